@@ -0,0 +1,32 @@
+#
+# Copyright 2022 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# - Find libbpf with AF_XDP (XSK) support
+# Find the libbpf includes and library
+# This module defines
+#  BPF_INCLUDE_DIR, where to find bpf/xsk.h
+#  BPF_LIBRARIES, the libraries needed to use AF_XDP sockets.
+#  BPF_FOUND, If false, do not try to use libbpf.
+# also defined, but not for general use are
+#  BPF_LIBRARY, where to find the libbpf library.
+
+find_package(PkgConfig)
+PKG_CHECK_MODULES(PC_BPF QUIET libbpf >= 0.2)
+
+find_path(BPF_INCLUDE_DIR bpf/xsk.h
+	HINTS $ENV{BPF_DIR}/include ${PC_BPF_INCLUDE_DIR}
+)
+
+find_library(BPF_LIBRARY
+	NAMES bpf libbpf
+	HINTS $ENV{BPF_DIR}/lib ${PC_BPF_LIBDIR} ${PC_BPF_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(BPF DEFAULT_MSG BPF_LIBRARY BPF_INCLUDE_DIR)
+mark_as_advanced(BPF_INCLUDE_DIR BPF_LIBRARY)
+
+set(BPF_LIBRARIES ${BPF_LIBRARY})
+set(BPF_INCLUDE_DIRS ${BPF_INCLUDE_DIR})
@@ -0,0 +1,32 @@
+#
+# Copyright 2022 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# - Find liburing
+# Find the liburing includes and library
+# This module defines
+#  URING_INCLUDE_DIR, where to find liburing.h
+#  URING_LIBRARIES, the libraries needed to use io_uring.
+#  URING_FOUND, If false, do not try to use liburing.
+# also defined, but not for general use are
+#  URING_LIBRARY, where to find the liburing library.
+
+find_package(PkgConfig)
+PKG_CHECK_MODULES(PC_URING QUIET liburing >= 0.7)
+
+find_path(URING_INCLUDE_DIR liburing.h
+	HINTS $ENV{URING_DIR}/include ${PC_URING_INCLUDE_DIR}
+)
+
+find_library(URING_LIBRARY
+	NAMES uring liburing
+	HINTS $ENV{URING_DIR}/lib ${PC_URING_LIBDIR} ${PC_URING_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(URING DEFAULT_MSG URING_LIBRARY URING_INCLUDE_DIR)
+mark_as_advanced(URING_INCLUDE_DIR URING_LIBRARY)
+
+set(URING_LIBRARIES ${URING_LIBRARY})
+set(URING_INCLUDE_DIRS ${URING_INCLUDE_DIR})
@@ -88,32 +88,55 @@ T to_clean_num(const T num)
     return ((num < 0) ? -1 : 1) * clean * pow10;
 }
 
-//! Compute an FFT with pre-computed factors using Cooley-Tukey
-template <typename T>
-std::complex<T> ct_fft_f(const std::complex<T>* samps,
-    size_t nsamps,
-    const std::complex<T>* factors,
-    size_t start = 0,
-    size_t step  = 1)
+//! Reverse the lowest nbits bits of val
+inline size_t reverse_bits(size_t val, size_t nbits)
 {
-    if (nsamps == 1)
-        return samps[start];
-    std::complex<T> E_k = ct_fft_f(samps, nsamps / 2, factors + 1, start, step * 2);
-    std::complex<T> O_k =
-        ct_fft_f(samps, nsamps / 2, factors + 1, start + step, step * 2);
-    return E_k + factors[0] * O_k;
+    size_t rev = 0;
+    for (size_t i = 0; i < nbits; i++) {
+        rev = (rev << 1) | ((val >> i) & 1);
+    }
+    return rev;
 }
 
-//! Compute an FFT for a particular bin k using Cooley-Tukey
+//! Compute an in-place FFT using iterative radix-2 Cooley-Tukey.
+//  All bins are produced in one O(N log N) pass, and the butterflies in
+//  each stage walk contiguous memory with loop-invariant twiddles so the
+//  compiler can vectorize them.
 template <typename T>
-std::complex<T> ct_fft_k(const std::complex<T>* samps, size_t nsamps, size_t k)
+void ct_fft_inplace(std::complex<T>* samps, size_t nsamps)
 {
-    // pre-compute the factors to use in Cooley-Tukey
-    std::vector<std::complex<T>> factors;
-    for (size_t N = nsamps; N != 0; N /= 2) {
-        factors.push_back(std::exp(std::complex<T>(0, T(-2 * pi * k / N))));
+    size_t log2_n = 0;
+    while ((size_t(1) << log2_n) < nsamps) {
+        log2_n++;
+    }
+
+    // bit-reversal permutation brings the output into natural bin order
+    for (size_t i = 0; i < nsamps; i++) {
+        const size_t j = reverse_bits(i, log2_n);
+        if (i < j) {
+            std::swap(samps[i], samps[j]);
+        }
+    }
+
+    // pre-compute one full table of twiddle factors; each stage strides
+    // through it instead of calling exp() inside the butterfly loops
+    std::vector<std::complex<T>> twiddles(nsamps / 2);
+    for (size_t k = 0; k < nsamps / 2; k++) {
+        twiddles[k] = std::exp(std::complex<T>(0, T(-2 * pi * k / nsamps)));
+    }
+
+    for (size_t len = 2; len <= nsamps; len *= 2) {
+        const size_t stride = nsamps / len;
+        for (size_t base = 0; base < nsamps; base += len) {
+            for (size_t k = 0; k < len / 2; k++) {
+                const std::complex<T> odd_k = twiddles[k * stride] //
+                                              * samps[base + len / 2 + k];
+                const std::complex<T> even_k = samps[base + k];
+                samps[base + k]              = even_k + odd_k;
+                samps[base + len / 2 + k]    = even_k - odd_k;
+            }
+        }
     }
-    return ct_fft_f(samps, nsamps, &factors.front());
 }
 
 //! Helper class to build a DFT plot frame
@@ -213,12 +236,12 @@ log_pwr_dft_type log_pwr_dft(const std::complex<T>* samps, size_t nsamps)
         win_pwr += w_n * w_n;
     }
 
-    // compute the log-power dft
+    // compute the log-power dft (windowing was fused into the load above)
+    ct_fft_inplace(&win_samps.front(), nsamps);
     log_pwr_dft_type log_pwr_dft;
     for (size_t k = 0; k < nsamps; k++) {
-        std::complex<T> dft_k = ct_fft_k(&win_samps.front(), nsamps, k);
         log_pwr_dft.push_back(
-            float(+20 * std::log10(std::abs(dft_k)) - 20 * std::log10(T(nsamps))
+            float(+20 * std::log10(std::abs(win_samps[k])) - 20 * std::log10(T(nsamps))
                   - 10 * std::log10(win_pwr / nsamps) + 3));
     }
 
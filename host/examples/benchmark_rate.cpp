@@ -13,12 +13,17 @@
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
 #include <boost/thread/thread.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <complex>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace po = boost::program_options;
 using namespace std::chrono_literals;
@@ -32,16 +37,64 @@ using start_time_type = std::chrono::time_point<std::chrono::steady_clock>;
 /***********************************************************************
  * Test result variables
  **********************************************************************/
-unsigned long long num_overruns      = 0;
-unsigned long long num_underruns     = 0;
-unsigned long long num_rx_samps      = 0;
-unsigned long long num_tx_samps      = 0;
-unsigned long long num_dropped_samps = 0;
-unsigned long long num_seq_errors    = 0;
-unsigned long long num_seqrx_errors  = 0; // "D"s
-unsigned long long num_late_commands = 0;
-unsigned long long num_timeouts_rx   = 0;
-unsigned long long num_timeouts_tx   = 0;
+// With --multi_streamer several threads update these concurrently, so they
+// must be atomic
+std::atomic<unsigned long long> num_overruns{0};
+std::atomic<unsigned long long> num_underruns{0};
+std::atomic<unsigned long long> num_rx_samps{0};
+std::atomic<unsigned long long> num_tx_samps{0};
+std::atomic<unsigned long long> num_dropped_samps{0};
+std::atomic<unsigned long long> num_seq_errors{0};
+std::atomic<unsigned long long> num_seqrx_errors{0}; // "D"s
+std::atomic<unsigned long long> num_late_commands{0};
+std::atomic<unsigned long long> num_timeouts_rx{0};
+std::atomic<unsigned long long> num_timeouts_tx{0};
+
+/***********************************************************************
+ * Recv call latency capture
+ **********************************************************************/
+//! Wall-clock duration of every recv() call on one streamer thread.
+//  Scheduling jitter and transport stalls show up as tail percentiles.
+struct latency_stats_t
+{
+    void record(const std::chrono::steady_clock::duration& delta)
+    {
+        call_times_ns.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(delta).count());
+    }
+
+    //! Return the given percentile (0.0 - 100.0) in microseconds.
+    //  Requires call_times_ns to be sorted.
+    double percentile_usec(const double pct) const
+    {
+        if (call_times_ns.empty()) {
+            return 0.0;
+        }
+        const size_t index =
+            std::min(call_times_ns.size() - 1, size_t(pct / 100.0 * call_times_ns.size()));
+        return call_times_ns[index] / 1e3;
+    }
+
+    std::vector<uint64_t> call_times_ns;
+};
+
+std::mutex latency_results_mutex;
+std::vector<std::pair<std::string, latency_stats_t>> latency_results;
+
+//! Publishes a thread's latency capture into the global result list on scope
+//  exit, whichever return path the streamer thread takes
+struct latency_publisher_t
+{
+    ~latency_publisher_t()
+    {
+        std::sort(stats.call_times_ns.begin(), stats.call_times_ns.end());
+        std::lock_guard<std::mutex> lock(latency_results_mutex);
+        latency_results.emplace_back(name, std::move(stats));
+    }
+
+    std::string name;
+    latency_stats_t stats;
+};
 
 inline auto time_delta(const start_time_type& ref_time)
 {
@@ -74,11 +127,18 @@ void benchmark_rx_rate(uhd::usrp::multi_usrp::sptr usrp,
     const start_time_type& start_time,
     std::atomic<bool>& burst_timer_elapsed,
     bool elevate_priority,
-    double rx_delay)
+    double rx_delay,
+    const std::string& stream_name,
+    const std::vector<size_t>& cpu_affinity)
 {
     if (elevate_priority) {
         uhd::set_thread_priority_safe();
     }
+    if (not cpu_affinity.empty()) {
+        uhd::set_thread_affinity(cpu_affinity);
+    }
+    latency_publisher_t latency{stream_name, {}};
+    latency.stats.call_times_ns.reserve(65536);
 
     // print pre-test summary
     auto time_stamp   = NOW();
@@ -119,8 +179,10 @@ void benchmark_rx_rate(uhd::usrp::multi_usrp::sptr usrp,
             rx_stream->issue_stream_cmd(cmd);
         }
         try {
+            const auto recv_start = std::chrono::steady_clock::now();
             num_rx_samps += rx_stream->recv(buffs, max_samps_per_packet, md, recv_timeout)
                             * rx_stream->get_num_channels();
+            latency.stats.record(std::chrono::steady_clock::now() - recv_start);
             recv_timeout = burst_pkt_time;
         } catch (uhd::io_error& e) {
             std::cerr << "[" << NOW() << "] Caught an IO exception. " << std::endl;
@@ -206,11 +268,15 @@ void benchmark_tx_rate(uhd::usrp::multi_usrp::sptr usrp,
     const size_t spp,
     bool elevate_priority,
     double tx_delay,
+    const std::vector<size_t>& cpu_affinity,
     bool random_nsamps = false)
 {
     if (elevate_priority) {
         uhd::set_thread_priority_safe();
     }
+    if (not cpu_affinity.empty()) {
+        uhd::set_thread_affinity(cpu_affinity);
+    }
 
     // print pre-test summary
     auto time_stamp   = NOW();
@@ -334,6 +400,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     double tx_delay, rx_delay;
     std::string priority;
     bool elevate_priority = false;
+    bool multi_streamer   = false;
+    std::string rx_cpu_affinity, tx_cpu_affinity;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -372,6 +440,11 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("tx_delay", po::value<double>(&tx_delay)->default_value(0.25), "delay before starting TX in seconds")
         ("rx_delay", po::value<double>(&rx_delay)->default_value(0.05), "delay before starting RX in seconds")
         ("priority", po::value<std::string>(&priority)->default_value("normal"), "thread priority (normal, high)")
+        ("multi_streamer", "Create a separate streamer and thread per channel instead of one streamer for all channels")
+        ("rx_cpu_affinity", po::value<std::string>(&rx_cpu_affinity)->default_value(""),
+         "comma-separated list of CPU cores; RX streamer threads are pinned to these round-robin")
+        ("tx_cpu_affinity", po::value<std::string>(&tx_cpu_affinity)->default_value(""),
+         "comma-separated list of CPU cores; TX streamer threads are pinned to these round-robin")
     ;
     // clang-format on
     po::variables_map vm;
@@ -400,6 +473,22 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         random_nsamps = true;
     }
 
+    multi_streamer = vm.count("multi_streamer") > 0;
+
+    auto parse_cpu_list = [](const std::string& cpu_list) {
+        std::vector<size_t> cpus;
+        if (not cpu_list.empty()) {
+            std::vector<std::string> cpu_strings;
+            boost::split(cpu_strings, cpu_list, boost::is_any_of("\"',"));
+            for (const std::string& cpu : cpu_strings) {
+                cpus.push_back(std::stoul(cpu));
+            }
+        }
+        return cpus;
+    };
+    const std::vector<size_t> rx_cpu_cores = parse_cpu_list(rx_cpu_affinity);
+    const std::vector<size_t> tx_cpu_cores = parse_cpu_list(tx_cpu_affinity);
+
     // create a usrp device
     std::cout << std::endl;
     uhd::device_addrs_t device_addrs = uhd::device::find(args, uhd::device::USRP);
@@ -527,61 +616,97 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         usrp->set_time_now(0.0);
     }
 
-    // spawn the receive test thread
+    // spawn the receive test thread(s)
     if (vm.count("rx_rate")) {
         usrp->set_rx_rate(rx_rate);
         if (vm.count("rx_spp")) {
             std::cout << boost::format("Setting RX spp to %u\n") % rx_spp;
             usrp->set_rx_spp(rx_spp);
         }
-        // create a receive streamer
-        uhd::stream_args_t stream_args(rx_cpu, rx_otw);
-        stream_args.channels             = rx_channel_nums;
-        stream_args.args                 = uhd::device_addr_t(rx_stream_args);
-        uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
-        auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-            benchmark_rx_rate(usrp,
-                rx_cpu,
-                rx_stream,
-                random_nsamps,
-                start_time,
-                burst_timer_elapsed,
-                elevate_priority,
-                rx_delay);
-        });
-        uhd::set_thread_name(rx_thread, "bmark_rx_stream");
+        // With --multi_streamer every RX channel gets its own streamer and
+        // thread; otherwise a single streamer serves all channels.
+        std::vector<std::vector<size_t>> rx_streamer_channels;
+        if (multi_streamer) {
+            for (const size_t chan : rx_channel_nums) {
+                rx_streamer_channels.push_back({chan});
+            }
+        } else {
+            rx_streamer_channels.push_back(rx_channel_nums);
+        }
+        for (size_t i = 0; i < rx_streamer_channels.size(); i++) {
+            // create a receive streamer
+            uhd::stream_args_t stream_args(rx_cpu, rx_otw);
+            stream_args.channels             = rx_streamer_channels[i];
+            stream_args.args                 = uhd::device_addr_t(rx_stream_args);
+            uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
+            const std::string stream_name = str(boost::format("RX streamer %u") % i);
+            std::vector<size_t> cpu_affinity;
+            if (not rx_cpu_cores.empty()) {
+                cpu_affinity.push_back(rx_cpu_cores[i % rx_cpu_cores.size()]);
+            }
+            auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
+                benchmark_rx_rate(usrp,
+                    rx_cpu,
+                    rx_stream,
+                    random_nsamps,
+                    start_time,
+                    burst_timer_elapsed,
+                    elevate_priority,
+                    rx_delay,
+                    stream_name,
+                    cpu_affinity);
+            });
+            uhd::set_thread_name(rx_thread, str(boost::format("bmark_rx_%u") % i));
+        }
     }
 
-    // spawn the transmit test thread
+    // spawn the transmit test thread(s)
     if (vm.count("tx_rate")) {
         usrp->set_tx_rate(tx_rate);
-        // create a transmit streamer
-        uhd::stream_args_t stream_args(tx_cpu, tx_otw);
-        stream_args.channels             = tx_channel_nums;
-        stream_args.args                 = uhd::device_addr_t(tx_stream_args);
-        uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
-        const size_t max_spp             = tx_stream->get_max_num_samps();
-        size_t spp                       = max_spp;
-        if (vm.count("tx_spp")) {
-            spp = std::min(spp, tx_spp);
+        std::vector<std::vector<size_t>> tx_streamer_channels;
+        if (multi_streamer) {
+            for (const size_t chan : tx_channel_nums) {
+                tx_streamer_channels.push_back({chan});
+            }
+        } else {
+            tx_streamer_channels.push_back(tx_channel_nums);
+        }
+        for (size_t i = 0; i < tx_streamer_channels.size(); i++) {
+            // create a transmit streamer
+            uhd::stream_args_t stream_args(tx_cpu, tx_otw);
+            stream_args.channels             = tx_streamer_channels[i];
+            stream_args.args                 = uhd::device_addr_t(tx_stream_args);
+            uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
+            const size_t max_spp             = tx_stream->get_max_num_samps();
+            size_t spp                       = max_spp;
+            if (vm.count("tx_spp")) {
+                spp = std::min(spp, tx_spp);
+            }
+            std::cout << boost::format("Setting TX spp to %u\n") % spp;
+            std::vector<size_t> cpu_affinity;
+            if (not tx_cpu_cores.empty()) {
+                cpu_affinity.push_back(tx_cpu_cores[i % tx_cpu_cores.size()]);
+            }
+            auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
+                benchmark_tx_rate(usrp,
+                    tx_cpu,
+                    tx_stream,
+                    burst_timer_elapsed,
+                    start_time,
+                    spp,
+                    elevate_priority,
+                    tx_delay,
+                    cpu_affinity,
+                    random_nsamps);
+            });
+            uhd::set_thread_name(tx_thread, str(boost::format("bmark_tx_%u") % i));
+            auto tx_async_thread =
+                thread_group.create_thread([=, &burst_timer_elapsed]() {
+                    benchmark_tx_rate_async_helper(
+                        tx_stream, start_time, burst_timer_elapsed);
+                });
+            uhd::set_thread_name(tx_async_thread, str(boost::format("bmark_tx_h%u") % i));
         }
-        std::cout << boost::format("Setting TX spp to %u\n") % spp;
-        auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-            benchmark_tx_rate(usrp,
-                tx_cpu,
-                tx_stream,
-                burst_timer_elapsed,
-                start_time,
-                spp,
-                elevate_priority,
-                tx_delay,
-                random_nsamps);
-        });
-        uhd::set_thread_name(tx_thread, "bmark_tx_stream");
-        auto tx_async_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-            benchmark_tx_rate_async_helper(tx_stream, start_time, burst_timer_elapsed);
-        });
-        uhd::set_thread_name(tx_async_thread, "bmark_tx_helper");
     }
 
     // sleep for the required duration (add any initial delay)
@@ -625,10 +750,28 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                                "  Num late commands:        %u\n"
                                "  Num timeouts (Tx):        %u\n"
                                "  Num timeouts (Rx):        %u\n")
-                     % num_rx_samps % num_dropped_samps % num_overruns % num_tx_samps
-                     % num_seq_errors % num_seqrx_errors % num_underruns
-                     % num_late_commands % num_timeouts_tx % num_timeouts_rx
+                     % num_rx_samps.load() % num_dropped_samps.load()
+                     % num_overruns.load() % num_tx_samps.load() % num_seq_errors.load()
+                     % num_seqrx_errors.load() % num_underruns.load()
+                     % num_late_commands.load() % num_timeouts_tx.load()
+                     % num_timeouts_rx.load()
               << std::endl;
+
+    // print per-thread recv call latency percentiles
+    if (not latency_results.empty()) {
+        std::cout << "Recv call latency (usec):" << std::endl;
+        for (const auto& result : latency_results) {
+            const latency_stats_t& stats = result.second;
+            std::cout << boost::format(
+                             "  %s: p50 %8.1f  p99 %8.1f  p99.9 %8.1f  (%u calls)")
+                             % result.first % stats.percentile_usec(50.0)
+                             % stats.percentile_usec(99.0) % stats.percentile_usec(99.9)
+                             % stats.call_times_ns.size()
+                      << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
     // finished
     std::cout << std::endl << "Done!" << std::endl << std::endl;
 
@@ -636,23 +779,23 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         || seq_threshold_err) {
         std::cout << "The following error thresholds were exceeded:\n";
         if (overrun_threshold_err) {
-            std::cout << boost::format("  * Overruns (%d/%d)") % num_overruns
+            std::cout << boost::format("  * Overruns (%d/%d)") % num_overruns.load()
                              % overrun_threshold
                       << std::endl;
         }
         if (underrun_threshold_err) {
-            std::cout << boost::format("  * Underruns (%d/%d)") % num_underruns
+            std::cout << boost::format("  * Underruns (%d/%d)") % num_underruns.load()
                              % underrun_threshold
                       << std::endl;
         }
         if (drop_threshold_err) {
             std::cout << boost::format("  * Dropped packets (RX) (%d/%d)")
-                             % num_seqrx_errors % drop_threshold
+                             % num_seqrx_errors.load() % drop_threshold
                       << std::endl;
         }
         if (seq_threshold_err) {
             std::cout << boost::format("  * Dropped packets (TX) (%d/%d)")
-                             % num_seq_errors % seq_threshold
+                             % num_seq_errors.load() % seq_threshold
                       << std::endl;
         }
         return EXIT_FAILURE;
@@ -0,0 +1,146 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Benchmark the registered sample converters.
+//
+// This example times every conversion in the converter registry across a
+// range of buffer sizes and prints the achieved rate in Msps. It needs no
+// hardware, so it can be used to validate that the SIMD converter paths
+// selected on a given machine perform as expected before deployment.
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+namespace {
+
+//! Benchmark a single converter for one buffer size, returns Msps
+double benchmark_converter(
+    const uhd::convert::id_type& id, const size_t nsamps, const size_t iters)
+{
+    const size_t bytes_per_in_item  = uhd::convert::get_bytes_per_item(id.input_format);
+    const size_t bytes_per_out_item = uhd::convert::get_bytes_per_item(id.output_format);
+
+    // Allocate slightly oversized buffers so converters with a vector body
+    // and packed formats (e.g. sc12) never read or write out of bounds.
+    const size_t slack = 64;
+    std::vector<std::vector<char>> in_buffs(
+        id.num_inputs, std::vector<char>(nsamps * bytes_per_in_item + slack));
+    std::vector<std::vector<char>> out_buffs(
+        id.num_outputs, std::vector<char>(nsamps * bytes_per_out_item + slack));
+
+    std::vector<const void*> in_ptrs;
+    std::vector<void*> out_ptrs;
+    for (auto& buff : in_buffs) {
+        // 0x3f bytes make valid, mid-range values for all sample formats
+        std::memset(buff.data(), 0x3f, buff.size());
+        in_ptrs.push_back(buff.data());
+    }
+    for (auto& buff : out_buffs) {
+        out_ptrs.push_back(buff.data());
+    }
+
+    uhd::convert::converter::sptr conv = uhd::convert::get_converter(id)();
+    conv->set_scalar(1.0);
+
+    // warm up caches and the branch predictors before timing
+    conv->conv(in_ptrs, out_ptrs, nsamps);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iters; i++) {
+        conv->conv(in_ptrs, out_ptrs, nsamps);
+    }
+    const auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start)
+                             .count();
+
+    return double(nsamps * iters) / elapsed / 1e6;
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string filter;
+    std::string sizes_str;
+    size_t bytes_per_run;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("filter", po::value<std::string>(&filter)->default_value(""), "only benchmark conversion IDs containing this substring")
+        ("sizes", po::value<std::string>(&sizes_str)->default_value("1024,4096,16384,262144"), "comma-separated buffer sizes in samples")
+        ("bytes-per-run", po::value<size_t>(&bytes_per_run)->default_value(size_t(1) << 28), "approximate bytes to convert per measurement")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << "UHD Converter Benchmark " << desc << std::endl;
+        std::cout << "    Times every registered converter across the given\n"
+                     "    buffer sizes and prints the rate in Msps.\n"
+                  << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<size_t> sizes;
+    for (size_t pos = 0; pos != std::string::npos;) {
+        const size_t next = sizes_str.find(',', pos);
+        sizes.push_back(std::stoul(sizes_str.substr(pos, next - pos)));
+        pos = (next == std::string::npos) ? next : next + 1;
+    }
+
+    std::vector<uhd::convert::id_type> ids = uhd::convert::get_ids();
+    std::sort(ids.begin(), ids.end(),
+        [](const uhd::convert::id_type& lhs, const uhd::convert::id_type& rhs) {
+            return lhs.to_string() < rhs.to_string();
+        });
+
+    std::cout << boost::format("%-40s") % "conversion";
+    for (const size_t size : sizes) {
+        std::cout << boost::format("%12d") % size;
+    }
+    std::cout << std::endl;
+
+    for (const uhd::convert::id_type& id : ids) {
+        if (id.to_string().find(filter) == std::string::npos) {
+            continue;
+        }
+
+        size_t bytes_per_in_item;
+        try {
+            bytes_per_in_item = uhd::convert::get_bytes_per_item(id.input_format);
+            uhd::convert::get_bytes_per_item(id.output_format);
+        } catch (const uhd::key_error&) {
+            // formats without a registered item size cannot be sized here
+            continue;
+        }
+
+        std::cout << boost::format("%-40s") % id.to_string();
+        for (const size_t size : sizes) {
+            const size_t iters =
+                std::max<size_t>(1, bytes_per_run / (size * bytes_per_in_item));
+            std::cout << boost::format("%12.1f")
+                             % benchmark_converter(id, size, iters);
+        }
+        std::cout << " Msps" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
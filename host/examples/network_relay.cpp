@@ -15,10 +15,15 @@
 #include <chrono>
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <thread>
 #include <vector>
+#ifdef __linux__
+#    include <sys/socket.h>
+#endif
 
 namespace po   = boost::program_options;
 namespace asio = boost::asio;
@@ -27,6 +32,11 @@ typedef std::shared_ptr<asio::ip::udp::socket> socket_type;
 
 static const size_t insane_mtu = 9000;
 
+#ifdef __linux__
+// number of packets moved per recvmmsg/sendmmsg syscall
+static const size_t packets_per_batch = 32;
+#endif
+
 #if defined(UHD_PLATFORM_MACOS)
 // limit buffer resize on macos or it will error
 const size_t rx_dsp_buff_size = size_t(1e6);
@@ -62,6 +72,69 @@ static bool wait_for_recv_ready(int sock_fd)
     return ::select(sock_fd + 1, &rset, NULL, NULL, &tv) > 0;
 }
 
+#ifdef __linux__
+/***********************************************************************
+ * Batched message buffers for recvmmsg/sendmmsg
+ **********************************************************************/
+struct msg_batch_type
+{
+    msg_batch_type()
+        : bufs(packets_per_batch, std::vector<char>(insane_mtu))
+        , iovs(packets_per_batch)
+        , msgs(packets_per_batch)
+        , src_addrs(packets_per_batch)
+    {
+        for (size_t i = 0; i < packets_per_batch; i++) {
+            iovs[i].iov_base = bufs[i].data();
+            std::memset(&msgs[i], 0, sizeof(mmsghdr));
+            msgs[i].msg_hdr.msg_iov    = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    //! Prepare headers for receiving a fresh batch
+    void reset_for_recv(void)
+    {
+        for (size_t i = 0; i < packets_per_batch; i++) {
+            iovs[i].iov_len              = insane_mtu;
+            msgs[i].msg_hdr.msg_name     = &src_addrs[i];
+            msgs[i].msg_hdr.msg_namelen  = sizeof(sockaddr_storage);
+            msgs[i].msg_hdr.msg_flags    = 0;
+        }
+    }
+
+    //! Prepare the first num_msgs headers for sending the received payloads
+    //  to the given destination (NULL for a connected socket)
+    void reset_for_send(const size_t num_msgs, sockaddr_storage* dest, socklen_t dest_len)
+    {
+        for (size_t i = 0; i < num_msgs; i++) {
+            iovs[i].iov_len             = msgs[i].msg_len;
+            msgs[i].msg_hdr.msg_name    = dest;
+            msgs[i].msg_hdr.msg_namelen = dest ? dest_len : 0;
+        }
+    }
+
+    std::vector<std::vector<char>> bufs;
+    std::vector<iovec> iovs;
+    std::vector<mmsghdr> msgs;
+    std::vector<sockaddr_storage> src_addrs;
+};
+
+//! Send all num_msgs messages of the batch, looping on partial sends
+static void send_batch(int sock_fd, msg_batch_type& batch, const size_t num_msgs)
+{
+    size_t num_sent = 0;
+    while (num_sent < num_msgs) {
+        const int ret =
+            ::sendmmsg(sock_fd, &batch.msgs[num_sent], num_msgs - num_sent, 0);
+        if (ret <= 0) {
+            return; // drop the rest of the batch rather than spin on errors
+        }
+        num_sent += ret;
+    }
+}
+#endif /* __linux__ */
+
 /***********************************************************************
  * Relay class
  **********************************************************************/
@@ -74,39 +147,64 @@ public:
         const size_t server_rx_size = 0,
         const size_t server_tx_size = 0,
         const size_t client_rx_size = 0,
-        const size_t client_tx_size = 0)
+        const size_t client_tx_size = 0,
+        const size_t num_workers    = 1)
         : _port(port)
     {
-        {
-            asio::ip::udp::resolver resolver(_io_service);
-            asio::ip::udp::resolver::query query(asio::ip::udp::v4(), server_addr, port);
-            asio::ip::udp::endpoint endpoint = *resolver.resolve(query);
-
-            _server_socket = std::shared_ptr<asio::ip::udp::socket>(
-                new asio::ip::udp::socket(_io_service, endpoint));
-            resize_buffs(_server_socket, server_rx_size, server_tx_size);
-        }
-        {
-            asio::ip::udp::resolver resolver(_io_service);
-            asio::ip::udp::resolver::query query(asio::ip::udp::v4(), client_addr, port);
-            asio::ip::udp::endpoint endpoint = *resolver.resolve(query);
+        asio::ip::udp::resolver resolver(_io_service);
+        asio::ip::udp::resolver::query server_query(
+            asio::ip::udp::v4(), server_addr, port);
+        const asio::ip::udp::endpoint server_endpoint = *resolver.resolve(server_query);
+        asio::ip::udp::resolver::query client_query(
+            asio::ip::udp::v4(), client_addr, port);
+        const asio::ip::udp::endpoint client_endpoint = *resolver.resolve(client_query);
+
+        // Each worker owns its own pair of sockets. With more than one
+        // worker, the server sockets share the port via SO_REUSEPORT and the
+        // kernel hashes incoming flows across them, so independent analysis
+        // hosts are served by independent threads.
+        for (size_t i = 0; i < num_workers; i++) {
+            std::shared_ptr<worker_type> worker(new worker_type());
 
-            _client_socket = std::shared_ptr<asio::ip::udp::socket>(
+            worker->server_socket = std::shared_ptr<asio::ip::udp::socket>(
                 new asio::ip::udp::socket(_io_service));
-            _client_socket->open(asio::ip::udp::v4());
-            _client_socket->connect(endpoint);
-            resize_buffs(_client_socket, client_rx_size, client_tx_size);
+            worker->server_socket->open(asio::ip::udp::v4());
+            if (num_workers > 1) {
+#ifdef __linux__
+                const int enable = 1;
+                ::setsockopt(worker->server_socket->native_handle(),
+                    SOL_SOCKET,
+                    SO_REUSEPORT,
+                    &enable,
+                    sizeof(enable));
+#else
+                throw std::runtime_error(
+                    "Multiple workers require SO_REUSEPORT (Linux only)");
+#endif
+            }
+            resize_buffs(worker->server_socket, server_rx_size, server_tx_size);
+            worker->server_socket->bind(server_endpoint);
+
+            worker->client_socket = std::shared_ptr<asio::ip::udp::socket>(
+                new asio::ip::udp::socket(_io_service));
+            worker->client_socket->open(asio::ip::udp::v4());
+            worker->client_socket->connect(client_endpoint);
+            resize_buffs(worker->client_socket, client_rx_size, client_tx_size);
+
+            _workers.push_back(worker);
         }
 
         std::cout << "spawning relay threads... " << _port << std::endl;
         boost::unique_lock<boost::mutex> lock(
             spawn_mutex); // lock in preparation to wait for threads to spawn
-        (void)_thread_group.create_thread(
-            std::bind(&udp_relay_type::server_thread, this));
-        wait_for_thread.wait(lock); // wait for thread to spin up
-        (void)_thread_group.create_thread(
-            std::bind(&udp_relay_type::client_thread, this));
-        wait_for_thread.wait(lock); // wait for thread to spin up
+        for (const auto& worker : _workers) {
+            (void)_thread_group.create_thread(
+                std::bind(&udp_relay_type::server_thread, this, worker));
+            wait_for_thread.wait(lock); // wait for thread to spin up
+            (void)_thread_group.create_thread(
+                std::bind(&udp_relay_type::client_thread, this, worker));
+            wait_for_thread.wait(lock); // wait for thread to spin up
+        }
         std::cout << "    done!" << std::endl << std::endl;
     }
 
@@ -119,6 +217,14 @@ public:
     }
 
 private:
+    //! Socket pair and return endpoint state for one worker thread pair
+    struct worker_type
+    {
+        socket_type server_socket, client_socket;
+        asio::ip::udp::endpoint endpoint; // source of the last packet received
+        boost::mutex endpoint_mutex;
+    };
+
     static void resize_buffs(socket_type sock, const size_t rx_size, const size_t tx_size)
     {
         if (rx_size != 0)
@@ -127,56 +233,99 @@ private:
             sock->set_option(asio::socket_base::send_buffer_size(tx_size));
     }
 
-    void server_thread(void)
+    void server_thread(std::shared_ptr<worker_type> worker)
     {
         std::cout << "    entering server_thread..." << std::endl;
         wait_for_thread.notify_one(); // notify constructor that this thread has started
+#ifdef __linux__
+        // Batched data path: drain a batch of packets per syscall and relay
+        // it with a single sendmmsg, instead of two syscalls per packet
+        msg_batch_type batch;
+        while (not boost::this_thread::interruption_requested()) {
+            if (not wait_for_recv_ready(worker->server_socket->native_handle())) {
+                continue;
+            }
+            batch.reset_for_recv();
+            const int num_pkts = ::recvmmsg(worker->server_socket->native_handle(),
+                batch.msgs.data(),
+                packets_per_batch,
+                MSG_DONTWAIT,
+                NULL);
+            if (num_pkts <= 0) {
+                continue;
+            }
+            {
+                boost::mutex::scoped_lock lock(worker->endpoint_mutex);
+                std::memcpy(worker->endpoint.data(),
+                    &batch.src_addrs[num_pkts - 1],
+                    sizeof(sockaddr_in));
+            }
+            batch.reset_for_send(num_pkts, NULL, 0);
+            send_batch(worker->client_socket->native_handle(), batch, num_pkts);
+        }
+#else
         std::vector<char> buff(insane_mtu);
         while (not boost::this_thread::interruption_requested()) {
-            if (wait_for_recv_ready(_server_socket->native_handle())) {
-                boost::mutex::scoped_lock lock(_endpoint_mutex);
-                const size_t len = _server_socket->receive_from(
-                    asio::buffer(&buff.front(), buff.size()), _endpoint);
+            if (wait_for_recv_ready(worker->server_socket->native_handle())) {
+                boost::mutex::scoped_lock lock(worker->endpoint_mutex);
+                const size_t len = worker->server_socket->receive_from(
+                    asio::buffer(&buff.front(), buff.size()), worker->endpoint);
                 lock.unlock();
-                _client_socket->send(asio::buffer(&buff.front(), len));
-
-                // perform sequence error detection on tx dsp data (can detect bad network
-                // cards)
-                /*
-                if (_port[4] == '7'){
-                    static uint32_t next_seq;
-                    const uint32_t this_seq = ntohl(reinterpret_cast<const uint32_t
-                *>(&buff.front())[0]); if (next_seq != this_seq and this_seq != 0)
-                std::cout << "S" << std::flush; next_seq = this_seq + 1;
-                }
-                */
+                worker->client_socket->send(asio::buffer(&buff.front(), len));
             }
         }
+#endif
         std::cout << "    exiting server_thread..." << std::endl;
     }
 
-    void client_thread(void)
+    void client_thread(std::shared_ptr<worker_type> worker)
     {
         std::cout << "    entering client_thread..." << std::endl;
         wait_for_thread.notify_one(); // notify constructor that this thread has started
+#ifdef __linux__
+        msg_batch_type batch;
+        while (not boost::this_thread::interruption_requested()) {
+            if (not wait_for_recv_ready(worker->client_socket->native_handle())) {
+                continue;
+            }
+            batch.reset_for_recv();
+            const int num_pkts = ::recvmmsg(worker->client_socket->native_handle(),
+                batch.msgs.data(),
+                packets_per_batch,
+                MSG_DONTWAIT,
+                NULL);
+            if (num_pkts <= 0) {
+                continue;
+            }
+            sockaddr_storage dest;
+            socklen_t dest_len;
+            {
+                boost::mutex::scoped_lock lock(worker->endpoint_mutex);
+                dest_len = socklen_t(worker->endpoint.size());
+                std::memcpy(&dest, worker->endpoint.data(), dest_len);
+            }
+            batch.reset_for_send(num_pkts, &dest, dest_len);
+            send_batch(worker->server_socket->native_handle(), batch, num_pkts);
+        }
+#else
         std::vector<char> buff(insane_mtu);
         while (not boost::this_thread::interruption_requested()) {
-            if (wait_for_recv_ready(_client_socket->native_handle())) {
-                const size_t len =
-                    _client_socket->receive(asio::buffer(&buff.front(), buff.size()));
-                boost::mutex::scoped_lock lock(_endpoint_mutex);
-                _server_socket->send_to(asio::buffer(&buff.front(), len), _endpoint);
+            if (wait_for_recv_ready(worker->client_socket->native_handle())) {
+                const size_t len = worker->client_socket->receive(
+                    asio::buffer(&buff.front(), buff.size()));
+                boost::mutex::scoped_lock lock(worker->endpoint_mutex);
+                worker->server_socket->send_to(
+                    asio::buffer(&buff.front(), len), worker->endpoint);
             }
         }
+#endif
         std::cout << "    exiting client_thread..." << std::endl;
     }
 
     const std::string _port;
     boost::thread_group _thread_group;
     asio::io_service _io_service;
-    asio::ip::udp::endpoint _endpoint;
-    boost::mutex _endpoint_mutex;
-    socket_type _server_socket, _client_socket;
+    std::vector<std::shared_ptr<worker_type>> _workers;
     boost::mutex spawn_mutex;
     boost::condition_variable wait_for_thread;
 };
@@ -190,6 +339,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // variables to be set by po
     std::string addr;
     std::string bind;
+    size_t workers;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -198,6 +348,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("help", "help message")
         ("addr", po::value<std::string>(&addr), "the resolvable address of the usrp (must be specified)")
         ("bind", po::value<std::string>(&bind)->default_value("0.0.0.0"), "bind the server to this network address (default: any)")
+        ("workers", po::value<size_t>(&workers)->default_value(1), "worker thread pairs per streaming port; incoming flows are hashed across workers (>1 requires Linux)")
     ;
     // clang-format on
     po::variables_map vm;
@@ -209,20 +360,26 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         std::cout << boost::format("UHD Network Relay %s") % desc << std::endl
                   << "Runs a network relay between UHD on one computer and a USRP on the "
                      "network.\n"
-                  << "This example is basically for test purposes. Use at your own "
-                     "convenience.\n"
+                  << "On Linux, packets are moved in batches (recvmmsg/sendmmsg), and\n"
+                  << "--workers spreads independent flows over multiple threads, so the\n"
+                  << "relay can fan out CHDR streams at 10GbE rates.\n"
                   << std::endl;
         return EXIT_FAILURE;
     }
 
+    if (workers == 0) {
+        std::cerr << "Number of workers must be at least 1" << std::endl;
+        return EXIT_FAILURE;
+    }
+
     {
         std::shared_ptr<udp_relay_type> ctrl(new udp_relay_type(bind, addr, "49152"));
         std::shared_ptr<udp_relay_type> rxdsp0(new udp_relay_type(
-            bind, addr, "49156", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0));
+            bind, addr, "49156", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0, workers));
         std::shared_ptr<udp_relay_type> txdsp0(new udp_relay_type(
-            bind, addr, "49157", tx_dsp_buff_size, 0, 0, tx_dsp_buff_size));
+            bind, addr, "49157", tx_dsp_buff_size, 0, 0, tx_dsp_buff_size, workers));
         std::shared_ptr<udp_relay_type> rxdsp1(new udp_relay_type(
-            bind, addr, "49158", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0));
+            bind, addr, "49158", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0, workers));
         std::shared_ptr<udp_relay_type> gps(new udp_relay_type(bind, addr, "49172"));
 
         std::signal(SIGINT, &sig_int_handler);
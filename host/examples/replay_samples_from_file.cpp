@@ -20,6 +20,12 @@
 #include <csignal>
 #include <fstream>
 #include <thread>
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 
 namespace po = boost::program_options;
@@ -231,30 +237,54 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     ///////////////////////////////////////////////////////////////////////////
     // Read the data to replay
 
-    // Open the file
-    std::ifstream infile(file.c_str(), std::ifstream::binary);
-    if (!infile.is_open()) {
-        std::cerr << "Could not open specified file" << std::endl;
-        return EXIT_FAILURE;
+    size_t file_size = 0;
+    std::vector<char> tx_buffer;
+    const char* tx_buf_ptr = NULL;
+#ifndef _WIN32
+    // Map the file instead of copying it into a buffer: the data is uploaded
+    // straight from the mapped region, and MADV_SEQUENTIAL lets the OS
+    // prefetch ahead of the upload cursor. For multi-GB waveform files this
+    // avoids holding a second copy of the file in anonymous memory.
+    const int infile_fd = ::open(file.c_str(), O_RDONLY);
+    void* file_mapping  = MAP_FAILED;
+    if (infile_fd >= 0) {
+        struct stat file_stat;
+        if (::fstat(infile_fd, &file_stat) == 0 and file_stat.st_size > 0) {
+            file_mapping =
+                ::mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, infile_fd, 0);
+            if (file_mapping != MAP_FAILED) {
+                file_size = size_t(file_stat.st_size);
+                ::madvise(file_mapping, file_size, MADV_SEQUENTIAL);
+                tx_buf_ptr = static_cast<const char*>(file_mapping);
+            }
+        }
+        ::close(infile_fd);
+    }
+#endif
+    if (tx_buf_ptr == NULL) {
+        // Buffered fallback (also the Windows path)
+        std::ifstream infile(file.c_str(), std::ifstream::binary);
+        if (!infile.is_open()) {
+            std::cerr << "Could not open specified file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // Get the file size
+        infile.seekg(0, std::ios::end);
+        file_size = infile.tellg();
+        infile.seekg(0, std::ios::beg);
+
+        // Read file into buffer, rounded down to number of words
+        tx_buffer.resize(file_size / replay_word_size * replay_word_size);
+        infile.read(&tx_buffer[0], tx_buffer.size());
+        infile.close();
+        tx_buf_ptr = &tx_buffer[0];
     }
-
-    // Get the file size
-    infile.seekg(0, std::ios::end);
-    size_t file_size = infile.tellg();
-    infile.seekg(0, std::ios::beg);
 
     // Calculate the number of 64-bit words and samples to replay
     size_t words_to_replay   = file_size / replay_word_size;
     size_t samples_to_replay = words_to_replay * replay_word_size / bytes_per_sample;
 
-    // Create buffer
-    std::vector<char> tx_buffer(words_to_replay * replay_word_size);
-    char* tx_buf_ptr = &tx_buffer[0];
-
-    // Read file into buffer, rounded down to number of words
-    infile.read(tx_buf_ptr, words_to_replay * replay_word_size);
-    infile.close();
-
 
     ///////////////////////////////////////////////////////////////////////////
     // Configure replay block
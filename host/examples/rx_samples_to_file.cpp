@@ -16,9 +16,20 @@
 #include <chrono>
 #include <complex>
 #include <csignal>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <thread>
+#ifdef __linux__
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <cerrno>
+#    include <cstdlib>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
 
 namespace po = boost::program_options;
 
@@ -28,6 +39,241 @@ void sig_int_handler(int)
     stop_signal_called = true;
 }
 
+/***********************************************************************
+ * File sink backends
+ *
+ * The default ("buffered") backend writes through std::ofstream, i.e.
+ * through the page cache. The "direct" backend (Linux only) opens the
+ * file with O_DIRECT and hands filled, block-aligned buffers to a writer
+ * thread through a queue of configurable depth. That keeps page cache
+ * writeback stalls out of the receive loop, which matters when recording
+ * at rates close to what the disk can sustain.
+ **********************************************************************/
+class file_sink
+{
+public:
+    virtual ~file_sink() {}
+
+    //! Append nbytes of data to the file
+    virtual void write(const char* data, size_t nbytes) = 0;
+
+    //! Flush and close the file. Throws if a write failed asynchronously.
+    virtual void close() = 0;
+
+    size_t get_bytes_written() const
+    {
+        return _bytes_written;
+    }
+
+protected:
+    size_t _bytes_written = 0;
+};
+
+class buffered_file_sink : public file_sink
+{
+public:
+    buffered_file_sink(const std::string& path)
+    {
+        _outfile.open(path.c_str(), std::ofstream::binary);
+        if (not _outfile.is_open()) {
+            throw std::runtime_error("Could not open file for writing: " + path);
+        }
+    }
+
+    void write(const char* data, size_t nbytes) override
+    {
+        _outfile.write(data, nbytes);
+        _bytes_written += nbytes;
+    }
+
+    void close() override
+    {
+        _outfile.close();
+    }
+
+private:
+    std::ofstream _outfile;
+};
+
+#ifdef __linux__
+class direct_file_sink : public file_sink
+{
+public:
+    //! O_DIRECT requires the buffer address, buffer size and file offset to
+    //  be aligned to the logical block size; 4096 covers all common devices.
+    static constexpr size_t ALIGNMENT = 4096;
+
+    direct_file_sink(const std::string& path, size_t buffer_size, size_t queue_depth)
+    {
+        _buffer_size = std::max<size_t>(1, (buffer_size + ALIGNMENT - 1) / ALIGNMENT)
+                       * ALIGNMENT;
+        _fd = ::open(
+            path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT | O_CLOEXEC, 0644);
+        if (_fd < 0) {
+            throw std::runtime_error("direct backend: could not open " + path + ": "
+                                     + std::string(std::strerror(errno)));
+        }
+        for (size_t i = 0; i < std::max<size_t>(2, queue_depth); i++) {
+            void* mem = nullptr;
+            if (::posix_memalign(&mem, ALIGNMENT, _buffer_size)) {
+                throw std::runtime_error(
+                    "direct backend: could not allocate aligned buffers");
+            }
+            _all_buffs.push_back(static_cast<char*>(mem));
+            _free_buffs.push_back(static_cast<char*>(mem));
+        }
+        _fill_buff = _acquire_buffer();
+        _writer    = std::thread([this]() { _writer_loop(); });
+    }
+
+    ~direct_file_sink() override
+    {
+        try {
+            close();
+        } catch (...) {
+            // errors were either already reported by close(), or there is
+            // nobody left to report them to
+        }
+        for (char* buff : _all_buffs) {
+            ::free(buff);
+        }
+    }
+
+    void write(const char* data, size_t nbytes) override
+    {
+        _bytes_written += nbytes;
+        while (nbytes > 0) {
+            const size_t num_copy = std::min(nbytes, _buffer_size - _fill_level);
+            std::memcpy(_fill_buff + _fill_level, data, num_copy);
+            _fill_level += num_copy;
+            data += num_copy;
+            nbytes -= num_copy;
+            if (_fill_level == _buffer_size) {
+                _submit_buffer(_fill_buff, _buffer_size);
+                _fill_buff  = _acquire_buffer();
+                _fill_level = 0;
+            }
+        }
+    }
+
+    void close() override
+    {
+        if (_fd < 0) {
+            return;
+        }
+        // O_DIRECT can only write whole blocks: pad the tail, then truncate
+        // the file back to the true length below.
+        if (_fill_level > 0) {
+            const size_t padded =
+                (_fill_level + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+            std::memset(_fill_buff + _fill_level, 0, padded - _fill_level);
+            _submit_buffer(_fill_buff, padded);
+            _fill_buff  = nullptr;
+            _fill_level = 0;
+        }
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _shutdown = true;
+            _queue_cv.notify_all();
+        }
+        _writer.join();
+        if (::ftruncate(_fd, _bytes_written) != 0 and _write_error.empty()) {
+            _write_error = std::string(std::strerror(errno));
+        }
+        ::close(_fd);
+        _fd = -1;
+        if (not _write_error.empty()) {
+            throw std::runtime_error("direct backend: write failed: " + _write_error);
+        }
+    }
+
+private:
+    char* _acquire_buffer()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _free_cv.wait(lock, [this]() { return not _free_buffs.empty(); });
+        char* buff = _free_buffs.front();
+        _free_buffs.pop_front();
+        return buff;
+    }
+
+    void _submit_buffer(char* buff, size_t nbytes)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _queue.push_back(std::make_pair(buff, nbytes));
+        _queue_cv.notify_one();
+    }
+
+    void _writer_loop()
+    {
+        while (true) {
+            std::pair<char*, size_t> job;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _queue_cv.wait(
+                    lock, [this]() { return _shutdown or not _queue.empty(); });
+                if (_queue.empty()) {
+                    return; // shutdown and drained
+                }
+                job = _queue.front();
+                _queue.pop_front();
+            }
+            const char* data = job.first;
+            size_t left      = job.second;
+            while (left > 0) {
+                const ssize_t num_written = ::write(_fd, data, left);
+                if (num_written < 0) {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (_write_error.empty()) {
+                        _write_error = std::string(std::strerror(errno));
+                    }
+                    break;
+                }
+                data += num_written;
+                left -= num_written;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _free_buffs.push_back(job.first);
+            _free_cv.notify_one();
+        }
+    }
+
+    int _fd = -1;
+    size_t _buffer_size;
+    std::vector<char*> _all_buffs;
+    char* _fill_buff   = nullptr;
+    size_t _fill_level = 0;
+
+    std::mutex _mutex;
+    std::condition_variable _queue_cv;
+    std::condition_variable _free_cv;
+    std::deque<char*> _free_buffs;
+    std::deque<std::pair<char*, size_t>> _queue;
+    bool _shutdown = false;
+    std::string _write_error;
+    std::thread _writer;
+};
+#endif /* __linux__ */
+
+std::unique_ptr<file_sink> make_file_sink(const std::string& path,
+    const std::string& backend,
+    size_t write_buffer_size,
+    size_t write_queue_depth)
+{
+    if (backend == "buffered") {
+        return std::unique_ptr<file_sink>(new buffered_file_sink(path));
+    }
+    if (backend == "direct") {
+#ifdef __linux__
+        return std::unique_ptr<file_sink>(
+            new direct_file_sink(path, write_buffer_size, write_queue_depth));
+#else
+        throw std::runtime_error("The direct file backend is only available on Linux.");
+#endif
+    }
+    throw std::runtime_error("Unknown file backend: " + backend);
+}
+
 template <typename samp_type>
 void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     const std::string& cpu_format,
@@ -41,7 +287,10 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     bool stats                  = false,
     bool null                   = false,
     bool enable_size_map        = false,
-    bool continue_on_bad_packet = false)
+    bool continue_on_bad_packet = false,
+    const std::string& file_backend = "buffered",
+    size_t write_buffer_size        = 4 * 1024 * 1024,
+    size_t write_queue_depth        = 4)
 {
     unsigned long long num_total_samps = 0;
     // create a receive streamer
@@ -53,9 +302,9 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
 
     uhd::rx_metadata_t md;
     std::vector<samp_type> buff(samps_per_buff);
-    std::ofstream outfile;
+    std::unique_ptr<file_sink> outfile;
     if (not null)
-        outfile.open(file.c_str(), std::ofstream::binary);
+        outfile = make_file_sink(file, file_backend, write_buffer_size, write_queue_depth);
     bool overflow_message = true;
 
     // setup streaming
@@ -123,8 +372,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
 
         num_total_samps += num_rx_samps;
 
-        if (outfile.is_open()) {
-            outfile.write((const char*)&buff.front(), num_rx_samps * sizeof(samp_type));
+        if (outfile) {
+            outfile->write((const char*)&buff.front(), num_rx_samps * sizeof(samp_type));
         }
 
         if (bw_summary) {
@@ -145,8 +394,16 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     stream_cmd.stream_mode = uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
     rx_stream->issue_stream_cmd(stream_cmd);
 
-    if (outfile.is_open()) {
-        outfile.close();
+    if (outfile) {
+        outfile->close();
+        const double write_duration_seconds =
+            std::chrono::duration<double>(actual_stop_time - start_time).count();
+        if (write_duration_seconds > 0.0) {
+            std::cout << boost::format("Sustained write throughput: %f MB/s")
+                             % (outfile->get_bytes_written() / write_duration_seconds
+                                 / 1e6)
+                      << std::endl;
+        }
     }
 
     if (stats) {
@@ -216,8 +473,8 @@ bool check_locked_sensor(std::vector<std::string> sensor_names,
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
-    std::string args, file, type, ant, subdev, ref, wirefmt;
-    size_t channel, total_num_samps, spb;
+    std::string args, file, type, ant, subdev, ref, wirefmt, file_backend;
+    size_t channel, total_num_samps, spb, write_buffer_size, write_queue_depth;
     double rate, freq, gain, bw, total_time, setup_time, lo_offset;
 
     // setup the program options
@@ -227,6 +484,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("help", "help message")
         ("args", po::value<std::string>(&args)->default_value(""), "multi uhd device address args")
         ("file", po::value<std::string>(&file)->default_value("usrp_samples.dat"), "name of the file to write binary samples to")
+        ("file-backend", po::value<std::string>(&file_backend)->default_value("buffered"), "file write backend: buffered, or direct (Linux only; O_DIRECT with aligned buffers and a writer thread)")
+        ("write-buffer-size", po::value<size_t>(&write_buffer_size)->default_value(4 * 1024 * 1024), "size in bytes of each write buffer (direct backend)")
+        ("write-queue-depth", po::value<size_t>(&write_queue_depth)->default_value(4), "number of write buffers in flight (direct backend)")
         ("type", po::value<std::string>(&type)->default_value("short"), "sample type: double, float, or short")
         ("nsamps", po::value<size_t>(&total_num_samps)->default_value(0), "total number of samples to receive")
         ("duration", po::value<double>(&total_time)->default_value(0), "total number of seconds to receive")
@@ -392,7 +652,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         stats,                    \
         null,                     \
         enable_size_map,          \
-        continue_on_bad_packet)
+        continue_on_bad_packet,   \
+        file_backend,             \
+        write_buffer_size,        \
+        write_queue_depth)
     // recv to file
     if (wirefmt == "s16") {
         if (type == "double")
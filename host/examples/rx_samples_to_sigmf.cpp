@@ -0,0 +1,695 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/tune_request.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/thread.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace po = boost::program_options;
+
+static bool stop_signal_called = false;
+void sig_int_handler(int)
+{
+    stop_signal_called = true;
+}
+
+/***********************************************************************
+ * SigMF streaming sink
+ *
+ * Samples are recorded as SigMF recordings: a raw .sigmf-data file plus
+ * a JSON .sigmf-meta file per data file. The sink owns a ring of
+ * preallocated buffers and a background writer thread, so the receive
+ * loop never blocks on disk I/O: it pops a free buffer, fills it from
+ * recv(), and hands it back to the writer. If the disk falls behind and
+ * the ring runs dry, the chunk is dropped and the gap is annotated in
+ * the metadata instead of stalling the stream.
+ *
+ * Data files are rotated at a configurable size boundary. Each file gets
+ * its own metadata file whose "core:offset" records the recording-wide
+ * index of its first sample, and overflow/drop annotations land in the
+ * file that contains the affected sample offset.
+ **********************************************************************/
+
+//! Escape a string for embedding in a JSON document
+std::string json_escape(const std::string& input)
+{
+    std::string out;
+    for (const char c : input) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += str(boost::format("\\u%04x") % int(c));
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out;
+}
+
+//! Current time as an ISO-8601 UTC string, as SigMF's core:datetime wants
+std::string iso8601_now()
+{
+    const std::time_t now = std::time(nullptr);
+    char buff[32];
+    std::tm tm_utc;
+#ifdef _WIN32
+    gmtime_s(&tm_utc, &now);
+#else
+    gmtime_r(&now, &tm_utc);
+#endif
+    std::strftime(buff, sizeof(buff), "%Y-%m-%dT%H:%M:%SZ", &tm_utc);
+    return std::string(buff);
+}
+
+class sigmf_recorder
+{
+public:
+    //! Description of the stream for the metadata files
+    struct stream_info_t
+    {
+        std::string datatype; // SigMF core:datatype, e.g. ci16_le
+        size_t bytes_per_samp;
+        double sample_rate;
+        double frequency;
+        std::string hw;
+        std::string description;
+    };
+
+    sigmf_recorder(const std::string& base_path,
+        const stream_info_t& info,
+        size_t max_file_bytes,
+        size_t buffer_bytes,
+        size_t num_buffers)
+        : _base_path(base_path)
+        , _info(info)
+        , _max_file_bytes(std::max(max_file_bytes, buffer_bytes))
+        , _start_datetime(iso8601_now())
+    {
+        for (size_t i = 0; i < std::max<size_t>(2, num_buffers); i++) {
+            _all_buffs.emplace_back(new buffer_t(buffer_bytes));
+            _free_buffs.push_back(_all_buffs.back().get());
+        }
+        _open_next_file();
+        _writer = std::thread([this]() { _writer_loop(); });
+    }
+
+    ~sigmf_recorder()
+    {
+        try {
+            close();
+        } catch (...) {
+            // close() already reported the error, or nobody is listening
+        }
+    }
+
+    //! Get a free buffer to fill, or nullptr if the writer has fallen
+    //  behind and the ring is empty. Never blocks.
+    char* try_get_buffer()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_free_buffs.empty()) {
+            return nullptr;
+        }
+        char* mem = _free_buffs.front()->data.data();
+        return mem;
+    }
+
+    //! Queue the buffer returned by try_get_buffer() for writing
+    void submit(size_t nbytes)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffer_t* buff = _free_buffs.front();
+        _free_buffs.pop_front();
+        buff->nbytes = nbytes;
+        _filled_buffs.push_back(buff);
+        _num_samps_submitted += nbytes / _info.bytes_per_samp;
+        _queue_cv.notify_one();
+    }
+
+    //! Record an annotation at the current position in the recording
+    void annotate(const std::string& label)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Coalesce with the previous annotation if nothing was recorded in
+        // between (e.g. repeated overflows while the radio recovers)
+        if (not _annotations.empty() and _annotations.back().label == label
+            and _annotations.back().sample_start == _num_samps_submitted) {
+            return;
+        }
+        _annotations.push_back(annotation_t{_num_samps_submitted, label});
+    }
+
+    //! Flush everything, finalize the last metadata file, and stop the
+    //  writer thread. Throws if a write failed asynchronously.
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_shutdown) {
+                return;
+            }
+            _shutdown = true;
+            _queue_cv.notify_all();
+        }
+        _writer.join();
+        _finalize_file();
+        if (not _write_error.empty()) {
+            throw std::runtime_error("sigmf recorder: write failed: " + _write_error);
+        }
+    }
+
+    uint64_t get_bytes_written() const
+    {
+        return _total_bytes_written;
+    }
+
+    size_t get_num_files() const
+    {
+        return _file_index;
+    }
+
+    uint64_t get_num_dropped_chunks() const
+    {
+        return _num_dropped_chunks;
+    }
+
+    //! Note a chunk that could not be recorded because the ring was empty
+    void count_dropped_chunk()
+    {
+        _num_dropped_chunks++;
+        annotate("recorder_drop");
+    }
+
+private:
+    struct buffer_t
+    {
+        explicit buffer_t(size_t size) : data(size) {}
+        std::vector<char> data;
+        size_t nbytes = 0;
+    };
+
+    struct annotation_t
+    {
+        uint64_t sample_start;
+        std::string label;
+    };
+
+    std::string _file_stem(const size_t index) const
+    {
+        return str(boost::format("%s-%04d") % _base_path % index);
+    }
+
+    void _open_next_file()
+    {
+        const std::string path = _file_stem(_file_index) + ".sigmf-data";
+        _data_file.open(path.c_str(), std::ofstream::binary);
+        if (not _data_file.is_open()) {
+            throw std::runtime_error("Could not open file for writing: " + path);
+        }
+        _file_bytes_written = 0;
+        _file_start_samp    = _total_bytes_written / _info.bytes_per_samp;
+    }
+
+    //! Close the current data file and write its .sigmf-meta companion
+    void _finalize_file()
+    {
+        _data_file.close();
+        const uint64_t file_end_samp = _total_bytes_written / _info.bytes_per_samp;
+
+        std::vector<annotation_t> file_annotations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (const auto& annotation : _annotations) {
+                if (annotation.sample_start >= _file_start_samp
+                    and (annotation.sample_start < file_end_samp
+                         or file_end_samp == _file_start_samp)) {
+                    file_annotations.push_back(annotation);
+                }
+            }
+        }
+
+        std::ostringstream meta;
+        meta << "{\n";
+        meta << "    \"global\": {\n";
+        meta << "        \"core:datatype\": \"" << _info.datatype << "\",\n";
+        meta << boost::format("        \"core:sample_rate\": %.1f,\n")
+                    % _info.sample_rate;
+        meta << "        \"core:version\": \"1.0.0\",\n";
+        meta << "        \"core:recorder\": \"UHD rx_samples_to_sigmf\",\n";
+        meta << "        \"core:hw\": \"" << json_escape(_info.hw) << "\",\n";
+        if (not _info.description.empty()) {
+            meta << "        \"core:description\": \"" << json_escape(_info.description)
+                 << "\",\n";
+        }
+        meta << "        \"core:offset\": " << _file_start_samp << "\n";
+        meta << "    },\n";
+        meta << "    \"captures\": [\n";
+        meta << "        {\n";
+        meta << "            \"core:sample_start\": 0,\n";
+        meta << boost::format("            \"core:frequency\": %.1f,\n")
+                    % _info.frequency;
+        meta << "            \"core:datetime\": \"" << _start_datetime << "\"\n";
+        meta << "        }\n";
+        meta << "    ],\n";
+        meta << "    \"annotations\": [";
+        for (size_t i = 0; i < file_annotations.size(); i++) {
+            // SigMF sample offsets are relative to the start of the data file
+            meta << (i ? "," : "") << "\n        {\n";
+            meta << "            \"core:sample_start\": "
+                 << (file_annotations[i].sample_start - _file_start_samp) << ",\n";
+            meta << "            \"core:sample_count\": 0,\n";
+            meta << "            \"core:label\": \""
+                 << json_escape(file_annotations[i].label) << "\"\n";
+            meta << "        }";
+        }
+        meta << (file_annotations.empty() ? "]\n" : "\n    ]\n");
+        meta << "}\n";
+
+        const std::string meta_path = _file_stem(_file_index) + ".sigmf-meta";
+        std::ofstream meta_file(meta_path.c_str());
+        if (not meta_file.is_open()) {
+            throw std::runtime_error("Could not open file for writing: " + meta_path);
+        }
+        meta_file << meta.str();
+        _file_index++;
+    }
+
+    void _writer_loop()
+    {
+        while (true) {
+            buffer_t* buff = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _queue_cv.wait(
+                    lock, [this]() { return _shutdown or not _filled_buffs.empty(); });
+                if (_filled_buffs.empty()) {
+                    return; // shutdown and drained
+                }
+                buff = _filled_buffs.front();
+                _filled_buffs.pop_front();
+            }
+            try {
+                // Rotate at the size boundary before the write, so a file
+                // never exceeds the limit and samples are not split across
+                // a buffer
+                if (_file_bytes_written > 0
+                    and _file_bytes_written + buff->nbytes > _max_file_bytes) {
+                    _finalize_file();
+                    _open_next_file();
+                }
+                _data_file.write(buff->data.data(), buff->nbytes);
+                if (not _data_file) {
+                    throw std::runtime_error("data file write failed");
+                }
+                _file_bytes_written += buff->nbytes;
+                _total_bytes_written += buff->nbytes;
+            } catch (const std::exception& ex) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_write_error.empty()) {
+                    _write_error = ex.what();
+                }
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            _free_buffs.push_back(buff);
+        }
+    }
+
+    const std::string _base_path;
+    const stream_info_t _info;
+    const size_t _max_file_bytes;
+    const std::string _start_datetime;
+
+    std::vector<std::unique_ptr<buffer_t>> _all_buffs;
+    std::deque<buffer_t*> _free_buffs;
+    std::deque<buffer_t*> _filled_buffs;
+    std::mutex _mutex;
+    std::condition_variable _queue_cv;
+    bool _shutdown = false;
+    std::string _write_error;
+    std::thread _writer;
+
+    // Only touched by the writer thread (and close(), after the join)
+    std::ofstream _data_file;
+    size_t _file_index           = 0;
+    uint64_t _file_bytes_written = 0;
+    uint64_t _file_start_samp    = 0;
+
+    uint64_t _total_bytes_written  = 0;
+    uint64_t _num_samps_submitted  = 0;
+    uint64_t _num_dropped_chunks   = 0;
+    std::vector<annotation_t> _annotations;
+};
+
+/***********************************************************************
+ * Receive loop
+ **********************************************************************/
+template <typename samp_type>
+void recv_to_sigmf(uhd::usrp::multi_usrp::sptr usrp,
+    const std::string& cpu_format,
+    const std::string& wire_format,
+    const size_t channel,
+    sigmf_recorder& recorder,
+    size_t samps_per_buff,
+    unsigned long long num_requested_samples,
+    double time_requested,
+    bool bw_summary,
+    bool stats)
+{
+    unsigned long long num_total_samps = 0;
+    uhd::stream_args_t stream_args(cpu_format, wire_format);
+    stream_args.channels             = {channel};
+    uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
+
+    uhd::rx_metadata_t md;
+    // Scratch buffer for chunks received while the write ring is empty;
+    // the samples are dropped but the stream keeps draining
+    std::vector<samp_type> scratch(samps_per_buff);
+    bool overflow_message = true;
+
+    uhd::stream_cmd_t stream_cmd((num_requested_samples == 0)
+                                     ? uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS
+                                     : uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    stream_cmd.num_samps  = size_t(num_requested_samples);
+    stream_cmd.stream_now = true;
+    stream_cmd.time_spec  = uhd::time_spec_t();
+    rx_stream->issue_stream_cmd(stream_cmd);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto stop_time =
+        start_time + std::chrono::milliseconds(int64_t(1000 * time_requested));
+    auto last_update                     = start_time;
+    unsigned long long last_update_samps = 0;
+
+    while (not stop_signal_called
+           and (num_requested_samples != num_total_samps or num_requested_samples == 0)
+           and (time_requested == 0.0 or std::chrono::steady_clock::now() <= stop_time)) {
+        const auto now = std::chrono::steady_clock::now();
+
+        char* write_mem = recorder.try_get_buffer();
+        void* recv_mem  = write_mem ? static_cast<void*>(write_mem)
+                                    : static_cast<void*>(scratch.data());
+
+        const size_t num_rx_samps = rx_stream->recv(recv_mem, samps_per_buff, md, 3.0);
+
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+            std::cout << "Timeout while streaming" << std::endl;
+            break;
+        }
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+            // The gap lands in the metadata, so this is informational only
+            recorder.annotate("overflow");
+            if (overflow_message) {
+                overflow_message = false;
+                std::cerr << boost::format(
+                                 "Got an overflow indication; it will be annotated in "
+                                 "the SigMF metadata. Your write medium must sustain "
+                                 "a rate of %fMB/s. This message will not appear "
+                                 "again.\n")
+                                 % (usrp->get_rx_rate(channel) * sizeof(samp_type) / 1e6);
+            }
+            continue;
+        }
+        if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            throw std::runtime_error("Receiver error: " + md.strerror());
+        }
+
+        num_total_samps += num_rx_samps;
+        if (write_mem) {
+            recorder.submit(num_rx_samps * sizeof(samp_type));
+        } else {
+            recorder.count_dropped_chunk();
+        }
+
+        if (bw_summary) {
+            last_update_samps += num_rx_samps;
+            const auto time_since_last_update = now - last_update;
+            if (time_since_last_update > std::chrono::seconds(1)) {
+                const double time_since_last_update_s =
+                    std::chrono::duration<double>(time_since_last_update).count();
+                const double rate = double(last_update_samps) / time_since_last_update_s;
+                std::cout << "\t" << (rate / 1e6) << " Msps" << std::endl;
+                last_update_samps = 0;
+                last_update       = now;
+            }
+        }
+    }
+    const auto actual_stop_time = std::chrono::steady_clock::now();
+
+    stream_cmd.stream_mode = uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
+    rx_stream->issue_stream_cmd(stream_cmd);
+
+    recorder.close();
+
+    if (stats) {
+        std::cout << std::endl;
+        const double actual_duration_seconds =
+            std::chrono::duration<float>(actual_stop_time - start_time).count();
+        std::cout << boost::format("Received %d samples in %f seconds") % num_total_samps
+                         % actual_duration_seconds
+                  << std::endl;
+        std::cout << boost::format("Wrote %d bytes across %d SigMF recording(s)")
+                         % recorder.get_bytes_written() % recorder.get_num_files()
+                  << std::endl;
+        if (recorder.get_num_dropped_chunks() > 0) {
+            std::cout << boost::format("Dropped %d chunk(s) because the writer could "
+                                       "not keep up (annotated in the metadata)")
+                             % recorder.get_num_dropped_chunks()
+                      << std::endl;
+        }
+        if (actual_duration_seconds > 0.0) {
+            std::cout << boost::format("Sustained write throughput: %f MB/s")
+                             % (recorder.get_bytes_written() / actual_duration_seconds
+                                 / 1e6)
+                      << std::endl;
+        }
+    }
+}
+
+//! Map a CPU sample type to the matching SigMF core:datatype string
+std::string sigmf_datatype(const std::string& type)
+{
+    const uint16_t endian_probe = 0x0100;
+    const std::string suffix =
+        (*reinterpret_cast<const uint8_t*>(&endian_probe) == 0x01) ? "_be" : "_le";
+    if (type == "short") {
+        return "ci16" + suffix;
+    }
+    if (type == "float") {
+        return "cf32" + suffix;
+    }
+    if (type == "double") {
+        return "cf64" + suffix;
+    }
+    throw std::runtime_error("Unknown type " + type);
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    // variables to be set by po
+    std::string args, file, type, ant, subdev, ref, wirefmt, description;
+    size_t channel, total_num_samps, spb, num_buffs;
+    size_t file_size;
+    double rate, freq, gain, bw, total_time, setup_time, lo_offset;
+
+    // setup the program options
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("args", po::value<std::string>(&args)->default_value(""), "multi uhd device address args")
+        ("file", po::value<std::string>(&file)->default_value("usrp_samples"), "base name of the SigMF recording (index and extensions are appended)")
+        ("file-size", po::value<size_t>(&file_size)->default_value(size_t(1) << 30), "rotate to a new data file at this size in bytes")
+        ("num-buffs", po::value<size_t>(&num_buffs)->default_value(8), "number of preallocated write buffers in the ring")
+        ("description", po::value<std::string>(&description)->default_value(""), "description for the SigMF metadata")
+        ("type", po::value<std::string>(&type)->default_value("short"), "sample type: double, float, or short")
+        ("nsamps", po::value<size_t>(&total_num_samps)->default_value(0), "total number of samples to receive")
+        ("duration", po::value<double>(&total_time)->default_value(0), "total number of seconds to receive")
+        ("spb", po::value<size_t>(&spb)->default_value(10000), "samples per buffer")
+        ("rate", po::value<double>(&rate)->default_value(1e6), "rate of incoming samples")
+        ("freq", po::value<double>(&freq)->default_value(0.0), "RF center frequency in Hz")
+        ("lo-offset", po::value<double>(&lo_offset)->default_value(0.0),
+            "Offset for frontend LO in Hz (optional)")
+        ("gain", po::value<double>(&gain), "gain for the RF chain")
+        ("ant", po::value<std::string>(&ant), "antenna selection")
+        ("subdev", po::value<std::string>(&subdev), "subdevice specification")
+        ("channel", po::value<size_t>(&channel)->default_value(0), "which channel to use")
+        ("bw", po::value<double>(&bw), "analog frontend filter bandwidth in Hz")
+        ("ref", po::value<std::string>(&ref)->default_value("internal"), "reference source (internal, external, mimo)")
+        ("wirefmt", po::value<std::string>(&wirefmt)->default_value("sc16"), "wire format (sc8, sc16 or s16)")
+        ("setup", po::value<double>(&setup_time)->default_value(1.0), "seconds of setup time")
+        ("progress", "periodically display short-term bandwidth")
+        ("stats", "show average bandwidth on exit")
+        ("int-n", "tune USRP with integer-N tuning")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD RX samples to SigMF %s") % desc << std::endl;
+        std::cout << std::endl
+                  << "This application streams data from a single channel of a USRP\n"
+                     "device into a SigMF recording: one or more .sigmf-data files\n"
+                     "(rotated at --file-size bytes) with .sigmf-meta companions.\n"
+                     "Writes happen on a background thread through a ring of\n"
+                     "preallocated buffers, and overflows are annotated in the\n"
+                     "metadata.\n"
+                  << std::endl;
+        return ~0;
+    }
+
+    bool bw_summary = vm.count("progress") > 0;
+    bool stats      = vm.count("stats") > 0;
+
+    // create a usrp device
+    std::cout << std::endl;
+    std::cout << boost::format("Creating the usrp device with: %s...") % args
+              << std::endl;
+    uhd::usrp::multi_usrp::sptr usrp = uhd::usrp::multi_usrp::make(args);
+
+    // Lock mboard clocks
+    if (vm.count("ref")) {
+        usrp->set_clock_source(ref);
+    }
+
+    // always select the subdevice first, the channel mapping affects the other settings
+    if (vm.count("subdev"))
+        usrp->set_rx_subdev_spec(subdev);
+
+    std::cout << boost::format("Using Device: %s") % usrp->get_pp_string() << std::endl;
+
+    // set the sample rate
+    if (rate <= 0.0) {
+        std::cerr << "Please specify a valid sample rate" << std::endl;
+        return ~0;
+    }
+    std::cout << boost::format("Setting RX Rate: %f Msps...") % (rate / 1e6) << std::endl;
+    usrp->set_rx_rate(rate, channel);
+    std::cout << boost::format("Actual RX Rate: %f Msps...")
+                     % (usrp->get_rx_rate(channel) / 1e6)
+              << std::endl
+              << std::endl;
+
+    // set the center frequency
+    if (vm.count("freq")) { // with default of 0.0 this will always be true
+        std::cout << boost::format("Setting RX Freq: %f MHz...") % (freq / 1e6)
+                  << std::endl;
+        std::cout << boost::format("Setting RX LO Offset: %f MHz...") % (lo_offset / 1e6)
+                  << std::endl;
+        uhd::tune_request_t tune_request(freq, lo_offset);
+        if (vm.count("int-n"))
+            tune_request.args = uhd::device_addr_t("mode_n=integer");
+        usrp->set_rx_freq(tune_request, channel);
+        std::cout << boost::format("Actual RX Freq: %f MHz...")
+                         % (usrp->get_rx_freq(channel) / 1e6)
+                  << std::endl
+                  << std::endl;
+    }
+
+    // set the rf gain
+    if (vm.count("gain")) {
+        std::cout << boost::format("Setting RX Gain: %f dB...") % gain << std::endl;
+        usrp->set_rx_gain(gain, channel);
+        std::cout << boost::format("Actual RX Gain: %f dB...")
+                         % usrp->get_rx_gain(channel)
+                  << std::endl
+                  << std::endl;
+    }
+
+    // set the IF filter bandwidth
+    if (vm.count("bw")) {
+        std::cout << boost::format("Setting RX Bandwidth: %f MHz...") % (bw / 1e6)
+                  << std::endl;
+        usrp->set_rx_bandwidth(bw, channel);
+        std::cout << boost::format("Actual RX Bandwidth: %f MHz...")
+                         % (usrp->get_rx_bandwidth(channel) / 1e6)
+                  << std::endl
+                  << std::endl;
+    }
+
+    // set the antenna
+    if (vm.count("ant"))
+        usrp->set_rx_antenna(ant, channel);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(int64_t(1000 * setup_time)));
+
+    if (total_num_samps == 0) {
+        std::signal(SIGINT, &sig_int_handler);
+        std::cout << "Press Ctrl + C to stop streaming..." << std::endl;
+    }
+
+    sigmf_recorder::stream_info_t info;
+    info.datatype    = sigmf_datatype(type);
+    info.sample_rate = usrp->get_rx_rate(channel);
+    info.frequency   = usrp->get_rx_freq(channel);
+    info.hw          = usrp->get_mboard_name();
+    info.description = description;
+
+    std::string cpu_format;
+    if (type == "double") {
+        cpu_format          = "fc64";
+        info.bytes_per_samp = sizeof(std::complex<double>);
+    } else if (type == "float") {
+        cpu_format          = "fc32";
+        info.bytes_per_samp = sizeof(std::complex<float>);
+    } else if (type == "short") {
+        cpu_format          = "sc16";
+        info.bytes_per_samp = sizeof(std::complex<short>);
+    } else {
+        throw std::runtime_error("Unknown type " + type);
+    }
+
+    sigmf_recorder recorder(file, info, file_size, spb * info.bytes_per_samp, num_buffs);
+    if (type == "double") {
+        recv_to_sigmf<std::complex<double>>(usrp, cpu_format, wirefmt, channel, recorder,
+            spb, total_num_samps, total_time, bw_summary, stats);
+    } else if (type == "float") {
+        recv_to_sigmf<std::complex<float>>(usrp, cpu_format, wirefmt, channel, recorder,
+            spb, total_num_samps, total_time, bw_summary, stats);
+    } else {
+        recv_to_sigmf<std::complex<short>>(usrp, cpu_format, wirefmt, channel, recorder,
+            spb, total_num_samps, total_time, bw_summary, stats);
+    }
+
+    // finished
+    std::cout << std::endl << "Done!" << std::endl << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -11,12 +11,19 @@
 #include <uhd/utils/thread.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <chrono>
 #include <complex>
 #include <csignal>
 #include <fstream>
 #include <iostream>
 #include <thread>
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 namespace po = boost::program_options;
 
@@ -26,6 +33,44 @@ void sig_int_handler(int)
     stop_signal_called = true;
 }
 
+#ifndef _WIN32
+//! RAII wrapper around a read-only memory mapping of a file
+struct mapped_file
+{
+    mapped_file(const std::string& file)
+    {
+        const int fd = ::open(file.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == 0 and file_stat.st_size > 0) {
+            void* mapping =
+                ::mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                base = static_cast<const char*>(mapping);
+                size = size_t(file_stat.st_size);
+                // We walk the file front to back; let the kernel read ahead
+                // of the send cursor and drop pages behind it.
+                ::madvise(mapping, size, MADV_SEQUENTIAL);
+            }
+        }
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+    }
+
+    ~mapped_file()
+    {
+        if (base != NULL) {
+            ::munmap(const_cast<char*>(base), size);
+        }
+    }
+
+    const char* base = NULL;
+    size_t size      = 0;
+};
+#endif
+
 template <typename samp_type>
 void send_from_file(
     uhd::tx_streamer::sptr tx_stream, const std::string& file, size_t samps_per_buff)
@@ -33,6 +78,29 @@ void send_from_file(
     uhd::tx_metadata_t md;
     md.start_of_burst = false;
     md.end_of_burst   = false;
+
+#ifndef _WIN32
+    // Map the file and send straight out of the mapped region. This avoids
+    // the read copy into a temporary buffer, and with MADV_SEQUENTIAL the OS
+    // prefetches ahead of the send cursor, which matters for waveform files
+    // much larger than RAM.
+    mapped_file mapping(file);
+    if (mapping.base != NULL) {
+        const samp_type* samps = reinterpret_cast<const samp_type*>(mapping.base);
+        const size_t num_total_samps = mapping.size / sizeof(samp_type);
+        size_t num_sent_samps        = 0;
+        while (num_sent_samps < num_total_samps and not stop_signal_called) {
+            const size_t samps_to_send =
+                std::min(samps_per_buff, num_total_samps - num_sent_samps);
+            md.end_of_burst = (num_sent_samps + samps_to_send == num_total_samps);
+            num_sent_samps +=
+                tx_stream->send(samps + num_sent_samps, samps_to_send, md);
+        }
+        return;
+    }
+    // Fall through to the buffered path if the file could not be mapped
+#endif
+
     std::vector<samp_type> buff(samps_per_buff);
     std::ifstream infile(file.c_str(), std::ifstream::binary);
 
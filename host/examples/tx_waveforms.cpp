@@ -14,7 +14,6 @@
 #include <stdint.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
-#include <boost/math/special_functions/round.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <csignal>
@@ -41,7 +40,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // variables to be set by po
     std::string args, wave_type, ant, subdev, ref, pps, otw, channel_list;
     uint64_t total_num_samps;
-    size_t spb;
+    size_t spb, table_len;
     double rate, freq, gain, power, wave_freq, bw, lo_offset;
     float ampl;
 
@@ -65,6 +64,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("bw", po::value<double>(&bw), "analog frontend filter bandwidth in Hz")
         ("wave-type", po::value<std::string>(&wave_type)->default_value("CONST"), "waveform type (CONST, SQUARE, RAMP, SINE)")
         ("wave-freq", po::value<double>(&wave_freq)->default_value(0), "waveform frequency in Hz")
+        ("wave-table-len", po::value<size_t>(&table_len)->default_value(wave_table_len), "wave table length in samples (power of two); larger tables reduce lookup spurs")
+        ("wave-interp", "linearly interpolate between wave table entries (lower spurs, more CPU)")
         ("ref", po::value<std::string>(&ref)->default_value("internal"), "clock reference (internal, external, mimo, gpsdo)")
         ("pps", po::value<std::string>(&pps), "PPS source (internal, external, mimo, gpsdo)")
         ("otw", po::value<std::string>(&otw)->default_value("sc16"), "specify the over-the-wire sample mode")
@@ -139,10 +140,12 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     }
 
     // pre-compute the waveform values
-    const wave_table_class wave_table(wave_type, ampl);
-    const size_t step =
-        boost::math::iround(wave_freq / usrp->get_tx_rate() * wave_table_len);
-    size_t index = 0;
+    const wave_table_class wave_table(
+        wave_type, ampl, table_len, vm.count("wave-interp") > 0);
+    // table positions per output sample; fractional unless the wave frequency
+    // divides the sample rate evenly
+    const double step = wave_freq / usrp->get_tx_rate() * wave_table.size();
+    double phase      = 0.0;
 
     for (size_t ch = 0; ch < channel_nums.size(); ch++) {
         std::cout << boost::format("Setting TX Freq: %f MHz...") % (freq / 1e6)
@@ -206,7 +209,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     if (std::abs(wave_freq) > usrp->get_tx_rate() / 2) {
         throw std::runtime_error("wave freq out of Nyquist zone");
     }
-    if (usrp->get_tx_rate() / std::abs(wave_freq) > wave_table_len / 2) {
+    if (usrp->get_tx_rate() / std::abs(wave_freq) > wave_table.size() / 2) {
         throw std::runtime_error("wave freq too small for table");
     }
 
@@ -224,9 +227,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     std::vector<std::complex<float>*> buffs(channel_nums.size(), &buff.front());
 
     // pre-fill the buffer with the waveform
-    for (size_t n = 0; n < buff.size(); n++) {
-        buff[n] = wave_table(index += step);
-    }
+    wave_table(&buff.front(), buff.size(), phase, step);
 
     std::cout << boost::format("Setting device timestamp to 0...") << std::endl;
     if (channel_nums.size() > 1) {
@@ -313,9 +314,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         num_acc_samps += tx_stream->send(buffs, buff.size(), md);
 
         // fill the buffer with the waveform
-        for (size_t n = 0; n < buff.size(); n++) {
-            buff[n] = wave_table(index += step);
-        }
+        wave_table(&buff.front(), buff.size(), phase, step);
 
         md.start_of_burst = false;
         md.has_time_spec  = false;
@@ -18,9 +18,24 @@ static const size_t wave_table_len = 8192;
 class wave_table_class
 {
 public:
-    wave_table_class(const std::string& wave_type, const float ampl)
-        : _wave_table(wave_table_len, {0.0, 0.0})
+    //! \param wave_type CONST, SQUARE, RAMP, or SINE
+    //  \param ampl peak amplitude
+    //  \param table_len table length in samples, must be a power of two so
+    //         that indices can wrap with a mask instead of a modulo
+    //  \param interpolate linearly interpolate between table entries for
+    //         non-integer phase steps; larger tables and interpolation both
+    //         reduce lookup spurs
+    wave_table_class(const std::string& wave_type,
+        const float ampl,
+        const size_t table_len = wave_table_len,
+        const bool interpolate = false)
+        : _wave_table(table_len, {0.0, 0.0})
+        , _table_mask(table_len - 1)
+        , _interpolate(interpolate)
     {
+        if (table_len < 2 or (table_len & (table_len - 1)) != 0) {
+            throw std::runtime_error("wave table length must be a power of two");
+        }
         // Note: CONST, SQUARE, and RAMP only fill the I portion, since they are
         // amplitude-modulating signals, not phase-modulating.
         if (wave_type == "CONST") {
@@ -31,7 +46,7 @@ public:
         } else if (wave_type == "SQUARE") {
             // Fill the second half of the table with ampl, first half with
             // zeros
-            std::fill(_wave_table.begin() + wave_table_len / 2,
+            std::fill(_wave_table.begin() + table_len / 2,
                 _wave_table.end(),
                 std::complex<float>{ampl, 0.0});
             _power_dbfs = static_cast<double>(20 * std::log10(ampl))
@@ -39,11 +54,11 @@ public:
         } else if (wave_type == "RAMP") {
             // Fill I values with ramp from -1 to 1, Q with zero
             float energy_acc = 0.0f;
-            for (size_t i = 0; i < wave_table_len; i++) {
-                _wave_table[i] = {(2.0f * i / (wave_table_len - 1) - 1.0f) * ampl, 0.0};
+            for (size_t i = 0; i < table_len; i++) {
+                _wave_table[i] = {(2.0f * i / (table_len - 1) - 1.0f) * ampl, 0.0};
                 energy_acc += std::norm(_wave_table[i]);
             }
-            _power_dbfs = static_cast<double>(energy_acc / wave_table_len);
+            _power_dbfs = static_cast<double>(energy_acc / table_len);
             // Note: The closed-form solution to the average sum of squares of
             // the ramp is:
             // 1.0 / 3 + 2.0 / (3 * N) + 1.0 / (3 * N) + 4.0 / (6 * N^2))
@@ -51,14 +66,14 @@ public:
             // just calculate the power on the fly.
         } else if (wave_type == "SINE") {
             static const double tau = 2 * std::acos(-1.0);
-            static const std::complex<float> J(0, 1);
-            // Careful: i is the loop counter, not the imaginary unit
-            for (size_t i = 0; i < wave_table_len; i++) {
-                // Directly generate complex sinusoid (a*e^{j 2\pi i/N}). We
-                // create a single rotation. The call site will sub-sample
-                // appropriately to create a sine wave of it's desired frequency
-                _wave_table[i] =
-                    ampl * std::exp(J * static_cast<float>(tau * i / wave_table_len));
+            // Directly generate a complex sinusoid (a*e^{j 2\pi i/N}). We
+            // create a single rotation. The call site will sub-sample
+            // appropriately to create a sine wave of its desired frequency.
+            // Computing cos/sin per entry (instead of std::exp on a complex
+            // argument) lets the compiler vectorize this fill.
+            for (size_t i = 0; i < table_len; i++) {
+                const float arg = static_cast<float>(tau * i / table_len);
+                _wave_table[i]  = {ampl * std::cos(arg), ampl * std::sin(arg)};
             }
             _power_dbfs = static_cast<double>(20 * std::log10(ampl));
         } else {
@@ -68,7 +83,44 @@ public:
 
     inline std::complex<float> operator()(const size_t index) const
     {
-        return _wave_table[index % wave_table_len];
+        return _wave_table[index & _table_mask];
+    }
+
+    /*! Emit nsamps samples into buff, advancing phase by step per sample.
+     *
+     * phase and step are in table positions; step may be fractional, and
+     * with interpolation enabled fractional positions are linearly
+     * interpolated instead of truncated. The masked-index loops contain no
+     * branches or modulo, so they vectorize.
+     */
+    inline void operator()(std::complex<float>* buff,
+        const size_t nsamps,
+        double& phase,
+        const double step) const
+    {
+        if (_interpolate) {
+            for (size_t n = 0; n < nsamps; n++) {
+                const double pos = phase + n * step;
+                const size_t i0  = static_cast<size_t>(pos) & _table_mask;
+                const size_t i1  = (i0 + 1) & _table_mask;
+                const float frac = static_cast<float>(pos - std::floor(pos));
+                buff[n] = _wave_table[i0] + (_wave_table[i1] - _wave_table[i0]) * frac;
+            }
+        } else {
+            for (size_t n = 0; n < nsamps; n++) {
+                buff[n] =
+                    _wave_table[static_cast<size_t>(phase + n * step) & _table_mask];
+            }
+        }
+        // Wrap the phase accumulator so it never loses fractional precision
+        // on long runs
+        phase = std::fmod(phase + nsamps * step, double(_wave_table.size()));
+    }
+
+    //! Return the table length in samples
+    inline size_t size() const
+    {
+        return _wave_table.size();
     }
 
     //! Return the signal power in dBFS
@@ -79,5 +131,7 @@ public:
 
 private:
     std::vector<std::complex<float>> _wave_table;
+    size_t _table_mask;
+    bool _interpolate;
     double _power_dbfs;
 };
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <uhd/cal/database.hpp>
 #include <uhd/config.hpp>
 #include <stdint.h>
 #include <memory>
@@ -39,6 +40,22 @@ public:
     //! Populate this class from the serialized data
     virtual void deserialize(const std::vector<uint8_t>& data) = 0;
 
+    //! Populate this class from a serialized data blob, without copying it
+    //
+    // Unlike deserialize(const std::vector<uint8_t>&), this hands the
+    // container a shared reference to the underlying storage (e.g., a
+    // memory-mapped cal file, see database::read_cal_data_blob()). Containers
+    // may hold on to the blob and defer parsing the bulk of the data until it
+    // is first accessed, which keeps device initialization cheap when most of
+    // the cal data is never used in a session.
+    //
+    // The default implementation simply copies the blob and behaves exactly
+    // like the vector-based deserialize().
+    virtual void deserialize(const cal_data_blob::sptr& data)
+    {
+        deserialize(std::vector<uint8_t>(data->data(), data->data() + data->size()));
+    }
+
     //! Generic factory for cal data from serialized data
     //
     // \tparam container_type The class type of cal data which should be
@@ -51,6 +68,22 @@ public:
         cal_data->deserialize(data);
         return cal_data;
     }
+
+    //! Generic factory for cal data from a serialized data blob
+    //
+    // Like make(const std::vector<uint8_t>&), but without copying the data.
+    // See deserialize(const cal_data_blob::sptr&).
+    //
+    // \tparam container_type The class type of cal data which should be
+    //                        generated from \p data
+    // \param data The serialized data blob to be turned into the cal class
+    template <typename container_type>
+    static std::shared_ptr<container_type> make(const cal_data_blob::sptr& data)
+    {
+        auto cal_data = container_type::make();
+        cal_data->deserialize(data);
+        return cal_data;
+    }
 };
 
 }}} // namespace uhd::usrp::cal
@@ -8,6 +8,8 @@
 
 #include <uhd/config.hpp>
 #include <stddef.h>
+#include <stdint.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,31 @@ enum class source {
     USER //!< Provided by the user
 };
 
+/*! Read-only view onto a serialized calibration data blob
+ *
+ * Unlike the byte vectors returned by database::read_cal_data(), a blob does
+ * not own a heap copy of the data. Depending on where the data came from, it
+ * references a memory-mapped file, memory compiled into UHD by the resource
+ * compiler, or (as a fallback) an internal buffer. The underlying storage is
+ * guaranteed to stay valid for the lifetime of the blob object, so consumers
+ * can hold on to the shared pointer and read from data() lazily. This is how
+ * the cal containers avoid copying multi-megabyte cal files into heap memory
+ * at device initialization (see container::deserialize()).
+ */
+class UHD_API cal_data_blob
+{
+public:
+    using sptr = std::shared_ptr<const cal_data_blob>;
+
+    virtual ~cal_data_blob() = default;
+
+    //! Pointer to the first byte of serialized cal data
+    virtual const uint8_t* data() const = 0;
+
+    //! Size of the serialized cal data in bytes
+    virtual size_t size() const = 0;
+};
+
 /*! Calibration Data Storage/Retrieval Class
  *
  * UHD can store calibration data on disk or compiled within UHD. This class
@@ -87,6 +114,29 @@ public:
         const std::string& serial,
         const source source_type = source::ANY);
 
+    //! Return a calibration data set as a read-only blob without copying it
+    //
+    // This is the zero-copy sibling of read_cal_data(). Filesystem cal data is
+    // memory-mapped (where the platform supports it), so only the pages that
+    // are actually read get faulted in, and the data stays out of the heap.
+    // RC cal data is referenced in place, since it is already resident in the
+    // UHD binary. When memory-mapping is unavailable, this degrades to a heap
+    // copy and behaves like read_cal_data().
+    //
+    // Source selection and error behavior are identical to read_cal_data().
+    //
+    // \param key The calibration type key (e.g., "rx_iq")
+    // \param serial The serial number of the device this data is for. See also
+    //               \ref cal_db_serial
+    // \param source_type Where to read the calibration data from. See
+    //                    read_cal_data().
+    //
+    // \throws uhd::key_error if no calibration data is found matching the source
+    //                        type.
+    static cal_data_blob::sptr read_cal_data_blob(const std::string& key,
+        const std::string& serial,
+        const source source_type = source::ANY);
+
     //! Check if calibration data exists for a given source type
     //
     // This can be called before calling read_cal_data() to avoid having to
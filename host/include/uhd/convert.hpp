@@ -13,6 +13,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace convert {
 
@@ -89,6 +90,19 @@ UHD_API void register_converter(
  */
 UHD_API function_type get_converter(const id_type& id, const priority_type prio = -1);
 
+/*!
+ * Check if a converter is registered for a conversion.
+ * \param id identify the conversion
+ * \return true if get_converter() can return a factory for this id
+ */
+UHD_API bool has_converter(const id_type& id);
+
+/*!
+ * List the registered conversions.
+ * \return the conversion IDs of every registered converter
+ */
+UHD_API std::vector<id_type> get_ids(void);
+
 /*!
  * Register the size of a particular item.
  * \param format the item format
@@ -59,7 +59,7 @@ public:
     //! Factory function
     static sptr make(const uhd::stream_cmd_t::stream_mode_t stream_mode);
 
-private:
+protected:
     stream_cmd_action_info(const uhd::stream_cmd_t::stream_mode_t stream_mode);
 };
 
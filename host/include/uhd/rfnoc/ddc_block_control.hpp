@@ -124,6 +124,31 @@ public:
      */
     virtual double set_output_rate(const double rate, const size_t chan) = 0;
 
+    /*! Set the output rate without a graph-wide property resolution (fast path)
+     *
+     * Like set_output_rate(), but constrained for rate agility: \p rate must
+     * correspond exactly to one of the precomputed legal decimations (cf.
+     * get_output_rates()); it is validated against that set and never
+     * coerced. On success, only the DDC registers and this block's own
+     * properties are updated — no property propagation through the graph is
+     * triggered, which makes this call considerably cheaper in large graphs
+     * (e.g., for scanning applications that change rates per hop).
+     *
+     * The decimation affects neither tick rates nor packet sizes, so the
+     * graph stays functional. However, downstream blocks are not notified of
+     * the changed rate and scaling; they will pick up the new values on the
+     * next full property resolution.
+     *
+     * \param rate The requested rate
+     * \param chan The channel for which the rate is being set
+     * \returns the new sampling rate at this block's output
+     * \throws uhd::runtime_error if the input rate is not yet valid (i.e.,
+     *         the graph was not yet committed)
+     * \throws uhd::value_error if \p rate does not correspond to a legal
+     *         decimation of the current input rate
+     */
+    virtual double set_output_rate_fast(const double rate, const size_t chan) = 0;
+
     /**************************************************************************
      * Streaming-Related API Calls
      *************************************************************************/
@@ -12,11 +12,47 @@
 namespace uhd { namespace rfnoc {
 
 /*! DMA FIFO Block Control Class
+ *
+ * The DMA FIFO block buffers transmit samples in off-chip DRAM. The getters
+ * on this class read live counters from the FIFO cores and may be polled
+ * while streaming: they only occupy the control path, not the data path.
+ * The fill level is the primary tool for locating the starving stage when
+ * debugging TX underruns. A FIFO that is near-full when an underrun occurs
+ * points downstream (radio consuming faster than the FIFO can drain), while
+ * a FIFO that is near-empty points at the host not delivering samples in
+ * time -- in the latter case, correlate with the stall time and call latency
+ * reported by uhd::tx_streamer::get_stream_stats().
  */
 class UHD_API dmafifo_block_control : public noc_block_base
 {
 public:
     RFNOC_DECLARE_BLOCK(dmafifo_block_control)
+
+    /*! Get the number of packets that have passed through a FIFO
+     *
+     * \param chan The channel (i.e. the FIFO instance) to query
+     * \returns the packet count
+     */
+    virtual uint32_t get_packet_count(const size_t chan) = 0;
+
+    /*! Get the current fill level of a FIFO in bytes
+     *
+     * The fullness is read in a single batched register access, so polling
+     * it costs one control transaction round trip per call.
+     *
+     * \param chan The channel (i.e. the FIFO instance) to query
+     * \returns the fill level in bytes
+     */
+    virtual uint64_t get_fifo_fullness(const size_t chan) = 0;
+
+    /*! Get the current fill level of all FIFOs in bytes
+     *
+     * Convenience overload for periodically sampling the fill level of
+     * every channel, e.g. from a telemetry thread.
+     *
+     * \returns one fill level in bytes per channel
+     */
+    virtual std::vector<uint64_t> get_fifo_fullness() = 0;
 };
 
 }} // namespace uhd::rfnoc
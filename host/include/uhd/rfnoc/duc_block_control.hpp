@@ -122,6 +122,30 @@ public:
      * \returns the coerced sampling rate at this block's output
      */
     virtual double set_input_rate(const double rate, const size_t chan) = 0;
+
+    /*! Set the input rate without a graph-wide property resolution (fast path)
+     *
+     * Like set_input_rate(), but constrained for rate agility: \p rate must
+     * correspond exactly to one of the precomputed legal interpolations (cf.
+     * get_input_rates()); it is validated against that set and never coerced.
+     * On success, only the DUC registers and this block's own properties are
+     * updated — no property propagation through the graph is triggered, which
+     * makes this call considerably cheaper in large graphs.
+     *
+     * The interpolation affects neither tick rates nor packet sizes, so the
+     * graph stays functional. However, upstream blocks are not notified of
+     * the changed rate and scaling; they will pick up the new values on the
+     * next full property resolution.
+     *
+     * \param rate The requested rate
+     * \param chan The channel for which the rate is being set
+     * \returns the new sampling rate at this block's input
+     * \throws uhd::runtime_error if the output rate is not yet valid (i.e.,
+     *         the graph was not yet committed)
+     * \throws uhd::value_error if \p rate does not correspond to a legal
+     *         interpolation of the current output rate
+     */
+    virtual double set_input_rate_fast(const double rate, const size_t chan) = 0;
 };
 
 }} // namespace uhd::rfnoc
@@ -335,6 +335,22 @@ public:
      */
     virtual std::vector<std::string> get_sensor_names() = 0;
 
+    /*! Get multiple motherboard sensor values in one call
+     *
+     * This returns the same values as calling get_sensor() for every entry
+     * of \p names, but implementations may coalesce the reads into a single
+     * transaction to the device (e.g., one RPC call), which significantly
+     * reduces control-plane traffic when many sensors are polled
+     * periodically (e.g., for telemetry).
+     *
+     * The default implementation simply calls get_sensor() for every name.
+     *
+     * \param names the names of the sensors to read
+     * \return a vector of sensor value objects, in the same order as \p names
+     */
+    virtual std::vector<uhd::sensor_value_t> get_sensors(
+        const std::vector<std::string>& names);
+
     /*! Return the motherboard EEPROM data
      */
     virtual uhd::usrp::mboard_eeprom_t get_eeprom() = 0;
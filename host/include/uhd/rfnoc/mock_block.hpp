@@ -15,6 +15,7 @@
 #include <uhd/utils/log.hpp>
 #include <unordered_map>
 #include <boost/format.hpp>
+#include <limits>
 #include <vector>
 
 namespace uhd { namespace rfnoc {
@@ -115,6 +116,17 @@ public:
         // nop
     }
 
+    size_t get_cmd_buff_space() const
+    {
+        // The mock never runs out of space
+        return std::numeric_limits<size_t>::max();
+    }
+
+    void register_cmd_buff_space_handler(cmd_buff_space_callback_t /*callback_f*/)
+    {
+        // nop
+    }
+
     void set_policy(const std::string& name, const uhd::device_addr_t& args)
     {
         UHD_LOG_INFO("MOCK_REG_IFACE",
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace uhd { namespace rfnoc {
@@ -38,6 +39,8 @@ public:
     using resolve_callback_t = std::function<void(void)>;
     using action_handler_t =
         std::function<void(const res_source_info&, action_info::sptr)>;
+    using multi_action_handler_t = std::function<void(
+        const std::vector<std::pair<res_source_info, action_info::sptr>>&)>;
 
     //! Types of property/action forwarding for those not defined by the block itself
     enum class forwarding_policy_t {
@@ -157,6 +160,36 @@ public:
     const prop_data_t& get_property(
         const std::string& id, const size_t instance = 0) /* mutable */;
 
+    /*! Set the value of a user property by compile-time key
+     *
+     * Same as set_property(), but the property is identified by a
+     * prop_key_t. The key carries the property's hash and data type, so the
+     * lookup compares precomputed hashes instead of strings and the value
+     * type is checked at compile time against the key.
+     *
+     * \param key The key of the property to write (see prop_key_t)
+     * \param val The new value of the property.
+     * \param instance The instance number of this property
+     */
+    template <typename prop_data_t>
+    void set_property(const prop_key_t<prop_data_t>& key,
+        const prop_data_t& val,
+        const size_t instance = 0);
+
+    /*! Get the value of a user property by compile-time key
+     *
+     * Same as get_property(), but the property is identified by a
+     * prop_key_t (see set_property() for the benefits).
+     *
+     * \param key The key of the property to read (see prop_key_t)
+     * \param instance The instance number of this property
+     * \return The value of the property.
+     * \throws uhd::lookup_error if the property can't be found.
+     */
+    template <typename prop_data_t>
+    const prop_data_t& get_property(
+        const prop_key_t<prop_data_t>& key, const size_t instance = 0) /* mutable */;
+
     /*! Standard API for setting the command time
      *
      * There are instances where commands need a time associated with them.
@@ -249,6 +282,32 @@ protected:
     void add_property_resolver(
         prop_ptrs_t&& inputs, prop_ptrs_t&& outputs, resolver_fn_t&& resolver_fn);
 
+    /*! Like set_property(), but only resolves this node's own properties
+     *
+     * This is a fast path for property changes whose effects are known to be
+     * contained within a single node: The property is set and this node's
+     * resolvers run, but no graph-wide property propagation is triggered. In
+     * large graphs, a full propagation can be orders of magnitude more
+     * expensive than the local resolution.
+     *
+     * The price is that neighbouring nodes do not see the updated edge
+     * properties until the next full resolution. This node's edge properties
+     * are deliberately left marked dirty so that the next graph-wide
+     * resolution (triggered by any subsequent set_property() or
+     * get_property() call on any node in the graph) starts from this node and
+     * propagates the new values outward. Blocks must therefore only use this
+     * for changes that cannot invalidate other nodes' state (e.g., changes
+     * that affect neither tick rates nor packet sizes), and should expose it
+     * through constrained APIs that validate this precondition.
+     *
+     * \param id The identifier of the property to write
+     * \param val The new value of the property
+     * \param src_info The source info of the property to write
+     */
+    template <typename prop_data_t>
+    void set_property_local(
+        const std::string& id, const prop_data_t& val, const res_source_info& src_info);
+
     /**************************************************************************
      * Property forwarding
      *************************************************************************/
@@ -355,6 +414,23 @@ protected:
      */
     void post_action(const res_source_info& edge_info, action_info::sptr action);
 
+    /*! Post several actions at once
+     *
+     * Identical to calling post_action() for every element of \p actions,
+     * except that the graph delivers the whole batch in a single
+     * action-handling pass: all actions are enqueued before the first one is
+     * delivered, and no other thread can interleave its own actions between
+     * them. Use this when one event must fan out to multiple chains with
+     * minimal skew, e.g. a stream command going to all channels of a
+     * streamer.
+     *
+     * \param actions Pairs of edge info and action, see post_action()
+     * \throws uhd::runtime_error if any edge info is not either INPUT_EDGE or
+     *         OUTPUT_EDGE
+     */
+    void post_actions(
+        const std::vector<std::pair<res_source_info, action_info::sptr>>& actions);
+
     /**************************************************************************
      * Graph Interaction
      *************************************************************************/
@@ -404,6 +480,14 @@ private:
     property_base_t* _find_property(
         res_source_info src_info, const std::string& id) const;
 
+    /*! Like _find_property(), but with the ID's hash already computed
+     *
+     * Properties are compared by hash first, and by string only on a hash
+     * match, so the caller must pass \p id_hash == prop_id_hash(\p id).
+     */
+    property_base_t* _find_property(
+        res_source_info src_info, const uint32_t id_hash, const char* id) const;
+
     /*! RAII-Style property access
      *
      * Returns an object which will grant temporary \p access to the property
@@ -492,6 +576,16 @@ private:
      */
     void clean_props();
 
+    /*! Like clean_props(), but leaves edge properties dirty
+     *
+     * This is used by set_property_local(): Edge properties modified by a
+     * local-only resolution remain dirty so that the next graph-wide
+     * resolution picks up this node and forwards the new values to its
+     * neighbours (instead of the neighbours' stale values being forwarded
+     * back). All properties are still set to read-only.
+     */
+    void clean_non_edge_props();
+
     /*! Sets a callback that the framework can call when it needs to trigger a
      * property resolution.
      */
@@ -548,6 +642,14 @@ private:
         _post_action_cb = std::move(post_handler);
     }
 
+    /*! Sets a callback that this node can call to post a batch of actions in
+     * one action-handling pass. See post_actions().
+     */
+    void set_post_actions_callback(multi_action_handler_t&& post_handler)
+    {
+        _post_actions_cb = std::move(post_handler);
+    }
+
     /*! This function gets called by the framework when there's a new action for
      * this node. It will then dispatch appropriate action handlers.
      *
@@ -622,6 +724,12 @@ private:
     action_handler_t _post_action_cb = [](const res_source_info&,
                                            action_info::sptr) { /* nop */ };
 
+    //! Callback which allows us to post a batch of actions in one pass
+    //
+    // When unset, post_actions() falls back to posting one action at a time
+    // through _post_action_cb
+    multi_action_handler_t _post_actions_cb;
+
     /**************************************************************************
      * Other attributes
      *************************************************************************/
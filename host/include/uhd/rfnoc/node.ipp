@@ -15,7 +15,7 @@ template <typename prop_data_t>
 uhd::rfnoc::property_t<prop_data_t>* _assert_prop(
     uhd::rfnoc::property_base_t* prop_base_ptr,
     const std::string& node_id,
-    const std::string& prop_id)
+    const char* prop_id)
 {
     // First check if the pointer is valid at all:
     if (prop_base_ptr == nullptr) {
@@ -56,13 +56,47 @@ const prop_data_t& node_t::get_property(const std::string& id, const size_t inst
     return get_property<prop_data_t>(id, src_info);
 }
 
+template <typename prop_data_t>
+void node_t::set_property(
+    const prop_key_t<prop_data_t>& key, const prop_data_t& val, const size_t instance)
+{
+    const res_source_info src_info{res_source_info::USER, instance};
+    RFNOC_LOG_TRACE("Setting property " << key.id << "@" << src_info.to_string());
+    auto prop_ptr = _assert_prop<prop_data_t>(
+        _find_property(src_info, key.hash, key.id), get_unique_id(), key.id);
+    {
+        auto prop_access = _request_property_access(prop_ptr, property_base_t::RW);
+        prop_ptr->set(val);
+    }
+
+    // Now trigger a property resolution. If other properties depend on this one,
+    // they will be updated.
+    resolve_all();
+}
+
+template <typename prop_data_t>
+const prop_data_t& node_t::get_property(
+    const prop_key_t<prop_data_t>& key, const size_t instance)
+{
+    const res_source_info src_info{res_source_info::USER, instance};
+    RFNOC_LOG_TRACE("Getting property " << key.id << "@" << src_info.to_string());
+    // First, trigger a property resolution to make sure this property is
+    // updated (if necessary) before reading it out
+    resolve_all();
+    auto prop_ptr = _assert_prop<prop_data_t>(
+        _find_property(src_info, key.hash, key.id), get_unique_id(), key.id);
+
+    auto prop_access = _request_property_access(prop_ptr, property_base_t::RO);
+    return prop_ptr->get();
+}
+
 template <typename prop_data_t>
 void node_t::set_property(
     const std::string& id, const prop_data_t& val, const res_source_info& src_info)
 {
     RFNOC_LOG_TRACE("Setting property " << id << "@" << src_info.to_string());
     auto prop_ptr =
-        _assert_prop<prop_data_t>(_find_property(src_info, id), get_unique_id(), id);
+        _assert_prop<prop_data_t>(_find_property(src_info, id), get_unique_id(), id.c_str());
     {
         auto prop_access = _request_property_access(prop_ptr, property_base_t::RW);
         prop_ptr->set(val);
@@ -73,6 +107,26 @@ void node_t::set_property(
     resolve_all();
 }
 
+template <typename prop_data_t>
+void node_t::set_property_local(
+    const std::string& id, const prop_data_t& val, const res_source_info& src_info)
+{
+    RFNOC_LOG_TRACE("Setting property " << id << "@" << src_info.to_string()
+                                        << " (local resolution only)");
+    auto prop_ptr =
+        _assert_prop<prop_data_t>(_find_property(src_info, id), get_unique_id(), id.c_str());
+    {
+        auto prop_access = _request_property_access(prop_ptr, property_base_t::RW);
+        prop_ptr->set(val);
+    }
+
+    // Only run this node's own resolvers; deliberately skip the graph-wide
+    // property propagation. Edge properties stay dirty so the next full
+    // resolution forwards them (see the declaration for the consequences).
+    resolve_props();
+    clean_non_edge_props();
+}
+
 template <typename prop_data_t>
 const prop_data_t& node_t::get_property(
     const std::string& id, const res_source_info& src_info)
@@ -82,7 +136,7 @@ const prop_data_t& node_t::get_property(
     // updated (if necessary) before reading it out
     resolve_all();
     auto prop_ptr = _assert_prop<prop_data_t>(
-        _find_property(src_info, id), get_unique_id(), id);
+        _find_property(src_info, id), get_unique_id(), id.c_str());
 
     auto prop_access = _request_property_access(prop_ptr, property_base_t::RO);
     return prop_ptr->get();
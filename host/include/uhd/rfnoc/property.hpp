@@ -10,6 +10,7 @@
 #include <uhd/rfnoc/res_source_info.hpp>
 #include <uhd/utils/cast.hpp>
 #include <uhd/utils/dirty_tracked.hpp>
+#include <stdint.h>
 #include <memory>
 #include <string>
 
@@ -19,6 +20,54 @@ namespace uhd { namespace rfnoc {
 // Forward declaration, separates includes
 class prop_accessor_t;
 
+/*! Hash a property ID (FNV-1a, 32 bit)
+ *
+ * This is constexpr so that property keys known at compile time hash at
+ * compile time. Properties store the hash of their ID, which lets lookups
+ * compare integers first and only fall back to string comparison on a hash
+ * match.
+ */
+constexpr uint32_t prop_id_hash(const char* id)
+{
+    uint32_t hash = 2166136261u;
+    while (*id) {
+        hash = (hash ^ static_cast<uint32_t>(static_cast<unsigned char>(*id++)))
+               * 16777619u;
+    }
+    return hash;
+}
+
+//! Overload of prop_id_hash() for runtime strings
+inline uint32_t prop_id_hash(const std::string& id)
+{
+    return prop_id_hash(id.c_str());
+}
+
+/*! Compile-time key for property access
+ *
+ * A property key pairs a property ID with its precomputed hash and the
+ * property's data type. Declaring keys as constants lets blocks access
+ * their properties without hashing or allocating at the call site, and the
+ * data type travels with the key, so get_property()/set_property() calls
+ * can't disagree with the key's type:
+ *
+ *     static constexpr prop_key_t<double> PROP_KEY_FREQ{"freq"};
+ *     // ...
+ *     set_property(PROP_KEY_FREQ, 1e9, chan); // No type argument needed
+ *
+ * String-based access remains available for dynamically defined properties.
+ */
+template <typename data_t>
+struct prop_key_t
+{
+    // Explicit so that string literals passed to get/set_property() keep
+    // selecting the std::string overloads
+    explicit constexpr prop_key_t(const char* id_) : id(id_), hash(prop_id_hash(id_)) {}
+
+    const char* const id;
+    const uint32_t hash;
+};
+
 /*! Base class for properties
  *
  */
@@ -34,7 +83,7 @@ public:
     };
 
     property_base_t(const std::string& id, const res_source_info& source_info)
-        : _id(id), _source_info(source_info)
+        : _id(id), _id_hash(prop_id_hash(id)), _source_info(source_info)
     {
     }
 
@@ -44,6 +93,12 @@ public:
         return _id;
     }
 
+    //! Gets the hash of this property's ID (see prop_id_hash())
+    uint32_t get_id_hash() const
+    {
+        return _id_hash;
+    }
+
     //! Return the source info for this property
     const res_source_info& get_src_info() const
     {
@@ -126,6 +181,9 @@ private:
     //! Stores an ID string for this property. They don't need to be unique.
     const std::string _id;
 
+    //! Hash of _id, precomputed for fast lookups
+    const uint32_t _id_hash;
+
     //! Stores the source info for this property.
     const res_source_info _source_info;
 
@@ -14,6 +14,7 @@
 #include <uhd/types/ranges.hpp>
 #include <uhd/types/sensors.hpp>
 #include <uhd/types/stream_cmd.hpp>
+#include <future>
 
 namespace uhd { namespace rfnoc {
 
@@ -102,6 +103,22 @@ public:
      */
     virtual double set_tx_frequency(const double freq, size_t chan) = 0;
 
+    /*! Tune the TX frequency for channel \p chan without blocking the caller.
+     *
+     * This is the asynchronous version of set_tx_frequency(). The tune
+     * (including LO settling and any daughterboard register writes) runs on a
+     * separate thread, so independent channels or radios can be retuned
+     * concurrently instead of back-to-back. Any error thrown by the tune is
+     * rethrown when the future is waited on.
+     *
+     * \param freq Frequency in Hz
+     * \param chan Channel to tune
+     *
+     * \return A future that yields the actual (coerced) frequency.
+     */
+    virtual std::future<double> set_tx_frequency_async(
+        const double freq, const size_t chan) = 0;
+
     /*! Set the TX tune args, if supported by the hardware.
      */
     virtual void set_tx_tune_args(const uhd::device_addr_t& args, const size_t chan) = 0;
@@ -132,6 +149,18 @@ public:
      */
     virtual double set_rx_frequency(const double freq, const size_t chan) = 0;
 
+    /*! Tune the RX frequency for channel \p chan without blocking the caller.
+     *
+     * This is the asynchronous version of set_rx_frequency(). See
+     * set_tx_frequency_async() for details on the threading behaviour.
+     *
+     * \param freq Requested frequency
+     * \param chan Channel number.
+     * \return A future that yields the actual (coerced) frequency.
+     */
+    virtual std::future<double> set_rx_frequency_async(
+        const double freq, const size_t chan) = 0;
+
     /*! Set the TX tune args, if supported by the hardware.
      */
     virtual void set_rx_tune_args(const uhd::device_addr_t& args, const size_t chan) = 0;
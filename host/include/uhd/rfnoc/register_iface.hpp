@@ -55,6 +55,15 @@ public:
     using async_msg_callback_t = std::function<void(
         uint32_t addr, const std::vector<uint32_t>& data, boost::optional<uint64_t>)>;
 
+    /*! Callback function for when command buffer space is freed.
+     *
+     *  When responses from the device return flow-control credits, and thus
+     *  free up space in the command buffer, this callback is invoked with the
+     *  current amount of free space in 32-bit words (the same value that
+     *  get_cmd_buff_space() would return at that point).
+     */
+    using cmd_buff_space_callback_t = std::function<void(size_t buff_space)>;
+
     /*! Write a 32-bit register implemented in the NoC block.
      *
      * \param addr The byte address of the register to write to (truncated to 20 bits).
@@ -290,10 +299,63 @@ public:
      */
     virtual void register_async_msg_handler(async_msg_callback_t callback_f) = 0;
 
+    /*! Query the free space in the downstream command buffer.
+     *
+     * The host mirrors the occupancy of the command buffer exactly through
+     * flow control: every request occupies its payload size in the buffer
+     * until its response returns. This call reports how many 32-bit words can
+     * currently be queued without blocking; a request that doesn't fit will
+     * stall inside the poke/peek call until enough responses have returned.
+     * As a sizing guide, an untimed poke32() occupies 3 words and a timed
+     * poke32() occupies 5 words (the timestamp adds two words).
+     *
+     * Together with register_cmd_buff_space_handler(), this allows a
+     * scheduler to pipeline timed commands (e.g., a sequence of timed tunes)
+     * up to the full depth of the command buffer, rather than throttling
+     * blindly to avoid stalls.
+     *
+     * \return The free command buffer space in 32-bit words
+     */
+    virtual size_t get_cmd_buff_space() const = 0;
+
+    /*! Register a callback function for when command buffer space frees up.
+     *
+     * The callback is invoked from the I/O service context every time
+     * responses return flow-control credits to the command buffer. It must
+     * not block, and because it is called outside of this class' internal
+     * locks, it may issue new commands on this register interface (that is
+     * its intended use).
+     *
+     * Only one callback function can be registered. When calling this
+     * multiple times, only the last callback will be accepted.
+     *
+     * \param callback_f The function to call when command buffer space frees up
+     */
+    virtual void register_cmd_buff_space_handler(
+        cmd_buff_space_callback_t callback_f) = 0;
+
     /*! Set a policy that governs the operational parameters of this register bus.
      *  Policies can be used to make tradeoffs between performance, resilience, latency,
      *  etc.
      *
+     *  The following policies are supported:
+     *  - "default": Writes are sent individually and reads block on their
+     *    response. Accepts a "timeout" argument (transaction timeout in
+     *    seconds).
+     *  - "write_combine": Like "default", but unacked writes to consecutive
+     *    addresses are queued and sent as a single block write, which greatly
+     *    reduces the transaction count during bulk configuration (e.g.,
+     *    loading filter coefficients). A timed write starts a new run whose
+     *    timestamp applies to the entire run, so a sequence of writes to
+     *    consecutive registers (e.g., a timed GPIO switching sequence)
+     *    executes back-to-back in hardware at the given time while costing a
+     *    single control transaction. Queued writes are flushed when the run
+     *    of consecutive addresses ends, when the control payload is full,
+     *    before any read or sleep operation, and when the policy is changed.
+     *    Note that a write may thus not have reached the hardware until one
+     *    of these flush points; switch back to "default" to flush and leave
+     *    this mode.
+     *
      * \param name The name of the policy to apply
      * \param args Additional arguments to pass to the policy governor
      */
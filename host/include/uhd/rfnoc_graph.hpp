@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/config.hpp>
+#include <uhd/exception.hpp>
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/graph_edge.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
@@ -14,6 +15,7 @@
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/time_spec.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <boost/units/detail/utility.hpp> // for demangle
 #include <memory>
@@ -262,6 +264,12 @@ public:
      * This method needs to be called when the graph is ready for action.
      * It will run checks on the graph and run a property propagation.
      *
+     * Because commit() and release() are counting, the topology checks and
+     * property propagation only run when the release count drops to zero.
+     * This makes it possible to batch multiple connections and property
+     * changes into a single resolution (see also graph_edit_session, which
+     * wraps this pattern).
+     *
      * \throws uhd::resolve_error if the properties fail to resolve.
      */
     virtual void commit() = 0;
@@ -340,4 +348,65 @@ public:
     virtual uhd::property_tree::sptr get_tree(void) const = 0;
 }; // class rfnoc_graph
 
+/*! Scoped edit session for batching changes to an rfnoc_graph
+ *
+ * Reconfiguring a committed graph one call at a time re-runs the topology
+ * checks and a full property propagation after every single change, which
+ * is wasteful when an application needs to make several connections or
+ * property changes at once (e.g., retuning a frequency-hopping chain).
+ *
+ * Constructing this object releases the graph, which defers property
+ * propagation; destroying it commits the graph again, so all changes made
+ * during the lifetime of the session are resolved in a single pass.
+ * Because commit() and release() are counting, sessions may be nested;
+ * resolution runs when the outermost session ends.
+ *
+ * Example:
+ * ~~~{.cpp}
+ * {
+ *     uhd::rfnoc::graph_edit_session session(graph);
+ *     graph->connect(block_a, 0, block_b, 0);
+ *     graph->connect(block_b, 0, block_c, 0);
+ *     block_a->set_property<int>("foo", 42, 0);
+ * } // <- topology checks and property resolution run once, here
+ * ~~~
+ */
+class graph_edit_session : public uhd::noncopyable
+{
+public:
+    graph_edit_session(rfnoc_graph::sptr graph) : _graph(std::move(graph))
+    {
+        _graph->release();
+    }
+
+    /*! End the session early and commit the batched changes
+     *
+     * Unlike letting the session go out of scope, this propagates any
+     * exception thrown during resolution to the caller.
+     *
+     * \throws uhd::resolve_error if the properties fail to resolve.
+     */
+    void commit()
+    {
+        if (!_committed) {
+            _committed = true;
+            _graph->commit();
+        }
+    }
+
+    ~graph_edit_session()
+    {
+        // Destructors must not throw; use commit() to see resolution errors
+        try {
+            commit();
+        } catch (const uhd::exception& ex) {
+            UHD_LOG_ERROR("RFNOC", "Error committing graph edit session: " << ex.what());
+        }
+    }
+
+private:
+    rfnoc_graph::sptr _graph;
+    bool _committed = false;
+};
+
 }}; // namespace uhd::rfnoc
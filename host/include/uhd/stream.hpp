@@ -14,7 +14,11 @@
 #include <uhd/types/stream_cmd.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <boost/utility.hpp>
+#include <array>
+#include <complex>
+#include <cstdint>
 #include <memory>
+#include <vector>
 #include <string>
 #include <vector>
 
@@ -69,6 +73,8 @@ struct UHD_API stream_args_t
      * Conversions for the following CPU formats have been implemented:
      *  - fc64 - complex<double>
      *  - fc32 - complex<float>
+     *  - fc16 - complex IEEE 754 binary16; buffers hold the raw component
+     *           bits as pairs of uint16_t
      *  - sc16 - complex<int16_t>
      *  - sc8 - complex<int8_t>
      *
@@ -128,6 +134,23 @@ struct UHD_API stream_args_t
      * Users should specify this option to request smaller than default
      * packets, probably with the intention of reducing packet latency.
      *
+     * - tolerate_seq_error: when set to 1, the RX streamer does
+     * not return an overflow error when it detects a dropped packet.
+     * Instead, it keeps streaming and reports the gap through the
+     * out_of_sequence flag and the dropped_samps count in rx_metadata_t,
+     * leaving the recovery decision to the application. This avoids the
+     * latency of a stream stop/restart for isolated packet loss.
+     *
+     * - aggregate_bursts: number of consecutive end-of-burst terminated
+     * bursts the RX streamer coalesces into one recv() buffer. By default
+     * (or when set to 1), recv() returns at every end-of-burst marker. When
+     * blocks deliver many small bursts (e.g., an FFT block emitting one
+     * packet per transform), setting this to N amortizes the per-call
+     * overhead over N bursts: recv() only returns once N bursts (or the
+     * requested number of samples) have been read, with the end-of-burst
+     * flag set for the last aggregated burst. The returned time spec always
+     * refers to the first packet in the buffer.
+     *
      * - noclear: Used by tx_dsp_core_200 and rx_dsp_core_200
      *
      * The following are not implemented, but are listed for conceptual purposes:
@@ -161,6 +184,147 @@ struct UHD_API stream_args_t
     std::vector<size_t> channels;
 };
 
+/*!
+ * Statistics accumulated by a streamer.
+ *
+ * The counters are cumulative over the lifetime of the streamer and are
+ * updated on the streamer's packet path. They can be queried while streaming
+ * without perturbing it: the counters are written without synchronization,
+ * so values read from a thread other than the one calling recv()/send() may
+ * be momentarily inconsistent with each other, but each counter on its own
+ * is monotonically increasing.
+ */
+struct UHD_API stream_stats_t
+{
+    //! Number of buckets in the call latency histogram
+    static const size_t NUM_LATENCY_BUCKETS = 16;
+
+    //! Packets transferred, summed across all channels
+    uint64_t num_packets = 0;
+
+    //! Over-the-wire sample bytes transferred, summed across all channels
+    uint64_t num_bytes = 0;
+
+    //! Sequence error events, i.e. packets detected as dropped on receive.
+    //! Transmit-side errors are reported through the async message queue
+    //! instead, so this stays zero for TX streamers.
+    uint64_t num_seq_errors = 0;
+
+    //! Timestamp discontinuity events, i.e. timestamped packets whose
+    //! timestamp did not line up with the end of the previous packet. Gaps
+    //! already reported as sequence errors are not counted again here. Only
+    //! populated for RX streamers.
+    uint64_t num_ts_discontinuities = 0;
+
+    //! Calls that timed out waiting on the transport
+    uint64_t num_timeouts = 0;
+
+    //! Total number of recv() or send() calls
+    uint64_t num_calls = 0;
+
+    //! Time in nanoseconds spent in calls that timed out waiting on the
+    //! transport (RX: waiting for packets to arrive, TX: waiting for flow
+    //! control credit or a free frame buffer)
+    uint64_t stall_time_ns = 0;
+
+    //! Histogram of recv()/send() call durations. Bucket N counts calls
+    //! that took between 2^N and 2^(N+1) microseconds; bucket 0 also
+    //! collects sub-microsecond calls and the last bucket all longer ones.
+    std::array<uint64_t, NUM_LATENCY_BUCKETS> call_latency_hist{{}};
+
+    //! Maximum number of flow control drop events retained per channel
+    static const size_t MAX_FC_DROP_EVENTS = 16;
+
+    //! A receive-side packet drop detected through flow control accounting.
+    //! The credit state captured with each event tells host-slowness apart
+    //! from loss in the network without a packet capture.
+    struct fc_drop_event_t
+    {
+        //! Time the drop was detected, in nanoseconds on the steady
+        //! (monotonic) clock
+        uint64_t time_ns = 0;
+
+        //! Streamer channel on which the drop was detected
+        size_t channel = 0;
+
+        //! Over-the-wire bytes dropped
+        uint64_t bytes_dropped = 0;
+
+        //! Packets dropped
+        uint64_t packets_dropped = 0;
+
+        //! Bytes received but not yet released back to the device when the
+        //! drop was detected, i.e. flow control credit held by the host. A
+        //! value close to the transport buffer size means the host was not
+        //! keeping up; a value near zero points at loss in the network.
+        uint64_t bytes_held = 0;
+
+        //! Cumulative released (transfer-complete) byte count at the drop
+        uint64_t xfer_bytes = 0;
+
+        //! Cumulative released packet count at the drop
+        uint64_t xfer_packets = 0;
+    };
+
+    //! Most recent flow control drop events across all channels, oldest
+    //! first. At most MAX_FC_DROP_EVENTS per channel are retained; older
+    //! events are discarded. Only populated for RX streamers.
+    std::vector<fc_drop_event_t> fc_drop_events;
+};
+
+/*!
+ * Interface for a receive post-processing stage.
+ *
+ * A post-processor attached to an RX streamer channel runs inside the
+ * streamer's conversion pass: it is handed each packet's worth of converted
+ * samples while they are still cache resident and writes its output
+ * directly into the caller's recv() buffer, so a sample-rate reduction or
+ * filtering stage costs no separate traversal of the receive buffer.
+ *
+ * Implementations may hold filter state across calls; packets of one
+ * channel are always processed in order on the thread calling recv().
+ */
+class UHD_API rx_postproc : uhd::noncopyable
+{
+public:
+    typedef std::shared_ptr<rx_postproc> sptr;
+
+    virtual ~rx_postproc(void);
+
+    /*! Process one chunk of converted samples
+     *
+     * \param in pointer to num_in converted input samples
+     * \param out pointer to the output region
+     * \param num_in number of input samples available
+     * \return the number of output samples written to out
+     */
+    virtual size_t process(const void* in, void* out, const size_t num_in) = 0;
+
+    /*! Return the largest number of input samples that is guaranteed to
+     * produce no more than max_out output samples, given any input already
+     * buffered by the processor. Used by the streamer to avoid overrunning
+     * the caller's buffer.
+     */
+    virtual size_t max_input(const size_t max_out) const = 0;
+};
+
+/*!
+ * Create a streaming polyphase FIR decimator for use with
+ * rx_streamer::set_postproc().
+ *
+ * The decimator consumes fc32 samples and produces one filtered output
+ * sample per \p decim inputs, carrying its filter history across packets.
+ * When no taps are given, a Hamming-windowed sinc lowpass with unity DC
+ * gain and a cutoff at 80% of the decimated Nyquist rate is designed
+ * internally.
+ *
+ * \param decim the integer decimation factor, must be nonzero
+ * \param taps optional FIR prototype filter taps
+ * \return a new decimator instance
+ */
+UHD_API rx_postproc::sptr make_fir_decimator(
+    const size_t decim, const std::vector<float>& taps = std::vector<float>());
+
 /*!
  * The RX streamer is the host interface to receiving samples.
  * It represents the layer between the samples on the host
@@ -212,6 +376,14 @@ public:
      * different sources, then those may be called from different threads
      * simultaneously.
      *
+     * Note on real-time use: recv() is hot-path safe. In steady state (i.e.,
+     * once streaming has started and while no error conditions occur), it
+     * performs no heap allocations, so it can be called from real-time
+     * threads. The same holds for get_num_channels(), get_max_num_samps()
+     * and get_stream_stats(). Other methods of this class, as well as the
+     * error paths of recv() itself (which may construct log messages), make
+     * no such guarantee.
+     *
      * \param buffs a vector of writable memory to fill with samples
      * \param nsamps_per_buff the size of each buffer in number of samples
      * \param metadata data to fill describing the buffer
@@ -225,6 +397,131 @@ public:
         const double timeout  = 0.1,
         const bool one_packet = false) = 0;
 
+    /*!
+     * Borrow the payload of the next received packet directly from the
+     * transport, without copying or converting samples.
+     *
+     * This is an advanced API for applications that consume samples in the
+     * over-the-wire format (e.g., recording sc16 data with an sc16 wire
+     * format). The returned pointers reference the transport's own frame
+     * buffers, so the usual conversion and copy into a caller-provided
+     * buffer is skipped entirely. The buffers remain valid until
+     * release_recv_buffs() is called, and the transport cannot reuse them
+     * for new packets until then; call release_recv_buffs() promptly to
+     * avoid starving the link of receive frames.
+     *
+     * The metadata is filled in the same way as for recv(), except that
+     * fragmentation does not apply: each call returns exactly one packet
+     * per channel. It is not valid to call this method while a previous
+     * borrow is outstanding, or while a partially read packet from recv()
+     * is in flight. Like recv(), this method is not thread-safe.
+     *
+     * \param buffs vector to fill with one payload pointer per channel;
+     *              the data is in the over-the-wire format
+     * \param metadata data to fill describing the packet payloads
+     * \param timeout the timeout in seconds to wait for a packet
+     * \return the number of samples in each payload, or 0 on error
+     */
+    virtual size_t recv_buffs(std::vector<const void*>& buffs,
+        rx_metadata_t& metadata,
+        const double timeout = 0.1);
+
+    /*!
+     * Release the packet buffers borrowed by the last successful call to
+     * recv_buffs() back to the transport for reuse. Calling this without
+     * an outstanding borrow is a no-op.
+     */
+    virtual void release_recv_buffs();
+
+    /*!
+     * Query the statistics accumulated by this streamer.
+     *
+     * Not all streamer implementations keep statistics; those that do not
+     * will throw a uhd::not_implemented_error.
+     *
+     * \return a snapshot of the streamer's counters
+     */
+    virtual stream_stats_t get_stream_stats() const;
+
+    /*!
+     * Enable or disable one of this streamer's channels at runtime.
+     *
+     * A disabled channel stays connected: its transport and flow control
+     * state are kept warm, but the streamer stops delivering samples for it
+     * and it no longer takes part in time alignment. In recv(), the buffer
+     * of a disabled channel is left untouched; in recv_buffs(), its payload
+     * pointer is returned as nullptr. This makes switching between channel
+     * subsets (e.g. 4- and 8-channel operating modes) a sub-millisecond
+     * operation, where recreating the streamer would take hundreds of
+     * milliseconds of transport setup.
+     *
+     * Stop the stream on a channel before disabling it, otherwise its
+     * queued packets will back up into the device. Channels must not be
+     * enabled or disabled while a recv() fragment or a recv_buffs() borrow
+     * is outstanding. At least one channel must remain enabled.
+     *
+     * Not all streamer implementations support this; those that do not
+     * will throw a uhd::not_implemented_error.
+     *
+     * \param channel the channel index to modify
+     * \param enabled false to park the channel, true to resume it
+     */
+    virtual void set_channel_enabled(const size_t channel, const bool enabled);
+
+    /*!
+     * Query whether a channel is currently enabled.
+     *
+     * \param channel the channel index to query
+     * \return true if the channel delivers samples
+     */
+    virtual bool is_channel_enabled(const size_t channel) const;
+
+    /*!
+     * Apply a host-side DC offset / IQ balance correction to a channel.
+     *
+     * Every received sample y on the channel is replaced with
+     * y * gain + offset before it is handed to the caller. The correction is
+     * folded into the format conversion pass, running over each packet while
+     * it is still cache resident, so unlike a correction loop after recv()
+     * in the application it does not cost a separate traversal of the
+     * receive buffer. It is intended as a fallback for frontend paths
+     * without hardware correction.
+     *
+     * The correction runs in the CPU sample domain and therefore requires a
+     * complex floating point cpu_format (fc32 or fc64). Passing a gain of 1
+     * and an offset of 0 restores the uncorrected fast path for the channel.
+     *
+     * Not all streamer implementations support this; those that do not
+     * will throw a uhd::not_implemented_error.
+     *
+     * \param channel the channel index to correct
+     * \param gain complex gain applied to each sample
+     * \param offset complex offset added after the gain
+     */
+    virtual void set_iq_correction(const size_t channel,
+        const std::complex<double> gain,
+        const std::complex<double> offset);
+
+    /*!
+     * Attach a post-processing stage to a channel, or detach it.
+     *
+     * See rx_postproc for the execution model. While a processor is
+     * attached, recv() counts and returns samples in the processor's output
+     * domain, while metadata timestamps and fragment offsets remain in the
+     * over-the-wire sample domain. When processors are attached to several
+     * channels of one streamer they should all have the same input/output
+     * ratio, since recv() fills all channel buffers in lockstep.
+     *
+     * A processor must not be attached or detached while a recv() fragment
+     * or a recv_buffs() borrow is outstanding. Not all streamer
+     * implementations support this; those that do not will throw a
+     * uhd::not_implemented_error.
+     *
+     * \param channel the channel index to modify
+     * \param postproc the processing stage, or nullptr to detach
+     */
+    virtual void set_postproc(const size_t channel, rx_postproc::sptr postproc);
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -239,6 +536,42 @@ public:
     virtual void issue_stream_cmd(const stream_cmd_t& stream_cmd) = 0;
 };
 
+/*!
+ * Create an RX streamer that aggregates several existing RX streamers.
+ *
+ * The aggregate streamer presents the channels of all member streamers as one
+ * channel list (in the order the members are given) and provides a single
+ * recv() call that time-aligns the members against each other, the same way a
+ * multi-channel streamer aligns its channels: packets whose timestamps fall
+ * behind the other members (e.g. after an overrun on one device) are dropped
+ * and refetched until all members agree. This allows coherent capture across
+ * channels that live in separate UHD sessions, e.g. one rfnoc_graph per
+ * device, without application-side alignment code.
+ *
+ * For the members to be alignable, their devices must share a time and clock
+ * reference, and streaming should be started with a timed stream command
+ * issued through issue_stream_cmd() on the aggregate streamer (which forwards
+ * it to all members). To additionally share I/O service worker threads across
+ * the member sessions, open the sessions with the `shared_io_srv_mgr=1`
+ * device arg.
+ *
+ * recv() on the aggregate streamer is hot-path safe under the same conditions
+ * as the member streamers: all per-call state is preallocated, so the steady
+ * state performs no heap allocations. recv() is not thread-safe, and the
+ * member streamers must not be used directly while the aggregate streamer is
+ * receiving.
+ *
+ * \param streamers the member RX streamers, each with at least one channel
+ * \param cpu_format the host sample format the members were created with
+ *                   (see stream_args_t::cpu_format); all members must use the
+ *                   same format
+ * \return an RX streamer spanning all channels of all members
+ * \throws uhd::value_error if no streamers are given or the CPU format is
+ *         not recognized
+ */
+UHD_API rx_streamer::sptr make_aggregate_rx_streamer(
+    const std::vector<rx_streamer::sptr>& streamers, const std::string& cpu_format);
+
 /*!
  * The TX streamer is the host interface to transmitting samples.
  * It represents the layer between the samples on the host
@@ -282,6 +615,14 @@ public:
      * different destinations, then those may be called from different threads
      * simultaneously.
      *
+     * Note on real-time use: send() is hot-path safe. In steady state (i.e.,
+     * once streaming has started and while no error conditions occur), it
+     * performs no heap allocations, so it can be called from real-time
+     * threads. The same holds for get_num_channels(), get_max_num_samps()
+     * and get_stream_stats(). Other methods of this class, as well as the
+     * error paths of send() itself (which may construct log messages), make
+     * no such guarantee.
+     *
      * \param buffs a vector of read-only memory containing samples
      * \param nsamps_per_buff the number of samples to send, per buffer
      * \param metadata data describing the buffer's contents
@@ -301,6 +642,16 @@ public:
      */
     virtual bool recv_async_msg(
         async_metadata_t& async_metadata, double timeout = 0.1) = 0;
+
+    /*!
+     * Query the statistics accumulated by this streamer.
+     *
+     * Not all streamer implementations keep statistics; those that do not
+     * will throw a uhd::not_implemented_error.
+     *
+     * \return a snapshot of the streamer's counters
+     */
+    virtual stream_stats_t get_stream_stats() const;
 };
 
 } // namespace uhd
@@ -30,10 +30,48 @@ public:
      * \param num_buffs the number of buffers to allocate
      * \param buff_size the size of each buffer in bytes
      * \param alignment the alignment boundary in bytes
+     * \param numa_node the NUMA node to allocate the memory on, or -1 for
+     *                  no placement control. Only honored on Linux; on
+     *                  other platforms, or if binding fails, the pool
+     *                  falls back to default placement with a warning.
+     * \param use_hugepages back the pool with 2 MB huge pages to reduce
+     *                  TLB pressure. Only honored on Linux; on other
+     *                  platforms, or if no huge pages are available, the
+     *                  pool falls back to regular pages with a warning.
      * \return a new buffer pool buff_size X num_buffs
      */
-    static sptr make(
-        const size_t num_buffs, const size_t buff_size, const size_t alignment = 16);
+    static sptr make(const size_t num_buffs,
+        const size_t buff_size,
+        const size_t alignment   = 16,
+        const int numa_node      = -1,
+        const bool use_hugepages = false);
+
+    /*!
+     * Make a buffer pool from application-provided memory.
+     *
+     * Instead of allocating its own memory, the pool carves the buffers out
+     * of \p mem. This allows received samples to land directly in memory the
+     * application has prepared for further processing, e.g., CUDA-pinned
+     * host memory for a zero-copy GPU pipeline.
+     *
+     * The pool does not take ownership: the caller must keep the region
+     * valid (and, where applicable, registered with the consuming device)
+     * for the lifetime of the pool.
+     *
+     * \param mem pointer to the application-provided memory region
+     * \param mem_size the size of the memory region in bytes
+     * \param num_buffs the number of buffers to carve out of the region
+     * \param buff_size the size of each buffer in bytes
+     * \param alignment the alignment boundary in bytes
+     * \return a new buffer pool buff_size X num_buffs
+     * \throws uhd::value_error if the region is too small to hold the
+     *         requested buffers at the requested alignment
+     */
+    static sptr make_external(void* mem,
+        const size_t mem_size,
+        const size_t num_buffs,
+        const size_t buff_size,
+        const size_t alignment = 16);
 
     //! Get a pointer to the buffer start at the specified index
     virtual ptr_type at(const size_t index) const = 0;
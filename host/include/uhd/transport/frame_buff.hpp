@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 namespace uhd { namespace transport {
@@ -55,12 +56,35 @@ public:
         _packet_size = size;
     }
 
+    /*!
+     * Returns the wire arrival time of the packet, if the link recorded one
+     * \return the arrival timestamp in nanoseconds, or 0 if the link does not
+     *         provide timestamps. The clock source is link-specific (NIC
+     *         hardware clock or host CLOCK_REALTIME for kernel sockets).
+     */
+    uint64_t wire_time_ns() const
+    {
+        return _wire_time_ns;
+    }
+
+    /*!
+     * Sets the wire arrival time of the packet contained in the frame buffer
+     * \param time_ns Arrival timestamp in nanoseconds, or 0 if not available
+     */
+    void set_wire_time_ns(uint64_t time_ns)
+    {
+        _wire_time_ns = time_ns;
+    }
+
 protected:
     /*! Pointer to data of current frame */
     void* _data = nullptr;
 
     /*! Size of packet in current frame */
     size_t _packet_size = 0;
+
+    /*! Wire arrival time of current frame, in ns (0 if not available) */
+    uint64_t _wire_time_ns = 0;
 };
 
 }} // namespace uhd::transport
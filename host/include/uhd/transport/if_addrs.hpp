@@ -30,5 +30,28 @@ struct UHD_API if_addrs_t
  */
 UHD_API std::vector<if_addrs_t> get_if_addrs(void);
 
+/*!
+ * Get a list of network interface addresses, served from a cache.
+ *
+ * Identical to get_if_addrs(), except the system-dependent enumeration is
+ * only re-run after a short TTL has expired. Discovery code that enumerates
+ * interfaces once per probe round should prefer this call: repeated find()
+ * invocations then share one enumeration instead of querying the OS every
+ * time.
+ * \return a vector of if addrs
+ */
+UHD_API std::vector<if_addrs_t> get_if_addrs_cached(void);
+
+/*!
+ * Check if an address belongs to a local network interface.
+ *
+ * The lookup is served from the same cache as get_if_addrs_cached(), with
+ * the interface addresses pre-indexed so repeated queries don't re-scan
+ * the interface list.
+ * \param addr an IPv4 address string
+ * \return true if a local interface owns this address
+ */
+UHD_API bool is_local_if_addr(const std::string& addr);
+
 }} // namespace uhd::transport
 
@@ -47,6 +47,15 @@ public:
     //! Make a virtual transport for the specified stream number
     virtual zero_copy_if::sptr make_stream(const uint32_t stream_num) = 0;
 
+    /*!
+     * Make a virtual transport for the specified stream number and mark it
+     * high priority. The demux thread never blocks on a high priority
+     * stream's queue (the oldest packet is dropped instead if the consumer
+     * has fallen behind), so time-critical command packets do not queue
+     * behind bulk traffic.
+     */
+    virtual zero_copy_if::sptr make_priority_stream(const uint32_t stream_num) = 0;
+
     //! Unregister the stream number. All packets destined to the stream will be dropped.
     virtual void remove_stream(const uint32_t stream_num) = 0;
 
@@ -150,9 +150,19 @@ bool nirio_fifo<data_t>::_acquire_block_from_rio_buffer(
         // (don't want to acquire partial frames)
         elements_to_request = elements_remaining_u32 - (elements_remaining_u32 % _frame_size_in_elements);
 
-        // the next call to wait_on_fifo can have a 0 timeout since we
-        // know there is at least as much data as we will request available
-        timeout_in_ms = 0;
+        if (elements_to_request == 0)
+        {
+            // no complete frame is ready yet: fall back to a blocking wait
+            // for the requested amount (with the caller's timeout) instead
+            // of returning empty-handed and forcing the caller to poll
+            elements_to_request = elements_requested;
+        }
+        else
+        {
+            // the next call to wait_on_fifo can have a 0 timeout since we
+            // know there is at least as much data as we will request available
+            timeout_in_ms = 0;
+        }
     }
     else
     {
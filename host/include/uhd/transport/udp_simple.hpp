@@ -41,6 +41,26 @@ public:
      */
     static sptr make_connected(const std::string& addr, const std::string& port);
 
+    /*!
+     * Make a connected udp transport, re-using a warm socket when one
+     * already exists for this destination.
+     *
+     * Control-plane bring-up issues thousands of request/reply transactions
+     * and several code paths (discovery, then session init) open their own
+     * short-lived socket to the same endpoint. This factory keeps one
+     * connected socket per (address, port) alive for as long as anyone
+     * holds a reference and hands it back out, skipping repeated address
+     * resolution and socket setup.
+     *
+     * Like the plain connected transport, the returned object expects one
+     * transaction at a time; callers sharing a pooled socket must not
+     * interleave request/reply pairs from multiple threads.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     */
+    static sptr make_connected_pooled(const std::string& addr, const std::string& port);
+
     /*!
      * Make a new broadcasting udp transport:
      * This transport can send udp broadcast datagrams
@@ -83,6 +83,30 @@ public:
     }
 };
 
+/*! Well-known device address keys
+ *
+ * Compile-time constants for argument keys that appear on hot control paths
+ * (discovery, make(), per-connection arg parsing). Prefer these over
+ * repeated string literals in new code; they keep the spelling in one place
+ * and make misspelled keys a compile error instead of a silent miss.
+ */
+namespace dev_addr_keys {
+constexpr const char* ADDR       = "addr";
+constexpr const char* MGMT_ADDR  = "mgmt_addr";
+constexpr const char* RESOURCE   = "resource";
+constexpr const char* NAME       = "name";
+constexpr const char* SERIAL     = "serial";
+constexpr const char* TYPE       = "type";
+constexpr const char* PRODUCT    = "product";
+constexpr const char* RECV_BUFF_SIZE  = "recv_buff_size";
+constexpr const char* SEND_BUFF_SIZE  = "send_buff_size";
+constexpr const char* NUM_RECV_FRAMES = "num_recv_frames";
+constexpr const char* NUM_SEND_FRAMES = "num_send_frames";
+constexpr const char* RECV_FRAME_SIZE = "recv_frame_size";
+constexpr const char* SEND_FRAME_SIZE = "send_frame_size";
+constexpr const char* MASTER_CLOCK_RATE = "master_clock_rate";
+} // namespace dev_addr_keys
+
 //! A typedef for a vector of device addresses
 typedef std::vector<device_addr_t> device_addrs_t;
 
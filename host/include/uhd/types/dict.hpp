@@ -8,8 +8,9 @@
 #pragma once
 
 #include <uhd/config.hpp>
-#include <list>
+#include <boost/container/small_vector.hpp>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace uhd {
@@ -84,6 +85,13 @@ public:
      */
     void set(const Key& key, const Val& val);
 
+    /*!
+     * Set a value in the dict at the key (move overload).
+     * \param key the key to set at
+     * \param val the value to move into the dict
+     */
+    void set(const Key& key, Val&& val);
+
     /*!
      * Get a value for the given key if it exists.
      * If the key is not found throw an error.
@@ -146,7 +154,13 @@ public:
 
 private:
     typedef std::pair<Key, Val> pair_t;
-    std::list<pair_t> _map; // private container
+    // Contiguous flat-map storage. Dicts in UHD are small (device args,
+    // EEPROM maps), where a linear scan over a small_vector beats node-based
+    // containers on both lookups and allocation count; the first few pairs
+    // live inline without any heap allocation. Note that unlike the previous
+    // std::list backing, references returned by operator[] are invalidated
+    // by subsequent insertions and removals.
+    boost::container::small_vector<pair_t, 8> _map; // private container
 };
 
 } // namespace uhd
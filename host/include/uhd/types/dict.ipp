@@ -94,6 +94,11 @@ namespace uhd{
         (*this)[key] = val;
     }
 
+    template <typename Key, typename Val>
+    void dict<Key, Val>::set(const Key &key, Val &&val){
+        (*this)[key] = std::move(val);
+    }
+
     template <typename Key, typename Val>
     const Val &dict<Key, Val>::operator[](const Key &key) const{
         for(const pair_t &p : _map){
@@ -107,7 +112,7 @@ namespace uhd{
         for(pair_t &p : _map){
             if (p.first == key) return p.second;
         }
-        _map.push_back(std::make_pair(key, Val()));
+        _map.emplace_back(key, Val());
         return _map.back().second;
     }
 
@@ -131,10 +136,9 @@ namespace uhd{
 
     template <typename Key, typename Val>
     Val dict<Key, Val>::pop(const Key &key){
-        typename std::list<pair_t>::iterator it;
-        for (it = _map.begin(); it != _map.end(); it++){
+        for (auto it = _map.begin(); it != _map.end(); it++){
             if (it->first == key){
-                Val val = it->second;
+                Val val = std::move(it->second);
                 _map.erase(it);
                 return val;
             }
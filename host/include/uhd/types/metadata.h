@@ -86,7 +86,9 @@ typedef enum {
     //! Multi-channel alignment failed
     UHD_RX_METADATA_ERROR_CODE_ALIGNMENT    = 0xC,
     //! The packet could not be parsed
-    UHD_RX_METADATA_ERROR_CODE_BAD_PACKET   = 0xF
+    UHD_RX_METADATA_ERROR_CODE_BAD_PACKET   = 0xF,
+    //! The link went silent mid-burst beyond the liveness timeout
+    UHD_RX_METADATA_ERROR_CODE_LINK_DOWN    = 0x10
 } uhd_rx_metadata_error_code_t;
 
 
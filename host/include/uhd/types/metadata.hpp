@@ -32,6 +32,8 @@ struct UHD_API rx_metadata_t
     {
         has_time_spec       = false;
         time_spec           = time_spec_t(0.0);
+        has_wire_time       = false;
+        wire_time           = time_spec_t(0.0);
         more_fragments      = false;
         fragment_offset     = 0;
         start_of_burst      = false;
@@ -41,6 +43,7 @@ struct UHD_API rx_metadata_t
         eov_positions_count = 0;
         error_code          = ERROR_CODE_NONE;
         out_of_sequence     = false;
+        dropped_samps       = 0;
     }
 
     //! Has time specification?
@@ -49,6 +52,17 @@ struct UHD_API rx_metadata_t
     //! Time of the first sample.
     time_spec_t time_spec;
 
+    //! Has wire arrival time? Only set when the transport records timestamps.
+    bool has_wire_time;
+
+    /*!
+     * Wire arrival time of the first packet in this buffer, as recorded by
+     * the transport (NIC hardware clock when the interface has timestamping
+     * enabled, otherwise the host clock at packet reception). Unlike
+     * time_spec, this is host time, not radio time.
+     */
+    time_spec_t wire_time;
+
     /*!
      * Fragmentation flag:
      * Similar to IPv4 fragmentation:
@@ -132,13 +146,30 @@ struct UHD_API rx_metadata_t
         //! Multi-channel alignment failed.
         ERROR_CODE_ALIGNMENT = 0xc,
         //! The packet could not be parsed.
-        ERROR_CODE_BAD_PACKET = 0xf
+        ERROR_CODE_BAD_PACKET = 0xf,
+        /*!
+         * The transport went silent mid-burst for longer than the configured
+         * link liveness timeout; the device has likely died or rebooted.
+         * Only reported when the link_timeout_ms stream argument is set.
+         * Unlike a timeout, this indicates the stream will not recover on
+         * its own, so failover logic can react immediately.
+         */
+        ERROR_CODE_LINK_DOWN = 0x10
     } error_code;
 
     //! Out of sequence.  The transport has either dropped a packet or received data out
     //! of order.
     bool out_of_sequence;
 
+    /*!
+     * Number of samples missing immediately before the first sample of this
+     * buffer. Only set together with out_of_sequence, when the streamer is
+     * configured to tolerate sequence errors (see the "tolerate_seq_error"
+     * stream argument) and could derive the size of the gap from the packet
+     * timestamps. Zero when there is no gap or it could not be quantified.
+     */
+    size_t dropped_samps;
+
     /*!
      * Convert a rx_metadata_t into a pretty print string.
      *
@@ -152,6 +183,32 @@ struct UHD_API rx_metadata_t
      * code. \return a printable string representing the error.
      */
     std::string strerror(void) const;
+
+    /*!
+     * Numeric summary of the error state of this metadata.
+     *
+     * Carries the same information that strerror() renders as text, so
+     * telemetry and high-rate logging paths can record receive errors
+     * without any string formatting or heap allocation.
+     */
+    struct error_details_t
+    {
+        //! Error code, same as the error_code field.
+        error_code_t error_code;
+        //! Set when an overflow was caused by a sequence error.
+        bool out_of_sequence;
+        //! Set when the time fields below are valid.
+        bool has_time_spec;
+        //! Whole seconds of the first sample time.
+        int64_t time_full_secs;
+        //! Fractional seconds of the first sample time.
+        double time_frac_secs;
+        //! Samples missing before this buffer, if known (see dropped_samps).
+        size_t dropped_samps;
+    };
+
+    //! Return the error state of this metadata as plain numbers.
+    error_details_t get_error_details(void) const;
 };
 
 /*!
@@ -11,6 +11,8 @@
 #include <uhd/types/time_spec.hpp>
 #include <stdint.h>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace uhd {
 
@@ -50,6 +52,28 @@ public:
      */
     virtual uint32_t peek32(const wb_addr_type addr);
 
+    /*!
+     * Write many registers (32 bits each)
+     *
+     * The default implementation performs one poke32() per entry.
+     * Implementations whose transport can aggregate accesses may override
+     * this to collapse the writes into fewer bus/network transactions.
+     * \param regs the (address, data) pairs to write, in order
+     */
+    virtual void poke32_many(
+        const std::vector<std::pair<wb_addr_type, uint32_t>>& regs);
+
+    /*!
+     * Read many registers (32 bits each)
+     *
+     * The default implementation performs one peek32() per address.
+     * Implementations whose transport can aggregate accesses may override
+     * this to collapse the reads into fewer bus/network transactions.
+     * \param addrs the addresses to read, in order
+     * \return the 32bit data words, one per address
+     */
+    virtual std::vector<uint32_t> peek32_many(const std::vector<wb_addr_type>& addrs);
+
     /*!
      * Write a register (16 bits)
      * \param addr the address
@@ -37,6 +37,8 @@
 #include <uhd/usrp/subdev_spec.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <complex>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -146,6 +148,34 @@ public:
     //! Convenience method to get a TX streamer. See also uhd::device::get_tx_stream().
     virtual tx_streamer::sptr get_tx_stream(const stream_args_t& args) = 0;
 
+    /*!
+     * Post a control task for asynchronous execution.
+     *
+     * The task is queued for a single command thread owned by this device
+     * and this call returns immediately, so a control loop can issue e.g.
+     * gain or frequency updates at a high rate without blocking for the
+     * full property tree and hardware latency of each call. Tasks run
+     * strictly in the order they were posted, exactly as if the posting
+     * thread had made the calls itself back to back.
+     *
+     * The returned future becomes ready when the task has completed and
+     * delivers any exception the task threw; it may be discarded for
+     * fire-and-forget use. Mixing posted tasks with direct synchronous
+     * calls from other threads is subject to the same (lack of) ordering
+     * guarantees as making those calls from two threads directly. The
+     * command thread is started on first use and joined when the device
+     * object is destroyed, after completing all queued tasks.
+     *
+     * Example:
+     * \code{.cpp}
+     * usrp->post_task([usrp, gain]() { usrp->set_rx_gain(gain, 0); });
+     * \endcode
+     *
+     * \param task the callable to run on the command thread
+     * \return a future made ready when the task has completed
+     */
+    virtual std::future<void> post_task(std::function<void()> task) = 0;
+
     /*!
      * Returns identifying information about this USRP's configuration.
      * Returns motherboard ID, name, and serial.
@@ -549,6 +579,20 @@ public:
      */
     virtual std::vector<std::string> get_mboard_sensor_names(size_t mboard = 0) = 0;
 
+    /*!
+     * Get multiple motherboard sensor values in one call.
+     * This returns the same values as calling get_mboard_sensor() for every
+     * entry of \p names, but allows the underlying device to coalesce the
+     * reads into a single control transaction (e.g., one RPC call), which
+     * reduces control-plane traffic when many sensors are polled
+     * periodically (e.g., for telemetry).
+     * \param names the names of the sensors to read
+     * \param mboard the motherboard index 0 to M-1
+     * \return a vector of sensor value objects, in the same order as \p names
+     */
+    virtual std::vector<sensor_value_t> get_mboard_sensors(
+        const std::vector<std::string>& names, size_t mboard = 0) = 0;
+
     /*!
      * Perform write on the user configuration register bus. These only exist if
      * the user has implemented custom setting registers in the device FPGA.
@@ -11,6 +11,7 @@
 #include <uhd/device.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/sensors.hpp>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -82,6 +83,34 @@ public:
      */
     virtual sensor_value_t get_sensor(const std::string& name, size_t board = 0) = 0;
 
+    /*!
+     * Get several USRP Clock sensor values in one batch.
+     *
+     * The device reports all status fields in a single datagram, so reading
+     * the sensors together costs one timeout-guarded UDP exchange instead of
+     * one per field.
+     *
+     * \param names the names of the sensors to read
+     * \param board the board index (0 to M-1)
+     * \return the sensor values, in the same order as \p names
+     */
+    virtual std::vector<sensor_value_t> get_sensors(
+        const std::vector<std::string>& names, size_t board = 0) = 0;
+
+    /*!
+     * Start an asynchronous USRP Clock sensor query.
+     *
+     * The query runs on a background thread, so a monitoring loop can poll
+     * several boards concurrently without serializing their round-trip (and
+     * possibly timeout) latencies.
+     *
+     * \param name the name of the sensor
+     * \param board the board index (0 to M-1)
+     * \return a future that yields the sensor value (or the query's error)
+     */
+    virtual std::future<sensor_value_t> get_sensor_async(
+        const std::string& name, size_t board = 0) = 0;
+
     /*!
      * Get a list of possible USRP Clock sensor names.
      * \param board the board index (0 to M-1)
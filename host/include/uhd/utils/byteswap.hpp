@@ -9,6 +9,7 @@
 
 #include <uhd/config.hpp>
 #include <uhd/types/endianness.hpp>
+#include <stddef.h>
 #include <stdint.h>
 
 /*! \file byteswap.hpp
@@ -49,6 +50,30 @@ T wtohx(T);
 template <typename T>
 T htowx(T);
 
+/*!
+ * Byteswap every element of a buffer of integers in place.
+ *
+ * The loop is written so the compiler can vectorize it for the target
+ * architecture; use this instead of calling byteswap() element by element
+ * when swapping whole packets or sample buffers.
+ *
+ * \param buff the buffer of 16, 32, or 64 bit integers
+ * \param num_elems the number of integers in the buffer
+ */
+template <typename T>
+void byteswap_buff(T* buff, size_t num_elems);
+
+/*!
+ * Byteswap every element of an input buffer of integers into an output
+ * buffer. The buffers must not partially overlap.
+ *
+ * \param output the destination buffer of 16, 32, or 64 bit integers
+ * \param input the source buffer of the same length
+ * \param num_elems the number of integers in each buffer
+ */
+template <typename T>
+void byteswap_copy(T* output, const T* input, size_t num_elems);
+
 } // namespace uhd
 
 #include <uhd/utils/byteswap.ipp>
@@ -144,4 +144,25 @@ template <typename T> UHD_INLINE T htowx(T num)
 #endif
 }
 
+/***********************************************************************
+ * Define the templated buffer swap utilities
+ **********************************************************************/
+template <typename T> UHD_INLINE void byteswap_buff(T* buff, size_t num_elems)
+{
+    // Plain element loop on purpose: the per-element swap compiles down to
+    // a single bswap (or shift/or pair for 16 bit), which the vectorizer
+    // turns into SIMD shuffles across the buffer
+    for (size_t i = 0; i < num_elems; i++) {
+        buff[i] = uhd::byteswap(buff[i]);
+    }
+}
+
+template <typename T>
+UHD_INLINE void byteswap_copy(T* output, const T* input, size_t num_elems)
+{
+    for (size_t i = 0; i < num_elems; i++) {
+        output[i] = uhd::byteswap(input[i]);
+    }
+}
+
 } /* namespace uhd */
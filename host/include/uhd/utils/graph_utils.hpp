@@ -35,6 +35,10 @@ static const std::vector<block_port_def> TERMINATOR_BLOCKS{
  *  This function does not make the connections between blocks, it simply traverses the
  *  static connections.
  *
+ *  Since the static connections are fixed by the loaded FPGA image, the
+ *  computed chain is cached for the lifetime of the graph object, and
+ *  repeated calls with the same arguments are cheap.
+ *
  *  \param graph The rfnoc_graph that is being examined
  *  \param start_block The block we begin to build the chain from
  *  \param port The block port of `src_port` that the path will begin at
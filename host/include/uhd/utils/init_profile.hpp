@@ -0,0 +1,59 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace utils {
+
+/*! A single timed initialization phase
+ *
+ * Phases nest: a phase started while another phase is active on the same
+ * thread is recorded with a greater depth. Records are listed in the order
+ * the phases were started.
+ */
+struct init_phase_record_t
+{
+    //! Name of the phase (e.g. "discovery", "block_enumeration")
+    std::string name;
+    //! Nesting depth; 0 is a top-level phase such as device::make()
+    size_t depth = 0;
+    //! Phase start time in seconds, relative to the first recorded phase
+    double start = 0.0;
+    //! Phase duration in seconds
+    double duration = 0.0;
+};
+
+/*! Return all initialization phases recorded so far in this process
+ *
+ * UHD times its expensive startup phases (device discovery, claiming,
+ * block enumeration, transport setup, ...) unconditionally, so slow
+ * session creation can be diagnosed after the fact. Call this after
+ * creating a device or graph session to see where the time went.
+ */
+UHD_API std::vector<init_phase_record_t> get_init_profile();
+
+/*! Return the recorded initialization phases as a printable report
+ *
+ * One line per phase, indented by nesting depth, with start offset and
+ * duration in milliseconds. The same report is logged automatically at the
+ * end of each top-level phase when the UHD_INIT_PROFILE environment
+ * variable is set to a non-empty value.
+ */
+UHD_API std::string format_init_profile();
+
+/*! Discard all recorded initialization phases
+ *
+ * Useful to isolate the phases of a particular session when a process
+ * creates several.
+ */
+UHD_API void clear_init_profile();
+
+}} // namespace uhd::utils
@@ -170,6 +170,14 @@ UHD_API void set_file_level(uhd::log::severity_level level);
  * \throws uhd::key_error if \p logger was not defined
  */
 UHD_API void set_logger_level(const std::string& logger, uhd::log::severity_level level);
+
+/*! Get the global log level
+ *
+ * This is a single atomic read, and is cheap enough to call from hot paths.
+ * The UHD_LOG_* macros use it to guarantee that a runtime-disabled log level
+ * costs no more than this check.
+ */
+UHD_API uhd::log::severity_level get_log_level(void);
 }} // namespace uhd::log
 
 //! \cond
@@ -178,45 +186,57 @@ UHD_API void set_logger_level(const std::string& logger, uhd::log::severity_leve
     uhd::_log::log(level, __FILE__, __LINE__, component, boost::this_thread::get_id())
 //! \endcond
 
+//! \cond
+//! Internal guard so a runtime-disabled level only costs the level check:
+// the log object (and the string arguments it takes) are only constructed
+// when the level is enabled.
+#define _UHD_LOG_GUARDED(component, level, message)          \
+    do {                                                     \
+        if (level >= uhd::log::get_log_level()) {            \
+            _UHD_LOG_INTERNAL(component, level) << message;  \
+        }                                                    \
+    } while (0);
+//! \endcond
+
 // macro-style logging (compile-time determined)
 #if UHD_LOG_MIN_LEVEL < 1
 #    define UHD_LOG_TRACE(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::trace) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::trace, message)
 #else
 #    define UHD_LOG_TRACE(component, message)
 #endif
 
 #if UHD_LOG_MIN_LEVEL < 2
 #    define UHD_LOG_DEBUG(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::debug) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::debug, message)
 #else
 #    define UHD_LOG_DEBUG(component, message)
 #endif
 
 #if UHD_LOG_MIN_LEVEL < 3
 #    define UHD_LOG_INFO(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::info) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::info, message)
 #else
 #    define UHD_LOG_INFO(component, message)
 #endif
 
 #if UHD_LOG_MIN_LEVEL < 4
 #    define UHD_LOG_WARNING(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::warning) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::warning, message)
 #else
 #    define UHD_LOG_WARNING(component, message)
 #endif
 
 #if UHD_LOG_MIN_LEVEL < 5
 #    define UHD_LOG_ERROR(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::error) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::error, message)
 #else
 #    define UHD_LOG_ERROR(component, message)
 #endif
 
 #if UHD_LOG_MIN_LEVEL < 6
 #    define UHD_LOG_FATAL(component, message) \
-        _UHD_LOG_INTERNAL(component, uhd::log::fatal) << message;
+        _UHD_LOG_GUARDED(component, uhd::log::fatal, message)
 #else
 #    define UHD_LOG_FATAL(component, message)
 #endif
@@ -0,0 +1,276 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/utils/log.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace uhd;
+
+namespace {
+
+// Number of realignment passes recv() will attempt before returning an
+// alignment error. Matches the threshold used by the transport-level
+// alignment in get_aligned_buffs.hpp, of which this is the
+// streamer-granularity counterpart.
+constexpr size_t ALIGNMENT_FAILURE_THRESHOLD = 1000;
+
+/*! RX streamer implementation that aggregates several member RX streamers
+ *
+ * The members keep full ownership of their transports, conversion and
+ * fragmentation state; this class only slices the caller's buffer vector
+ * into per-member views and time-aligns the members against each other.
+ * Alignment follows the same drop-and-refetch scheme as the transport-level
+ * get_aligned_buffs engine, except that the unit of work is one one-packet
+ * recv() on a member instead of one frame buffer from a transport: packets
+ * behind the largest timestamp are overwritten in place by refetching into
+ * the same buffer position. Packets without a timestamp are never dropped.
+ */
+class aggregate_rx_streamer : public rx_streamer
+{
+public:
+    aggregate_rx_streamer(
+        const std::vector<rx_streamer::sptr>& streamers, const std::string& cpu_format)
+        : _streamers(streamers), _bytes_per_item(convert::get_bytes_per_item(cpu_format))
+    {
+        if (_streamers.empty()) {
+            throw uhd::value_error(
+                "Cannot create an aggregate RX streamer without member streamers");
+        }
+
+        _num_chans     = 0;
+        _max_num_samps = std::numeric_limits<size_t>::max();
+        for (const auto& streamer : _streamers) {
+            UHD_ASSERT_THROW(bool(streamer));
+            _chan_offsets.push_back(_num_chans);
+            _num_chans += streamer->get_num_channels();
+            _max_num_samps = std::min(_max_num_samps, streamer->get_max_num_samps());
+        }
+
+        // Preallocate all per-call state so recv() stays allocation-free
+        const size_t num_members = _streamers.size();
+        _member_buffs.resize(num_members);
+        for (size_t i = 0; i < num_members; i++) {
+            _member_buffs[i].resize(_streamers[i]->get_num_channels());
+        }
+        _member_mds.resize(num_members);
+        _member_samps.resize(num_members);
+        _member_eob.resize(num_members);
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return _max_num_samps;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        rx_metadata_t& metadata,
+        const double timeout,
+        const bool one_packet) override
+    {
+        metadata.reset();
+        const size_t num_members = _streamers.size();
+
+        // Fetch the leading packet of every member into the start of its
+        // slice of the caller's buffers
+        for (size_t i = 0; i < num_members; i++) {
+            _slice_buffs(buffs, i, 0);
+            if (not _fetch_one(i, nsamps_per_buff, metadata, timeout)) {
+                return 0;
+            }
+        }
+
+        // Drop-and-refetch until all timed members agree on the leading
+        // timestamp. Refetching overwrites the stale packet in place, so no
+        // scratch memory is needed. A member whose time goes backwards (the
+        // user changed the device time while streaming) keeps chasing the
+        // stale maximum and runs into the threshold, which surfaces as an
+        // alignment error rather than a hang.
+        size_t iterations = 0;
+        while (true) {
+            time_spec_t max_time(0.0);
+            bool have_time = false;
+            bool aligned   = true;
+            for (size_t i = 0; i < num_members; i++) {
+                if (not _member_mds[i].has_time_spec) {
+                    continue;
+                }
+                if (have_time and _member_mds[i].time_spec != max_time) {
+                    aligned = false;
+                }
+                max_time  = std::max(max_time, _member_mds[i].time_spec);
+                have_time = true;
+            }
+            if (not have_time or aligned) {
+                break;
+            }
+
+            if (iterations++ > ALIGNMENT_FAILURE_THRESHOLD) {
+                UHD_LOGGER_ERROR("STREAMER")
+                    << "The aggregate rx streamer failed to time-align its members.";
+                metadata.reset();
+                metadata.error_code = rx_metadata_t::ERROR_CODE_ALIGNMENT;
+                return 0;
+            }
+
+            for (size_t i = 0; i < num_members; i++) {
+                if (not _member_mds[i].has_time_spec
+                    or _member_mds[i].time_spec == max_time) {
+                    continue;
+                }
+                _slice_buffs(buffs, i, 0);
+                if (not _fetch_one(i, nsamps_per_buff, metadata, timeout)) {
+                    return 0;
+                }
+            }
+        }
+
+        // The leading packets agree; report the first member's metadata
+        // (time spec and burst flags of the aligned position)
+        metadata = _member_mds[0];
+        for (size_t i = 0; i < num_members; i++) {
+            _member_eob[i] = _member_mds[i].end_of_burst;
+        }
+
+        // Top up all members to a common sample count: the full caller
+        // buffer, or, for one-packet calls, the largest member packet (so
+        // members with a smaller spp do not fall behind the others)
+        const size_t target_samps =
+            one_packet ? *std::max_element(_member_samps.begin(), _member_samps.end())
+                       : nsamps_per_buff;
+        for (size_t i = 0; i < num_members; i++) {
+            while (_member_samps[i] < target_samps) {
+                _slice_buffs(buffs, i, _member_samps[i]);
+                rx_metadata_t md;
+                const size_t num_samps = _streamers[i]->recv(_member_buffs[i],
+                    target_samps - _member_samps[i],
+                    md,
+                    timeout,
+                    one_packet);
+                _member_samps[i] += num_samps;
+                _member_eob[i] = md.end_of_burst;
+                // A short return means timeout, error or end of burst; the
+                // member caches errors for its next call, so stop here and
+                // let the final count reflect what was actually aligned
+                if (num_samps == 0 or md.error_code != rx_metadata_t::ERROR_CODE_NONE
+                    or md.end_of_burst or not one_packet) {
+                    break;
+                }
+            }
+        }
+
+        // The burst is over when it is over on all members
+        metadata.end_of_burst =
+            std::all_of(_member_eob.begin(), _member_eob.end(), [](bool eob) {
+                return eob;
+            });
+
+        return *std::min_element(_member_samps.begin(), _member_samps.end());
+    }
+
+    stream_stats_t get_stream_stats() const override
+    {
+        stream_stats_t stats;
+        for (const auto& streamer : _streamers) {
+            const stream_stats_t member_stats = streamer->get_stream_stats();
+            stats.num_packets += member_stats.num_packets;
+            stats.num_bytes += member_stats.num_bytes;
+            stats.num_seq_errors += member_stats.num_seq_errors;
+            stats.num_timeouts += member_stats.num_timeouts;
+            stats.num_calls += member_stats.num_calls;
+            stats.stall_time_ns += member_stats.stall_time_ns;
+            for (size_t i = 0; i < stream_stats_t::NUM_LATENCY_BUCKETS; i++) {
+                stats.call_latency_hist[i] += member_stats.call_latency_hist[i];
+            }
+        }
+        return stats;
+    }
+
+    void issue_stream_cmd(const stream_cmd_t& stream_cmd) override
+    {
+        for (const auto& streamer : _streamers) {
+            streamer->issue_stream_cmd(stream_cmd);
+        }
+    }
+
+private:
+    //! Point member i's buffer view into the caller's buffers, offset by
+    //! samps_consumed samples
+    void _slice_buffs(const buffs_type& buffs, const size_t i, const size_t samps_consumed)
+    {
+        for (size_t chan = 0; chan < _member_buffs[i].size(); chan++) {
+            _member_buffs[i][chan] =
+                static_cast<char*>(buffs[_chan_offsets[i] + chan])
+                + samps_consumed * _bytes_per_item;
+        }
+    }
+
+    /*! Receive one packet on member i into its current buffer view
+     *
+     * On success, the packet's sample count and metadata are stored in the
+     * member's slots and true is returned. On timeout or error, the caller's
+     * metadata is filled in and false is returned, matching the
+     * error-interrupts-the-call behavior of the member streamers.
+     */
+    bool _fetch_one(const size_t i,
+        const size_t nsamps_per_buff,
+        rx_metadata_t& metadata,
+        const double timeout)
+    {
+        _member_samps[i] = _streamers[i]->recv(
+            _member_buffs[i], nsamps_per_buff, _member_mds[i], timeout, true);
+        if (_member_mds[i].error_code != rx_metadata_t::ERROR_CODE_NONE) {
+            metadata = _member_mds[i];
+            return false;
+        }
+        if (_member_samps[i] == 0) {
+            metadata.reset();
+            metadata.error_code = rx_metadata_t::ERROR_CODE_TIMEOUT;
+            return false;
+        }
+        return true;
+    }
+
+    // Member streamers, in channel order
+    std::vector<rx_streamer::sptr> _streamers;
+
+    // Bytes per sample of the common CPU format
+    const size_t _bytes_per_item;
+
+    // Index of each member's first channel in the aggregate channel list
+    std::vector<size_t> _chan_offsets;
+
+    // Total channels across all members
+    size_t _num_chans;
+
+    // Smallest max_num_samps across all members
+    size_t _max_num_samps;
+
+    // Preallocated per-call state: buffer views, leading-packet metadata,
+    // samples received and end-of-burst flag for each member
+    std::vector<std::vector<void*>> _member_buffs;
+    std::vector<rx_metadata_t> _member_mds;
+    std::vector<size_t> _member_samps;
+    std::vector<bool> _member_eob;
+};
+
+} // namespace
+
+rx_streamer::sptr uhd::make_aggregate_rx_streamer(
+    const std::vector<rx_streamer::sptr>& streamers, const std::string& cpu_format)
+{
+    return std::make_shared<aggregate_rx_streamer>(streamers, cpu_format);
+}
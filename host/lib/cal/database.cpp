@@ -12,6 +12,14 @@
 #include <boost/filesystem.hpp>
 #include <ctime>
 #include <fstream>
+#include <utility>
+
+#ifndef UHD_PLATFORM_WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 CMRC_DECLARE(rc);
 
@@ -55,6 +63,109 @@ std::vector<uint8_t> get_cal_data_rc(const std::string& key)
     }
 }
 
+//! Blob backed by a heap buffer; fallback when we can't reference data in place
+class vector_cal_blob : public cal_data_blob
+{
+public:
+    vector_cal_blob(std::vector<uint8_t>&& data) : _data(std::move(data)) {}
+
+    const uint8_t* data() const override
+    {
+        return _data.data();
+    }
+
+    size_t size() const override
+    {
+        return _data.size();
+    }
+
+private:
+    const std::vector<uint8_t> _data;
+};
+
+//! Blob referencing cal data compiled into UHD by the resource compiler
+//
+// The RC data lives in static storage within the UHD binary, so we only need
+// to keep the cmrc file handle (a pair of pointers) around.
+class rc_cal_blob : public cal_data_blob
+{
+public:
+    rc_cal_blob(cmrc::file file) : _file(std::move(file)) {}
+
+    const uint8_t* data() const override
+    {
+        return reinterpret_cast<const uint8_t*>(_file.begin());
+    }
+
+    size_t size() const override
+    {
+        return _file.size();
+    }
+
+private:
+    cmrc::file _file;
+};
+
+//! Return a blob for a given cal resource (zero-copy, data is in the binary)
+cal_data_blob::sptr get_cal_blob_rc(const std::string& key)
+{
+    try {
+        auto fs = rc::get_filesystem();
+        return std::make_shared<rc_cal_blob>(fs.open(get_cal_path_rc(key)));
+    } catch (const std::system_error&) {
+        throw uhd::key_error(std::string("Unable to open resource with key: ") + key);
+    }
+}
+
+#ifndef UHD_PLATFORM_WIN32
+//! Blob backed by a memory-mapped cal file
+//
+// The mapping is read-only and private; pages are faulted in on demand as the
+// consumer reads through the data and can be reclaimed by the OS under memory
+// pressure, since they are clean file-backed pages.
+class mmap_cal_blob : public cal_data_blob
+{
+public:
+    mmap_cal_blob(void* mem, size_t size) : _mem(mem), _size(size) {}
+
+    ~mmap_cal_blob() override
+    {
+        munmap(_mem, _size);
+    }
+
+    const uint8_t* data() const override
+    {
+        return static_cast<const uint8_t*>(_mem);
+    }
+
+    size_t size() const override
+    {
+        return _size;
+    }
+
+private:
+    void* const _mem;
+    const size_t _size;
+};
+
+//! Try to memory-map a cal file; returns nullptr if the mapping fails
+cal_data_blob::sptr try_mmap_cal_file(const fs::path& path, const size_t filesize)
+{
+    const int fd = ::open(path.string().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    void* mem = ::mmap(nullptr, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file; the descriptor is no
+    // longer needed either way.
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::make_shared<mmap_cal_blob>(mem, filesize);
+}
+#endif /* !UHD_PLATFORM_WIN32 */
+
 void check_or_create_dir(fs::path dir)
 {
     if (fs::exists(dir)) {
@@ -137,6 +248,37 @@ std::vector<uint8_t> get_cal_data_fs(const std::string& key, const std::string&
     return result;
 }
 
+//! Return a blob for a given filesystem resource, memory-mapped if possible
+cal_data_blob::sptr get_cal_blob_fs(const std::string& key, const std::string& serial)
+{
+    if (!has_cal_data_fs(key, serial)) {
+        throw uhd::key_error(
+            std::string("Cannot find cal file for key=") + key + ", serial=" + serial);
+    }
+#ifndef UHD_PLATFORM_WIN32
+    const auto cal_file_path =
+        fs::path(uhd::get_cal_data_path()) / get_cal_path_fs(key, serial);
+    const size_t filesize = fs::file_size(cal_file_path);
+    if (filesize > CALDATA_MAX_SIZE) {
+        throw uhd::key_error(
+            std::string("The following cal data file exceeds maximum size limitations: ")
+            + cal_file_path.string());
+    }
+    if (filesize > 0) {
+        auto blob = try_mmap_cal_file(cal_file_path, filesize);
+        if (blob) {
+            UHD_LOG_TRACE(
+                LOG_ID, "Mapped " << filesize << " bytes from " << cal_file_path);
+            return blob;
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Could not memory-map cal file, falling back to reading: "
+                << cal_file_path.string());
+    }
+#endif
+    return std::make_shared<vector_cal_blob>(get_cal_data_fs(key, serial));
+}
+
 } // namespace
 
 std::vector<uint8_t> database::read_cal_data(
@@ -160,6 +302,27 @@ std::vector<uint8_t> database::read_cal_data(
     throw uhd::key_error(err_msg);
 }
 
+cal_data_blob::sptr database::read_cal_data_blob(
+    const std::string& key, const std::string& serial, const source source_type)
+{
+    if (source_type == source::FILESYSTEM || source_type == source::ANY) {
+        if (has_cal_data_fs(key, serial)) {
+            return get_cal_blob_fs(key, serial);
+        }
+    }
+
+    if (source_type == source::RC || source_type == source::ANY) {
+        if (has_cal_data_rc(key)) {
+            return get_cal_blob_rc(key);
+        }
+    }
+
+    const std::string err_msg =
+        std::string("Calibration Data not found for: key=") + key + ", serial=" + serial;
+    UHD_LOG_ERROR(LOG_ID, err_msg);
+    throw uhd::key_error(err_msg);
+}
+
 bool database::has_cal_data(
     const std::string& key, const std::string& serial, const source source_type)
 {
@@ -60,6 +60,7 @@ public:
 
     std::complex<double> get_cal_coeff(const double freq) const
     {
+        _ensure_coeffs();
         UHD_ASSERT_THROW(!_coeffs.empty());
         // Find the first coefficient in the map that maps to a larger frequency
         // than freq (or equal)
@@ -97,12 +98,14 @@ public:
         const double suppression_abs   = 0,
         const double suppression_delta = 0)
     {
+        _ensure_coeffs();
         _coeffs[freq] = coeff;
         _supp[freq]   = {suppression_abs, suppression_delta};
     }
 
     void clear()
     {
+        _deferred_data.reset();
         _coeffs.clear();
         _supp.clear();
     }
@@ -112,6 +115,7 @@ public:
      *************************************************************************/
     std::vector<uint8_t> serialize()
     {
+        _ensure_coeffs();
         // This is a magic value to estimate the amount of space the builder will
         // have to reserve on top of the coeff data.
         // Worst case is we get this too low, and the builder will have to do a
@@ -153,17 +157,41 @@ public:
     // necessary to call clear() ahead of time.
     void deserialize(const std::vector<uint8_t>& data)
     {
-        auto verifier = flatbuffers::Verifier(data.data(), data.size());
+        _load_coeffs(_parse_header(data.data(), data.size()));
+    }
+
+    // Same amend semantics as the vector-based deserialize(), but the
+    // coefficients are not unpacked until a lookup needs them. Only the
+    // metadata is read eagerly; the blob (e.g., a memory-mapped cal file) is
+    // kept alive until then.
+    void deserialize(const cal_data_blob::sptr& data)
+    {
+        _parse_header(data->data(), data->size());
+        _deferred_data = data;
+    }
+
+
+private:
+    //! Verify the FlatBuffers data and read everything except the coefficients
+    const IQCalCoeffs* _parse_header(const uint8_t* data, const size_t size)
+    {
+        auto verifier = flatbuffers::Verifier(data, size);
         if (!VerifyIQCalCoeffsBuffer(verifier)) {
             throw uhd::runtime_error("iq_cal: Invalid data provided!");
         }
-        auto cal_table = GetIQCalCoeffs(static_cast<const void*>(data.data()));
+        auto cal_table = GetIQCalCoeffs(static_cast<const void*>(data));
         // TODO we can handle this more nicely
         UHD_ASSERT_THROW(cal_table->metadata()->version_major() == VERSION_MAJOR);
-        _name          = std::string(cal_table->metadata()->name()->c_str());
-        _serial        = std::string(cal_table->metadata()->serial()->c_str());
-        _timestamp     = cal_table->metadata()->timestamp();
-        auto coeffs    = cal_table->coeffs();
+        _name      = std::string(cal_table->metadata()->name()->c_str());
+        _serial    = std::string(cal_table->metadata()->serial()->c_str());
+        _timestamp = cal_table->metadata()->timestamp();
+        return cal_table;
+    }
+
+    //! Unpack the coefficients of an already verified buffer into _coeffs
+    void _load_coeffs(const IQCalCoeffs* cal_table)
+    {
+        auto coeffs = cal_table->coeffs();
         for (auto it = coeffs->begin(); it != coeffs->end(); ++it) {
             _coeffs[it->freq()] = {it->coeff_real(), it->coeff_imag()};
             // Suppression levels are really not necessary for runtime.
@@ -173,8 +201,20 @@ public:
         }
     }
 
-
-private:
+    //! Unpack lazily deserialized cal data, if any is pending
+    //
+    // The blob was already verified in deserialize(), so this cannot throw on
+    // malformed data. Logically const: it only changes the representation of
+    // the data, not the data itself.
+    void _ensure_coeffs() const
+    {
+        if (!_deferred_data) {
+            return;
+        }
+        auto* self      = const_cast<iq_cal_impl*>(this);
+        const auto blob = std::move(self->_deferred_data);
+        self->_load_coeffs(GetIQCalCoeffs(static_cast<const void*>(blob->data())));
+    }
     std::string _name;
     std::string _serial;
     uint64_t _timestamp;
@@ -182,6 +222,8 @@ private:
     coeffs_type _coeffs;
     // Abs suppression, delta suppression
     std::map<double, std::pair<double, double>> _supp;
+    //! Verified-but-unparsed cal data; see deserialize(cal_data_blob::sptr)
+    cal_data_blob::sptr _deferred_data;
 
     interp_mode _interp;
 };
@@ -86,6 +86,7 @@ public:
                             + std::to_string(min_power) + " dBm, "
                             + std::to_string(max_power) + " dBm)"));
         }
+        _ensure_tables();
         const int temp    = bool(temperature) ? temperature.get() : _default_temp;
         _data[temp][static_cast<uint64_t>(freq)] = {
             gain_power_map, reverse_map(gain_power_map), min_power, max_power};
@@ -98,6 +99,7 @@ public:
         const double freq,
         const boost::optional<int> temperature = boost::none) const
     {
+        _ensure_tables();
         UHD_ASSERT_THROW(!_data.empty());
         const uint64_t freqi = static_cast<uint64_t>(freq);
         const auto& table = _get_table(temperature);
@@ -136,6 +138,7 @@ public:
 
     void clear()
     {
+        _deferred_data.reset();
         _data.clear();
     }
 
@@ -162,6 +165,7 @@ public:
     uhd::meta_range_t get_power_limits(
         const double freq, const boost::optional<int> temperature = boost::none) const
     {
+        _ensure_tables();
         const auto table = at_nearest(_get_table(temperature), uint64_t(freq));
         return uhd::meta_range_t(table.min_power, table.max_power);
     }
@@ -170,6 +174,7 @@ public:
         const double freq,
         const boost::optional<int> temperature = boost::none) const
     {
+        _ensure_tables();
         UHD_ASSERT_THROW(!_data.empty());
         const uint64_t freqi = static_cast<uint64_t>(freq);
         const auto& table = _get_table(temperature);
@@ -213,6 +218,7 @@ public:
      *************************************************************************/
     std::vector<uint8_t> serialize()
     {
+        _ensure_tables();
         const size_t initial_size_bytes = 1024 * 20; // 20 kiB as an initial guess
         flatbuffers::FlatBufferBuilder builder(initial_size_bytes);
 
@@ -258,11 +264,32 @@ public:
     // necessary to call clear() ahead of time.
     void deserialize(const std::vector<uint8_t>& data)
     {
-        auto verifier = flatbuffers::Verifier(data.data(), data.size());
+        _load_tables(_parse_header(data.data(), data.size()));
+    }
+
+    // Same amend semantics as the vector-based deserialize(), but the power
+    // tables are not unpacked until a lookup needs them. Only the metadata is
+    // read eagerly; the blob (e.g., a memory-mapped cal file) is kept alive
+    // until then.
+    void deserialize(const cal_data_blob::sptr& data)
+    {
+        _parse_header(data->data(), data->size());
+        _deferred_data = data;
+    }
+
+
+private:
+    //! Verify the FlatBuffers data and read everything except the power tables
+    //
+    // Returns the verified table pointer so the caller can decide when to
+    // unpack the bulky part.
+    const PowerCal* _parse_header(const uint8_t* data, const size_t size)
+    {
+        auto verifier = flatbuffers::Verifier(data, size);
         if (!VerifyPowerCalBuffer(verifier)) {
             throw uhd::runtime_error("pwr_cal: Invalid data provided!");
         }
-        auto cal_table = GetPowerCal(static_cast<const void*>(data.data()));
+        auto cal_table = GetPowerCal(static_cast<const void*>(data));
         if (cal_table->metadata()->version_major() != VERSION_MAJOR) {
             throw uhd::runtime_error("pwr_cal: Compat number mismatch!");
         }
@@ -279,7 +306,12 @@ public:
         if (cal_table->ref_gain() >= 0.0) {
             _ref_gain = cal_table->ref_gain();
         }
+        return cal_table;
+    }
 
+    //! Unpack the power tables of an already verified buffer into _data
+    void _load_tables(const PowerCal* cal_table)
+    {
         auto temp_freq_map = cal_table->temp_freq_map();
         for (auto it = temp_freq_map->begin(); it != temp_freq_map->end(); ++it) {
             const int temperature = it->temperature();
@@ -300,8 +332,24 @@ public:
         }
     }
 
+    //! Unpack lazily deserialized cal data, if any is pending
+    //
+    // Every accessor that reads or amends _data funnels through this. The
+    // blob was already verified in deserialize(), so this cannot throw on
+    // malformed data. Logically const: it only changes the representation of
+    // the data, not the data itself.
+    void _ensure_tables() const
+    {
+        if (!_deferred_data) {
+            return;
+        }
+        auto* self = const_cast<pwr_cal_impl*>(this);
+        // Move the blob out first: _load_tables() amends via add_power_table(),
+        // which comes back through here.
+        const auto blob = std::move(self->_deferred_data);
+        self->_load_tables(GetPowerCal(static_cast<const void*>(blob->data())));
+    }
 
-private:
     // We map the gain to power, and power to gain, in different data structures.
     // This is suboptimal w.r.t. memory usage (it duplicates the keys/values),
     // but helps us with the algorithms above.
@@ -329,6 +377,8 @@ private:
 
     //! The actual gain table
     std::map<int /* temp */, freq_table_map> _data;
+    //! Verified-but-unparsed cal data; see deserialize(cal_data_blob::sptr)
+    cal_data_blob::sptr _deferred_data;
     double _ref_gain  = 0.0;
     int _default_temp = NORMAL_TEMPERATURE;
 };
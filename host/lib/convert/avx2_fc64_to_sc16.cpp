@@ -0,0 +1,112 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+DECLARE_CONVERTER(fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration; unaligned loads carry no penalty on
+    // AVX2-capable CPUs, so there is no alignment dispatch like in the SSE2
+    // kernels
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m256d tmplo =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 0));
+        __m256d tmphi =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 2));
+
+        // convert and scale
+        __m128i tmpilo = _mm256_cvtpd_epi32(_mm256_mul_pd(tmplo, scalar));
+        __m128i tmpihi = _mm256_cvtpd_epi32(_mm256_mul_pd(tmphi, scalar));
+
+        // pack + swap 16-bit pairs
+        __m128i tmpi = _mm_packs_epi32(tmpilo, tmpihi);
+        tmpi         = _mm_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi         = _mm_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        // store to output
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m256d tmplo =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 0));
+        __m256d tmphi =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 2));
+
+        // convert and scale
+        __m128i tmpilo = _mm256_cvtpd_epi32(_mm256_mul_pd(tmplo, scalar));
+        __m128i tmpihi = _mm256_cvtpd_epi32(_mm256_mul_pd(tmphi, scalar));
+
+        // pack + byteswap 16-bit words
+        __m128i tmpi = _mm_packs_epi32(tmpilo, tmpihi);
+        tmpi         = _mm_or_si128(_mm_srli_epi16(tmpi, 8), _mm_slli_epi16(tmpi, 8));
+
+        // store to output
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m256d tmplo =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 0));
+        __m256d tmphi =
+            _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 2));
+
+        // convert and scale
+        __m128i tmpilo = _mm256_cvtpd_epi32(_mm256_mul_pd(tmplo, scalar));
+        __m128i tmpihi = _mm256_cvtpd_epi32(_mm256_mul_pd(tmphi, scalar));
+
+        // pack, the samples are already in host order
+        __m128i tmpi = _mm_packs_epi32(tmpilo, tmpihi);
+
+        // store to output
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,127 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor) / (1 << 16));
+    const __m256i zeroi = _mm256_setzero_si256();
+
+    size_t i = 0;
+
+    // convert 8 samples per iteration; unaligned accesses carry no penalty on
+    // AVX2-capable CPUs, so there is no alignment dispatch like in the SSE2
+    // kernels
+    for (; i + 7 < nsamps; i += 8) {
+        // load from input
+        __m256i tmpi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        // swap 16-bit pairs, then pre-swap the 64-bit quads so the per-lane
+        // unpack below yields samples in order
+        tmpi = _mm256_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm256_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));
+
+        // unpack with the value in the upper 16 bits
+        __m256i tmpilo = _mm256_unpacklo_epi16(zeroi, tmpi);
+        __m256i tmpihi = _mm256_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256 tmplo = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpilo), scalar);
+        __m256 tmphi = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor) / (1 << 16));
+    const __m256i zeroi = _mm256_setzero_si256();
+
+    size_t i = 0;
+
+    // convert 8 samples per iteration
+    for (; i + 7 < nsamps; i += 8) {
+        // load from input
+        __m256i tmpi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        // byteswap 16-bit words, then pre-swap the 64-bit quads so the
+        // per-lane unpack below yields samples in order
+        tmpi = _mm256_or_si256(_mm256_srli_epi16(tmpi, 8), _mm256_slli_epi16(tmpi, 8));
+        tmpi = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));
+
+        // unpack with the value in the upper 16 bits
+        __m256i tmpilo = _mm256_unpacklo_epi16(zeroi, tmpi);
+        __m256i tmpihi = _mm256_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256 tmplo = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpilo), scalar);
+        __m256 tmphi = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor) / (1 << 16));
+    const __m256i zeroi = _mm256_setzero_si256();
+
+    size_t i = 0;
+
+    // convert 8 samples per iteration
+    for (; i + 7 < nsamps; i += 8) {
+        // load from input
+        __m256i tmpi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        // pre-swap the 64-bit quads so the per-lane unpack below yields
+        // samples in order
+        tmpi = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));
+
+        // unpack with the value in the upper 16 bits
+        __m256i tmpilo = _mm256_unpacklo_epi16(zeroi, tmpi);
+        __m256i tmpihi = _mm256_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256 tmplo = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpilo), scalar);
+        __m256 tmphi = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4), tmphi);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
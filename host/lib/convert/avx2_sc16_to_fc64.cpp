@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration; unaligned accesses carry no penalty on
+    // AVX2-capable CPUs, so there is no alignment dispatch like in the SSE2
+    // kernels
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // swap 16-bit pairs
+        tmpi = _mm_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        // sign extend to 32 bits
+        __m256i tmpi32 = _mm256_cvtepi16_epi32(tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(tmpi32)), scalar);
+        __m256d tmphi = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(tmpi32, 1)), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc64, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // byteswap 16-bit words
+        tmpi = _mm_or_si128(_mm_srli_epi16(tmpi, 8), _mm_slli_epi16(tmpi, 8));
+
+        // sign extend to 32 bits
+        __m256i tmpi32 = _mm256_cvtepi16_epi32(tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(tmpi32)), scalar);
+        __m256d tmphi = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(tmpi32, 1)), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc64, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc64_t* output      = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input, the samples are already in host order
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // sign extend to 32 bits
+        __m256i tmpi32 = _mm256_cvtepi16_epi32(tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(tmpi32)), scalar);
+        __m256d tmphi = _mm256_mul_pd(
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(tmpi32, 1)), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
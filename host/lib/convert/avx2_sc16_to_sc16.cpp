@@ -0,0 +1,126 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+//
+// These converters are the AVX2 counterparts of sse2_sc16_to_sc16.cpp: pure
+// wire-format conversions for hosts that stream sc16 samples. For the
+// network-endian (item32_be) devices, this is the entire conversion cost per
+// sample, so doubling the swap width directly doubles the throughput of that
+// path.
+//
+// All swaps are local to each 32-bit word, so no cross-lane permute is
+// needed. Unaligned accesses carry no penalty on AVX2-capable CPUs, so there
+// is no alignment dispatch like in the SSE2 kernels.
+//
+
+//
+// AVX2 16-bit pair swap
+//
+//       -----------------
+//      | A | B | C | D |   Input
+//      -----------------
+//        0   1   2   3     Address
+//      -----------------
+//      | C | D | A | B |   Output
+//      -----------------
+//
+#define CONVERT_SC16_1_TO_SC16_1_NSWAP_GUTS                                       \
+    for (; i + 7 < nsamps; i += 8) {                                              \
+        __m256i m0;                                                               \
+                                                                                  \
+        /* load from input */                                                     \
+        m0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));     \
+                                                                                  \
+        /* swap 16-bit pairs */                                                   \
+        m0 = _mm256_shufflelo_epi16(m0, _MM_SHUFFLE(2, 3, 0, 1));                 \
+        m0 = _mm256_shufflehi_epi16(m0, _MM_SHUFFLE(2, 3, 0, 1));                 \
+                                                                                  \
+        /* store to output */                                                     \
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), m0);          \
+    }
+
+//
+// AVX2 byte swap
+//
+//       -----------------
+//      | A | B | C | D |   Input
+//      -----------------
+//        0   1   2   3     Address
+//      -----------------
+//      | B | A | D | C |   Output
+//      -----------------
+//
+#define CONVERT_SC16_1_TO_SC16_1_BSWAP_GUTS                                       \
+    for (; i + 7 < nsamps; i += 8) {                                              \
+        __m256i m0;                                                               \
+                                                                                  \
+        /* load from input */                                                     \
+        m0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));     \
+                                                                                  \
+        /* byteswap 16-bit words */                                               \
+        m0 = _mm256_or_si256(_mm256_srli_epi16(m0, 8), _mm256_slli_epi16(m0, 8)); \
+                                                                                  \
+        /* store to output */                                                     \
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), m0);          \
+    }
+
+DECLARE_CONVERTER(sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    CONVERT_SC16_1_TO_SC16_1_NSWAP_GUTS
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    CONVERT_SC16_1_TO_SC16_1_BSWAP_GUTS
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_CONVERTER(sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    CONVERT_SC16_1_TO_SC16_1_NSWAP_GUTS
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, sc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    CONVERT_SC16_1_TO_SC16_1_BSWAP_GUTS
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, 1.0);
+}
@@ -0,0 +1,219 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * The kernels below run the SSSE3 single-group recipe (see
+ * ssse3_unpack_sc12.cpp for the shuffle derivation) in both 128-bit lanes of
+ * a 256-bit register at once, so each iteration unpacks two packed 3x groups
+ * into 8 samples. All operations are per-lane, so the only additions are the
+ * two-address lane load and the cross-lane reordering before the store.
+ *
+ * The anonymous namespace keeps these instantiations from colliding with the
+ * SSSE3 kernels of the same shape at link time.
+ */
+namespace {
+
+#define SC12_SHIFT_MASK 0x0fff0fff, 0x0fff0fff, 0xfff0fff0, 0xfff0fff0
+#define SC12_PACK_SHUFFLE1 5, 4, 8, 7, 11, 10, 14, 13, 6, 5, 9, 8, 12, 11, 15, 14
+#define SC12_PACK_SHUFFLE2 15, 14, 7, 6, 13, 12, 5, 4, 11, 10, 3, 2, 9, 8, 1, 0
+
+template <typename type, tohost32_type tohost>
+inline void convert_sc12_item32_6_to_star_8(const item32_sc12_3x* input,
+    std::complex<type>* out,
+    double scalar,
+    typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
+{
+    __m256i m0, m1, m2, m3, m4;
+    m0 = _mm256_set_epi32(SC12_SHIFT_MASK, SC12_SHIFT_MASK);
+    m1 = _mm256_set_epi8(SC12_PACK_SHUFFLE1, SC12_PACK_SHUFFLE1);
+    // load group 0 into the lower lane and group 1 into the upper lane (the
+    // 16-byte lane loads read 4 bytes past each 12-byte group, exactly like
+    // the SSSE3 kernel)
+    m2 = _mm256_loadu2_m128i(reinterpret_cast<const __m128i*>(input + 1),
+        reinterpret_cast<const __m128i*>(input + 0));
+    m2 = _mm256_shuffle_epi32(m2, _MM_SHUFFLE(0, 1, 2, 3));
+    m3 = _mm256_shuffle_epi8(m2, m1);
+    m3 = _mm256_and_si256(m3, m0);
+
+    m4 = _mm256_setzero_si256();
+    m1 = _mm256_unpacklo_epi16(m4, m3);
+    m2 = _mm256_unpackhi_epi16(m4, m3);
+    m2 = _mm256_slli_epi32(m2, 4);
+    m3 = _mm256_unpacklo_epi32(m1, m2);
+    m4 = _mm256_unpackhi_epi32(m1, m2);
+
+    // m3 holds samples 0,1|4,5 and m4 holds samples 2,3|6,7 - reorder
+    __m256i lo = _mm256_permute2x128_si256(m3, m4, 0x20);
+    __m256i hi = _mm256_permute2x128_si256(m3, m4, 0x31);
+
+    __m256 m5, m6, m7;
+    m5 = _mm256_set1_ps(float(scalar / (1 << 16)));
+    m6 = _mm256_mul_ps(_mm256_cvtepi32_ps(lo), m5);
+    m7 = _mm256_mul_ps(_mm256_cvtepi32_ps(hi), m5);
+
+    _mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), m6);
+    _mm256_storeu_ps(reinterpret_cast<float*>(&out[4]), m7);
+}
+
+template <typename type, tohost32_type tohost>
+inline void convert_sc12_item32_6_to_star_8(const item32_sc12_3x* input,
+    std::complex<type>* out,
+    double,
+    typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
+{
+    __m256i m0, m1, m2, m3;
+    m0 = _mm256_set_epi32(SC12_SHIFT_MASK, SC12_SHIFT_MASK);
+    m1 = _mm256_set_epi8(SC12_PACK_SHUFFLE1, SC12_PACK_SHUFFLE1);
+    m2 = _mm256_set_epi8(SC12_PACK_SHUFFLE2, SC12_PACK_SHUFFLE2);
+
+    m3 = _mm256_loadu2_m128i(reinterpret_cast<const __m128i*>(input + 1),
+        reinterpret_cast<const __m128i*>(input + 0));
+    m3 = _mm256_shuffle_epi32(m3, _MM_SHUFFLE(0, 1, 2, 3));
+    m3 = _mm256_shuffle_epi8(m3, m1);
+    m3 = _mm256_and_si256(m3, m0);
+
+    m0 = _mm256_slli_epi16(m3, 4);
+    m1 = _mm256_shuffle_epi32(m3, _MM_SHUFFLE(1, 0, 0, 0));
+    m0 = _mm256_unpackhi_epi64(m1, m0);
+    m1 = _mm256_shuffle_epi8(m0, m2);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), m1);
+}
+
+template <typename type, tohost32_type tohost>
+struct convert_sc12_item32_1_to_star_2 : public converter
+{
+    convert_sc12_item32_1_to_star_2(void) : _scalar(0.0)
+    {
+        // NOP
+    }
+
+    void set_scalar(const double scalar)
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        const size_t head_samps = size_t(inputs[0]) & 0x3;
+        size_t rewind           = 0;
+        switch (head_samps) {
+            case 0:
+                break;
+            case 1:
+                rewind = 9;
+                break;
+            case 2:
+                rewind = 6;
+                break;
+            case 3:
+                rewind = 3;
+                break;
+        }
+
+        const item32_sc12_3x* input =
+            reinterpret_cast<const item32_sc12_3x*>(size_t(inputs[0]) - rewind);
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        std::complex<type> dummy;
+        size_t i = 0, o = 0;
+        switch (head_samps) {
+            case 0:
+                break; // no head
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, dummy, output[0], _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, output[0], output[1], _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, output[0], output[1], output[2], _scalar);
+                break;
+        }
+        o += head_samps;
+
+        // convert the body, two groups at a time
+        while (o + 7 < nsamps) {
+            convert_sc12_item32_6_to_star_8<type, tohost>(
+                &input[i], &output[o], _scalar);
+            i += 2;
+            o += 8;
+        }
+
+        // convert a leftover whole group
+        while (o + 3 < nsamps) {
+            convert_sc12_item32_3_to_star_4<type, tohost>(input[i],
+                output[o + 0],
+                output[o + 1],
+                output[o + 2],
+                output[o + 3],
+                _scalar);
+            i += 1;
+            o += 4;
+        }
+
+        const size_t tail_samps = nsamps - o;
+        switch (tail_samps) {
+            case 0:
+                break; // no tail
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], dummy, dummy, dummy, _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], output[o + 1], dummy, dummy, _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(input[i],
+                    output[o + 0],
+                    output[o + 1],
+                    output[o + 2],
+                    dummy,
+                    _scalar);
+                break;
+        }
+    }
+
+    double _scalar;
+};
+
+} // namespace
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_2<float, uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_2<short, uhd::wtohx>());
+}
+
+UHD_STATIC_BLOCK(register_avx2_unpack_sc12)
+{
+    uhd::convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 1;
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD_AVX2);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD_AVX2);
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+// The 512-bit pack operates per 128-bit lane; this index vector restores
+// sample order across the 64-bit quads afterwards.
+#define AVX512_PACK_PERM _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0)
+
+DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    const __m512i perm  = AVX512_PACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration; unaligned loads carry no penalty on
+    // AVX-512-capable CPUs, so there is no alignment dispatch like in the
+    // SSE2 kernels
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        // convert and scale
+        __m512i tmpilo = _mm512_cvtps_epi32(_mm512_mul_ps(tmplo, scalar));
+        __m512i tmpihi = _mm512_cvtps_epi32(_mm512_mul_ps(tmphi, scalar));
+
+        // pack + lane fixup + swap 16-bit pairs
+        __m512i tmpi = _mm512_packs_epi32(tmpilo, tmpihi);
+        tmpi         = _mm512_permutexvar_epi64(perm, tmpi);
+        tmpi         = _mm512_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi         = _mm512_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        // store to output
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    const __m512i perm  = AVX512_PACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        // convert and scale
+        __m512i tmpilo = _mm512_cvtps_epi32(_mm512_mul_ps(tmplo, scalar));
+        __m512i tmpihi = _mm512_cvtps_epi32(_mm512_mul_ps(tmphi, scalar));
+
+        // pack + lane fixup + byteswap 16-bit words
+        __m512i tmpi = _mm512_packs_epi32(tmpilo, tmpihi);
+        tmpi         = _mm512_permutexvar_epi64(perm, tmpi);
+        tmpi = _mm512_or_si512(_mm512_srli_epi16(tmpi, 8), _mm512_slli_epi16(tmpi, 8));
+
+        // store to output
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    const __m512i perm  = AVX512_PACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        // convert and scale
+        __m512i tmpilo = _mm512_cvtps_epi32(_mm512_mul_ps(tmplo, scalar));
+        __m512i tmpihi = _mm512_cvtps_epi32(_mm512_mul_ps(tmphi, scalar));
+
+        // pack + lane fixup, the samples are already in host order
+        __m512i tmpi = _mm512_packs_epi32(tmpilo, tmpihi);
+        tmpi         = _mm512_permutexvar_epi64(perm, tmpi);
+
+        // store to output
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,127 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+// Pre-swap the 64-bit quads so the per-lane unpack yields samples in order.
+#define AVX512_UNPACK_PERM _mm512_set_epi64(7, 3, 6, 2, 5, 1, 4, 0)
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor) / (1 << 16));
+    const __m512i zeroi = _mm512_setzero_si512();
+    const __m512i perm  = AVX512_UNPACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration; unaligned accesses carry no penalty
+    // on AVX-512-capable CPUs, so there is no alignment dispatch like in the
+    // SSE2 kernels
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input
+        __m512i tmpi = _mm512_loadu_si512(reinterpret_cast<const void*>(input + i));
+
+        // swap 16-bit pairs + lane fixup
+        tmpi = _mm512_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm512_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm512_permutexvar_epi64(perm, tmpi);
+
+        // unpack with the value in the upper 16 bits
+        __m512i tmpilo = _mm512_unpacklo_epi16(zeroi, tmpi);
+        __m512i tmpihi = _mm512_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m512 tmplo = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpilo), scalar);
+        __m512 tmphi = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 8), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor) / (1 << 16));
+    const __m512i zeroi = _mm512_setzero_si512();
+    const __m512i perm  = AVX512_UNPACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input
+        __m512i tmpi = _mm512_loadu_si512(reinterpret_cast<const void*>(input + i));
+
+        // byteswap 16-bit words + lane fixup
+        tmpi = _mm512_or_si512(_mm512_srli_epi16(tmpi, 8), _mm512_slli_epi16(tmpi, 8));
+        tmpi = _mm512_permutexvar_epi64(perm, tmpi);
+
+        // unpack with the value in the upper 16 bits
+        __m512i tmpilo = _mm512_unpacklo_epi16(zeroi, tmpi);
+        __m512i tmpihi = _mm512_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m512 tmplo = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpilo), scalar);
+        __m512 tmphi = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 8), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor) / (1 << 16));
+    const __m512i zeroi = _mm512_setzero_si512();
+    const __m512i perm  = AVX512_UNPACK_PERM;
+
+    size_t i = 0;
+
+    // convert 16 samples per iteration
+    for (; i + 15 < nsamps; i += 16) {
+        // load from input, the samples are already in host order
+        __m512i tmpi = _mm512_loadu_si512(reinterpret_cast<const void*>(input + i));
+
+        // lane fixup
+        tmpi = _mm512_permutexvar_epi64(perm, tmpi);
+
+        // unpack with the value in the upper 16 bits
+        __m512i tmpilo = _mm512_unpacklo_epi16(zeroi, tmpi);
+        __m512i tmpihi = _mm512_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m512 tmplo = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpilo), scalar);
+        __m512 tmphi = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpihi), scalar);
+
+        // store to output
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i + 8), tmphi);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -12,6 +12,7 @@
 #include <uhd/utils/static.hpp>
 #include <stdint.h>
 #include <complex>
+#include <cstring>
 
 #define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio)    \
     struct name : public uhd::convert::converter                              \
@@ -77,11 +78,19 @@ static const int PRIORITY_SIMD  = 3;
 static const int PRIORITY_TABLE = 1;
 #endif
 
+// Wider kernels outrank the 128-bit set when the build enables them. The
+// registry checks these tiers against the features of the running CPU, so
+// registering them is safe even on machines without the instructions.
+static const int PRIORITY_SIMD_AVX2   = 4;
+static const int PRIORITY_SIMD_AVX512 = 5;
+
 /***********************************************************************
  * Typedefs
  **********************************************************************/
 typedef std::complex<double> fc64_t;
 typedef std::complex<float> fc32_t;
+// fc16 holds the raw IEEE 754 binary16 component bits in uint16_t
+typedef std::complex<uint16_t> fc16_t;
 typedef std::complex<int32_t> sc32_t;
 typedef std::complex<int16_t> sc16_t;
 typedef std::complex<int8_t> sc8_t;
@@ -96,6 +105,76 @@ typedef uint32_t item32_t;
 
 typedef item32_t (*xtox_t)(item32_t);
 
+/***********************************************************************
+ * Scalar binary16 (fc16) helpers
+ *
+ * These round to nearest even, matching the F16C conversion
+ * instructions bit for bit so the SIMD kernels and their scalar tails
+ * agree.
+ **********************************************************************/
+UHD_INLINE uint16_t fc16_float_to_half(const float in)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &in, sizeof(bits));
+    const uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+    bits &= 0x7fffffff;
+
+    if (bits >= 0x47800000) {
+        // overflow and infinity map to infinity, NaN stays NaN
+        return sign | uint16_t((bits > 0x7f800000) ? 0x7e00 : 0x7c00);
+    }
+    if (bits >= 0x38800000) {
+        // normal half: rebias the exponent, round the mantissa (a mantissa
+        // carry correctly bumps the exponent)
+        bits -= 0x38000000;
+        bits += 0xfff + ((bits >> 13) & 1);
+        return sign | uint16_t(bits >> 13);
+    }
+    if (bits < 0x33000000) {
+        // too small for a subnormal half: flush to signed zero
+        return sign;
+    }
+    // subnormal half: shift the full mantissa into place
+    const uint32_t shift = 125 - (bits >> 23);
+    const uint32_t mant  = (bits & 0x7fffff) | 0x800000;
+    uint32_t half        = mant >> (shift + 1);
+    const uint32_t rem   = mant & ((2u << shift) - 1);
+    const uint32_t mid   = 1u << shift;
+    if (rem > mid or (rem == mid and (half & 1))) {
+        half++;
+    }
+    return sign | uint16_t(half);
+}
+
+UHD_INLINE float fc16_half_to_float(const uint16_t in)
+{
+    const uint32_t sign = uint32_t(in & 0x8000) << 16;
+    uint32_t exp        = (in >> 10) & 0x1f;
+    uint32_t mant       = in & 0x3ff;
+
+    uint32_t bits;
+    if (exp == 0x1f) {
+        // infinity and NaN
+        bits = sign | 0x7f800000 | (mant << 13);
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+    } else if (mant != 0) {
+        // subnormal half: normalize into a float
+        exp = 113;
+        while ((mant & 0x400) == 0) {
+            mant <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+    } else {
+        bits = sign; // signed zero
+    }
+
+    float out;
+    std::memcpy(&out, &bits, sizeof(out));
+    return out;
+}
+
 /***********************************************************************
  * Convert xx to items32 sc16 buffer
  **********************************************************************/
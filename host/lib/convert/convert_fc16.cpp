@@ -0,0 +1,92 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+
+using namespace uhd::convert;
+
+/*
+ * Scalar converters for the fc16 CPU format: complex IEEE 754 binary16
+ * with the raw component bits stored in uint16_t. These are the generic
+ * fallbacks; the F16C kernels outrank them on capable x86 CPUs.
+ */
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc16, 1, PRIORITY_GENERAL)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc16_t* output      = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = fc16_t(fc16_float_to_half(float(input[i].real()) * scale),
+            fc16_float_to_half(float(input[i].imag()) * scale));
+    }
+}
+
+DECLARE_CONVERTER(fc16, 1, sc16_chdr, 1, PRIORITY_GENERAL)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = sc16_t(int16_t(fc16_half_to_float(input[i].real()) * scale),
+            int16_t(fc16_half_to_float(input[i].imag()) * scale));
+    }
+}
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc16, 1, PRIORITY_GENERAL)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc16_t* output        = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = uhd::wtohx(input[i]);
+        output[i] = fc16_t(fc16_float_to_half(float(int16_t(item >> 16)) * scale),
+            fc16_float_to_half(float(int16_t(item >> 0)) * scale));
+    }
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc16, 1, PRIORITY_GENERAL)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc16_t* output        = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = uhd::ntohx(input[i]);
+        output[i] = fc16_t(fc16_float_to_half(float(int16_t(item >> 16)) * scale),
+            fc16_float_to_half(float(int16_t(item >> 0)) * scale));
+    }
+}
+
+DECLARE_CONVERTER(fc16, 1, sc16_item32_le, 1, PRIORITY_GENERAL)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const uint16_t real = int16_t(fc16_half_to_float(input[i].real()) * scale);
+        const uint16_t imag = int16_t(fc16_half_to_float(input[i].imag()) * scale);
+        output[i] = uhd::htowx((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
+
+DECLARE_CONVERTER(fc16, 1, sc16_item32_be, 1, PRIORITY_GENERAL)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const float scale = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const uint16_t real = int16_t(fc16_half_to_float(input[i].real()) * scale);
+        const uint16_t imag = int16_t(fc16_half_to_float(input[i].imag()) * scale);
+        output[i] = uhd::htonx((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
@@ -5,14 +5,31 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "convert_common.hpp"
 #include <uhd/convert.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/paths.hpp>
 #include <stdint.h>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <chrono>
 #include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <cpuid.h>
+#endif
+
+namespace fs = boost::filesystem;
 
 using namespace uhd;
 
@@ -68,14 +85,235 @@ void uhd::convert::register_converter(
     //----------------------------------------------------------------//
 }
 
+/***********************************************************************
+ * Runtime CPU feature detection
+ **********************************************************************/
+/*!
+ * Return the highest priority tier usable on the running CPU.
+ *
+ * The AVX2/AVX-512 kernels are registered whenever the compiler can build
+ * them, so one binary can serve a heterogeneous fleet; this ceiling keeps
+ * the registry from handing out a converter the CPU cannot execute.
+ */
+static convert::priority_type cpu_max_priority(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (__builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512bw"))
+        return PRIORITY_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return PRIORITY_SIMD_AVX2;
+    return PRIORITY_SIMD;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4] = {0};
+    __cpuid(regs, 0);
+    if (regs[0] < 7)
+        return PRIORITY_SIMD;
+    __cpuid(regs, 1);
+    // without OSXSAVE the OS does not preserve the wider register state
+    if ((regs[2] & (1 << 27)) == 0)
+        return PRIORITY_SIMD;
+    const uint64_t xcr0  = _xgetbv(0);
+    const bool os_avx    = (xcr0 & 0x06) == 0x06;
+    const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+    __cpuidex(regs, 7, 0);
+    const bool has_avx2     = (regs[1] & (1 << 5)) != 0;
+    const bool has_avx512f  = (regs[1] & (1 << 16)) != 0;
+    const bool has_avx512bw = (regs[1] & (1 << 30)) != 0;
+    if (has_avx512f and has_avx512bw and os_avx512)
+        return PRIORITY_SIMD_AVX512;
+    if (has_avx2 and os_avx)
+        return PRIORITY_SIMD_AVX2;
+    return PRIORITY_SIMD;
+#else
+    return PRIORITY_SIMD;
+#endif
+}
+
+/***********************************************************************
+ * Optional converter calibration
+ *
+ * The priority scheme assumes the widest SIMD kernel is the fastest, but
+ * that does not hold on every microarchitecture. Setting the environment
+ * variable UHD_CONVERT_CALIBRATE enables a one-time micro-benchmark of
+ * all registered candidates for each conversion in use; the winner is
+ * cached per CPU model under the appdata path and reused on later runs.
+ **********************************************************************/
+static bool calibration_mode_enabled(void)
+{
+    static const char* env = std::getenv("UHD_CONVERT_CALIBRATE");
+    return env != NULL and std::strcmp(env, "0") != 0;
+}
+
+static std::string cpu_model_string(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    char brand[49] = {0};
+    unsigned int regs[4];
+    for (unsigned int i = 0; i < 3; i++) {
+        if (!__get_cpuid(0x80000002 + i, &regs[0], &regs[1], &regs[2], &regs[3]))
+            return "generic";
+        std::memcpy(brand + i * 16, regs, 16);
+    }
+    return brand;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    char brand[49] = {0};
+    int regs[4];
+    for (int i = 0; i < 3; i++) {
+        __cpuid(regs, 0x80000002 + i);
+        std::memcpy(brand + i * 16, regs, 16);
+    }
+    return brand;
+#else
+    return "generic";
+#endif
+}
+
+static fs::path calibration_file_path(void)
+{
+    return fs::path(uhd::get_appdata_path()) / ".uhd" / "converter_calibration.csv";
+}
+
+//! Load the cached winners for this CPU model, keyed by conversion id
+static std::map<std::string, convert::priority_type>& get_calibration_table(void)
+{
+    static std::map<std::string, convert::priority_type> table = []() {
+        std::map<std::string, convert::priority_type> result;
+        const std::string model = cpu_model_string();
+        std::ifstream file(calibration_file_path().string().c_str());
+        std::string line;
+        while (std::getline(file, line)) {
+            const size_t sep1 = line.find(';');
+            const size_t sep2 = line.rfind(';');
+            if (sep1 == std::string::npos or sep2 <= sep1)
+                continue;
+            if (line.substr(0, sep1) != model)
+                continue;
+            result[line.substr(sep1 + 1, sep2 - sep1 - 1)] =
+                std::atoi(line.substr(sep2 + 1).c_str());
+        }
+        return result;
+    }();
+    return table;
+}
+
+//! Time one candidate converter, returns samples per second
+static double benchmark_converter_fcn(
+    const convert::id_type& id, const convert::function_type& fcn)
+{
+    size_t bytes_per_in_item  = sizeof(uint32_t);
+    size_t bytes_per_out_item = sizeof(uint32_t);
+    try {
+        bytes_per_in_item  = convert::get_bytes_per_item(id.input_format);
+        bytes_per_out_item = convert::get_bytes_per_item(id.output_format);
+    } catch (const uhd::key_error&) {
+        // packed formats have no item size; the default over-allocates
+    }
+
+    // oversize the buffers so packed-format kernels can overread/overwrite
+    const size_t nsamps = 4096;
+    const size_t slack  = 64;
+    std::vector<std::vector<char>> in_buffs(
+        id.num_inputs, std::vector<char>(nsamps * bytes_per_in_item + slack));
+    std::vector<std::vector<char>> out_buffs(
+        id.num_outputs, std::vector<char>(nsamps * bytes_per_out_item + slack));
+
+    std::vector<const void*> in_ptrs;
+    std::vector<void*> out_ptrs;
+    for (auto& buff : in_buffs) {
+        // 0x3f bytes are valid mid-range values in every sample format
+        std::memset(buff.data(), 0x3f, buff.size());
+        in_ptrs.push_back(buff.data());
+    }
+    for (auto& buff : out_buffs) {
+        out_ptrs.push_back(buff.data());
+    }
+
+    convert::converter::sptr conv = fcn();
+    conv->set_scalar(1.0);
+    conv->conv(in_ptrs, out_ptrs, nsamps); // warm-up pass
+
+    const size_t iters = 512;
+    const auto start   = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iters; i++) {
+        conv->conv(in_ptrs, out_ptrs, nsamps);
+    }
+    const double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return double(nsamps * iters) / elapsed;
+}
+
+//! Benchmark all usable candidates for this id and persist the winner
+static convert::priority_type calibrate_converter(
+    const convert::id_type& id, const convert::priority_type max_prio)
+{
+    convert::priority_type best_prio = -1;
+    double best_rate                 = 0.0;
+    for (convert::priority_type prio_i : get_table()[id].keys()) {
+        if (prio_i > max_prio)
+            continue;
+        const double rate = benchmark_converter_fcn(id, get_table()[id][prio_i]);
+        UHD_LOGGER_DEBUG("CONVERT")
+            << boost::format("calibrate: %s prio %d: %.1f Msps") % id.to_string()
+                   % prio_i % (rate / 1e6);
+        if (rate > best_rate) {
+            best_rate = rate;
+            best_prio = prio_i;
+        }
+    }
+
+    get_calibration_table()[id.to_string()] = best_prio;
+    try {
+        fs::create_directories(calibration_file_path().parent_path());
+        std::ofstream file(
+            calibration_file_path().string().c_str(), std::ios::app);
+        file << cpu_model_string() << ";" << id.to_string() << ";" << best_prio
+             << std::endl;
+    } catch (...) {
+        UHD_LOGGER_WARNING("CONVERT")
+            << "calibrate: could not persist results to "
+            << calibration_file_path().string();
+    }
+
+    UHD_LOGGER_INFO("CONVERT") << boost::format("calibrate: %s: using prio %d")
+                                      % id.to_string() % best_prio;
+    return best_prio;
+}
+
 /***********************************************************************
  * The converter functions
  **********************************************************************/
+bool convert::has_converter(const id_type& id)
+{
+    return get_table().has_key(id);
+}
+
+std::vector<convert::id_type> convert::get_ids(void)
+{
+    return get_table().keys();
+}
+
 convert::function_type convert::get_converter(const id_type& id, const priority_type prio)
 {
     if (not get_table().has_key(id))
         throw uhd::key_error("Cannot find a conversion routine for " + id.to_pp_string());
 
+    static const priority_type max_prio = cpu_max_priority();
+
+    // calibration mode overrides the static priority scheme
+    if (prio == -1 and calibration_mode_enabled()) {
+        priority_type cal_prio;
+        if (get_calibration_table().count(id.to_string())) {
+            cal_prio = get_calibration_table()[id.to_string()];
+        } else {
+            cal_prio = calibrate_converter(id, max_prio);
+        }
+        if (get_table()[id].has_key(cal_prio)) {
+            return get_table()[id][cal_prio];
+        }
+        // the cached entry is stale (converter set changed); fall through
+    }
+
     // find a matching priority
     priority_type best_prio = -1;
     for (priority_type prio_i : get_table()[id].keys()) {
@@ -88,6 +326,9 @@ convert::function_type convert::get_converter(const id_type& id, const priority_
             //----------------------------------------------------------------//
             return get_table()[id][prio];
         }
+        // skip kernels built for wider SIMD than the running CPU supports
+        if (prio_i > max_prio)
+            continue;
         best_prio = std::max(best_prio, prio_i);
     }
 
@@ -139,6 +380,7 @@ UHD_STATIC_BLOCK(convert_register_item_sizes)
     // register standard complex types
     convert::register_bytes_per_item("fc64", sizeof(std::complex<double>));
     convert::register_bytes_per_item("fc32", sizeof(std::complex<float>));
+    convert::register_bytes_per_item("fc16", sizeof(std::complex<uint16_t>));
     convert::register_bytes_per_item("sc64", sizeof(std::complex<int64_t>));
     convert::register_bytes_per_item("sc32", sizeof(std::complex<int32_t>));
     convert::register_bytes_per_item("sc16", sizeof(std::complex<int16_t>));
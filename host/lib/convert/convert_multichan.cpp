@@ -0,0 +1,103 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/convert.hpp>
+#include <uhd/utils/static.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace uhd::convert;
+
+/*
+ * Fused multi-channel converters.
+ *
+ * A multi-channel streamer traditionally converts one full buffer per
+ * channel back to back, so by the time channel N is done the caches have
+ * been swept N times. The converter below is registered with
+ * num_inputs == num_outputs == N and converts all channels in one call,
+ * walking the channels in blocks so every block's inputs and outputs stay
+ * cache resident. The per-block conversion itself reuses the best
+ * registered single-channel kernel, so SIMD coverage is inherited rather
+ * than duplicated here.
+ */
+namespace {
+
+class convert_multichan : public converter
+{
+public:
+    convert_multichan(const id_type& chan_id, const size_t nchans)
+        : _bytes_per_in_item(get_bytes_per_item(chan_id.input_format))
+        , _bytes_per_out_item(get_bytes_per_item(chan_id.output_format))
+    {
+        for (size_t i = 0; i < nchans; i++) {
+            _chan_converters.push_back(get_converter(chan_id)());
+        }
+    }
+
+    void set_scalar(const double scalar)
+    {
+        for (auto& chan_converter : _chan_converters) {
+            chan_converter->set_scalar(scalar);
+        }
+    }
+
+    void operator()(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        // At 8 bytes per complex sample in and out, one block of one channel
+        // touches 64 KiB; interleaving the channels per block rather than
+        // per buffer is what keeps multi-channel conversion cache friendly.
+        static const size_t block_samps = 4096;
+
+        for (size_t offset = 0; offset < nsamps; offset += block_samps) {
+            const size_t block = std::min(block_samps, nsamps - offset);
+            for (size_t chan = 0; chan < _chan_converters.size(); chan++) {
+                const void* in = reinterpret_cast<const char*>(inputs[chan])
+                                 + offset * _bytes_per_in_item;
+                void* out = reinterpret_cast<char*>(outputs[chan])
+                            + offset * _bytes_per_out_item;
+                _chan_converters[chan]->conv(in, out, block);
+            }
+        }
+    }
+
+private:
+    std::vector<converter::sptr> _chan_converters;
+    const size_t _bytes_per_in_item;
+    const size_t _bytes_per_out_item;
+};
+
+} // namespace
+
+UHD_STATIC_BLOCK(register_convert_multichan)
+{
+    // The RX streamer looks these up with the channel count of the stream;
+    // the set below covers the common coherent capture configurations.
+    static const std::vector<std::string> out_formats{"fc64", "fc32", "sc16"};
+    static const std::vector<size_t> channel_counts{2, 3, 4, 8};
+
+    for (const std::string& out_format : out_formats) {
+        for (const size_t nchans : channel_counts) {
+            id_type chan_id;
+            chan_id.input_format  = "sc16_chdr";
+            chan_id.num_inputs    = 1;
+            chan_id.output_format = out_format;
+            chan_id.num_outputs   = 1;
+
+            id_type id     = chan_id;
+            id.num_inputs  = nchans;
+            id.num_outputs = nchans;
+
+            uhd::convert::register_converter(
+                id,
+                [chan_id, nchans](void) {
+                    return converter::sptr(new convert_multichan(chan_id, nchans));
+                },
+                PRIORITY_GENERAL);
+        }
+    }
+}
@@ -9,9 +9,28 @@
 #include <uhd/utils/byteswap.hpp>
 #include <arm_neon.h>
 
+#ifdef __aarch64__
+// on AArch64 the register swap is done with intrinsics below instead of the
+// ARMv7 assembly in convert_neon.S
+static void neon_item32_sc16_swap_16n(void* in, void* out, int iter)
+{
+    const int16_t* input = reinterpret_cast<const int16_t*>(in);
+    int16_t* output      = reinterpret_cast<int16_t*>(out);
+    for (int n = 0; n < iter; n++) {
+        // 16 samples per iteration, like the assembly
+        vst1q_s16(output + 0, vrev32q_s16(vld1q_s16(input + 0)));
+        vst1q_s16(output + 8, vrev32q_s16(vld1q_s16(input + 8)));
+        vst1q_s16(output + 16, vrev32q_s16(vld1q_s16(input + 16)));
+        vst1q_s16(output + 24, vrev32q_s16(vld1q_s16(input + 24)));
+        input += 32;
+        output += 32;
+    }
+}
+#else
 extern "C" {
 void neon_item32_sc16_swap_16n(void*, void*, int iter);
 }
+#endif
 
 static const int SIMD_WIDTH = 16;
 
@@ -25,35 +44,23 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
     size_t i;
 
     float32x4_t Q0 = vdupq_n_f32(float(scale_factor));
-    for (i = 0; i < (nsamps & ~0x0f); i += 8) {
-        float32x4_t Q1  = vld1q_f32(reinterpret_cast<const float*>(&input[i]));
-        float32x4_t Q4  = vld1q_f32(reinterpret_cast<const float*>(&input[i + 2]));
-        float32x4_t Q7  = vld1q_f32(reinterpret_cast<const float*>(&input[i + 4]));
-        float32x4_t Q10 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 6]));
-
-        float32x4_t Q2 = vmulq_f32(Q1, Q0);
-        int32x4_t Q3   = vcvtq_s32_f32(Q2);
-        int16x4_t D8   = vmovn_s32(Q3);
-        int16x4_t D9   = vrev32_s16(D8);
-        vst1_s16((reinterpret_cast<int16_t*>(&output[i])), D9);
-
-        float32x4_t Q5 = vmulq_f32(Q4, Q0);
-        int32x4_t Q6   = vcvtq_s32_f32(Q5);
-        int16x4_t D10  = vmovn_s32(Q6);
-        int16x4_t D11  = vrev32_s16(D10);
-        vst1_s16((reinterpret_cast<int16_t*>(&output[i + 2])), D11);
-
-        float32x4_t Q8 = vmulq_f32(Q7, Q0);
-        int32x4_t Q9   = vcvtq_s32_f32(Q8);
-        int16x4_t D12  = vmovn_s32(Q9);
-        int16x4_t D13  = vrev32_s16(D12);
-        vst1_s16((reinterpret_cast<int16_t*>(&output[i + 4])), D13);
-
-        float32x4_t Q11 = vmulq_f32(Q10, Q0);
-        int32x4_t Q13   = vcvtq_s32_f32(Q11);
-        int16x4_t D14   = vmovn_s32(Q13);
-        int16x4_t D15   = vrev32_s16(D14);
-        vst1_s16((reinterpret_cast<int16_t*>(&output[i + 6])), D15);
+    for (i = 0; i < (nsamps & ~0x7); i += 8) {
+        // full 128-bit loads, pipelined so the conversions of the first
+        // half overlap the loads of the second
+        float32x4_t Q1 = vld1q_f32(reinterpret_cast<const float*>(&input[i]));
+        float32x4_t Q2 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 2]));
+        float32x4_t Q3 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 4]));
+        float32x4_t Q4 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 6]));
+
+        int32x4_t Q5  = vcvtq_s32_f32(vmulq_f32(Q1, Q0));
+        int32x4_t Q6  = vcvtq_s32_f32(vmulq_f32(Q2, Q0));
+        int16x8_t Q7  = vcombine_s16(vmovn_s32(Q5), vmovn_s32(Q6));
+        vst1q_s16(reinterpret_cast<int16_t*>(&output[i]), vrev32q_s16(Q7));
+
+        int32x4_t Q8  = vcvtq_s32_f32(vmulq_f32(Q3, Q0));
+        int32x4_t Q9  = vcvtq_s32_f32(vmulq_f32(Q4, Q0));
+        int16x8_t Q10 = vcombine_s16(vmovn_s32(Q8), vmovn_s32(Q9));
+        vst1q_s16(reinterpret_cast<int16_t*>(&output[i + 4]), vrev32q_s16(Q10));
     }
 
     xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
@@ -67,39 +74,150 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
     size_t i;
 
     float32x4_t Q1 = vdupq_n_f32(float(scale_factor));
-    for (i = 0; i < (nsamps & ~0xf); i += 8) {
-        int16x4_t D0 = vld1_s16(reinterpret_cast<const int16_t*>(&input[i]));
-        int16x4_t D2 = vld1_s16(reinterpret_cast<const int16_t*>(&input[i + 2]));
-        int16x4_t D4 = vld1_s16(reinterpret_cast<const int16_t*>(&input[i + 4]));
-        int16x4_t D6 = vld1_s16(reinterpret_cast<const int16_t*>(&input[i + 6]));
-
-        int16x4_t D1   = vrev32_s16(D0);
-        int32x4_t Q2   = vmovl_s16(D1);
-        float32x4_t Q3 = vcvtq_f32_s32(Q2);
-        float32x4_t Q4 = vmulq_f32(Q3, Q1);
-        vst1q_f32((reinterpret_cast<float*>(&output[i])), Q4);
-
-        int16x4_t D3   = vrev32_s16(D2);
-        int32x4_t Q5   = vmovl_s16(D3);
-        float32x4_t Q6 = vcvtq_f32_s32(Q5);
-        float32x4_t Q7 = vmulq_f32(Q6, Q1);
-        vst1q_f32((reinterpret_cast<float*>(&output[i + 2])), Q7);
-
-        int16x4_t D5    = vrev32_s16(D4);
-        int32x4_t Q8    = vmovl_s16(D5);
-        float32x4_t Q9  = vcvtq_f32_s32(Q8);
-        float32x4_t Q10 = vmulq_f32(Q9, Q1);
-        vst1q_f32((reinterpret_cast<float*>(&output[i + 4])), Q10);
-
-        int16x4_t D7    = vrev32_s16(D6);
-        int32x4_t Q11   = vmovl_s16(D7);
-        float32x4_t Q12 = vcvtq_f32_s32(Q11);
-        float32x4_t Q13 = vmulq_f32(Q12, Q1);
-        vst1q_f32((reinterpret_cast<float*>(&output[i + 6])), Q13);
+    for (i = 0; i < (nsamps & ~0x7); i += 8) {
+        // full 128-bit loads, 4 samples each
+        int16x8_t Q2 = vrev32q_s16(
+            vld1q_s16(reinterpret_cast<const int16_t*>(&input[i])));
+        int16x8_t Q3 = vrev32q_s16(
+            vld1q_s16(reinterpret_cast<const int16_t*>(&input[i + 4])));
+
+        float32x4_t Q4 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(Q2)));
+        float32x4_t Q5 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(Q2)));
+        vst1q_f32(reinterpret_cast<float*>(&output[i]), vmulq_f32(Q4, Q1));
+        vst1q_f32(reinterpret_cast<float*>(&output[i + 2]), vmulq_f32(Q5, Q1));
+
+        float32x4_t Q6 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(Q3)));
+        float32x4_t Q7 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(Q3)));
+        vst1q_f32(reinterpret_cast<float*>(&output[i + 4]), vmulq_f32(Q6, Q1));
+        vst1q_f32(reinterpret_cast<float*>(&output[i + 6]), vmulq_f32(Q7, Q1));
+    }
+
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    float32x4_t Q0 = vdupq_n_f32(float(scale_factor));
+    size_t i = 0, j = 0;
+    for (; i + 7 < nsamps; i += 8, j += 4) {
+        float32x4_t Q1 = vld1q_f32(reinterpret_cast<const float*>(&input[i]));
+        float32x4_t Q2 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 2]));
+        float32x4_t Q3 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 4]));
+        float32x4_t Q4 = vld1q_f32(reinterpret_cast<const float*>(&input[i + 6]));
+
+        // scale, convert, and narrow with saturation like the SSE2 kernel
+        int16x8_t Q5 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(vmulq_f32(Q1, Q0))),
+            vqmovn_s32(vcvtq_s32_f32(vmulq_f32(Q2, Q0))));
+        int16x8_t Q6 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(vmulq_f32(Q3, Q0))),
+            vqmovn_s32(vcvtq_s32_f32(vmulq_f32(Q4, Q0))));
+        int8x16_t Q7 = vcombine_s8(vqmovn_s16(Q5), vqmovn_s16(Q6));
+
+        // swap to wire order within each item32 and store 4 items
+        vst1q_s8(reinterpret_cast<int8_t*>(&output[j]), vrev32q_s8(Q7));
+    }
+
+    xx_to_item32_sc8<uhd::htowx>(input + i, output + j, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    float32x4_t Q0   = vdupq_n_f32(float(scale_factor));
+    size_t i = 0, j  = 0;
+    size_t num_samps = nsamps;
+
+    // the buffer may start on a sample rather than an item boundary
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::wtohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 7 < num_samps; j += 8, i += 4) {
+        // 4 items = 8 samples; restore sample order within each item32
+        int8x16_t Q1 =
+            vrev32q_s8(vld1q_s8(reinterpret_cast<const int8_t*>(input + i)));
+        int16x8_t Q2 = vmovl_s8(vget_low_s8(Q1));
+        int16x8_t Q3 = vmovl_s8(vget_high_s8(Q1));
+
+        float32x4_t Q4 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(Q2)));
+        float32x4_t Q5 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(Q2)));
+        vst1q_f32(reinterpret_cast<float*>(&output[j]), vmulq_f32(Q4, Q0));
+        vst1q_f32(reinterpret_cast<float*>(&output[j + 2]), vmulq_f32(Q5, Q0));
+
+        float32x4_t Q6 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(Q3)));
+        float32x4_t Q7 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(Q3)));
+        vst1q_f32(reinterpret_cast<float*>(&output[j + 4]), vmulq_f32(Q6, Q0));
+        vst1q_f32(reinterpret_cast<float*>(&output[j + 6]), vmulq_f32(Q7, Q0));
+    }
+
+    item32_sc8_to_xx<uhd::wtohx>(input + i, output + j, num_samps - j, scale_factor);
+}
+
+#ifdef __aarch64__
+// double-precision vectors only exist on AArch64; ARMv7 keeps the scalar path
+DECLARE_CONVERTER(fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i;
+
+    float64x2_t Q0 = vdupq_n_f64(scale_factor);
+    for (i = 0; i < (nsamps & ~0x3); i += 4) {
+        float64x2_t Q1 = vld1q_f64(reinterpret_cast<const double*>(&input[i]));
+        float64x2_t Q2 = vld1q_f64(reinterpret_cast<const double*>(&input[i + 1]));
+        float64x2_t Q3 = vld1q_f64(reinterpret_cast<const double*>(&input[i + 2]));
+        float64x2_t Q4 = vld1q_f64(reinterpret_cast<const double*>(&input[i + 3]));
+
+        // scale in double precision, then narrow through float
+        float32x4_t Q5 = vcombine_f32(
+            vcvt_f32_f64(vmulq_f64(Q1, Q0)), vcvt_f32_f64(vmulq_f64(Q2, Q0)));
+        float32x4_t Q6 = vcombine_f32(
+            vcvt_f32_f64(vmulq_f64(Q3, Q0)), vcvt_f32_f64(vmulq_f64(Q4, Q0)));
+
+        int16x8_t Q7 = vcombine_s16(
+            vmovn_s32(vcvtq_s32_f32(Q5)), vmovn_s32(vcvtq_s32_f32(Q6)));
+        vst1q_s16(reinterpret_cast<int16_t*>(&output[i]), vrev32q_s16(Q7));
+    }
+
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    size_t i;
+
+    float64x2_t Q0 = vdupq_n_f64(scale_factor);
+    for (i = 0; i < (nsamps & ~0x3); i += 4) {
+        int16x8_t Q1 = vrev32q_s16(
+            vld1q_s16(reinterpret_cast<const int16_t*>(&input[i])));
+        int32x4_t Q2 = vmovl_s16(vget_low_s16(Q1));
+        int32x4_t Q3 = vmovl_s16(vget_high_s16(Q1));
+
+        // int16 values are exact in float; widen to double before scaling
+        float32x4_t Q4 = vcvtq_f32_s32(Q2);
+        float32x4_t Q5 = vcvtq_f32_s32(Q3);
+        vst1q_f64(reinterpret_cast<double*>(&output[i]),
+            vmulq_f64(vcvt_f64_f32(vget_low_f32(Q4)), Q0));
+        vst1q_f64(reinterpret_cast<double*>(&output[i + 1]),
+            vmulq_f64(vcvt_f64_f32(vget_high_f32(Q4)), Q0));
+        vst1q_f64(reinterpret_cast<double*>(&output[i + 2]),
+            vmulq_f64(vcvt_f64_f32(vget_low_f32(Q5)), Q0));
+        vst1q_f64(reinterpret_cast<double*>(&output[i + 3]),
+            vmulq_f64(vcvt_f64_f32(vget_high_f32(Q5)), Q0));
     }
 
     item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
 }
+#endif /* __aarch64__ */
 
 DECLARE_CONVERTER(sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD)
 {
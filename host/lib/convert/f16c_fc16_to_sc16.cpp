@@ -0,0 +1,102 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * F16C-accelerated fc16 (binary16) -> sc16 converters. F16C shipped
+ * together with AVX2 on every CPU we care about, so these register at the
+ * AVX2 tier and rely on the same runtime CPU ceiling.
+ */
+
+#define CONVERT_FC16_8_TO_SC16_8(swap_instructions)                               \
+    /* widen 16 binary16 components to float, convert, scale */                   \
+    __m256 tmplo = _mm256_cvtph_ps(                                               \
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0)));        \
+    __m256 tmphi = _mm256_cvtph_ps(                                               \
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4)));        \
+    __m256i tmpilo = _mm256_cvtps_epi32(_mm256_mul_ps(tmplo, scalar));            \
+    __m256i tmpihi = _mm256_cvtps_epi32(_mm256_mul_ps(tmphi, scalar));            \
+                                                                                  \
+    /* pack (per 128-bit lane, so restore sample order across lanes) */           \
+    __m256i tmpi = _mm256_packs_epi32(tmpilo, tmpihi);                            \
+    tmpi         = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));       \
+    swap_instructions;                                                            \
+                                                                                  \
+    /* store to output */                                                         \
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), tmpi);
+
+DECLARE_CONVERTER(fc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // the wire wants Q/I order; swap the 16-bit pairs
+        CONVERT_FC16_8_TO_SC16_8(
+            tmpi = _mm256_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+            tmpi = _mm256_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1)))
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        const uint16_t real = int16_t(fc16_half_to_float(input[i].real()) * scale);
+        const uint16_t imag = int16_t(fc16_half_to_float(input[i].imag()) * scale);
+        output[i] = uhd::htowx((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
+
+DECLARE_CONVERTER(fc16, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // byteswap the 16-bit words
+        CONVERT_FC16_8_TO_SC16_8(tmpi = _mm256_or_si256(
+                                     _mm256_srli_epi16(tmpi, 8), _mm256_slli_epi16(tmpi, 8)))
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        const uint16_t real = int16_t(fc16_half_to_float(input[i].real()) * scale);
+        const uint16_t imag = int16_t(fc16_half_to_float(input[i].imag()) * scale);
+        output[i] = uhd::htonx((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
+
+DECLARE_CONVERTER(fc16, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc16_t* input = reinterpret_cast<const fc16_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // samples are already in host order
+        CONVERT_FC16_8_TO_SC16_8()
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        output[i] = sc16_t(int16_t(fc16_half_to_float(input[i].real()) * scale),
+            int16_t(fc16_half_to_float(input[i].imag()) * scale));
+    }
+}
@@ -0,0 +1,105 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * F16C-accelerated sc16 -> fc16 (binary16) converters. F16C shipped
+ * together with AVX2 on every CPU we care about, so these register at the
+ * AVX2 tier and rely on the same runtime CPU ceiling.
+ */
+
+#define CONVERT_SC16_8_TO_FC16_8(swap_instructions)                              \
+    /* load 8 complex int16 samples */                                           \
+    __m256i tmpi =                                                               \
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));         \
+    swap_instructions;                                                           \
+                                                                                 \
+    /* sign extend to 32 bits, convert to float and scale */                     \
+    __m256 tmplo = _mm256_cvtepi32_ps(                                           \
+        _mm256_cvtepi16_epi32(_mm256_castsi256_si128(tmpi)));                    \
+    __m256 tmphi =                                                               \
+        _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(tmpi, 1))); \
+    tmplo = _mm256_mul_ps(tmplo, scalar);                                        \
+    tmphi = _mm256_mul_ps(tmphi, scalar);                                        \
+                                                                                 \
+    /* narrow to binary16 with round to nearest even */                          \
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 0),                 \
+        _mm256_cvtps_ph(tmplo, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));  \
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4),                 \
+        _mm256_cvtps_ph(tmphi, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc16_t* output        = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // the wire holds Q/I order; swap the 16-bit pairs back
+        CONVERT_SC16_8_TO_FC16_8(
+            tmpi = _mm256_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+            tmpi = _mm256_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1)))
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        const item32_t item = uhd::wtohx(input[i]);
+        output[i] = fc16_t(fc16_float_to_half(float(int16_t(item >> 16)) * scale),
+            fc16_float_to_half(float(int16_t(item >> 0)) * scale));
+    }
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc16_t* output        = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // byteswap the 16-bit words
+        CONVERT_SC16_8_TO_FC16_8(tmpi = _mm256_or_si256(
+                                     _mm256_srli_epi16(tmpi, 8), _mm256_slli_epi16(tmpi, 8)))
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        const item32_t item = uhd::ntohx(input[i]);
+        output[i] = fc16_t(fc16_float_to_half(float(int16_t(item >> 16)) * scale),
+            fc16_float_to_half(float(int16_t(item >> 0)) * scale));
+    }
+}
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc16_t* output      = reinterpret_cast<fc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        // samples are already in host order
+        CONVERT_SC16_8_TO_FC16_8()
+    }
+
+    // convert any remaining samples
+    const float scale = float(scale_factor);
+    for (; i < nsamps; i++) {
+        output[i] = fc16_t(fc16_float_to_half(float(input[i].real()) * scale),
+            fc16_float_to_half(float(input[i].imag()) * scale));
+    }
+}
@@ -12,6 +12,11 @@
 
 using namespace uhd::convert;
 
+// Outputs at least this large are written with non-temporal stores: the
+// converted samples are handed to the transport and never read back by the
+// CPU, so pulling them through the cache only evicts useful lines.
+static const size_t STREAM_STORE_MIN_BYTES = size_t(1) << 20;
+
 DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
@@ -20,7 +25,7 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
     const __m128 scalar = _mm_set_ps1(float(scale_factor));
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
-#define convert_fc32_1_to_item32_1_nswap_guts(_al_)                            \
+#define convert_fc32_1_to_item32_1_nswap_guts(_al_, _st_)                      \
     for (; i + 3 < nsamps; i += 4) {                                           \
         /* load from input */                                                  \
         __m128 tmplo =                                                         \
@@ -38,17 +43,27 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
         tmpi         = _mm_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));     \
                                                                                \
         /* store to output */                                                  \
-        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);        \
+        _mm_##_st_##_si128(reinterpret_cast<__m128i*>(output + i), tmpi);      \
     }
 
     size_t i = 0;
 
+    // buffers too large to stay cache resident bypass the cache on store
+    // (the streaming store needs an aligned destination)
+    if (nsamps * sizeof(item32_t) >= STREAM_STORE_MIN_BYTES
+        and (size_t(output) & 0xf) == 0) {
+        convert_fc32_1_to_item32_1_nswap_guts(u_, stream);
+        _mm_sfence();
+        xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+        return;
+    }
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(input) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_fc32_1_to_item32_1_nswap_guts(_) break;
+            convert_fc32_1_to_item32_1_nswap_guts(_, storeu) break;
         case 0x8:
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
@@ -56,11 +71,11 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
-            convert_fc32_1_to_item32_1_nswap_guts(_) break;
+            convert_fc32_1_to_item32_1_nswap_guts(_, storeu) break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load
-            convert_fc32_1_to_item32_1_nswap_guts(u_)
+            convert_fc32_1_to_item32_1_nswap_guts(u_, storeu)
     }
 
     // convert any remaining samples
@@ -75,7 +90,7 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
     const __m128 scalar = _mm_set_ps1(float(scale_factor));
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
-#define convert_fc32_1_to_item32_1_bswap_guts(_al_)                                    \
+#define convert_fc32_1_to_item32_1_bswap_guts(_al_, _st_)                              \
     for (; i + 3 < nsamps; i += 4) {                                                   \
         /* load from input */                                                          \
         __m128 tmplo =                                                                 \
@@ -92,17 +107,27 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
         tmpi         = _mm_or_si128(_mm_srli_epi16(tmpi, 8), _mm_slli_epi16(tmpi, 8)); \
                                                                                        \
         /* store to output */                                                          \
-        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);                \
+        _mm_##_st_##_si128(reinterpret_cast<__m128i*>(output + i), tmpi);              \
     }
 
     size_t i = 0;
 
+    // buffers too large to stay cache resident bypass the cache on store
+    // (the streaming store needs an aligned destination)
+    if (nsamps * sizeof(item32_t) >= STREAM_STORE_MIN_BYTES
+        and (size_t(output) & 0xf) == 0) {
+        convert_fc32_1_to_item32_1_bswap_guts(u_, stream);
+        _mm_sfence();
+        xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+        return;
+    }
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(input) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_fc32_1_to_item32_1_bswap_guts(_) break;
+            convert_fc32_1_to_item32_1_bswap_guts(_, storeu) break;
         case 0x8:
             // the first value is 8-byte aligned - process it and prepare the bulk of the
             // data for fast conversion
@@ -110,11 +135,11 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the remaining samples now that we are 16-byte
             // aligned
-            convert_fc32_1_to_item32_1_bswap_guts(_) break;
+            convert_fc32_1_to_item32_1_bswap_guts(_, storeu) break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load
-            convert_fc32_1_to_item32_1_bswap_guts(u_)
+            convert_fc32_1_to_item32_1_bswap_guts(u_, storeu)
     }
 
     // convert any remaining samples
@@ -129,7 +154,7 @@ DECLARE_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD)
     const __m128 scalar = _mm_set_ps1(float(scale_factor));
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
-#define convert_fc32_1_to_item32_1_guts(_al_)                                  \
+#define convert_fc32_1_to_item32_1_guts(_al_, _st_)                            \
     for (; i + 3 < nsamps; i += 4) {                                           \
         /* load from input */                                                  \
         __m128 tmplo =                                                         \
@@ -145,17 +170,27 @@ DECLARE_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD)
         __m128i tmpi = _mm_packs_epi32(tmpilo, tmpihi);                        \
                                                                                \
         /* store to output */                                                  \
-        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);        \
+        _mm_##_st_##_si128(reinterpret_cast<__m128i*>(output + i), tmpi);      \
     }
 
     size_t i = 0;
 
+    // buffers too large to stay cache resident bypass the cache on store
+    // (the streaming store needs an aligned destination)
+    if (nsamps * sizeof(sc16_t) >= STREAM_STORE_MIN_BYTES
+        and (size_t(output) & 0xf) == 0) {
+        convert_fc32_1_to_item32_1_guts(u_, stream);
+        _mm_sfence();
+        xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+        return;
+    }
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(input) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_fc32_1_to_item32_1_guts(_) break;
+            convert_fc32_1_to_item32_1_guts(_, storeu) break;
         case 0x8:
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
@@ -163,11 +198,11 @@ DECLARE_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
-            convert_fc32_1_to_item32_1_guts(_) break;
+            convert_fc32_1_to_item32_1_guts(_, storeu) break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load
-            convert_fc32_1_to_item32_1_guts(u_)
+            convert_fc32_1_to_item32_1_guts(u_, storeu)
     }
 
     // convert any remaining samples
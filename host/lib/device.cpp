@@ -11,7 +11,10 @@
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/init_profile.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <uhdlib/utils/prefs.hpp>
+#include <uhdlib/utils/thread_roles.hpp>
 #include <boost/format.hpp>
 #include <boost/functional/hash.hpp>
 #include <boost/thread/mutex.hpp>
@@ -82,6 +85,12 @@ device::~device(void)
  **********************************************************************/
 device_addrs_t device::find(const device_addr_t& hint, device_filter_t filter)
 {
+    utils::scoped_init_phase profile_phase("device::find");
+
+    // Modules may register additional device types; make sure they had their
+    // chance before we walk the registry.
+    uhd::load_modules();
+
     boost::mutex::scoped_lock lock(_device_mutex);
 
     device_addrs_t device_addrs;
@@ -110,22 +119,35 @@ device_addrs_t device::find(const device_addr_t& hint, device_filter_t filter)
  **********************************************************************/
 device::sptr device::make(const device_addr_t& hint, device_filter_t filter, size_t which)
 {
+    utils::scoped_init_phase profile_phase("device::make");
+
+    uhd::load_modules();
+
     boost::mutex::scoped_lock lock(_device_mutex);
 
     typedef std::tuple<device_addr_t, make_t> dev_addr_make_t;
     std::vector<dev_addr_make_t> dev_addr_makers;
 
-    for (const dev_fcn_reg_t& fcn : get_dev_fcn_regs()) {
-        try {
+    {
+        utils::scoped_init_phase profile_discovery("discovery");
+        // run the discovery functions concurrently, as in find() above
+        std::vector<std::pair<make_t, std::future<device_addrs_t>>> find_tasks;
+        for (const dev_fcn_reg_t& fcn : get_dev_fcn_regs()) {
             if (filter == ANY or std::get<2>(fcn) == filter) {
-                for (device_addr_t dev_addr : std::get<0>(fcn)(hint)) {
+                find_tasks.emplace_back(std::get<1>(fcn),
+                    std::async(std::launch::async,
+                        [fcn, hint]() { return std::get<0>(fcn)(hint); }));
+            }
+        }
+        for (auto& find_task : find_tasks) {
+            try {
+                for (device_addr_t dev_addr : find_task.second.get()) {
                     // append the discovered address and its factory function
-                    dev_addr_makers.push_back(
-                        dev_addr_make_t(dev_addr, std::get<1>(fcn)));
+                    dev_addr_makers.push_back(dev_addr_make_t(dev_addr, find_task.first));
                 }
+            } catch (const std::exception& e) {
+                UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
             }
-        } catch (const std::exception& e) {
-            UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
         }
     }
 
@@ -165,7 +187,12 @@ device::sptr device::make(const device_addr_t& hint, device_filter_t filter, siz
         // Add keys from the config files (note: the user-defined keys will
         // always be applied, see also get_usrp_args()
         // Then, create and register a new device.
-        device::sptr dev         = maker(prefs::get_usrp_args(dev_addr));
+        const device_addr_t usrp_args = prefs::get_usrp_args(dev_addr);
+        // Housekeeping threads spawned during and after make consult this
+        // for their CPU affinity and priority
+        uhd::utils::register_thread_role_config(usrp_args);
+        utils::scoped_init_phase profile_factory("claim_and_init");
+        device::sptr dev         = maker(usrp_args);
         hash_to_device[dev_hash] = dev;
         return dev;
     }
@@ -17,6 +17,7 @@
 #include <boost/thread/mutex.hpp>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 #ifdef UHD_EXPERT_LOGGING
 #    define EX_LOG(depth, str) _log(depth, str)
@@ -38,8 +39,32 @@ typedef boost::adjacency_list<boost::vecS, // Container used to represent the ed
     >
     expert_graph_t;
 
-typedef std::map<std::string, expert_graph_t::vertex_descriptor> vertex_map_t;
+//! The registries key on a pointer to the name string owned by the node
+// itself (nodes live until clear()), so each name is stored exactly once
+// and lookups hash the characters without copying the key
+struct node_name_hash
+{
+    size_t operator()(const std::string* name) const
+    {
+        return std::hash<std::string>()(*name);
+    }
+};
+
+struct node_name_equal
+{
+    bool operator()(const std::string* lhs, const std::string* rhs) const
+    {
+        return *lhs == *rhs;
+    }
+};
+
+typedef std::unordered_map<const std::string*,
+    expert_graph_t::vertex_descriptor,
+    node_name_hash,
+    node_name_equal>
+    vertex_map_t;
 typedef std::list<expert_graph_t::vertex_descriptor> node_queue_t;
+typedef std::vector<expert_graph_t::vertex_descriptor> node_order_t;
 
 typedef boost::graph_traits<expert_graph_t>::edge_iterator edge_iter;
 typedef boost::graph_traits<expert_graph_t>::vertex_iterator vertex_iter;
@@ -194,24 +219,24 @@ public:
             }
             bool prop_unused = false;
             if (in_count > 1) {
-                data_node_issues.push_back(v.first + ": multiple writers (workers)");
+                data_node_issues.push_back(*v.first + ": multiple writers (workers)");
             } else if (in_count > 0) {
                 if (_expert_dag[v.second]->get_class() == CLASS_PROPERTY) {
                     data_node_issues.push_back(
-                        v.first + ": multiple writers (worker and property tree)");
+                        *v.first + ": multiple writers (worker and property tree)");
                 }
             } else {
                 if (_expert_dag[v.second]->get_class() != CLASS_PROPERTY) {
                     data_node_issues.push_back(
-                        v.first + ": unreachable (will always hold initial value)");
+                        *v.first + ": unreachable (will always hold initial value)");
                 } else if (_expert_dag[v.second]->get_class() == CLASS_PROPERTY
                            and not _expert_dag[v.second]->has_write_callback()) {
                     if (out_count > 0) {
                         data_node_issues.push_back(
-                            v.first + ": needs explicit resolve after write");
+                            *v.first + ": needs explicit resolve after write");
                     } else {
                         data_node_issues.push_back(
-                            v.first + ": unused (no readers or writers)");
+                            *v.first + ": unused (no readers or writers)");
                         prop_unused = true;
                     }
                 }
@@ -219,12 +244,12 @@ public:
             if (out_count < 1) {
                 if (_expert_dag[v.second]->get_class() != CLASS_PROPERTY) {
                     data_node_issues.push_back(
-                        v.first + ": unused (is not read by any worker)");
+                        *v.first + ": unused (is not read by any worker)");
                 } else if (_expert_dag[v.second]->get_class() == CLASS_PROPERTY
                            and not _expert_dag[v.second]->has_read_callback()) {
                     if (not prop_unused) {
                         data_node_issues.push_back(
-                            v.first + ": needs explicit resolve to read");
+                            *v.first + ": needs explicit resolve to read");
                     }
                 }
             }
@@ -253,10 +278,10 @@ public:
                     out_count++;
             }
             if (in_count < 1) {
-                worker_issues.push_back(v.first + ": no inputs (will never resolve)");
+                worker_issues.push_back(*v.first + ": no inputs (will never resolve)");
             }
             if (out_count < 1) {
-                worker_issues.push_back(v.first + ": no outputs");
+                worker_issues.push_back(*v.first + ": no outputs");
             }
         }
         if (worker_issues.empty()) {
@@ -294,7 +319,7 @@ protected:
                                      + " is not a data/property node.");
             // Throw leaves data_node undeleted
         }
-        if (_datanode_map.find(data_node->get_name()) != _datanode_map.end()) {
+        if (_datanode_map.find(&data_node->get_name()) != _datanode_map.end()) {
             throw uhd::runtime_error(
                 "Data node with name " + data_node->get_name() + " already exists");
             // Throw leaves data node undeleted
@@ -304,9 +329,9 @@ protected:
             // Add a vertex in this graph for the data node
             expert_graph_t::vertex_descriptor gr_node =
                 boost::add_vertex(data_node, _expert_dag);
+            _sorted_nodes_valid = false;
             EX_LOG(1, str(boost::format("added vertex %s") % data_node->get_name()));
-            _datanode_map.insert(
-                vertex_map_t::value_type(data_node->get_name(), gr_node));
+            _datanode_map.emplace(&data_node->get_name(), gr_node);
 
             // Add resolve callbacks
             if (resolve_mode == AUTO_RESOLVE_ON_WRITE
@@ -344,7 +369,7 @@ protected:
             throw uhd::runtime_error(
                 "Supplied node " + worker->get_name() + " is not a worker node.");
         }
-        if (_worker_map.find(worker->get_name()) != _worker_map.end()) {
+        if (_worker_map.find(&worker->get_name()) != _worker_map.end()) {
             throw uhd::runtime_error(
                 "Resolver with name " + worker->get_name() + " already exists.");
         }
@@ -353,12 +378,13 @@ protected:
             // Add a vertex in this graph for the worker node
             expert_graph_t::vertex_descriptor gr_node =
                 boost::add_vertex(worker, _expert_dag);
+            _sorted_nodes_valid = false;
             EX_LOG(1, str(boost::format("added vertex %s") % worker->get_name()));
-            _worker_map.insert(vertex_map_t::value_type(worker->get_name(), gr_node));
+            _worker_map.emplace(&worker->get_name(), gr_node);
 
             // For each input, add an edge from the input to this node
             for (const std::string& node_name : worker->get_inputs()) {
-                vertex_map_t::const_iterator node = _datanode_map.find(node_name);
+                vertex_map_t::const_iterator node = _datanode_map.find(&node_name);
                 if (node != _datanode_map.end()) {
                     boost::add_edge((*node).second, gr_node, _expert_dag);
                     EX_LOG(1,
@@ -373,7 +399,7 @@ protected:
 
             // For each output, add an edge from this node to the output
             for (const std::string& node_name : worker->get_outputs()) {
-                vertex_map_t::const_iterator node = _datanode_map.find(node_name);
+                vertex_map_t::const_iterator node = _datanode_map.find(&node_name);
                 if (node != _datanode_map.end()) {
                     boost::add_edge(gr_node, (*node).second, _expert_dag);
                     EX_LOG(1,
@@ -423,6 +449,9 @@ protected:
 
         // Release all vertices and edges in the DAG
         _expert_dag.clear();
+        _sorted_nodes.clear();
+        _sorted_node_ptrs.clear();
+        _sorted_nodes_valid = false;
 
         // Release all nodes in the map
         _worker_map.clear();
@@ -430,8 +459,17 @@ protected:
     }
 
 private:
-    void _resolve_helper(std::string start, std::string stop, bool force)
+    /*!
+     * Ensure that _sorted_nodes holds a valid topological order of the DAG.
+     * The order only changes when nodes or edges are added (i.e. at container
+     * build time), so resolves reuse it instead of re-sorting the graph on
+     * every call. Requires _mutex to be held.
+     */
+    void _ensure_sorted_nodes()
     {
+        if (_sorted_nodes_valid) {
+            return;
+        }
         // Sort the graph topologically. This ensures that for all dependencies, the
         // dependant is always after all of its dependencies.
         node_queue_t sorted_nodes;
@@ -452,36 +490,54 @@ private:
                     + edges);
             }
         }
-        if (sorted_nodes.empty())
+        _sorted_nodes.assign(sorted_nodes.begin(), sorted_nodes.end());
+
+        // Also cache the node pointers in topological order, so resolves
+        // sweep a contiguous array instead of indirecting through the
+        // graph's vertex storage for every node
+        _sorted_node_ptrs.clear();
+        _sorted_node_ptrs.reserve(_sorted_nodes.size());
+        for (const auto& vertex : _sorted_nodes) {
+            _sorted_node_ptrs.push_back(&_get_vertex(vertex));
+        }
+        _sorted_nodes_valid = true;
+    }
+
+    void _resolve_helper(std::string start, std::string stop, bool force)
+    {
+        _ensure_sorted_nodes();
+        if (_sorted_nodes.empty())
             return;
 
         // Determine the start and stop node. If one is not explicitly specified then
         // resolve everything
-        expert_graph_t::vertex_descriptor start_vertex = sorted_nodes.front();
-        expert_graph_t::vertex_descriptor stop_vertex  = sorted_nodes.back();
+        expert_graph_t::vertex_descriptor start_vertex = _sorted_nodes.front();
+        expert_graph_t::vertex_descriptor stop_vertex  = _sorted_nodes.back();
         if (not start.empty())
             start_vertex = _lookup_vertex(start);
         if (not stop.empty())
             stop_vertex = _lookup_vertex(stop);
 
-        // First Pass: Resolve all nodes if they are dirty, in a topological order
-        std::list<dag_vertex_t*> resolved_workers;
+        // First Pass: Resolve all nodes if they are dirty, in the cached
+        // topological order. Dirtiness propagates along the order by itself:
+        // a worker's resolve writes (and thereby dirties) its outputs before
+        // the sweep reaches their downstream readers, so only the affected
+        // cone of the original write is ever evaluated.
+        _resolved_workers.clear();
         bool start_node_encountered = false;
-        for (node_queue_t::iterator node_iter = sorted_nodes.begin();
-             node_iter != sorted_nodes.end();
-             ++node_iter) {
+        for (size_t i = 0; i < _sorted_nodes.size(); i++) {
             // Determine if we are at or beyond the starting node
-            if (*node_iter == start_vertex)
+            if (_sorted_nodes[i] == start_vertex)
                 start_node_encountered = true;
 
             // Only resolve if the starting node has passed
             if (start_node_encountered) {
-                dag_vertex_t& node = _get_vertex(*node_iter);
+                dag_vertex_t& node = *_sorted_node_ptrs[i];
                 std::string node_val;
                 if (force or node.is_dirty()) {
                     node.resolve();
                     if (node.get_class() == CLASS_WORKER) {
-                        resolved_workers.push_back(&node);
+                        _resolved_workers.push_back(&node);
                     }
                     EX_LOG(1,
                         str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
@@ -494,7 +550,7 @@ private:
             }
 
             // Determine if we are beyond the stop node
-            if (*node_iter == stop_vertex)
+            if (_sorted_nodes[i] == stop_vertex)
                 break;
         }
 
@@ -502,8 +558,8 @@ private:
         // all of its dependencies clean so after this step all data nodes that are not
         // consumed by a worker will remain dirty (as they should because no one has
         // consumed their value)
-        for (std::list<dag_vertex_t*>::iterator worker = resolved_workers.begin();
-             worker != resolved_workers.end();
+        for (std::vector<dag_vertex_t*>::iterator worker = _resolved_workers.begin();
+             worker != _resolved_workers.end();
              ++worker) {
             (*worker)->mark_clean();
         }
@@ -513,12 +569,12 @@ private:
     {
         expert_graph_t::vertex_descriptor vertex;
         // Look for node in the data-node map
-        vertex_map_t::const_iterator vertex_iter = _datanode_map.find(name);
+        vertex_map_t::const_iterator vertex_iter = _datanode_map.find(&name);
         if (vertex_iter != _datanode_map.end()) {
             vertex = (*vertex_iter).second;
         } else {
             // If not found, look in the worker-node map
-            vertex_iter = _worker_map.find(name);
+            vertex_iter = _worker_map.find(&name);
             if (vertex_iter != _worker_map.end()) {
                 vertex = (*vertex_iter).second;
             } else {
@@ -553,6 +609,11 @@ private:
     vertex_map_t _worker_map; // A map from vertex name to vertex descriptor for workers
     vertex_map_t
         _datanode_map; // A map from vertex name to vertex descriptor for data nodes
+    node_order_t _sorted_nodes; // Cached topological order of the DAG
+    std::vector<dag_vertex_t*>
+        _sorted_node_ptrs; // Node pointers in the same order, for resolves
+    bool _sorted_nodes_valid = false;
+    std::vector<dag_vertex_t*> _resolved_workers; // Scratch space for resolves
     boost::mutex _mutex;
     boost::recursive_mutex _resolve_mutex;
 };
@@ -9,6 +9,7 @@
 #include <uhd/image_loader.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <iostream>
@@ -48,6 +49,10 @@ void uhd::image_loader::register_image_loader(const std::string& device_type,
 bool uhd::image_loader::load(
     const uhd::image_loader::image_loader_args_t& image_loader_args)
 {
+    // Modules may register additional image loaders; make sure they had
+    // their chance before we walk the registry.
+    uhd::load_modules();
+
     // If "type=foo" given in args, see if we have an image loader for that
     if (image_loader_args.args.has_key("type")) {
         std::string type = image_loader_args.args.get("type");
@@ -0,0 +1,128 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace rfnoc {
+
+/*!
+ * In-process flight recorder for CHDR data packets.
+ *
+ * Captures the 64-bit CHDR header (and timestamp, if present) of every
+ * packet a data transport sees into a fixed-size ring, so that when a
+ * stream error occurs the recent packet history can be dumped for
+ * post-mortem analysis without external port mirroring. Payloads are
+ * never copied, which keeps the hot-path cost to a pair of word stores
+ * plus a clock read.
+ *
+ * The ring is single-producer: record() may only be called from one
+ * thread at a time (the transport's packet path). dump() may be called
+ * from another thread, but is intended for use after the producer has
+ * stopped on an error; if the producer is still running, the oldest
+ * slot of the dump may contain a partially overwritten record.
+ *
+ * Dumps are written in pcapng format with a user link type
+ * (LINKTYPE_USER0) and nanosecond timestamps, so standard capture
+ * tooling can open them.
+ */
+class chdr_flight_recorder : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<chdr_flight_recorder>;
+
+    //! Direction of the recorded packet, mapped to the pcapng inbound /
+    //! outbound packet flags on dump
+    enum direction_t : uint8_t { DIR_RX = 0, DIR_TX = 1 };
+
+    /*!
+     * \param num_records Capacity of the ring in packets (must be nonzero)
+     * \param file_prefix Path prefix for files written by dump_on_error();
+     *                    ".pcapng" is appended
+     */
+    chdr_flight_recorder(const size_t num_records, const std::string& file_prefix);
+
+    /*!
+     * Records one packet header into the ring (hot path)
+     *
+     * \param header The raw 64-bit CHDR header, in host byte order
+     * \param tsf The packet timestamp, if has_tsf
+     * \param has_tsf Whether the packet carries a timestamp
+     * \param dir Direction of the packet
+     */
+    UHD_FORCE_INLINE void record(const uint64_t header,
+        const uint64_t tsf,
+        const bool has_tsf,
+        const direction_t dir)
+    {
+        const uint64_t seq = _next_record.load(std::memory_order_relaxed);
+        record_t& rec      = _records[seq % _records.size()];
+        rec.time_ns        = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+        rec.header  = header;
+        rec.tsf     = tsf;
+        rec.has_tsf = has_tsf;
+        rec.dir     = dir;
+        // Publish the slot; dump() acquires this counter
+        _next_record.store(seq + 1, std::memory_order_release);
+    }
+
+    /*!
+     * Writes the recorded history to a pcapng file, once
+     *
+     * The file is named <file_prefix>.pcapng. Subsequent calls are no-ops,
+     * so the history of the first error is not overwritten by follow-on
+     * errors. Note this performs file I/O and should only be called on an
+     * error path.
+     *
+     * \return the path of the written file, or an empty string if this
+     *         recorder already dumped or the file could not be opened
+     */
+    std::string dump_on_error();
+
+    //! Writes the recorded history, oldest packet first, as pcapng to a stream
+    void dump(std::ostream& out) const;
+
+    //! Returns the total number of packets recorded (not capped to the
+    //! ring capacity)
+    uint64_t get_num_recorded() const
+    {
+        return _next_record.load(std::memory_order_acquire);
+    }
+
+private:
+    //! One captured packet; payloads are intentionally not stored
+    struct record_t
+    {
+        uint64_t time_ns = 0;
+        uint64_t header  = 0;
+        uint64_t tsf     = 0;
+        uint8_t has_tsf  = 0;
+        uint8_t dir      = 0;
+    };
+
+    std::vector<record_t> _records;
+
+    // Count of records ever written; the producer bumps it with a release
+    // store after filling the slot
+    std::atomic<uint64_t> _next_record{0};
+
+    const std::string _file_prefix;
+
+    bool _dumped = false;
+};
+
+}} // namespace uhd::rfnoc
@@ -232,6 +232,21 @@ public:
             _chdr_pkt->conv_to_host<uint64_t>());
     }
 
+    //! Returns an allocation-free view into the CHDR payload
+    //
+    //  Unlike get_payload(), this does not deserialize anything; fields are
+    //  decoded from the packet buffer when the view's accessors are called.
+    //  The view is only valid as long as the buffer that this packet was last
+    //  refreshed onto. This is a member template so that it only has to exist
+    //  for payload types that provide a view (mgmt_payload does not).
+    template <typename T = payload_t>
+    inline typename T::view_t get_payload_view() const
+    {
+        return typename T::view_t(_chdr_pkt->get_payload_const_ptr_as<uint64_t>(),
+            _chdr_pkt->get_payload_size() / sizeof(uint64_t),
+            _chdr_pkt->get_byte_order());
+    }
+
 private:
     chdr_packet::uptr _chdr_pkt;
 };
@@ -8,6 +8,8 @@
 
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
 #include <uhdlib/rfnoc/chdr_packet.hpp>
 #include <uhdlib/rfnoc/chdr_types.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
@@ -15,6 +17,7 @@
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -202,6 +205,12 @@ public:
         auto info      = _read_data_packet_info(buff);
         bool seq_error = _is_out_of_sequence(std::get<1>(info));
 
+        if (seq_error and _flight_recorder) {
+            // One-shot post-mortem dump; the stream is already in error,
+            // so the file I/O cost here is acceptable
+            _flight_recorder->dump_on_error();
+        }
+
         return std::make_tuple(std::move(buff), std::get<0>(info), seq_error);
     }
 
@@ -215,6 +224,27 @@ public:
         _recv_io->release_recv_buff(std::move(buff));
     }
 
+    /*!
+     * Returns the recent flow control drop events recorded by this
+     * transport, oldest first. The channel field of each event is left for
+     * the streamer to fill in.
+     */
+    std::vector<stream_stats_t::fc_drop_event_t> get_fc_drop_events() const
+    {
+        return _fc_state.get_drop_events();
+    }
+
+    /*!
+     * Attaches a flight recorder that captures the header of every data
+     * packet this transport reads. On a sequence error, the recorded
+     * history is dumped automatically. Pass nullptr to detach; when no
+     * recorder is attached the packet path only pays a null check.
+     */
+    void set_flight_recorder(chdr_flight_recorder::sptr recorder)
+    {
+        _flight_recorder = std::move(recorder);
+    }
+
 private:
     /*!
      * Recv callback for I/O service
@@ -230,8 +260,12 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header   = _recv_packet_cb->get_chdr_header();
+        // All fields needed to classify the packet live in the first
+        // header word, for every CHDR width; read it with a single load
+        // instead of going through the virtual packet parser. The parser
+        // is only consulted for the rare stream command packets below.
+        const chdr::chdr_header header(
+            _u64_to_host(*reinterpret_cast<const uint64_t*>(buff->data())));
         const auto dst_epid = header.get_dst_epid();
 
         if (dst_epid != _epid) {
@@ -245,15 +279,22 @@ private:
         const auto packet_size_rounded = _round_pkt_size(header.get_length());
 
         if (type == chdr::PKT_TYPE_STRC) {
-            chdr::strc_payload strc;
-            strc.deserialize(_recv_packet_cb->get_payload_const_ptr_as<uint64_t>(),
+            // Use a view to avoid deserializing the payload in the receive
+            // path
+            _recv_packet_cb->refresh(buff->data());
+            const chdr::strc_payload_view strc(
+                _recv_packet_cb->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet_cb->get_payload_size() / sizeof(uint64_t),
-                _recv_packet_cb->conv_to_host<uint64_t>());
+                _recv_packet_cb->get_byte_order());
 
             const stream_buff_params_t strc_counts = {
-                strc.num_bytes, static_cast<uint32_t>(strc.num_pkts)};
+                strc.num_bytes(), static_cast<uint32_t>(strc.num_pkts())};
+
+            if (strc.op_code() == chdr::STRC_RESYNC) {
+                // Fold any credits deferred by the batched release path into
+                // the flow control state before comparing counts
+                _flush_fc_credits();
 
-            if (strc.op_code == chdr::STRC_RESYNC) {
                 // Resynchronize before updating fc_state, the strc payload
                 // contains counts before the strc packet itself
                 _fc_state.resynchronize(strc_counts);
@@ -279,6 +320,11 @@ private:
             // Update state that we received a packet
             _fc_state.data_received(packet_size_rounded);
 
+            // Remember the rounded size so the release path does not have to
+            // re-read the (by then cold) packet header to recover it
+            _fc_pkt_sizes[_fc_sizes_tail] = uint32_t(packet_size_rounded);
+            _fc_sizes_tail = (_fc_sizes_tail + 1) % _fc_pkt_sizes.size();
+
             // If this is a data packet, just claim it by returning true. The
             // I/O service will queue this packet in the recv_io_if.
             return true;
@@ -302,12 +348,33 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header        = _recv_packet_cb->get_chdr_header();
-        const size_t packet_size = _round_pkt_size(header.get_length());
+        // Data packets are released in arrival order, so the rounded size
+        // recorded by the recv callback is at the head of the ring
+        const size_t packet_size = _fc_pkt_sizes[_fc_sizes_head];
+        _fc_sizes_head           = (_fc_sizes_head + 1) % _fc_pkt_sizes.size();
         recv_link->release_recv_buff(std::move(buff));
-        _fc_state.xfer_done(packet_size);
-        _send_fc_response(send_link);
+
+        // Aggregate the freed credits and fold them into the flow control
+        // state once per batch, so a burst of releases results in at most
+        // one stream status response
+        _fc_pending.bytes += packet_size;
+        _fc_pending.packets++;
+        if (_fc_pending.packets >= FC_CREDIT_BATCH_SIZE) {
+            _flush_fc_credits();
+            _send_fc_response(send_link);
+        }
+    }
+
+    /*!
+     * Folds credits aggregated by the batched release path into the flow
+     * control state.
+     */
+    void _flush_fc_credits()
+    {
+        if (_fc_pending.packets != 0) {
+            _fc_state.xfer_done_batch(_fc_pending);
+            _fc_pending = {0, 0};
+        }
     }
 
     /*!
@@ -347,18 +414,36 @@ private:
      */
     std::tuple<packet_info_t, uint16_t> _read_data_packet_info(buff_t::uptr& buff)
     {
-        const void* data = buff->data();
-        _recv_packet->refresh(data);
-        const auto header        = _recv_packet->get_chdr_header();
-        const auto optional_time = _recv_packet->get_timestamp();
+        // Data packet headers are parsed with direct word loads rather than
+        // the virtual packet parser: the header is always the first 64-bit
+        // word, the timestamp (if any) the second, and the payload offset
+        // follows from the CHDR width fixed at construction
+        const uint64_t* data = reinterpret_cast<const uint64_t*>(buff->data());
+        const chdr::chdr_header header(_u64_to_host(data[0]));
+        const bool has_tsf =
+            header.get_pkt_type() == chdr::PKT_TYPE_DATA_WITH_TS;
+        const uint64_t tsf = has_tsf ? _u64_to_host(data[1]) : 0;
+
+        if (_flight_recorder) {
+            // Header-only capture, deliberately ahead of the length
+            // validation below so malformed packets also leave a trail
+            _flight_recorder->record(
+                header.pack(), tsf, has_tsf, chdr_flight_recorder::DIR_RX);
+        }
+
+        // Only 64-bit CHDR needs a second width word for the timestamp;
+        // wider widths carry it in the first
+        const size_t mdata_offset = (_chdr_w_bytes == 8 and has_tsf) ? 2 : 1;
+        const size_t pyld_offset =
+            (mdata_offset + header.get_num_mdata()) * _chdr_w_bytes;
 
         packet_info_t info;
         info.eob           = header.get_eob();
         info.eov           = header.get_eov();
-        info.has_tsf       = optional_time.is_initialized();
-        info.tsf           = optional_time ? *optional_time : 0;
-        info.payload_bytes = _recv_packet->get_payload_size();
-        info.payload       = _recv_packet->get_payload_const_ptr();
+        info.has_tsf       = has_tsf;
+        info.tsf           = tsf;
+        info.payload_bytes = header.get_length() - pyld_offset;
+        info.payload = reinterpret_cast<const uint8_t*>(buff->data()) + pyld_offset;
 
         const uint8_t* pkt_end =
             reinterpret_cast<uint8_t*>(buff->data()) + buff->packet_size();
@@ -373,27 +458,47 @@ private:
         return std::make_tuple(info, header.get_seq_num());
     }
 
+    inline uint64_t _u64_to_host(const uint64_t word) const
+    {
+        return (_endianness == ENDIANNESS_BIG) ? uhd::ntohx<uint64_t>(word)
+                                               : uhd::wtohx<uint64_t>(word);
+    }
+
     inline size_t _round_pkt_size(const size_t pkt_size_bytes)
     {
         return ((pkt_size_bytes + _chdr_w_bytes - 1) / _chdr_w_bytes) * _chdr_w_bytes;
     }
 
+    //! Number of released packets over which flow control credits are
+    //! aggregated before the shared counters are updated and a response is
+    //! considered. Matches the recv batch size of the kernel UDP link, and
+    //! is small against the flow control frequency, for which the headroom
+    //! already accounts.
+    static constexpr size_t FC_CREDIT_BATCH_SIZE = 16;
+
     // Interface to the I/O service
     transport::recv_io_if::sptr _recv_io;
 
     // Flow control state
     rx_flow_ctrl_state _fc_state;
 
+    // Ring of rounded sizes of the data packets queued between the recv
+    // callback and their release, in arrival order
+    std::vector<uint32_t> _fc_pkt_sizes;
+    size_t _fc_sizes_head = 0;
+    size_t _fc_sizes_tail = 0;
+
+    // Credits freed since the last update of _fc_state
+    stream_buff_params_t _fc_pending{0, 0};
+
     // Maximum data payload in bytes
     size_t _max_payload_size = 0;
 
     // Sequence number for data packets
     uint16_t _data_seq_num = 0;
 
-    // Packet for received data
-    chdr::chdr_packet::uptr _recv_packet;
-
-    // Packet for received data used in callbacks
+    // Packet parser for received stream command packets; data packet
+    // headers are parsed with direct word loads instead
     chdr::chdr_packet::uptr _recv_packet_cb;
 
     // Handles sending of strs flow control response packets
@@ -404,6 +509,12 @@ private:
 
     //! The CHDR width in bytes.
     size_t _chdr_w_bytes;
+
+    //! Byte order of the link
+    endianness_t _endianness = ENDIANNESS_LITTLE;
+
+    // Optional header capture ring for post-mortem analysis
+    chdr_flight_recorder::sptr _flight_recorder;
 };
 
 }} // namespace uhd::rfnoc
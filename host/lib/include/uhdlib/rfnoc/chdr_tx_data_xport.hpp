@@ -8,7 +8,9 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/types/metadata.hpp>
+#include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
 #include <uhdlib/rfnoc/chdr_packet.hpp>
 #include <uhdlib/rfnoc/chdr_types.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
@@ -46,6 +48,31 @@ public:
      */
     size_t send_strc_resync(
         transport::send_link_if* send_link, const stream_buff_params_t& counts)
+    {
+        return _send_strc(send_link, chdr::STRC_RESYNC, counts);
+    }
+
+    /*!
+     * Sends a flow control ping packet
+     *
+     * Sends a strc packet with the ping opcode to request an immediate
+     * stream status from the device, to refresh flow control credit before
+     * it is exhausted.
+     *
+     * \param send_link the link to use to send the packet
+     * \counts transfer counts for packet contents
+     */
+    size_t send_strc_ping(
+        transport::send_link_if* send_link, const stream_buff_params_t& counts)
+    {
+        return _send_strc(send_link, chdr::STRC_PING, counts);
+    }
+
+private:
+    //! Sends a strc packet with the given opcode and transfer counts
+    size_t _send_strc(transport::send_link_if* send_link,
+        const chdr::strc_op_code_t op_code,
+        const stream_buff_params_t& counts)
     {
         auto buff = send_link->get_send_buff(0);
         if (!buff) {
@@ -57,6 +84,7 @@ public:
         header.set_dst_epid(_dst_epid);
 
         chdr::strc_payload fc_payload(_fc_strc_pyld);
+        fc_payload.op_code   = op_code;
         fc_payload.num_bytes = counts.bytes;
         fc_payload.num_pkts  = counts.packets;
 
@@ -68,7 +96,6 @@ public:
         return size;
     }
 
-private:
     // Endpoint ID for recipient of flow control response
     const sep_id_t _dst_epid;
 
@@ -204,6 +231,18 @@ public:
         _enqueue_async_msg = fn;
     }
 
+    /*!
+     * Attaches a flight recorder that captures the header of every data
+     * packet this transport sends. When the device reports a sequence
+     * error, the recorded history is dumped automatically. Pass nullptr
+     * to detach; when no recorder is attached the packet path only pays
+     * a null check.
+     */
+    void set_flight_recorder(chdr_flight_recorder::sptr recorder)
+    {
+        _flight_recorder = std::move(recorder);
+    }
+
     /*!
      * Sends a TX data packet
      *
@@ -224,24 +263,43 @@ public:
     std::pair<void*, size_t> write_packet_header(
         buff_t::uptr& buff, const packet_info_t& info)
     {
-        uint64_t tsf = 0;
+        // The header template carries all static fields of this stream
+        // (destination EPID etc.); only the packet type, the burst/vector
+        // flags, the sequence number and the length change per packet, and
+        // they all live in the first header word. The header is therefore
+        // assembled in a register from the template and written with a
+        // single word store (plus one for the timestamp), instead of going
+        // through the virtual packet parser interface for every packet.
+        chdr::chdr_header header(_hdr_template);
+        const size_t pyld_offset = info.has_tsf ? _pyld_offset_with_ts
+                                                : _pyld_offset_no_ts;
+        const size_t length = pyld_offset + info.payload_bytes;
+
+        header.set_pkt_type(
+            info.has_tsf ? chdr::PKT_TYPE_DATA_WITH_TS : chdr::PKT_TYPE_DATA_NO_TS);
+        header.set_eob(info.eob);
+        header.set_eov(info.eov);
+        header.set_seq_num(_data_seq_num++);
+        header.set_length(length);
+
+        if (_flight_recorder) {
+            // Header-only capture of the outgoing packet
+            _flight_recorder->record(header.pack(),
+                info.tsf,
+                info.has_tsf,
+                chdr_flight_recorder::DIR_TX);
+        }
 
+        uint64_t* pkt_buff = reinterpret_cast<uint64_t*>(buff->data());
+        pkt_buff[0]        = _u64_from_host(header.pack());
         if (info.has_tsf) {
-            _send_header.set_pkt_type(chdr::PKT_TYPE_DATA_WITH_TS);
-            tsf = info.tsf;
-        } else {
-            _send_header.set_pkt_type(chdr::PKT_TYPE_DATA_NO_TS);
+            // In a uint64_t buffer, the timestamp is always immediately
+            // after the header, regardless of chdr_w
+            pkt_buff[1] = _u64_from_host(info.tsf);
         }
 
-        _send_header.set_eob(info.eob);
-        _send_header.set_eov(info.eov);
-        _send_header.set_seq_num(_data_seq_num++);
-
-        _send_packet->refresh(buff->data(), _send_header, tsf);
-        _send_packet->update_payload_size(info.payload_bytes);
-
-        return std::make_pair(_send_packet->get_payload_ptr(),
-            _send_packet->get_chdr_header().get_length());
+        return std::make_pair(
+            reinterpret_cast<char*>(buff->data()) + pyld_offset, length);
     }
 
 private:
@@ -269,18 +327,25 @@ private:
         }
 
         if (type == chdr::PKT_TYPE_STRS) {
-            chdr::strs_payload strs;
-            strs.deserialize(_recv_packet->get_payload_const_ptr_as<uint64_t>(),
+            // Use a view to avoid deserializing the payload on every flow
+            // control update
+            const chdr::strs_payload_view strs(
+                _recv_packet->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet->get_payload_size() / sizeof(uint64_t),
-                _recv_packet->conv_to_host<uint64_t>());
+                _recv_packet->get_byte_order());
 
             _fc_state.update_dest_recv_count(
-                {strs.xfer_count_bytes, static_cast<uint32_t>(strs.xfer_count_pkts)});
+                {strs.xfer_count_bytes(), static_cast<uint32_t>(strs.xfer_count_pkts())});
 
-            if (strs.status != chdr::STRS_OKAY) {
-                switch (strs.status) {
+            if (strs.status() != chdr::STRS_OKAY) {
+                switch (strs.status()) {
                     case chdr::STRS_SEQERR:
                         UHD_LOG_FASTPATH("S");
+                        if (_flight_recorder) {
+                            // One-shot post-mortem dump of the headers we
+                            // sent leading up to the reported error
+                            _flight_recorder->dump_on_error();
+                        }
                         if (_enqueue_async_msg) {
                             _enqueue_async_msg(
                                 async_metadata_t::EVENT_CODE_SEQ_ERROR, false, 0);
@@ -339,6 +404,18 @@ private:
             _fc_state.clear_fc_resync_req_pending();
             _fc_state.data_sent(strc_size);
         }
+
+        // When flow control credit runs low, prefetch a stream status so the
+        // refreshed counts arrive while the remaining credit is consumed,
+        // instead of stalling once it is exhausted
+        if (_fc_state.get_fc_ping_req_pending()
+            && _fc_state.dest_has_space(chdr::strc_payload::MAX_PACKET_SIZE)) {
+            const auto& xfer_counts = _fc_state.get_xfer_counts();
+            const size_t strc_size =
+                _round_pkt_size(_fc_sender.send_strc_ping(send_link, xfer_counts));
+            _fc_state.clear_fc_ping_req_pending();
+            _fc_state.data_sent(strc_size);
+        }
     }
 
     inline size_t _round_pkt_size(const size_t pkt_size_bytes)
@@ -346,6 +423,13 @@ private:
         return ((pkt_size_bytes + _chdr_w_bytes - 1) / _chdr_w_bytes) * _chdr_w_bytes;
     }
 
+    //! Converts a host word to the link byte order
+    inline uint64_t _u64_from_host(const uint64_t word) const
+    {
+        return (_endianness == ENDIANNESS_BIG) ? uhd::htonx<uint64_t>(word)
+                                               : uhd::htowx<uint64_t>(word);
+    }
+
     /*!
      * Flow control callback for I/O service
      *
@@ -374,11 +458,15 @@ private:
     // Sequence number for data packets
     uint16_t _data_seq_num = 0;
 
-    // Header to write into send packets
-    chdr::chdr_header _send_header;
+    // Header template for send packets, with all static fields prebaked
+    chdr::chdr_header _hdr_template;
 
-    // Packet for send data
-    chdr::chdr_packet::uptr _send_packet;
+    // Payload offsets in bytes for packets with and without a timestamp
+    size_t _pyld_offset_with_ts = 0;
+    size_t _pyld_offset_no_ts   = 0;
+
+    // Byte order of the link
+    endianness_t _endianness = ENDIANNESS_LITTLE;
 
     // Packet to receive strs messages
     chdr::chdr_packet::uptr _recv_packet;
@@ -397,6 +485,9 @@ private:
 
     //! The size of the send frame
     size_t _frame_size;
+
+    // Optional header capture ring for post-mortem analysis
+    chdr_flight_recorder::sptr _flight_recorder;
 };
 
 }} // namespace uhd::rfnoc
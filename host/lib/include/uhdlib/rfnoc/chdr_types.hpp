@@ -246,6 +246,8 @@ enum ctrl_opcode_t {
     OP_USER6       = 0xF,
 };
 
+class ctrl_payload_view;
+
 class ctrl_payload
 {
 public: // Members
@@ -359,6 +361,13 @@ private:
     static constexpr size_t STATUS_OFFSET      = 30;
     static constexpr size_t LO_DATA_OFFSET     = 0;
     static constexpr size_t HI_DATA_OFFSET     = 32;
+
+    // The view accesses the field offsets above
+    friend class ctrl_payload_view;
+
+public:
+    //! The allocation-free view type for this payload
+    using view_t = ctrl_payload_view;
 };
 
 //----------------------------------------------------
@@ -373,6 +382,8 @@ enum strs_status_t {
     STRS_RTERR   = 0x4, //! Unexpected destination (routing error)
 };
 
+class strs_payload_view;
+
 class strs_payload
 {
 public: // Members
@@ -464,6 +475,13 @@ private:
     static constexpr size_t XFER_COUNT_PKTS_OFFSET = 24;
     static constexpr size_t BUFF_INFO_OFFSET       = 0;
     static constexpr size_t STATUS_INFO_OFFSET     = 16;
+
+    // The view accesses the field offsets above
+    friend class strs_payload_view;
+
+public:
+    //! The allocation-free view type for this payload
+    using view_t = strs_payload_view;
 };
 
 //----------------------------------------------------
@@ -476,6 +494,8 @@ enum strc_op_code_t {
     STRC_RESYNC = 0x2, //! Re-synchronize flow control
 };
 
+class strc_payload_view;
+
 class strc_payload
 {
 public: // Members
@@ -557,6 +577,244 @@ private:
     static constexpr size_t OP_CODE_OFFSET  = 16;
     static constexpr size_t OP_DATA_OFFSET  = 20;
     static constexpr size_t NUM_PKTS_OFFSET = 24;
+
+    // The view accesses the field offsets above
+    friend class strc_payload_view;
+
+public:
+    //! The allocation-free view type for this payload
+    using view_t = strc_payload_view;
+};
+
+//----------------------------------------------------
+// CHDR Packet Payload Views
+//----------------------------------------------------
+
+/*! Base class for the allocation-free payload views below
+ *
+ * A view decodes payload fields straight out of the serialized packet buffer
+ * on every accessor call, instead of deserializing into owned storage like
+ * the payload classes above. This keeps hot paths (flow control handling,
+ * control-response routing) from exercising the allocator on every packet.
+ * The caller is responsible for passing in a payload buffer of the correct
+ * packet type, and the buffer must stay valid and unmodified for the
+ * lifetime of the view.
+ */
+class payload_view_base
+{
+protected:
+    payload_view_base(
+        const uint64_t* payload_buff, size_t num_elems, endianness_t byte_order)
+        : _payload_buff(payload_buff), _num_elems(num_elems), _byte_order(byte_order)
+    {
+    }
+
+    //! Return payload word \p idx in host byte order
+    inline uint64_t _word(size_t idx) const
+    {
+        return (_byte_order == uhd::ENDIANNESS_BIG)
+                   ? uhd::ntohx<uint64_t>(_payload_buff[idx])
+                   : uhd::wtohx<uint64_t>(_payload_buff[idx]);
+    }
+
+    //! Extract a field from a payload word
+    template <typename field_t>
+    static inline field_t _get_field(uint64_t word, size_t offset, size_t width)
+    {
+        return static_cast<field_t>((word >> offset) & ((uint64_t(1) << width) - 1));
+    }
+
+    const uint64_t* _payload_buff;
+    size_t _num_elems;
+    endianness_t _byte_order;
+};
+
+//! Allocation-free view into a serialized control payload (see ctrl_payload)
+class ctrl_payload_view : public payload_view_base
+{
+public:
+    ctrl_payload_view(
+        const uint64_t* payload_buff, size_t num_elems, endianness_t byte_order)
+        : payload_view_base(payload_buff, num_elems, byte_order)
+    {
+    }
+
+    inline uint16_t dst_port() const
+    {
+        return _get_field<uint16_t>(
+            _word(0), ctrl_payload::DST_PORT_OFFSET, ctrl_payload::DST_PORT_WIDTH);
+    }
+    inline uint16_t src_port() const
+    {
+        return _get_field<uint16_t>(
+            _word(0), ctrl_payload::SRC_PORT_OFFSET, ctrl_payload::SRC_PORT_WIDTH);
+    }
+    inline uint8_t seq_num() const
+    {
+        return _get_field<uint8_t>(
+            _word(0), ctrl_payload::SEQ_NUM_OFFSET, ctrl_payload::SEQ_NUM_WIDTH);
+    }
+    inline bool has_timestamp() const
+    {
+        return _get_field<bool>(
+            _word(0), ctrl_payload::HAS_TIME_OFFSET, ctrl_payload::HAS_TIME_WIDTH);
+    }
+    //! Only valid if has_timestamp() returns true
+    inline uint64_t timestamp() const
+    {
+        return _word(1);
+    }
+    inline bool is_ack() const
+    {
+        return _get_field<bool>(
+            _word(0), ctrl_payload::IS_ACK_OFFSET, ctrl_payload::IS_ACK_WIDTH);
+    }
+    inline uint16_t src_epid() const
+    {
+        return _get_field<uint16_t>(
+            _word(0), ctrl_payload::SRC_EPID_OFFSET, ctrl_payload::SRC_EPID_WIDTH);
+    }
+    inline uint32_t address() const
+    {
+        return _get_field<uint32_t>(_word(_op_word_idx()),
+            ctrl_payload::ADDRESS_OFFSET,
+            ctrl_payload::ADDRESS_WIDTH);
+    }
+    inline size_t num_data() const
+    {
+        return _get_field<size_t>(
+            _word(0), ctrl_payload::NUM_DATA_OFFSET, ctrl_payload::NUM_DATA_WIDTH);
+    }
+    //! Return data word \p idx, where idx must be less than num_data()
+    inline uint32_t data(size_t idx = 0) const
+    {
+        if (idx == 0) {
+            return _get_field<uint32_t>(
+                _word(_op_word_idx()), ctrl_payload::HI_DATA_OFFSET, 32);
+        }
+        const uint64_t data_word = _word(_op_word_idx() + ((idx + 1) / 2));
+        return _get_field<uint32_t>(data_word,
+            (idx % 2 == 1) ? ctrl_payload::LO_DATA_OFFSET : ctrl_payload::HI_DATA_OFFSET,
+            32);
+    }
+    inline uint8_t byte_enable() const
+    {
+        return _get_field<uint8_t>(_word(_op_word_idx()),
+            ctrl_payload::BYTE_ENABLE_OFFSET,
+            ctrl_payload::BYTE_ENABLE_WIDTH);
+    }
+    inline ctrl_opcode_t op_code() const
+    {
+        return _get_field<ctrl_opcode_t>(_word(_op_word_idx()),
+            ctrl_payload::OPCODE_OFFSET,
+            ctrl_payload::OPCODE_WIDTH);
+    }
+    inline ctrl_status_t status() const
+    {
+        return _get_field<ctrl_status_t>(_word(_op_word_idx()),
+            ctrl_payload::STATUS_OFFSET,
+            ctrl_payload::STATUS_WIDTH);
+    }
+
+private:
+    //! Index of the control operation word (the timestamp, if present, sits
+    //  between the control header and the operation word)
+    inline size_t _op_word_idx() const
+    {
+        return has_timestamp() ? 2 : 1;
+    }
+};
+
+//! Allocation-free view into a serialized stream status payload (see
+//  strs_payload)
+class strs_payload_view : public payload_view_base
+{
+public:
+    strs_payload_view(
+        const uint64_t* payload_buff, size_t num_elems, endianness_t byte_order)
+        : payload_view_base(payload_buff, num_elems, byte_order)
+    {
+    }
+
+    inline uint16_t src_epid() const
+    {
+        return _get_field<uint16_t>(
+            _word(0), strs_payload::SRC_EPID_OFFSET, strs_payload::SRC_EPID_WIDTH);
+    }
+    inline strs_status_t status() const
+    {
+        return _get_field<strs_status_t>(
+            _word(0), strs_payload::STATUS_OFFSET, strs_payload::STATUS_WIDTH);
+    }
+    inline uint64_t capacity_bytes() const
+    {
+        return _get_field<uint64_t>(_word(0),
+            strs_payload::CAPACITY_BYTES_OFFSET,
+            strs_payload::CAPACITY_BYTES_WIDTH);
+    }
+    inline uint32_t capacity_pkts() const
+    {
+        return _get_field<uint32_t>(_word(1),
+            strs_payload::CAPACITY_PKTS_OFFSET,
+            strs_payload::CAPACITY_PKTS_WIDTH);
+    }
+    inline uint64_t xfer_count_pkts() const
+    {
+        return _get_field<uint64_t>(_word(1),
+            strs_payload::XFER_COUNT_PKTS_OFFSET,
+            strs_payload::XFER_COUNT_PKTS_WIDTH);
+    }
+    inline uint64_t xfer_count_bytes() const
+    {
+        return _word(2);
+    }
+    inline uint16_t buff_info() const
+    {
+        return _get_field<uint16_t>(
+            _word(3), strs_payload::BUFF_INFO_OFFSET, strs_payload::BUFF_INFO_WIDTH);
+    }
+    inline uint64_t status_info() const
+    {
+        return _get_field<uint64_t>(
+            _word(3), strs_payload::STATUS_INFO_OFFSET, strs_payload::STATUS_INFO_WIDTH);
+    }
+};
+
+//! Allocation-free view into a serialized stream command payload (see
+//  strc_payload)
+class strc_payload_view : public payload_view_base
+{
+public:
+    strc_payload_view(
+        const uint64_t* payload_buff, size_t num_elems, endianness_t byte_order)
+        : payload_view_base(payload_buff, num_elems, byte_order)
+    {
+    }
+
+    inline uint16_t src_epid() const
+    {
+        return _get_field<uint16_t>(
+            _word(0), strc_payload::SRC_EPID_OFFSET, strc_payload::SRC_EPID_WIDTH);
+    }
+    inline strc_op_code_t op_code() const
+    {
+        return _get_field<strc_op_code_t>(
+            _word(0), strc_payload::OP_CODE_OFFSET, strc_payload::OP_CODE_WIDTH);
+    }
+    inline uint8_t op_data() const
+    {
+        return _get_field<uint8_t>(
+            _word(0), strc_payload::OP_DATA_OFFSET, strc_payload::OP_DATA_WIDTH);
+    }
+    inline uint64_t num_pkts() const
+    {
+        return _get_field<uint64_t>(
+            _word(0), strc_payload::NUM_PKTS_OFFSET, strc_payload::NUM_PKTS_WIDTH);
+    }
+    inline uint64_t num_bytes() const
+    {
+        return _word(1);
+    }
 };
 
 //----------------------------------------------------
@@ -666,6 +924,8 @@ public:
     }
     mgmt_op_t(const mgmt_op_t& rhs) = default;
 
+    mgmt_op_t& operator=(const mgmt_op_t& rhs) = default;
+
     //! Get the op-code for this transaction
     inline op_code_t get_op_code() const
     {
@@ -679,8 +939,8 @@ public:
     }
 
 private:
-    const op_code_t _op_code;
-    const payload_t _op_payload;
+    op_code_t _op_code;
+    payload_t _op_payload;
 };
 
 //! A class that represents a single management hop
@@ -699,6 +959,13 @@ public:
         _ops.push_back(op);
     }
 
+    //! Remove all operations from this hop. The underlying storage is
+    //  retained so the hop can be reused without reallocating.
+    inline void clear()
+    {
+        _ops.clear();
+    }
+
     //! Get the number of management operations in this hop
     inline size_t get_num_ops() const
     {
@@ -749,6 +1016,14 @@ public:
         _hops.push_back(hop);
     }
 
+    //! Remove all hops from this transaction. The underlying storage is
+    //  retained so the transaction object can be reused without
+    //  reallocating.
+    inline void clear()
+    {
+        _hops.clear();
+    }
+
     //! Get the number of management hops in this hop
     inline size_t get_num_hops() const
     {
@@ -13,6 +13,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace uhd { namespace rfnoc { namespace detail {
@@ -187,6 +188,16 @@ public:
      */
     void reset_chdr(uint16_t portno);
 
+    /*! Reset the CHDR and control logic of all block ports
+     *
+     * Equivalent to calling reset_chdr() and then reset_ctrl() on every
+     * block port, but the post-reset settling times are only waited once
+     * for all blocks rather than once per block.
+     *
+     * It is recommended to flush the ports before calling this.
+     */
+    void reset_all_blocks();
+
     /*! Get the port's configuration information
      *
      * \return Struct containing configuration information
@@ -206,8 +217,29 @@ private:
     uint16_t _num_edges;
     std::vector<edge_def_t> _adjacency_list;
 
+    //! Static (per-image) port registers, read once per port and then served
+    //  from this cache. The flush status flags live in the same register
+    //  space but are volatile and thus always read live.
+    struct static_port_info_t
+    {
+        uint32_t config_reg_val;
+        uint32_t noc_id;
+        uint32_t data_reg_val;
+    };
+    std::unordered_map<uint16_t, static_port_info_t> _static_port_info;
+
     std::vector<client_zero::edge_def_t> _get_adjacency_list();
 
+    /* Read (and cache) the static configuration registers of a port
+     *
+     * All three read registers of the port are fetched in one wide read the
+     * first time the port is queried; subsequent calls are served from the
+     * cache without touching the transport.
+     *
+     * \throws uhd::index_error if no NOC block is connected to the port
+     */
+    const static_port_info_t& _get_static_port_info(uint16_t portno);
+
     /* Helper function to determine if the given port number has a block connected
      *
      * \throws uhd::index_error if no NOC block is connected to the port
@@ -8,6 +8,7 @@
 
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -68,7 +69,10 @@ public:
 private:
     std::map<sep_addr_t, sep_id_t> _epid_map;
     std::map<sep_id_t, sep_addr_t> _addr_map;
-    sep_id_t _next_epid;
+    std::atomic<sep_id_t> _next_epid;
+    // The mutex only guards the lookup tables; endpoint initialization over
+    // the management portal runs without it so that allocations for
+    // independent links do not serialize on each other
     mutable std::mutex _mutex;
 };
 
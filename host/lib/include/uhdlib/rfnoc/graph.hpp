@@ -39,11 +39,16 @@ public:
      */
     void connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edge_info);
 
-    // void disconnect(node_ref_t src_node,
-    // node_ref_t dst_node,
-    // const size_t src_port,
-    // const size_t dst_port);
-    //
+    /*! Remove a node and all its edges from the graph
+     *
+     * After this function returns, the node is no longer part of property
+     * propagation or action delivery, and the graph holds no reference to
+     * it. This is used to tear down streamers without tearing down the
+     * session. If the node is not in the graph, this is a no-op.
+     *
+     * \param node A reference to the node to remove
+     */
+    void remove_node(node_ref_t node);
 
     /*! Commit graph and run initial checks
      *
@@ -191,9 +196,37 @@ private:
     void enqueue_action(
         node_ref_t src_node, res_source_info src_edge, action_info::sptr action);
 
+    /*! Enqueue a batch of actions for delivery in a single pass
+     *
+     * Like enqueue_action(), but all actions are put onto the action queue
+     * before delivery starts, and no other thread can interleave its own
+     * actions between them. A multi-channel stream command uses this to fan
+     * out to all chains back-to-back, which keeps the command arrival times
+     * at the individual radios tightly grouped.
+     *
+     * \param src_node Reference to the node where the post_actions() call is
+     *                 originating from
+     * \param actions Pairs of source edge and action, see enqueue_action()
+     */
+    void enqueue_actions(node_ref_t src_node,
+        const std::vector<std::pair<res_source_info, action_info::sptr>>& actions);
+
     /**************************************************************************
      * Private graph helpers
      *************************************************************************/
+    /*! Deliver all actions currently on the action queue
+     *
+     * This is the shared delivery loop of enqueue_action() and
+     * enqueue_actions(). It must only be called while holding _release_mutex
+     * and owning _action_handling_ongoing, and clears the latter when done.
+     * Delivered actions may enqueue follow-up actions, which are handled in
+     * the same loop.
+     *
+     * \throws uhd::runtime_error if it has to terminate an infinite cascade
+     *         of actions
+     */
+    void _process_action_queue();
+
     template <typename VertexContainerType>
     std::vector<node_ref_t> _vertices_to_nodes(VertexContainerType&& vertex_container)
     {
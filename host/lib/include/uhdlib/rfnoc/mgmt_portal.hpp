@@ -9,8 +9,10 @@
 #include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
 #include <uhdlib/rfnoc/chdr_packet.hpp>
 #include <uhdlib/rfnoc/chdr_types.hpp>
+#include <cstdint>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace uhd { namespace rfnoc { namespace mgmt {
 
@@ -197,6 +199,31 @@ public:
         xport_cfg_fn_t init_hop_cfg_fn,
         xport_cfg_fn_t rtcfg_hop_cfg_fn) = 0;
 
+    //! Export the topologies discovered by the management portals in this
+    //  process as a compact binary blob
+    //
+    //  A secondary process that attaches to hardware a primary session has
+    //  already walked (e.g. a read-only monitor) can feed the blob to
+    //  import_topology_cache() before it creates its session. Its portals
+    //  then skip the breadth-first crossbar discovery, including its
+    //  timeout-probing of unconnected ports, and only replay the fast
+    //  per-node initialization.
+    //
+    static std::vector<uint8_t> export_topology_cache();
+
+    //! Seed the topology cache of this process from a blob created by
+    //  export_topology_cache(), typically in another process
+    //
+    //  Must be called before the management portals are created to have an
+    //  effect. Importing a blob that does not match the attached hardware
+    //  is harmless: a stale entry is detected when the node initialization
+    //  is replayed, and a full discovery runs instead.
+    //
+    // \param blob The blob to import
+    // \throws uhd::value_error if the blob is malformed
+    //
+    static void import_topology_cache(const std::vector<uint8_t>& blob);
+
     //! Create an endpoint manager object
     //
     static uptr make(chdr_ctrl_xport& xport,
@@ -88,6 +88,16 @@ public:
         node->set_post_action_callback(std::move(post_handler));
     }
 
+    /*! Set the batched post action callback for the node
+     *
+     * See node_t::set_post_actions_callback() for details.
+     */
+    void set_post_actions_callback(
+        node_t* node, node_t::multi_action_handler_t&& post_handler)
+    {
+        node->set_post_actions_callback(std::move(post_handler));
+    }
+
     /*! Send an action to \p node
      *
      * This will call node_t::receive_action() (see that for details).
@@ -58,7 +58,11 @@ public:
     virtual void set_tx_antenna(const std::string& ant, const size_t chan);
     virtual void set_rx_antenna(const std::string& ant, const size_t chan);
     virtual double set_tx_frequency(const double freq, const size_t chan);
+    virtual std::future<double> set_tx_frequency_async(
+        const double freq, const size_t chan);
     virtual double set_rx_frequency(const double freq, const size_t chan);
+    virtual std::future<double> set_rx_frequency_async(
+        const double freq, const size_t chan);
     virtual void set_tx_tune_args(const uhd::device_addr_t&, const size_t chan);
     virtual void set_rx_tune_args(const uhd::device_addr_t&, const size_t chan);
     virtual double set_tx_gain(const double gain, const size_t chan);
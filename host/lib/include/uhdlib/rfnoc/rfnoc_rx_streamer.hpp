@@ -10,6 +10,7 @@
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <atomic>
+#include <functional>
 #include <string>
 
 namespace uhd { namespace rfnoc {
@@ -23,12 +24,29 @@ class rfnoc_rx_streamer : public node_t,
                           public transport::rx_streamer_impl<chdr_rx_data_xport>
 {
 public:
+    //! Callback used to query the current device time
+    using time_now_fn_t = std::function<uhd::time_spec_t()>;
+    //! Callback used to notify the graph that this streamer is going away
+    using disconnect_fn_t = std::function<void(const std::string&)>;
+
     /*! Constructor
      *
      * \param num_ports The number of ports
      * \param stream_args Arguments to aid the construction of the streamer
+     * \param disconnect_cb Callback to disconnect the streamer from the graph
+     *                      when it is destroyed, called with the unique ID
+     */
+    rfnoc_rx_streamer(const size_t num_ports,
+        const uhd::stream_args_t stream_args,
+        disconnect_fn_t disconnect_cb = nullptr);
+
+    /*! Destructor: disconnects this streamer from the graph
+     *
+     * Destroying a streamer releases its entire data plane (transports,
+     * offload threads, frame buffers) while the session stays up, so a
+     * standby receive chain can be parked cheaply and rebuilt quickly.
      */
-    rfnoc_rx_streamer(const size_t num_ports, const uhd::stream_args_t stream_args);
+    ~rfnoc_rx_streamer() override;
 
     /*! Returns a unique identifier string for this node. In every RFNoC graph,
      * no two nodes cannot have the same ID. Returns a string in the form of
@@ -58,6 +76,31 @@ public:
      */
     void issue_stream_cmd(const stream_cmd_t& stream_cmd);
 
+    /*! Implementation of rx_streamer API method
+     *
+     * Extends the streamer_impl version: before a channel is parked, a stop
+     * stream command is posted to its edge so the radio stops producing for
+     * it. The transport and graph connection stay warm, making a later
+     * re-enable (plus a fresh stream command) a sub-millisecond operation
+     * compared to recreating the streamer.
+     *
+     * \param channel the channel to enable or disable
+     * \param enabled false to park the channel, true to resume it
+     */
+    void set_channel_enabled(const size_t channel, const bool enabled);
+
+    /*! Provides a callback for querying the current device time
+     *
+     * When set, issue_stream_cmd() with a start time in the future converts
+     * the device-time gap into a host-time arrival estimate, and the next
+     * recv() sleeps until shortly before data is due instead of polling the
+     * transports through the whole gap. Without the callback, timed
+     * commands behave as before.
+     *
+     * \param time_now_fn callback returning the current device time
+     */
+    void set_time_now_fn(time_now_fn_t time_now_fn);
+
     /*! Returns stream args provided at creation
      *
      * \return stream args provided when streamer is created
@@ -107,8 +150,15 @@ private:
     // Stream args provided at construction
     const uhd::stream_args_t _stream_args;
 
+    // Callback to disconnect this streamer from the graph on destruction
+    const disconnect_fn_t _disconnect_cb;
+
     std::atomic<bool> _overrun_handling_mode{false};
     size_t _overrun_channel = 0;
+
+    // Callback to query the current device time, used to schedule the
+    // receive wakeup for timed stream commands
+    time_now_fn_t _time_now_fn;
 };
 
 }} // namespace uhd::rfnoc
@@ -10,6 +10,7 @@
 #include <uhdlib/rfnoc/chdr_tx_data_xport.hpp>
 #include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
 #include <uhdlib/transport/tx_streamer_impl.hpp>
+#include <functional>
 #include <string>
 
 namespace uhd { namespace rfnoc {
@@ -23,12 +24,27 @@ class rfnoc_tx_streamer : public node_t,
                           public transport::tx_streamer_impl<chdr_tx_data_xport>
 {
 public:
+    //! Callback used to notify the graph that this streamer is going away
+    using disconnect_fn_t = std::function<void(const std::string&)>;
+
     /*! Constructor
      *
      * \param num_ports The number of ports
      * \param stream_args Arguments to aid the construction of the streamer
+     * \param disconnect_cb Callback to disconnect the streamer from the graph
+     *                      when it is destroyed, called with the unique ID
      */
-    rfnoc_tx_streamer(const size_t num_chans, const uhd::stream_args_t stream_args);
+    rfnoc_tx_streamer(const size_t num_chans,
+        const uhd::stream_args_t stream_args,
+        disconnect_fn_t disconnect_cb = nullptr);
+
+    /*! Destructor: disconnects this streamer from the graph
+     *
+     * Destroying a streamer releases its entire data plane (transports,
+     * offload threads, frame buffers) while the session stays up, so a
+     * standby transmit chain can be parked cheaply and rebuilt quickly.
+     */
+    ~rfnoc_tx_streamer() override;
 
     /*! Returns a unique identifier string for this node. In every RFNoC graph,
      * no two nodes cannot have the same ID. Returns a string in the form of
@@ -109,6 +125,9 @@ private:
 
     // Stream args provided at construction
     const uhd::stream_args_t _stream_args;
+
+    // Callback to disconnect this streamer from the graph on destruction
+    const disconnect_fn_t _disconnect_cb;
 };
 
 }} // namespace uhd::rfnoc
@@ -6,8 +6,12 @@
 
 #pragma once
 
+#include <uhd/stream.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <chrono>
+#include <mutex>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -35,6 +39,27 @@ public:
             _xfer_counts.bytes += bytes_dropped;
             _xfer_counts.packets += pkts_dropped;
 
+            // Record the drop together with the credit state at the time it
+            // was detected so it can be examined through the streamer stats
+            stream_stats_t::fc_drop_event_t event;
+            event.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+            event.bytes_dropped   = bytes_dropped;
+            event.packets_dropped = pkts_dropped;
+            event.bytes_held      = counts.bytes - _xfer_counts.bytes;
+            event.xfer_bytes      = _xfer_counts.bytes;
+            event.xfer_packets    = _xfer_counts.packets;
+            {
+                // Drops are rare, so unlike the counters the event ring can
+                // afford a lock to make queries from another thread safe
+                std::lock_guard<std::mutex> lock(_drop_event_mutex);
+                if (_drop_events.size() >= stream_stats_t::MAX_FC_DROP_EVENTS) {
+                    _drop_events.erase(_drop_events.begin());
+                }
+                _drop_events.push_back(event);
+            }
+
             UHD_LOGGER_DEBUG("rx_flow_ctrl_state")
                 << "Flow control state mismatch: bytes reported: " << counts.bytes
                 << " bytes counted locally: " << _recv_counts.bytes
@@ -63,6 +88,13 @@ public:
         _xfer_counts.packets++;
     }
 
+    //! Update state when a batch of transfers is complete (buffer space freed)
+    void xfer_done_batch(const stream_buff_params_t counts)
+    {
+        _xfer_counts.bytes += counts.bytes;
+        _xfer_counts.packets += counts.packets;
+    }
+
     //! Returns whether a flow control response is needed
     bool fc_resp_due() const
     {
@@ -98,6 +130,15 @@ public:
         return _fc_freq;
     }
 
+    //! Returns the most recent drop events, oldest first. The channel field
+    //  is left at its default since this class does not know which streamer
+    //  channel the transport serves; the caller fills it in.
+    std::vector<stream_stats_t::fc_drop_event_t> get_drop_events() const
+    {
+        std::lock_guard<std::mutex> lock(_drop_event_mutex);
+        return _drop_events;
+    }
+
 private:
     // Counts for data received, including any data still in use
     stream_buff_params_t _recv_counts{0, 0};
@@ -111,6 +152,11 @@ private:
     // Frequency of flow control responses
     stream_buff_params_t _fc_freq{0, 0};
 
+    // Ring of the most recent drop events, oldest first; guarded by
+    // _drop_event_mutex since it is queried from outside the recv path
+    std::vector<stream_stats_t::fc_drop_event_t> _drop_events;
+    mutable std::mutex _drop_event_mutex;
+
     // Endpoint ID for log messages
     const sep_id_pair_t _epids;
 };
@@ -8,6 +8,8 @@
 
 #include <uhd/types/metadata.hpp>
 #include <boost/lockfree/queue.hpp>
+#include <atomic>
+#include <cstdint>
 
 namespace uhd { namespace rfnoc {
 
@@ -35,12 +37,25 @@ public:
     /*!
      *  Push an async message onto the queue
      *
+     * This never blocks or allocates, so it is safe to call from the I/O
+     * offload thread. If the queue is full, the message is dropped and
+     * counted instead.
+     *
      * \param async_metadata the metadata to be pushed
      */
     void enqueue(const async_metadata_t& async_metadata);
 
+    /*!
+     * Returns the number of async messages dropped because the queue was
+     * full when they were produced
+     */
+    uint64_t get_num_dropped() const;
+
 private:
     boost::lockfree::queue<async_metadata_t> _queue;
+
+    // Count of messages dropped on queue overflow
+    std::atomic<uint64_t> _num_dropped{0};
 };
 
 }} // namespace uhd::rfnoc
@@ -15,12 +15,18 @@ class tx_flow_ctrl_state
 {
 public:
     //! Constructor
-    tx_flow_ctrl_state(const stream_buff_params_t& capacity) : _dest_capacity(capacity) {}
+    tx_flow_ctrl_state(const stream_buff_params_t& capacity)
+        : _dest_capacity(capacity), _fc_ping_watermark(capacity.bytes / 8)
+    {
+    }
 
     //! Updates destination received count
     void update_dest_recv_count(const stream_buff_params_t& recv_count)
     {
         _recv_counts = recv_count;
+        // A stream status arrived, so a new ping may be requested the next
+        // time credit runs low
+        _fc_ping_outstanding = false;
     }
 
     /*! Returns whether the destination has buffer space for the requested
@@ -28,11 +34,7 @@ public:
      */
     bool dest_has_space(const size_t packet_size)
     {
-        // The stream endpoint only cares about bytes, the packet count is not
-        // important to determine the space available.
-        const auto buffer_fullness = _xfer_counts.bytes - _recv_counts.bytes;
-        const auto space_available = _dest_capacity.bytes - buffer_fullness;
-        return space_available >= packet_size;
+        return _space_available() >= packet_size;
     }
 
     //! Increments transfer count with amount of data sent
@@ -49,6 +51,32 @@ public:
         if (_xfer_counts.bytes - _last_fc_resync_bytes >= _dest_capacity.bytes) {
             _fc_resync_req = true;
         }
+
+        // Prefetch flow control credit: when the remaining credit falls below
+        // the watermark, request a stream status from the destination rather
+        // than waiting for credit to run out. The response is then in flight
+        // while the remaining credit is consumed, so the sender does not have
+        // to stall at the flow control window boundary. Only one ping is
+        // requested per stream status, to bound the overhead in steady state.
+        if (not _fc_ping_outstanding and _space_available() < _fc_ping_watermark) {
+            _fc_ping_req = true;
+        }
+    }
+
+    /*! Returns whether a flow control credit prefetch ping is pending. The
+     * ping asks the destination for an immediate stream status, and is
+     * requested when the remaining credit falls below the watermark.
+     */
+    bool get_fc_ping_req_pending() const
+    {
+        return _fc_ping_req;
+    }
+
+    //! Clears fc ping request pending status
+    void clear_fc_ping_req_pending()
+    {
+        _fc_ping_req         = false;
+        _fc_ping_outstanding = true;
     }
 
     /*! Returns whether an fc resync request is pending. The policy we use
@@ -74,6 +102,15 @@ public:
     }
 
 private:
+    //! Returns the buffer space currently available at the destination
+    size_t _space_available() const
+    {
+        // The stream endpoint only cares about bytes, the packet count is not
+        // important to determine the space available.
+        const auto buffer_fullness = _xfer_counts.bytes - _recv_counts.bytes;
+        return _dest_capacity.bytes - buffer_fullness;
+    }
+
     // Counts for data sent
     stream_buff_params_t _xfer_counts{0, 0};
 
@@ -83,11 +120,20 @@ private:
     // Buffer size at the destination
     stream_buff_params_t _dest_capacity{0, 0};
 
+    // Remaining credit below which a stream status is prefetched
+    const size_t _fc_ping_watermark;
+
     // Counts sent in last flow control resync
     size_t _last_fc_resync_bytes = 0;
 
     // Track when to send ack packets
     bool _fc_resync_req = false;
+
+    // Track when to prefetch a stream status
+    bool _fc_ping_req = false;
+
+    // Whether a ping was sent since the last stream status arrived
+    bool _fc_ping_outstanding = false;
 };
 
 }} // namespace uhd::rfnoc
@@ -20,11 +20,36 @@ public:
 
     adapter_id_t register_adapter(adapter_info& info);
 
+    /*! Records the discovered capabilities of an adapter
+     *
+     * Typically called by the link right after register_adapter. Capabilities
+     * registered for an already-known adapter are overwritten.
+     */
+    void register_capabilities(const adapter_id_t id, const adapter_caps_t& caps);
+
+    /*! Returns the capabilities recorded for an adapter
+     *
+     * If no capabilities were registered for the adapter, the returned
+     * struct has valid set to false.
+     */
+    adapter_caps_t get_capabilities(const adapter_id_t id);
+
 private:
     adapter_ctx() = default;
 
     std::mutex _mutex;
     std::unordered_map<std::string, adapter_id_t> _id_map;
+    std::unordered_map<adapter_id_t, adapter_caps_t> _caps_map;
 };
 
+/*! Discovers the capabilities of the adapter that owns a local IP address
+ *
+ * Resolves the interface holding local_addr and queries its offload
+ * configuration (checksum offload, GRO/GSO), queue counts and MTU via
+ * ethtool ioctls. Only implemented on Linux; elsewhere, and for addresses
+ * that cannot be resolved to an interface, the returned struct has valid
+ * set to false.
+ */
+adapter_caps_t discover_adapter_caps(const std::string& local_addr);
+
 }} // namespace uhd::transport
@@ -24,4 +24,36 @@ public:
     virtual std::string to_string() = 0;
 };
 
+/*! Capabilities of a network adapter, discovered from the OS
+ *
+ * All fields are best-effort: on platforms or interfaces where discovery is
+ * not supported, valid remains false and the other fields hold defaults.
+ */
+struct adapter_caps_t
+{
+    //! Whether the remaining fields were successfully discovered
+    bool valid = false;
+
+    //! Whether the NIC verifies receive checksums
+    bool rx_csum_offload = false;
+
+    //! Whether the NIC computes transmit checksums
+    bool tx_csum_offload = false;
+
+    //! Whether generic receive offload (coalescing) is enabled
+    bool gro_enabled = false;
+
+    //! Whether generic segmentation offload is enabled
+    bool gso_enabled = false;
+
+    //! Number of receive queues in use (including combined queues)
+    size_t num_rx_queues = 0;
+
+    //! Number of transmit queues in use (including combined queues)
+    size_t num_tx_queues = 0;
+
+    //! Configured interface MTU in bytes, or 0 if unknown
+    size_t mtu = 0;
+};
+
 }} // namespace uhd::transport
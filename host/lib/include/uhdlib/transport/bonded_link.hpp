@@ -0,0 +1,253 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Send link that stripes packets across multiple member links.
+ *
+ * Frame buffers are handed out from the member links in round-robin order,
+ * so consecutive packets of one stream leave through alternating physical
+ * ports and the aggregate bandwidth approaches the sum of the members.
+ *
+ * Both endpoints must support bonding for this to be usable: the receiving
+ * side sees the stream arrive interleaved across its ports, and packets may
+ * arrive slightly out of order, so the layer above the link must reorder by
+ * CHDR sequence number (see bonded_recv_link_t). The member links must
+ * terminate at the same remote entity, and flow control credit applies to
+ * the bonded link as a whole.
+ */
+class bonded_send_link_t : public send_link_if
+{
+public:
+    using sptr = std::shared_ptr<bonded_send_link_t>;
+
+    explicit bonded_send_link_t(const std::vector<send_link_if::sptr>& links)
+        : _links(links)
+    {
+        if (_links.empty()) {
+            throw uhd::value_error("bonded_send_link_t requires at least one link");
+        }
+        _frame_size = _links.front()->get_send_frame_size();
+        _num_frames = 0;
+        for (auto& link : _links) {
+            // The frame size must be uniform so that the MTU seen by the
+            // CHDR layer does not depend on which member a packet takes
+            if (link->get_send_frame_size() != _frame_size) {
+                throw uhd::value_error(
+                    "bonded_send_link_t: Member links have differing frame sizes");
+            }
+            _num_frames += link->get_num_send_frames();
+            _outstanding.push_back(0);
+        }
+    }
+
+    size_t get_num_send_frames() const override
+    {
+        return _num_frames;
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _frame_size;
+    }
+
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override
+    {
+        // Round-robin over the members, starting at the next one in line.
+        // Members whose frames are all outstanding are skipped (asking a
+        // link for more frames than it owns is a precondition violation),
+        // so a member stalled on its NIC does not stall the bonded link as
+        // long as another member has frames available.
+        const size_t preferred = _next_link;
+        _next_link             = (_next_link + 1) % _links.size();
+        for (size_t i = 0; i < _links.size(); i++) {
+            const size_t idx = (preferred + i) % _links.size();
+            if (_outstanding[idx] >= _links[idx]->get_num_send_frames()) {
+                continue;
+            }
+            auto buff = _links[idx]->get_send_buff(i == 0 ? timeout_ms : 0);
+            if (buff) {
+                _outstanding[idx]++;
+                _buff_owner[buff.get()] = idx;
+                return buff;
+            }
+        }
+        return nullptr;
+    }
+
+    void release_send_buff(frame_buff::uptr buff) override
+    {
+        auto owner_it = _buff_owner.find(buff.get());
+        UHD_ASSERT_THROW(owner_it != _buff_owner.end());
+        const size_t idx = owner_it->second;
+        _buff_owner.erase(owner_it);
+        _outstanding[idx]--;
+        _links[idx]->release_send_buff(std::move(buff));
+    }
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        // The bonded link spans adapters; report the first member's
+        return _links.front()->get_send_adapter_id();
+    }
+
+    bool supports_send_buff_out_of_order() const override
+    {
+        for (auto& link : _links) {
+            if (not link->supports_send_buff_out_of_order()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<send_link_if::sptr> _links;
+    size_t _frame_size;
+    size_t _num_frames;
+    //! Next member to hand out a frame from
+    size_t _next_link = 0;
+    //! Number of outstanding (acquired, unreleased) frames per member
+    std::vector<size_t> _outstanding;
+    //! Member index each outstanding frame buffer was acquired from
+    std::unordered_map<frame_buff*, size_t> _buff_owner;
+};
+
+/*!
+ * Recv link that merges packets arriving on multiple member links.
+ *
+ * Packets are returned in arrival order across all members. Because the
+ * members drain independently, packets of one stream can be returned out
+ * of order relative to their CHDR sequence numbers; the consuming
+ * transport must reorder (or tolerate reordering) within a window of
+ * roughly the members' frame counts.
+ */
+class bonded_recv_link_t : public recv_link_if
+{
+public:
+    using sptr = std::shared_ptr<bonded_recv_link_t>;
+
+    explicit bonded_recv_link_t(const std::vector<recv_link_if::sptr>& links)
+        : _links(links)
+    {
+        if (_links.empty()) {
+            throw uhd::value_error("bonded_recv_link_t requires at least one link");
+        }
+        _frame_size = _links.front()->get_recv_frame_size();
+        _num_frames = 0;
+        for (auto& link : _links) {
+            if (link->get_recv_frame_size() != _frame_size) {
+                throw uhd::value_error(
+                    "bonded_recv_link_t: Member links have differing frame sizes");
+            }
+            _num_frames += link->get_num_recv_frames();
+            _outstanding.push_back(0);
+        }
+    }
+
+    size_t get_num_recv_frames() const override
+    {
+        return _num_frames;
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _frame_size;
+    }
+
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
+    {
+        // Sweep all members without waiting first; members whose frames are
+        // all outstanding are skipped until the caller releases some.
+        for (size_t i = 0; i < _links.size(); i++) {
+            const size_t idx = (_next_link + i) % _links.size();
+            if (_outstanding[idx] >= _links[idx]->get_num_recv_frames()) {
+                continue;
+            }
+            auto buff = _links[idx]->get_recv_buff(0);
+            if (buff) {
+                _next_link = (idx + 1) % _links.size();
+                _outstanding[idx]++;
+                _buff_owner[buff.get()] = idx;
+                return buff;
+            }
+        }
+        if (timeout_ms == 0) {
+            return nullptr;
+        }
+        // Nothing pending: poll the members in slices of the timeout, so
+        // that the worst-case latency stays at the caller's timeout while
+        // every port still gets serviced
+        const int32_t slice_ms =
+            std::max<int32_t>(1, timeout_ms / int32_t(_links.size()));
+        int32_t remaining_ms = timeout_ms;
+        while (timeout_ms < 0 or remaining_ms > 0) {
+            const size_t idx = _next_link;
+            _next_link       = (_next_link + 1) % _links.size();
+            if (_outstanding[idx] >= _links[idx]->get_num_recv_frames()) {
+                continue;
+            }
+            auto buff = _links[idx]->get_recv_buff(slice_ms);
+            if (buff) {
+                _outstanding[idx]++;
+                _buff_owner[buff.get()] = idx;
+                return buff;
+            }
+            if (timeout_ms > 0) {
+                remaining_ms -= slice_ms;
+            }
+        }
+        return nullptr;
+    }
+
+    void release_recv_buff(frame_buff::uptr buff) override
+    {
+        auto owner_it = _buff_owner.find(buff.get());
+        UHD_ASSERT_THROW(owner_it != _buff_owner.end());
+        const size_t idx = owner_it->second;
+        _buff_owner.erase(owner_it);
+        _outstanding[idx]--;
+        _links[idx]->release_recv_buff(std::move(buff));
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _links.front()->get_recv_adapter_id();
+    }
+
+    bool supports_recv_buff_out_of_order() const override
+    {
+        for (auto& link : _links) {
+            if (not link->supports_recv_buff_out_of_order()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<recv_link_if::sptr> _links;
+    size_t _frame_size;
+    size_t _num_frames;
+    //! Next member to poll
+    size_t _next_link = 0;
+    //! Number of outstanding (acquired, unreleased) frames per member
+    std::vector<size_t> _outstanding;
+    //! Member index each outstanding frame buffer was acquired from
+    std::unordered_map<frame_buff*, size_t> _buff_owner;
+};
+
+}} // namespace uhd::transport
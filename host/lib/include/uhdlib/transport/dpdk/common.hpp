@@ -219,6 +219,22 @@ public:
         return _num_queues;
     }
 
+    /*! Whether the NIC computes UDP checksums on transmit
+     *
+     * When false, packets are sent with a zero (absent) UDP checksum
+     * rather than computing one in software.
+     */
+    inline bool get_tx_udp_cksum_offload() const
+    {
+        return _hw_udp_tx_cksum;
+    }
+
+    //! Whether the NIC validates UDP checksums on receive
+    inline bool get_rx_udp_cksum_offload() const
+    {
+        return _hw_udp_rx_cksum;
+    }
+
     /*! Getter for this port's RX packet buffer memory pool
      *
      * \return The RX packet buffer pool
@@ -255,6 +271,14 @@ public:
      */
     uint16_t alloc_udp_port(uint16_t udp_port);
 
+    /*!
+     * Allocate a TX DMA queue for a link, round-robin across the port's
+     * configured queues
+     *
+     * \return the queue ID to use for TX
+     */
+    queue_id_t alloc_queue();
+
 private:
     friend uhd::transport::dpdk_io_service;
 
@@ -271,11 +295,14 @@ private:
     struct ether_addr _mac_addr;
     ipv4_addr _ipv4;
     ipv4_addr _netmask;
+    bool _hw_udp_tx_cksum = false;
+    bool _hw_udp_rx_cksum = false;
 
     // Structures protected by mutex
     std::mutex _mutex;
     std::set<uint16_t> _udp_ports;
     uint16_t _next_udp_port = 0xffff;
+    queue_id_t _next_queue  = 0;
 
     // Structures protected by spin lock
     rte_spinlock_t _spinlock = RTE_SPINLOCK_INITIALIZER;
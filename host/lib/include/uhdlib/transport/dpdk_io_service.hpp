@@ -13,6 +13,8 @@
 #include <rte_ip.h>
 #include <rte_mbuf.h>
 #include <rte_udp.h>
+#include <stdint.h>
+#include <atomic>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -58,8 +60,45 @@ public:
         recv_link_if::sptr recv_link,
         size_t num_recv_frames,
         recv_callback_t recv_cb,
-        send_io_if::fc_callback_t fc_cb);
+        send_io_if::fc_callback_t fc_cb,
+        const bool high_priority = false);
 
+    /*! Snapshot of the I/O worker's loop accounting
+     *
+     * All counters are cumulative since the worker thread started.
+     */
+    struct stats_t
+    {
+        //! Total main-loop iterations
+        uint64_t iterations = 0;
+        //! Iterations that moved at least one packet or buffer
+        uint64_t busy_iterations = 0;
+        //! Packets received across all ports and RX queues
+        uint64_t rx_packets = 0;
+        //! Packets sent across all ports
+        uint64_t tx_packets = 0;
+        //! Number of non-empty RX bursts (rx_packets / rx_bursts = avg fill)
+        uint64_t rx_bursts = 0;
+        //! Number of non-empty TX bursts
+        uint64_t tx_bursts = 0;
+    };
+
+    /*! Get a snapshot of this service's worker accounting
+     *
+     * The counters are written only by the I/O worker lcore, so taking a
+     * snapshot is cheap and may lag the worker by at most one loop
+     * iteration. The busy/total iteration ratio shows how loaded the lcore
+     * is; comparing it across services is the data needed to repartition
+     * the NIC ports via the dpdk_lcore device args for asymmetric
+     * workloads.
+     */
+    stats_t get_stats() const;
+
+    //! Get the lcore whose worker thread services this object's ports
+    unsigned int get_lcore_id() const
+    {
+        return _lcore_id;
+    }
 
 private:
     friend class dpdk_recv_io;
@@ -222,6 +261,14 @@ private:
     //! Retry list for waking clients
     dpdk_io_if* _retry_head = NULL;
 
+    //! Worker loop accounting: written only by the I/O worker lcore
+    std::atomic<uint64_t> _stat_iterations{0};
+    std::atomic<uint64_t> _stat_busy_iterations{0};
+    std::atomic<uint64_t> _stat_rx_packets{0};
+    std::atomic<uint64_t> _stat_tx_packets{0};
+    std::atomic<uint64_t> _stat_rx_bursts{0};
+    std::atomic<uint64_t> _stat_tx_bursts{0};
+
     //! Mutex to protect below data structures
     std::mutex _mutex;
     //! The recv links attached to this I/O service (managed client side)
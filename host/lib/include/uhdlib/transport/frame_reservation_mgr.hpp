@@ -9,12 +9,19 @@
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 namespace uhd { namespace transport {
 
 /*!
  * Helper class to keep track of the number of frames reserved from a pair of links
+ *
+ * Reservation counts are atomic so that transports for independent links can
+ * be constructed and torn down concurrently. The internal mutex only guards
+ * the link tables themselves; the capacity check and reservation update are
+ * performed lock-free on the per-link counters.
  */
 class frame_reservation_mgr
 {
@@ -29,22 +36,27 @@ public:
 
     void register_link(const recv_link_if::sptr& recv_link)
     {
-        if (_recv_tbl[recv_link.get()] != 0) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _recv_tbl.find(recv_link.get());
+        if (it != _recv_tbl.end() && it->second.load() != 0) {
             throw uhd::runtime_error("Recv link already attached to I/O service");
         }
-        _recv_tbl[recv_link.get()] = 0;
+        _recv_tbl[recv_link.get()].store(0);
     }
 
     void register_link(const send_link_if::sptr& send_link)
     {
-        if (_send_tbl[send_link.get()] != 0) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _send_tbl.find(send_link.get());
+        if (it != _send_tbl.end() && it->second.load() != 0) {
             throw uhd::runtime_error("Send link already attached to I/O service");
         }
-        _send_tbl[send_link.get()] = 0;
+        _send_tbl[send_link.get()].store(0);
     }
 
     void unregister_link(const recv_link_if::sptr& recv_link)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         auto link_ptr = recv_link.get();
         UHD_ASSERT_THROW(_recv_tbl.count(link_ptr) != 0);
         _recv_tbl.erase(link_ptr);
@@ -52,6 +64,7 @@ public:
 
     void unregister_link(const send_link_if::sptr& send_link)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         auto link_ptr = send_link.get();
         UHD_ASSERT_THROW(_send_tbl.count(link_ptr) != 0);
         _send_tbl.erase(link_ptr);
@@ -60,48 +73,58 @@ public:
     void reserve_frames(const frame_reservation_t& reservation)
     {
         if (reservation.recv_link) {
-            const size_t rsvd_frames = _recv_tbl.at(reservation.recv_link.get());
-            const size_t capacity    = reservation.recv_link->get_num_recv_frames();
-            if (rsvd_frames + reservation.num_recv_frames > capacity) {
-                throw uhd::runtime_error(
-                    "Number of frames requested exceeds link recv frame capacity");
-            }
-
-            recv_link_if* link_ptr = reservation.recv_link.get();
-            _recv_tbl[link_ptr]    = rsvd_frames + reservation.num_recv_frames;
+            auto& rsvd_frames     = _get_entry(_recv_tbl, reservation.recv_link.get());
+            const size_t capacity = reservation.recv_link->get_num_recv_frames();
+            size_t cur_frames     = rsvd_frames.load();
+            do {
+                if (cur_frames + reservation.num_recv_frames > capacity) {
+                    throw uhd::runtime_error(
+                        "Number of frames requested exceeds link recv frame capacity");
+                }
+            } while (!rsvd_frames.compare_exchange_weak(
+                cur_frames, cur_frames + reservation.num_recv_frames));
         }
 
         if (reservation.send_link) {
-            const size_t rsvd_frames = _send_tbl.at(reservation.send_link.get());
-            const size_t capacity    = reservation.send_link->get_num_send_frames();
-            if (rsvd_frames + reservation.num_send_frames > capacity) {
-                throw uhd::runtime_error(
-                    "Number of frames requested exceeds link send frame capacity");
-            }
-
-            send_link_if* link_ptr = reservation.send_link.get();
-            _send_tbl[link_ptr]    = rsvd_frames + reservation.num_send_frames;
+            auto& rsvd_frames     = _get_entry(_send_tbl, reservation.send_link.get());
+            const size_t capacity = reservation.send_link->get_num_send_frames();
+            size_t cur_frames     = rsvd_frames.load();
+            do {
+                if (cur_frames + reservation.num_send_frames > capacity) {
+                    throw uhd::runtime_error(
+                        "Number of frames requested exceeds link send frame capacity");
+                }
+            } while (!rsvd_frames.compare_exchange_weak(
+                cur_frames, cur_frames + reservation.num_send_frames));
         }
     }
 
     void unreserve_frames(const frame_reservation_t& reservation)
     {
         if (reservation.recv_link) {
-            const size_t rsvd_frames = _recv_tbl.at(reservation.recv_link.get());
-            recv_link_if* link_ptr   = reservation.recv_link.get();
-            _recv_tbl[link_ptr]      = rsvd_frames - reservation.num_recv_frames;
+            _get_entry(_recv_tbl, reservation.recv_link.get())
+                .fetch_sub(reservation.num_recv_frames);
         }
 
         if (reservation.send_link) {
-            const size_t rsvd_frames = _send_tbl.at(reservation.send_link.get());
-            send_link_if* link_ptr   = reservation.send_link.get();
-            _send_tbl[link_ptr]      = rsvd_frames - reservation.num_send_frames;
+            _get_entry(_send_tbl, reservation.send_link.get())
+                .fetch_sub(reservation.num_send_frames);
         }
     }
 
 private:
-    std::unordered_map<recv_link_if*, size_t> _recv_tbl;
-    std::unordered_map<send_link_if*, size_t> _send_tbl;
+    // References into the tables remain valid while other links register and
+    // unregister, so the lock only has to cover the lookup itself
+    template <typename table_t, typename link_ptr_t>
+    std::atomic<size_t>& _get_entry(table_t& tbl, link_ptr_t link_ptr)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return tbl.at(link_ptr);
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<recv_link_if*, std::atomic<size_t>> _recv_tbl;
+    std::unordered_map<send_link_if*, std::atomic<size_t>> _send_tbl;
 };
 
 }} // namespace uhd::transport
@@ -8,16 +8,19 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
 
 namespace uhd { namespace transport {
 
-// Number of iterations that get_aligned_buffs will attempt to time align
-// packets before returning an alignment failure. get_aligned_buffs increments
-// the iteration count when it finds a timestamp that is larger than the
-// timestamps on channels it has already aligned and thus has to restart
-// aligning timestamps on all channels to the new timestamp.
+// Number of realignment passes that get_aligned_buffs will attempt before
+// returning an alignment failure. Each pass discards the packets that are
+// behind the largest timestamp seen and refetches those channels, so the
+// count only grows while the channels keep disagreeing.
 constexpr size_t ALIGNMENT_FAILURE_THRESHOLD = 1000;
 
 /*!
@@ -25,6 +28,16 @@ constexpr size_t ALIGNMENT_FAILURE_THRESHOLD = 1000;
  * transports for each channel and discards any packets whose tsf does not
  * match those of other channels due to dropped packets. Packets that do not
  * have a tsf are not checked for alignment and never dropped.
+ *
+ * The common case, where all channels already agree, is decided by a single
+ * reduction pass over the per-channel timestamps and one branch; the
+ * per-channel drop-and-refetch logic only runs when that pass detects a
+ * mismatch (e.g. while recovering from an overrun).
+ *
+ * Channels whose entry in the enabled mask is zero are skipped entirely:
+ * nothing is fetched for them and their (stale) packet info does not take
+ * part in the alignment. This lets the streamer park a subset of its
+ * channels without tearing down their transports.
  */
 template <typename transport_t, bool ignore_seq_err = false>
 class get_aligned_buffs
@@ -40,120 +53,162 @@ public:
 
     get_aligned_buffs(std::vector<typename transport_t::uptr>& xports,
         std::vector<typename transport_t::buff_t::uptr>& frame_buffs,
-        std::vector<typename transport_t::packet_info_t>& infos)
+        std::vector<typename transport_t::packet_info_t>& infos,
+        const std::vector<uint8_t>& chan_enabled)
         : _xports(xports)
         , _frame_buffs(frame_buffs)
         , _infos(infos)
+        , _chan_enabled(chan_enabled)
         , _prev_tsf(_xports.size(), 0)
-        , _channels_to_align(_xports.size())
     {
     }
 
     alignment_result_t operator()(const int32_t timeout_ms)
     {
-        // Clear state
-        _channels_to_align.set();
-        bool time_valid   = false;
-        uint64_t tsf      = 0;
-        size_t iterations = 0;
-
-        while (_channels_to_align.any()) {
-            const size_t chan = _channels_to_align.find_first();
-            auto& xport       = _xports[chan];
-            auto& info        = _infos[chan];
-            auto& frame_buff  = _frame_buffs[chan];
-            bool seq_error    = false;
-
-            // Receive a data packet for the channel if we don't have one. A
-            // packet may already be there if the previous call was interrupted
-            // by an error.
-            if (!frame_buff) {
-                try {
-                    std::tie(frame_buff, info, seq_error) =
-                        xport->get_recv_buff(timeout_ms);
-                } catch (const uhd::value_error& e) {
-                    // Bad packet
-                    UHD_LOGGER_ERROR("STREAMER")
-                        << boost::format(
-                               "The receive transport caught a value exception.\n%s")
-                               % e.what();
-                    return BAD_PACKET;
+        // Make sure every channel holds a packet. A packet may already be
+        // there if the previous call was interrupted by an error.
+        for (size_t chan = 0; chan < _xports.size(); chan++) {
+            if (!_chan_enabled[chan]) {
+                continue;
+            }
+            if (!_frame_buffs[chan]) {
+                const alignment_result_t result = _fetch_one(chan, timeout_ms);
+                if (result != SUCCESS) {
+                    return result;
                 }
             }
+        }
 
-            if (!frame_buff) {
-                return TIMEOUT;
-            }
+        // Fast path: one pass over the timestamps and one branch decide
+        // the already-aligned case
+        bool time_out_of_order;
+        uint64_t min_tsf, max_tsf;
+        size_t num_with_tsf = _scan_tsfs(time_out_of_order, min_tsf, max_tsf);
 
-            if (info.has_tsf) {
-                const bool time_out_of_order = _prev_tsf[chan] > info.tsf;
-                _prev_tsf[chan]              = info.tsf;
-
-                // If the user changes the device time while streaming, we can
-                // receive a packet that comes before the previous packet in
-                // time. This would cause the alignment logic to discard future
-                // received packets. Therefore, when this occurs, we reset the
-                // info to restart the alignment.
-                if (time_out_of_order) {
-                    time_valid = false;
-                }
+        if (num_with_tsf == 0 || (!time_out_of_order && min_tsf == max_tsf)) {
+            return SUCCESS;
+        }
 
-                // Check if the time is larger than packets received for other
-                // channels, and if so, use this time to align all channels
-                if (!time_valid || info.tsf > tsf) {
-                    // If we haven't found a set of aligned packets after many
-                    // iterations, return an alignment failure
-                    if (iterations++ > ALIGNMENT_FAILURE_THRESHOLD) {
-                        UHD_LOGGER_ERROR("STREAMER")
-                            << "The rx streamer failed to time-align packets.";
-                        return ALIGNMENT_FAILURE;
-                    }
+        // Slow path: some channel is behind the others, usually because it
+        // dropped packets during an overrun. Discard the stale packets and
+        // refetch those channels until all timestamps agree.
+        _num_realignments++;
+        size_t iterations = 0;
 
-                    // Release buffers for channels aligned previously. Keep
-                    // buffers that don't have a tsf since we don't need to
-                    // align those.
-                    for (size_t i = 0; i < _xports.size(); i++) {
-                        if (!_channels_to_align.test(i) && _infos[i].has_tsf) {
-                            _xports[i]->release_recv_buff(std::move(_frame_buffs[i]));
-                            _frame_buffs[i] = nullptr;
-                        }
-                    }
+        while (true) {
+            if (iterations++ > ALIGNMENT_FAILURE_THRESHOLD) {
+                UHD_LOGGER_ERROR("STREAMER")
+                    << "The rx streamer failed to time-align packets.";
+                return ALIGNMENT_FAILURE;
+            }
 
-                    // Mark only this channel as aligned and save its tsf
-                    _channels_to_align.set();
-                    _channels_to_align.reset(chan);
-                    time_valid = true;
-                    tsf        = info.tsf;
-                }
+            // Normally, channels behind the largest timestamp are the ones
+            // that dropped packets. However, if a timestamp went backwards,
+            // the user changed the device time while streaming; in that
+            // case drop all timed packets and restart the alignment at the
+            // new time rather than chasing the stale (larger) timestamps.
+            const uint64_t target = max_tsf;
 
-                // Check if the time matches that of other aligned channels
-                else if (info.tsf == tsf) {
-                    _channels_to_align.reset(chan);
+            for (size_t chan = 0; chan < _xports.size(); chan++) {
+                if (!_chan_enabled[chan]) {
+                    continue;
                 }
-
-                // Otherwise, time is smaller than other channels, release the buffer
-                else {
+                if (!_infos[chan].has_tsf) {
+                    // Packets without a tsf are never dropped
+                    continue;
+                }
+                if (time_out_of_order || _infos[chan].tsf != target) {
                     _xports[chan]->release_recv_buff(std::move(_frame_buffs[chan]));
                     _frame_buffs[chan] = nullptr;
+
+                    const alignment_result_t result = _fetch_one(chan, timeout_ms);
+                    if (result != SUCCESS) {
+                        return result;
+                    }
                 }
-            } else {
-                // Packet doesn't have a tsf, just mark it as aligned
-                _channels_to_align.reset(chan);
             }
 
-            // If this packet had a sequence error, stop to return the error.
-            // Keep the packet for the next call to get_aligned_buffs.
-            if (seq_error && !ignore_seq_err) {
-                UHD_LOG_FASTPATH("D");
-                return SEQUENCE_ERROR;
+            num_with_tsf = _scan_tsfs(time_out_of_order, min_tsf, max_tsf);
+
+            if (num_with_tsf == 0 || (!time_out_of_order && min_tsf == max_tsf)) {
+                return SUCCESS;
             }
         }
+    }
 
-        // All channels aligned
-        return SUCCESS;
+    //! Returns how often the slow realignment path has run
+    size_t get_num_realignments() const
+    {
+        return _num_realignments;
     }
 
 private:
+    /*!
+     * Receive one packet for the given channel, with the error mapping
+     * shared by the fast and realignment paths. On SUCCESS, the packet is
+     * stored in the channel's frame buffer slot.
+     */
+    alignment_result_t _fetch_one(const size_t chan, const int32_t timeout_ms)
+    {
+        bool seq_error = false;
+
+        try {
+            std::tie(_frame_buffs[chan], _infos[chan], seq_error) =
+                _xports[chan]->get_recv_buff(timeout_ms);
+        } catch (const uhd::value_error& e) {
+            // Bad packet
+            UHD_LOGGER_ERROR("STREAMER")
+                << boost::format("The receive transport caught a value exception.\n%s")
+                       % e.what();
+            return BAD_PACKET;
+        }
+
+        if (!_frame_buffs[chan]) {
+            return TIMEOUT;
+        }
+
+        // If this packet had a sequence error, stop to return the error.
+        // Keep the packet for the next call to get_aligned_buffs.
+        if (seq_error && !ignore_seq_err) {
+            UHD_LOG_FASTPATH("D");
+            return SEQUENCE_ERROR;
+        }
+
+        return SUCCESS;
+    }
+
+    /*!
+     * Single reduction pass over all channel timestamps. Returns the number
+     * of channels whose packets carry a tsf, and outputs the smallest and
+     * largest timestamps plus whether any channel's time went backwards
+     * relative to its previous packet (i.e. the device time was changed
+     * while streaming). The loop body is a plain min/max reduction so the
+     * compiler can vectorize it across channels.
+     */
+    size_t _scan_tsfs(bool& time_out_of_order, uint64_t& min_tsf, uint64_t& max_tsf)
+    {
+        time_out_of_order   = false;
+        min_tsf             = std::numeric_limits<uint64_t>::max();
+        max_tsf             = 0;
+        size_t num_with_tsf = 0;
+
+        for (size_t i = 0; i < _infos.size(); i++) {
+            if (!_chan_enabled[i]) {
+                continue;
+            }
+            const auto& info = _infos[i];
+            if (info.has_tsf) {
+                time_out_of_order |= (_prev_tsf[i] > info.tsf);
+                _prev_tsf[i] = info.tsf;
+                min_tsf      = std::min(min_tsf, info.tsf);
+                max_tsf      = std::max(max_tsf, info.tsf);
+                num_with_tsf++;
+            }
+        }
+
+        return num_with_tsf;
+    }
+
     // Transports for each channel
     std::vector<typename transport_t::uptr>& _xports;
 
@@ -163,11 +218,14 @@ private:
     // Packet info corresponding to aligned buffers
     std::vector<typename transport_t::packet_info_t>& _infos;
 
+    // Per-channel enabled mask; disabled channels are skipped entirely
+    const std::vector<uint8_t>& _chan_enabled;
+
     // Time of previous packet for each channel
     std::vector<uint64_t> _prev_tsf;
 
-    // Keeps track of channels that are aligned
-    boost::dynamic_bitset<> _channels_to_align;
+    // Number of times the slow realignment path has run
+    size_t _num_realignments = 0;
 };
 
 }} // namespace uhd::transport
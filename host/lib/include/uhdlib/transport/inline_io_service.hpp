@@ -20,15 +20,20 @@ class inline_recv_cb;
  * Note this is not an appropriate io_service to use with polling-mode drivers,
  * since such drivers require a thread to poll them and not block (i.e.
  * timeouts are not allowed at the link interface)
+ *
+ * With a nonzero recv_spin_budget, receive operations busy-poll the link
+ * instead of blocking in the socket layer, trading a core for minimum packet
+ * pickup latency. The budget is the number of non-blocking link polls between
+ * yields to the scheduler.
  */
 class inline_io_service : public virtual io_service,
                           public std::enable_shared_from_this<inline_io_service>
 {
 public:
     using sptr = std::shared_ptr<inline_io_service>;
-    static sptr make(void)
+    static sptr make(const size_t recv_spin_budget = 0)
     {
-        return sptr(new inline_io_service());
+        return sptr(new inline_io_service(recv_spin_budget));
     }
 
     ~inline_io_service();
@@ -52,13 +57,16 @@ public:
         recv_link_if::sptr recv_link,
         size_t num_recv_frames,
         recv_callback_t recv_cb,
-        send_io_if::fc_callback_t fc_cb);
+        send_io_if::fc_callback_t fc_cb,
+        const bool high_priority = false);
 
 private:
     friend class inline_recv_io;
     friend class inline_send_io;
 
-    inline_io_service()                         = default;
+    inline_io_service(const size_t recv_spin_budget) : _recv_spin_budget(recv_spin_budget)
+    {
+    }
     inline_io_service(const inline_io_service&) = delete;
 
     /*!
@@ -118,6 +126,10 @@ private:
     bool recv_flow_ctrl(
         inline_recv_cb* recv_io_cb, recv_link_if* recv_link, int32_t timeout_ms);
 
+    /* Number of non-blocking link polls between yields when busy-polling the
+     * recv links, or 0 to block in the link instead */
+    const size_t _recv_spin_budget;
+
     /* Track whether link is muxed and the callback */
     std::unordered_map<recv_link_if*, std::tuple<inline_recv_mux*, inline_recv_cb*>>
         _recv_tbl;
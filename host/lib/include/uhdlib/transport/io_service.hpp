@@ -326,6 +326,14 @@ public:
      * \param num_recv_frames Number of buffers to reserve in recv_link
      * \param recv_cb callback function for receiving packets from recv_link
      * \param fc_cb callback function to check if destination is ready for data
+     * \param high_priority whether this sender carries latency-sensitive
+     *                      (control-plane) traffic. When control and data
+     *                      share a link, I/O services with worker threads
+     *                      service high-priority senders ahead of data
+     *                      senders at packet boundaries, bounding command
+     *                      latency under full-rate streaming. I/O services
+     *                      that send inline in the caller's thread ignore
+     *                      this flag.
      * \return a send_io_if for interfacing with the link
      */
     virtual send_io_if::sptr make_send_client(send_link_if::sptr send_link,
@@ -334,7 +342,8 @@ public:
         recv_link_if::sptr recv_link,
         size_t num_recv_frames,
         recv_callback_t recv_cb,
-        send_io_if::fc_callback_t fc_cb) = 0;
+        send_io_if::fc_callback_t fc_cb,
+        const bool high_priority = false) = 0;
 
     /*!
      * Create a recv_io_if and registers the transport's callbacks.
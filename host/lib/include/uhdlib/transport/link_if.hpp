@@ -70,6 +70,43 @@ public:
     send_link_if& operator=(const send_link_if&) = delete;
 };
 
+/*!
+ * Extension interface for send links capable of scatter-gather I/O.
+ *
+ * A link implementing this interface can transmit a packet assembled from a
+ * header written into one of its frame buffers plus a payload residing in
+ * caller-owned memory. The kernel or NIC gathers the two pieces into one
+ * datagram, so the payload never has to be copied into the frame buffer.
+ * This allows header frames to come from a small pool while large payloads
+ * are referenced in place. Links advertise the extension by also deriving
+ * from this class; consumers discover it with a dynamic_cast.
+ */
+class sg_send_link_if
+{
+public:
+    using sptr = std::shared_ptr<sg_send_link_if>;
+
+    /*!
+     * Send a packet consisting of the contents of the frame buffer followed
+     * by the given payload, and release the buffer, allowing the link driver
+     * to reuse it. The packet size of the frame buffer must be set to the
+     * number of header bytes it holds. The payload memory is owned by the
+     * caller and is not referenced after this call returns.
+     *
+     * \param buff frame buffer containing the packet header
+     * \param payload pointer to the packet payload
+     * \param payload_size size of the payload in bytes
+     *
+     * Throws an exception if an I/O error occurs while sending
+     */
+    virtual void release_send_buff_sg(
+        frame_buff::uptr buff, const void* payload, const size_t payload_size) = 0;
+
+    sg_send_link_if()                       = default;
+    sg_send_link_if(const sg_send_link_if&) = delete;
+    sg_send_link_if& operator=(const sg_send_link_if&) = delete;
+};
+
 /*!
  * Link interface for receiving packets.
  */
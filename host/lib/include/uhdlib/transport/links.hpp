@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <uhd/transport/buffer_pool.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
 #include <tuple>
@@ -33,7 +34,63 @@ struct link_params_t
     size_t num_send_frames = 0;
     size_t recv_buff_size  = 0;
     size_t send_buff_size  = 0;
+    //! NUMA node on which to allocate the frame buffers, or -1 for no
+    //! placement control; should match the node of the NIC for this link
+    int numa_node = -1;
+    //! Back the frame buffers with 2 MB huge pages to reduce TLB pressure
+    bool use_hugepages = false;
+    //! Maximum transmit rate in bytes per second, or 0 to send unpaced. A
+    //! paced link shapes its bursts with a token bucket in front of the send
+    //! syscall so that shallow buffers in downstream switches are not
+    //! overflowed at line rate
+    size_t send_pacing_rate = 0;
+    //! Application-provided memory region to carve the receive frame
+    //! buffers out of (e.g., CUDA-pinned host memory for a zero-copy GPU
+    //! pipeline), or nullptr to let the link allocate its own memory. The
+    //! caller must keep the region valid for the lifetime of the link
+    void* recv_buff_mem = nullptr;
+    //! Size of the recv_buff_mem region in bytes
+    size_t recv_buff_mem_size = 0;
+    //! Like recv_buff_mem, but for the send frame buffers
+    void* send_buff_mem = nullptr;
+    //! Size of the send_buff_mem region in bytes
+    size_t send_buff_mem_size = 0;
 };
 
+/*! Create the receive frame buffer pool for a link
+ *
+ * Carves the pool out of the application-provided memory region if one was
+ * set in the link parameters, otherwise allocates link-owned memory.
+ */
+inline buffer_pool::sptr make_recv_buff_pool(const link_params_t& params)
+{
+    if (params.recv_buff_mem) {
+        return buffer_pool::make_external(params.recv_buff_mem,
+            params.recv_buff_mem_size,
+            params.num_recv_frames,
+            params.recv_frame_size);
+    }
+    return buffer_pool::make(params.num_recv_frames,
+        params.recv_frame_size,
+        16,
+        params.numa_node,
+        params.use_hugepages);
+}
+
+//! Like make_recv_buff_pool(), but for the send frame buffers
+inline buffer_pool::sptr make_send_buff_pool(const link_params_t& params)
+{
+    if (params.send_buff_mem) {
+        return buffer_pool::make_external(params.send_buff_mem,
+            params.send_buff_mem_size,
+            params.num_send_frames,
+            params.send_frame_size);
+    }
+    return buffer_pool::make(params.num_send_frames,
+        params.send_frame_size,
+        16,
+        params.numa_node,
+        params.use_hugepages);
+}
 
 }} // namespace uhd::transport
@@ -161,6 +161,12 @@ private:
         const size_t length = elems_acquired * sizeof(fifo_data_t);
 
         if (nirio_status_not_fatal(status)) {
+            if (length == 0) {
+                // Nothing was ready: hand any deferred grants back to the
+                // DMA engine so it has buffer space to land new frames
+                // before we poll again
+                _flush_pending_recv_grants();
+            }
             return length;
         } else if (status == NiRio_Status_CommunicationTimeout) {
             nirio_status_to_exception(status, "NI-RIO PCIe data transfer failed.");
@@ -170,7 +176,22 @@ private:
 
     UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& /*buff*/)
     {
-        _recv_fifo->release(_link_params.recv_frame_size / sizeof(fifo_data_t));
+        // Defer the kernel grant so several frames go back per ioctl.
+        // Frames are released in ring order (see
+        // supports_recv_buff_out_of_order), so one grant covers them all.
+        if (++_recv_frames_pending_release >= _recv_release_batch) {
+            _flush_pending_recv_grants();
+        }
+    }
+
+    //! Grant all deferred recv frames back to the DMA engine in one ioctl
+    UHD_FORCE_INLINE void _flush_pending_recv_grants()
+    {
+        if (_recv_frames_pending_release > 0) {
+            _recv_fifo->release(_recv_frames_pending_release
+                                * (_link_params.recv_frame_size / sizeof(fifo_data_t)));
+            _recv_frames_pending_release = 0;
+        }
     }
 
     // Methods called by send_link_base
@@ -215,6 +236,11 @@ private:
 
     const link_params_t _link_params;
 
+    //! Number of released recv frames accumulated before one batched grant
+    const size_t _recv_release_batch;
+    //! Released recv frames whose grant ioctl has been deferred
+    size_t _recv_frames_pending_release = 0;
+
     std::vector<nirio_frame_buff> _recv_buffs;
     std::vector<nirio_frame_buff> _send_buffs;
 
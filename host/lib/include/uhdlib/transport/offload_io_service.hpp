@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <uhd/transport/adapter_id.hpp>
 #include <uhdlib/transport/io_service.hpp>
+#include <boost/optional.hpp>
+#include <map>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -23,7 +26,7 @@ class offload_io_service : public io_service
 public:
     enum client_type_t { RECV_ONLY, SEND_ONLY, BOTH_SEND_AND_RECV };
 
-    enum wait_mode_t { POLL, BLOCK };
+    enum wait_mode_t { POLL, BLOCK, ADAPTIVE };
 
     /*!
      * Options for configuring offload I/O service
@@ -31,20 +34,50 @@ public:
     struct params_t
     {
         //! Array of CPU numbers to which to affinitize the offload thread.
+        //! When multiple worker threads are configured, this list applies to
+        //! every worker that has no entry in worker_cpu_affinity.
         std::vector<size_t> cpu_affinity_list;
         //! The types of client that the I/O service needs to support.
         client_type_t client_type = BOTH_SEND_AND_RECV;
         //! The thread behavior when waiting for incoming packets If set to
         //! BLOCK, the client type must be set to either RECV_ONLY or SEND_ONLY.
+        //! ADAPTIVE polls while there is work and backs off into sleeps once
+        //! the links go idle; it supports any client type.
         wait_mode_t wait_mode = POLL;
+        //! Number of idle loop iterations to busy-spin before backing off to
+        //! sleeps, when wait_mode is ADAPTIVE. While spinning, reaction to a
+        //! new burst is the same as with POLL.
+        size_t adaptive_spin_count = 10000;
+        //! Number of offload worker threads. Each attached link is serviced
+        //! by exactly one worker, so links on different workers never
+        //! serialize through the same event loop.
+        size_t num_worker_threads = 1;
+        //! Array of CPU numbers to which to affinitize each worker thread.
+        //! Entry i applies to worker i; workers beyond the end of the array
+        //! fall back to cpu_affinity_list.
+        std::vector<std::vector<size_t>> worker_cpu_affinity;
+        //! Scheduling priority for the worker threads, between -1 (lowest)
+        //! and +1 (highest), applied by each worker before it enters its
+        //! work loop. When unset, the threads inherit the scheduler settings
+        //! of the thread that created the I/O service.
+        boost::optional<double> thread_priority;
+        //! Use a realtime (round-robin) scheduling policy for the worker
+        //! threads. Only used when thread_priority is set.
+        bool realtime_priority = false;
+        //! Explicit assignment of links to workers, keyed by the link's
+        //! transport adapter ID so that both directions of one NIC port land
+        //! on the same worker. Adapters not listed here are distributed
+        //! round-robin over the workers as they first attach.
+        std::map<adapter_id_t, size_t> worker_assignment;
     };
 
     /*!
-     * Creates an io service that offloads I/O to a worker thread and
-     * passes configuration parameters to it.
+     * Creates an io service that offloads I/O to one or more worker threads
+     * and passes configuration parameters to it.
      *
-     *  \param io_srv The io service to perform the actual work in the worker
-     *                thread.
+     *  \param io_srv The io service to perform the actual work in the first
+     *                worker thread. Additional workers each run their own
+     *                inline I/O service.
      *  \param params Parameters to pass to the offload I/O service.
      *  \return A composite I/O service that executes the provided io service
      *          in its own thread.
@@ -48,6 +48,12 @@ static frame_buff::uptr client_get_buff(pop_func_t pop, const int32_t timeout_ms
 
 /*!
  * Recv I/O client for offload I/O service
+ *
+ * Fast-path guarantee: get_recv_buff and release_recv_buff only operate
+ * on the client port's lock-free SPSC queues and never take a mutex, so
+ * a streamer calling recv() cannot be blocked by the offload thread (or
+ * any other thread) holding a lock. The only mutex use in this class is
+ * the connect/disconnect handshake in the destructor.
  */
 template <typename io_service_t, bool polling>
 class offload_recv_io : public recv_io_if
@@ -107,6 +113,9 @@ private:
 
 /*!
  * Send I/O client for offload I/O service
+ *
+ * The same fast-path guarantee as offload_recv_io applies: get_send_buff
+ * and release_send_buff never take a mutex.
  */
 template <typename io_service_t, bool polling>
 class offload_send_io : public send_io_if
@@ -13,11 +13,25 @@
 #include <uhd/types/endianness.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/rx_streamer_zero_copy.hpp>
+#include <uhdlib/utils/tick_converter.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace uhd { namespace transport {
 
+// How long before the scheduled arrival of data recv() wakes up from a
+// scheduled-start sleep, to cover OS wakeup jitter and wire latency before
+// switching to the regular polling path
+constexpr int64_t SCHEDULED_START_GUARD_NS = 1000000;
+
 namespace detail {
 
 /*!
@@ -74,7 +88,9 @@ class rx_streamer_impl : public rx_streamer
 public:
     //! Constructor
     rx_streamer_impl(const size_t num_ports, const uhd::stream_args_t stream_args)
-        : _zero_copy_streamer(num_ports), _in_buffs(num_ports)
+        : _zero_copy_streamer(num_ports)
+        , _in_buffs(num_ports)
+        , _num_enabled_chans(num_ports)
     {
         if (stream_args.cpu_format.empty()) {
             throw uhd::value_error("[rx_stream] Must provide a cpu_format!");
@@ -90,6 +106,51 @@ public:
             _spp = stream_args.args.cast<size_t>("spp", _spp);
             _mtu = _spp * _convert_info.bytes_per_otw_item;
         }
+
+        if (stream_args.args.has_key("tolerate_seq_error")) {
+            _zero_copy_streamer.set_tolerate_seq_errors(
+                stream_args.args.cast<bool>("tolerate_seq_error", false));
+        }
+
+        // Opt-in link liveness watchdog: mid-burst silence beyond this many
+        // milliseconds turns a recv timeout into ERROR_CODE_LINK_DOWN
+        if (stream_args.args.has_key("link_timeout_ms")) {
+            _zero_copy_streamer.set_link_liveness_timeout(
+                stream_args.args.cast<int32_t>("link_timeout_ms", 0));
+        }
+
+        if (stream_args.args.has_key("aggregate_bursts")) {
+            _aggregate_bursts = std::max<size_t>(
+                1, stream_args.args.cast<size_t>("aggregate_bursts", 1));
+        }
+
+        // Parallel conversion: fan the per-channel conversions of a chunk
+        // out over a small pool so wide streamers do not convert serially
+        // on the calling thread. The pool size includes the caller, so
+        // convert_threads=N spawns N-1 workers.
+        const size_t convert_threads = std::min(
+            stream_args.args.cast<size_t>("convert_threads", 1), num_ports);
+        if (convert_threads > 1) {
+            _conv_num_out.resize(num_ports, 0);
+            _conv_pool_enabled = true;
+            for (size_t i = 0; i < convert_threads - 1; i++) {
+                _conv_pool.emplace_back([this]() { _conv_worker_loop(); });
+            }
+        }
+    }
+
+    ~rx_streamer_impl() override
+    {
+        if (not _conv_pool.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(_conv_mutex);
+                _conv_shutdown = true;
+                _conv_cv.notify_all();
+            }
+            for (auto& worker : _conv_pool) {
+                worker.join();
+            }
+        }
     }
 
     //! Connect a new channel to the streamer
@@ -117,6 +178,99 @@ public:
         return _spp;
     }
 
+    /*! Implementation of rx_streamer API method
+     *
+     * Parks or resumes a member channel without tearing down its transport.
+     * While a channel is disabled, its section of the output buffer is left
+     * untouched by recv() and recv_buffs() returns a nullptr for it.
+     */
+    void set_channel_enabled(const size_t channel, const bool enabled)
+    {
+        // A mode switch in the middle of a packet would scramble the
+        // fragment bookkeeping, so require the streamer to be quiescent
+        if (_buff_samps_remaining != 0 or _borrowed_buffs) {
+            throw uhd::runtime_error(
+                "[rx_stream] set_channel_enabled() called while packet buffers "
+                "are still in flight");
+        }
+
+        _zero_copy_streamer.set_channel_enabled(channel, enabled);
+        _num_enabled_chans = _zero_copy_streamer.get_num_enabled_channels();
+
+        // Null the stale input pointer so the conversion loop skips the
+        // channel without consulting the mask
+        if (not enabled) {
+            _in_buffs[channel] = nullptr;
+        }
+    }
+
+    //! Implementation of rx_streamer API method
+    bool is_channel_enabled(const size_t channel) const
+    {
+        return _zero_copy_streamer.is_channel_enabled(channel);
+    }
+
+    /*! Implementation of rx_streamer API method
+     *
+     * Stores the per-channel correction terms; the conversion path applies
+     * them to each packet right after format conversion, while the samples
+     * are still cache resident.
+     */
+    void set_iq_correction(const size_t channel,
+        const std::complex<double> gain,
+        const std::complex<double> offset)
+    {
+        if (channel >= get_num_channels()) {
+            throw uhd::index_error(
+                "Channel number indexes beyond the number of streamer ports");
+        }
+
+        const bool enabled = gain != std::complex<double>(1.0, 0.0)
+                             or offset != std::complex<double>(0.0, 0.0);
+
+        // The correction runs on converted samples, so it needs a format
+        // the math can be done in without clipping or quantization
+        if (enabled and not(_cpu_is_fc32 or _cpu_is_fc64)) {
+            throw uhd::value_error(
+                "[rx_stream] Host-side IQ correction requires a complex "
+                "floating point cpu_format (fc32 or fc64)");
+        }
+
+        _iq_corr[channel].gain    = gain;
+        _iq_corr[channel].offset  = offset;
+        _iq_corr[channel].enabled = enabled;
+        _iq_corr_any = std::any_of(_iq_corr.begin(),
+            _iq_corr.end(),
+            [](const iq_corr_t& corr) { return corr.enabled; });
+    }
+
+    /*! Implementation of rx_streamer API method
+     *
+     * The processor runs on each packet right after format conversion,
+     * reading the converted samples from a scratch buffer and writing its
+     * output into the caller's recv() buffer.
+     */
+    void set_postproc(const size_t channel, rx_postproc::sptr postproc)
+    {
+        if (channel >= get_num_channels()) {
+            throw uhd::index_error(
+                "Channel number indexes beyond the number of streamer ports");
+        }
+
+        // Attaching mid-packet would scramble the fragment bookkeeping, so
+        // require the streamer to be quiescent
+        if (_buff_samps_remaining != 0 or _borrowed_buffs) {
+            throw uhd::runtime_error(
+                "[rx_stream] set_postproc() called while packet buffers are "
+                "still in flight");
+        }
+
+        _postprocs[channel] = postproc;
+        _postproc_any       = std::any_of(_postprocs.begin(),
+            _postprocs.end(),
+            [](const rx_postproc::sptr& proc) { return bool(proc); });
+    }
+
     /*! Get width of each over-the-wire item component. For complex items,
      *  returns the width of one component only (real or imaginary).
      */
@@ -132,18 +286,121 @@ public:
         const double timeout,
         const bool one_packet)
     {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        const size_t num_samps =
+            _recv(buffs, nsamps_per_buff, metadata, timeout, one_packet);
+
+        _stats.num_calls++;
+        if (metadata.error_code == rx_metadata_t::ERROR_CODE_OVERFLOW
+            and metadata.out_of_sequence) {
+            _stats.num_seq_errors++;
+        }
+        _record_call_time(
+            start_time, metadata.error_code == rx_metadata_t::ERROR_CODE_TIMEOUT);
+
+        return num_samps;
+    }
+
+    //! Implementation of rx_streamer API method
+    size_t recv_buffs(std::vector<const void*>& buffs,
+        uhd::rx_metadata_t& metadata,
+        const double timeout)
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
         if (_error_metadata_cache.check(metadata)) {
             return 0;
         }
 
-        const int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
+        // The borrowed payloads are whole packets, so they cannot be
+        // interleaved with a partially read packet from recv(), nor can a
+        // second set be borrowed while the first is still outstanding
+        if (_buff_samps_remaining != 0 or _borrowed_buffs) {
+            throw uhd::runtime_error(
+                "[rx_stream] recv_buffs() called while packet buffers from a "
+                "previous call are still in flight");
+        }
+
+        buffs.resize(get_num_channels());
+
+        int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
+
+        // Sleep out the gap until a pending timed stream command is due,
+        // like recv() does
+        const int64_t sched_ns = _scheduled_start_ns.exchange(0);
+        if (sched_ns != 0) {
+            timeout_ms = _wait_for_scheduled_start(sched_ns, timeout_ms);
+        }
+
+        detail::eov_data_wrapper eov_positions(metadata);
+
+        const size_t num_samps = _zero_copy_streamer.get_recv_buffs(
+            buffs, metadata, eov_positions, timeout_ms);
+
+        _borrowed_buffs = (num_samps != 0);
+
+        _stats.num_calls++;
+        if (num_samps != 0) {
+            _stats.num_packets += _num_enabled_chans;
+            _stats.num_bytes +=
+                num_samps * _convert_info.bytes_per_otw_item * _num_enabled_chans;
+        }
+        _record_call_time(
+            start_time, metadata.error_code == rx_metadata_t::ERROR_CODE_TIMEOUT);
+
+        return num_samps;
+    }
+
+    //! Implementation of rx_streamer API method
+    void release_recv_buffs()
+    {
+        if (not _borrowed_buffs) {
+            return;
+        }
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            _zero_copy_streamer.release_recv_buff(i);
+        }
+        _borrowed_buffs = false;
+    }
+
+    //! Implementation of rx_streamer API method
+    stream_stats_t get_stream_stats() const
+    {
+        stream_stats_t stats         = _stats;
+        stats.num_ts_discontinuities = _zero_copy_streamer.get_num_ts_discontinuities();
+        _zero_copy_streamer.get_fc_drop_events(stats.fc_drop_events);
+        return stats;
+    }
+
+private:
+    //! Body of recv(), wrapped so the public method can update statistics
+    UHD_FORCE_INLINE size_t _recv(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const double timeout,
+        const bool one_packet)
+    {
+        if (_error_metadata_cache.check(metadata)) {
+            return 0;
+        }
+
+        int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
+
+        // If a timed stream command is pending, nothing can arrive before
+        // its start time, so sleep out the gap instead of burning the core
+        // in speculative polling
+        const int64_t sched_ns = _scheduled_start_ns.exchange(0);
+        if (sched_ns != 0) {
+            timeout_ms = _wait_for_scheduled_start(sched_ns, timeout_ms);
+        }
 
         detail::eov_data_wrapper eov_positions(metadata);
 
         size_t total_samps_recv =
             _recv_one_packet(buffs, nsamps_per_buff, metadata, eov_positions, timeout_ms);
 
-        if (one_packet or metadata.end_of_burst
+        if (one_packet
             or (eov_positions.data() and eov_positions.remaining() == 0)) {
             return total_samps_recv;
         }
@@ -153,6 +410,16 @@ public:
             return total_samps_recv;
         }
 
+        size_t bursts_recv = 0;
+        if (metadata.end_of_burst) {
+            if (++bursts_recv >= _aggregate_bursts) {
+                return total_samps_recv;
+            }
+            // Keep aggregating complete bursts into this buffer; the EOB
+            // flag is restored when the last one has been read
+            metadata.end_of_burst = false;
+        }
+
         // Loop until buffer is filled or error code. This method returns the
         // metadata from the first packet received, with the exception of
         // end-of-burst and end-of-vector indications (if requested).
@@ -174,10 +441,13 @@ public:
 
             total_samps_recv += num_samps;
 
-            // Return immediately if end of burst
+            // Return on end of burst, unless more bursts should be
+            // aggregated into this buffer
             if (loop_metadata.end_of_burst) {
-                metadata.end_of_burst = true;
-                break;
+                if (++bursts_recv >= _aggregate_bursts) {
+                    metadata.end_of_burst = true;
+                    break;
+                }
             }
             // Return if the end-of-vector position array has been exhausted
             if (eov_positions.data() and eov_positions.remaining() == 0) {
@@ -193,6 +463,19 @@ protected:
     void set_scale_factor(const size_t chan, const double scale_factor)
     {
         _converters[chan]->set_scalar(scale_factor);
+
+        // The fused converter applies one scale factor to all channels, so
+        // it can only be used while the per-channel factors agree
+        if (_fused_converter) {
+            _chan_scales[chan] = scale_factor;
+            _fused_scale_valid =
+                std::all_of(_chan_scales.begin(), _chan_scales.end(), [&](double s) {
+                    return s == _chan_scales.front();
+                });
+            if (_fused_scale_valid) {
+                _fused_converter->set_scalar(scale_factor);
+            }
+        }
     }
 
     //! Returns the maximum payload size
@@ -212,6 +495,7 @@ protected:
     void set_samp_rate(const double rate)
     {
         _samp_rate = rate;
+        _samp_conv.set_tick_rate(rate);
         _zero_copy_streamer.set_samp_rate(rate);
     }
 
@@ -224,6 +508,7 @@ protected:
     //! Notifies the streamer that an overrun has occured
     void set_stopped_due_to_overrun()
     {
+        UHD_TRACEPOINT(rx_overrun);
         _zero_copy_streamer.set_stopped_due_to_overrun();
     }
 
@@ -240,6 +525,22 @@ protected:
         _zero_copy_streamer.set_overrun_handler(handler);
     }
 
+    /*! Tells the streamer when data from a timed stream command is due
+     *
+     * The next call to recv() or recv_buffs() sleeps until shortly before
+     * the given point in time (bounded by its timeout argument) before it
+     * starts polling the transports, freeing the core for other work during
+     * the gap. A new scheduled start replaces a pending one; issuing a
+     * start time in the past is a no-op.
+     *
+     * \param start_time host time at which data is expected to arrive
+     */
+    void set_scheduled_start(const std::chrono::steady_clock::time_point start_time)
+    {
+        _scheduled_start_ns.store(std::max<int64_t>(
+            1, start_time.time_since_epoch() / std::chrono::nanoseconds(1)));
+    }
+
 private:
     //! Converter and associated item sizes
     struct convert_info
@@ -262,22 +563,74 @@ private:
             _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
                 _in_buffs, metadata, eov_positions, timeout_ms);
             _fragment_offset_in_samps = 0;
+
+            if (_buff_samps_remaining != 0) {
+                UHD_TRACEPOINT2(rx_packet, _buff_samps_remaining, _num_enabled_chans);
+                _stats.num_packets += _num_enabled_chans;
+                _stats.num_bytes += _buff_samps_remaining
+                                    * _convert_info.bytes_per_otw_item
+                                    * _num_enabled_chans;
+            }
         } else {
             // There are samples still left in the current set of buffers
             metadata = _last_fragment_metadata;
-            metadata.time_spec += time_spec_t::from_ticks(
-                _fragment_offset_in_samps - metadata.fragment_offset, _samp_rate);
+            metadata.time_spec += _samp_conv.from_ticks(
+                _fragment_offset_in_samps - metadata.fragment_offset);
         }
 
         if (_buff_samps_remaining != 0) {
-            const size_t num_samps = std::min(nsamps_per_buff, _buff_samps_remaining);
-
-            // Convert samples to the streamer's output format
-            for (size_t i = 0; i < get_num_channels(); i++) {
-                char* b = reinterpret_cast<char*>(buffs[i]);
-                const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
-                _convert_to_out_buff(out_buffs, i, num_samps);
+            // With a post-processor attached, nsamps_per_buff limits the
+            // processor's output, so translate it into an input limit first
+            size_t max_in = nsamps_per_buff;
+            if (_postproc_any) {
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    if (!_in_buffs[i]) {
+                        continue;
+                    }
+                    if (_postprocs[i]) {
+                        max_in = _postprocs[i]->max_input(nsamps_per_buff);
+                    }
+                    break;
+                }
             }
+            const size_t num_samps = std::min(max_in, _buff_samps_remaining);
+            size_t num_produced    = num_samps;
+
+            // Convert samples to the streamer's output format. The fused
+            // converter always touches all channels with no processing
+            // stage, so fall back to the per-channel converters while a
+            // subset is disabled or a post-processor is attached.
+            UHD_TRACEPOINT1(rx_convert_begin, num_samps);
+            if (_fused_converter and _fused_scale_valid and not _postproc_any
+                and _num_enabled_chans == get_num_channels()) {
+                _convert_to_out_buffs(buffs, buffer_offset_bytes, num_samps);
+            } else if (_conv_pool_enabled) {
+                num_produced =
+                    _convert_channels_parallel(buffs, buffer_offset_bytes, num_samps);
+            } else {
+                bool first_chan = true;
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    if (!_in_buffs[i]) {
+                        // Channel is disabled, nothing was received for it
+                        continue;
+                    }
+                    char* b = reinterpret_cast<char*>(buffs[i]);
+                    const uhd::rx_streamer::buffs_type out_buffs(
+                        b + buffer_offset_bytes);
+                    const size_t num_out =
+                        _convert_to_out_buff(out_buffs, i, num_samps);
+                    if (_buff_samps_remaining == num_samps) {
+                        _zero_copy_streamer.release_recv_buff(i);
+                    }
+                    // The sample count delivered to the caller follows the
+                    // first enabled channel, like the metadata does
+                    if (first_chan) {
+                        num_produced = num_out;
+                        first_chan   = false;
+                    }
+                }
+            }
+            UHD_TRACEPOINT1(rx_convert_end, num_samps);
 
             _buff_samps_remaining -= num_samps;
 
@@ -290,27 +643,253 @@ private:
                 _last_fragment_metadata = metadata;
             }
 
-            return num_samps;
+            return num_produced;
         } else {
             return 0;
         }
     }
 
-    //! Convert samples for one channel into its buffer
-    UHD_FORCE_INLINE void _convert_to_out_buff(
+    //! Convert samples for one channel into its buffer. Returns the number
+    //! of samples delivered to the caller's buffer, which differs from
+    //! num_samps when a post-processor is attached.
+    UHD_FORCE_INLINE size_t _convert_to_out_buff(
         const uhd::rx_streamer::buffs_type& out_buffs,
         const size_t chan,
         const size_t num_samps)
     {
         const char* buffer_ptr = reinterpret_cast<const char*>(_in_buffs[chan]);
+        size_t num_out         = num_samps;
+
+        if (_postproc_any and _postprocs[chan]) {
+            // Convert into the scratch buffer, then run the processor from
+            // there into the caller's buffer while the chunk is cache hot
+            auto& scratch      = _postproc_scratch[chan];
+            const size_t bytes = num_samps * _convert_info.bytes_per_cpu_item;
+            if (scratch.size() < bytes) {
+                scratch.resize(bytes);
+            }
+            void* scratch_ptr = scratch.data();
+            const uhd::rx_streamer::buffs_type scratch_buffs(scratch_ptr);
+            _converters[chan]->conv(buffer_ptr, scratch_buffs, num_samps);
+            num_out = _postprocs[chan]->process(scratch_ptr, out_buffs[0], num_samps);
+            if (_iq_corr_any and _iq_corr[chan].enabled) {
+                _apply_iq_correction(out_buffs[0], chan, num_out);
+            }
+        } else {
+            _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
+            if (_iq_corr_any and _iq_corr[chan].enabled) {
+                _apply_iq_correction(out_buffs[0], chan, num_samps);
+            }
+        }
 
-        _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
-
-        // Advance the pointer for the source buffer
+        // Advance the pointer for the source buffer. Releasing an exhausted
+        // buffer is the caller's job: the parallel path must defer it until
+        // every channel's conversion has completed.
         _in_buffs[chan] = buffer_ptr + num_samps * _convert_info.bytes_per_otw_item;
 
+        return num_out;
+    }
+
+    /*! Convert all channels of one chunk in parallel
+     *
+     * Publishes the chunk as a conversion round, lets the pool workers and
+     * the calling thread claim channels from it, and waits until all
+     * channels are done. Only then are exhausted aligned buffers released,
+     * since releasing can touch transport state that is not safe to share
+     * with in-flight conversions.
+     *
+     * \return the number of samples delivered on the first enabled channel
+     */
+    size_t _convert_channels_parallel(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t num_samps)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_conv_mutex);
+            _conv_buffs        = &buffs;
+            _conv_offset_bytes = buffer_offset_bytes;
+            _conv_num_samps    = num_samps;
+            _conv_next_chan.store(0, std::memory_order_relaxed);
+            _conv_pending = get_num_channels();
+            _conv_round++;
+            _conv_cv.notify_all();
+        }
+
+        // The calling thread works the round too
+        _conv_claim_channels();
+
+        {
+            std::unique_lock<std::mutex> lock(_conv_mutex);
+            _conv_done_cv.wait(lock, [this]() { return _conv_pending == 0; });
+            _conv_buffs = nullptr;
+        }
+
+        // All conversions are complete, release exhausted buffers
         if (_buff_samps_remaining == num_samps) {
-            _zero_copy_streamer.release_recv_buff(chan);
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                if (_in_buffs[i]) {
+                    _zero_copy_streamer.release_recv_buff(i);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            if (_in_buffs[i]) {
+                return _conv_num_out[i];
+            }
+        }
+        return num_samps;
+    }
+
+    //! Claim and convert channels of the current round until none are left
+    void _conv_claim_channels()
+    {
+        while (true) {
+            const size_t chan = _conv_next_chan.fetch_add(1);
+            if (chan >= get_num_channels()) {
+                return;
+            }
+            if (_in_buffs[chan]) {
+                char* b = reinterpret_cast<char*>((*_conv_buffs)[chan]);
+                const uhd::rx_streamer::buffs_type out_buffs(b + _conv_offset_bytes);
+                _conv_num_out[chan] =
+                    _convert_to_out_buff(out_buffs, chan, _conv_num_samps);
+            }
+            std::lock_guard<std::mutex> lock(_conv_mutex);
+            if (--_conv_pending == 0) {
+                _conv_done_cv.notify_one();
+            }
+        }
+    }
+
+    //! Pool worker: converts channels of each round as they are published
+    void _conv_worker_loop()
+    {
+        uint64_t last_round = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_conv_mutex);
+                _conv_cv.wait(lock, [this, last_round]() {
+                    return _conv_shutdown or _conv_round != last_round;
+                });
+                if (_conv_shutdown) {
+                    return;
+                }
+                last_round = _conv_round;
+            }
+            _conv_claim_channels();
+        }
+    }
+
+    //! Convert samples for all channels into their buffers with one call
+    UHD_FORCE_INLINE void _convert_to_out_buffs(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t num_samps)
+    {
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            _out_buffs[i] = reinterpret_cast<char*>(buffs[i]) + buffer_offset_bytes;
+        }
+
+        _fused_converter->conv(_in_buffs, _out_buffs, num_samps);
+
+        if (_iq_corr_any) {
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                if (_iq_corr[i].enabled) {
+                    _apply_iq_correction(_out_buffs[i], i, num_samps);
+                }
+            }
+        }
+
+        // Advance the pointers for the source buffers
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            _in_buffs[i] = reinterpret_cast<const char*>(_in_buffs[i])
+                           + num_samps * _convert_info.bytes_per_otw_item;
+
+            if (_buff_samps_remaining == num_samps) {
+                _zero_copy_streamer.release_recv_buff(i);
+            }
+        }
+    }
+
+    /*! Apply y = y * gain + offset in place over one converted packet
+     *
+     * Runs immediately after the format conversion of the same chunk, so
+     * the samples are still cache resident and the correction costs no
+     * extra trips to memory. The plain loops vectorize under the same
+     * flags as the converters.
+     */
+    UHD_FORCE_INLINE void _apply_iq_correction(
+        void* buff, const size_t chan, const size_t num_samps)
+    {
+        const iq_corr_t& corr = _iq_corr[chan];
+        if (_cpu_is_fc64) {
+            std::complex<double>* samps = reinterpret_cast<std::complex<double>*>(buff);
+            for (size_t i = 0; i < num_samps; i++) {
+                samps[i] = samps[i] * corr.gain + corr.offset;
+            }
+        } else {
+            const std::complex<float> gain(corr.gain);
+            const std::complex<float> offset(corr.offset);
+            std::complex<float>* samps = reinterpret_cast<std::complex<float>*>(buff);
+            for (size_t i = 0; i < num_samps; i++) {
+                samps[i] = samps[i] * gain + offset;
+            }
+        }
+    }
+
+    /*! Sleep until just before a scheduled stream start is due
+     *
+     * The wakeup is clamped to the caller's timeout so recv() never blocks
+     * longer than requested, and happens SCHEDULED_START_GUARD_NS early so
+     * the regular polling path is already waiting when data hits the wire.
+     *
+     * \param start_time_ns scheduled start, in steady_clock nanoseconds
+     * \param timeout_ms the caller's timeout budget
+     * \return the timeout budget remaining after the sleep, in ms
+     */
+    int32_t _wait_for_scheduled_start(
+        const int64_t start_time_ns, const int32_t timeout_ms)
+    {
+        using namespace std::chrono;
+
+        const auto now = steady_clock::now();
+        const auto due = steady_clock::time_point(
+            nanoseconds(start_time_ns - SCHEDULED_START_GUARD_NS));
+        const auto deadline = now + milliseconds(timeout_ms);
+        const auto wake     = std::min(due, deadline);
+
+        if (wake <= now) {
+            return timeout_ms;
+        }
+
+        std::this_thread::sleep_until(wake);
+
+        return static_cast<int32_t>(std::max<int64_t>(
+            0, duration_cast<milliseconds>(deadline - steady_clock::now()).count()));
+    }
+
+    //! Records the duration of one streamer call in the statistics
+    UHD_FORCE_INLINE void _record_call_time(
+        const std::chrono::steady_clock::time_point start_time, const bool timed_out)
+    {
+        using namespace std::chrono;
+
+        const uint64_t elapsed_ns =
+            duration_cast<nanoseconds>(steady_clock::now() - start_time).count();
+
+        // Bucket index is the position of the highest set bit of the
+        // duration in microseconds, clamped to the last bucket
+        uint64_t us   = elapsed_ns / 1000;
+        size_t bucket = 0;
+        while (us > 1 and bucket < stream_stats_t::NUM_LATENCY_BUCKETS - 1) {
+            us >>= 1;
+            bucket++;
+        }
+        _stats.call_latency_hist[bucket]++;
+
+        if (timed_out) {
+            _stats.num_timeouts++;
+            _stats.stall_time_ns += elapsed_ns;
         }
     }
 
@@ -345,10 +924,30 @@ private:
 
         _convert_info = info;
 
+        _cpu_is_fc32 = stream_args.cpu_format == "fc32";
+        _cpu_is_fc64 = stream_args.cpu_format == "fc64";
+        _iq_corr.resize(num_ports);
+        _postprocs.resize(num_ports);
+        _postproc_scratch.resize(num_ports);
+
         for (size_t i = 0; i < num_ports; i++) {
             _converters.push_back(convert::get_converter(id)());
             _converters.back()->set_scalar(1 / 32767.0);
         }
+
+        // Prefer a fused converter that handles all channels in one call
+        // when one is registered for this channel count and format pair
+        if (num_ports > 1) {
+            convert::id_type fused_id = id;
+            fused_id.num_inputs       = num_ports;
+            fused_id.num_outputs      = num_ports;
+            if (convert::has_converter(fused_id)) {
+                _fused_converter = convert::get_converter(fused_id)();
+                _fused_converter->set_scalar(1 / 32767.0);
+                _out_buffs.resize(num_ports);
+            }
+        }
+        _chan_scales.assign(num_ports, 1 / 32767.0);
     }
 
     // Converter and item sizes
@@ -357,15 +956,59 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Fused converter that handles all channels at once, if available
+    uhd::convert::converter::sptr _fused_converter;
+
+    // Per-channel scale factors; the fused converter is only usable while
+    // they all match
+    std::vector<double> _chan_scales;
+    bool _fused_scale_valid = true;
+
+    //! Host-side correction terms for one channel (see set_iq_correction())
+    struct iq_corr_t
+    {
+        bool enabled = false;
+        std::complex<double> gain{1.0, 0.0};
+        std::complex<double> offset{0.0, 0.0};
+    };
+
+    // Per-channel host-side IQ correction; _iq_corr_any caches whether any
+    // channel has a correction active so the packet path can skip the
+    // per-channel checks in the common case
+    std::vector<iq_corr_t> _iq_corr;
+    bool _iq_corr_any = false;
+
+    // Whether the cpu_format is a complex float type, which the host-side
+    // IQ correction requires
+    bool _cpu_is_fc32 = false;
+    bool _cpu_is_fc64 = false;
+
+    // Per-channel post-processing stages and the scratch buffers holding
+    // the converted packet they read from; _postproc_any caches whether any
+    // channel has a stage attached so the packet path can skip the checks
+    std::vector<rx_postproc::sptr> _postprocs;
+    std::vector<std::vector<char>> _postproc_scratch;
+    bool _postproc_any = false;
+
+    // Container for output buffer pointers used by the fused converter
+    std::vector<void*> _out_buffs;
+
     // Implementation of frame buffer management and packet info
     rx_streamer_zero_copy<transport_t, ignore_seq_err> _zero_copy_streamer;
 
     // Container for buffer pointers used in recv method
     std::vector<const void*> _in_buffs;
 
+    // Number of currently enabled channels, mirrored from the zero copy
+    // streamer so the packet path does not recount per packet
+    size_t _num_enabled_chans;
+
     // Sample rate used to calculate metadata time_spec_t
     double _samp_rate = 1.0;
 
+    // Tick-native converter at the sample rate, for fragment timestamps
+    tick_converter _samp_conv;
+
     // MTU, determined when xport is connected and modifiable by subclass
     size_t _mtu = std::numeric_limits<std::size_t>::max();
 
@@ -375,12 +1018,45 @@ private:
     // Num samps remaining in buffer currently held by zero copy streamer
     size_t _buff_samps_remaining = 0;
 
+    // Number of EOB-terminated bursts to coalesce into one recv buffer (see
+    // the aggregate_bursts stream arg); 1 preserves the per-burst behavior
+    size_t _aggregate_bursts = 1;
+
+    // Whether frame buffers are lent out via recv_buffs()
+    bool _borrowed_buffs = false;
+
+    // Scheduled stream start in steady_clock nanoseconds, or 0 if none is
+    // pending. Atomic since stream commands may be issued from a different
+    // thread than the one calling recv().
+    std::atomic<int64_t> _scheduled_start_ns{0};
+
     // Metadata cache for error handling
     detail::rx_metadata_cache _error_metadata_cache;
 
+    // Statistics updated on the packet path; recv() is single-threaded by
+    // contract, so plain counters suffice
+    stream_stats_t _stats;
+
     // Fragment (partially read packet) information
     size_t _fragment_offset_in_samps = 0;
     rx_metadata_t _last_fragment_metadata;
+
+    // Parallel conversion state (see _convert_channels_parallel()). The
+    // job fields are published under _conv_mutex per round; workers claim
+    // channels through the atomic counter.
+    bool _conv_pool_enabled = false;
+    std::vector<std::thread> _conv_pool;
+    std::mutex _conv_mutex;
+    std::condition_variable _conv_cv;
+    std::condition_variable _conv_done_cv;
+    uint64_t _conv_round  = 0;
+    size_t _conv_pending  = 0;
+    bool _conv_shutdown   = false;
+    std::atomic<size_t> _conv_next_chan{0};
+    const uhd::rx_streamer::buffs_type* _conv_buffs = nullptr;
+    size_t _conv_offset_bytes                       = 0;
+    size_t _conv_num_samps                          = 0;
+    std::vector<size_t> _conv_num_out;
 };
 
 }} // namespace uhd::transport
@@ -8,11 +8,16 @@
 
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/get_aligned_buffs.hpp>
+#include <uhdlib/utils/tick_converter.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -93,7 +98,8 @@ public:
         : _xports(num_ports)
         , _frame_buffs(num_ports)
         , _infos(num_ports)
-        , _get_aligned_buffs(_xports, _frame_buffs, _infos)
+        , _chan_enabled(num_ports, 1)
+        , _get_aligned_buffs(_xports, _frame_buffs, _infos, _chan_enabled)
     {
     }
 
@@ -128,16 +134,98 @@ public:
         return _xports.size();
     }
 
+    /*! Enables or disables a channel on the running streamer
+     *
+     * A disabled channel keeps its transport, but the streamer stops
+     * fetching packets for it and it no longer takes part in time
+     * alignment, so re-enabling it later is nearly free. On disable, any
+     * packet held for the channel is released and packets already queued in
+     * the transport are flushed.
+     *
+     * The caller is responsible for stopping the stream on a channel before
+     * disabling it, otherwise its transport will fill up and stall the
+     * device-side flow control.
+     *
+     * \param channel the channel to enable or disable
+     * \param enabled false to park the channel, true to resume it
+     * \throws uhd::index_error if the channel index is invalid
+     * \throws uhd::value_error if disabling would leave no enabled channels
+     */
+    void set_channel_enabled(const size_t channel, const bool enabled)
+    {
+        if (channel >= get_num_channels()) {
+            throw uhd::index_error(
+                "Channel number indexes beyond the number of streamer ports");
+        }
+
+        if (_chan_enabled[channel] == (enabled ? 1 : 0)) {
+            return;
+        }
+
+        if (not enabled) {
+            if (get_num_enabled_channels() == 1) {
+                throw uhd::value_error(
+                    "Cannot disable the last enabled channel of an rx streamer");
+            }
+
+            // Release the packet held for this channel, if any, and flush
+            // packets already queued in the transport so they do not get
+            // delivered as stale data when the channel is re-enabled.
+            if (_frame_buffs[channel]) {
+                _xports[channel]->release_recv_buff(std::move(_frame_buffs[channel]));
+                _frame_buffs[channel] = nullptr;
+            }
+
+            typename transport_t::buff_t::uptr buff;
+            while (true) {
+                std::tie(buff, std::ignore, std::ignore) =
+                    _xports[channel]->get_recv_buff(0);
+                if (!buff) {
+                    break;
+                }
+                _xports[channel]->release_recv_buff(std::move(buff));
+            }
+        }
+
+        _chan_enabled[channel] = enabled ? 1 : 0;
+
+        _first_enabled = 0;
+        while (!_chan_enabled[_first_enabled]) {
+            _first_enabled++;
+        }
+    }
+
+    //! Returns whether the given channel is currently enabled
+    bool is_channel_enabled(const size_t channel) const
+    {
+        return _chan_enabled[channel] != 0;
+    }
+
+    //! Returns the number of currently enabled channels
+    size_t get_num_enabled_channels() const
+    {
+        size_t count = 0;
+        for (const auto enabled : _chan_enabled) {
+            count += (enabled != 0);
+        }
+        return count;
+    }
+
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
         _tick_rate = rate;
+        _tick_conv.set_tick_rate(rate);
+        _ticks_per_samp     = _tick_rate / _samp_rate;
+        _expected_tsf_valid = false;
     }
 
     //! Configures sample rate for conversion of timestamp
     void set_samp_rate(const double rate)
     {
-        _samp_rate = rate;
+        _samp_rate          = rate;
+        _ticks_per_samp     = _tick_rate / _samp_rate;
+        _expected_tsf_valid = false;
     }
 
     //! Configures the size of each sample
@@ -164,6 +252,62 @@ public:
         _overrun_handler = handler;
     }
 
+    /*! Configures whether sequence errors stop the stream
+     *
+     * When enabled, a dropped packet does not surface as an overflow
+     * error. The streamer keeps delivering data and reports the gap via
+     * the out_of_sequence flag and dropped_samps count in the metadata,
+     * so the application can decide whether a restart is warranted.
+     */
+    void set_tolerate_seq_errors(const bool tolerate)
+    {
+        _tolerate_seq_errors = tolerate;
+    }
+
+    /*! Configures the link liveness timeout
+     *
+     * When nonzero, a recv timeout that occurs mid-burst (packets were
+     * flowing and no end-of-burst was seen) after the link has been silent
+     * for longer than this is reported as ERROR_CODE_LINK_DOWN instead of
+     * ERROR_CODE_TIMEOUT, so failover logic can distinguish a dead device
+     * from a slow one. Silence after an end-of-burst is normal and never
+     * reported as link-down.
+     */
+    void set_link_liveness_timeout(const int32_t timeout_ms)
+    {
+        _liveness_timeout_ms = timeout_ms;
+    }
+
+    //! Returns how often the channels needed to be time-realigned
+    size_t get_num_realignments() const
+    {
+        return _get_aligned_buffs.get_num_realignments();
+    }
+
+    //! Returns the number of timestamp discontinuities detected
+    uint64_t get_num_ts_discontinuities() const
+    {
+        return _num_ts_discontinuities;
+    }
+
+    //! Appends recent flow control drop events from all channel transports,
+    //  tagged with their channel index and merged in time order
+    void get_fc_drop_events(std::vector<stream_stats_t::fc_drop_event_t>& events) const
+    {
+        for (size_t i = 0; i < _xports.size(); i++) {
+            for (auto event : _xports[i]->get_fc_drop_events()) {
+                event.channel = i;
+                events.push_back(event);
+            }
+        }
+        std::sort(events.begin(),
+            events.end(),
+            [](const stream_stats_t::fc_drop_event_t& lhs,
+                const stream_stats_t::fc_drop_event_t& rhs) {
+                return lhs.time_ns < rhs.time_ns;
+            });
+    }
+
     /*!
      * Gets a set of time-aligned buffers, one per channel.
      *
@@ -181,13 +325,18 @@ public:
         auto set_metadata_for_error =
             [this](typename get_aligned_buffs_t::alignment_result_t error,
                 rx_metadata_t& metadata) {
+                // The stream is interrupted, so the next packet's timestamp
+                // carries no continuity expectation
+                _expected_tsf_valid = false;
                 switch (error) {
                     case get_aligned_buffs_t::BAD_PACKET:
                         metadata.error_code = rx_metadata_t::ERROR_CODE_BAD_PACKET;
                         break;
 
                     case get_aligned_buffs_t::TIMEOUT:
-                        metadata.error_code = rx_metadata_t::ERROR_CODE_TIMEOUT;
+                        metadata.error_code = _liveness_expired()
+                                                  ? rx_metadata_t::ERROR_CODE_LINK_DOWN
+                                                  : rx_metadata_t::ERROR_CODE_TIMEOUT;
                         break;
 
                     case get_aligned_buffs_t::ALIGNMENT_FAILURE:
@@ -222,6 +371,7 @@ public:
                     _last_read_time_info.get_next_packet_time(_samp_rate);
                 metadata.error_code     = rx_metadata_t::ERROR_CODE_OVERFLOW;
                 _stopped_due_to_overrun = false;
+                _expected_tsf_valid     = false;
                 return 0;
             } else {
                 // Packets were not available with zero timeout, wait for them
@@ -231,11 +381,21 @@ public:
                     metadata.has_time_spec   = false;
                     metadata.error_code      = rx_metadata_t::ERROR_CODE_LATE_COMMAND;
                     _stopped_due_to_late_cmd = false;
+                    _expected_tsf_valid      = false;
                     return 0;
                 }
             }
         }
 
+        // In tolerant mode, an isolated gap does not stop the stream. The
+        // packet that revealed the gap was kept by the transport, so just
+        // finish the alignment and report the hole via metadata below.
+        bool seq_err_tolerated = false;
+        while (result == get_aligned_buffs_t::SEQUENCE_ERROR and _tolerate_seq_errors) {
+            seq_err_tolerated = true;
+            result            = _get_aligned_buffs(timeout_ms);
+        }
+
         if (result != get_aligned_buffs_t::SUCCESS) {
             set_metadata_for_error(result, metadata);
             return 0;
@@ -249,20 +409,46 @@ public:
         bool eob = false;
         bool eov = false;
         for (size_t i = 0; i < buffs.size(); i++) {
+            if (!_chan_enabled[i]) {
+                // Disabled channels deliver no data
+                buffs[i] = nullptr;
+                continue;
+            }
             buffs[i] = _infos[i].payload;
             eob |= _infos[i].eob;
             eov |= _infos[i].eov;
         }
 
-        // Set the metadata from the buffer information at index zero
-        const auto& info_0 = _infos[0];
+        // Set the metadata from the buffer information of the first enabled
+        // channel
+        const auto& info_0 = _infos[_first_enabled];
 
         metadata.has_time_spec  = info_0.has_tsf;
-        metadata.time_spec      = time_spec_t::from_ticks(info_0.tsf, _tick_rate);
+        metadata.time_spec      = _tick_conv.from_ticks(info_0.tsf);
         metadata.start_of_burst = false;
         metadata.end_of_burst   = eob;
         metadata.error_code     = rx_metadata_t::ERROR_CODE_NONE;
 
+        // Track link liveness: arm the watchdog on every packet mid-burst
+        // and stand down at end-of-burst, where silence is expected
+        if (_liveness_timeout_ms > 0) {
+            _last_packet_time = std::chrono::steady_clock::now();
+            _liveness_armed   = not eob;
+        }
+
+        if (seq_err_tolerated) {
+            metadata.out_of_sequence = true;
+            metadata.dropped_samps   = _estimate_dropped_samps(info_0);
+        }
+
+        // Surface the wire arrival time recorded by the transport, if any
+        const uint64_t wire_time_ns = _frame_buffs[_first_enabled]->wire_time_ns();
+        if (wire_time_ns != 0) {
+            metadata.has_wire_time = true;
+            metadata.wire_time =
+                _ns_conv.from_ticks(static_cast<int64_t>(wire_time_ns));
+        }
+
         // If the caller wants eov indications via metadata, then check
         // eov and set the metadata values appropriately. Note that only
         // channel 0 is checked for eov--in most cases, it should be the
@@ -272,10 +458,32 @@ public:
                                     + info_0.payload_bytes / _bytes_per_item);
         }
 
+        const size_t num_samps = info_0.payload_bytes / _bytes_per_item;
+
+        // Always-on timestamp continuity check: each timestamped packet is
+        // expected to start where the previous one ended. This is one
+        // multiply-add and one compare per packet, so it replaces full
+        // timestamp audits of the receive buffer downstream. A gap that was
+        // already reported as a sequence error is not counted again.
+        const uint64_t ticks_this_pkt =
+            static_cast<uint64_t>(std::llround(num_samps * _ticks_per_samp));
+        if (info_0.has_tsf) {
+            if (_expected_tsf_valid and info_0.tsf != _expected_tsf
+                and not seq_err_tolerated) {
+                _num_ts_discontinuities++;
+            }
+            _expected_tsf       = info_0.tsf + ticks_this_pkt;
+            _expected_tsf_valid = true;
+        } else if (_expected_tsf_valid) {
+            // Untimestamped packets advance the expectation so the next
+            // timestamped packet can still be validated
+            _expected_tsf += ticks_this_pkt;
+        }
+
         // Done with these packets, save timestamp info for next call
         _last_read_time_info.has_time_spec = metadata.has_time_spec;
         _last_read_time_info.time_spec     = metadata.time_spec;
-        _last_read_time_info.num_samps     = info_0.payload_bytes / _bytes_per_item;
+        _last_read_time_info.num_samps     = num_samps;
         eov_positions.update_running_sample_count(_last_read_time_info.num_samps);
 
         return _last_read_time_info.num_samps;
@@ -288,6 +496,10 @@ public:
      */
     void release_recv_buff(const size_t channel)
     {
+        // Disabled channels hold no packet
+        if (!_frame_buffs[channel]) {
+            return;
+        }
         _xports[channel]->release_recv_buff(std::move(_frame_buffs[channel]));
         _frame_buffs[channel] = typename transport_t::buff_t::uptr();
     }
@@ -295,6 +507,28 @@ public:
 private:
     using get_aligned_buffs_t = get_aligned_buffs<transport_t, ignore_seq_err>;
 
+    /*!
+     * Derive the number of samples lost in a tolerated sequence error from
+     * the gap between the expected time of the next packet and the actual
+     * timestamp of the packet that followed the hole.
+     */
+    size_t _estimate_dropped_samps(
+        const typename transport_t::packet_info_t& info) const
+    {
+        if (not(info.has_tsf and _last_read_time_info.has_time_spec)) {
+            return 0;
+        }
+        const time_spec_t expected =
+            _last_read_time_info.time_spec
+            + time_spec_t::from_ticks(_last_read_time_info.num_samps, _samp_rate);
+        const time_spec_t actual = time_spec_t::from_ticks(info.tsf, _tick_rate);
+        if (not(expected < actual)) {
+            return 0;
+        }
+        return static_cast<size_t>(
+            (actual - expected).get_real_secs() * _samp_rate + 0.5);
+    }
+
     void _handle_overrun()
     {
         // Flush any remaining packets. This method is called after any channel
@@ -352,9 +586,20 @@ private:
     // Packet info corresponding to the packets in flight
     std::vector<typename transport_t::packet_info_t> _infos;
 
+    // Per-channel enabled mask (uint8_t since get_aligned_buffs holds a
+    // reference into it and std::vector<bool> has no stable elements)
+    std::vector<uint8_t> _chan_enabled;
+
+    // Index of the lowest enabled channel, used as the metadata source
+    size_t _first_enabled = 0;
+
     // Rate used in conversion of timestamp to time_spec_t
     double _tick_rate = 1.0;
 
+    // Tick-native converters for the per-packet timestamp conversions
+    tick_converter _tick_conv;
+    tick_converter _ns_conv{1e9};
+
     // Rate used in conversion of timestamp to time_spec_t
     double _samp_rate = 1.0;
 
@@ -367,6 +612,18 @@ private:
     // Information about the last data packet processed
     last_read_time_info_t _last_read_time_info;
 
+    // Ticks per sample, cached from the tick and sample rates for the
+    // per-packet timestamp continuity check
+    double _ticks_per_samp = 1.0;
+
+    // Expected timestamp of the next packet in ticks. Invalid until a
+    // timestamped packet is seen and after any stream interruption.
+    uint64_t _expected_tsf   = 0;
+    bool _expected_tsf_valid = false;
+
+    // Count of detected timestamp discontinuities
+    uint64_t _num_ts_discontinuities = 0;
+
     // Total number of samples read, used in determining EOV positions
     size_t _total_num_samps = 0;
 
@@ -380,6 +637,27 @@ private:
 
     // Callback for overrun
     overrun_handler_t _overrun_handler;
+
+    // Whether sequence errors are reported via metadata instead of
+    // stopping the stream with an overflow error
+    bool _tolerate_seq_errors = false;
+
+    //! Returns whether the link has been silent mid-burst beyond the
+    //  liveness timeout
+    bool _liveness_expired() const
+    {
+        return _liveness_armed and _liveness_timeout_ms > 0
+               and std::chrono::steady_clock::now() - _last_packet_time
+                       > std::chrono::milliseconds(_liveness_timeout_ms);
+    }
+
+    // Link liveness timeout in milliseconds; 0 disables the watchdog
+    int32_t _liveness_timeout_ms = 0;
+
+    // Arrival time of the most recent packet, and whether the watchdog is
+    // armed (a packet arrived mid-burst more recently than an end-of-burst)
+    std::chrono::steady_clock::time_point _last_packet_time;
+    bool _liveness_armed = false;
 };
 
 }} // namespace uhd::transport
@@ -0,0 +1,367 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*! Frame buffer pointing into a slot of a shared-memory ring
+ *
+ * The ring owns the memory; the buffer just carries a pointer to the
+ * slot it was bound to at acquisition time.
+ */
+class shmem_frame_buff : public frame_buff
+{
+public:
+    shmem_frame_buff()
+    {
+        _data = nullptr;
+    }
+
+    void set_mem(void* mem)
+    {
+        _data = mem;
+    }
+
+    //! Free-running count of ring slots consumed through this frame's slot
+    uint64_t seq = 0;
+};
+
+namespace shmem_detail {
+
+//! Written to ring_header::magic once a segment is fully initialized
+static constexpr uint64_t RING_MAGIC = 0x55484453484d454dULL; // "UHDSHMEM"
+//! Bump when the segment layout changes
+static constexpr uint32_t RING_VERSION = 1;
+
+/*! On-segment header of one single-producer/single-consumer frame ring
+ *
+ * The producer publishes frames by advancing \p head after filling the
+ * frame payload and its length; the consumer hands slots back by
+ * advancing \p tail. Both cursors are free-running frame counts (slot =
+ * count % num_frames), so head == tail means empty and
+ * head - tail == num_frames means full. Each cursor sits on its own
+ * cache line so the two processes do not false-share.
+ */
+struct ring_header
+{
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t frame_size;
+    uint32_t num_frames;
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+/*! One mapped single-producer/single-consumer frame ring over a POSIX
+ * shared memory segment
+ *
+ * The segment layout is the ring_header, a per-slot length table, then
+ * the frame payload area, with each section cache-line aligned.
+ */
+class shmem_ring
+{
+public:
+    shmem_ring()                  = default;
+    shmem_ring(const shmem_ring&) = delete;
+
+    ~shmem_ring();
+
+    //! Create and initialize the segment (this process is the owner)
+    void create(
+        const std::string& name, const size_t frame_size, const size_t num_frames);
+
+    //! Attach to a segment created by another process and validate its
+    //! geometry against the given values
+    void attach(
+        const std::string& name, const size_t frame_size, const size_t num_frames);
+
+    //! Unmap the segment, and unlink it if this process created it
+    void close();
+
+    UHD_FORCE_INLINE uint64_t head() const
+    {
+        return _hdr->head.load(std::memory_order_acquire);
+    }
+
+    UHD_FORCE_INLINE uint64_t tail() const
+    {
+        return _hdr->tail.load(std::memory_order_acquire);
+    }
+
+    //! Publish all frames below the given count to the consumer
+    UHD_FORCE_INLINE void publish(const uint64_t head)
+    {
+        _hdr->head.store(head, std::memory_order_release);
+    }
+
+    //! Return all slots below the given count to the producer
+    UHD_FORCE_INLINE void release_to(const uint64_t tail)
+    {
+        _hdr->tail.store(tail, std::memory_order_release);
+    }
+
+    UHD_FORCE_INLINE void* frame_mem(const uint64_t count)
+    {
+        return _frames + (count % _num_frames) * _frame_size;
+    }
+
+    UHD_FORCE_INLINE uint32_t& frame_len(const uint64_t count)
+    {
+        return _lens[count % _num_frames];
+    }
+
+private:
+    ring_header* _hdr = nullptr;
+    uint32_t* _lens   = nullptr;
+    uint8_t* _frames  = nullptr;
+    size_t _map_size  = 0;
+    size_t _frame_size = 0;
+    size_t _num_frames = 0;
+    std::string _name;
+    bool _owner = false;
+};
+
+} // namespace shmem_detail
+
+class shmem_adapter_info : public adapter_info
+{
+public:
+    shmem_adapter_info(const std::string& name) : _name(name) {}
+
+    ~shmem_adapter_info() {}
+
+    std::string to_string()
+    {
+        return std::string("SHMEM:") + _name;
+    }
+
+    bool operator==(const shmem_adapter_info& rhs) const
+    {
+        return (_name == rhs._name);
+    }
+
+private:
+    const std::string _name;
+};
+
+/*! Intra-host link over a pair of shared-memory rings
+ *
+ * One endpoint creates two single-producer/single-consumer ring segments
+ * (one per direction) and the other attaches to them, so co-located
+ * producers and consumers (e.g. the CHDR simulator, or multiple DSP
+ * processes on one host) can stream frames without traversing the kernel
+ * network stack. Frames are handed out zero-copy straight from the
+ * mapped segment.
+ *
+ * \b Note: Like nirio_link, this link claims ring slots in acquisition
+ *          order, which means frame buffers cannot be released out of
+ *          order, and it can't be used with an IO service that does that.
+ */
+class shmem_link : public recv_link_base<shmem_link>, public send_link_base<shmem_link>
+{
+public:
+    using sptr = std::shared_ptr<shmem_link>;
+
+    shmem_link(const std::string& name, const bool create, const link_params_t& params);
+
+    ~shmem_link();
+
+    /*! Make a new shared-memory link.
+     *
+     * Exactly one endpoint passes \p create = true; it creates the ring
+     * segments and unlinks them on destruction. Both endpoints must use
+     * the same \p name, and the attaching side's send frame geometry must
+     * match the creating side's recv frame geometry and vice versa.
+     *
+     * \param name a name identifying this link, unique per host
+     * \param create whether to create the ring segments or attach to them
+     * \param params Values for frame sizes and num frames
+     * \return a shared_ptr to a new shared-memory link
+     */
+    static sptr make(
+        const std::string& name, const bool create, const link_params_t& params);
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Returns whether this link type supports releasing the frame buffers
+     * in an order different from that in which they were acquired.
+     */
+    bool supports_send_buff_out_of_order() const
+    {
+        return false;
+    }
+
+    /*!
+     * Returns whether this link type supports releasing the frame buffers
+     * in an order different from that in which they were acquired.
+     */
+    bool supports_recv_buff_out_of_order() const
+    {
+        return false;
+    }
+
+    /*!
+     * Release a send buffer. Overridden from send_link_base because a
+     * buffer abandoned without payload (packet_size == 0) still occupies
+     * the ring slot it claimed at acquisition time; it is published as a
+     * zero-length frame, which the receiving side skips.
+     */
+    void release_send_buff(frame_buff::uptr buff)
+    {
+        frame_buff* buff_ptr = buff.release();
+        assert(buff_ptr);
+
+        _send_ring.frame_len(_send_released) =
+            static_cast<uint32_t>(buff_ptr->packet_size());
+        _send_released++;
+        _send_ring.publish(_send_released);
+
+        buff_ptr->set_packet_size(0);
+        send_link_base_t::preload_free_buff(buff_ptr);
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<shmem_link>;
+    using send_link_base_t = send_link_base<shmem_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    // Methods called by recv_link_base
+    UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        auto& frame = static_cast<shmem_frame_buff&>(buff);
+        while (true) {
+            if (_recv_consumed == _recv_ring.head()) {
+                if (not _wait_for(
+                        [this]() { return _recv_consumed != _recv_ring.head(); },
+                        timeout_ms)) {
+                    return 0;
+                }
+            }
+            const size_t len = _recv_ring.frame_len(_recv_consumed);
+            frame.set_mem(_recv_ring.frame_mem(_recv_consumed));
+            _recv_consumed++;
+            if (len == 0) {
+                // The sender abandoned this slot; hand it straight back
+                // unless that would run ahead of a frame the caller still
+                // holds (releases are strictly in ring order)
+                if (_recv_outstanding == 0) {
+                    _recv_ring.release_to(_recv_consumed);
+                }
+                continue;
+            }
+            frame.seq = _recv_consumed;
+            _recv_outstanding++;
+            return len;
+        }
+    }
+
+    UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& buff)
+    {
+        auto& frame = static_cast<shmem_frame_buff&>(buff);
+        _recv_outstanding--;
+        // In-order release: every slot through this frame's is done with.
+        // Once nothing is outstanding, trailing abandoned slots are, too.
+        _recv_ring.release_to(_recv_outstanding == 0 ? _recv_consumed : frame.seq);
+    }
+
+    // Methods called by send_link_base
+    UHD_FORCE_INLINE bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        if (_send_claimed - _send_ring.tail() >= get_num_send_frames()) {
+            if (not _wait_for(
+                    [this]() {
+                        return _send_claimed - _send_ring.tail()
+                               < get_num_send_frames();
+                    },
+                    timeout_ms)) {
+                return false;
+            }
+        }
+        static_cast<shmem_frame_buff&>(buff).set_mem(
+            _send_ring.frame_mem(_send_claimed));
+        _send_claimed++;
+        return true;
+    }
+
+    UHD_FORCE_INLINE void release_send_buff_derived(frame_buff& /*buff*/)
+    {
+        // Not used: release_send_buff is overridden above so abandoned
+        // buffers advance the ring as well
+    }
+
+    //! Poll for the condition until it holds or the timeout elapses. A
+    //! negative timeout polls forever; a zero timeout checks exactly once.
+    template <typename predicate_t>
+    UHD_FORCE_INLINE bool _wait_for(predicate_t&& pred, const int32_t timeout_ms)
+    {
+        if (timeout_ms == 0) {
+            return pred();
+        }
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::milliseconds(timeout_ms);
+        while (not pred()) {
+            if (timeout_ms > 0 and std::chrono::steady_clock::now() > deadline) {
+                return pred();
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    /**************************************************************************
+     * Private attributes
+     *************************************************************************/
+    //! The rings, named from this endpoint's perspective
+    shmem_detail::shmem_ring _send_ring;
+    shmem_detail::shmem_ring _recv_ring;
+
+    //! Free-running count of send slots claimed at buffer acquisition
+    uint64_t _send_claimed = 0;
+    //! Free-running count of send slots published at buffer release
+    uint64_t _send_released = 0;
+    //! Free-running count of recv slots taken off the ring
+    uint64_t _recv_consumed = 0;
+    //! Number of recv frames currently held by the caller
+    size_t _recv_outstanding = 0;
+
+    std::vector<shmem_frame_buff> _recv_buffs;
+    std::vector<shmem_frame_buff> _send_buffs;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
@@ -12,7 +12,16 @@
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/tasks.hpp>
 #include <uhdlib/transport/tx_streamer_zero_copy.hpp>
+#include <uhdlib/utils/tick_converter.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -115,6 +124,34 @@ public:
             _spp = stream_args.args.cast<size_t>("spp", _spp);
             _mtu = _spp * _convert_info.bytes_per_otw_item;
         }
+
+        // Pipelined conversion: a worker thread converts the next packet
+        // while this thread releases the previous one to the wire, so
+        // conversion and transmission overlap instead of strictly
+        // alternating within a send() call
+        if (stream_args.args.cast<bool>("convert_pipeline", false)) {
+            for (auto& slot : _pipe_slots) {
+                slot.in_ptrs.resize(num_chans);
+                slot.out_buffs.resize(num_chans);
+            }
+            _pipe_enabled = true;
+            _pipe_worker  = std::thread([this]() { _pipe_worker_loop(); });
+        }
+    }
+
+    ~tx_streamer_impl() override
+    {
+        if (_pipe_worker.joinable()) {
+            // A packet can still be pending if the last send() bailed out
+            // early; push it to the wire before tearing down
+            _pipe_flush();
+            {
+                std::lock_guard<std::mutex> lock(_pipe_mutex);
+                _pipe_shutdown = true;
+                _pipe_cv.notify_all();
+            }
+            _pipe_worker.join();
+        }
     }
 
     virtual void connect_channel(const size_t channel, typename transport_t::uptr xport)
@@ -149,6 +186,32 @@ public:
         const size_t nsamps_per_buff,
         const uhd::tx_metadata_t& metadata_,
         const double timeout)
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        const size_t num_sent = _send(buffs, nsamps_per_buff, metadata_, timeout);
+
+        _stats.num_calls++;
+        // The only early exit from the send loop is a failure to get a send
+        // buffer, so a short return means the call spent its time waiting
+        // on flow control credit or a free frame
+        _record_call_time(start_time, num_sent < nsamps_per_buff);
+
+        return num_sent;
+    }
+
+    //! Implementation of tx_streamer API method
+    stream_stats_t get_stream_stats() const
+    {
+        return _stats;
+    }
+
+private:
+    //! Body of send(), wrapped so the public method can update statistics
+    size_t _send(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata_,
+        const double timeout)
     {
         uhd::tx_metadata_t metadata(metadata_);
 
@@ -242,7 +305,7 @@ public:
                 metadata.end_of_burst =
                     (eob_on_last_packet and nsamps_to_send == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
+                num_samps_sent = _send_data_packet(
                     buffs, total_nsamps_sent, nsamps_to_send, metadata, eov, timeout_ms);
 
                 metadata.start_of_burst = false;
@@ -256,7 +319,7 @@ public:
                 metadata.end_of_burst = false;
 
                 for (size_t i = 0; i < num_fragments; i++) {
-                    num_samps_sent = _send_one_packet(
+                    num_samps_sent = _send_data_packet(
                         buffs, total_nsamps_sent, _spp, metadata, false, timeout_ms);
 
                     // Advance sample accumulator and decrement remaining
@@ -265,14 +328,16 @@ public:
                     nsamps_to_send_remaining -= num_samps_sent;
 
                     if (num_samps_sent == 0) {
+                        if (_pipe_enabled) {
+                            _pipe_flush();
+                        }
                         return total_nsamps_sent;
                     }
 
                     // Setup timespec for the next fragment
                     if (metadata.has_time_spec) {
                         metadata.time_spec =
-                            metadata.time_spec
-                            + time_spec_t::from_ticks(num_samps_sent, _samp_rate);
+                            metadata.time_spec + _samp_conv.from_ticks(num_samps_sent);
                     }
 
                     metadata.start_of_burst = false;
@@ -282,7 +347,7 @@ public:
                 metadata.end_of_burst =
                     (eob_on_last_packet and final_length == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
+                num_samps_sent = _send_data_packet(
                     buffs, total_nsamps_sent, final_length, metadata, eov, timeout_ms);
             }
 
@@ -301,14 +366,19 @@ public:
             // metadata for the next fragment (if desired)
             if (nsamps_to_send_remaining > 0 and metadata.has_time_spec) {
                 metadata.time_spec =
-                    metadata.time_spec
-                    + time_spec_t::from_ticks(num_samps_sent, _samp_rate);
+                    metadata.time_spec + _samp_conv.from_ticks(num_samps_sent);
             }
 
             last_eov_position = total_nsamps_sent;
 
         } while (nsamps_to_send_remaining > 0);
 
+        // The last packet may still be converting on the worker; it must hit
+        // the wire before send() returns, since the caller may reuse buffs
+        if (_pipe_enabled) {
+            _pipe_flush();
+        }
+
         return total_nsamps_sent;
     }
 
@@ -342,6 +412,7 @@ protected:
     void set_samp_rate(const double rate)
     {
         _samp_rate = rate;
+        _samp_conv.set_tick_rate(rate);
     }
 
     //! Configures tick rate for conversion of timestamp
@@ -359,6 +430,139 @@ private:
         size_t otw_item_bit_width;
     };
 
+    //! Send one data packet through the pipelined or the plain path
+    UHD_FORCE_INLINE size_t _send_data_packet(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_in_samps,
+        const size_t num_samples,
+        const tx_metadata_t& metadata,
+        const bool eov,
+        const int32_t timeout_ms)
+    {
+        if (_pipe_enabled) {
+            return _send_one_packet_pipelined(
+                buffs, buffer_offset_in_samps, num_samples, metadata, eov, timeout_ms);
+        }
+        return _send_one_packet(
+            buffs, buffer_offset_in_samps, num_samples, metadata, eov, timeout_ms);
+    }
+
+    /*! Pipelined variant of _send_one_packet()
+     *
+     * The conversion of this packet is handed to the worker thread, and
+     * while it runs, the previous packet (whose conversion finished in the
+     * meantime) is released to the wire. Packets are released in order, and
+     * at most one packet is pending when this method returns; _pipe_flush()
+     * pushes it out before send() returns to the caller.
+     */
+    size_t _send_one_packet_pipelined(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_in_samps,
+        const size_t num_samples,
+        const tx_metadata_t& metadata,
+        const bool eov,
+        const int32_t timeout_ms)
+    {
+        assert(buffs.size() == get_num_channels());
+
+        const size_t slot_idx = _pipe_next;
+        pipe_slot_t& slot     = _pipe_slots[slot_idx];
+
+        // The packet header is written here, so metadata is latched before
+        // the conversion is dispatched
+        if (!_zero_copy_streamer.get_send_buffs(
+                slot.out_buffs, num_samples, metadata, eov, timeout_ms, slot_idx)) {
+            return 0;
+        }
+
+        const size_t byte_offset =
+            buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            slot.in_ptrs[i] = static_cast<const uint8_t*>(buffs[i]) + byte_offset;
+        }
+        slot.num_samples = num_samples;
+
+        {
+            std::lock_guard<std::mutex> lock(_pipe_mutex);
+            slot.done = false;
+            _pipe_jobs.push_back(slot_idx);
+            _pipe_cv.notify_one();
+        }
+        slot.pending = true;
+
+        // While the worker converts this packet, wait out and release the
+        // previous one; this is where transmission overlaps conversion
+        const size_t prev_idx = slot_idx ^ 1;
+        if (_pipe_slots[prev_idx].pending) {
+            _pipe_wait_and_release(prev_idx);
+        }
+        _pipe_next = prev_idx;
+
+        _stats.num_packets += get_num_channels();
+        _stats.num_bytes +=
+            num_samples * _convert_info.bytes_per_otw_item * get_num_channels();
+
+        return num_samples;
+    }
+
+    //! Wait for the worker to finish converting a slot, then send it
+    void _pipe_wait_and_release(const size_t slot_idx)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_pipe_mutex);
+            _pipe_done_cv.wait(
+                lock, [this, slot_idx]() { return _pipe_slots[slot_idx].done; });
+        }
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            _zero_copy_streamer.release_send_buff(i, slot_idx);
+        }
+        _pipe_slots[slot_idx].pending = false;
+    }
+
+    //! Release any packet still in the pipeline
+    void _pipe_flush()
+    {
+        for (size_t slot_idx = 0; slot_idx < _pipe_slots.size(); slot_idx++) {
+            if (_pipe_slots[slot_idx].pending) {
+                _pipe_wait_and_release(slot_idx);
+            }
+        }
+    }
+
+    //! Conversion worker: converts queued slots in FIFO order
+    void _pipe_worker_loop()
+    {
+        while (true) {
+            size_t slot_idx;
+            {
+                std::unique_lock<std::mutex> lock(_pipe_mutex);
+                _pipe_cv.wait(
+                    lock, [this]() { return _pipe_shutdown or !_pipe_jobs.empty(); });
+                if (_pipe_jobs.empty()) {
+                    return; // shutdown and drained
+                }
+                slot_idx = _pipe_jobs.front();
+                _pipe_jobs.pop_front();
+            }
+            pipe_slot_t& slot = _pipe_slots[slot_idx];
+
+            UHD_TRACEPOINT1(tx_convert_begin, slot.num_samples);
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                if (_conversion_is_identity) {
+                    std::memcpy(slot.out_buffs[i],
+                        slot.in_ptrs[i],
+                        slot.num_samples * _convert_info.bytes_per_otw_item);
+                } else {
+                    _converters[i]->conv(
+                        slot.in_ptrs[i], slot.out_buffs[i], slot.num_samples);
+                }
+            }
+            UHD_TRACEPOINT1(tx_convert_end, slot.num_samples);
+
+            std::lock_guard<std::mutex> lock(_pipe_mutex);
+            slot.done = true;
+            _pipe_done_cv.notify_one();
+        }
+    }
+
     //! Convert samples for one channel and sends a packet
     size_t _send_one_packet(const uhd::tx_streamer::buffs_type& buffs,
         const size_t buffer_offset_in_samps,
@@ -376,16 +580,57 @@ private:
 
         size_t byte_offset = buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
 
+        UHD_TRACEPOINT1(tx_convert_begin, num_samples);
         for (size_t i = 0; i < get_num_channels(); i++) {
             const void* input_ptr = static_cast<const uint8_t*>(buffs[i]) + byte_offset;
-            _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
+
+            if (_conversion_is_identity) {
+                // The registered converter would only memcpy; do it directly
+                // and skip the virtual dispatch on the packet hot path
+                std::memcpy(_out_buffs[i],
+                    input_ptr,
+                    num_samples * _convert_info.bytes_per_otw_item);
+            } else {
+                _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
+            }
 
             _zero_copy_streamer.release_send_buff(i);
         }
+        UHD_TRACEPOINT1(tx_convert_end, num_samples);
+
+        UHD_TRACEPOINT2(tx_packet, num_samples, get_num_channels());
+        _stats.num_packets += get_num_channels();
+        _stats.num_bytes +=
+            num_samples * _convert_info.bytes_per_otw_item * get_num_channels();
 
         return num_samples;
     }
 
+    //! Records the duration of one streamer call in the statistics
+    UHD_FORCE_INLINE void _record_call_time(
+        const std::chrono::steady_clock::time_point start_time, const bool timed_out)
+    {
+        using namespace std::chrono;
+
+        const uint64_t elapsed_ns =
+            duration_cast<nanoseconds>(steady_clock::now() - start_time).count();
+
+        // Bucket index is the position of the highest set bit of the
+        // duration in microseconds, clamped to the last bucket
+        uint64_t us   = elapsed_ns / 1000;
+        size_t bucket = 0;
+        while (us > 1 and bucket < stream_stats_t::NUM_LATENCY_BUCKETS - 1) {
+            us >>= 1;
+            bucket++;
+        }
+        _stats.call_latency_hist[bucket]++;
+
+        if (timed_out) {
+            _stats.num_timeouts++;
+            _stats.stall_time_ns += elapsed_ns;
+        }
+    }
+
     //! Create converters and initialize _bytes_per_cpu_item
     void _setup_converters(const size_t num_chans, const uhd::stream_args_t stream_args)
     {
@@ -417,6 +662,11 @@ private:
 
         _convert_info = info;
 
+        // When the CPU format matches the wire format, the registered chdr
+        // converter is a plain memcpy (the scale factor does not apply), so
+        // the send path can copy samples straight into the transport frame
+        _conversion_is_identity = (stream_args.cpu_format == stream_args.otw_format);
+
         for (size_t i = 0; i < num_chans; i++) {
             _converters.push_back(convert::get_converter(id)());
             _converters.back()->set_scalar(32767.0);
@@ -429,6 +679,9 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // True when CPU and wire formats match and conversion is a plain copy
+    bool _conversion_is_identity = false;
+
     // Manages frame buffers and packet info
     tx_streamer_zero_copy<transport_t> _zero_copy_streamer;
 
@@ -443,6 +696,9 @@ private:
     // Sample rate used to calculate metadata time_spec_t
     double _samp_rate = 1.0;
 
+    // Tick-native converter at the sample rate, for fragment timestamps
+    tick_converter _samp_conv;
+
     // MTU, determined when xport is connected and modifiable by subclass
     size_t _mtu = std::numeric_limits<std::size_t>::max();
 
@@ -451,6 +707,34 @@ private:
 
     // Metadata cache for send calls with no data
     detail::tx_metadata_cache _metadata_cache;
+
+    // Statistics updated on the packet path; send() is single-threaded by
+    // contract, so plain counters suffice
+    stream_stats_t _stats;
+
+    // State of one pipelined packet: input pointers, destination frame
+    // buffers (slot N of the zero copy streamer) and completion flags. All
+    // flag transitions happen under _pipe_mutex; the pointers are only
+    // touched while the slot is neither queued nor converting.
+    struct pipe_slot_t
+    {
+        std::vector<const void*> in_ptrs;
+        std::vector<void*> out_buffs;
+        size_t num_samples = 0;
+        bool done          = false;
+        bool pending       = false;
+    };
+
+    // Pipelined conversion state (see _send_one_packet_pipelined())
+    bool _pipe_enabled = false;
+    std::array<pipe_slot_t, tx_streamer_zero_copy<transport_t>::NUM_SLOTS> _pipe_slots;
+    size_t _pipe_next = 0;
+    std::mutex _pipe_mutex;
+    std::condition_variable _pipe_cv;
+    std::condition_variable _pipe_done_cv;
+    std::deque<size_t> _pipe_jobs;
+    bool _pipe_shutdown = false;
+    std::thread _pipe_worker;
 };
 
 }} // namespace uhd::transport
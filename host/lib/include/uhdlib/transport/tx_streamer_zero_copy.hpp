@@ -9,6 +9,7 @@
 #include <uhd/config.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
+#include <uhdlib/utils/tick_converter.hpp>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -22,9 +23,15 @@ template <typename transport_t>
 class tx_streamer_zero_copy
 {
 public:
+    //! Number of frame buffer slots held per channel. The streamer's
+    //  pipelined conversion path keeps the previous packet's frames alive
+    //  (one slot) while the next packet is acquired and converted into the
+    //  other slot; the plain path only ever uses slot 0.
+    static constexpr size_t NUM_SLOTS = 2;
+
     //! Constructor
     tx_streamer_zero_copy(const size_t num_chans)
-        : _xports(num_chans), _frame_buffs(num_chans)
+        : _xports(num_chans), _frame_buffs(num_chans * NUM_SLOTS)
     {
     }
 
@@ -60,6 +67,7 @@ public:
     void set_tick_rate(const double rate)
     {
         _tick_rate = rate;
+        _tick_conv.set_tick_rate(rate);
     }
 
     //! Configures the size of each sample
@@ -76,20 +84,22 @@ public:
      * \param metadata the metadata to write to the packet header
      * \param eov EOV flag to write to the packet header
      * \param timeout_ms timeout in milliseconds
+     * \param slot the frame buffer slot to store the buffers in
      * \return true if the operation was sucessful, false if timeout occurs
      */
     UHD_FORCE_INLINE bool get_send_buffs(std::vector<void*>& buffs,
         const size_t nsamps_per_buff,
         const tx_metadata_t& metadata,
         const bool eov,
-        const int32_t timeout_ms)
+        const int32_t timeout_ms,
+        const size_t slot = 0)
     {
         // Try to get a buffer per channel
         for (; _next_buff_to_get < _xports.size(); _next_buff_to_get++) {
-            _frame_buffs[_next_buff_to_get].first =
+            _frame_buffs[_next_buff_to_get * NUM_SLOTS + slot].first =
                 _xports[_next_buff_to_get]->get_send_buff(timeout_ms);
 
-            if (!_frame_buffs[_next_buff_to_get].first) {
+            if (!_frame_buffs[_next_buff_to_get * NUM_SLOTS + slot].first) {
                 return false;
             }
         }
@@ -102,7 +112,7 @@ public:
         info.has_tsf = metadata.has_time_spec;
 
         if (metadata.has_time_spec) {
-            info.tsf = metadata.time_spec.to_ticks(_tick_rate);
+            info.tsf = _tick_conv.to_ticks(metadata.time_spec);
         }
 
         info.payload_bytes = nsamps_per_buff * _bytes_per_item;
@@ -111,8 +121,9 @@ public:
 
         // Write packet header
         for (size_t i = 0; i < buffs.size(); i++) {
-            std::tie(buffs[i], _frame_buffs[i].second) =
-                _xports[i]->write_packet_header(_frame_buffs[i].first, info);
+            std::tie(buffs[i], _frame_buffs[i * NUM_SLOTS + slot].second) =
+                _xports[i]->write_packet_header(
+                    _frame_buffs[i * NUM_SLOTS + slot].first, info);
         }
 
         return true;
@@ -122,14 +133,16 @@ public:
      * Send the packet for the specified channel
      *
      * \param channel the channel for which to release the packet
+     * \param slot the frame buffer slot that holds the packet
      */
-    UHD_FORCE_INLINE void release_send_buff(const size_t channel)
+    UHD_FORCE_INLINE void release_send_buff(const size_t channel, const size_t slot = 0)
     {
-        _frame_buffs[channel].first->set_packet_size(_frame_buffs[channel].second);
-        _xports[channel]->release_send_buff(std::move(_frame_buffs[channel].first));
+        auto& frame_buff = _frame_buffs[channel * NUM_SLOTS + slot];
+        frame_buff.first->set_packet_size(frame_buff.second);
+        _xports[channel]->release_send_buff(std::move(frame_buff.first));
 
-        _frame_buffs[channel].first  = nullptr;
-        _frame_buffs[channel].second = 0;
+        frame_buff.first  = nullptr;
+        frame_buff.second = 0;
     }
 
 private:
@@ -142,6 +155,9 @@ private:
     // Rate used in conversion of timestamp to time_spec_t
     double _tick_rate = 1.0;
 
+    // Tick-native converter for the per-packet timestamp conversion
+    tick_converter _tick_conv;
+
     // Size of a sample on the device
     size_t _bytes_per_item = 0;
 
@@ -14,8 +14,13 @@
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <boost/asio.hpp>
+#include <array>
+#include <chrono>
 #include <memory>
 #include <vector>
+#if defined(UHD_PLATFORM_LINUX)
+#    include <sys/socket.h>
+#endif
 
 namespace uhd { namespace transport {
 
@@ -54,7 +59,8 @@ private:
 };
 
 class udp_boost_asio_link : public recv_link_base<udp_boost_asio_link>,
-                            public send_link_base<udp_boost_asio_link>
+                            public send_link_base<udp_boost_asio_link>,
+                            public sg_send_link_if
 {
 public:
     using sptr = std::shared_ptr<udp_boost_asio_link>;
@@ -103,6 +109,36 @@ public:
         return _adapter_id;
     }
 
+    /*!
+     * Send a packet gathered from the frame buffer's header bytes and a
+     * caller-owned payload, then release the buffer. See sg_send_link_if.
+     */
+    void release_send_buff_sg(frame_buff::uptr buff,
+        const void* payload,
+        const size_t payload_size) override
+    {
+        assert(buff);
+        if (_pacing_rate != 0) {
+            pace_send(buff->packet_size() + payload_size);
+        }
+        send_udp_packet_sg(
+            _sock_fd, buff->data(), buff->packet_size(), payload, payload_size);
+
+        // the packet went out via the gather path; a zero packet size tells
+        // the base class to re-pool the buffer without sending it again
+        buff->set_packet_size(0);
+        send_link_base_t::release_send_buff(std::move(buff));
+    }
+
+#if defined(UHD_PLATFORM_LINUX)
+    // On Linux, the recv side is batched: one recvmmsg syscall fills up to
+    // RECV_BATCH_SIZE frame buffers, which are then handed out one at a
+    // time. The overrides below replace the one-syscall-per-packet
+    // implementation in recv_link_base with a batch-aware free list.
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+    void release_recv_buff(frame_buff::uptr buff) override;
+#endif
+
 private:
     using recv_link_base_t = recv_link_base<udp_boost_asio_link>;
     using send_link_base_t = send_link_base<udp_boost_asio_link>;
@@ -137,9 +173,40 @@ private:
 
     UHD_FORCE_INLINE void release_send_buff_derived(frame_buff& buff)
     {
+        if (_pacing_rate != 0) {
+            pace_send(buff.packet_size());
+        }
         send_udp_packet(_sock_fd, buff.data(), buff.packet_size());
     }
 
+    //! Block until the token bucket has accrued nbytes, then consume them
+    void pace_send(const size_t nbytes);
+
+#if defined(UHD_PLATFORM_LINUX)
+    //! Maximum number of packets pulled in with one recvmmsg call
+    static constexpr size_t RECV_BATCH_SIZE = 16;
+
+    //! Per-message control buffer size for SCM_TIMESTAMPING records
+    static constexpr size_t RECV_CMSG_SIZE = 64;
+
+    //! Issue one recvmmsg for as many free buffers as are available
+    bool fill_recv_batch(int32_t timeout_ms);
+
+    //! Best-effort request for RX timestamps on the socket
+    void enable_rx_timestamps();
+
+    // Free and filled-but-unclaimed buffers for the batched recv path
+    std::vector<frame_buff*> _recv_free;
+    std::vector<frame_buff*> _recv_pending;
+    size_t _recv_pending_head = 0;
+
+    // Scatter/gather structures reused across recvmmsg calls
+    std::vector<frame_buff*> _batch_buffs;
+    std::vector<::mmsghdr> _msgs;
+    std::vector<::iovec> _iovs;
+    std::vector<std::array<char, RECV_CMSG_SIZE>> _cmsg_bufs;
+#endif
+
     buffer_pool::sptr _recv_memory_pool;
     buffer_pool::sptr _send_memory_pool;
 
@@ -150,6 +217,13 @@ private:
     std::shared_ptr<boost::asio::ip::udp::socket> _socket;
     int _sock_fd;
     adapter_id_t _adapter_id;
+
+    // Token bucket for optional transmit pacing. The send path is
+    // single-threaded per link, so the bucket needs no locking.
+    const size_t _pacing_rate; // bytes per second, 0 = unpaced
+    double _pacing_tokens       = 0.0;
+    double _pacing_bucket_depth = 0.0;
+    std::chrono::steady_clock::time_point _pacing_last_refill;
 };
 
 }} // namespace uhd::transport
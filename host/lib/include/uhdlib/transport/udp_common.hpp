@@ -11,12 +11,14 @@
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/constants.hpp>
+#include <uhd/transport/udp_simple.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <boost/asio.hpp>
 #include <boost/format.hpp>
+#include <cstring>
 #include <thread>
 
 namespace uhd { namespace transport {
@@ -147,6 +149,63 @@ UHD_INLINE void send_udp_packet(int sock_fd, void* mem, size_t len)
     }
 }
 
+/*!
+ * Send a single UDP packet gathered from a header and a separate payload.
+ * The kernel assembles the datagram from both pieces, so the payload does
+ * not need to be copied into the header's buffer first. Neither piece is
+ * referenced after this call returns.
+ */
+UHD_INLINE void send_udp_packet_sg(int sock_fd,
+    void* header,
+    size_t header_len,
+    const void* payload,
+    size_t payload_len)
+{
+    const size_t total_len = header_len + payload_len;
+
+#ifdef UHD_PLATFORM_WIN32
+    WSABUF bufs[2];
+    bufs[0].buf = (CHAR*)header;
+    bufs[0].len = (ULONG)header_len;
+    bufs[1].buf = (CHAR*)const_cast<void*>(payload);
+    bufs[1].len = (ULONG)payload_len;
+
+    DWORD num_sent = 0;
+    if (WSASend(sock_fd, bufs, 2, &num_sent, 0, NULL, NULL) != 0) {
+        throw uhd::io_error(str(
+            boost::format("send error on socket: %d") % WSAGetLastError()));
+    }
+    UHD_ASSERT_THROW(num_sent == total_len);
+#else
+    ::iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len  = header_len;
+    iov[1].iov_base = const_cast<void*>(payload);
+    iov[1].iov_len  = payload_len;
+
+    ::msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov    = iov;
+    msg.msg_iovlen = 2;
+
+    // Retry logic because send may fail with ENOBUFS, as above
+    while (true) {
+        const ssize_t ret = uhd::narrow_cast<ssize_t>(::sendmsg(sock_fd, &msg, 0));
+        if (ret == ssize_t(total_len))
+            break;
+        if (ret == -1 and errno == ENOBUFS) {
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            continue; // try to send again
+        }
+        if (ret == -1) {
+            throw uhd::io_error(
+                str(boost::format("sendmsg error on socket: %s") % strerror(errno)));
+        }
+        UHD_ASSERT_THROW(ret == ssize_t(total_len));
+    }
+#endif
+}
+
 template <typename Opt>
 size_t get_udp_socket_buffer_size(socket_sptr socket)
 {
@@ -243,6 +302,8 @@ inline link_params_t calculate_udp_link_params(
         device_args.cast<size_t>("send_buff_size", default_link_params.send_buff_size);
     link_params.recv_buff_size =
         device_args.cast<size_t>("recv_buff_size", default_link_params.recv_buff_size);
+    link_params.send_pacing_rate = device_args.cast<size_t>(
+        "send_pacing_rate", default_link_params.send_pacing_rate);
 
     // Now apply stream-level overrides based on the link type.
     if (link_type == link_type_t::CTRL) {
@@ -250,6 +311,21 @@ inline link_params_t calculate_udp_link_params(
         // configured.
         link_params.num_recv_frames =
             uhd::rfnoc::CMD_FIFO_SIZE / uhd::rfnoc::MAX_CMD_PKT_SIZE;
+        // The default frame sizes are tuned for bulk data, but the control
+        // link only ever carries management and control packets, all of
+        // which fit in a standard Ethernet frame. The control transport is
+        // shared by every streamer on this link, so cap its frame pools
+        // (and the socket buffers backing them) to avoid pinning several
+        // data-sized buffers per direction for the life of the session.
+        const size_t ctrl_frame_size = uhd::transport::udp_simple::mtu;
+        link_params.send_frame_size =
+            std::min(link_params.send_frame_size, ctrl_frame_size);
+        link_params.recv_frame_size =
+            std::min(link_params.recv_frame_size, ctrl_frame_size);
+        link_params.send_buff_size = std::min(link_params.send_buff_size,
+            link_params.num_send_frames * link_params.send_frame_size);
+        link_params.recv_buff_size = std::min(link_params.recv_buff_size,
+            link_params.num_recv_frames * link_params.recv_frame_size);
     } else if (link_type == link_type_t::TX_DATA) {
         // Note that the send frame size will be capped to the Tx MTU.
         link_params.send_frame_size = link_args.cast<size_t>("send_frame_size",
@@ -258,6 +334,8 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("num_send_frames", link_params.num_send_frames);
         link_params.send_buff_size =
             link_args.cast<size_t>("send_buff_size", link_params.send_buff_size);
+        link_params.send_pacing_rate =
+            link_args.cast<size_t>("send_pacing_rate", link_params.send_pacing_rate);
     } else if (link_type == link_type_t::RX_DATA) {
         // Note that the receive frame size will be capped to the Rx MTU.
         link_params.recv_frame_size = link_args.cast<size_t>("recv_frame_size",
@@ -257,7 +257,7 @@ private:
     adapter_id_t _adapter_id;
     //! The RX frame buff list head
     dpdk::dpdk_frame_buff* _recv_buff_head = nullptr;
-    // TODO: Implement ability to use multiple queues
+    //! The TX DMA queue assigned to this link by its port
     dpdk::queue_id_t _queue = 0;
 };
 
@@ -0,0 +1,274 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <winsock2.h>
+#include <mswsock.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * A frame buffer backed by a slot in a RIO-registered buffer region
+ */
+class udp_rio_frame_buff : public frame_buff
+{
+public:
+    udp_rio_frame_buff(void* mem, const size_t index) : _index(index)
+    {
+        _data = mem;
+    }
+
+    size_t get_index() const
+    {
+        return _index;
+    }
+
+private:
+    //! Index of this frame within its registered buffer region
+    size_t _index;
+};
+
+class udp_rio_adapter_info : public adapter_info
+{
+public:
+    udp_rio_adapter_info(const std::string& src_ip) : _src_ip(src_ip) {}
+
+    ~udp_rio_adapter_info() {}
+
+    std::string to_string()
+    {
+        return std::string("Ethernet(kernel):") + _src_ip;
+    }
+
+    bool operator==(const udp_rio_adapter_info& rhs) const
+    {
+        return (_src_ip == rhs._src_ip);
+    }
+
+private:
+    // Use source IP addr
+    std::string _src_ip;
+};
+
+/*!
+ * A zero-copy UDP link using Winsock Registered I/O (RIO)
+ *
+ * The frame buffers are registered with the socket layer once at
+ * construction, so the kernel can DMA packet data directly in and out of
+ * them without per-packet buffer probing and locking. Receives are kept
+ * posted for every frame buffer, and completions are dequeued in batches
+ * from user mode, replacing the per-packet overlapped completions of the
+ * WSA transport.
+ *
+ * Completions are polled rather than waited on: get_recv_buff spins
+ * briefly and then sleeps in 1 ms steps until its timeout, so an idle
+ * link does not pin a core. RIO request queues are not thread safe, and
+ * the single queue is shared by both directions, so posts (but not
+ * completion dequeues) are serialized with a spinlock.
+ */
+class udp_rio_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr = std::shared_ptr<udp_rio_link>;
+
+    /*!
+     * Make a new RIO UDP link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes, num frames, and buffer sizes
+     * \param[out] recv_socket_buff_size Returns the recv socket buffer size
+     * \param[out] send_socket_buff_size Returns the send socket buffer size
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        size_t& recv_socket_buff_size,
+        size_t& send_socket_buff_size);
+
+    ~udp_rio_link();
+
+    /*!
+     * Get the number of frame buffers that can be queued by this link.
+     */
+    size_t get_num_recv_frames() const
+    {
+        return _num_recv_frames;
+    }
+
+    /*!
+     * Get the maximum capacity of a frame buffer.
+     */
+    size_t get_recv_frame_size() const
+    {
+        return _recv_frame_size;
+    }
+
+    /*!
+     * Receive a packet and return a frame buffer containing the packet data.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms);
+
+    /*!
+     * Release a frame buffer, allowing the link driver to reuse it.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_recv_buff(frame_buff::uptr buff);
+
+    /*!
+     * Get the number of frame buffers that can be queued by this link.
+     */
+    size_t get_num_send_frames() const
+    {
+        return _num_send_frames;
+    }
+
+    /*!
+     * Get the maximum capacity of a frame buffer.
+     */
+    size_t get_send_frame_size() const
+    {
+        return _send_frame_size;
+    }
+
+    /*!
+     * Get an empty frame buffer in which to write packet contents.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_send_buff(int32_t timeout_ms);
+
+    /*!
+     * Send a packet with the contents of the frame buffer and release the
+     * buffer, allowing the link driver to reuse it. If the size of the frame
+     * buffer is 0, the buffer is released with no packet being sent.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_send_buff(frame_buff::uptr buff);
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Returns whether this link type supports releasing the frame buffers
+     * in an order different from that in which they were acquired.
+     */
+    bool supports_send_buff_out_of_order() const
+    {
+        return true;
+    }
+
+    /*!
+     * Returns whether this link type supports releasing the frame buffers
+     * in an order different from that in which they were acquired.
+     */
+    bool supports_recv_buff_out_of_order() const
+    {
+        return true;
+    }
+
+private:
+    udp_rio_link(
+        const std::string& addr, const std::string& port, const link_params_t& params);
+
+    //! Post (or repost) a receive for the given frame buffer
+    void post_recv(udp_rio_frame_buff* buff);
+
+    //! Dequeue a batch of receive completions into _recv_pending
+    bool dequeue_recv_completions();
+
+    //! Return completed send buffers to the free list
+    void reap_send_completions();
+
+    //! Briefly hold the request queue spinlock around a post
+    class rq_lock_guard
+    {
+    public:
+        rq_lock_guard(std::atomic_flag& flag) : _flag(flag)
+        {
+            while (_flag.test_and_set(std::memory_order_acquire)) {
+                // spin: posts are a few hundred ns
+            }
+        }
+        ~rq_lock_guard()
+        {
+            _flag.clear(std::memory_order_release);
+        }
+
+    private:
+        std::atomic_flag& _flag;
+    };
+
+    size_t _num_recv_frames;
+    size_t _recv_frame_size;
+    size_t _num_send_frames;
+    size_t _send_frame_size;
+
+    buffer_pool::sptr _recv_memory_pool;
+    buffer_pool::sptr _send_memory_pool;
+
+    std::vector<udp_rio_frame_buff> _recv_buffs;
+    std::vector<udp_rio_frame_buff> _send_buffs;
+
+    // Completed-but-unclaimed receives from the last batched dequeue
+    std::vector<frame_buff*> _recv_pending;
+    size_t _recv_pending_head = 0;
+
+    // Send buffers not currently in flight
+    std::vector<frame_buff*> _send_free;
+    size_t _sends_in_flight = 0;
+
+    SOCKET _socket = INVALID_SOCKET;
+    RIO_EXTENSION_FUNCTION_TABLE _rio;
+    RIO_CQ _recv_cq = RIO_INVALID_CQ;
+    RIO_CQ _send_cq = RIO_INVALID_CQ;
+    RIO_RQ _rq      = RIO_INVALID_RQ;
+    RIO_BUFFERID _recv_bufid = RIO_INVALID_BUFFERID;
+    RIO_BUFFERID _send_bufid = RIO_INVALID_BUFFERID;
+
+    // One RIO_BUF slice per frame, reused across posts
+    std::vector<RIO_BUF> _recv_rio_bufs;
+    std::vector<RIO_BUF> _send_rio_bufs;
+
+    std::atomic_flag _rq_flag = ATOMIC_FLAG_INIT;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
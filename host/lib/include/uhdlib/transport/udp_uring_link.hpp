@@ -0,0 +1,161 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <liburing.h>
+#include <boost/asio.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+//! Frame buffer that remembers its slot in the ring's registered buffer table
+class udp_uring_frame_buff : public frame_buff
+{
+public:
+    udp_uring_frame_buff(void* mem, const size_t index) : _index(index)
+    {
+        _data = mem;
+    }
+
+    size_t get_index() const
+    {
+        return _index;
+    }
+
+private:
+    size_t _index;
+};
+
+/*!
+ * A kernel-bypass-adjacent UDP transport built on io_uring.
+ *
+ * Unlike udp_dpdk_link, the NIC stays under kernel control and can be
+ * shared with other applications; the throughput win comes from keeping
+ * receives posted ahead of packet arrival, pinning the frame buffers in
+ * the kernel via registered buffers, and batching submissions so that
+ * steady-state operation amortizes to well under one syscall per packet
+ * (or zero with SQPOLL). Receive and send each use a private ring, so
+ * the usual one-recv-thread/one-send-thread streamer model needs no
+ * locking.
+ */
+class udp_uring_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr = std::shared_ptr<udp_uring_link>;
+
+    ~udp_uring_link();
+
+    /*!
+     * Make a new io_uring UDP link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes, num frames, and buffer sizes
+     * \param use_sqpoll request a kernel submission-polling thread
+     *                   (IORING_SETUP_SQPOLL); requires an appropriate
+     *                   kernel and privileges, falls back with a warning
+     * \param[out] recv_socket_buff_size Returns the recv socket buffer size
+     * \param[out] send_socket_buff_size Returns the send socket buffer size
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const bool use_sqpoll,
+        size_t& recv_socket_buff_size,
+        size_t& send_socket_buff_size);
+
+    // recv_link_if
+    size_t get_num_recv_frames() const override
+    {
+        return _num_recv_frames;
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _recv_frame_size;
+    }
+
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+    void release_recv_buff(frame_buff::uptr buff) override;
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    // send_link_if
+    size_t get_num_send_frames() const override
+    {
+        return _num_send_frames;
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _send_frame_size;
+    }
+
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override;
+    void release_send_buff(frame_buff::uptr buff) override;
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    udp_uring_link(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const bool use_sqpoll);
+
+    //! Initialize one ring, downgrading from SQPOLL if the kernel refuses
+    void setup_ring(::io_uring& ring, const size_t num_entries, const bool use_sqpoll);
+
+    //! Queue a fixed-buffer read for the given recv frame
+    void post_recv(udp_uring_frame_buff* buff);
+
+    //! Harvest completed sends back onto the free list
+    void reap_send_completions(int32_t timeout_ms);
+
+    size_t resize_recv_socket_buffer(size_t num_bytes);
+    size_t resize_send_socket_buffer(size_t num_bytes);
+
+    const size_t _num_recv_frames;
+    const size_t _recv_frame_size;
+    const size_t _num_send_frames;
+    const size_t _send_frame_size;
+
+    buffer_pool::sptr _recv_memory_pool;
+    buffer_pool::sptr _send_memory_pool;
+
+    std::vector<udp_uring_frame_buff> _recv_buffs;
+    std::vector<udp_uring_frame_buff> _send_buffs;
+
+    //! Send frames not currently owned by the caller or in flight
+    std::vector<frame_buff*> _send_free;
+    //! Number of send frames handed to the kernel but not yet completed
+    size_t _sends_in_flight = 0;
+
+    ::io_uring _recv_ring;
+    ::io_uring _send_ring;
+
+    boost::asio::io_service _io_service;
+    std::shared_ptr<boost::asio::ip::udp::socket> _socket;
+    int _sock_fd;
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,212 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <bpf/xsk.h>
+#include <boost/asio.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+//! Frame buffer backed by one UMEM frame
+class xdp_frame_buff : public frame_buff
+{
+public:
+    xdp_frame_buff(const size_t index) : _index(index) {}
+
+    size_t get_index() const
+    {
+        return _index;
+    }
+
+    //! RX packets land at a kernel-chosen offset within the frame, so the
+    //! payload pointer is updated per packet
+    void set_data(void* data)
+    {
+        _data = data;
+    }
+
+private:
+    size_t _index;
+};
+
+class xdp_adapter_info : public adapter_info
+{
+public:
+    xdp_adapter_info(const std::string& iface, const size_t queue_index)
+        : _iface(iface), _queue_index(queue_index)
+    {
+    }
+
+    ~xdp_adapter_info() {}
+
+    std::string to_string()
+    {
+        return std::string("XDP:") + _iface + ":" + std::to_string(_queue_index);
+    }
+
+private:
+    std::string _iface;
+    size_t _queue_index;
+};
+
+/*!
+ * A zero-copy UDP transport built on AF_XDP.
+ *
+ * Packets are DMAed by the NIC directly into UMEM frames that back the
+ * frame_buff objects handed to the caller, so the RX and TX hot paths
+ * copy nothing and make no syscalls beyond the occasional ring doorbell.
+ * Unlike DPDK, the interface stays bound to the kernel driver and only
+ * one NIC queue is claimed; steer the CHDR flow to that queue with
+ * ethtool --config-ntuple so unrelated traffic keeps flowing through
+ * the regular stack.
+ *
+ * Since AF_XDP operates below the kernel's IP stack, this link builds
+ * and strips the Ethernet/IPv4/UDP headers itself. A regular connected
+ * UDP socket is kept open for the lifetime of the link to reserve the
+ * local port and keep the kernel answering ARP for us.
+ */
+class xdp_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr = std::shared_ptr<xdp_link>;
+
+    ~xdp_link();
+
+    /*!
+     * Make a new AF_XDP link. Addressing is resolved through the kernel:
+     * the local IP and port come from a connected UDP socket, the local
+     * MAC from the interface, and the remote MAC from the ARP table.
+     *
+     * \param iface name of the network interface to attach to
+     * \param queue_index NIC queue to claim for this link
+     * \param remote_addr Remote IP address
+     * \param remote_port Remote UDP port
+     * \param params Values for frame sizes, num frames, and buffer sizes
+     * \return a shared_ptr to a new xdp link
+     */
+    static sptr make(const std::string& iface,
+        const size_t queue_index,
+        const std::string& remote_addr,
+        const std::string& remote_port,
+        const link_params_t& params);
+
+    // recv_link_if
+    size_t get_num_recv_frames() const override
+    {
+        return _num_recv_frames;
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _recv_frame_size;
+    }
+
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+    void release_recv_buff(frame_buff::uptr buff) override;
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    // send_link_if
+    size_t get_num_send_frames() const override
+    {
+        return _num_send_frames;
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _send_frame_size;
+    }
+
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override;
+    void release_send_buff(frame_buff::uptr buff) override;
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    //! Resolved addressing for the CHDR flow, used to synthesize headers
+    struct flow_info_t
+    {
+        std::array<uint8_t, 6> local_mac;
+        std::array<uint8_t, 6> remote_mac;
+        uint32_t local_ip; // network byte order
+        uint32_t remote_ip; // network byte order
+        uint16_t local_port; // network byte order
+        uint16_t remote_port; // network byte order
+    };
+
+    xdp_link(const std::string& iface,
+        const size_t queue_index,
+        const std::string& remote_addr,
+        const std::string& remote_port,
+        const link_params_t& params);
+
+    //! Resolve MAC/IP/port addressing for the flow through the kernel
+    void resolve_flow(const std::string& iface,
+        const std::string& remote_addr,
+        const std::string& remote_port);
+
+    //! Fill the header template shared by all send frames
+    void build_header_template();
+
+    //! Return a UMEM frame to the kernel's fill ring
+    void refill(const size_t frame_index);
+
+    //! Move completed sends from the completion ring back to the free list
+    void reap_tx_completions();
+
+    //! Ring the TX doorbell if the kernel requested a wakeup
+    void kick_tx();
+
+    //! Check that a received packet belongs to the CHDR flow
+    bool packet_matches_flow(const uint8_t* pkt, const size_t len) const;
+
+    const size_t _num_recv_frames;
+    const size_t _recv_frame_size;
+    const size_t _num_send_frames;
+    const size_t _send_frame_size;
+
+    flow_info_t _flow;
+    std::array<uint8_t, 42> _header_template; // eth + ipv4 + udp
+
+    void* _umem_area = nullptr;
+    size_t _umem_size;
+    ::xsk_umem* _umem   = nullptr;
+    ::xsk_socket* _xsk  = nullptr;
+    ::xsk_ring_prod _fill_ring;
+    ::xsk_ring_cons _comp_ring;
+    ::xsk_ring_cons _rx_ring;
+    ::xsk_ring_prod _tx_ring;
+    int _xsk_fd = -1;
+
+    std::vector<xdp_frame_buff> _recv_buffs;
+    std::vector<xdp_frame_buff> _send_buffs;
+    std::vector<frame_buff*> _send_free;
+
+    // Keeps the local UDP port allocated and the ARP entry fresh
+    boost::asio::io_service _io_service;
+    std::shared_ptr<boost::asio::ip::udp::socket> _ctrl_socket;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
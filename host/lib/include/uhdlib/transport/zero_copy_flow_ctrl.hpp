@@ -0,0 +1,202 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/transport/zero_copy.hpp>
+#include <uhd/transport/zero_copy_flow_ctrl.hpp>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Compile-time flow control layer for zero_copy_if transports.
+ *
+ * In the spirit of link_base.hpp, the flow control policies are template
+ * parameters rather than std::function objects, so the policy hooks inline
+ * into the buffer path and disabled directions compile down to a plain
+ * pass-through with no per-buffer wrapping.
+ *
+ * A send policy provides:
+ *   - static const bool enabled
+ *       Whether this direction is flow controlled at all.
+ *   - static const bool has_release_hook
+ *       Whether on_send_release must run when the buffer is committed. Only
+ *       then is the buffer wrapped in an intermediate managed buffer.
+ *   - bool wait_for_send(double timeout)
+ *       Called before a buffer is requested from the transport. Return
+ *       false to give up (e.g. flow control timeout).
+ *   - void on_send_buff(managed_send_buffer::sptr&)
+ *       Called on each buffer handed out, e.g. to stamp a sequence word.
+ *   - bool on_send_release(managed_send_buffer::sptr&)
+ *       Called after commit; looped until it returns true.
+ *
+ * A recv policy provides:
+ *   - static const bool enabled
+ *   - bool on_recv_buff(managed_recv_buffer::sptr&)
+ *       Called on each received buffer; looped until it returns true.
+ */
+
+//! Pass-through send policy: no flow control on the send direction
+struct no_send_flow_ctrl_t
+{
+    static const bool enabled          = false;
+    static const bool has_release_hook = false;
+    bool wait_for_send(double)
+    {
+        return true;
+    }
+    void on_send_buff(managed_send_buffer::sptr&) {}
+    bool on_send_release(managed_send_buffer::sptr&)
+    {
+        return true;
+    }
+};
+
+//! Pass-through recv policy: no flow control on the recv direction
+struct no_recv_flow_ctrl_t
+{
+    static const bool enabled = false;
+    bool on_recv_buff(managed_recv_buffer::sptr&)
+    {
+        return true;
+    }
+};
+
+/*!
+ * Intermediate send buffer that runs the policy's release hook when the
+ * caller commits the buffer. Only instantiated for policies that declare
+ * has_release_hook.
+ */
+template <typename send_flow_ctrl_t>
+class flow_ctrl_msb_t : public managed_send_buffer
+{
+public:
+    flow_ctrl_msb_t(send_flow_ctrl_t& flow_ctrl) : _flow_ctrl(flow_ctrl)
+    {
+        /* NOP */
+    }
+
+    void release()
+    {
+        if (_mb) {
+            _mb->commit(size());
+            while (not _flow_ctrl.on_send_release(_mb)) {
+            }
+            _mb.reset();
+        }
+    }
+
+    UHD_INLINE sptr get(sptr& mb)
+    {
+        _mb = mb;
+        return make(this, _mb->cast<void*>(), _mb->size());
+    }
+
+private:
+    sptr _mb;
+    send_flow_ctrl_t& _flow_ctrl;
+};
+
+/*!
+ * Flow controlled wrapper around a zero_copy_if transport. The policy
+ * hooks are inlined into get_recv_buff/get_send_buff; directions whose
+ * policy is disabled pass the underlying buffers through untouched.
+ */
+template <typename send_flow_ctrl_t, typename recv_flow_ctrl_t>
+class zero_copy_flow_ctrl_t : public zero_copy_flow_ctrl
+{
+public:
+    zero_copy_flow_ctrl_t(zero_copy_if::sptr transport,
+        const send_flow_ctrl_t& send_flow_ctrl,
+        const recv_flow_ctrl_t& recv_flow_ctrl)
+        : _transport(transport)
+        , _send_flow_ctrl(send_flow_ctrl)
+        , _recv_flow_ctrl(recv_flow_ctrl)
+        , _send_buff_index(0)
+    {
+        if (send_flow_ctrl_t::has_release_hook) {
+            for (size_t i = 0; i < transport->get_num_send_frames(); i++) {
+                _send_buffers.push_back(
+                    std::make_shared<flow_ctrl_msb_t<send_flow_ctrl_t>>(
+                        _send_flow_ctrl));
+            }
+        }
+    }
+
+    managed_recv_buffer::sptr get_recv_buff(double timeout)
+    {
+        managed_recv_buffer::sptr buff = _transport->get_recv_buff(timeout);
+        if (recv_flow_ctrl_t::enabled and buff) {
+            while (not _recv_flow_ctrl.on_recv_buff(buff)) {
+            }
+        }
+        return buff;
+    }
+
+    size_t get_num_recv_frames() const
+    {
+        return _transport->get_num_recv_frames();
+    }
+
+    size_t get_recv_frame_size() const
+    {
+        return _transport->get_recv_frame_size();
+    }
+
+    managed_send_buffer::sptr get_send_buff(double timeout)
+    {
+        if (send_flow_ctrl_t::enabled and not _send_flow_ctrl.wait_for_send(timeout)) {
+            return managed_send_buffer::sptr();
+        }
+        managed_send_buffer::sptr buff = _transport->get_send_buff(timeout);
+        if (send_flow_ctrl_t::enabled and buff) {
+            _send_flow_ctrl.on_send_buff(buff);
+            if (send_flow_ctrl_t::has_release_hook) {
+                auto& mb = _send_buffers[_send_buff_index++];
+                _send_buff_index %= _send_buffers.size();
+                return mb->get(buff);
+            }
+        }
+        return buff;
+    }
+
+    size_t get_num_send_frames() const
+    {
+        return _transport->get_num_send_frames();
+    }
+
+    size_t get_send_frame_size() const
+    {
+        return _transport->get_send_frame_size();
+    }
+
+private:
+    // The underlying transport
+    zero_copy_if::sptr _transport;
+
+    // Flow control policies
+    send_flow_ctrl_t _send_flow_ctrl;
+    recv_flow_ctrl_t _recv_flow_ctrl;
+
+    // Intermediate send buffers, only populated when the send policy has a
+    // release hook
+    std::vector<std::shared_ptr<flow_ctrl_msb_t<send_flow_ctrl_t>>> _send_buffers;
+    size_t _send_buff_index;
+};
+
+//! Convenience factory deducing the policy types
+template <typename send_flow_ctrl_t, typename recv_flow_ctrl_t>
+zero_copy_flow_ctrl::sptr make_zero_copy_flow_ctrl(zero_copy_if::sptr transport,
+    const send_flow_ctrl_t& send_flow_ctrl,
+    const recv_flow_ctrl_t& recv_flow_ctrl)
+{
+    return std::make_shared<zero_copy_flow_ctrl_t<send_flow_ctrl_t, recv_flow_ctrl_t>>(
+        transport, send_flow_ctrl, recv_flow_ctrl);
+}
+
+}} // namespace uhd::transport
@@ -44,12 +44,18 @@ public:
     virtual ~ad9361_ctrl(void) {}
 
     //! make a new codec control object
+    //
+    // When \p skip_one_shot_cals is set, the initialization-time one-shot
+    // calibrations are deferred to the first tune. See also
+    // ad9361_device_t::initialize() and run_init_cals().
     static sptr make_spi(ad9361_params::sptr client_settings,
         uhd::spi_iface::sptr spi_iface,
-        uint32_t slave_num);
+        uint32_t slave_num,
+        const bool skip_one_shot_cals = false);
 
-    static sptr make_spi(
-        ad9361_params::sptr client_settings, ad9361_io::sptr spi_io_iface);
+    static sptr make_spi(ad9361_params::sptr client_settings,
+        ad9361_io::sptr spi_io_iface,
+        const bool skip_one_shot_cals = false);
 
     //! Get a list of gain names for RX or TX
     static std::vector<std::string> get_gain_names(const std::string& /*which*/)
@@ -145,6 +151,12 @@ public:
     //! read the internal temp sensor
     virtual sensor_value_t get_temperature() = 0;
 
+    //! re-run the initialization-time one-shot calibrations
+    //
+    // This is a no-op unless the underlying implementation drives the cal
+    // state machines from the host (i.e., the SPI-based control).
+    virtual void run_init_cals() {}
+
     //! List all available filters by name
     virtual std::vector<std::string> get_filter_names(const std::string& which) = 0;
 
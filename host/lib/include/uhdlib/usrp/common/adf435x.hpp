@@ -18,7 +18,11 @@
 #include <uhdlib/utils/narrow.hpp>
 #include <boost/math/special_functions/round.hpp>
 #include <boost/thread.hpp>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <utility>
 #include <vector>
 
 class adf435x_iface
@@ -144,11 +148,13 @@ public:
     void set_reference_freq(double fref)
     {
         _reference_freq = fref;
+        _tune_cache.clear();
     }
 
     void set_feedback_select(feedback_sel_t fb_sel)
     {
         _fb_after_divider = (fb_sel == FB_SEL_DIVIDED);
+        _tune_cache.clear();
     }
 
     void set_prescaler(prescaler_t prescaler)
@@ -160,6 +166,7 @@ public:
             _regs.prescaler = adf435x_regs_t::PRESCALER_4_5;
             _N_min          = 23;
         }
+        _tune_cache.clear();
     }
 
     void set_output_power(output_t output, output_power_t power)
@@ -260,6 +267,7 @@ public:
                                        ? adf435x_regs_t::LOW_NOISE_AND_SPUR_LOW_SPUR
                                        : adf435x_regs_t::LOW_NOISE_AND_SPUR_LOW_NOISE;
         _regs.phase_12_bit = (_tuning_mode == TUNING_MODE_HIGH_RESOLUTION) ? 0 : 1;
+        _tune_cache.clear();
     }
 
     void set_charge_pump_current(charge_pump_current_t cp_current)
@@ -364,6 +372,22 @@ public:
         static const double VCO_FREQ_MIN            = 2.2e9;
         static const double VCO_FREQ_MAX            = 4.4e9;
 
+        // Divider solutions depend only on the target frequency, the mode and
+        // the reference configuration (the cache is cleared when the latter
+        // changes), so they are memoized: repeated tunes to the same frequency
+        // (e.g. scan patterns and hop sets) skip the divider search below, and
+        // a warm-up pass over a known hop set precomputes the table.
+        static const size_t MAX_TUNE_CACHE_ENTRIES = 1024;
+        const tune_key_t tune_key(
+            static_cast<int64_t>(std::llround(target_freq)), int_n_mode);
+        const auto cached = _tune_cache.find(tune_key);
+        if (cached != _tune_cache.end()) {
+            _apply_tune_solution(cached->second, int_n_mode);
+            if (flush)
+                commit();
+            return cached->second.actual_freq;
+        }
+
         // Default invalid value for actual_freq
         double actual_freq = 0;
 
@@ -526,6 +550,22 @@ public:
         UHD_ASSERT_THROW(_regs.int_16_bit >= static_cast<uint16_t>(int_range.start()));
         UHD_ASSERT_THROW(_regs.int_16_bit <= static_cast<uint16_t>(int_range.stop()));
 
+        // Memoize the solution for subsequent tunes to the same frequency
+        if (_tune_cache.size() >= MAX_TUNE_CACHE_ENTRIES) {
+            _tune_cache.clear();
+        }
+        tune_solution_t& sol      = _tune_cache[tune_key];
+        sol.frac_12_bit           = _regs.frac_12_bit;
+        sol.int_16_bit            = _regs.int_16_bit;
+        sol.mod_12_bit            = _regs.mod_12_bit;
+        sol.clock_divider_12_bit  = _regs.clock_divider_12_bit;
+        sol.r_counter_10_bit      = _regs.r_counter_10_bit;
+        sol.band_select_clock_div = _regs.band_select_clock_div;
+        sol.rf_divider_select     = _regs.rf_divider_select;
+        sol.reference_divide_by_2 = _regs.reference_divide_by_2;
+        sol.reference_doubler     = _regs.reference_doubler;
+        sol.actual_freq           = actual_freq;
+
         if (flush)
             commit();
         return actual_freq;
@@ -553,12 +593,52 @@ protected:
     uhd::range_t _get_rfdiv_range();
     int _get_rfdiv_setting(uint16_t div);
 
+    //! The frequency dependent register values of one divider solution,
+    // memoized in _tune_cache (see set_frequency)
+    struct tune_solution_t
+    {
+        uint16_t frac_12_bit;
+        uint16_t int_16_bit;
+        uint16_t mod_12_bit;
+        uint16_t clock_divider_12_bit;
+        uint16_t r_counter_10_bit;
+        uint8_t band_select_clock_div;
+        typename adf435x_regs_t::rf_divider_select_t rf_divider_select;
+        typename adf435x_regs_t::reference_divide_by_2_t reference_divide_by_2;
+        typename adf435x_regs_t::reference_doubler_t reference_doubler;
+        double actual_freq;
+    };
+    //! Cache key: target frequency quantized to 1 Hz, and int-N mode
+    typedef std::pair<int64_t, bool> tune_key_t;
+
+    //! Load a memoized divider solution into the register soft copies
+    void _apply_tune_solution(const tune_solution_t& sol, const bool int_n_mode)
+    {
+        _regs.frac_12_bit          = sol.frac_12_bit;
+        _regs.int_16_bit           = sol.int_16_bit;
+        _regs.mod_12_bit           = sol.mod_12_bit;
+        _regs.clock_divider_12_bit = sol.clock_divider_12_bit;
+        _regs.feedback_select      = _fb_after_divider
+                                    ? adf435x_regs_t::FEEDBACK_SELECT_DIVIDED
+                                    : adf435x_regs_t::FEEDBACK_SELECT_FUNDAMENTAL;
+        _regs.clock_div_mode = _fb_after_divider
+                                   ? adf435x_regs_t::CLOCK_DIV_MODE_RESYNC_ENABLE
+                                   : adf435x_regs_t::CLOCK_DIV_MODE_FAST_LOCK;
+        _regs.r_counter_10_bit      = sol.r_counter_10_bit;
+        _regs.reference_divide_by_2 = sol.reference_divide_by_2;
+        _regs.reference_doubler     = sol.reference_doubler;
+        _regs.band_select_clock_div = sol.band_select_clock_div;
+        _regs.rf_divider_select     = sol.rf_divider_select;
+        _regs.ldf = int_n_mode ? adf435x_regs_t::LDF_INT_N : adf435x_regs_t::LDF_FRAC_N;
+    }
+
     write_fn_t _write_fn;
     adf435x_regs_t _regs;
     double _fb_after_divider;
     double _reference_freq;
     int _N_min;
     tuning_mode_t _tuning_mode;
+    std::map<tune_key_t, tune_solution_t> _tune_cache;
 };
 
 template <>
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/types/device_addr.hpp>
+#include <boost/optional.hpp>
 #include <map>
 
 namespace uhd { namespace usrp {
@@ -20,9 +21,13 @@ namespace uhd { namespace usrp {
  * send_offload: set to "true" to use an offload thread for TX_DATA links, "false"
  *               to use an inline I/O service.
  * recv_offload_wait_mode: set to "poll" to use a polling strategy in the offload
- *                         thread, set to "block" to use a blocking strategy.
+ *                         thread, set to "block" to use a blocking strategy, or
+ *                         set to "adaptive" to poll while busy and back off into
+ *                         sleeps when the link goes idle.
  * send_offload_wait_mode: set to "poll" to use a polling strategy in the offload
- *                         thread, set to "block" to use a blocking strategy.
+ *                         thread, set to "block" to use a blocking strategy, or
+ *                         set to "adaptive" to poll while busy and back off into
+ *                         sleeps when the link goes idle.
  * num_poll_offload_threads: set to the total number of offload threads to use for
  *                           RX_DATA and TX_DATA in this rfnoc_graph. New connections
  *                           always go to the offload thread containing the fewest
@@ -42,10 +47,58 @@ namespace uhd { namespace usrp {
  *                              thread. N indicates the thread instance, starting
  *                              with 0 and up to num_poll_offload_threads minus 1.
  *                              Only used if the I/O service is configured to poll.
+ * offload_thread_prio: a float between -1.0 (lowest) and +1.0 (highest) to set
+ *                      the scheduling priority of the offload threads at
+ *                      thread creation. When not specified, the threads
+ *                      inherit the scheduler settings of the calling thread,
+ *                      and the application can still adjust them after the
+ *                      fact. Combined with the thread CPU args above, this
+ *                      lets a config string fully determine thread placement;
+ *                      pinning a thread to the CPUs of one NUMA node also
+ *                      keeps its first-touch allocations on that node.
+ * offload_thread_policy: set to "realtime" to request a realtime (round-robin)
+ *                        scheduling policy for the offload threads, or
+ *                        "timeshare" for the default policy. Only used if
+ *                        offload_thread_prio is specified. Realtime
+ *                        scheduling usually requires elevated privileges; if
+ *                        the request fails, a warning is logged and the
+ *                        thread keeps the default policy.
+ * recv_busy_poll_spin: set to a value greater than 0 to busy-poll the receive
+ *                      link instead of blocking in the socket layer, trading a
+ *                      core for minimum packet pickup latency. The value is the
+ *                      number of non-blocking link polls between yields to the
+ *                      scheduler. Only used with an inline I/O service (i.e.
+ *                      recv_offload is false), and only for data links. The
+ *                      default is 0 (block between packets).
+ * offload_spin_count: number of idle loop iterations an "adaptive" offload
+ *                     thread busy-spins before backing off into progressively
+ *                     longer sleeps. Reaction to a new burst is sub-microsecond
+ *                     while spinning; larger values extend that window at the
+ *                     cost of CPU during idle gaps. The default is 10000.
+ * isolation_class: set to "latency" to give this stream's links a dedicated
+ *                  inline I/O service that busy-polls the receive link. All
+ *                  I/O then runs in the caller's thread and never touches a
+ *                  shared worker, so other streams cannot induce latency
+ *                  spikes on this one. Set to "bulk" to run the links on the
+ *                  shared pool of polling offload workers, which amortizes
+ *                  cores across throughput-oriented streams. The default
+ *                  ("default") leaves the choice to the recv_offload/
+ *                  send_offload args above. Since this is a stream arg, a
+ *                  latency-critical stream and bulk streams can coexist in
+ *                  one session with disjoint scheduling.
+ * shared_io_srv_mgr: set to "true" to share a single I/O service manager (and
+ *                    thus one set of offload worker threads) between all UHD
+ *                    sessions in this process that also set this arg. This is
+ *                    a device arg, not a stream arg; it is intended for
+ *                    applications that open one session per device but stream
+ *                    from all of them, e.g. through an aggregate streamer.
+ *                    The args of the first such session configure the shared
+ *                    manager.
  */
 struct io_service_args_t
 {
-    enum wait_mode_t { POLL, BLOCK };
+    enum wait_mode_t { POLL, BLOCK, ADAPTIVE };
+    enum isolation_class_t { ISOLATION_DEFAULT, ISOLATION_LATENCY, ISOLATION_BULK };
 
     //! Whether to offload streaming I/O to a worker thread
     bool recv_offload = false;
@@ -70,6 +123,27 @@ struct io_service_args_t
 
     //! CPU affinity of offload threads, if wait_mode is set to POLL
     std::map<size_t, size_t> poll_offload_thread_cpu;
+
+    //! Scheduling priority of offload threads, between -1.0 and +1.0, or
+    //! unset to leave the scheduler settings untouched
+    boost::optional<double> offload_thread_prio;
+
+    //! Whether to request a realtime scheduling policy for offload threads,
+    //! if offload_thread_prio is set
+    bool offload_thread_realtime = false;
+
+    //! Number of non-blocking link polls between yields when busy-polling
+    //! receive in an inline I/O service, or 0 to block between packets
+    size_t recv_busy_poll_spin = 0;
+
+    //! Number of idle iterations to busy-spin before backing off to sleeps,
+    //! if wait_mode is set to ADAPTIVE
+    size_t offload_spin_count = 10000;
+
+    //! Scheduling isolation class for this stream's data links: LATENCY
+    //! forces a dedicated busy-polling inline I/O service, BULK forces the
+    //! shared polling offload workers, DEFAULT defers to the offload args
+    isolation_class_t isolation_class = ISOLATION_DEFAULT;
 };
 
 /*! Reads I/O service args from provided dictionary
@@ -39,6 +39,15 @@ namespace uhd { namespace usrp {
  * there are multiple streamers, this manager creates a separate set of I/O
  * services for each streamer.
  *
+ * Streams may also request a scheduling isolation class through the
+ * isolation_class stream arg instead of picking offload options directly.
+ * "latency" pins the stream's links to a dedicated busy-polling inline I/O
+ * service (all I/O runs in the caller's thread, and no other stream's
+ * traffic is serviced on it), while "bulk" places the links on the shared
+ * pool of polling offload workers. This lets a latency-critical stream and
+ * high-throughput streams coexist in one session without the bulk traffic
+ * inducing latency spikes on the critical stream.
+ *
  * Offload I/O services have a number of restrictions that must be observed:
  * - Offload I/O services currently do not support links that require frame
  *   buffers to be released in order.
@@ -20,8 +20,11 @@
 #include <boost/assign.hpp>
 #include <boost/math/special_functions/round.hpp>
 #include <chrono>
+#include <cmath>
 #include <functional>
+#include <map>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 /**
@@ -250,8 +253,18 @@ protected:
     bool _write_all_regs;
 
 private:
+    //! A memoized divider solution of the tune algorithm
+    struct tune_solution_t
+    {
+        int T, D, R, BS, N, FRAC, MOD, RFdiv;
+        double actual_freq;
+    };
+    //! Tune inputs a solution depends on (frequencies quantized to 1 Hz)
+    typedef std::tuple<int64_t, int64_t, int64_t, bool, bool> tune_key_t;
+
     write_fn _write;
     bool _delay_after_write;
+    std::map<tune_key_t, tune_solution_t> _tune_cache;
 };
 
 /**
@@ -534,105 +547,141 @@ double max287x<max287x_regs_t>::set_frequency(
     double pfd_freq = target_pfd_freq;
     bool feedback_divided =
         (_regs.feedback_select == max287x_regs_t::FEEDBACK_SELECT_DIVIDED);
+    double actual_freq = 0.0;
 
-    // increase RF divider until acceptable VCO frequency (MIN freq for MAX287x VCO is
-    // 3GHz)
     UHD_ASSERT_THROW(target_freq > 0);
-    double vco_freq = target_freq;
-    while (vco_freq < MIN_VCO_FREQ) {
-        vco_freq *= 2;
-        RFdiv *= 2;
-    }
 
-    // The feedback frequency can be the fundamental VCO frequency or
-    // divided frequency.  The output divider for MAX287x is actually
-    // 2 dividers, but only the first (1/2/4/8/16) is included in the
-    // feedback loop.
-    int fb_divisor = feedback_divided ? (RFdiv > 16 ? 16 : RFdiv) : 1;
-
-    /*
-     * The goal here is to loop though possible R dividers,
-     * band select clock dividers, N (int) dividers, and FRAC
-     * (frac) dividers.
-     *
-     * Calculate the N and F dividers for each set of values.
-     * The loop exits when it meets all of the constraints.
-     * The resulting loop values are loaded into the registers.
-     *
-     * f_pfd = f_ref*(1+D)/(R*(1+T))
-     * f_vco = (N + (FRAC/MOD))*f_pfd
-     *     N = f_vco/f_pfd - FRAC/MOD = f_vco*((R*(T+1))/(f_ref*(1+D))) - FRAC/MOD
-     * f_rf  = f_vco/RFdiv
-     */
-    for (R = int(ref_freq * (1 + D) / (target_pfd_freq * (1 + T))); R <= r_range.stop();
-         R++) {
-        // PFD input frequency = f_ref/R ... ignoring Reference doubler/divide-by-2 (D &
-        // T)
-        pfd_freq = ref_freq * (1 + D) / (R * (1 + T));
-
-        // keep the PFD frequency at or below target
-        if (pfd_freq > target_pfd_freq)
-            continue;
-
-        // ignore fractional part of tuning
-        N = int((vco_freq / pfd_freq) / fb_divisor);
-
-        // Fractional-N calculation
-        FRAC = int(boost::math::round(((vco_freq / pfd_freq) / fb_divisor - N) * MOD));
-
-        if (is_int_n) {
-            if (FRAC
-                > (MOD / 2)) // Round integer such that actual freq is closest to target
-                N++;
-            FRAC = 0;
+    // The divider solution is a pure function of the tune parameters and the
+    // feedback select, so solutions are memoized: repeated tunes to the same
+    // frequency (e.g. scan patterns and hop sets) skip the search loops below.
+    // A warm-up pass over a known hop set effectively precomputes the table.
+    static const size_t MAX_TUNE_CACHE_ENTRIES = 1024;
+    const tune_key_t tune_key(static_cast<int64_t>(std::llround(target_freq)),
+        static_cast<int64_t>(std::llround(ref_freq)),
+        static_cast<int64_t>(std::llround(target_pfd_freq)),
+        is_int_n,
+        feedback_divided);
+    const auto cached = _tune_cache.find(tune_key);
+    if (cached != _tune_cache.end()) {
+        const tune_solution_t& sol = cached->second;
+        T                          = sol.T;
+        D                          = sol.D;
+        R                          = sol.R;
+        BS                         = sol.BS;
+        N                          = sol.N;
+        FRAC                       = sol.FRAC;
+        MOD                        = sol.MOD;
+        RFdiv                      = sol.RFdiv;
+        pfd_freq                   = ref_freq * (1 + D) / (R * (1 + T));
+        actual_freq                = sol.actual_freq;
+    } else {
+        // increase RF divider until acceptable VCO frequency (MIN freq for MAX287x VCO
+        // is 3GHz)
+        double vco_freq = target_freq;
+        while (vco_freq < MIN_VCO_FREQ) {
+            vco_freq *= 2;
+            RFdiv *= 2;
         }
 
-        // keep N within int divider requirements
-        if (is_int_n) {
-            if (N <= int_n_mode_div_range.start())
-                continue;
-            if (N >= int_n_mode_div_range.stop())
-                continue;
-        } else {
-            if (N <= frac_n_mode_div_range.start())
-                continue;
-            if (N >= frac_n_mode_div_range.stop())
+        // The feedback frequency can be the fundamental VCO frequency or
+        // divided frequency.  The output divider for MAX287x is actually
+        // 2 dividers, but only the first (1/2/4/8/16) is included in the
+        // feedback loop.
+        int fb_divisor = feedback_divided ? (RFdiv > 16 ? 16 : RFdiv) : 1;
+
+        /*
+         * The goal here is to loop though possible R dividers,
+         * band select clock dividers, N (int) dividers, and FRAC
+         * (frac) dividers.
+         *
+         * Calculate the N and F dividers for each set of values.
+         * The loop exits when it meets all of the constraints.
+         * The resulting loop values are loaded into the registers.
+         *
+         * f_pfd = f_ref*(1+D)/(R*(1+T))
+         * f_vco = (N + (FRAC/MOD))*f_pfd
+         *     N = f_vco/f_pfd - FRAC/MOD = f_vco*((R*(T+1))/(f_ref*(1+D))) - FRAC/MOD
+         * f_rf  = f_vco/RFdiv
+         */
+        for (R = int(ref_freq * (1 + D) / (target_pfd_freq * (1 + T)));
+             R <= r_range.stop();
+             R++) {
+            // PFD input frequency = f_ref/R ... ignoring Reference doubler/divide-by-2
+            // (D & T)
+            pfd_freq = ref_freq * (1 + D) / (R * (1 + T));
+
+            // keep the PFD frequency at or below target
+            if (pfd_freq > target_pfd_freq)
                 continue;
+
+            // ignore fractional part of tuning
+            N = int((vco_freq / pfd_freq) / fb_divisor);
+
+            // Fractional-N calculation
+            FRAC =
+                int(boost::math::round(((vco_freq / pfd_freq) / fb_divisor - N) * MOD));
+
+            if (is_int_n) {
+                if (FRAC
+                    > (MOD
+                        / 2)) // Round integer such that actual freq is closest to target
+                    N++;
+                FRAC = 0;
+            }
+
+            // keep N within int divider requirements
+            if (is_int_n) {
+                if (N <= int_n_mode_div_range.start())
+                    continue;
+                if (N >= int_n_mode_div_range.stop())
+                    continue;
+            } else {
+                if (N <= frac_n_mode_div_range.start())
+                    continue;
+                if (N >= frac_n_mode_div_range.stop())
+                    continue;
+            }
+
+            // keep pfd freq low enough to achieve 50kHz BS clock
+            BS = static_cast<int>(std::ceil(pfd_freq / BS_FREQ));
+            if (BS <= MAX_BS_VALUE)
+                break;
         }
+        UHD_ASSERT_THROW(R <= r_range.stop());
 
-        // keep pfd freq low enough to achieve 50kHz BS clock
-        BS = static_cast<int>(std::ceil(pfd_freq / BS_FREQ));
-        if (BS <= MAX_BS_VALUE)
-            break;
-    }
-    UHD_ASSERT_THROW(R <= r_range.stop());
+        // Reference divide-by-2 for 50% duty cycle
+        // if R even, move one divide by 2 to to regs.reference_divide_by_2
+        if (R % 2 == 0) {
+            T = 1;
+            R /= 2;
+        }
 
-    // Reference divide-by-2 for 50% duty cycle
-    // if R even, move one divide by 2 to to regs.reference_divide_by_2
-    if (R % 2 == 0) {
-        T = 1;
-        R /= 2;
+        // actual frequency calculation
+        actual_freq = double((N + (double(FRAC) / double(MOD))) * ref_freq
+                             * (1 + int(D)) / (R * (1 + int(T))))
+                      * fb_divisor / RFdiv;
+
+        UHD_LOGGER_TRACE("MAX287X")
+            << boost::format("Intermediates: ref=%0.2f, outdiv=%f, fbdiv=%f") % ref_freq
+                   % double(RFdiv * 2) % double(N + double(FRAC) / double(MOD));
+        UHD_LOGGER_TRACE("MAX287X")
+            << boost::format("Tune: R=%d, BS=%d, N=%d, FRAC=%d, MOD=%d, T=%d, D=%d, "
+                             "RFdiv=%d, type=%s")
+                   % R % BS % N % FRAC % MOD % T % D % RFdiv
+                   % ((is_int_n) ? "Integer-N" : "Fractional");
+        UHD_LOGGER_TRACE("MAX287X")
+            << boost::format("Frequencies (MHz): REQ=%0.2f, ACT=%0.2f, VCO=%0.2f, "
+                             "PFD=%0.2f, BAND=%0.2f")
+                   % (target_freq / 1e6) % (actual_freq / 1e6) % (vco_freq / 1e6)
+                   % (pfd_freq / 1e6) % (pfd_freq / BS / 1e6);
+
+        if (_tune_cache.size() >= MAX_TUNE_CACHE_ENTRIES) {
+            _tune_cache.clear();
+        }
+        _tune_cache[tune_key] =
+            tune_solution_t{T, D, R, BS, N, FRAC, MOD, RFdiv, actual_freq};
     }
 
-    // actual frequency calculation
-    double actual_freq = double((N + (double(FRAC) / double(MOD))) * ref_freq
-                                * (1 + int(D)) / (R * (1 + int(T))))
-                         * fb_divisor / RFdiv;
-
-    UHD_LOGGER_TRACE("MAX287X")
-        << boost::format("Intermediates: ref=%0.2f, outdiv=%f, fbdiv=%f") % ref_freq
-               % double(RFdiv * 2) % double(N + double(FRAC) / double(MOD));
-    UHD_LOGGER_TRACE("MAX287X")
-        << boost::format(
-               "Tune: R=%d, BS=%d, N=%d, FRAC=%d, MOD=%d, T=%d, D=%d, RFdiv=%d, type=%s")
-               % R % BS % N % FRAC % MOD % T % D % RFdiv
-               % ((is_int_n) ? "Integer-N" : "Fractional");
-    UHD_LOGGER_TRACE("MAX287X")
-        << boost::format("Frequencies (MHz): REQ=%0.2f, ACT=%0.2f, VCO=%0.2f, PFD=%0.2f, "
-                         "BAND=%0.2f")
-               % (target_freq / 1e6) % (actual_freq / 1e6) % (vco_freq / 1e6)
-               % (pfd_freq / 1e6) % (pfd_freq / BS / 1e6);
-
     // load the register values
     _regs.rf_output_enable = max287x_regs_t::RF_OUTPUT_ENABLE_ENABLED;
 
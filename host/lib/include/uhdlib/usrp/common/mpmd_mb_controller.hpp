@@ -82,6 +82,7 @@ public:
     void set_clock_source_out(const bool enb);
     void set_time_source_out(const bool enb);
     uhd::sensor_value_t get_sensor(const std::string& name);
+    std::vector<uhd::sensor_value_t> get_sensors(const std::vector<std::string>& names);
     std::vector<std::string> get_sensor_names();
     uhd::usrp::mboard_eeprom_t get_eeprom();
     std::vector<std::string> get_gpio_banks() const;
@@ -101,6 +102,11 @@ private:
     //! List of MB sensor names
     std::unordered_set<std::string> _sensor_names;
 
+    //! Whether MPM provides the bulk sensor read RPC (get_mb_sensors_values).
+    // Cleared on the first failed attempt so we fall back to single reads
+    // without re-trying the bulk call on every poll.
+    bool _has_bulk_sensor_rpc = true;
+
     //! Cache of available GPIO sources
     std::vector<std::string> _gpio_banks;
     std::unordered_map<std::string, std::vector<std::string>> _gpio_srcs;
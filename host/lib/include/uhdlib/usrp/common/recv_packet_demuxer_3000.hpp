@@ -12,12 +12,13 @@
 #include <uhd/types/time_spec.hpp>
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/utils/bounded_queue.hpp>
 #include <stdint.h>
-#include <boost/thread.hpp>
+#include <algorithm>
 #include <chrono>
 #include <map>
 #include <memory>
-#include <queue>
+#include <mutex>
 
 namespace uhd { namespace usrp {
 
@@ -29,7 +30,8 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
         return sptr(new recv_packet_demuxer_3000(xport));
     }
 
-    recv_packet_demuxer_3000(transport::zero_copy_if::sptr xport) : _xport(xport)
+    recv_packet_demuxer_3000(transport::zero_copy_if::sptr xport)
+        : _xport(xport), _queues(std::make_shared<queue_map_t>())
     { /*NOP*/
     }
 
@@ -58,16 +60,18 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
     {
         transport::managed_recv_buffer::sptr buff;
 
+        // Take a snapshot of the sid map. The map itself is immutable; sid
+        // registration swaps in a fresh copy, so the per-packet path never
+        // takes a lock.
+        const std::shared_ptr<queue_map_t> queues = std::atomic_load(&_queues);
+
         //----------------------------------------------------------
-        //-- Check the queue to see if we already have a buffer
+        //-- Check the queue to see if we already have a buffer:
+        //-- another channel's reader may have demuxed one for us
         //----------------------------------------------------------
         {
-            boost::mutex::scoped_lock l(mutex);
-            queue_type_t& queue = _queues[sid];
-            if (not queue.empty()) {
-                buff = queue.front();
-                queue.front().reset();
-                queue.pop();
+            auto it = queues->find(sid);
+            if (it != queues->end() and it->second->pop_with_haste(buff)) {
                 return buff;
             }
         }
@@ -76,13 +80,16 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
             if (buff) {
                 const uint32_t new_sid = uhd::wtohx(buff->cast<const uint32_t*>()[1]);
                 if (new_sid != sid) {
-                    boost::mutex::scoped_lock l(mutex);
-                    if (_queues.count(new_sid) == 0)
+                    auto it = queues->find(new_sid);
+                    if (it == queues->end())
                         UHD_LOGGER_ERROR("STREAMER")
                             << "recv packet demuxer unexpected sid 0x" << std::hex
                             << new_sid << std::dec;
                     else
-                        _queues[new_sid].push(buff);
+                        // The queue depth matches the transport's frame pool,
+                        // so pushing a claimed frame can never hit a full
+                        // queue; the pop-on-full is belt and braces
+                        it->second->push_with_pop_on_full(buff);
                     buff.reset();
                 }
             }
@@ -92,19 +99,22 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
 
     void realloc_sid(const uint32_t sid)
     {
-        boost::mutex::scoped_lock l(mutex);
-        while (not _queues[sid].empty()) // allocated and clears if already allocated
-        {
-            _queues[sid].pop();
-        }
+        // Registration is the slow path: copy the map, replace this sid's
+        // queue with a fresh (empty) one, and atomically publish the copy
+        std::lock_guard<std::mutex> l(_mutex);
+        auto new_queues = std::make_shared<queue_map_t>(*std::atomic_load(&_queues));
+        (*new_queues)[sid] = std::make_shared<queue_type_t>(
+            std::max<size_t>(1, _xport->get_num_recv_frames()));
+        std::atomic_store(&_queues, new_queues);
     }
 
     transport::zero_copy_if::sptr make_proxy(const uint32_t sid);
 
-    typedef std::queue<transport::managed_recv_buffer::sptr> queue_type_t;
-    std::map<uint32_t, queue_type_t> _queues;
+    typedef uhd::utils::bounded_queue<transport::managed_recv_buffer::sptr> queue_type_t;
+    typedef std::map<uint32_t, std::shared_ptr<queue_type_t>> queue_map_t;
+    std::shared_ptr<queue_map_t> _queues;
     transport::zero_copy_if::sptr _xport;
-    boost::mutex mutex;
+    std::mutex _mutex; // guards sid registration only
 };
 
 struct recv_packet_demuxer_proxy_3000 : transport::zero_copy_if
@@ -19,12 +19,22 @@ public:
     using sptr        = std::shared_ptr<dma_fifo_core_3000>;
     using poke32_fn_t = std::function<void(uint32_t, uint32_t)>;
     using peek32_fn_t = std::function<uint32_t(uint32_t)>;
+    using peek64_fn_t = std::function<uint64_t(uint32_t)>;
 
     virtual ~dma_fifo_core_3000(void) = 0;
 
     //! Create a DMA FIFO controller for a specific channel
-    static sptr make(
-        poke32_fn_t&& poke_fn, peek32_fn_t&& peek_fn, const size_t fifo_index);
+    //
+    // The 64-bit registers (fullness, BIST counters) are read as two
+    // consecutive 32-bit peeks unless \p peek64_fn is provided, in which
+    // case the owner can service both halves in a single transaction
+    // (e.g. via register_iface::peek64). This matters when polling the
+    // fullness register while streaming, where each control round trip
+    // counts.
+    static sptr make(poke32_fn_t&& poke_fn,
+        peek32_fn_t&& peek_fn,
+        const size_t fifo_index,
+        peek64_fn_t&& peek64_fn = nullptr);
 
     /**************************************************************************
      * API
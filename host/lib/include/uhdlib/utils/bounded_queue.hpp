@@ -0,0 +1,210 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace uhd { namespace utils {
+
+/*!
+ * A bounded lock-free multi-producer/multi-consumer queue.
+ *
+ * This is a drop-in alternative to uhd::transport::bounded_buffer for
+ * intra-UHD queues on latency-sensitive paths: push and pop are wait-free
+ * CAS loops over a fixed ring (Vyukov-style, one sequence counter per slot),
+ * so neither end ever takes a mutex or a condition variable wakeup when the
+ * queue has data. Blocking pops use an adaptive wait strategy: spin briefly
+ * on the ring first, then park on a condition variable which producers only
+ * signal when a waiter is registered.
+ *
+ * The capacity is rounded up to the next power of two. Elements must be
+ * default-constructible; popped slots are reset to a default-constructed
+ * element so that reference-holding types (sptrs) release their referents.
+ */
+template <typename elem_type>
+class bounded_queue : uhd::noncopyable
+{
+public:
+    bounded_queue(size_t capacity)
+        : _capacity(_round_up_pow2(capacity))
+        , _mask(_capacity - 1)
+        , _slots(new slot_type[_capacity])
+    {
+        for (size_t i = 0; i < _capacity; i++) {
+            _slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+        _write_pos.store(0, std::memory_order_relaxed);
+        _read_pos.store(0, std::memory_order_relaxed);
+        _num_waiters.store(0, std::memory_order_relaxed);
+    }
+
+    /*!
+     * Push a new element into the queue immediately.
+     * The element will not be pushed when the queue is full.
+     * \param elem the new element to push
+     * \return false when the queue is full
+     */
+    UHD_INLINE bool push_with_haste(const elem_type& elem)
+    {
+        size_t pos = _write_pos.load(std::memory_order_relaxed);
+        while (true) {
+            slot_type& slot          = _slots[pos & _mask];
+            const size_t seq         = slot.seq.load(std::memory_order_acquire);
+            const std::ptrdiff_t dif = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+            if (dif == 0) {
+                if (_write_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.elem = elem;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    _notify_if_waiting();
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false; // full
+            } else {
+                pos = _write_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /*!
+     * Push a new element into the queue.
+     * If the queue is full prior to the push,
+     * make room by popping the oldest element.
+     * \param elem the new element to push
+     * \return true if the element fit without popping for space
+     */
+    UHD_INLINE bool push_with_pop_on_full(const elem_type& elem)
+    {
+        if (push_with_haste(elem)) {
+            return true;
+        }
+        elem_type dummy;
+        pop_with_haste(dummy);
+        while (not push_with_haste(elem)) {
+            pop_with_haste(dummy);
+        }
+        return false;
+    }
+
+    /*!
+     * Pop an element from the queue immediately.
+     * The element will not be popped when the queue is empty.
+     * \param elem the element reference to pop to
+     * \return false when the queue is empty
+     */
+    UHD_INLINE bool pop_with_haste(elem_type& elem)
+    {
+        size_t pos = _read_pos.load(std::memory_order_relaxed);
+        while (true) {
+            slot_type& slot          = _slots[pos & _mask];
+            const size_t seq         = slot.seq.load(std::memory_order_acquire);
+            const std::ptrdiff_t dif = std::ptrdiff_t(seq) - std::ptrdiff_t(pos + 1);
+            if (dif == 0) {
+                if (_read_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    elem      = slot.elem;
+                    slot.elem = elem_type();
+                    slot.seq.store(pos + _capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false; // empty
+            } else {
+                pos = _read_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /*!
+     * Pop an element from the queue.
+     * Spin until the queue becomes non-empty, then park until the timeout.
+     * \param elem the element reference to pop to
+     * \param timeout the timeout in seconds
+     * \return false when the operation times out
+     */
+    bool pop_with_timed_wait(elem_type& elem, double timeout)
+    {
+        // Phase 1: spin on the ring. This covers the common streaming case
+        // where the producer is at most a few microseconds away, and avoids
+        // the scheduler wakeup penalty of a condition variable entirely.
+        for (size_t i = 0; i < SPIN_ITERATIONS; i++) {
+            if (pop_with_haste(elem)) {
+                return true;
+            }
+            if ((i & 0x3F) == 0x3F) {
+                std::this_thread::yield();
+            }
+        }
+
+        // Phase 2: park on the condition variable. Producers only lock and
+        // notify when _num_waiters is non-zero, so this costs nothing while
+        // the consumer keeps up.
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::microseconds(int64_t(timeout * 1e6));
+        std::unique_lock<std::mutex> lock(_park_mutex);
+        _num_waiters.fetch_add(1);
+        while (not pop_with_haste(elem)) {
+            if (_park_cv.wait_until(lock, deadline) == std::cv_status::timeout) {
+                _num_waiters.fetch_sub(1);
+                // final check to not miss an element pushed at the deadline
+                return pop_with_haste(elem);
+            }
+        }
+        _num_waiters.fetch_sub(1);
+        return true;
+    }
+
+private:
+    //! Spin budget before parking; roughly tens of microseconds
+    static const size_t SPIN_ITERATIONS = 1000;
+
+    struct slot_type
+    {
+        std::atomic<size_t> seq;
+        elem_type elem;
+    };
+
+    static size_t _round_up_pow2(size_t value)
+    {
+        size_t pow2 = 1;
+        while (pow2 < value) {
+            pow2 *= 2;
+        }
+        return pow2;
+    }
+
+    UHD_INLINE void _notify_if_waiting(void)
+    {
+        if (_num_waiters.load() > 0) {
+            // Lock so the notify cannot fall between a parking consumer's
+            // final empty-check and its wait
+            std::lock_guard<std::mutex> lock(_park_mutex);
+            _park_cv.notify_one();
+        }
+    }
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<slot_type[]> _slots;
+    std::atomic<size_t> _write_pos;
+    std::atomic<size_t> _read_pos;
+
+    // parking lot for blocking pops
+    std::atomic<int> _num_waiters;
+    std::mutex _park_mutex;
+    std::condition_variable _park_cv;
+};
+
+}} // namespace uhd::utils
@@ -42,6 +42,12 @@ public:
      */
     void read_file(const std::string& path);
 
+    /*! Write the current values to an INI file, replacing its contents.
+     *
+     * \throws uhd::runtime_error if the file cannot be written.
+     */
+    void save(const std::string& path);
+
     //! Return a list of sections
     std::vector<std::string> sections();
 
@@ -36,6 +36,28 @@ public:
      */
     void read(record_handle_type record_handler);
 
+    /*! Read an Intel HEX file and handle it in coalesced blocks.
+     *
+     * Like read(), but contiguous data records are merged in a single pass
+     * into blocks of up to \p max_block_size bytes before they are passed to
+     * the record handler. Firmware uploaders should prefer this call: hex
+     * records are typically 16 bytes, so pushing each one individually over
+     * a USB control transfer wastes most of the time on per-transfer
+     * overhead.
+     *
+     * A block is flushed when it reaches \p max_block_size, when the next
+     * record is not contiguous with it (address gap or new upper address
+     * bits), and before the jump instruction from a start linear address
+     * record is handed through (which is passed on with a zero length, same
+     * as with read()).
+     *
+     * \param record_handler The functor that will handle the blocks.
+     * \param max_block_size Maximum number of payload bytes per block.
+     *
+     * \throws uhd::io_error if the HEX file is corrupted or unreadable.
+     */
+    void read_coalesced(record_handle_type record_handler, const size_t max_block_size);
+
     /* Convert the ihex file to a bin file.
      *
      * *Note:* This function makes the assumption that the hex file is
@@ -0,0 +1,39 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/utils/init_profile.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <cstddef>
+#include <string>
+
+namespace uhd { namespace utils {
+
+/*! Scoped timer for an initialization phase
+ *
+ * Records the duration from construction to destruction into the
+ * process-wide init profile (see uhd/utils/init_profile.hpp). Phases
+ * started while another phase is active on the same thread are recorded as
+ * nested. When a top-level phase ends and the UHD_INIT_PROFILE environment
+ * variable is set, the full report is logged.
+ *
+ * Recording is always compiled in: the cost is one clock read and one
+ * mutex-protected vector append per phase, which is negligible next to the
+ * I/O-bound work being timed.
+ */
+class scoped_init_phase : uhd::noncopyable
+{
+public:
+    explicit scoped_init_phase(std::string name);
+    ~scoped_init_phase();
+
+private:
+    //! Index of this phase's record in the profile
+    const size_t _index;
+};
+
+}} // namespace uhd::utils
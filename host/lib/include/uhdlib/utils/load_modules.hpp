@@ -0,0 +1,24 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+namespace uhd {
+
+/*! Load all UHD modules from the module paths.
+ *
+ * Modules are shared objects that register additional device types, image
+ * loaders, etc. with UHD's registries when loaded. Loading them requires a
+ * recursive filesystem walk over all module paths plus a dlopen() per
+ * module, so it is deferred until a registry is first consulted rather than
+ * running before main().
+ *
+ * This function is thread-safe and idempotent; the walk only runs once per
+ * process.
+ */
+void load_modules(void);
+
+} /* namespace uhd */
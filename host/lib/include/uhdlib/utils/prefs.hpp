@@ -81,4 +81,28 @@ uhd::device_addr_t get_dpdk_args(const uhd::device_addr_t& user_args);
  *                  if they exist.
  */
 uhd::device_addr_t get_dpdk_nic_args(const uhd::device_addr_t& user_args);
+
+/*! Returns the cached path MTU for a device/interface pair
+ *
+ * The cache is stored in an INI file in the user's data directory and
+ * persists across sessions, so repeated session setup can skip the timed
+ * echo probes of MTU discovery. Cached values must always be revalidated
+ * against the device before use.
+ *
+ * \param device Identifier of the device (e.g. its serial number)
+ * \param iface Identifier of the path to the device (e.g. its IP address)
+ * \return The cached MTU in bytes, or 0 if no value is cached
+ */
+size_t get_cached_mtu(const std::string& device, const std::string& iface);
+
+/*! Updates the cached path MTU for a device/interface pair
+ *
+ * Writes through to the cache file. Failures to write are logged but not
+ * fatal, since the cache is only an optimization.
+ *
+ * \param device Identifier of the device (e.g. its serial number)
+ * \param iface Identifier of the path to the device (e.g. its IP address)
+ * \param mtu The discovered MTU in bytes
+ */
+void update_cached_mtu(const std::string& device, const std::string& iface, const size_t mtu);
 }} /* namespace uhd::prefs */
@@ -12,7 +12,12 @@
 #include <rpc/client.h>
 #include <rpc/rpc_error.h>
 #include <boost/format.hpp>
+#include <chrono>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 namespace {
 
@@ -36,10 +41,95 @@ bool await_rpc_connected_state(
 
     return state == rpc::client::connection_state::connected;
 }
+
+/*! Pull the last error out of the RPC server. Not thread-safe.
+ *
+ * This function will do its best not to get in anyone's way. If it can't
+ * get an error string, it'll return an empty string.
+ */
+std::string get_last_rpc_error_safe(
+    std::shared_ptr<rpc::client> client, const std::string& get_last_error_cmd)
+{
+    if (get_last_error_cmd.empty()) {
+        return "";
+    }
+    try {
+        return client->call(get_last_error_cmd).as<std::string>();
+    } catch (const ::rpc::rpc_error&) {
+        // nop
+    } catch (const std::bad_cast&) {
+        // nop
+    } catch (...) {
+        // nop
+    }
+    return "";
+}
 } // namespace
 
 namespace uhd {
 
+/*! Handle to a pipelined RPC request (see rpc_client::async_request())
+ *
+ * Holds the pending response of a request that was sent without waiting for
+ * its reply. Calling get() blocks until the reply arrives and converts
+ * errors the same way rpc_client::request() does. get() may only be called
+ * once.
+ */
+template <typename return_type>
+class rpc_response
+{
+public:
+    rpc_response(std::future<RPCLIB_MSGPACK::object_handle>&& response,
+        std::shared_ptr<rpc::client> client,
+        const std::string& func_name,
+        const std::string& get_last_error_cmd,
+        const uint64_t timeout_ms)
+        : _response(std::move(response))
+        , _client(client)
+        , _func_name(func_name)
+        , _get_last_error_cmd(get_last_error_cmd)
+        , _timeout_ms(timeout_ms)
+    {
+    }
+
+    //! Block until the response arrives, and return its value
+    //
+    // \throws uhd::runtime_error in case of failure or timeout
+    return_type get()
+    {
+        // The async interface of the underlying RPC implementation does not
+        // apply the client timeout to pending futures, so enforce it here
+        if (_response.wait_for(std::chrono::milliseconds(_timeout_ms))
+            != std::future_status::ready) {
+            throw uhd::runtime_error(
+                str(boost::format("Timeout during RPC call to `%s'") % _func_name));
+        }
+        try {
+            return _response.get().template as<return_type>();
+        } catch (const ::rpc::rpc_error& ex) {
+            const std::string error =
+                get_last_rpc_error_safe(_client, _get_last_error_cmd);
+            if (not error.empty()) {
+                UHD_LOG_ERROR("RPC", error);
+            }
+            throw uhd::runtime_error(
+                str(boost::format("Error during RPC call to `%s'. Error message: %s")
+                    % _func_name % (error.empty() ? ex.what() : error)));
+        } catch (const std::bad_cast& ex) {
+            throw uhd::runtime_error(
+                str(boost::format("Error during RPC call to `%s'. Error message: %s")
+                    % _func_name % ex.what()));
+        }
+    }
+
+private:
+    std::future<RPCLIB_MSGPACK::object_handle> _response;
+    std::shared_ptr<rpc::client> _client;
+    const std::string _func_name;
+    const std::string _get_last_error_cmd;
+    const uint64_t _timeout_ms;
+};
+
 
 /*! Abstraction for RPC client
  *
@@ -60,6 +150,40 @@ public:
         return std::make_shared<rpc_client>(addr, port, timeout_ms, get_last_error_cmd);
     }
 
+    /*! Like make(), but returns a pooled connection.
+     *
+     * Clients with identical settings (address, port, timeout, error
+     * command) share one warm connection instead of opening a new one,
+     * which saves the TCP setup and server handshake when the same device
+     * is contacted repeatedly (e.g., discovery followed by a session, or
+     * several components within one session). The connection is dropped
+     * when the last reference goes away.
+     *
+     * Note that pooled clients share their token (see set_token()), so
+     * callers that need a private token on an otherwise identical
+     * configuration must use make() instead.
+     */
+    static sptr make_pooled(const std::string& addr,
+        const uint16_t port,
+        const uint64_t timeout_ms             = DEFAULT_RPC_TIMEOUT_MS,
+        const std::string& get_last_error_cmd = "")
+    {
+        static std::mutex pool_mutex;
+        static std::map<std::string, std::weak_ptr<rpc_client>> pool;
+        const std::string key = addr + ":" + std::to_string(port) + ":"
+                                + std::to_string(timeout_ms) + ":" + get_last_error_cmd;
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        auto pool_iter = pool.find(key);
+        if (pool_iter != pool.end()) {
+            if (sptr pooled_client = pool_iter->second.lock()) {
+                return pooled_client;
+            }
+        }
+        sptr new_client = make(addr, port, timeout_ms, get_last_error_cmd);
+        pool[key]       = new_client;
+        return new_client;
+    }
+
     /*!
      * \param addr An IP address to connect to
      * \param port Port to connect to
@@ -219,6 +343,41 @@ public:
         }
     };
 
+    /*! Start a pipelined RPC request.
+     *
+     * Thread safe (locked). Unlike request(), this sends the request without
+     * waiting for the reply, so several independent requests can be in
+     * flight at once and share one network round trip time. The reply is
+     * claimed via rpc_response::get(); errors (including timeouts) surface
+     * there rather than here.
+     *
+     * \param func_name The function name that is called via RPC
+     * \param args All these arguments are passed to the RPC call
+     */
+    template <typename return_type, typename... Args>
+    rpc_response<return_type> async_request(std::string const& func_name, Args&&... args)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return rpc_response<return_type>(
+            _client->async_call(func_name, std::forward<Args>(args)...),
+            _client,
+            func_name,
+            _get_last_error_cmd,
+            _default_timeout_ms);
+    };
+
+    /*! Like async_request(), also provides a token.
+     *
+     * This is a convenience wrapper to directly call a function that requires
+     * a token without having to have a copy of the token.
+     */
+    template <typename return_type, typename... Args>
+    rpc_response<return_type> async_request_with_token(
+        std::string const& func_name, Args&&... args)
+    {
+        return async_request<return_type>(func_name, _token, std::forward<Args>(args)...);
+    };
+
     /*! Like request(), also provides a token.
      *
      * This is a convenience wrapper to directly call a function that requires
@@ -300,19 +459,7 @@ private:
      */
     std::string _get_last_error_safe()
     {
-        if (_get_last_error_cmd.empty()) {
-            return "";
-        }
-        try {
-            return _client->call(_get_last_error_cmd).as<std::string>();
-        } catch (const ::rpc::rpc_error&) {
-            // nop
-        } catch (const std::bad_cast&) {
-            // nop
-        } catch (...) {
-            // nop
-        }
-        return "";
+        return get_last_rpc_error_safe(_client, _get_last_error_cmd);
     }
 
     //! Reference the actual RPC client
@@ -0,0 +1,58 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace uhd {
+
+/*!
+ * Serial task executor: a single worker thread draining a FIFO of tasks.
+ *
+ * Tasks posted from any thread run on the worker in the order they were
+ * posted, so a sequence of control calls keeps its ordering while the
+ * posting thread returns immediately. Each post returns a future that
+ * becomes ready when the task has run; an exception thrown by the task is
+ * delivered through the future and ignored if the future is discarded.
+ */
+class serial_task_executor
+{
+public:
+    using task_t = std::function<void()>;
+
+    /*!
+     * \param name thread name of the worker, for debugging
+     */
+    serial_task_executor(const std::string& name);
+
+    //! Runs all queued tasks to completion, then joins the worker
+    ~serial_task_executor();
+
+    /*! Queue a task for execution on the worker thread
+     *
+     * \param task the callable to run
+     * \return future made ready when the task has completed
+     */
+    std::future<void> post(task_t task);
+
+private:
+    void _worker_loop();
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<std::packaged_task<void()>> _queue;
+    bool _exit = false;
+    std::thread _worker;
+};
+
+} // namespace uhd
@@ -12,9 +12,23 @@ namespace uhd {
 
 /*!
  * Get the system time in time_spec_t format.
- * Uses the highest precision clock available.
+ * Uses the highest precision clock available. On x86-64 hosts with an
+ * invariant TSC this is a calibrated rdtsc read with no syscall on the fast
+ * path; everywhere else it falls back to the steady system clock.
  * \return the system time as a time_spec_t
  */
 time_spec_t get_system_time(void);
 
+/*!
+ * Get the system time from a coarse (low-resolution, cheap to read) clock.
+ *
+ * This shares the timeline of get_system_time(), but is only as precise as
+ * the kernel tick (typically 1-4 ms on Linux). Use it for timeout
+ * bookkeeping, where the resolution is irrelevant but the read happens on
+ * every iteration of a receive loop. Falls back to get_system_time() where
+ * no coarse clock is available.
+ * \return the system time as a time_spec_t
+ */
+time_spec_t get_system_time_coarse(void);
+
 }; /* namespace uhd */
@@ -0,0 +1,48 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/device_addr.hpp>
+#include <string>
+
+namespace uhd { namespace utils {
+
+/*! Register thread placement configuration for named thread roles.
+ *
+ * UHD spawns a number of housekeeping threads per session (claimer loops,
+ * message tasks, flush tasks, ...). Each of these has a role name: the name
+ * passed to uhd::task::make (e.g. "mpmd_claimer_task", "x300_claimer").
+ * This function scans \p args for keys of the form:
+ *
+ * - thread_<role>_cpu: an integer to specify the CPU affinity of threads
+ *   with the given role
+ * - thread_<role>_priority: a float between -1.0 and 1.0 to specify the
+ *   (non-realtime) scheduling priority of threads with the given role
+ *
+ * The special role "default" applies to every named housekeeping thread
+ * that has no more specific entry, e.g. `thread_default_cpu=0` moves all of
+ * them off the remaining cores. Streaming offload threads are configured
+ * separately (see io_service_args_t).
+ *
+ * The configuration is process-global and consulted when a thread with a
+ * given role starts up; it does not move threads that are already running.
+ * Registration happens automatically from the device args in device::make.
+ *
+ * \param args device args to scan for thread role keys
+ */
+void register_thread_role_config(const device_addr_t& args);
+
+/*! Apply the registered affinity/priority for \p role to the current thread.
+ *
+ * No-op if \p role is empty or neither it nor "default" has been
+ * configured. Failure to apply a setting logs a warning but does not throw.
+ *
+ * \param role the role name of the calling thread
+ */
+void apply_thread_role(const std::string& role);
+
+}} // namespace uhd::utils
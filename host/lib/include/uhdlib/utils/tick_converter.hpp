@@ -0,0 +1,79 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <cstdint>
+
+namespace uhd {
+
+/*! Tick-native time conversion for hot paths
+ *
+ * time_spec_t::from_ticks() and to_ticks() decompose the tick rate into
+ * its integer and fractional parts and divide by the rate on every call.
+ * The streamers perform these conversions per packet with a tick rate
+ * that rarely changes, so this class caches the decomposition and the
+ * reciprocal once and reduces each conversion to multiplications (plus
+ * one integer division for the full-second split), removing the
+ * double-precision divide from the per-packet path.
+ *
+ * Conversions produce results identical to the time_spec_t methods for
+ * the integer tick rates used by actual devices. The converter is cheap
+ * to copy and safe to re-rate via set_tick_rate() whenever the streamer
+ * learns a new rate.
+ */
+class tick_converter
+{
+public:
+    tick_converter(const double tick_rate = 1.0)
+    {
+        set_tick_rate(tick_rate);
+    }
+
+    //! Re-derive the cached rate decomposition for a new tick rate
+    void set_tick_rate(const double tick_rate)
+    {
+        _tick_rate   = tick_rate;
+        _tick_period = 1.0 / tick_rate;
+        _rate_i      = (long long)(tick_rate);
+        _rate_f      = tick_rate - _rate_i;
+    }
+
+    //! Returns the tick rate this converter was configured with
+    double get_tick_rate() const
+    {
+        return _tick_rate;
+    }
+
+    //! Equivalent of time_spec_t::from_ticks() at the cached tick rate
+    UHD_FORCE_INLINE time_spec_t from_ticks(const long long ticks) const
+    {
+        const int64_t secs_full     = int64_t(ticks / _rate_i);
+        const long long ticks_error = ticks - (secs_full * _rate_i);
+        const double ticks_frac     = ticks_error - secs_full * _rate_f;
+        return time_spec_t(secs_full, ticks_frac * _tick_period);
+    }
+
+    //! Equivalent of time_spec_t::to_ticks() at the cached tick rate
+    UHD_FORCE_INLINE long long to_ticks(const time_spec_t& time) const
+    {
+        const long long ticks_full = time.get_full_secs() * _rate_i;
+        const double ticks_error   = time.get_full_secs() * _rate_f;
+        const double ticks_frac    = time.get_frac_secs() * _tick_rate;
+        // Assumes non-negative time, like time_spec_t::to_ticks()
+        return ticks_full + (long long)(ticks_error + ticks_frac + 0.5);
+    }
+
+private:
+    double _tick_rate   = 1.0;
+    double _tick_period = 1.0;
+    long long _rate_i   = 1;
+    double _rate_f      = 0.0;
+};
+
+} // namespace uhd
@@ -0,0 +1,42 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+/*!
+ * Static tracepoints for the transport and streamer hot paths.
+ *
+ * When UHD is built on a system that provides <sys/sdt.h> (systemtap-sdt-dev
+ * on Debian-likes, systemtap-sdt-devel on Red Hat-likes), these macros emit
+ * USDT probes under the "uhd" provider. A disabled probe compiles to a single
+ * nop instruction, so the tracepoints can stay in release builds and be
+ * attached to in production with bpftrace, perf or systemtap, e.g.:
+ *
+ *     bpftrace -e 'usdt:/path/to/libuhd.so:uhd:rx_overrun { ... }'
+ *
+ * Without <sys/sdt.h>, the macros expand to nothing.
+ *
+ * Probe arguments must be integral or pointer values; do not pass expressions
+ * with side effects, as they are not evaluated when probes are unavailable.
+ */
+
+#ifdef HAVE_SYS_SDT_H
+
+#    include <sys/sdt.h>
+
+#    define UHD_TRACEPOINT(name) DTRACE_PROBE(uhd, name)
+#    define UHD_TRACEPOINT1(name, a1) DTRACE_PROBE1(uhd, name, a1)
+#    define UHD_TRACEPOINT2(name, a1, a2) DTRACE_PROBE2(uhd, name, a1, a2)
+#    define UHD_TRACEPOINT3(name, a1, a2, a3) DTRACE_PROBE3(uhd, name, a1, a2, a3)
+
+#else
+
+#    define UHD_TRACEPOINT(name)
+#    define UHD_TRACEPOINT1(name, a1)
+#    define UHD_TRACEPOINT2(name, a1, a2)
+#    define UHD_TRACEPOINT3(name, a1, a2, a3)
+
+#endif
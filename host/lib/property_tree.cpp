@@ -7,11 +7,14 @@
 //
 
 #include <uhd/property_tree.hpp>
-#include <uhd/types/dict.hpp>
-#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <typeindex>
+#include <vector>
 
 using namespace uhd;
 
@@ -47,23 +50,30 @@ fs_path fs_path::branch_path(void) const
 
 fs_path uhd::operator/(const fs_path& lhs, const fs_path& rhs)
 {
-    // strip trailing slash on left-hand-side
-    if (not lhs.empty() and *lhs.rbegin() == '/') {
-        return fs_path(lhs.substr(0, lhs.size() - 1)) / rhs;
+    // Strip trailing slashes on the left-hand-side and leading slashes on
+    // the right-hand-side, then join with exactly one separator. This is
+    // done in a single pass so that the (very common) path concatenations
+    // during property registration only allocate the result string.
+    size_t lhs_len = lhs.size();
+    while (lhs_len > 0 and lhs[lhs_len - 1] == '/') {
+        lhs_len--;
     }
-
-    // strip leading slash on right-hand-side
-    if (not rhs.empty() and *rhs.begin() == '/') {
-        return lhs / fs_path(rhs.substr(1));
+    size_t rhs_pos = 0;
+    while (rhs_pos < rhs.size() and rhs[rhs_pos] == '/') {
+        rhs_pos++;
     }
 
-    return fs_path(lhs + "/" + rhs);
+    std::string result;
+    result.reserve(lhs_len + 1 + (rhs.size() - rhs_pos));
+    result.append(lhs, 0, lhs_len);
+    result += '/';
+    result.append(rhs, rhs_pos, std::string::npos);
+    return fs_path(result);
 }
 
 fs_path uhd::operator/(const fs_path& lhs, size_t rhs)
 {
-    fs_path rhs_str = std::to_string(rhs);
-    return lhs / rhs_str;
+    return lhs / fs_path(std::to_string(rhs));
 }
 
 /***********************************************************************
@@ -80,7 +90,7 @@ public:
     sptr subtree(const fs_path& path_) const
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::shared_lock<boost::shared_mutex> lock(_guts->mutex);
 
         property_tree_impl* subtree = new property_tree_impl(path);
         subtree->_guts              = this->_guts; // copy the guts sptr
@@ -90,31 +100,32 @@ public:
     void remove(const fs_path& path_)
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::unique_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node_type* child = node->find_child(name);
+            if (child == nullptr)
                 throw_path_not_found(path);
             parent = node;
-            node   = &(*node)[name];
+            node   = child;
         }
         if (parent == NULL)
             throw uhd::runtime_error("Cannot uproot");
-        parent->pop(fs_path(path.leaf()));
+        parent->pop(path.leaf());
     }
 
     bool exists(const fs_path& path_) const
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::shared_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node = node->find_child(name);
+            if (node == nullptr)
                 return false;
-            node = &(*node)[name];
         }
         return true;
     }
@@ -122,30 +133,31 @@ public:
     std::vector<std::string> list(const fs_path& path_) const
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::shared_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node = node->find_child(name);
+            if (node == nullptr)
                 throw_path_not_found(path);
-            node = &(*node)[name];
         }
 
-        return node->keys();
+        return node->child_order;
     }
 
     std::shared_ptr<void> _pop(const fs_path& path_)
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::unique_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node_type* child = node->find_child(name);
+            if (child == nullptr)
                 throw_path_not_found(path);
             parent = node;
-            node   = &(*node)[name];
+            node   = child;
         }
 
         if (node->prop.get() == NULL)
@@ -153,7 +165,7 @@ public:
         if (parent == NULL)
             throw uhd::runtime_error("Cannot pop");
         auto prop = node->prop;
-        parent->pop(fs_path(path.leaf()));
+        parent->pop(path.leaf());
         return prop;
     }
 
@@ -162,13 +174,11 @@ public:
         std::type_index prop_type)
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::unique_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
-                (*node)[name] = node_type();
-            node = &(*node)[name];
+            node = node->insert_child(name);
         }
         if (node->prop.get() != NULL)
             throw uhd::runtime_error(
@@ -180,13 +190,13 @@ public:
     std::shared_ptr<void>& _access(const fs_path& path_) const
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::shared_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node = node->find_child(name);
+            if (node == nullptr)
                 throw_path_not_found(path);
-            node = &(*node)[name];
         }
         if (node->prop.get() == NULL)
             throw uhd::runtime_error("Cannot access! Property uninitialized at: " + path);
@@ -197,13 +207,13 @@ public:
         const fs_path& path_, std::type_index expected_prop_type) const
     {
         const fs_path path = _root / path_;
-        boost::mutex::scoped_lock lock(_guts->mutex);
+        boost::shared_lock<boost::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name))
+            node = node->find_child(name);
+            if (node == nullptr)
                 throw_path_not_found(path);
-            node = &(*node)[name];
         }
         if (node->prop.get() == NULL)
             throw uhd::runtime_error("Cannot access! Property uninitialized at: " + path);
@@ -219,18 +229,61 @@ private:
         throw uhd::lookup_error("Path not found in tree: " + path);
     }
 
-    // basic structural node element
-    struct node_type : uhd::dict<std::string, node_type>
+    // basic structural node element. Children are kept in a sorted map so
+    // each path component resolves with O(log n) compares instead of a
+    // linear scan, which adds up in the repeated per-channel discovery
+    // walks (gain elements, sensors) that query the tree at runtime. The
+    // insertion order of child names is maintained separately, since list()
+    // has always enumerated children in the order they were created; it
+    // doubles as the precomputed enumeration result and only changes on
+    // structural updates.
+    struct node_type
     {
+        std::map<std::string, std::shared_ptr<node_type>> children;
+        std::vector<std::string> child_order;
         std::shared_ptr<void> prop;
         std::size_t prop_type_hash;
+
+        //! Returns the named child, or NULL if there is none
+        node_type* find_child(const std::string& name) const
+        {
+            const auto it = children.find(name);
+            return it == children.end() ? nullptr : it->second.get();
+        }
+
+        //! Returns the named child, creating it if necessary
+        node_type* insert_child(const std::string& name)
+        {
+            auto& child = children[name];
+            if (not child) {
+                child = std::make_shared<node_type>();
+                child_order.push_back(name);
+            }
+            return child.get();
+        }
+
+        //! Removes the named child and its subtree
+        void pop(const std::string& name)
+        {
+            children.erase(name);
+            const auto it =
+                std::find(child_order.begin(), child_order.end(), name);
+            if (it != child_order.end()) {
+                child_order.erase(it);
+            }
+        }
     };
 
-    // tree guts which may be referenced in a subtree
+    // tree guts which may be referenced in a subtree. The lock is a
+    // reader-writer lock: read-only lookups (access, exists, list) take it
+    // shared so they never contend with each other, and only structural
+    // changes (create, remove, pop) take it exclusively. Note that property
+    // get/set calls do not hold the tree lock at all; it only guards the
+    // path lookup.
     struct tree_guts_type
     {
         node_type root;
-        boost::mutex mutex;
+        boost::shared_mutex mutex;
     };
 
     // members, the tree and root prefix
@@ -7,12 +7,130 @@
 #include <uhd/rfnoc/actions.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 using namespace uhd::rfnoc;
 
 namespace {
 // A static counter, which we use to uniquely label actions
 std::atomic<size_t> action_counter{0};
+
+/*! A recycling arena for action objects
+ *
+ * Actions are created for every stream command, overflow, and flow control
+ * event that traverses the graph, which adds up to significant allocator
+ * churn during overrun storms. This arena hands out fixed-size blocks and
+ * recycles them through a freelist, so steady-state action creation does
+ * not hit the global allocator. It is used below via std::allocate_shared,
+ * so one block holds both the action object and the shared_ptr control
+ * block.
+ */
+class action_arena
+{
+public:
+    //! Big enough for any action type plus the shared_ptr control block.
+    //  Oversized requests fall through to the global allocator.
+    static constexpr size_t BLOCK_SIZE = 256;
+    //! Bound on the freelist so a single event storm cannot pin memory
+    //  forever
+    static constexpr size_t MAX_FREE_BLOCKS = 64;
+
+    static action_arena& instance()
+    {
+        // Intentionally leaked: actions may outlive static destruction of
+        // this translation unit, and their blocks must remain returnable
+        static action_arena* arena = new action_arena();
+        return *arena;
+    }
+
+    void* allocate(const size_t size)
+    {
+        if (size > BLOCK_SIZE) {
+            return ::operator new(size);
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_free_blocks.empty()) {
+                void* block = _free_blocks.back();
+                _free_blocks.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(BLOCK_SIZE);
+    }
+
+    void deallocate(void* ptr, const size_t size)
+    {
+        if (size <= BLOCK_SIZE) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_free_blocks.size() < MAX_FREE_BLOCKS) {
+                _free_blocks.push_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    action_arena() = default;
+
+    std::mutex _mutex;
+    std::vector<void*> _free_blocks;
+};
+
+//! Minimal allocator interface over the action arena, for allocate_shared
+template <typename T>
+struct action_arena_allocator
+{
+    using value_type = T;
+
+    action_arena_allocator() = default;
+    template <typename U>
+    action_arena_allocator(const action_arena_allocator<U>&)
+    {
+    }
+
+    T* allocate(const size_t n)
+    {
+        return static_cast<T*>(action_arena::instance().allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, const size_t n)
+    {
+        action_arena::instance().deallocate(ptr, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const action_arena_allocator<T>&, const action_arena_allocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const action_arena_allocator<T>&, const action_arena_allocator<U>&)
+{
+    return false;
+}
+
+//! Create an action through the arena. The struct-template dance mirrors
+//  the *_make_shared wrappers below: it makes the protected constructors
+//  reachable for allocate_shared.
+template <typename action_t, typename... Args>
+typename action_t::sptr make_action_pooled(Args&&... args)
+{
+    struct action_make_shared : public action_t
+    {
+        action_make_shared(Args&&... ctor_args)
+            : action_t(std::forward<Args>(ctor_args)...)
+        {
+        }
+    };
+    return std::allocate_shared<action_make_shared>(
+        action_arena_allocator<action_make_shared>(), std::forward<Args>(args)...);
+}
 } // namespace
 
 action_info::action_info(const std::string& key, const uhd::device_addr_t& args)
@@ -25,15 +143,11 @@ action_info::action_info(const std::string& key, const uhd::device_addr_t& args)
 action_info::sptr action_info::make(
     const std::string& key, const uhd::device_addr_t& args)
 {
-    struct action_info_make_shared : public action_info
-    {
-    };
     if (key == ACTION_KEY_STREAM_CMD) {
         return stream_cmd_action_info::make(
             uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
     }
-    // return std::make_shared<action_info_make_shared>(key, args);
-    return sptr(new action_info(key, args));
+    return make_action_pooled<action_info>(key, args);
 }
 
 /*** Stream Command Action Info **********************************************/
@@ -47,7 +161,7 @@ stream_cmd_action_info::stream_cmd_action_info(
 stream_cmd_action_info::sptr stream_cmd_action_info::make(
     const uhd::stream_cmd_t::stream_mode_t stream_mode)
 {
-    return sptr(new stream_cmd_action_info(stream_mode));
+    return make_action_pooled<stream_cmd_action_info>(stream_mode);
 }
 
 /*** RX Metadata Action Info *************************************************/
@@ -60,14 +174,7 @@ rx_event_action_info::rx_event_action_info(uhd::rx_metadata_t::error_code_t erro
 rx_event_action_info::sptr rx_event_action_info::make(
     uhd::rx_metadata_t::error_code_t error_code)
 {
-    struct rx_event_action_info_make_shared : public rx_event_action_info
-    {
-        rx_event_action_info_make_shared(uhd::rx_metadata_t::error_code_t error_code)
-            : rx_event_action_info(error_code)
-        {
-        }
-    };
-    return std::make_shared<rx_event_action_info_make_shared>(error_code);
+    return make_action_pooled<rx_event_action_info>(error_code);
 }
 
 /*** TX Metadata Action Info *************************************************/
@@ -84,13 +191,5 @@ tx_event_action_info::tx_event_action_info(
 tx_event_action_info::sptr tx_event_action_info::make(
     uhd::async_metadata_t::event_code_t event_code, const boost::optional<uint64_t>& tsf)
 {
-    struct tx_event_action_info_make_shared : public tx_event_action_info
-    {
-        tx_event_action_info_make_shared(uhd::async_metadata_t::event_code_t event_code,
-            const boost::optional<uint64_t>& tsf)
-            : tx_event_action_info(event_code, tsf)
-        {
-        }
-    };
-    return std::make_shared<tx_event_action_info_make_shared>(event_code, tsf);
+    return make_action_pooled<tx_event_action_info>(event_code, tsf);
 }
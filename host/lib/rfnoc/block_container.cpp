@@ -44,8 +44,8 @@ std::vector<block_id_t> block_container_t::find_blocks(
     std::vector<block_id_t> block_ids;
     for (auto it = _blocks.cbegin(); it != _blocks.cend(); ++it) {
         auto id = (*it)->get_block_id();
-        if (id.match(block_id_hint) || block_id_hint.empty()) {
-            block_ids.push_back(id);
+        if (block_id_hint.empty() || id.match(block_id_hint)) {
+            block_ids.push_back(std::move(id));
         }
     }
     std::sort(block_ids.begin(),
@@ -60,7 +60,7 @@ bool block_container_t::has_block(const block_id_t& block_id) const
 {
     std::lock_guard<std::mutex> lock(_mutex);
     return std::any_of(
-        _blocks.cbegin(), _blocks.cend(), [block_id](noc_block_base::sptr block) {
+        _blocks.cbegin(), _blocks.cend(), [&block_id](const noc_block_base::sptr& block) {
             return block->get_block_id() == block_id;
         });
 }
@@ -68,7 +68,7 @@ bool block_container_t::has_block(const block_id_t& block_id) const
 noc_block_base::sptr block_container_t::get_block(const block_id_t& block_id) const
 {
     auto block_itr = std::find_if(
-        _blocks.cbegin(), _blocks.cend(), [block_id](noc_block_base::sptr block) {
+        _blocks.cbegin(), _blocks.cend(), [&block_id](const noc_block_base::sptr& block) {
             return block->get_block_id() == block_id;
         });
     if (block_itr == _blocks.cend()) {
@@ -10,13 +10,31 @@
 #include <uhd/property_tree.hpp>
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/constants.hpp>
-#include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
 #include <iostream>
 #include <regex>
 
 using namespace uhd::rfnoc;
 
+namespace {
+
+// Compiling a std::regex is expensive (it allocates and builds the state
+// machine), and the block ID expressions never change, so compile them once.
+// Graph construction validates and matches IDs thousands of times.
+const std::regex& blockname_regex()
+{
+    static const std::regex re(VALID_BLOCKNAME_REGEX);
+    return re;
+}
+
+const std::regex& blockid_regex()
+{
+    static const std::regex re(VALID_BLOCKID_REGEX);
+    return re;
+}
+
+} // namespace
+
 block_id_t::block_id_t() : _device_no(0), _block_name(""), _block_ctr(0) {}
 
 block_id_t::block_id_t(const std::string& block_str)
@@ -39,34 +57,33 @@ block_id_t::block_id_t(
 
 bool block_id_t::is_valid_blockname(const std::string& block_name)
 {
-    return std::regex_match(block_name, std::regex(VALID_BLOCKNAME_REGEX));
+    return std::regex_match(block_name, blockname_regex());
 }
 
 bool block_id_t::is_valid_block_id(const std::string& block_name)
 {
-    return std::regex_match(block_name, std::regex(VALID_BLOCKID_REGEX));
+    return std::regex_match(block_name, blockid_regex());
 }
 
 std::string block_id_t::to_string() const
 {
-    return str(boost::format("%d/%s") % get_device_no() % get_local());
+    return std::to_string(get_device_no()) + "/" + get_local();
 }
 
 std::string block_id_t::get_local() const
 {
-    return str(boost::format("%s#%d") % get_block_name() % get_block_count());
+    return _block_name + "#" + std::to_string(_block_ctr);
 }
 
 uhd::fs_path block_id_t::get_tree_root() const
 {
-    return str(boost::format("/mboards/%d/xbar/%s") % get_device_no() % get_local());
+    return "/mboards/" + std::to_string(get_device_no()) + "/xbar/" + get_local();
 }
 
 bool block_id_t::match(const std::string& block_str)
 {
     std::cmatch matches;
-    if (not std::regex_match(
-            block_str.c_str(), matches, std::regex(VALID_BLOCKID_REGEX))) {
+    if (not std::regex_match(block_str.c_str(), matches, blockid_regex())) {
         return false;
     }
     try {
@@ -84,8 +101,7 @@ bool block_id_t::match(const std::string& block_str)
 bool block_id_t::set(const std::string& new_name)
 {
     std::cmatch matches;
-    if (not std::regex_match(
-            new_name.c_str(), matches, std::regex(VALID_BLOCKID_REGEX))) {
+    if (not std::regex_match(new_name.c_str(), matches, blockid_regex())) {
         return false;
     }
     if (not(matches[1] == "")) {
@@ -13,8 +13,11 @@
 #include <uhdlib/rfnoc/chdr_types.hpp>
 #include <boost/format.hpp>
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -64,7 +67,9 @@ public:
                 }
             }
             // Release child endpoints
-            _endpoint_map.clear(););
+            _endpoint_map.clear();
+            std::atomic_store(&_dispatch_table,
+                std::make_shared<const dispatch_table_t>()););
     }
 
     virtual ctrlport_endpoint::sptr get_ctrlport_ep(sep_id_t dst_epid,
@@ -102,6 +107,7 @@ public:
                 client_clk,
                 timebase_clk);
             _endpoint_map.insert(std::make_pair(key, ctrlport_ep));
+            _publish_dispatch_table();
             UHD_LOG_DEBUG("RFNOC",
                 boost::format("Created ctrlport endpoint for port %d on EPID %d")
                     % dst_port % _my_epid);
@@ -132,10 +138,24 @@ private:
                 // std::lock_guard<std::mutex> lock(_mutex);
                 try {
                     _recv_pkt->refresh(buff->data());
-                    const ctrl_payload payload = _recv_pkt->get_payload();
-                    ep_map_key_t key{payload.src_epid, payload.dst_port};
-                    if (_endpoint_map.find(key) != _endpoint_map.end()) {
-                        _endpoint_map.at(key)->handle_recv(payload);
+                    // Route on an allocation-free view first; the full
+                    // payload (with its heap-backed data vector) is only
+                    // constructed for packets that have a recipient
+                    const auto payload_view = _recv_pkt->get_payload_view();
+                    // Dispatch through the published table: an index by
+                    // dst_port, then a scan of the (nearly always
+                    // single-entry) per-port list for the source EPID, so
+                    // the cost does not grow with the number of registered
+                    // endpoints
+                    const auto table  = std::atomic_load(&_dispatch_table);
+                    const size_t port = payload_view.dst_port();
+                    if (port < table->size()) {
+                        for (const auto& ep : (*table)[port]) {
+                            if (ep.first == payload_view.src_epid()) {
+                                ep.second->handle_recv(_recv_pkt->get_payload());
+                                break;
+                            }
+                        }
                     }
                 } catch (...) {
                     // Ignore all errors
@@ -162,6 +182,28 @@ private:
     }
 
     using ep_map_key_t = std::pair<sep_id_t, uint16_t>;
+    // Immutable dispatch structure: indexed by dst_port, each slot lists the
+    // registered endpoints for that port by source EPID
+    using dispatch_table_t =
+        std::vector<std::vector<std::pair<sep_id_t, ctrlport_endpoint::sptr>>>;
+
+    // Rebuild the dispatch table from _endpoint_map and publish it. RCU
+    // style: readers atomically load the current table and keep it alive via
+    // shared_ptr, so registration never blocks or races response dispatch.
+    // Must be called with _mutex held.
+    void _publish_dispatch_table()
+    {
+        auto new_table = std::make_shared<dispatch_table_t>();
+        for (const auto& ep : _endpoint_map) {
+            const size_t port = ep.first.second;
+            if (new_table->size() <= port) {
+                new_table->resize(port + 1);
+            }
+            (*new_table)[port].emplace_back(ep.first.first, ep.second);
+        }
+        std::atomic_store(&_dispatch_table,
+            std::shared_ptr<const dispatch_table_t>(std::move(new_table)));
+    }
 
     // The endpoint ID of this software endpoint
     const sep_id_t _my_epid;
@@ -174,8 +216,13 @@ private:
     // Packet containers
     chdr_ctrl_packet::uptr _send_pkt;
     chdr_ctrl_packet::cuptr _recv_pkt;
-    // A collection of ctrlport endpoints (keyed by the port number)
+    // A collection of ctrlport endpoints (keyed by the port number). This is
+    // the writer-side registry; response dispatch goes through
+    // _dispatch_table instead.
     std::map<ep_map_key_t, ctrlport_endpoint::sptr> _endpoint_map;
+    // Read-mostly dispatch table published by _publish_dispatch_table()
+    std::shared_ptr<const dispatch_table_t> _dispatch_table =
+        std::make_shared<dispatch_table_t>();
     // Mutex that protects all state in this class except for _send_pkt
     std::mutex _mutex;
     // Mutex that protects _send_pkt and _xport.send
@@ -27,8 +27,16 @@ chdr_ctrl_xport::chdr_ctrl_xport(io_service::sptr io_srv,
                                               frame_buff::uptr buff, send_link_if* link) {
         link->release_send_buff(std::move(buff));
     };
-    _send_if = io_srv->make_send_client(
-        send_link, num_send_frames, send_cb, recv_link_if::sptr(), 0, nullptr, nullptr);
+    // Flag the sender as high priority so control packets preempt bulk data
+    // at packet boundaries when control and data share a link
+    _send_if = io_srv->make_send_client(send_link,
+        num_send_frames,
+        send_cb,
+        recv_link_if::sptr(),
+        0,
+        nullptr,
+        nullptr,
+        true);
 
     /* Make dumb recv pipe that matches management and control packets */
     uhd::transport::recv_callback_t ctrl_recv_cb =
@@ -0,0 +1,138 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
+#include <uhdlib/rfnoc/chdr_types.hpp>
+#include <algorithm>
+#include <fstream>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+// The capture is written as little-endian pcapng; the byte-order magic in
+// the section header tells readers so
+void write_u16(std::ostream& out, const uint16_t value)
+{
+    const char bytes[2] = {char(value & 0xFF), char((value >> 8) & 0xFF)};
+    out.write(bytes, sizeof(bytes));
+}
+
+void write_u32(std::ostream& out, const uint32_t value)
+{
+    const char bytes[4] = {char(value & 0xFF),
+        char((value >> 8) & 0xFF),
+        char((value >> 16) & 0xFF),
+        char((value >> 24) & 0xFF)};
+    out.write(bytes, sizeof(bytes));
+}
+
+void write_u64(std::ostream& out, const uint64_t value)
+{
+    write_u32(out, uint32_t(value & 0xFFFFFFFF));
+    write_u32(out, uint32_t(value >> 32));
+}
+
+constexpr uint32_t PCAPNG_SHB_TYPE  = 0x0A0D0D0A;
+constexpr uint32_t PCAPNG_IDB_TYPE  = 0x00000001;
+constexpr uint32_t PCAPNG_EPB_TYPE  = 0x00000006;
+constexpr uint32_t PCAPNG_BOM_MAGIC = 0x1A2B3C4D;
+
+// There is no assigned link type for CHDR, so the capture uses the first
+// user-defined link type. Records hold only the first header word and the
+// optional timestamp word.
+constexpr uint16_t LINKTYPE_USER0 = 147;
+constexpr uint32_t SNAP_LEN       = 16;
+
+} // namespace
+
+chdr_flight_recorder::chdr_flight_recorder(
+    const size_t num_records, const std::string& file_prefix)
+    : _file_prefix(file_prefix)
+{
+    if (num_records == 0) {
+        throw uhd::value_error(
+            "[chdr_flight_recorder] Ring capacity must be nonzero");
+    }
+    _records.resize(num_records);
+}
+
+void chdr_flight_recorder::dump(std::ostream& out) const
+{
+    // Section header block
+    write_u32(out, PCAPNG_SHB_TYPE);
+    write_u32(out, 28); // block length
+    write_u32(out, PCAPNG_BOM_MAGIC);
+    write_u16(out, 1); // major version
+    write_u16(out, 0); // minor version
+    write_u64(out, 0xFFFFFFFFFFFFFFFFull); // section length (unspecified)
+    write_u32(out, 28);
+
+    // Interface description block, with nanosecond timestamp resolution
+    write_u32(out, PCAPNG_IDB_TYPE);
+    write_u32(out, 32); // block length
+    write_u16(out, LINKTYPE_USER0);
+    write_u16(out, 0); // reserved
+    write_u32(out, SNAP_LEN);
+    write_u16(out, 9); // option: if_tsresol
+    write_u16(out, 1); // option length
+    write_u32(out, 9); // 10^-9 seconds, padded to 32 bits
+    write_u16(out, 0); // option: end of options
+    write_u16(out, 0);
+    write_u32(out, 32);
+
+    // One enhanced packet block per record, oldest first
+    const uint64_t total = _next_record.load(std::memory_order_acquire);
+    const uint64_t first = total > _records.size() ? total - _records.size() : 0;
+    for (uint64_t seq = first; seq < total; seq++) {
+        const record_t& rec     = _records[seq % _records.size()];
+        const uint32_t data_len = rec.has_tsf ? 16 : 8;
+        const uint32_t blk_len  = 44 + data_len;
+        const uint32_t orig_len =
+            uint32_t(chdr::chdr_header(rec.header).get_length());
+
+        write_u32(out, PCAPNG_EPB_TYPE);
+        write_u32(out, blk_len);
+        write_u32(out, 0); // interface ID
+        write_u32(out, uint32_t(rec.time_ns >> 32));
+        write_u32(out, uint32_t(rec.time_ns & 0xFFFFFFFF));
+        write_u32(out, data_len); // captured packet length
+        write_u32(out, std::max(orig_len, data_len)); // original packet length
+        write_u64(out, rec.header);
+        if (rec.has_tsf) {
+            write_u64(out, rec.tsf);
+        }
+        write_u16(out, 2); // option: epb_flags
+        write_u16(out, 4); // option length
+        write_u32(out, rec.dir == DIR_RX ? 0x1 : 0x2); // inbound / outbound
+        write_u16(out, 0); // option: end of options
+        write_u16(out, 0);
+        write_u32(out, blk_len);
+    }
+}
+
+std::string chdr_flight_recorder::dump_on_error()
+{
+    if (_dumped) {
+        return "";
+    }
+    _dumped = true;
+
+    const std::string path = _file_prefix + ".pcapng";
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (not out) {
+        UHD_LOG_ERROR("FLIGHT_RECORDER",
+            "Failed to open " << path << " for the packet history dump");
+        return "";
+    }
+    dump(out);
+    UHD_LOG_WARNING("FLIGHT_RECORDER",
+        "Stream error: dumped the last " << std::min<uint64_t>(get_num_recorded(),
+            _records.size()) << " packet headers to " << path);
+    return path;
+}
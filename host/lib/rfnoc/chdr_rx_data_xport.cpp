@@ -41,18 +41,23 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _fc_sender(pkt_factory, epids)
     , _epid(epids.second)
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
+    , _endianness(pkt_factory.get_endianness())
 {
     UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
         "Creating rx xport with local epid=" << epids.second
                                              << ", remote epid=" << epids.first);
 
-    _recv_packet    = pkt_factory.make_generic();
     _recv_packet_cb = pkt_factory.make_generic();
     _fc_sender.set_capacity(fc_params.buff_capacity);
 
+    // At most num_recv_frames data packets can be queued between the recv
+    // callback and their release; one extra slot keeps the tail from
+    // catching the head
+    _fc_pkt_sizes.resize(num_recv_frames + 1);
+
     // Calculate max payload size
     const size_t pyld_offset =
-        _recv_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
+        _recv_packet_cb->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     _max_payload_size = recv_link->get_recv_frame_size() - pyld_offset;
 
     // Make data transport
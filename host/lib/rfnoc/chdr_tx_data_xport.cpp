@@ -42,14 +42,19 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
         "Creating tx xport with local epid=" << epids.first
                                              << ", remote epid=" << epids.second);
 
-    _send_header.set_dst_epid(epids.second);
-    _send_packet = pkt_factory.make_generic();
+    _hdr_template.set_dst_epid(epids.second);
     _recv_packet = pkt_factory.make_generic();
 
+    // Precompute everything write_packet_header() needs, so the per-packet
+    // path reduces to assembling the header word from the template
+    chdr::chdr_packet::uptr send_packet = pkt_factory.make_generic();
+    _pyld_offset_with_ts =
+        send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
+    _pyld_offset_no_ts = send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_NO_TS);
+    _endianness        = pkt_factory.get_endianness();
+
     // Calculate max payload size
-    const size_t pyld_offset =
-        _send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
-    _max_payload_size = send_link->get_send_frame_size() - pyld_offset;
+    _max_payload_size = send_link->get_send_frame_size() - _pyld_offset_with_ts;
 
     // Now create the send I/O we will use for data
     auto send_cb = [this](buff_t::uptr buff, transport::send_link_if* send_link) {
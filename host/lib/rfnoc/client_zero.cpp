@@ -9,6 +9,7 @@
 #include <uhdlib/utils/narrow.hpp>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace uhd::rfnoc;
 using namespace uhd::rfnoc::detail;
@@ -43,12 +44,14 @@ client_zero::client_zero(register_iface::sptr reg)
     : uhd::rfnoc::register_iface_holder(reg)
 {
     // The info we need is static, so we can read it all up front, and store the
-    // parsed information.
-    const uint32_t proto_reg_val       = regs().peek32(PROTOVER_ADDR);
-    const uint32_t port_reg_val        = regs().peek32(PORT_CNT_ADDR);
-    const uint32_t edge_reg_val        = regs().peek32(EDGE_CNT_ADDR);
-    const uint32_t device_info_reg_val = regs().peek32(DEVICE_INFO_ADDR);
-    const uint32_t cport_info_reg_val  = regs().peek32(CTRLPORT_CNT_ADDR);
+    // parsed information. The registers are contiguous, so fetch them in one
+    // wide read rather than paying a transport round trip per register.
+    const auto info_reg_vals = regs().block_peek32(PROTOVER_ADDR, 5);
+    const uint32_t proto_reg_val       = info_reg_vals[PROTOVER_ADDR / 4];
+    const uint32_t port_reg_val        = info_reg_vals[PORT_CNT_ADDR / 4];
+    const uint32_t edge_reg_val        = info_reg_vals[EDGE_CNT_ADDR / 4];
+    const uint32_t device_info_reg_val = info_reg_vals[DEVICE_INFO_ADDR / 4];
+    const uint32_t cport_info_reg_val  = info_reg_vals[CTRLPORT_CNT_ADDR / 4];
 
     // Parse the PROTOVER_ADDR register
     _proto_ver = proto_reg_val & 0xFFFF;
@@ -105,9 +108,8 @@ std::vector<client_zero::edge_def_t> client_zero::_get_adjacency_list()
 
 uint32_t client_zero::get_noc_id(uint16_t portno)
 {
-    _check_port_number(portno);
     // The NOC ID is the second entry in the port's register space
-    return regs().peek32(_get_port_base_addr(portno) + 4);
+    return _get_static_port_info(portno).noc_id;
 }
 
 bool client_zero::get_flush_active(uint16_t portno)
@@ -169,14 +171,33 @@ bool client_zero::complete_flush_all_blocks()
         set_flush(block_portno);
     }
 
-    // Poll for flush done
-    bool all_ports_flushed = true;
+    // Poll all ports collectively: the flushes proceed in parallel in the
+    // fabric, so one shared deadline bounds the total wait by the slowest
+    // block instead of accumulating a full timeout per block.
+    std::vector<uint16_t> pending_ports;
+    pending_ports.reserve(num_blocks);
     for (size_t portno = 0; portno < num_blocks; ++portno) {
-        size_t block_portno = portno + first_block_port;
-        all_ports_flushed   = all_ports_flushed && poll_flush_done(block_portno);
+        pending_ports.push_back(uhd::narrow_cast<uint16_t>(portno + first_block_port));
+    }
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_POLL_TIMEOUT;
+    while (!pending_ports.empty()) {
+        for (auto it = pending_ports.begin(); it != pending_ports.end();) {
+            if (get_flush_done(*it)) {
+                it = pending_ports.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (pending_ports.empty()) {
+            break;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_POLL_PERIOD));
     }
 
-    return all_ports_flushed;
+    return true;
 }
 
 void client_zero::reset_ctrl(uint16_t portno)
@@ -201,13 +222,37 @@ void client_zero::reset_chdr(uint16_t portno)
     std::this_thread::sleep_for(1ms);
 }
 
+void client_zero::reset_all_blocks()
+{
+    const size_t num_blocks       = get_num_blocks();
+    const size_t first_block_port = 1 + get_num_stream_endpoints();
+
+    // The resets settle in parallel, so trigger the rising edge on every
+    // port first and wait the time requested by the RFNoC spec once,
+    // instead of once per block.
+    for (size_t portno = 0; portno < num_blocks; ++portno) {
+        const auto block_portno = uhd::narrow_cast<uint16_t>(portno + first_block_port);
+        regs().poke32(_get_port_base_addr(block_portno) + FLUSH_RESET_ADDR, 0);
+        regs().poke32(
+            _get_port_base_addr(block_portno) + FLUSH_RESET_ADDR, (1 << 2) /* 2nd bit */);
+    }
+    std::this_thread::sleep_for(1ms);
+    for (size_t portno = 0; portno < num_blocks; ++portno) {
+        const auto block_portno = uhd::narrow_cast<uint16_t>(portno + first_block_port);
+        regs().poke32(_get_port_base_addr(block_portno) + FLUSH_RESET_ADDR, 0);
+        regs().poke32(
+            _get_port_base_addr(block_portno) + FLUSH_RESET_ADDR, (1 << 1) /* 1st bit */);
+    }
+    std::this_thread::sleep_for(100us);
+}
+
 client_zero::block_config_info client_zero::get_block_info(uint16_t portno)
 {
-    _check_port_number(portno);
+    const auto& port_info = _get_static_port_info(portno);
     // The block and ctrl information is in the port's first register
-    uint32_t config_reg_val = regs().peek32(_get_port_base_addr(portno) + 0);
+    const uint32_t config_reg_val = port_info.config_reg_val;
     // The block and ctrl information is in the port's third register
-    uint32_t data_reg_val = regs().peek32(_get_port_base_addr(portno) + 8);
+    const uint32_t data_reg_val = port_info.data_reg_val;
     return {uhd::narrow_cast<uint8_t>((config_reg_val & 0x0000003F) >> 0),
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x00000FC0) >> 6),
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x0003F000) >> 12),
@@ -221,6 +266,27 @@ uint32_t client_zero::_get_port_base_addr(uint16_t portno)
     return REGS_PER_PORT * portno * 4;
 }
 
+const client_zero::static_port_info_t& client_zero::_get_static_port_info(uint16_t portno)
+{
+    _check_port_number(portno);
+    auto port_info_it = _static_port_info.find(portno);
+    if (port_info_it == _static_port_info.end()) {
+        // All three read registers of the port are contiguous, so grab them
+        // in a single wide read. Note that only the static fields of these
+        // registers may be served from this cache; the flush status flags
+        // (bits 0 and 1 of the third register) are volatile and are read
+        // live in _get_flush_status_flags().
+        const auto port_reg_vals = regs().block_peek32(_get_port_base_addr(portno), 3);
+        port_info_it =
+            _static_port_info
+                .emplace(portno,
+                    static_port_info_t{
+                        port_reg_vals[0], port_reg_vals[1], port_reg_vals[2]})
+                .first;
+    }
+    return port_info_it->second;
+}
+
 void client_zero::_check_port_number(uint16_t portno)
 {
     auto num_ports = get_num_blocks() + get_num_stream_endpoints() + 1;
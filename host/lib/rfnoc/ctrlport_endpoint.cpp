@@ -11,6 +11,7 @@
 #include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
 #include <condition_variable>
 #include <boost/format.hpp>
+#include <atomic>
 #include <deque>
 #include <mutex>
 #include <numeric>
@@ -27,12 +28,22 @@ using namespace std::chrono_literals;
 namespace {
 //! Max async msg (CTRL_WRITE) size in 32-bit words (2 hdr, 2 TS, 1 op-word, 1 data)
 constexpr size_t ASYNC_MESSAGE_SIZE = 6;
+//! Max number of data words in a single control payload (NumData is a 4-bit field)
+constexpr size_t MAX_PAYLOAD_DATA_WORDS = 15;
 //! Default completion timeout for transactions
 constexpr double DEFAULT_TIMEOUT = 0.1;
 //! Long timeout for when we wait on a timed command
 constexpr double MASSIVE_TIMEOUT = 10.0;
 //! Default value for whether ACKs are always required
 constexpr bool DEFAULT_FORCE_ACKS = false;
+//! Number of times wait_for_ack() polls the completion counter before it
+//! falls back to waiting on the condition variable. Control responses
+//! typically arrive within a few microseconds, so during bulk configuration
+//! (e.g. a tuning storm writing many registers with ACKs, or the read-ahead
+//! in block_peek32()) the poll almost always succeeds and the waiter never
+//! pays the wake/sleep context switch of the condition variable. If no
+//! response shows up within the budget, we sleep as before.
+constexpr size_t ACK_POLL_COUNT = 2000;
 } // namespace
 
 ctrlport_endpoint::~ctrlport_endpoint() = default;
@@ -64,6 +75,13 @@ public:
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
         bool ack                   = false)
     {
+        // With the write_combine policy, unacked writes get queued and are
+        // sent as a single block write once the run of consecutive addresses
+        // ends (or the payload is full). A timed write starts a new run and
+        // shares its timestamp with the writes that join it.
+        if (maybe_enqueue_write(addr, data, timestamp, ack)) {
+            return;
+        }
         // Compute transaction expiration time
         auto timeout_time = start_timeout(_policy.timeout);
         // Send request
@@ -119,6 +137,8 @@ public:
     virtual uint32_t peek32(
         uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP)
     {
+        // Queued writes must hit the hardware before we read back
+        flush_write_queue();
         // Compute transaction expiration time
         auto timeout_time = start_timeout(_policy.timeout);
         // Send request
@@ -133,10 +153,29 @@ public:
         size_t length,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP)
     {
-        std::vector<uint32_t> values;
+        // Queued writes must hit the hardware before we read back
+        flush_write_queue();
+        // Read ahead: issue all read requests up front, then collect the
+        // responses. The device processes requests in order and responses
+        // come back in order, so waiting on the ACKs one by one after all
+        // requests are in flight yields the same values as serialized reads
+        // while only paying the transport round trip once.
+        std::vector<std::pair<ctrl_payload, steady_clock::time_point>> requests;
+        requests.reserve(length);
         for (size_t i = 0; i < length; i++) {
-            values.push_back(peek32(first_addr + (i * sizeof(uint32_t)),
-                (i == 0) ? timestamp : uhd::time_spec_t::ASAP));
+            auto timeout_time = start_timeout(_policy.timeout);
+            requests.push_back(
+                std::make_pair(send_request_packet(OP_READ,
+                                   first_addr + (i * sizeof(uint32_t)),
+                                   {uint32_t(0)},
+                                   (i == 0) ? timestamp : uhd::time_spec_t::ASAP,
+                                   timeout_time),
+                    timeout_time));
+        }
+        std::vector<uint32_t> values;
+        values.reserve(length);
+        for (const auto& request : requests) {
+            values.push_back(wait_for_ack(request.first, request.second).data_vtr[0]);
         }
         return values;
 
@@ -165,6 +204,8 @@ public:
         // TODO: Uncomment when this is implemented in the FPGA
         throw uhd::not_implemented_error("Control poll not implemented in the FPGA");
 
+        // Queued writes must hit the hardware before the poll
+        flush_write_queue();
         // Compute transaction expiration time
         auto timeout_time = start_timeout(_policy.timeout);
         // Send request
@@ -181,6 +222,8 @@ public:
 
     virtual void sleep(uhd::time_spec_t duration, bool ack = false)
     {
+        // Queued writes must precede the sleep on the control bus
+        flush_write_queue();
         // Compute transaction expiration time
         auto timeout_time = start_timeout(_policy.timeout);
         // Send request
@@ -207,12 +250,31 @@ public:
         _handle_async_msg = callback_f;
     }
 
+    virtual size_t get_cmd_buff_space() const
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return get_cmd_buff_space_locked();
+    }
+
+    virtual void register_cmd_buff_space_handler(cmd_buff_space_callback_t callback_f)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _handle_cmd_buff_space = callback_f;
+    }
+
     virtual void set_policy(const std::string& name, const uhd::device_addr_t& args)
     {
+        // Leaving write-combining mode flushes whatever is still queued
+        flush_write_queue();
         std::unique_lock<std::mutex> lock(_mutex);
         if (name == "default") {
-            _policy.timeout    = args.cast<double>("timeout", DEFAULT_TIMEOUT);
-            _policy.force_acks = DEFAULT_FORCE_ACKS;
+            _policy.timeout       = args.cast<double>("timeout", DEFAULT_TIMEOUT);
+            _policy.force_acks    = DEFAULT_FORCE_ACKS;
+            _policy.write_combine = false;
+        } else if (name == "write_combine") {
+            _policy.timeout       = args.cast<double>("timeout", DEFAULT_TIMEOUT);
+            _policy.force_acks    = DEFAULT_FORCE_ACKS;
+            _policy.write_combine = true;
         } else {
             // TODO: Uncomment when custom policies are implemented
             throw uhd::not_implemented_error("Policy implemented in the FPGA");
@@ -236,6 +298,7 @@ public:
                 _req_queue.pop_front();
                 // Push the response into the response queue
                 _resp_queue.push(std::make_tuple(rx_ctrl, resp_status));
+                _num_resps_ready.fetch_add(1, std::memory_order_release);
                 _resp_ready_cond.notify_one();
             };
             // Function to process a response with sequence errors
@@ -248,6 +311,7 @@ public:
                 ctrl_payload resp(_req_queue.front());
                 resp.is_ack = true;
                 _resp_queue.push(std::make_tuple(resp, RESP_DROPPED));
+                _num_resps_ready.fetch_add(1, std::memory_order_release);
                 _resp_ready_cond.notify_one();
                 // Pop the request from the queue
                 _req_queue.pop_front();
@@ -268,6 +332,33 @@ public:
                 // Requests are processed in order. If seq_num_diff is negative then we
                 // have either already seen this response or we have dropped >128
                 // responses. Either way ignore this packet.
+                return;
+            }
+
+            // We granted flow control credits above: Notify the command buffer
+            // space handler, if one is registered. The callback is invoked
+            // outside of the lock so that it may queue new commands.
+            cmd_buff_space_callback_t notify_cmd_buff_space;
+            size_t buff_space = 0;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (_handle_cmd_buff_space) {
+                    notify_cmd_buff_space = _handle_cmd_buff_space;
+                    buff_space            = get_cmd_buff_space_locked();
+                }
+            }
+            if (notify_cmd_buff_space) {
+                try {
+                    notify_cmd_buff_space(buff_space);
+                } catch (const std::exception& ex) {
+                    UHD_LOG_ERROR("CTRLEP",
+                        "Caught exception during command buffer space handling: "
+                            << ex.what());
+                } catch (...) {
+                    UHD_LOG_ERROR("CTRLEP",
+                        "Caught unknown exception during command buffer space "
+                        "handling!");
+                }
             }
         } else {
             // Handle asynchronous message callback
@@ -350,6 +441,19 @@ private:
         return steady_clock::now() + (static_cast<int>(std::ceil(duration / 1e-6)) * 1us);
     }
 
+    //! Returns the free command buffer space in 32-bit words. Requires _mutex.
+    //
+    // The room reserved for async message responses is not available for
+    // commands, so it is excluded here (matching the flow control condition in
+    // send_request_packet()).
+    size_t get_cmd_buff_space_locked() const
+    {
+        const ssize_t buff_space =
+            ssize_t(_buff_capacity - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs))
+            - _buff_occupied;
+        return (buff_space > 0) ? size_t(buff_space) : 0;
+    }
+
     //! Returns whether or not we have a timed command queued
     bool check_timed_in_queue() const
     {
@@ -361,6 +465,87 @@ private:
         return false;
     }
 
+    //! Queues a write in the write-combining buffer, if possible
+    //
+    // Returns true if the write was absorbed into the queue. Returns false if
+    // write-combining is disabled or the write must be individually observable
+    // (it is acked); in the latter case any queued run is flushed first so
+    // that ordering is preserved on the regular path.
+    //
+    // An untimed write can join the current run. A timed write always starts
+    // a new run, and its timestamp applies to the whole run, so that e.g. a
+    // timed sequence of GPIO attribute writes goes out as a single timed
+    // packet and executes back-to-back in hardware at the requested time.
+    bool maybe_enqueue_write(
+        uint32_t addr, uint32_t data, const uhd::time_spec_t& time_spec, bool ack)
+    {
+        uint32_t flush_addr = 0;
+        std::vector<uint32_t> flush_data;
+        uhd::time_spec_t flush_timestamp = uhd::time_spec_t::ASAP;
+        bool queued                      = false;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (!_policy.write_combine) {
+                return false;
+            }
+            const bool combinable = !(ack || _policy.force_acks);
+            const bool timed      = (time_spec != uhd::time_spec_t::ASAP);
+            const bool adjacent =
+                !_wc_data.empty()
+                && addr == _wc_first_addr + uint32_t(_wc_data.size() * sizeof(uint32_t));
+            if (combinable && !timed && adjacent
+                && _wc_data.size() < MAX_PAYLOAD_DATA_WORDS) {
+                _wc_data.push_back(data);
+                return true;
+            }
+            // The run of consecutive addresses ends here (or the payload is
+            // full, or this write is timed): take it out of the queue so it
+            // can be sent below, and start a new run with this write if it is
+            // combinable
+            flush_addr      = _wc_first_addr;
+            flush_timestamp = _wc_timestamp;
+            flush_data.swap(_wc_data);
+            _wc_timestamp = uhd::time_spec_t::ASAP;
+            if (combinable) {
+                _wc_first_addr = addr;
+                _wc_timestamp  = time_spec;
+                _wc_data.push_back(data);
+                queued = true;
+            }
+        }
+        if (!flush_data.empty()) {
+            send_combined_write(flush_addr, flush_data, flush_timestamp);
+        }
+        return queued;
+    }
+
+    //! Sends any queued combined writes as a single block write
+    void flush_write_queue()
+    {
+        uint32_t flush_addr = 0;
+        std::vector<uint32_t> flush_data;
+        uhd::time_spec_t flush_timestamp = uhd::time_spec_t::ASAP;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            flush_addr      = _wc_first_addr;
+            flush_timestamp = _wc_timestamp;
+            flush_data.swap(_wc_data);
+            _wc_timestamp = uhd::time_spec_t::ASAP;
+        }
+        if (!flush_data.empty()) {
+            send_combined_write(flush_addr, flush_data, flush_timestamp);
+        }
+    }
+
+    //! Sends a run of writes to consecutive addresses as one block write
+    void send_combined_write(uint32_t first_addr,
+        const std::vector<uint32_t>& data,
+        const uhd::time_spec_t& time_spec)
+    {
+        auto timeout_time = start_timeout(_policy.timeout);
+        send_request_packet(OP_BLOCK_WRITE, first_addr, data, time_spec, timeout_time);
+    }
+
     //! Sends a request control packet to a remote device
     const ctrl_payload send_request_packet(ctrl_opcode_t op_code,
         uint32_t address,
@@ -433,6 +618,15 @@ private:
     {
         auto resp_ready = [this]() -> bool { return !_resp_queue.empty(); };
         while (true) {
+            // Completion polling: spin on the counter that the I/O thread
+            // bumps for every queued response, without taking the lock, for
+            // a short budget before falling back to the condition variable.
+            // This keeps the I/O thread free to acquire the lock and keeps
+            // the waiter on its core for the common fast-response case.
+            for (size_t i = 0; i < ACK_POLL_COUNT
+                               and _num_resps_ready.load(std::memory_order_acquire) == 0;
+                 i++) {
+            }
             std::unique_lock<std::mutex> lock(_mutex);
             // Wait until there is a response in the response queue
             if (!resp_ready()) {
@@ -445,6 +639,7 @@ private:
             response_status_t resp_status;
             std::tie(rx_ctrl, resp_status) = _resp_queue.front();
             _resp_queue.pop();
+            _num_resps_ready.fetch_sub(1, std::memory_order_relaxed);
             // Check if this is the response meant for the request
             // Filter by op_code, address and seq_num
             if (rx_ctrl.seq_num == request.seq_num && rx_ctrl.op_code == request.op_code
@@ -479,8 +674,9 @@ private:
     //! The parameters associated with the policy that governs this object
     struct policy_args
     {
-        double timeout  = DEFAULT_TIMEOUT;
-        bool force_acks = DEFAULT_FORCE_ACKS;
+        double timeout     = DEFAULT_TIMEOUT;
+        bool force_acks    = DEFAULT_FORCE_ACKS;
+        bool write_combine = false;
     };
     //! The software status (different from the transaction status) of the response
     enum response_status_t { RESP_VALID, RESP_DROPPED, RESP_RTERR, RESP_SIZEERR };
@@ -506,22 +702,36 @@ private:
         [](uint32_t, const std::vector<uint32_t>&) { return true; };
     //! The function to call to handle an async message
     async_msg_callback_t _handle_async_msg = async_msg_callback_t();
+    //! The function to call when command buffer space frees up
+    cmd_buff_space_callback_t _handle_cmd_buff_space = cmd_buff_space_callback_t();
     //! The current control sequence number of outgoing packets
     uint8_t _tx_seq_num = 0;
     //! The number of occupied words in the downstream buffer
     ssize_t _buff_occupied = 0;
     //! The arguments for the policy that governs this register interface
     policy_args _policy;
+    //! The address of the first write in the write-combining queue
+    uint32_t _wc_first_addr = 0;
+    //! The timestamp of the queued writes (set by the write that started the
+    // run, and shared by the whole run)
+    uhd::time_spec_t _wc_timestamp = uhd::time_spec_t::ASAP;
+    //! The data of the queued writes (at consecutive addresses from
+    // _wc_first_addr)
+    std::vector<uint32_t> _wc_data;
     //! A condition variable that hold the "downstream buffer is free" condition
     std::condition_variable _buff_free_cond;
     //! A queue that holds all outstanding requests
     std::deque<ctrl_payload> _req_queue;
     //! A queue that holds all outstanding responses and their status
     std::queue<std::tuple<ctrl_payload, response_status_t>> _resp_queue;
+    //! Lock-free view of the response queue's size, so that waiters can poll
+    // for a completion without contending for _mutex with the I/O thread
+    std::atomic<size_t> _num_resps_ready{0};
     //! A condition variable that hold the "response is available" condition
     std::condition_variable _resp_ready_cond;
-    //! A mutex to protect all state in this class
-    std::mutex _mutex;
+    //! A mutex to protect all state in this class (mutable so that const
+    // queries like get_cmd_buff_space() can lock it)
+    mutable std::mutex _mutex;
 };
 
 ctrlport_endpoint::sptr ctrlport_endpoint::make(const send_fn_t& handle_send,
@@ -16,7 +16,10 @@
 #include <uhdlib/usrp/cores/dsp_core_utils.hpp>
 #include <uhdlib/utils/compat_check.hpp>
 #include <uhdlib/utils/math.hpp>
+#include <boost/format.hpp>
 #include <boost/math/special_functions/round.hpp>
+#include <algorithm>
+#include <cmath>
 #include <set>
 #include <string>
 
@@ -84,6 +87,11 @@ public:
         for (size_t decim : decims) {
             _valid_decims.push_back(uhd::range_t(double(decim)));
         }
+        // The legal set is fixed by the hardware, so keep a sorted integer
+        // table next to the meta_range: coercion in the resolvers then
+        // becomes a binary search instead of a linear meta_range clip (which
+        // also re-checks monotonicity on every call)
+        _decim_table.assign(decims.begin(), decims.end());
 
         // Initialize properties. It is very important to first reserve the
         // space, because we use push_back() further down, and properties must
@@ -176,6 +184,33 @@ public:
         return _samp_rate_out.at(chan).get();
     }
 
+    double set_output_rate_fast(const double rate, const size_t chan)
+    {
+        if (!_samp_rate_in.at(chan).is_valid()) {
+            throw uhd::runtime_error(
+                "Cannot use fast-path rate change before the input rate is valid! "
+                "Commit the graph first.");
+        }
+        const double input_rate = _samp_rate_in.at(chan).get();
+        const int decim         = boost::math::iround(input_rate / rate);
+        // The fast path never coerces: the requested rate must hit a legal
+        // decimation exactly (we use a relative comparison here, because the
+        // absolute delta of frequencies_are_equal() is too coarse for low rates)
+        if (decim < 1 or coerce_decim(double(decim)) != decim
+            or not(uhd::math::fp_compare::fp_compare_epsilon<double>(input_rate / decim)
+                   == rate)) {
+            throw uhd::value_error(
+                str(boost::format("set_output_rate_fast(): Requested rate %f is not a "
+                                  "legal decimation of the input rate %f!")
+                    % rate % input_rate));
+        }
+        // This runs the decim resolver (register writes, output rate and
+        // scaling update), but skips the graph-wide propagation
+        set_property_local<int>(
+            PROP_KEY_DECIM, decim, {res_source_info::USER, chan});
+        return _samp_rate_out.at(chan).get();
+    }
+
     // Somewhat counter-intuitively, we post a stream command as a message to
     // ourselves. That's because it's easier to re-use the message handler than
     // it is to reuse the issue_stream_cmd() API call, because this API call
@@ -533,7 +568,19 @@ private:
     int coerce_decim(const double requested_decim) const
     {
         UHD_ASSERT_THROW(requested_decim >= 0);
-        return static_cast<int>(_valid_decims.clip(requested_decim, true));
+        const auto above = std::lower_bound(
+            _decim_table.begin(), _decim_table.end(), requested_decim);
+        if (above == _decim_table.end()) {
+            return _decim_table.back();
+        }
+        if (above == _decim_table.begin()) {
+            return _decim_table.front();
+        }
+        const int below = *std::prev(above);
+        // Like meta_range_t::clip(), ties round down
+        return (std::abs(requested_decim - *above) < std::abs(requested_decim - below))
+                   ? *above
+                   : below;
     }
 
     //! Set the DDS frequency shift the signal to \p requested_freq
@@ -561,6 +608,8 @@ private:
 
     //! List of valid decimation values
     uhd::meta_range_t _valid_decims;
+    //! Same values as _valid_decims, as a sorted integer table for coercion
+    std::vector<int> _decim_table;
 
     //! Cache the current residual scaling
     std::vector<double> _residual_scaling;
@@ -41,7 +41,9 @@ public:
                 },
                 [this, i](
                     const uint32_t addr) { return regs().peek32(addr + i * REG_OFFSET); },
-                i));
+                i,
+                [this, i](
+                    const uint32_t addr) { return regs().peek64(addr + i * REG_OFFSET); }));
             RFNOC_LOG_DEBUG("Initialized FIFO core " << i << ".");
             if (_fifo_cores.back()->has_bist()) {
                 RFNOC_LOG_DEBUG("Running BIST...");
@@ -62,6 +64,22 @@ public:
         return _fifo_cores.at(chan)->get_packet_count();
     }
 
+    uint64_t get_fifo_fullness(const size_t chan)
+    {
+        UHD_ASSERT_THROW(chan < _fifo_cores.size());
+        return _fifo_cores.at(chan)->get_fifo_fullness();
+    }
+
+    std::vector<uint64_t> get_fifo_fullness()
+    {
+        std::vector<uint64_t> fullness;
+        fullness.reserve(_fifo_cores.size());
+        for (auto& fifo_core : _fifo_cores) {
+            fullness.push_back(fifo_core->get_fifo_fullness());
+        }
+        return fullness;
+    }
+
 private:
     //! One FIFO core object per FIFO
     std::vector<dma_fifo_core_3000::sptr> _fifo_cores;
@@ -16,7 +16,10 @@
 #include <uhdlib/usrp/cores/dsp_core_utils.hpp>
 #include <uhdlib/utils/compat_check.hpp>
 #include <uhdlib/utils/math.hpp>
+#include <boost/format.hpp>
 #include <boost/math/special_functions/round.hpp>
+#include <algorithm>
+#include <cmath>
 #include <set>
 #include <string>
 
@@ -81,6 +84,11 @@ public:
         for (size_t interp : interps) {
             _valid_interps.push_back(uhd::range_t(double(interp)));
         }
+        // The legal set is fixed by the hardware, so keep a sorted integer
+        // table next to the meta_range: coercion in the resolvers then
+        // becomes a binary search instead of a linear meta_range clip (which
+        // also re-checks monotonicity on every call)
+        _interp_table.assign(interps.begin(), interps.end());
 
         // Initialize properties. It is very important to first reserve the
         // space, because we use push_back() further down, and properties must
@@ -174,6 +182,33 @@ public:
         return _samp_rate_in.at(chan).get();
     }
 
+    double set_input_rate_fast(const double rate, const size_t chan)
+    {
+        if (!_samp_rate_out.at(chan).is_valid()) {
+            throw uhd::runtime_error(
+                "Cannot use fast-path rate change before the output rate is valid! "
+                "Commit the graph first.");
+        }
+        const double output_rate = _samp_rate_out.at(chan).get();
+        const int interp         = boost::math::iround(output_rate / rate);
+        // The fast path never coerces: the requested rate must hit a legal
+        // interpolation exactly (we use a relative comparison here, because the
+        // absolute delta of frequencies_are_equal() is too coarse for low rates)
+        if (interp < 1 or coerce_interp(double(interp)) != interp
+            or not(uhd::math::fp_compare::fp_compare_epsilon<double>(output_rate / interp)
+                   == rate)) {
+            throw uhd::value_error(
+                str(boost::format("set_input_rate_fast(): Requested rate %f is not a "
+                                  "legal interpolation of the output rate %f!")
+                    % rate % output_rate));
+        }
+        // This runs the interp resolver (register writes, input rate and
+        // scaling update), but skips the graph-wide propagation
+        set_property_local<int>(
+            PROP_KEY_INTERP, interp, {res_source_info::USER, chan});
+        return _samp_rate_in.at(chan).get();
+    }
+
 protected:
     //! Block-specific register interface
     multichan_register_iface _duc_reg_iface;
@@ -514,7 +549,19 @@ private:
     int coerce_interp(const double requested_interp) const
     {
         UHD_ASSERT_THROW(requested_interp >= 0);
-        return static_cast<int>(_valid_interps.clip(requested_interp, true));
+        const auto above = std::lower_bound(
+            _interp_table.begin(), _interp_table.end(), requested_interp);
+        if (above == _interp_table.end()) {
+            return _interp_table.back();
+        }
+        if (above == _interp_table.begin()) {
+            return _interp_table.front();
+        }
+        const int below = *std::prev(above);
+        // Like meta_range_t::clip(), ties round down
+        return (std::abs(requested_interp - *above) < std::abs(requested_interp - below))
+                   ? *above
+                   : below;
     }
 
     //! Set the DDS frequency shift the signal to \p requested_freq
@@ -542,6 +589,8 @@ private:
 
     //! List of valid interpolation values
     uhd::meta_range_t _valid_interps;
+    //! Same values as _valid_interps, as a sorted integer table for coercion
+    std::vector<int> _interp_table;
 
     //! Cache the current residual scaling
     std::vector<double> _residual_scaling;
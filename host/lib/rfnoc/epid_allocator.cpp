@@ -29,16 +29,22 @@ sep_id_t epid_allocator::allocate_epid(const sep_addr_t& addr)
 sep_id_t epid_allocator::allocate_epid(
     const sep_addr_t& addr, mgmt::mgmt_portal& mgmt_portal, chdr_ctrl_xport& xport)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::unique_lock<std::mutex> lock(_mutex);
 
     if (_epid_map.count(addr) == 0) {
         sep_id_t new_epid   = _next_epid++;
         _epid_map[addr]     = new_epid;
         _addr_map[new_epid] = addr;
+        // The management transaction does not touch the allocation tables, so
+        // run it unlocked. Endpoints on independent links can then be
+        // initialized concurrently instead of serializing on this allocator
+        // (there is one allocator per rfnoc_graph but one portal per link).
+        lock.unlock();
         mgmt_portal.initialize_endpoint(xport, addr, new_epid);
         return new_epid;
     } else {
         sep_id_t epid = _epid_map.at(addr);
+        lock.unlock();
         mgmt_portal.register_endpoint(addr, epid);
         return epid;
     }
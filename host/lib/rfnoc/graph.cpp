@@ -11,7 +11,9 @@
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <limits>
+#include <set>
 #include <utility>
+#include <vector>
 
 using namespace uhd::rfnoc;
 using namespace uhd::rfnoc::detail;
@@ -140,6 +142,16 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
         dst_node, [this, dst_node](const res_source_info& src, action_info::sptr action) {
             this->enqueue_action(dst_node, src, action);
         });
+    node_accessor.set_post_actions_callback(src_node,
+        [this, src_node](
+            const std::vector<std::pair<res_source_info, action_info::sptr>>& actions) {
+            this->enqueue_actions(src_node, actions);
+        });
+    node_accessor.set_post_actions_callback(dst_node,
+        [this, dst_node](
+            const std::vector<std::pair<res_source_info, action_info::sptr>>& actions) {
+            this->enqueue_actions(dst_node, actions);
+        });
 
     // Check if connection exists
     // This can be optimized: Edges can appear in both out_edges and in_edges,
@@ -176,6 +188,48 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
     }
 }
 
+void graph_t::remove_node(node_ref_t node)
+{
+    std::lock_guard<std::recursive_mutex> l(_release_mutex);
+    auto node_it = _node_map.find(node);
+    if (node_it == _node_map.end()) {
+        return;
+    }
+    node_accessor_t node_accessor{};
+    UHD_LOG_TRACE(LOG_ID, "Removing node " << node->get_unique_id());
+
+    // Restore the node's default callbacks so that a stray resolution or
+    // action on the removed node can no longer call back into this graph
+    node_accessor.set_resolve_all_callback(node, [node]() {
+        node_accessor_t{}.resolve_props(node);
+        node_accessor_t{}.clean_props(node);
+    });
+    node_accessor.set_post_action_callback(
+        node, [](const res_source_info&, action_info::sptr) { /* nop */ });
+    node_accessor.set_post_actions_callback(node,
+        [](const std::vector<std::pair<res_source_info, action_info::sptr>>&) {
+            /* nop */
+        });
+
+    const auto vertex_desc = node_it->second;
+    boost::clear_vertex(vertex_desc, _graph);
+    boost::remove_vertex(vertex_desc, _graph);
+
+    // With vecS vertex storage, removing a vertex invalidates all descriptors
+    // after it. Rebuild the node map, and re-seat the remaining nodes'
+    // resolve callbacks, which capture descriptors.
+    _node_map.clear();
+    auto v_range = boost::vertices(_graph);
+    for (auto v_it = v_range.first; v_it != v_range.second; ++v_it) {
+        node_ref_t v_node = boost::get(vertex_property_t(), _graph, *v_it);
+        _node_map.emplace(v_node, *v_it);
+        const auto v_desc = *v_it;
+        node_accessor.set_resolve_all_callback(v_node, [this, v_desc]() {
+            this->resolve_all_properties(resolve_context::NODE_PROP, v_desc);
+        });
+    }
+}
+
 void graph_t::commit()
 {
     std::lock_guard<std::recursive_mutex> l(_release_mutex);
@@ -249,7 +303,7 @@ void graph_t::resolve_all_properties(
         return;
     }
 
-    // First, find the node on which we'll start.
+    // First, find the dirty nodes from which resolution must start.
     auto initial_dirty_nodes = _find_dirty_nodes();
     if (initial_dirty_nodes.size() > 1) {
         UHD_LOGGER_WARNING(LOG_ID)
@@ -262,31 +316,54 @@ void graph_t::resolve_all_properties(
         }
     }
 
-    // Now get all nodes in topologically sorted order, and the appropriate
-    // iterators.
+    // Now get all nodes in topologically sorted order, and build a map from
+    // vertex descriptor to topological index so the worklist below can hand
+    // out nodes in topologically sorted order.
     auto topo_sorted_nodes = _get_topo_sorted_nodes();
-    auto node_it           = topo_sorted_nodes.begin();
-    auto begin_it          = topo_sorted_nodes.begin();
-    auto end_it            = topo_sorted_nodes.end();
-    while (*node_it != initial_node) {
-        // We know *node_it must be == initial_node at some point, because
-        // otherwise, initial_dirty_nodes would have been empty
-        node_it++;
-    }
-
-    // Start iterating over nodes
-    bool forward_dir   = true;
-    int num_iterations = 0;
-    // If all edge properties were known at the beginning, a single iteration
-    // would suffice. However, usually during the first time the property
-    // propagation is run, blocks create new (dynamic) edge properties that
-    // default to dirty. If we had a way of knowing when that happens, we could
-    // dynamically increase the number of iterations during the loop. For now,
-    // we simply hard-code the number of iterations to 2 so that we catch that
-    // case without any additional complications.
-    constexpr int MAX_NUM_ITERATIONS = 2;
-    while (true) {
-        node_ref_t current_node = boost::get(vertex_property_t(), _graph, *node_it);
+    const std::vector<rfnoc_graph_t::vertex_descriptor> topo_order(
+        topo_sorted_nodes.cbegin(), topo_sorted_nodes.cend());
+    std::map<rfnoc_graph_t::vertex_descriptor, size_t> topo_index;
+    for (size_t i = 0; i < topo_order.size(); i++) {
+        topo_index.emplace(topo_order[i], i);
+    }
+
+    // The worklist of nodes that still require resolution, stored as indices
+    // into the topological order so that the topologically first dirty node is
+    // always resolved next. Resolving a node can only dirty its direct
+    // neighbours (through edge property forwarding), and those simply get
+    // (re-)inserted into the worklist, regardless of whether they are
+    // upstream or downstream of the current node. This way, only the part of
+    // the graph that is reachable from the dirtied properties is revisited,
+    // instead of sweeping all nodes.
+    std::set<size_t> worklist;
+    if (context == resolve_context::INIT) {
+        // On initialization, all nodes require at least one resolution
+        for (size_t i = 0; i < topo_order.size(); i++) {
+            worklist.insert(i);
+        }
+    } else {
+        worklist.insert(topo_index.at(initial_node));
+        for (auto& vertex : initial_dirty_nodes) {
+            worklist.insert(topo_index.at(vertex));
+        }
+    }
+
+    // Limit the total number of resolutions to catch the case where nodes
+    // keep dirtying each other and the resolution cannot converge. The limit
+    // matches the two full sweeps the previous ping-pong algorithm performed.
+    const size_t max_resolutions = 2 * topo_order.size();
+    size_t num_resolutions       = 0;
+    while (!worklist.empty()) {
+        if (num_resolutions++ >= max_resolutions) {
+            UHD_LOG_TRACE(LOG_ID,
+                "Terminating graph resolution after " << num_resolutions
+                                                      << " node resolutions");
+            break;
+        }
+        const auto current_vertex = topo_order[*worklist.begin()];
+        worklist.erase(worklist.begin());
+        node_ref_t current_node =
+            boost::get(vertex_property_t(), _graph, current_vertex);
         UHD_LOG_TRACE(
             LOG_ID, "Now resolving next node: " << current_node->get_unique_id());
 
@@ -302,49 +379,36 @@ void graph_t::resolve_all_properties(
         //  Forward all edge props in all directions from current node. We make
         //  sure to skip properties if the edge is flagged as
         //  !property_propagation_active
-        _forward_edge_props(*node_it);
+        _forward_edge_props(current_vertex);
 
         // Now mark all properties on this node as clean
         node_accessor.clean_props(current_node);
 
-        // If the property resolution was triggered by a node updating one of
-        // its properties, we can stop anytime there are no more dirty nodes.
-        if (context == resolve_context::NODE_PROP && _find_dirty_nodes().empty()) {
-            UHD_LOG_TRACE(LOG_ID,
-                "Terminating graph resolution early during iteration " << num_iterations);
-            break;
-        }
-
-        // The rest of the code in this loop is to figure out who's the next
-        // node. First, increment (or decrement) iterator:
-        if (forward_dir) {
-            node_it++;
-            // If we're at the end, flip the direction
-            if (node_it == end_it) {
-                forward_dir = false;
-                // Back off from the sentinel:
-                node_it--;
+        // Requeue any neighbour that the edge property forwarding above has
+        // dirtied
+        auto requeue_if_dirty = [this, &worklist, &topo_index](
+                                    rfnoc_graph_t::vertex_descriptor vertex) {
+            if (!get_dirty_props(boost::get(vertex_property_t(), _graph, vertex))
+                     .empty()) {
+                worklist.insert(topo_index.at(vertex));
             }
+        };
+        auto ie_iters = boost::in_edges(current_vertex, _graph);
+        for (auto it = ie_iters.first; it != ie_iters.second; ++it) {
+            requeue_if_dirty(boost::source(*it, _graph));
         }
-        if (!forward_dir) {
-            if (topo_sorted_nodes.size() > 1) {
-                node_it--;
-                // If we're back at the front, flip direction
-                if (node_it == begin_it) {
-                    forward_dir = true;
-                }
-            } else {
-                forward_dir = true;
-            }
+        auto oe_iters = boost::out_edges(current_vertex, _graph);
+        for (auto it = oe_iters.first; it != oe_iters.second; ++it) {
+            requeue_if_dirty(boost::target(*it, _graph));
         }
-        // If we're going forward, and the next node is the initial node,
-        // we've gone full circle (one full iteration).
-        if (forward_dir && (*node_it == initial_node)) {
-            num_iterations++;
-            if (num_iterations == MAX_NUM_ITERATIONS || _find_dirty_nodes().empty()) {
-                UHD_LOG_TRACE(LOG_ID,
-                    "Terminating graph resolution after iteration " << num_iterations);
-                break;
+
+        // When the worklist drains, do one graph-wide check for stragglers.
+        // During the first resolution, blocks may create new (dynamic) edge
+        // properties that default to dirty; this picks those up without
+        // having to sweep all nodes on every resolution.
+        if (worklist.empty()) {
+            for (auto& vertex : _find_dirty_nodes()) {
+                worklist.insert(topo_index.at(vertex));
             }
         }
     }
@@ -417,6 +481,44 @@ void graph_t::enqueue_action(
         return;
     }
 
+    _process_action_queue();
+}
+
+void graph_t::enqueue_actions(node_ref_t src_node,
+    const std::vector<std::pair<res_source_info, action_info::sptr>>& actions)
+{
+    // See enqueue_action() for the locking rationale
+    std::lock_guard<std::recursive_mutex> release_lock(_release_mutex);
+    if (_shutdown) {
+        return;
+    }
+    if (_release_count) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Action propagation is not enabled, graph is not committed! Will not "
+            "propagate action batch from `"
+                << src_node->get_unique_id() << "'");
+        return;
+    }
+
+    const bool handling_ongoing = _action_handling_ongoing.test_and_set();
+    // Stash the entire batch at the end of the action queue before any of it
+    // is delivered
+    for (const auto& action : actions) {
+        _action_queue.emplace_back(
+            std::make_tuple(src_node, action.first, action.second));
+    }
+    if (handling_ongoing) {
+        UHD_LOG_TRACE(LOG_ID,
+            "Action handling ongoing, deferring delivery of action batch from "
+                << src_node->get_unique_id());
+        return;
+    }
+
+    _process_action_queue();
+}
+
+void graph_t::_process_action_queue()
+{
     unsigned iteration_count = 0;
     while (!_action_queue.empty()) {
         if (iteration_count++ == MAX_ACTION_ITERATIONS) {
@@ -428,7 +530,7 @@ void graph_t::enqueue_action(
         auto& next_action                  = _action_queue.front();
         node_ref_t action_src_node         = std::get<0>(next_action);
         res_source_info action_src_port    = std::get<1>(next_action);
-        action_info::sptr next_action_sptr = std::get<2>(next_action);
+        action_info::sptr next_action_sptr = std::move(std::get<2>(next_action));
         _action_queue.pop_front();
 
         // Find the node that is supposed to receive this action, and if we find
@@ -447,8 +549,9 @@ void graph_t::enqueue_action(
             if (recipient_node == nullptr) {
                 UHD_LOG_WARNING(LOG_ID,
                     "Cannot forward action "
-                        << action->key << " from " << src_node->get_unique_id() << ":"
-                        << src_edge.to_string() << ", no neighbour found!");
+                        << next_action_sptr->key << " from "
+                        << action_src_node->get_unique_id() << ":"
+                        << action_src_port.to_string() << ", no neighbour found!");
                 continue;
             }
             recipient_port = {res_source_info::invert_edge(action_src_port.type),
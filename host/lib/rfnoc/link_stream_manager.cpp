@@ -10,6 +10,8 @@
 #include <uhdlib/rfnoc/link_stream_manager.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <boost/format.hpp>
+#include <atomic>
+#include <mutex>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -238,7 +240,10 @@ public:
         // Create a new destination (host) endpoint and EPID
         sep_addr_t sw_epid_addr(_my_device_id, SEP_INST_DATA_BASE + (_data_ep_inst++));
         sep_id_t src_epid = _epid_alloc->allocate_epid(sw_epid_addr);
-        _allocated_epids.insert(src_epid);
+        {
+            std::lock_guard<std::mutex> lock(_allocated_epids_mutex);
+            _allocated_epids.insert(src_epid);
+        }
 
         return _mb_iface.make_tx_data_transport(*_mgmt_portal,
             {sw_epid_addr, dst_addr},
@@ -269,7 +274,10 @@ public:
         // Create a new destination (host) endpoint and EPID
         sep_addr_t sw_epid_addr(_my_device_id, SEP_INST_DATA_BASE + (_data_ep_inst++));
         sep_id_t dst_epid = _epid_alloc->allocate_epid(sw_epid_addr);
-        _allocated_epids.insert(dst_epid);
+        {
+            std::lock_guard<std::mutex> lock(_allocated_epids_mutex);
+            _allocated_epids.insert(dst_epid);
+        }
 
         return _mb_iface.make_rx_data_transport(*_mgmt_portal,
             {src_addr, sw_epid_addr},
@@ -308,7 +316,9 @@ private:
     mb_iface& _mb_iface;
     // A pointer to the EPID allocator
     epid_allocator::sptr _epid_alloc;
-    // A set of all allocated EPIDs
+    // A set of all allocated EPIDs, and a mutex to allow data transports to
+    // be created concurrently
+    std::mutex _allocated_epids_mutex;
     std::set<sep_id_t> _allocated_epids;
     // The software EPID for all management and control traffic
     sep_id_t _my_mgmt_ctrl_epid;
@@ -321,7 +331,7 @@ private:
     // A map of all client zero instances indexed by the destination
     std::map<sep_id_t, client_zero::sptr> _client_zero_map;
     // Data endpoint instance
-    sep_inst_t _data_ep_inst;
+    std::atomic<sep_inst_t> _data_ep_inst;
 };
 
 link_stream_manager::uptr link_stream_manager::make(
@@ -151,6 +151,19 @@ void mb_controller::timekeeper::set_tick_rate(const double tick_rate)
     set_period(period_ns);
 }
 
+std::vector<uhd::sensor_value_t> mb_controller::get_sensors(
+    const std::vector<std::string>& names)
+{
+    // Default implementation: Read the sensors one at a time. Devices that can
+    // batch sensor reads into a single transaction override this.
+    std::vector<uhd::sensor_value_t> values;
+    values.reserve(names.size());
+    for (const auto& name : names) {
+        values.push_back(get_sensor(name));
+    }
+    return values;
+}
+
 size_t mb_controller::get_num_timekeepers() const
 {
     return _timekeepers.size();
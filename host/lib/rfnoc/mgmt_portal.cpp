@@ -167,6 +167,113 @@ std::string to_string(const node_addr_t& node_addr)
     }
 }
 
+//! Topology previously discovered through a management portal, cached
+//  process-wide so that a portal re-created on the same hardware (additional
+//  links, or repeated sessions within one process) can skip the full
+//  crossbar walk and its timeout-probing of unconnected ports. Keyed by the
+//  identity of the node directly attached to the portal's transport plus the
+//  protocol version and CHDR width; staleness is caught when replaying the
+//  per-node initialization, which falls back to a full discovery.
+struct cached_topology_t
+{
+    //! Nodes and their addresses, in discovery (BFS) order. The order
+    //  guarantees that a node's upstream crossbars are initialized before
+    //  the node itself when the initialization is replayed.
+    std::vector<std::pair<node_id_t, node_addr_t>> nodes;
+    //! The stream endpoints found among the nodes
+    std::set<sep_addr_t> ep_set;
+};
+
+std::mutex topo_cache_mutex;
+std::map<std::string, cached_topology_t> topo_cache;
+
+std::string topo_cache_key(
+    const node_id_t& first_node, const uint16_t protover, const chdr_w_t chdr_w)
+{
+    return std::to_string(first_node.unique_id()) + ":"
+           + std::to_string(first_node.extended_info) + ":" + std::to_string(protover)
+           + ":" + std::to_string(static_cast<int>(chdr_w));
+}
+
+//---------------------------------------------------------------
+// Topology cache serialization
+//---------------------------------------------------------------
+// The blob starts with a magic number and a format version, followed by the
+// cache entries. All fields are packed little-endian with no padding.
+constexpr uint32_t TOPO_BLOB_MAGIC   = 0x55485054; // "UHPT"
+constexpr uint16_t TOPO_BLOB_VERSION = 1;
+
+void pack_u16(std::vector<uint8_t>& blob, const uint16_t value)
+{
+    blob.push_back(static_cast<uint8_t>(value & 0xFF));
+    blob.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+}
+
+void pack_u32(std::vector<uint8_t>& blob, const uint32_t value)
+{
+    pack_u16(blob, static_cast<uint16_t>(value & 0xFFFF));
+    pack_u16(blob, static_cast<uint16_t>((value >> 16) & 0xFFFF));
+}
+
+void pack_node_id(std::vector<uint8_t>& blob, const node_id_t& node)
+{
+    pack_u16(blob, node.device_id);
+    pack_u16(blob, static_cast<uint16_t>(node.type));
+    pack_u16(blob, node.inst);
+    pack_u32(blob, node.extended_info);
+}
+
+//! Bounds-checked reader for the blob format above
+struct topo_blob_reader_t
+{
+    topo_blob_reader_t(const std::vector<uint8_t>& blob_) : blob(blob_) {}
+
+    uint16_t unpack_u16()
+    {
+        if (pos + 2 > blob.size()) {
+            throw uhd::value_error("Topology cache blob is truncated");
+        }
+        const uint16_t value = static_cast<uint16_t>(blob[pos])
+                               | (static_cast<uint16_t>(blob[pos + 1]) << 8);
+        pos += 2;
+        return value;
+    }
+
+    uint32_t unpack_u32()
+    {
+        const uint32_t lo = unpack_u16();
+        return lo | (static_cast<uint32_t>(unpack_u16()) << 16);
+    }
+
+    std::string unpack_string()
+    {
+        const size_t len = unpack_u16();
+        if (pos + len > blob.size()) {
+            throw uhd::value_error("Topology cache blob is truncated");
+        }
+        std::string str(blob.begin() + pos, blob.begin() + pos + len);
+        pos += len;
+        return str;
+    }
+
+    node_id_t unpack_node_id()
+    {
+        node_id_t node;
+        node.device_id = unpack_u16();
+        node.type      = static_cast<node_type>(unpack_u16());
+        node.inst      = unpack_u16();
+        if (node.type != NODE_TYPE_XBAR and node.type != NODE_TYPE_STRM_EP
+            and node.type != NODE_TYPE_XPORT) {
+            throw uhd::value_error("Topology cache blob contains an invalid node type");
+        }
+        node.extended_info = unpack_u32();
+        return node;
+    }
+
+    const std::vector<uint8_t>& blob;
+    size_t pos = 0;
+};
+
 // Empty dtor for stream_manager
 mgmt_portal::~mgmt_portal() {}
 
@@ -303,16 +410,28 @@ public:
         // Lookup the physical stream endpoint address using the endpoint ID
         const node_addr_t& node_addr = _lookup_sep_node_addr(dst_epid);
 
+        // Initialize each node in the path. The responses carry no information
+        // we need, and a node performs its initialization when the request
+        // packet passes through it, before the response is generated. Requests
+        // posted back-to-back on the same transport are therefore executed in
+        // order, so we can post all of them before collecting the responses
+        // and pay approximately one round trip for the whole path instead of
+        // one per hop.
         node_addr_t route_addr = node_addr_t();
         route_addr.push_back(std::make_pair(_my_node_id, next_dest_t(-1)));
+        mgmt_payload init_req_xact;
+        size_t num_posted = 0;
         for (const auto& addr_pair : node_addr) {
-            mgmt_payload init_req_xact;
+            init_req_xact.clear();
             _traverse_to_node(init_req_xact, route_addr);
             _push_node_init_hop(init_req_xact, addr_pair.first, my_epid);
-            const mgmt_payload resp_xact =
-                _send_recv_mgmt_transaction(xport, init_req_xact);
+            _post_mgmt_transaction(xport, init_req_xact);
+            num_posted++;
             route_addr.push_back(addr_pair);
         }
+        for (size_t i = 0; i < num_posted; i++) {
+            _recv_mgmt_transaction(xport);
+        }
 
         // Build a management transaction to configure all the nodes in the path going to
         // dst_epid
@@ -648,11 +767,22 @@ private: // Functions
         std::queue<std::pair<node_id_t, next_dest_t>> pending_paths;
         auto my_epid = xport.get_epid();
 
-        // Add ourselves to the the pending queue to kick off the search
         UHD_LOG_DEBUG("RFNOC::MGMT",
             "Starting topology discovery from " << _my_node_id.to_string());
-        bool is_first_path = true;
-        pending_paths.push(std::make_pair(_my_node_id, next_dest_t(-1)));
+
+        // Identify the directly-attached node with a single transaction. Its
+        // identity keys the process-wide topology cache, so a portal created
+        // on hardware that was already walked can skip the BFS below and
+        // only replay the per-node initialization.
+        node_addr_t first_addr;
+        first_addr.push_back(std::make_pair(_my_node_id, next_dest_t(-1)));
+        const node_id_t first_node = _identify_node(xport, first_addr);
+
+        if (_restore_cached_topology(xport, first_node)) {
+            return;
+        }
+
+        _process_discovered_node(xport, first_node, first_addr, pending_paths);
 
         while (not pending_paths.empty()) {
             // Pop the next path to discover from the pending queue
@@ -662,34 +792,14 @@ private: // Functions
             // We need to build a node_addr_t to allow us to get to next_path
             // To do so we first lookup how to get to next_path.first. This location has
             // already been discovered so we should just be able to look it up in
-            // _node_addr_map. The only exception for that is when we are just starting
-            // out, in which case our previous node is "us".
-            node_addr_t next_addr = is_first_path ? node_addr_t()
-                                                  : _node_addr_map.at(next_path.first);
+            // _node_addr_map.
+            node_addr_t next_addr = _node_addr_map.at(next_path.first);
             // Once we know how to get to the base node, then add the next destination
             next_addr.push_back(next_path);
-            is_first_path = false;
-
-            // Build a management transaction to first get to our destination so that we
-            // can ask it to identify itself
-            mgmt_payload route_xact;
-            route_xact.set_header(my_epid, _protover, _chdr_w);
-            _traverse_to_node(route_xact, next_addr);
-
-            // Discover downstream node (we ask the node to identify itself)
-            mgmt_payload disc_req_xact(route_xact);
-            // Push a node discovery hop
-            mgmt_hop_t disc_hop;
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
-            disc_req_xact.add_hop(disc_hop);
 
             node_id_t new_node;
             try {
-                // Send the discovery transaction
-                const mgmt_payload disc_resp_xact =
-                    _send_recv_mgmt_transaction(xport, disc_req_xact);
-                new_node = _pop_node_discovery_hop(disc_resp_xact);
+                new_node = _identify_node(xport, next_addr);
             } catch (uhd::io_error& io_err) {
                 // We received an IO error. This could happen if we have a legitimate
                 // error or if there is no node to discover downstream. We can't tell for
@@ -709,78 +819,191 @@ private: // Functions
                 }
             }
 
-            // We found a node!
-            // First check if we have already seen this node in the past. If not, we have
-            // to add it to our internal data structures. If we have already seen it then
-            // we just skip it. It is OK to skip the node because we are doing a BFS,
-            // which means that the first time a node is discovered during the traversal,
-            // the distance from this EP to that node will be the shortest path. The core
-            // design philosophy for RFNoC is that the data will always take the shortest
-            // path, because we make the assumption that a shorter path *always* has
-            // better QoS compared to a longer one. If this assumption is not true, we
-            // have to handle ordering by QoS for which we need to modify this search a
-            // bit and provide QoS preferences in the API. That may be a future feature.
-            if (_node_addr_map.count(new_node) > 0) {
-                UHD_LOG_DEBUG("RFNOC::MGMT",
-                    "Re-discovered node " << new_node.to_string() << ". Skipping it");
-            } else {
-                UHD_LOG_DEBUG("RFNOC::MGMT", "Discovered node " << new_node.to_string());
-                _node_addr_map[new_node] = next_addr;
-
-                // Initialize the node (first time config)
-                mgmt_payload init_req_xact(route_xact);
-                _push_node_init_hop(init_req_xact, new_node, my_epid);
-                const mgmt_payload init_resp_xact =
-                    _send_recv_mgmt_transaction(xport, init_req_xact);
-                UHD_LOG_DEBUG("RFNOC::MGMT", "Initialized node " << new_node.to_string());
-
-                // If the new node is a stream endpoint then we are done traversing this
-                // path. If not, then check all ports downstream of the new node and add
-                // them to pending_paths for further traversal
-                switch (new_node.type) {
-                    case NODE_TYPE_XBAR: {
-                        // Total ports on this crossbar
-                        size_t nports =
-                            static_cast<size_t>(new_node.extended_info & 0xFF);
-                        // Total transport ports on this crossbar (the first nports_xport
-                        // ports are transport ports)
-                        size_t nports_xport =
-                            static_cast<size_t>((new_node.extended_info >> 8) & 0xFF);
-                        // When we allow daisy chaining, we need to recursively check
-                        // other transports
-                        size_t start_port = ALLOW_DAISY_CHAINING ? 0 : nports_xport;
-                        for (size_t i = start_port; i < nports; i++) {
-                            // Skip the current port because it's the input
-                            if (i != static_cast<size_t>(new_node.inst)) {
-                                // If there is a single downstream port then do nothing
-                                pending_paths.push(std::make_pair(
-                                    new_node, static_cast<next_dest_t>(i)));
-                            }
-                        }
-                        UHD_LOG_TRACE("RFNOC::MGMT",
-                            "* " << new_node.to_string() << " has " << nports
-                                 << " ports, " << nports_xport
-                                 << " transports and we are hooked up on port "
-                                 << new_node.inst);
-                    } break;
-                    case NODE_TYPE_STRM_EP: {
-                        // Stop searching when we find a stream endpoint
-                        // Add the endpoint to the discovered endpoint vector
-                        _discovered_ep_set.insert(
-                            sep_addr_t(new_node.device_id, new_node.inst));
-                    } break;
-                    case NODE_TYPE_XPORT: {
-                        // A transport has only one output. We don't need to take
-                        // any action to reach
-                        pending_paths.push(std::make_pair(new_node, -1));
-                    } break;
-                    default: {
-                        UHD_THROW_INVALID_CODE_PATH();
-                        break;
+            _process_discovered_node(xport, new_node, next_addr, pending_paths);
+        }
+
+        _store_cached_topology(first_node);
+    }
+
+    //! Route to the node at the given address and ask it to identify itself
+    node_id_t _identify_node(chdr_ctrl_xport& xport, const node_addr_t& node_addr)
+    {
+        mgmt_payload route_xact;
+        route_xact.set_header(xport.get_epid(), _protover, _chdr_w);
+        _traverse_to_node(route_xact, node_addr);
+
+        // Discover downstream node (we ask the node to identify itself)
+        mgmt_payload disc_req_xact(route_xact);
+        // Push a node discovery hop
+        mgmt_hop_t disc_hop;
+        disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
+        disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
+        disc_req_xact.add_hop(disc_hop);
+
+        const mgmt_payload disc_resp_xact =
+            _send_recv_mgmt_transaction(xport, disc_req_xact);
+        return _pop_node_discovery_hop(disc_resp_xact);
+    }
+
+    //! Record and initialize a discovered node and queue its downstream
+    //  ports for further traversal
+    void _process_discovered_node(chdr_ctrl_xport& xport,
+        const node_id_t& new_node,
+        const node_addr_t& next_addr,
+        std::queue<std::pair<node_id_t, next_dest_t>>& pending_paths)
+    {
+        const auto my_epid = xport.get_epid();
+
+        // We found a node!
+        // First check if we have already seen this node in the past. If not, we have
+        // to add it to our internal data structures. If we have already seen it then
+        // we just skip it. It is OK to skip the node because we are doing a BFS,
+        // which means that the first time a node is discovered during the traversal,
+        // the distance from this EP to that node will be the shortest path. The core
+        // design philosophy for RFNoC is that the data will always take the shortest
+        // path, because we make the assumption that a shorter path *always* has
+        // better QoS compared to a longer one. If this assumption is not true, we
+        // have to handle ordering by QoS for which we need to modify this search a
+        // bit and provide QoS preferences in the API. That may be a future feature.
+        if (_node_addr_map.count(new_node) > 0) {
+            UHD_LOG_DEBUG("RFNOC::MGMT",
+                "Re-discovered node " << new_node.to_string() << ". Skipping it");
+            return;
+        }
+
+        UHD_LOG_DEBUG("RFNOC::MGMT", "Discovered node " << new_node.to_string());
+        _node_addr_map[new_node] = next_addr;
+        _discovery_order.push_back(new_node);
+
+        // Initialize the node (first time config)
+        mgmt_payload route_xact;
+        route_xact.set_header(my_epid, _protover, _chdr_w);
+        _traverse_to_node(route_xact, next_addr);
+        mgmt_payload init_req_xact(route_xact);
+        _push_node_init_hop(init_req_xact, new_node, my_epid);
+        const mgmt_payload init_resp_xact =
+            _send_recv_mgmt_transaction(xport, init_req_xact);
+        (void)init_resp_xact;
+        UHD_LOG_DEBUG("RFNOC::MGMT", "Initialized node " << new_node.to_string());
+
+        // If the new node is a stream endpoint then we are done traversing this
+        // path. If not, then check all ports downstream of the new node and add
+        // them to pending_paths for further traversal
+        switch (new_node.type) {
+            case NODE_TYPE_XBAR: {
+                // Total ports on this crossbar
+                size_t nports = static_cast<size_t>(new_node.extended_info & 0xFF);
+                // Total transport ports on this crossbar (the first nports_xport
+                // ports are transport ports)
+                size_t nports_xport =
+                    static_cast<size_t>((new_node.extended_info >> 8) & 0xFF);
+                // When we allow daisy chaining, we need to recursively check
+                // other transports
+                size_t start_port = ALLOW_DAISY_CHAINING ? 0 : nports_xport;
+                for (size_t i = start_port; i < nports; i++) {
+                    // Skip the current port because it's the input
+                    if (i != static_cast<size_t>(new_node.inst)) {
+                        // If there is a single downstream port then do nothing
+                        pending_paths.push(
+                            std::make_pair(new_node, static_cast<next_dest_t>(i)));
                     }
                 }
+                UHD_LOG_TRACE("RFNOC::MGMT",
+                    "* " << new_node.to_string() << " has " << nports << " ports, "
+                         << nports_xport
+                         << " transports and we are hooked up on port "
+                         << new_node.inst);
+            } break;
+            case NODE_TYPE_STRM_EP: {
+                // Stop searching when we find a stream endpoint
+                // Add the endpoint to the discovered endpoint vector
+                _discovered_ep_set.insert(sep_addr_t(new_node.device_id, new_node.inst));
+            } break;
+            case NODE_TYPE_XPORT: {
+                // A transport has only one output. We don't need to take
+                // any action to reach
+                pending_paths.push(std::make_pair(new_node, -1));
+            } break;
+            default: {
+                UHD_THROW_INVALID_CODE_PATH();
+                break;
+            }
+        }
+    }
+
+    //! Adopt a previously discovered topology if one is cached for the
+    //  attached hardware. Returns false on a cache miss or when the cached
+    //  topology turns out to be stale, in which case a full discovery must
+    //  run.
+    bool _restore_cached_topology(chdr_ctrl_xport& xport, const node_id_t& first_node)
+    {
+        const std::string key = topo_cache_key(first_node, _protover, _chdr_w);
+        cached_topology_t cached;
+        {
+            std::lock_guard<std::mutex> lock(topo_cache_mutex);
+            const auto it = topo_cache.find(key);
+            if (it == topo_cache.end()) {
+                return false;
+            }
+            cached = it->second;
+        }
+
+        UHD_LOG_DEBUG("RFNOC::MGMT",
+            "Restoring cached topology with " << cached.nodes.size()
+                                              << " nodes, skipping rediscovery");
+
+        // Replay the per-node initialization in discovery order, so routes
+        // for this portal's EPID get programmed into each upstream crossbar
+        // before nodes behind it are reached. If the hardware no longer
+        // matches the cache (e.g. a different image was loaded), a node
+        // fails to respond and we fall back to a full discovery.
+        try {
+            // As in setup_local_route(), the responses are not inspected and
+            // each node initializes when the request passes through it, so all
+            // requests can be posted before the responses are collected.
+            mgmt_payload init_req_xact;
+            for (const auto& node_pair : cached.nodes) {
+                init_req_xact.clear();
+                _traverse_to_node(init_req_xact, node_pair.second);
+                _push_node_init_hop(init_req_xact, node_pair.first, xport.get_epid());
+                _post_mgmt_transaction(xport, init_req_xact);
+            }
+            for (size_t i = 0; i < cached.nodes.size(); i++) {
+                _recv_mgmt_transaction(xport);
             }
+        } catch (const uhd::io_error&) {
+            UHD_LOG_DEBUG(
+                "RFNOC::MGMT", "Cached topology is stale, running a full discovery");
+            // Drain responses that may still be in flight from the pipelined
+            // requests above so they are not mistaken for responses to the
+            // transactions the full discovery is about to run
+            while (auto mgmt_buff = xport.get_mgmt_buff(100)) {
+                xport.release_mgmt_buff(std::move(mgmt_buff));
+            }
+            std::lock_guard<std::mutex> lock(topo_cache_mutex);
+            topo_cache.erase(key);
+            return false;
+        }
+
+        for (const auto& node_pair : cached.nodes) {
+            _node_addr_map[node_pair.first] = node_pair.second;
+            _discovery_order.push_back(node_pair.first);
         }
+        _discovered_ep_set = cached.ep_set;
+        return true;
+    }
+
+    //! Save the topology found by the BFS for subsequent portals on the
+    //  same hardware
+    void _store_cached_topology(const node_id_t& first_node)
+    {
+        cached_topology_t cached;
+        for (const auto& node : _discovery_order) {
+            cached.nodes.push_back(std::make_pair(node, _node_addr_map.at(node)));
+        }
+        cached.ep_set = _discovered_ep_set;
+        std::lock_guard<std::mutex> lock(topo_cache_mutex);
+        topo_cache[topo_cache_key(first_node, _protover, _chdr_w)] = std::move(cached);
     }
 
     // Add hops to the management transaction to reach the specified node
@@ -1034,33 +1257,49 @@ private: // Functions
         xport.release_send_buff(std::move(send_buff));
     }
 
-    // Send the specified management transaction to the device and receive a response
-    const mgmt_payload _send_recv_mgmt_transaction(
-        chdr_ctrl_xport& xport, const mgmt_payload& transaction, double timeout = 0.1)
+    // Send a management transaction for which a response is expected, without
+    // waiting for the response to arrive. The transaction is finalized in place
+    // (header and response hop added). Each call must be paired with a
+    // subsequent _recv_mgmt_transaction() call on the same transport; responses
+    // arrive in send order.
+    void _post_mgmt_transaction(chdr_ctrl_xport& xport, mgmt_payload& transaction)
     {
-        auto my_epid = xport.get_epid();
-        mgmt_payload send(transaction);
-        send.set_header(my_epid, _protover, _chdr_w);
+        transaction.set_header(xport.get_epid(), _protover, _chdr_w);
         // If we are expecting to receive a response then we have to add an additional
         // NO-OP hop for the receive endpoint. All responses will be appended to this hop.
         mgmt_hop_t nop_hop;
         nop_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_NOP));
-        send.add_hop(nop_hop);
+        transaction.add_hop(nop_hop);
         // Send the transaction over the wire
-        _send_mgmt_transaction(xport, send);
+        _send_mgmt_transaction(xport, transaction);
+    }
 
+    // Receive the response for a previously posted management transaction
+    const mgmt_payload _recv_mgmt_transaction(chdr_ctrl_xport& xport, double timeout = 0.1)
+    {
         auto mgmt_buff = xport.get_mgmt_buff(timeout * 1000);
         if (not mgmt_buff) {
             throw uhd::io_error("Timed out getting recv buff for management transaction");
         }
         _recv_pkt->refresh(mgmt_buff->data());
         mgmt_payload recv;
-        recv.set_header(my_epid, _protover, _chdr_w);
+        recv.set_header(xport.get_epid(), _protover, _chdr_w);
         _recv_pkt->fill_payload(recv);
         xport.release_mgmt_buff(std::move(mgmt_buff));
         return recv;
     }
 
+    // Send the specified management transaction to the device and receive a response
+    const mgmt_payload _send_recv_mgmt_transaction(
+        chdr_ctrl_xport& xport, const mgmt_payload& transaction, double timeout = 0.1)
+    {
+        // Copy into the scratch transaction instead of constructing a fresh
+        // payload; the assignment reuses the hop storage from previous calls.
+        _scratch_xact = transaction;
+        _post_mgmt_transaction(xport, _scratch_xact);
+        return _recv_mgmt_transaction(xport, timeout);
+    }
+
 private: // Members
     // The software RFNoC protocol version
     const uint16_t _protover;
@@ -1074,6 +1313,10 @@ private: // Members
     // address of a node given the node ID. There may be multiple ways to get to the
     // node but we only store the shortest path here.
     std::map<node_id_t, node_addr_t> _node_addr_map;
+    // Nodes in the order they were discovered (BFS order). Used to replay the
+    // per-node initialization with upstream nodes first when the topology is
+    // restored from the cache.
+    std::vector<node_id_t> _discovery_order;
     // A list of all discovered endpoints
     std::set<sep_addr_t> _discovered_ep_set;
     // A table that maps a stream endpoint ID to the physical address of the stream
@@ -1084,6 +1327,9 @@ private: // Members
     // Management packet containers
     chdr_mgmt_packet::uptr _send_pkt;
     chdr_mgmt_packet::cuptr _recv_pkt;
+    // Scratch transaction reused across sends to avoid allocating hop
+    // buffers for every transaction (protected by _mutex)
+    mgmt_payload _scratch_xact;
     // Hop configuration function maps
     std::map<uint8_t, xport_cfg_fn_t> _init_cfg_fns;
     std::map<uint8_t, xport_cfg_fn_t> _rtcfg_cfg_fns;
@@ -1092,6 +1338,85 @@ private: // Members
 }; // namespace mgmt
 
 
+std::vector<uint8_t> mgmt_portal::export_topology_cache()
+{
+    std::lock_guard<std::mutex> lock(topo_cache_mutex);
+    std::vector<uint8_t> blob;
+    pack_u32(blob, TOPO_BLOB_MAGIC);
+    pack_u16(blob, TOPO_BLOB_VERSION);
+    pack_u16(blob, static_cast<uint16_t>(topo_cache.size()));
+    for (const auto& entry : topo_cache) {
+        pack_u16(blob, static_cast<uint16_t>(entry.first.size()));
+        blob.insert(blob.end(), entry.first.begin(), entry.first.end());
+        pack_u16(blob, static_cast<uint16_t>(entry.second.nodes.size()));
+        for (const auto& node_pair : entry.second.nodes) {
+            pack_node_id(blob, node_pair.first);
+            pack_u16(blob, static_cast<uint16_t>(node_pair.second.size()));
+            for (const auto& hop : node_pair.second) {
+                pack_node_id(blob, hop.first);
+                pack_u32(blob, static_cast<uint32_t>(hop.second));
+            }
+        }
+        pack_u16(blob, static_cast<uint16_t>(entry.second.ep_set.size()));
+        for (const auto& ep : entry.second.ep_set) {
+            pack_u16(blob, ep.first);
+            pack_u16(blob, ep.second);
+        }
+    }
+    return blob;
+}
+
+void mgmt_portal::import_topology_cache(const std::vector<uint8_t>& blob)
+{
+    // Parse the entire blob before touching the cache, so that a malformed
+    // blob does not leave a half-imported topology behind
+    topo_blob_reader_t reader(blob);
+    if (reader.unpack_u32() != TOPO_BLOB_MAGIC) {
+        throw uhd::value_error("Invalid topology cache blob (bad magic number)");
+    }
+    const uint16_t version = reader.unpack_u16();
+    if (version != TOPO_BLOB_VERSION) {
+        throw uhd::value_error(
+            "Unsupported topology cache blob version: " + std::to_string(version));
+    }
+    std::map<std::string, cached_topology_t> imported;
+    const size_t num_entries = reader.unpack_u16();
+    for (size_t i = 0; i < num_entries; i++) {
+        const std::string key = reader.unpack_string();
+        cached_topology_t cached;
+        const size_t num_nodes = reader.unpack_u16();
+        for (size_t n = 0; n < num_nodes; n++) {
+            const node_id_t node = reader.unpack_node_id();
+            node_addr_t node_addr;
+            const size_t num_hops = reader.unpack_u16();
+            for (size_t h = 0; h < num_hops; h++) {
+                const node_id_t hop_node = reader.unpack_node_id();
+                const next_dest_t dest   = static_cast<next_dest_t>(reader.unpack_u32());
+                node_addr.push_back(std::make_pair(hop_node, dest));
+            }
+            cached.nodes.push_back(std::make_pair(node, std::move(node_addr)));
+        }
+        const size_t num_eps = reader.unpack_u16();
+        for (size_t e = 0; e < num_eps; e++) {
+            const device_id_t device_id = reader.unpack_u16();
+            const sep_inst_t inst       = reader.unpack_u16();
+            cached.ep_set.insert(sep_addr_t(device_id, inst));
+        }
+        imported[key] = std::move(cached);
+    }
+    if (reader.pos != blob.size()) {
+        throw uhd::value_error(
+            "Invalid topology cache blob (trailing bytes after last entry)");
+    }
+
+    std::lock_guard<std::mutex> lock(topo_cache_mutex);
+    for (auto& entry : imported) {
+        UHD_LOG_DEBUG("RFNOC::MGMT",
+            "Imported cached topology with " << entry.second.nodes.size() << " nodes");
+        topo_cache[entry.first] = std::move(entry.second);
+    }
+}
+
 mgmt_portal::uptr mgmt_portal::make(chdr_ctrl_xport& xport,
     const chdr::chdr_packet_factory& pkt_factory,
     sep_addr_t my_sep_addr)
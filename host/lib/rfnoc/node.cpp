@@ -173,6 +173,20 @@ void node_t::post_action(const res_source_info& edge_info, action_info::sptr act
     _post_action_cb(edge_info, action);
 }
 
+void node_t::post_actions(
+    const std::vector<std::pair<res_source_info, action_info::sptr>>& actions)
+{
+    if (_post_actions_cb) {
+        _post_actions_cb(actions);
+        return;
+    }
+    // Without a batch callback (i.e., detached from a graph), fall back to
+    // posting the actions one at a time
+    for (const auto& action : actions) {
+        _post_action_cb(action.first, action.second);
+    }
+}
+
 bool node_t::check_topology(const std::vector<size_t>& connected_inputs,
     const std::vector<size_t>& connected_outputs)
 {
@@ -193,13 +207,22 @@ bool node_t::check_topology(const std::vector<size_t>& connected_inputs,
 /*** Private methods *********************************************************/
 property_base_t* node_t::_find_property(
     res_source_info src_info, const std::string& id) const
+{
+    return _find_property(src_info, prop_id_hash(id), id.c_str());
+}
+
+property_base_t* node_t::_find_property(
+    res_source_info src_info, const uint32_t id_hash, const char* id) const
 {
     for (const auto& type_prop_pair : _props) {
         if (type_prop_pair.first != src_info.type) {
             continue;
         }
         for (const auto& prop : type_prop_pair.second) {
-            if (prop->get_id() == id && prop->get_src_info() == src_info) {
+            // Compare the precomputed hashes first; the string comparison
+            // only runs on a hash match, which all but guarantees equality
+            if (prop->get_id_hash() == id_hash && prop->get_src_info() == src_info
+                && prop->get_id() == id) {
                 return prop;
             }
         }
@@ -452,6 +475,26 @@ void node_t::clean_props()
     }
 }
 
+void node_t::clean_non_edge_props()
+{
+    prop_accessor_t prop_accessor{};
+    for (const auto& type_prop_pair : _props) {
+        const bool is_edge_prop =
+            type_prop_pair.first == res_source_info::INPUT_EDGE
+            || type_prop_pair.first == res_source_info::OUTPUT_EDGE;
+        for (const auto& prop : type_prop_pair.second) {
+            if (!is_edge_prop) {
+                if (prop->is_valid() && prop->is_dirty()
+                    && _clean_cb_registry.count(prop)) {
+                    _clean_cb_registry.at(prop)();
+                }
+                prop_accessor.mark_clean(*prop);
+            }
+            prop_accessor.set_access(prop, property_base_t::RO);
+        }
+    }
+}
+
 
 void node_t::forward_edge_property(
     property_base_t* incoming_prop, const size_t incoming_port)
@@ -306,6 +306,17 @@ double radio_control_impl::set_tx_frequency(const double freq, const size_t chan
     return _tx_freq[chan] = freq;
 }
 
+std::future<double> radio_control_impl::set_tx_frequency_async(
+    const double freq, const size_t chan)
+{
+    // Dispatch the (virtual) synchronous tune onto its own thread. How much
+    // of the tune actually runs concurrently depends on the locking in the
+    // derived radio; independent channels and radios can overlap LO settling
+    // and daughterboard register writes.
+    return std::async(std::launch::async,
+        [this, freq, chan]() { return this->set_tx_frequency(freq, chan); });
+}
+
 void radio_control_impl::set_tx_tune_args(const uhd::device_addr_t&, const size_t)
 {
     RFNOC_LOG_TRACE("tune_args not supported by this radio.");
@@ -317,6 +328,13 @@ double radio_control_impl::set_rx_frequency(const double freq, const size_t chan
     return _rx_freq[chan] = freq;
 }
 
+std::future<double> radio_control_impl::set_rx_frequency_async(
+    const double freq, const size_t chan)
+{
+    return std::async(std::launch::async,
+        [this, freq, chan]() { return this->set_rx_frequency(freq, chan); });
+}
+
 void radio_control_impl::set_rx_tune_args(const uhd::device_addr_t&, const size_t)
 {
     RFNOC_LOG_TRACE("tune_args not supported by this radio.");
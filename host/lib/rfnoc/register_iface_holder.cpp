@@ -69,6 +69,17 @@ public:
         UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
     }
 
+    size_t get_cmd_buff_space() const
+    {
+        UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
+        return 0;
+    }
+
+    void register_cmd_buff_space_handler(cmd_buff_space_callback_t)
+    {
+        UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
+    }
+
     void set_policy(const std::string&, const uhd::device_addr_t&)
     {
         UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
@@ -5,6 +5,22 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+// NOTE: This is a legacy (gen-2 RFNoC) controller that is currently not part
+// of the build: its interface header (uhd/rfnoc/replay_block_ctrl.hpp) has
+// not been ported to this tree, and the corresponding example is commented
+// out in host/examples/CMakeLists.txt. Two pieces of functionality should be
+// added when the block is ported to the gen-3 noc_block_base framework as
+// replay_block_control; neither can be attached to this orphaned class:
+//  * A bulk-upload API: pipelined max-size bursts with progress reporting,
+//    verified against REC_FULLNESS.
+//  * A bulk-download mode for draining recorded data to the host: issue the
+//    play command without timestamps (stream_now, so the RX chain never
+//    paces packets against radio time), raise RX_CTRL_MAXLEN to the
+//    transport MTU instead of the radio-friendly default, and size the
+//    receive window/flow-control credit for a memory-to-memory transfer
+//    rather than a live radio, so draining a full DRAM capture can approach
+//    wire rate.
+
 #include <uhd/rfnoc/replay_block_ctrl.hpp>
 #include <mutex>
 
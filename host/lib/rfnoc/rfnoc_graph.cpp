@@ -15,12 +15,17 @@
 #include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
 #include <uhdlib/rfnoc/graph_stream_manager.hpp>
+#include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
 #include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
+#include <uhdlib/utils/init_profile.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -37,7 +42,8 @@ struct block_xbar_info
 };
 } // namespace
 
-class rfnoc_graph_impl : public rfnoc_graph
+class rfnoc_graph_impl : public rfnoc_graph,
+                         public std::enable_shared_from_this<rfnoc_graph_impl>
 {
 public:
     /**************************************************************************
@@ -50,25 +56,56 @@ public:
           _num_mboards(_tree->list("/mboards").size()),
           _block_registry(std::make_unique<detail::block_container_t>()),
           _graph(std::make_unique<uhd::rfnoc::detail::graph_t>()) {
+        utils::scoped_init_phase profile_phase("rfnoc_graph::init");
         _mb_controllers.reserve(_num_mboards);
         // Now initialize all subsystems:
-        _init_io_srv_mgr(dev_addr); // Global I/O Service Manager
-        _init_mb_controllers();
-        _init_gsm(); // Graph Stream Manager
+        {
+            utils::scoped_init_phase profile_sub("io_srv_mgr");
+            _init_io_srv_mgr(dev_addr); // Global I/O Service Manager
+        }
+        {
+            utils::scoped_init_phase profile_sub("mb_controllers");
+            _init_mb_controllers();
+        }
+        if (dev_addr.has_key("topology_import")) {
+            _import_topology_cache(dev_addr["topology_import"]);
+        }
+        {
+            utils::scoped_init_phase profile_sub("graph_stream_manager");
+            _init_gsm(); // Graph Stream Manager
+        }
         try {
             // If anything fails here, we immediately deinit all the other
             // blocks to avoid any more fallout, then safely bring down the
             // device.
-            for (size_t mb_idx = 0; mb_idx < _num_mboards; ++mb_idx) {
-                _init_blocks(mb_idx, dev_addr);
+            {
+                utils::scoped_init_phase profile_sub("block_enumeration");
+                for (size_t mb_idx = 0; mb_idx < _num_mboards; ++mb_idx) {
+                    _init_blocks(mb_idx, dev_addr);
+                }
             }
             UHD_LOG_TRACE(LOG_ID, "Initializing properties on all blocks...");
-            _block_registry->init_props();
-            _init_sep_map();
-            _init_static_connections();
-            _init_mbc();
+            {
+                utils::scoped_init_phase profile_sub("block_init_props");
+                _block_registry->init_props();
+            }
+            {
+                utils::scoped_init_phase profile_sub("static_connections");
+                _init_sep_map();
+                _init_static_connections();
+            }
+            {
+                utils::scoped_init_phase profile_sub("mb_controller_init");
+                _init_mbc();
+            }
             // Start with time set to zero, but don't complain if sync fails
-            rfnoc_graph_impl::synchronize_devices(uhd::time_spec_t(0.0), true);
+            {
+                utils::scoped_init_phase profile_sub("device_sync");
+                rfnoc_graph_impl::synchronize_devices(uhd::time_spec_t(0.0), true);
+            }
+            if (dev_addr.has_key("topology_export")) {
+                _export_topology_cache(dev_addr["topology_export"]);
+            }
         } catch (...) {
             _block_registry->shutdown();
             throw;
@@ -83,6 +120,15 @@ public:
 
     ~rfnoc_graph_impl()
     {
+        // Remove any streamers the application still holds, so their graph
+        // callbacks no longer point into this object after it is gone
+        {
+            std::lock_guard<std::mutex> lock(_streamer_mutex);
+            for (auto& streamer : _streamer_node_map) {
+                _graph->remove_node(streamer.second);
+            }
+            _streamer_node_map.clear();
+        }
         UHD_LOG_TRACE(LOG_ID, "Shutting down detail::graph...");
         _graph->shutdown();
         UHD_LOG_TRACE(LOG_ID, "Shutting down all blocks ...");
@@ -326,15 +372,21 @@ public:
     uhd::rx_streamer::sptr create_rx_streamer(
         const size_t num_chans, const uhd::stream_args_t& args)
     {
-        _rx_streamers.push_back(std::make_shared<rfnoc_rx_streamer>(num_chans, args));
-        return _rx_streamers.back();
+        auto rx_streamer = std::make_shared<rfnoc_rx_streamer>(
+            num_chans, args, _make_streamer_disconnect_cb());
+        std::lock_guard<std::mutex> lock(_streamer_mutex);
+        _streamer_node_map.emplace(rx_streamer->get_unique_id(), rx_streamer.get());
+        return rx_streamer;
     }
 
     uhd::tx_streamer::sptr create_tx_streamer(
         const size_t num_chans, const uhd::stream_args_t& args)
     {
-        _tx_streamers.push_back(std::make_shared<rfnoc_tx_streamer>(num_chans, args));
-        return _tx_streamers.back();
+        auto tx_streamer = std::make_shared<rfnoc_tx_streamer>(
+            num_chans, args, _make_streamer_disconnect_cb());
+        std::lock_guard<std::mutex> lock(_streamer_mutex);
+        _streamer_node_map.emplace(tx_streamer->get_unique_id(), tx_streamer.get());
+        return tx_streamer;
     }
 
     size_t get_num_mboards() const
@@ -459,9 +511,85 @@ public:
     }
 
 private:
+    /**************************************************************************
+     * Streamer lifetime
+     *************************************************************************/
+    //! Create the callback with which a streamer disconnects itself from
+    // this graph on destruction. It must not hold a strong reference to the
+    // graph, or a lingering streamer handle would keep the session alive.
+    std::function<void(const std::string&)> _make_streamer_disconnect_cb()
+    {
+        std::weak_ptr<rfnoc_graph_impl> graph_wptr = shared_from_this();
+        return [graph_wptr](const std::string& streamer_id) {
+            if (auto graph = graph_wptr.lock()) {
+                graph->_remove_streamer(streamer_id);
+            }
+        };
+    }
+
+    //! Remove a streamer's node from the graph, usually because the streamer
+    // is being destroyed
+    void _remove_streamer(const std::string& streamer_id)
+    {
+        detail::graph_t::node_ref_t node = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_streamer_mutex);
+            auto it = _streamer_node_map.find(streamer_id);
+            if (it == _streamer_node_map.end()) {
+                return;
+            }
+            node = it->second;
+            _streamer_node_map.erase(it);
+        }
+        _graph->remove_node(node);
+        UHD_LOG_DEBUG(LOG_ID,
+            "Disconnected streamer " << streamer_id
+                                     << ", releasing its data plane resources");
+    }
+
     /**************************************************************************
      * Device Setup
      *************************************************************************/
+    //! Seed the management portal's topology cache from a file written by a
+    //  primary session (see _export_topology_cache()), so the portals created
+    //  by _init_gsm() skip the on-the-wire crossbar discovery
+    void _import_topology_cache(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (not file) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Cannot read topology cache file: " << path << ". Ignoring.");
+            return;
+        }
+        const std::vector<uint8_t> blob{
+            std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        try {
+            mgmt::mgmt_portal::import_topology_cache(blob);
+        } catch (const uhd::value_error& ex) {
+            // A bad cache file only costs us the fast attach, so fall back
+            // to the full discovery instead of failing the session
+            UHD_LOG_WARNING(LOG_ID,
+                "Ignoring topology cache file " << path << ": " << ex.what());
+            return;
+        }
+        UHD_LOG_DEBUG(LOG_ID, "Imported topology cache from " << path);
+    }
+
+    //! Write the topology discovered during init to a file, for secondary
+    //  sessions (e.g. read-only monitoring processes) to import
+    void _export_topology_cache(const std::string& path)
+    {
+        const std::vector<uint8_t> blob = mgmt::mgmt_portal::export_topology_cache();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (not file.write(reinterpret_cast<const char*>(blob.data()), blob.size())) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Cannot write topology cache file: " << path << ". Ignoring.");
+            return;
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Exported topology cache (" << blob.size() << " bytes) to " << path);
+    }
+
     void _init_io_srv_mgr(const uhd::device_addr_t& dev_addr)
     {
         _io_srv_mgr = usrp::io_service_mgr::make(dev_addr);
@@ -567,12 +695,26 @@ private:
         UHD_LOG_TRACE(LOG_ID,
             std::string("Flushing and resetting blocks on mboard ")
                 + std::to_string(mb_idx));
-        _flush_and_reset_mboard(mb_cz, num_blocks, first_block_port);
+        _flush_and_reset_mboard(mb_cz);
 
         // Make a map to count the number of each block we have
         std::unordered_map<std::string, uint16_t> block_count_map;
 
-        // Iterate through and register each of the blocks in this mboard
+        // The block controllers are constructed concurrently: each
+        // constructor does its own register I/O, but only against its own
+        // port's register space, so independent blocks don't interfere. All
+        // shared state (property tree nodes, ID bookkeeping, the block
+        // registry) is only touched from this thread.
+        struct block_make_task_t
+        {
+            block_id_t block_id;
+            std::future<noc_block_base::sptr> block_future;
+        };
+        std::vector<block_make_task_t> block_make_tasks;
+        block_make_tasks.reserve(num_blocks);
+
+        // Iterate through the blocks in this mboard and kick off their
+        // controller constructions
         for (size_t portno = 0; portno < num_blocks; ++portno) {
             const auto noc_id       = mb_cz->get_noc_id(portno + first_block_port);
             const auto device_type  = mb_cz->get_device_type();
@@ -617,19 +759,35 @@ private:
             _tree->create<uint32_t>(block_path / "noc_id").set(noc_id);
             make_args_uptr->tree = _tree->subtree(block_path);
             make_args_uptr->args = dev_addr; // TODO filter the device args
-            try {
-                _block_registry->register_block(
-                    block_factory_info.factory_fn(std::move(make_args_uptr)));
-            } catch (...) {
-                UHD_LOG_ERROR(
-                    LOG_ID, "Error during initialization of block " << block_id << "!");
-                throw;
-            }
+            auto factory_fn      = block_factory_info.factory_fn;
+            block_make_tasks.push_back({block_id,
+                std::async(std::launch::async,
+                    [factory_fn](noc_block_base::make_args_ptr make_args) {
+                        return factory_fn(std::move(make_args));
+                    },
+                    std::move(make_args_uptr))});
             _xbar_block_config[block_id.to_string()] = {
                 portno, noc_id, block_id.get_block_count()};
 
             _port_block_map.insert({{mb_idx, portno + first_block_port}, block_id});
         }
+
+        // Join all constructions before edge discovery. We wait for every
+        // task first so that no constructor is still talking to the device
+        // if one of them failed and we have to bail out.
+        for (auto& block_make_task : block_make_tasks) {
+            block_make_task.block_future.wait();
+        }
+        for (auto& block_make_task : block_make_tasks) {
+            try {
+                _block_registry->register_block(block_make_task.block_future.get());
+            } catch (...) {
+                UHD_LOG_ERROR(LOG_ID,
+                    "Error during initialization of block " << block_make_task.block_id
+                                                            << "!");
+                throw;
+            }
+        }
     }
 
     void _init_sep_map()
@@ -788,20 +946,14 @@ private:
     }
 
     //! Flush and reset each connected port on the mboard
-    void _flush_and_reset_mboard(detail::client_zero::sptr mb_cz,
-        const size_t num_blocks,
-        const size_t first_block_port)
+    void _flush_and_reset_mboard(detail::client_zero::sptr mb_cz)
     {
         if (!mb_cz->complete_flush_all_blocks()) {
             UHD_LOG_WARNING(LOG_ID, "One or more blocks timed out during flush!");
         }
 
         // Reset
-        for (size_t portno = 0; portno < num_blocks; ++portno) {
-            auto block_portno = portno + first_block_port;
-            mb_cz->reset_chdr(block_portno);
-            mb_cz->reset_ctrl(block_portno);
-        }
+        mb_cz->reset_all_blocks();
     }
 
     /*! Find the static edge that matches \p pred
@@ -890,11 +1042,17 @@ private:
     //! Reference to a packet factory object. Gets initialized just before the GSM
     std::unique_ptr<chdr::chdr_packet_factory> _pkt_factory;
 
-    //! Reference to RX streamers
-    std::vector<rx_streamer::sptr> _rx_streamers;
-
-    //! Reference to TX streamers
-    std::vector<tx_streamer::sptr> _tx_streamers;
+    //! Mutex for _streamer_node_map
+    std::mutex _streamer_mutex;
+
+    //! Map of active streamer unique IDs to their graph node. The graph does
+    // not hold strong references to streamers: when the application drops
+    // its last handle, the streamer disconnects itself through the callback
+    // below and its data plane (transports, offload threads, buffers) is
+    // released, while this session stays claimed and enumerated. Creating a
+    // new streamer afterwards only rebuilds the data plane, which makes a
+    // parked warm-standby chain cheap to hold and fast to resume.
+    std::map<std::string, detail::graph_t::node_ref_t> _streamer_node_map;
 }; /* class rfnoc_graph_impl */
 
 
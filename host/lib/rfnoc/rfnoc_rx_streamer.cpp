@@ -5,9 +5,11 @@
 //
 
 #include <uhd/rfnoc/defaults.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <atomic>
+#include <chrono>
 #include <thread>
 
 using namespace std::chrono_literals;
@@ -18,11 +20,13 @@ using namespace uhd::rfnoc;
 const std::string STREAMER_ID = "RxStreamer";
 static std::atomic<uint64_t> streamer_inst_ctr;
 
-rfnoc_rx_streamer::rfnoc_rx_streamer(
-    const size_t num_chans, const uhd::stream_args_t stream_args)
+rfnoc_rx_streamer::rfnoc_rx_streamer(const size_t num_chans,
+    const uhd::stream_args_t stream_args,
+    disconnect_fn_t disconnect_cb)
     : rx_streamer_impl<chdr_rx_data_xport>(num_chans, stream_args)
     , _unique_id(STREAMER_ID + "#" + std::to_string(streamer_inst_ctr++))
     , _stream_args(stream_args)
+    , _disconnect_cb(std::move(disconnect_cb))
 {
     set_overrun_handler([this]() { this->_handle_overrun(); });
 
@@ -90,6 +94,16 @@ rfnoc_rx_streamer::rfnoc_rx_streamer(
     node_accessor.init_props(this);
 }
 
+rfnoc_rx_streamer::~rfnoc_rx_streamer()
+{
+    // Disconnect from the graph before the base class tears down the data
+    // transports, so no property resolution or action can reach a
+    // half-destroyed node
+    if (_disconnect_cb) {
+        _disconnect_cb(_unique_id);
+    }
+}
+
 std::string rfnoc_rx_streamer::get_unique_id() const
 {
     return _unique_id;
@@ -107,7 +121,14 @@ size_t rfnoc_rx_streamer::get_num_output_ports() const
 
 void rfnoc_rx_streamer::issue_stream_cmd(const stream_cmd_t& stream_cmd)
 {
-    if (get_num_channels() > 1 and stream_cmd.stream_now
+    // Disabled channels do not take part in streaming, so only the enabled
+    // ones count for the time-alignment restriction and receive the command
+    size_t num_enabled = 0;
+    for (size_t i = 0; i < get_num_channels(); i++) {
+        num_enabled += is_channel_enabled(i) ? 1 : 0;
+    }
+
+    if (num_enabled > 1 and stream_cmd.stream_now
         and stream_cmd.stream_mode != stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS) {
         throw uhd::runtime_error(
             "Invalid recv stream command - stream now on multiple channels in a "
@@ -117,10 +138,60 @@ void rfnoc_rx_streamer::issue_stream_cmd(const stream_cmd_t& stream_cmd)
     auto cmd        = stream_cmd_action_info::make(stream_cmd.stream_mode);
     cmd->stream_cmd = stream_cmd;
 
+    // Fan the command out to all enabled channels as one batch, so the
+    // per-chain commands are delivered back-to-back in a single
+    // action-handling pass and the radios see minimal skew between them
+    std::vector<std::pair<res_source_info, action_info::sptr>> cmds;
+    cmds.reserve(get_num_channels());
     for (size_t i = 0; i < get_num_channels(); i++) {
-        const res_source_info info(res_source_info::INPUT_EDGE, i);
-        post_action(info, cmd);
+        if (not is_channel_enabled(i)) {
+            continue;
+        }
+        cmds.emplace_back(res_source_info(res_source_info::INPUT_EDGE, i), cmd);
     }
+    post_actions(cmds);
+
+    // For a start time in the future, tell the receive path when data is
+    // due so recv() can sleep out the gap instead of polling through it
+    if (_time_now_fn and not stream_cmd.stream_now
+        and stream_cmd.stream_mode != stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS) {
+        const double delay = (stream_cmd.time_spec - _time_now_fn()).get_real_secs();
+        if (delay > 0.0) {
+            set_scheduled_start(
+                std::chrono::steady_clock::now()
+                + std::chrono::nanoseconds(static_cast<int64_t>(delay * 1e9)));
+        }
+    }
+}
+
+void rfnoc_rx_streamer::set_time_now_fn(time_now_fn_t time_now_fn)
+{
+    _time_now_fn = std::move(time_now_fn);
+}
+
+void rfnoc_rx_streamer::set_channel_enabled(const size_t channel, const bool enabled)
+{
+    if (channel >= get_num_channels()) {
+        throw uhd::index_error(
+            "Channel number indexes beyond the number of streamer ports");
+    }
+
+    if (enabled == is_channel_enabled(channel)) {
+        return;
+    }
+
+    if (not enabled) {
+        // Stop the upstream producer before parking the channel so its
+        // transport does not keep filling with packets nobody reads
+        RFNOC_LOG_DEBUG("Disabling channel " << channel);
+        auto stop_action =
+            stream_cmd_action_info::make(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
+        post_action({res_source_info::INPUT_EDGE, channel}, stop_action);
+    } else {
+        RFNOC_LOG_DEBUG("Re-enabling channel " << channel);
+    }
+
+    rx_streamer_impl<chdr_rx_data_xport>::set_channel_enabled(channel, enabled);
 }
 
 const uhd::stream_args_t& rfnoc_rx_streamer::get_stream_args() const
@@ -158,6 +229,17 @@ void rfnoc_rx_streamer::connect_channel(
     const size_t mtu = xport->get_max_payload_size();
     set_property<size_t>(PROP_KEY_MTU, mtu, {res_source_info::INPUT_EDGE, channel});
 
+    // Optionally attach a packet header capture ring for post-mortem
+    // analysis, sized in packets via the flight_record stream arg
+    const size_t flight_record = _stream_args.args.cast<size_t>("flight_record", 0);
+    if (flight_record > 0) {
+        const std::string prefix =
+            _stream_args.args.get("flight_record_file", "uhd_flight_record")
+            + "_rx_ch" + std::to_string(channel);
+        xport->set_flight_recorder(
+            std::make_shared<chdr_flight_recorder>(flight_record, prefix));
+    }
+
     rx_streamer_impl<chdr_rx_data_xport>::connect_channel(channel, std::move(xport));
 }
 
@@ -259,6 +341,9 @@ void rfnoc_rx_streamer::_handle_stream_cmd_action(
         stream_cmd_action_info::make(stream_cmd_action->stream_cmd.stream_mode);
     start_action->stream_cmd = stream_cmd_action->stream_cmd;
     for (size_t i = 0; i < get_num_input_ports(); ++i) {
+        if (not is_channel_enabled(i)) {
+            continue;
+        }
         post_action({res_source_info::INPUT_EDGE, i}, start_action);
     }
     if (_overrun_handling_mode.exchange(false)) {
@@ -5,6 +5,7 @@
 //
 
 #include <uhd/rfnoc/defaults.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <atomic>
@@ -16,11 +17,13 @@ const std::string STREAMER_ID = "TxStreamer";
 static std::atomic<uint64_t> streamer_inst_ctr;
 static constexpr size_t ASYNC_MSG_QUEUE_SIZE = 1000;
 
-rfnoc_tx_streamer::rfnoc_tx_streamer(
-    const size_t num_chans, const uhd::stream_args_t stream_args)
+rfnoc_tx_streamer::rfnoc_tx_streamer(const size_t num_chans,
+    const uhd::stream_args_t stream_args,
+    disconnect_fn_t disconnect_cb)
     : tx_streamer_impl<chdr_tx_data_xport>(num_chans, stream_args)
     , _unique_id(STREAMER_ID + "#" + std::to_string(streamer_inst_ctr++))
     , _stream_args(stream_args)
+    , _disconnect_cb(std::move(disconnect_cb))
 {
     _async_msg_queue = std::make_shared<tx_async_msg_queue>(ASYNC_MSG_QUEUE_SIZE);
 
@@ -78,6 +81,16 @@ rfnoc_tx_streamer::rfnoc_tx_streamer(
     node_accessor.init_props(this);
 }
 
+rfnoc_tx_streamer::~rfnoc_tx_streamer()
+{
+    // Disconnect from the graph before the base class tears down the data
+    // transports, so no property resolution or action can reach a
+    // half-destroyed node
+    if (_disconnect_cb) {
+        _disconnect_cb(_unique_id);
+    }
+}
+
 std::string rfnoc_tx_streamer::get_unique_id() const
 {
     return _unique_id;
@@ -134,6 +147,17 @@ void rfnoc_tx_streamer::connect_channel(
             this->_async_msg_queue->enqueue(md);
         });
 
+    // Optionally attach a packet header capture ring for post-mortem
+    // analysis, sized in packets via the flight_record stream arg
+    const size_t flight_record = _stream_args.args.cast<size_t>("flight_record", 0);
+    if (flight_record > 0) {
+        const std::string prefix =
+            _stream_args.args.get("flight_record_file", "uhd_flight_record")
+            + "_tx_ch" + std::to_string(channel);
+        xport->set_flight_recorder(
+            std::make_shared<chdr_flight_recorder>(flight_record, prefix));
+    }
+
     tx_streamer_impl<chdr_tx_data_xport>::connect_channel(channel, std::move(xport));
 }
 
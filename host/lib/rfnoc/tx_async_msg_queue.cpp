@@ -5,6 +5,7 @@
 //
 
 #include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <chrono>
 #include <thread>
 
@@ -45,5 +46,18 @@ bool tx_async_msg_queue::recv_async_msg(
 
 void tx_async_msg_queue::enqueue(const async_metadata_t& async_metadata)
 {
-    _queue.push(async_metadata);
+    // Underruns and other transmit events surface here from the data xport
+    UHD_TRACEPOINT1(tx_async_msg, async_metadata.event_code);
+
+    // bounded_push never falls back to the allocator, so producing a
+    // message cannot block packet processing; on overflow the message is
+    // dropped and counted rather than waited on
+    if (!_queue.bounded_push(async_metadata)) {
+        _num_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t tx_async_msg_queue::get_num_dropped() const
+{
+    return _num_dropped.load(std::memory_order_relaxed);
 }
@@ -5,16 +5,171 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
 
 using namespace uhd;
 
+/***********************************************************************
+ * Post-processing stages
+ **********************************************************************/
+rx_postproc::~rx_postproc(void)
+{
+    // empty
+}
+
+namespace {
+
+//! Default lowpass prototype: Hamming-windowed sinc with unity DC gain and
+// the cutoff at 80% of the decimated Nyquist rate, 8 taps per output phase
+std::vector<float> design_decim_taps(const size_t decim)
+{
+    const size_t ntaps  = 8 * decim + 1;
+    const double cutoff = 0.8 / (2.0 * decim);
+    std::vector<float> taps(ntaps);
+    double sum = 0.0;
+    for (size_t i = 0; i < ntaps; i++) {
+        const double m = double(i) - double(ntaps - 1) / 2.0;
+        const double sinc =
+            (m == 0.0) ? 2.0 * M_PI * cutoff : std::sin(2.0 * M_PI * cutoff * m) / m;
+        const double window = 0.54 - 0.46 * std::cos(2.0 * M_PI * i / (ntaps - 1));
+        taps[i]             = static_cast<float>(sinc * window);
+        sum += taps[i];
+    }
+    for (auto& tap : taps) {
+        tap = static_cast<float>(tap / sum);
+    }
+    return taps;
+}
+
+/*!
+ * Streaming polyphase FIR decimator for fc32 samples. Input that cannot
+ * yet produce an output (the filter history and any partial phase) is
+ * buffered across process() calls, so packet boundaries are invisible to
+ * the filter.
+ */
+class fir_decimator : public rx_postproc
+{
+public:
+    fir_decimator(const size_t decim, const std::vector<float>& taps)
+        : _decim(decim), _taps(taps.empty() ? design_decim_taps(decim) : taps)
+    {
+        if (decim == 0) {
+            throw uhd::value_error(
+                "[fir_decimator] Decimation factor must be nonzero");
+        }
+    }
+
+    size_t process(const void* in, void* out, const size_t num_in)
+    {
+        const std::complex<float>* in_samps =
+            reinterpret_cast<const std::complex<float>*>(in);
+        std::complex<float>* out_samps = reinterpret_cast<std::complex<float>*>(out);
+
+        _buffer.insert(_buffer.end(), in_samps, in_samps + num_in);
+
+        const size_t ntaps = _taps.size();
+        size_t num_out     = 0;
+        size_t read_pos    = 0;
+        while (_buffer.size() - read_pos >= ntaps) {
+            const std::complex<float>* sig = _buffer.data() + read_pos;
+            std::complex<float> acc(0.0f, 0.0f);
+            for (size_t t = 0; t < ntaps; t++) {
+                acc += sig[t] * _taps[t];
+            }
+            out_samps[num_out++] = acc;
+            read_pos += _decim;
+        }
+
+        // Keep the unconsumed tail (filter history and partial phase)
+        _buffer.erase(_buffer.begin(), _buffer.begin() + read_pos);
+
+        return num_out;
+    }
+
+    size_t max_input(const size_t max_out) const
+    {
+        // The (max_out + 1)-th output would need a window starting at
+        // max_out * decim, i.e. max_out * decim + ntaps total samples;
+        // anything already buffered counts against that budget
+        const size_t limit = max_out * _decim + _taps.size() - 1;
+        return limit > _buffer.size() ? limit - _buffer.size() : 0;
+    }
+
+private:
+    const size_t _decim;
+    const std::vector<float> _taps;
+    std::vector<std::complex<float>> _buffer;
+};
+
+} // namespace
+
+rx_postproc::sptr uhd::make_fir_decimator(
+    const size_t decim, const std::vector<float>& taps)
+{
+    return std::make_shared<fir_decimator>(decim, taps);
+}
+
 rx_streamer::~rx_streamer(void)
 {
     // empty
 }
 
+size_t rx_streamer::recv_buffs(
+    std::vector<const void*>&, rx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error(
+        "recv_buffs() is not supported by this streamer implementation");
+}
+
+void rx_streamer::release_recv_buffs(void)
+{
+    throw uhd::not_implemented_error(
+        "release_recv_buffs() is not supported by this streamer implementation");
+}
+
+stream_stats_t rx_streamer::get_stream_stats(void) const
+{
+    throw uhd::not_implemented_error(
+        "get_stream_stats() is not supported by this streamer implementation");
+}
+
+void rx_streamer::set_channel_enabled(const size_t, const bool)
+{
+    throw uhd::not_implemented_error(
+        "set_channel_enabled() is not supported by this streamer implementation");
+}
+
+bool rx_streamer::is_channel_enabled(const size_t) const
+{
+    // Implementations without channel parking always stream all channels
+    return true;
+}
+
+void rx_streamer::set_iq_correction(
+    const size_t, const std::complex<double>, const std::complex<double>)
+{
+    throw uhd::not_implemented_error(
+        "set_iq_correction() is not supported by this streamer implementation");
+}
+
+void rx_streamer::set_postproc(const size_t, rx_postproc::sptr)
+{
+    throw uhd::not_implemented_error(
+        "set_postproc() is not supported by this streamer implementation");
+}
+
 tx_streamer::~tx_streamer(void)
 {
     // empty
 }
+
+stream_stats_t tx_streamer::get_stream_stats(void) const
+{
+    throw uhd::not_implemented_error(
+        "get_stream_stats() is not supported by this streamer implementation");
+}
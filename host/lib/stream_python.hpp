@@ -8,9 +8,11 @@
 #ifndef INCLUDED_UHD_STREAM_PYTHON_HPP
 #define INCLUDED_UHD_STREAM_PYTHON_HPP
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <boost/format.hpp>
+#include <vector>
 
 static size_t wrap_recv(uhd::rx_streamer* rx_stream,
     py::object& np_array,
@@ -125,6 +127,113 @@ static size_t wrap_send(uhd::tx_streamer* tx_stream,
     return result;
 }
 
+/*! Persistent ring of receive buffers for the Python API
+ *
+ * wrap_recv() has to re-derive the storage pointers from the NumPy array on
+ * every call, while holding the GIL. That per-call overhead (and the implicit
+ * copy NumPy makes when handed a non-contiguous array) is what caps Python
+ * receive rates well below the C++ streamer. This class validates a set of
+ * user-provided NumPy arrays once, pins them (by holding a reference), and
+ * caches their storage pointers. After that, recv() into any buffer of the
+ * ring is a single C++ call with the GIL released for its entire duration.
+ *
+ * Intended use from Python:
+ *
+ *     buffs = [np.empty((num_chans, spp), np.complex64) for _ in range(N)]
+ *     ring = uhd.usrp.RecvBufferRing(streamer, buffs)
+ *     while streaming:
+ *         nsamps = ring.recv(idx, metadata, timeout)
+ *         # hand buffs[idx] to the DSP, advance idx modulo N
+ */
+class recv_buffer_ring
+{
+public:
+    recv_buffer_ring(uhd::rx_streamer::sptr rx_stream, const py::list& np_arrays)
+        : _rx_stream(rx_stream)
+    {
+        if (py::len(np_arrays) == 0) {
+            throw uhd::value_error("recv_buffer_ring: No buffers provided!");
+        }
+        const size_t channels = rx_stream->get_num_channels();
+        for (auto array_it : np_arrays) {
+            auto np_array = py::reinterpret_borrow<py::object>(array_it);
+            if (!PyArray_Check(np_array.ptr())) {
+                throw uhd::type_error("recv_buffer_ring: Buffers must be NumPy arrays!");
+            }
+            PyArrayObject* array_type_obj =
+                reinterpret_cast<PyArrayObject*>(np_array.ptr());
+            // We stash the raw storage pointers, so unlike wrap_recv(), we
+            // cannot let NumPy hand us a contiguous copy: recv() would fill
+            // the copy, not the caller's array.
+            if (!PyArray_IS_C_CONTIGUOUS(array_type_obj)) {
+                throw uhd::value_error(
+                    "recv_buffer_ring: Buffers must be C-contiguous NumPy arrays!");
+            }
+            const size_t dims     = PyArray_NDIM(array_type_obj);
+            const npy_intp* shape = PyArray_SHAPE(array_type_obj);
+            if (((channels > 1) && (dims != 2)) or ((size_t)shape[0] < channels)) {
+                size_t input_channels = (dims != 2) ? 1 : shape[0];
+                throw uhd::runtime_error(str(
+                    boost::format("Number of RX channels (%d) does not match the "
+                                  "dimensions of the data array (%d)")
+                    % channels % input_channels));
+            }
+            const npy_intp* strides = PyArray_STRIDES(array_type_obj);
+            std::vector<void*> channel_storage;
+            char* data = PyArray_BYTES(array_type_obj);
+            for (size_t i = 0; i < channels; ++i) {
+                channel_storage.push_back((void*)(data + i * strides[0]));
+            }
+            const size_t nsamps_per_buff =
+                (dims > 1) ? (size_t)shape[1] : PyArray_SIZE(array_type_obj);
+            if (!_views.empty() and nsamps_per_buff != _views.front().nsamps_per_buff) {
+                throw uhd::value_error(
+                    "recv_buffer_ring: All buffers must have the same size!");
+            }
+            // Hold a reference so the storage can't be freed behind our back
+            _arrays.push_back(np_array);
+            _views.push_back({std::move(channel_storage), nsamps_per_buff});
+        }
+    }
+
+    //! Receive into the \p index-th buffer of the ring
+    //
+    // The GIL is released for the entire call.
+    size_t recv(const size_t index, uhd::rx_metadata_t& metadata, const double timeout)
+    {
+        if (index >= _views.size()) {
+            throw uhd::index_error("recv_buffer_ring: Buffer index out of range!");
+        }
+        const auto& view = _views[index];
+        py::gil_scoped_release release;
+        return _rx_stream->recv(
+            view.channel_storage, view.nsamps_per_buff, metadata, timeout);
+    }
+
+    //! Number of buffers in the ring
+    size_t num_buffs() const
+    {
+        return _views.size();
+    }
+
+    //! Number of samples (per channel) each buffer can hold
+    size_t get_nsamps_per_buff() const
+    {
+        return _views.front().nsamps_per_buff;
+    }
+
+private:
+    struct buffer_view
+    {
+        std::vector<void*> channel_storage;
+        size_t nsamps_per_buff;
+    };
+
+    uhd::rx_streamer::sptr _rx_stream;
+    std::vector<py::object> _arrays;
+    std::vector<buffer_view> _views;
+};
+
 static bool wrap_recv_async_msg(uhd::tx_streamer* tx_stream,
     uhd::async_metadata_t& async_metadata,
     double timeout = 0.1)
@@ -159,6 +268,19 @@ void export_stream(py::module& m)
         .def("get_max_num_samps", &uhd::rx_streamer::get_max_num_samps)
         .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd);
 
+    py::class_<recv_buffer_ring>(
+        m, "recv_buffer_ring", "See: recv_buffer_ring in stream_python.hpp")
+        .def(py::init<uhd::rx_streamer::sptr, const py::list&>(),
+            py::arg("rx_streamer"),
+            py::arg("np_arrays"))
+        .def("recv",
+            &recv_buffer_ring::recv,
+            py::arg("index"),
+            py::arg("metadata"),
+            py::arg("timeout") = 0.1)
+        .def("num_buffs", &recv_buffer_ring::num_buffs)
+        .def("get_nsamps_per_buff", &recv_buffer_ring::get_nsamps_per_buff);
+
     py::class_<tx_streamer, tx_streamer::sptr>(m, "tx_streamer", "See: uhd::tx_streamer")
         // Methods
         .def("send",
@@ -4,8 +4,22 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhdlib/transport/adapter.hpp>
+#if defined(UHD_PLATFORM_LINUX)
+#    include <arpa/inet.h>
+#    include <ifaddrs.h>
+#    include <linux/ethtool.h>
+#    include <linux/sockios.h>
+#    include <net/if.h>
+#    include <netinet/in.h>
+#    include <sys/ioctl.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#    include <cstring>
+#endif
 
 using namespace uhd::transport;
 
@@ -21,3 +35,121 @@ adapter_id_t adapter_ctx::register_adapter(adapter_info& info)
         return id;
     }
 }
+
+void adapter_ctx::register_capabilities(const adapter_id_t id, const adapter_caps_t& caps)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _caps_map[id] = caps;
+}
+
+adapter_caps_t adapter_ctx::get_capabilities(const adapter_id_t id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _caps_map.find(id);
+    if (it == _caps_map.end()) {
+        return adapter_caps_t();
+    }
+    return it->second;
+}
+
+#if defined(UHD_PLATFORM_LINUX)
+
+namespace {
+
+//! Returns the name of the interface holding the given IPv4 address
+std::string _find_iface_for_addr(const std::string& local_addr)
+{
+    ifaddrs* ifap = nullptr;
+    if (::getifaddrs(&ifap) != 0) {
+        return "";
+    }
+    std::string iface;
+    for (ifaddrs* ifa = ifap; ifa; ifa = ifa->ifa_next) {
+        if (not ifa->ifa_addr or ifa->ifa_addr->sa_family != AF_INET) {
+            continue;
+        }
+        char addr_str[INET_ADDRSTRLEN];
+        const auto* sin = reinterpret_cast<const sockaddr_in*>(ifa->ifa_addr);
+        if (::inet_ntop(AF_INET, &sin->sin_addr, addr_str, sizeof(addr_str))
+            and local_addr == addr_str) {
+            iface = ifa->ifa_name;
+            break;
+        }
+    }
+    ::freeifaddrs(ifap);
+    return iface;
+}
+
+//! Reads a boolean ethtool setting (e.g. ETHTOOL_GRXCSUM); returns false on error
+bool _ethtool_get_flag(const int fd, ifreq& ifr, const uint32_t cmd)
+{
+    ethtool_value value;
+    std::memset(&value, 0, sizeof(value));
+    value.cmd    = cmd;
+    ifr.ifr_data = reinterpret_cast<char*>(&value);
+    if (::ioctl(fd, SIOCETHTOOL, &ifr) != 0) {
+        return false;
+    }
+    return value.data != 0;
+}
+
+} // namespace
+
+adapter_caps_t uhd::transport::discover_adapter_caps(const std::string& local_addr)
+{
+    adapter_caps_t caps;
+
+    const std::string iface = _find_iface_for_addr(local_addr);
+    if (iface.empty() or iface.size() >= IFNAMSIZ) {
+        return caps;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        return caps;
+    }
+
+    ifreq ifr;
+    std::memset(&ifr, 0, sizeof(ifr));
+    std::strncpy(ifr.ifr_name, iface.c_str(), IFNAMSIZ - 1);
+
+    if (::ioctl(fd, SIOCGIFMTU, &ifr) == 0) {
+        caps.mtu = ifr.ifr_mtu;
+    }
+
+    caps.rx_csum_offload = _ethtool_get_flag(fd, ifr, ETHTOOL_GRXCSUM);
+    caps.tx_csum_offload = _ethtool_get_flag(fd, ifr, ETHTOOL_GTXCSUM);
+    caps.gro_enabled     = _ethtool_get_flag(fd, ifr, ETHTOOL_GGRO);
+    caps.gso_enabled     = _ethtool_get_flag(fd, ifr, ETHTOOL_GGSO);
+
+    // Queue counts: channels may be reported as separate rx/tx queues, as
+    // combined queues, or both, depending on the driver
+    ethtool_channels channels;
+    std::memset(&channels, 0, sizeof(channels));
+    channels.cmd = ETHTOOL_GCHANNELS;
+    ifr.ifr_data = reinterpret_cast<char*>(&channels);
+    if (::ioctl(fd, SIOCETHTOOL, &ifr) == 0) {
+        caps.num_rx_queues = channels.rx_count + channels.combined_count;
+        caps.num_tx_queues = channels.tx_count + channels.combined_count;
+    }
+
+    ::close(fd);
+    caps.valid = true;
+
+    UHD_LOGGER_TRACE("ADAPTER")
+        << "Capabilities of " << iface << " (" << local_addr << "): mtu=" << caps.mtu
+        << ", rx_csum=" << caps.rx_csum_offload << ", tx_csum=" << caps.tx_csum_offload
+        << ", gro=" << caps.gro_enabled << ", gso=" << caps.gso_enabled
+        << ", rx_queues=" << caps.num_rx_queues << ", tx_queues=" << caps.num_tx_queues;
+
+    return caps;
+}
+
+#else
+
+adapter_caps_t uhd::transport::discover_adapter_caps(const std::string&)
+{
+    return adapter_caps_t();
+}
+
+#endif
@@ -5,10 +5,20 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/zero_copy.hpp>
+#include <uhd/utils/log.hpp>
 #include <boost/shared_array.hpp>
 #include <vector>
+#ifdef UHD_PLATFORM_LINUX
+#    include <linux/mempolicy.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <cstdlib>
+#    include <cstring>
+#endif
 
 using namespace uhd::transport;
 
@@ -18,6 +28,72 @@ static size_t pad_to_boundary(const size_t bytes, const size_t alignment)
     return bytes + (alignment - bytes) % alignment;
 }
 
+#ifdef UHD_PLATFORM_LINUX
+//! Bind the region to the requested node, then touch every page while the
+//! policy is in effect so the pages are faulted in on that node rather than
+//! wherever the first user thread runs
+static void bind_and_touch(void* mem, const size_t size, const int numa_node)
+{
+    if (numa_node >= 0) {
+        const unsigned long nodemask = 1ul << numa_node;
+        if (::syscall(SYS_mbind, mem, size, MPOL_BIND, &nodemask, sizeof(nodemask) * 8, 0)
+            != 0) {
+            UHD_LOGGER_WARNING("BUFFER_POOL")
+                << "Could not bind buffer pool to NUMA node " << numa_node
+                << ", continuing with default placement";
+        }
+    }
+    std::memset(mem, 0, size);
+}
+#endif
+
+//! Allocate the pool memory, honoring NUMA and huge-page requests
+static boost::shared_array<char> allocate_mem(
+    const size_t num_bytes, const int numa_node, const bool use_hugepages)
+{
+#ifdef UHD_PLATFORM_LINUX
+    if (use_hugepages) {
+        // 2 MB huge pages cut the TLB entries per pool by 512x. The mmap
+        // fails if no huge pages are reserved (vm.nr_hugepages), in which
+        // case we fall through to the regular-page path below.
+        constexpr size_t huge_page_size = 2 * 1024 * 1024;
+        const size_t alloc_size =
+            (num_bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+        void* mem = ::mmap(nullptr,
+            alloc_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+            -1,
+            0);
+        if (mem != MAP_FAILED) {
+            bind_and_touch(mem, alloc_size, numa_node);
+            return boost::shared_array<char>(static_cast<char*>(mem),
+                [alloc_size](char* p) { ::munmap(p, alloc_size); });
+        }
+        UHD_LOGGER_WARNING("BUFFER_POOL")
+            << "Could not allocate buffer pool from huge pages (is "
+               "vm.nr_hugepages set?), continuing with regular pages";
+    }
+    if (numa_node >= 0 and size_t(numa_node) < sizeof(unsigned long) * 8) {
+        const size_t page_size  = size_t(::sysconf(_SC_PAGESIZE));
+        const size_t alloc_size = (num_bytes + page_size - 1) & ~(page_size - 1);
+        void* mem               = nullptr;
+        if (::posix_memalign(&mem, page_size, alloc_size) == 0) {
+            bind_and_touch(mem, alloc_size, numa_node);
+            return boost::shared_array<char>(
+                static_cast<char*>(mem), [](char* p) { ::free(p); });
+        }
+    }
+#else
+    if (numa_node >= 0 or use_hugepages) {
+        UHD_LOGGER_WARNING("BUFFER_POOL")
+            << "NUMA-aware and huge-page allocation are not supported on this "
+               "platform, continuing with default placement";
+    }
+#endif
+    return boost::shared_array<char>(new char[num_bytes]);
+}
+
 buffer_pool::~buffer_pool(void)
 {
     /* NOP */
@@ -53,14 +129,18 @@ private:
 /***********************************************************************
  * Buffer pool factor function
  **********************************************************************/
-buffer_pool::sptr buffer_pool::make(
-    const size_t num_buffs, const size_t buff_size, const size_t alignment)
+buffer_pool::sptr buffer_pool::make(const size_t num_buffs,
+    const size_t buff_size,
+    const size_t alignment,
+    const int numa_node,
+    const bool use_hugepages)
 {
     // 1) pad the buffer size to be a multiple of alignment
     // 2) pad the overall memory size for room after alignment
     // 3) allocate the memory in one block of sufficient size
     const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
-    boost::shared_array<char> mem(new char[padded_buff_size * num_buffs + alignment - 1]);
+    boost::shared_array<char> mem = allocate_mem(
+        padded_buff_size * num_buffs + alignment - 1, numa_node, use_hugepages);
 
     // Fill a vector with boundary-aligned points in the memory
     const size_t mem_start = pad_to_boundary(size_t(mem.get()), alignment);
@@ -74,3 +154,30 @@ buffer_pool::sptr buffer_pool::make(
     // - the reference to allocated memory.
     return sptr(new buffer_pool_impl(ptrs, mem));
 }
+
+buffer_pool::sptr buffer_pool::make_external(void* mem,
+    const size_t mem_size,
+    const size_t num_buffs,
+    const size_t buff_size,
+    const size_t alignment)
+{
+    const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
+    const size_t mem_start        = pad_to_boundary(size_t(mem), alignment);
+    const size_t mem_end          = size_t(mem) + mem_size;
+
+    if (mem_start + padded_buff_size * num_buffs > mem_end) {
+        throw uhd::value_error(
+            "buffer_pool: Application-provided memory region is too small for "
+            "the requested buffers");
+    }
+
+    // Fill a vector with boundary-aligned points in the memory
+    std::vector<ptr_type> ptrs(num_buffs);
+    for (size_t i = 0; i < num_buffs; i++) {
+        ptrs[i] = ptr_type(mem_start + padded_buff_size * i);
+    }
+
+    // The application owns the memory; pass an empty reference so the pool
+    // never frees it
+    return sptr(new buffer_pool_impl(ptrs, boost::shared_array<char>()));
+}
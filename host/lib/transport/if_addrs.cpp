@@ -8,7 +8,10 @@
 #include <uhd/transport/if_addrs.hpp>
 #include <stdint.h>
 #include <boost/asio/ip/address_v4.hpp>
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <set>
 
 /***********************************************************************
  * Interface address discovery through ifaddrs api
@@ -127,3 +130,64 @@ std::vector<uhd::transport::if_addrs_t> uhd::transport::get_if_addrs(void)
 }
 
 #endif /* HAVE_IF_ADDRS_DUMMY */
+
+/***********************************************************************
+ * Cached interface address lookups
+ **********************************************************************/
+namespace {
+
+//! How long a cached interface enumeration stays valid. Interfaces rarely
+// get reconfigured in the middle of a discovery burst, so a short TTL is a
+// good trade against one OS enumeration per probe round.
+constexpr std::chrono::milliseconds IF_ADDRS_CACHE_TTL(1000);
+
+struct if_addrs_cache_t
+{
+    std::mutex mutex;
+    std::vector<uhd::transport::if_addrs_t> addrs;
+    //! Interface addresses from `addrs`, indexed for cheap lookup
+    std::set<std::string> inet_index;
+    std::chrono::steady_clock::time_point last_update;
+    bool valid = false;
+};
+
+if_addrs_cache_t& if_addrs_cache(void)
+{
+    static if_addrs_cache_t cache;
+    return cache;
+}
+
+//! Re-run the enumeration if the cached one expired. Requires cache.mutex
+// to be held by the caller.
+void refresh_if_addrs_cache(if_addrs_cache_t& cache)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (cache.valid and now - cache.last_update < IF_ADDRS_CACHE_TTL) {
+        return;
+    }
+    cache.addrs = uhd::transport::get_if_addrs();
+    cache.inet_index.clear();
+    for (const auto& if_addr : cache.addrs) {
+        cache.inet_index.insert(if_addr.inet);
+    }
+    cache.last_update = now;
+    cache.valid       = true;
+}
+
+} // namespace
+
+std::vector<uhd::transport::if_addrs_t> uhd::transport::get_if_addrs_cached(void)
+{
+    auto& cache = if_addrs_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    refresh_if_addrs_cache(cache);
+    return cache.addrs;
+}
+
+bool uhd::transport::is_local_if_addr(const std::string& addr)
+{
+    auto& cache = if_addrs_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    refresh_if_addrs_cache(cache);
+    return cache.inet_index.count(addr) > 0;
+}
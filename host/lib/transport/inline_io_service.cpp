@@ -8,11 +8,55 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <boost/circular_buffer.hpp>
 #include <cassert>
+#include <chrono>
+#include <thread>
 
 namespace uhd { namespace transport {
 
+namespace {
+
+/*!
+ * Get a buffer from the link, either blocking in the link or busy-polling
+ *
+ * With a nonzero spin budget, the link is polled without blocking so the
+ * thread never sleeps in the socket layer between packets. The budget is the
+ * number of polls between yields, which bounds how long a spin can keep the
+ * core from other runnable threads.
+ */
+frame_buff::uptr link_recv_buff(
+    recv_link_if* link, const int32_t timeout_ms, const size_t spin_budget)
+{
+    if (spin_budget == 0) {
+        frame_buff::uptr buff = link->get_recv_buff(timeout_ms);
+        if (buff) {
+            UHD_TRACEPOINT1(io_recv_packet, buff->packet_size());
+        }
+        return buff;
+    }
+
+    using namespace std::chrono;
+    const auto end_time = steady_clock::now() + milliseconds(timeout_ms);
+
+    while (true) {
+        for (size_t i = 0; i < spin_budget; i++) {
+            frame_buff::uptr buff = link->get_recv_buff(0);
+            if (buff) {
+                UHD_TRACEPOINT1(io_recv_packet, buff->packet_size());
+                return frame_buff::uptr(std::move(buff));
+            }
+        }
+        if (timeout_ms >= 0 and steady_clock::now() > end_time) {
+            return frame_buff::uptr();
+        }
+        std::this_thread::yield();
+    }
+}
+
+} // namespace
+
 /*!
  * Interface class for unifying callback processing between both inline_send_io
  * and inline_recv_io
@@ -32,6 +76,31 @@ public:
         return _recv_cb(buff, recv_link, _cb_send_link);
     }
 
+    /*! The mux this callback is connected through, or nullptr when it is
+     * the link's only receiver. Cached here so the per-packet path does
+     * not have to look it up in the I/O service's table.
+     */
+    UHD_FORCE_INLINE inline_recv_mux* get_mux() const
+    {
+        return _mux;
+    }
+
+    void set_mux(inline_recv_mux* mux)
+    {
+        _mux = mux;
+    }
+
+    //! This callback's packet queue inside the mux (nullptr when unmuxed)
+    UHD_FORCE_INLINE boost::circular_buffer<frame_buff*>* get_mux_queue() const
+    {
+        return _mux_queue;
+    }
+
+    void set_mux_queue(boost::circular_buffer<frame_buff*>* queue)
+    {
+        _mux_queue = queue;
+    }
+
 protected:
     inline_recv_cb(recv_callback_t cb, send_link_if* send_link)
         : _recv_cb(cb), _cb_send_link(send_link)
@@ -41,6 +110,9 @@ protected:
     recv_callback_t _recv_cb;
     // pointer to send link used with the callback
     send_link_if* _cb_send_link;
+    // cached connection state, maintained by connect/disconnect_receiver
+    inline_recv_mux* _mux                            = nullptr;
+    boost::circular_buffer<frame_buff*>* _mux_queue = nullptr;
 };
 
 /*!
@@ -50,7 +122,8 @@ protected:
 class inline_recv_mux
 {
 public:
-    inline_recv_mux(recv_link_if* link) : _link(link){};
+    inline_recv_mux(recv_link_if* link, const size_t recv_spin_budget)
+        : _link(link), _recv_spin_budget(recv_spin_budget){};
 
     ~inline_recv_mux(){};
 
@@ -61,13 +134,15 @@ public:
      */
     void connect(inline_recv_cb* cb)
     {
-        UHD_ASSERT_THROW(_queues.count(cb) == 0);
+        UHD_ASSERT_THROW(cb->get_mux_queue() == nullptr);
         /* Always create queue of max size, since we don't know when there are
          * virtual channels (which share frames)
          */
         auto queue =
             new boost::circular_buffer<frame_buff*>(_link->get_num_recv_frames());
-        _queues[cb] = queue;
+        /* The queue lives in the callback object so the per-packet path
+         * does not need a table lookup to find it */
+        cb->set_mux_queue(queue);
         _callbacks.push_back(cb);
     }
 
@@ -77,14 +152,14 @@ public:
      */
     void disconnect(inline_recv_cb* cb)
     {
-        auto queue = _queues.at(cb);
+        auto queue = cb->get_mux_queue();
         while (!queue->empty()) {
             frame_buff* buff = queue->front();
             _link->release_recv_buff(frame_buff::uptr(buff));
             queue->pop_front();
         }
         delete queue;
-        _queues.erase(cb);
+        cb->set_mux_queue(nullptr);
         _callbacks.remove(cb);
     }
 
@@ -106,14 +181,15 @@ public:
      */
     frame_buff::uptr recv(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
-        auto queue = _queues.at(cb);
+        auto queue = cb->get_mux_queue();
         if (!queue->empty()) {
             frame_buff* buff = queue->front();
             queue->pop_front();
             return frame_buff::uptr(buff);
         }
         while (true) {
-            frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+            frame_buff::uptr buff =
+                link_recv_buff(recv_link, timeout_ms, _recv_spin_budget);
             /* Process buffer */
             if (buff) {
                 bool rcvr_found = false;
@@ -127,7 +203,7 @@ public:
                                 /* NOTE: Should not overflow, by construction
                                  * Every queue can hold link->get_num_recv_frames()
                                  */
-                                _queues[rcvr]->push_back(buff.release());
+                                rcvr->get_mux_queue()->push_back(buff.release());
                             }
                         }
                         /* Continue looping if buffer was consumed */
@@ -147,7 +223,8 @@ public:
     bool recv_flow_ctrl(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
         while (true) {
-            frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+            frame_buff::uptr buff =
+                link_recv_buff(recv_link, timeout_ms, _recv_spin_budget);
             /* Process buffer */
             if (buff) {
                 bool rcvr_found = false;
@@ -161,7 +238,7 @@ public:
                             /* NOTE: Should not overflow, by construction
                              * Every queue can hold link->get_num_recv_frames()
                              */
-                            _queues[rcvr]->push_back(buff.release());
+                            rcvr->get_mux_queue()->push_back(buff.release());
                         } else {
                             /* Continue looping if buffer was consumed and
                                receiver is not the requested one */
@@ -181,11 +258,13 @@ public:
 
 private:
     recv_link_if* _link;
+    const size_t _recv_spin_budget;
     std::list<inline_recv_cb*> _callbacks;
-    std::unordered_map<inline_recv_cb*, boost::circular_buffer<frame_buff*>*> _queues;
 };
 
-class inline_recv_io : public virtual recv_io_if, public virtual inline_recv_cb
+// final so the compiler may devirtualize the per-packet interface calls
+// wherever the concrete type is visible
+class inline_recv_io final : public virtual recv_io_if, public virtual inline_recv_cb
 {
 public:
     using sptr = std::shared_ptr<inline_recv_io>;
@@ -227,6 +306,9 @@ public:
 
     void release_recv_buff(frame_buff::uptr buff)
     {
+        // The flow control callback releases the frame and may send a flow
+        // control response on the fc link
+        UHD_TRACEPOINT(io_fc_callback);
         _fc_cb(frame_buff::uptr(std::move(buff)), _data_link.get(), _fc_link.get());
         _num_frames_in_use--;
     }
@@ -239,7 +321,7 @@ private:
     size_t _num_frames_in_use = 0;
 };
 
-class inline_send_io : public virtual send_io_if, public virtual inline_recv_cb
+class inline_send_io final : public virtual send_io_if, public virtual inline_recv_cb
 {
 public:
     using sptr = std::shared_ptr<inline_send_io>;
@@ -380,8 +462,11 @@ send_io_if::sptr inline_io_service::make_send_client(send_link_if::sptr send_lin
     recv_link_if::sptr recv_link,
     size_t num_recv_frames,
     recv_callback_t recv_cb,
-    send_io_if::fc_callback_t fc_cb)
+    send_io_if::fc_callback_t fc_cb,
+    const bool /*high_priority*/)
 {
+    // This I/O service sends inline in the caller's thread, so packets never
+    // queue behind another client's data and the priority flag is moot.
     UHD_ASSERT_THROW(send_link);
     UHD_ASSERT_THROW(num_send_frames > 0);
     UHD_ASSERT_THROW(send_cb);
@@ -432,13 +517,16 @@ void inline_io_service::connect_receiver(
     if (mux) {
         mux->connect(cb);
     } else if (rcvr) {
-        mux = new inline_recv_mux(link);
+        mux = new inline_recv_mux(link, _recv_spin_budget);
         mux->connect(rcvr);
         mux->connect(cb);
+        /* The first receiver was promoted into the mux: update its cache */
+        rcvr->set_mux(mux);
         rcvr = nullptr;
     } else {
         rcvr = cb;
     }
+    cb->set_mux(mux);
     _recv_tbl[link] = std::make_tuple(mux, rcvr);
 }
 
@@ -456,25 +544,25 @@ void inline_io_service::disconnect_receiver(recv_link_if* link, inline_recv_cb*
     } else {
         rcvr = nullptr;
     }
+    cb->set_mux(nullptr);
     _recv_tbl[link] = std::make_tuple(mux, rcvr);
 }
 
 frame_buff::uptr inline_io_service::recv(
     inline_recv_cb* recv_io_cb, recv_link_if* recv_link, int32_t timeout_ms)
 {
-    inline_recv_mux* mux;
-    inline_recv_cb* rcvr;
-    std::tie(mux, rcvr) = _recv_tbl.at(recv_link);
+    /* The connection state is cached in the callback object, so the
+     * per-packet path does not pay for a table lookup */
+    inline_recv_mux* mux = recv_io_cb->get_mux();
 
     if (mux) {
         /* Defer to mux's recv() if present */
         return mux->recv(recv_io_cb, recv_link, timeout_ms);
-    } else {
-        assert(recv_io_cb == rcvr);
     }
+    inline_recv_cb* rcvr = recv_io_cb;
 
     while (true) {
-        frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+        frame_buff::uptr buff = link_recv_buff(recv_link, timeout_ms, _recv_spin_budget);
         /* Process buffer */
         if (buff) {
             if (rcvr->callback(buff, recv_link)) {
@@ -495,19 +583,17 @@ frame_buff::uptr inline_io_service::recv(
 bool inline_io_service::recv_flow_ctrl(
     inline_recv_cb* recv_io_cb, recv_link_if* recv_link, int32_t timeout_ms)
 {
-    inline_recv_mux* mux;
-    inline_recv_cb* rcvr;
-    std::tie(mux, rcvr) = _recv_tbl.at(recv_link);
+    /* As in recv(), use the cached connection state */
+    inline_recv_mux* mux = recv_io_cb->get_mux();
 
     if (mux) {
         /* Defer to mux's recv_flow_ctrl() if present */
         return mux->recv_flow_ctrl(recv_io_cb, recv_link, timeout_ms);
-    } else {
-        assert(recv_io_cb == rcvr);
     }
+    inline_recv_cb* rcvr = recv_io_cb;
 
     while (true) {
-        frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+        frame_buff::uptr buff = link_recv_buff(recv_link, timeout_ms, _recv_spin_budget);
         /* Process buffer */
         if (buff) {
             if (rcvr->callback(buff, recv_link)) {
@@ -62,7 +62,8 @@ private:
      * handling events. Using more than one thread can result in excessive CPU usage in
      * kernel space (presumably from locking/waiting). The libusb documentation says it is
      * safe, which it is, but it neglects to state the cost in CPU usage. Just don't do
-     * it!
+     * it! Parallelism across devices comes from giving each device its own
+     * session (and thus context) via make_private_session() instead.
      */
     UHD_INLINE void libusb_event_handler_task(libusb_context* context)
     {
@@ -124,6 +125,14 @@ libusb::session::sptr libusb::session::get_global_session(void)
     return new_global_session;
 }
 
+libusb::session::sptr libusb::session::make_private_session(void)
+{
+    // Each session owns its own context and (exactly one) event handler
+    // thread. Private sessions let devices be serviced in parallel rather
+    // than all sharing the global context's single event loop.
+    return sptr(new libusb_session_impl());
+}
+
 /***********************************************************************
  * libusb device
  **********************************************************************/
@@ -295,10 +304,27 @@ libusb::device_handle::~device_handle(void)
 class libusb_device_handle_impl : public libusb::device_handle
 {
 public:
-    libusb_device_handle_impl(libusb::device::sptr dev)
+    libusb_device_handle_impl(libusb::device::sptr dev, libusb::session::sptr session)
+        : _dev(dev), _session(session)
     {
-        _dev = dev;
-        UHD_ASSERT_THROW(libusb_open(_dev->get(), &_handle) == 0);
+        // A libusb_device is bound to the context it was enumerated on, so
+        // re-find this device on the private context by bus number and
+        // address before opening it there.
+        const uint8_t bus_no     = libusb_get_bus_number(dev->get());
+        const uint8_t dev_addr   = libusb_get_device_address(dev->get());
+        libusb_device** dev_list = NULL;
+        const ssize_t count = libusb_get_device_list(_session->get_context(), &dev_list);
+        UHD_ASSERT_THROW(count >= 0);
+        int ret = LIBUSB_ERROR_NO_DEVICE;
+        for (ssize_t i = 0; i < count; i++) {
+            if (libusb_get_bus_number(dev_list[i]) == bus_no
+                and libusb_get_device_address(dev_list[i]) == dev_addr) {
+                ret = libusb_open(dev_list[i], &_handle);
+                break;
+            }
+        }
+        libusb_free_device_list(dev_list, true /*unref*/);
+        UHD_ASSERT_THROW(ret == 0);
     }
 
     virtual ~libusb_device_handle_impl(void);
@@ -308,6 +334,11 @@ public:
         return _handle;
     }
 
+    libusb_context* get_context(void) const
+    {
+        return _session->get_context();
+    }
+
     void claim_interface(int interface)
     {
         UHD_ASSERT_THROW(libusb_claim_interface(this->get(), interface) == 0);
@@ -334,6 +365,7 @@ public:
 
 private:
     libusb::device::sptr _dev; // always keep a reference to device
+    libusb::session::sptr _session; // keeps the private context alive
     libusb_device_handle* _handle;
     std::vector<int> _claimed;
 };
@@ -360,9 +392,11 @@ libusb::device_handle::sptr libusb::device_handle::get_cached_handle(device::spt
         return handles[dev->get()].lock();
     }
 
-    // create a new cached handle
+    // create a new cached handle, opened on its own private session so each
+    // device gets a dedicated event handler thread
     try {
-        sptr new_handle(new libusb_device_handle_impl(dev));
+        sptr new_handle(
+            new libusb_device_handle_impl(dev, libusb::session::make_private_session()));
         handles[dev->get()] = new_handle;
         return new_handle;
     } catch (const uhd::exception&) {
@@ -68,6 +68,14 @@ public:
     //! get a shared pointer to the global session
     static sptr get_global_session(void);
 
+    /*!
+     * Make a new session with a private context and event handler thread.
+     * Opening each device on its own private session keeps one device's
+     * transfer completions from serializing behind another's in a shared
+     * event loop.
+     */
+    static sptr make_private_session(void);
+
     //! get the underlying libusb context pointer
     virtual libusb_context* get_context(void) const = 0;
 };
@@ -142,6 +150,9 @@ public:
     //! get the underlying device handle
     virtual libusb_device_handle* get(void) const = 0;
 
+    //! get the context this handle was opened on
+    virtual libusb_context* get_context(void) const = 0;
+
     /*!
      * Open USB interfaces for control using magic value
      * IN interface:      2
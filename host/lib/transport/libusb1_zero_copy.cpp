@@ -16,6 +16,7 @@
 #include <boost/format.hpp>
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/mutex.hpp>
+#include <algorithm>
 #include <functional>
 #include <list>
 #include <memory>
@@ -25,6 +26,8 @@ using namespace uhd::transport;
 
 static const size_t DEFAULT_NUM_XFERS = 16; // num xfers
 static const size_t DEFAULT_XFER_SIZE = 32 * 512; // bytes
+//! number of released recv buffers accumulated before resubmitting them
+static const size_t DEFAULT_RESUBMIT_BATCH = 4;
 
 //! type for sharing the release queue with managed buffers
 class libusb_zero_copy_mb;
@@ -116,11 +119,12 @@ public:
         const size_t frame_size,
         std::function<void(libusb_zero_copy_mb*)> release_cb,
         const bool is_recv,
-        const std::string& name)
+        const std::string& name,
+        libusb_context* ctx)
         : _release_cb(release_cb)
         , _is_recv(is_recv)
         , _name(name)
-        , _ctx(libusb::session::get_global_session()->get_context())
+        , _ctx(ctx)
         , _lut(lut)
         , _frame_size(frame_size)
     { /* NOP */
@@ -218,19 +222,21 @@ public:
         : _handle(handle)
         , _num_frames(num_frames)
         , _frame_size(frame_size)
+        , _is_recv((endpoint & 0x80) != 0)
+        , _resubmit_batch(
+              std::max<size_t>(1, std::min(DEFAULT_RESUBMIT_BATCH, num_frames / 2)))
         , _buffer_pool(buffer_pool::make(_num_frames, _frame_size))
         , _enqueued(_num_frames)
         , _released(_num_frames)
         , _status(STATUS_RUNNING)
     {
-        const bool is_recv = (endpoint & 0x80) != 0;
-        const std::string name =
-            str(boost::format("%s%d") % ((is_recv) ? "rx" : "tx") % int(endpoint & 0x7f));
+        const std::string name = str(
+            boost::format("%s%d") % ((_is_recv) ? "rx" : "tx") % int(endpoint & 0x7f));
         _handle->claim_interface(interface);
 
         // flush the buffers out of the recv endpoint
         // limit the flushing to at most one second
-        if (is_recv)
+        if (_is_recv)
             for (size_t i = 0; i < 100; i++) {
                 unsigned char buff[512];
                 int transfered   = 0;
@@ -255,8 +261,9 @@ public:
                 std::bind(&libusb_zero_copy_single::enqueue_buffer,
                     this,
                     std::placeholders::_1),
-                is_recv,
-                name));
+                _is_recv,
+                name,
+                _handle->get_context()));
 
             libusb_fill_bulk_transfer(lut, // transfer
                 _handle->get(), // dev_handle
@@ -274,7 +281,7 @@ public:
         // initial release for all buffers
         for (size_t i = 0; i < get_num_frames(); i++) {
             libusb_zero_copy_mb& mb = *(_mb_pool[i]);
-            if (is_recv)
+            if (_is_recv)
                 mb.release();
             else {
                 mb.result.completed = 1;
@@ -343,6 +350,8 @@ public:
 private:
     libusb::device_handle::sptr _handle;
     const size_t _num_frames, _frame_size;
+    const bool _is_recv;
+    const size_t _resubmit_batch;
 
     //! Storage for transfer related objects
     buffer_pool::sptr _buffer_pool;
@@ -361,6 +370,15 @@ private:
     {
         boost::mutex::scoped_lock l(_queue_mutex);
         _released.push_back(mb);
+        // Batch recv resubmission: while enough transfers remain in flight,
+        // defer the submits so several buffers go back per pass through the
+        // submit loop. Progress is guaranteed because get_buff() submits
+        // unconditionally. Send buffers always go out immediately; deferring
+        // them would hold back user data.
+        if (_is_recv and _released.size() < _resubmit_batch
+            and _enqueued.size() >= _num_frames / 2) {
+            return;
+        }
         this->submit_what_we_can();
         _buff_ready_cond.notify_one();
     }
@@ -11,6 +11,7 @@
 #include <uhd/utils/safe_call.hpp>
 #include <boost/thread.hpp>
 #include <boost/thread/locks.hpp>
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -30,6 +31,7 @@ public:
         size_t max_streams)
         : _base_xport(base_xport)
         , _classify(classify_fn)
+        , _streams(std::make_shared<stream_map_t>())
         , _max_num_streams(max_streams)
         , _num_dropped_frames(0)
     {
@@ -55,24 +57,17 @@ public:
             // Note that this will not delete or flush the child streams
             // until the owners of the streams have released the respective
             // shared pointers. This ensures that packets are not dropped.
-            _streams.clear(););
+            std::atomic_store(&_streams, std::make_shared<stream_map_t>()););
     }
 
     virtual zero_copy_if::sptr make_stream(const uint32_t stream_num)
     {
-        boost::lock_guard<boost::mutex> lock(_mutex);
-        if (_streams.size() >= _max_num_streams) {
-            throw uhd::runtime_error("muxed_zero_copy_if: stream capacity exceeded. "
-                                     "cannot create more streams.");
-        }
-        // Only allocate a portion of the base transport's frames to each stream
-        // to prevent all streams from attempting to use all the frames.
-        stream_impl::sptr stream = std::make_shared<stream_impl>(this->shared_from_this(),
-            stream_num,
-            _base_xport->get_num_send_frames(),
-            _base_xport->get_num_recv_frames());
-        _streams[stream_num]     = stream;
-        return stream;
+        return _make_stream(stream_num, false /*high_priority*/);
+    }
+
+    virtual zero_copy_if::sptr make_priority_stream(const uint32_t stream_num)
+    {
+        return _make_stream(stream_num, true /*high_priority*/);
     }
 
     virtual size_t get_num_dropped_frames() const
@@ -82,8 +77,12 @@ public:
 
     void remove_stream(const uint32_t stream_num)
     {
+        // Registration is the slow path: copy the table and atomically
+        // publish the new snapshot for the demux thread
         boost::lock_guard<boost::mutex> lock(_mutex);
-        _streams.erase(stream_num);
+        auto new_streams = std::make_shared<stream_map_t>(*std::atomic_load(&_streams));
+        new_streams->erase(stream_num);
+        std::atomic_store(&_streams, std::shared_ptr<stream_map_t>(new_streams));
     }
 
 private:
@@ -122,8 +121,10 @@ private:
         stream_impl(muxed_zero_copy_if_impl::sptr muxed_xport,
             const uint32_t stream_num,
             const size_t num_send_frames,
-            const size_t num_recv_frames)
+            const size_t num_recv_frames,
+            const bool high_priority)
             : _stream_num(stream_num)
+            , _high_priority(high_priority)
             , _muxed_xport(muxed_xport)
             , _num_send_frames(num_send_frames)
             , _send_frame_size(_muxed_xport->base_xport()->get_send_frame_size())
@@ -172,9 +173,16 @@ private:
 
         void push_recv_buff(managed_recv_buffer::sptr buff)
         {
-            _buff_queue.push_with_wait(
-                _buffers.at(_buffer_index++)->get_new(buff->cast<char*>(), buff->size()));
+            managed_recv_buffer::sptr copy =
+                _buffers.at(_buffer_index++)->get_new(buff->cast<char*>(), buff->size());
             _buffer_index %= _buffers.size();
+            if (_high_priority) {
+                // Never stall the demux thread on a priority stream; if the
+                // consumer has fallen behind, the oldest packet gives way
+                _buff_queue.push_with_pop_on_full(copy);
+            } else {
+                _buff_queue.push_with_wait(copy);
+            }
         }
 
         size_t get_num_send_frames(void) const
@@ -194,6 +202,7 @@ private:
 
     private:
         const uint32_t _stream_num;
+        const bool _high_priority;
         muxed_zero_copy_if_impl::sptr _muxed_xport;
         const size_t _num_send_frames;
         const size_t _send_frame_size;
@@ -254,11 +263,13 @@ private:
                 const uint32_t stream_num =
                     _classify(buff->cast<void*>(), _base_xport->get_recv_frame_size());
                 {
-                    // Hold the stream mutex long enough to pull a bounded buffer
-                    // and lock it (increment its ref count).
-                    boost::lock_guard<boost::mutex> lock(_mutex);
-                    stream_map_t::iterator str_iter = _streams.find(stream_num);
-                    if (str_iter != _streams.end()) {
+                    // Read-mostly lookup: take a snapshot of the published
+                    // stream table and lock the weak pointer, no mutex on
+                    // the per-packet path
+                    const std::shared_ptr<stream_map_t> streams =
+                        std::atomic_load(&_streams);
+                    stream_map_t::const_iterator str_iter = streams->find(stream_num);
+                    if (str_iter != streams->end()) {
                         stream = (*str_iter).second.lock();
                     }
                 }
@@ -270,7 +281,6 @@ private:
             if (stream.get()) {
                 stream->push_recv_buff(buff);
             } else {
-                boost::lock_guard<boost::mutex> lock(_mutex);
                 _num_dropped_frames++;
             }
             // We processed a packet, and there could be more coming
@@ -283,15 +293,37 @@ private:
         }
     }
 
+    zero_copy_if::sptr _make_stream(const uint32_t stream_num, const bool high_priority)
+    {
+        boost::lock_guard<boost::mutex> lock(_mutex);
+        auto new_streams = std::make_shared<stream_map_t>(*std::atomic_load(&_streams));
+        if (new_streams->size() >= _max_num_streams) {
+            throw uhd::runtime_error("muxed_zero_copy_if: stream capacity exceeded. "
+                                     "cannot create more streams.");
+        }
+        // Only allocate a portion of the base transport's frames to each stream
+        // to prevent all streams from attempting to use all the frames.
+        stream_impl::sptr stream = std::make_shared<stream_impl>(this->shared_from_this(),
+            stream_num,
+            _base_xport->get_num_send_frames(),
+            _base_xport->get_num_recv_frames(),
+            high_priority);
+        (*new_streams)[stream_num] = stream;
+        std::atomic_store(&_streams, std::shared_ptr<stream_map_t>(new_streams));
+        return stream;
+    }
+
     typedef std::map<uint32_t, stream_impl::wptr> stream_map_t;
 
     zero_copy_if::sptr _base_xport;
     stream_classifier_fn _classify;
-    stream_map_t _streams;
+    //! Published stream table snapshot: immutable once stored, replaced
+    //  wholesale under _mutex when streams are added or removed
+    std::shared_ptr<stream_map_t> _streams;
     const size_t _max_num_streams;
-    size_t _num_dropped_frames;
+    std::atomic<size_t> _num_dropped_frames;
     boost::thread _recv_thread;
-    boost::mutex _mutex;
+    boost::mutex _mutex; // guards stream registration only
 };
 
 muxed_zero_copy_if::sptr muxed_zero_copy_if::make(zero_copy_if::sptr base_xport,
@@ -55,6 +55,8 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
     , _fpga_session(fpga_session)
     , _fifo_instance(instance)
     , _link_params(params)
+    , _recv_release_batch(
+          std::max<size_t>(1, std::min<size_t>(16, params.num_recv_frames / 8)))
 {
     UHD_LOG_TRACE("NIRIO", "Creating PCIe transport for channel " << instance);
     UHD_LOGGER_TRACE("NIRIO")
@@ -101,13 +103,19 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
     nirio_status_chain(_fpga_session->create_tx_fifo(_fifo_instance, _send_fifo), status);
 
     if ((_recv_fifo.get() != NULL) && (_send_fifo.get() != NULL)) {
-        // Initialize FIFOs
+        // Initialize FIFOs. The RX FIFO runs with the MAXIMIZE_THROUGHPUT
+        // acquire policy: each kernel transition claims every complete frame
+        // already landed in the DMA ring, and subsequent get_recv_buff calls
+        // peel frames off the claimed block without an ioctl. The TX FIFO
+        // keeps the default policy; its entire buffer is pre-acquired on
+        // start and send grants must not be held back.
         nirio_status_chain(_recv_fifo->initialize((_link_params.recv_frame_size
                                                       * _link_params.num_recv_frames)
                                                       / sizeof(fifo_data_t),
                                _link_params.recv_frame_size / sizeof(fifo_data_t),
                                actual_depth,
-                               actual_size),
+                               actual_size,
+                               nirio_fifo<fifo_data_t>::MAXIMIZE_THROUGHPUT),
             status);
         nirio_status_chain(_send_fifo->initialize((_link_params.send_frame_size
                                                       * _link_params.num_send_frames)
@@ -301,6 +309,9 @@ nirio_link::sptr nirio_link::make(uhd::niusrprio::niusrprio_session::sptr fpga_s
  *****************************************************************************/
 void nirio_link::_flush_rx_buff()
 {
+    // hand any deferred grants back to the DMA engine first
+    _flush_pending_recv_grants();
+
     // acquire is called with 0 elements requested first to
     // get the number of elements in the buffer and then
     // repeatedly with the number of remaining elements
@@ -8,16 +8,18 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhdlib/transport/frame_reservation_mgr.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <uhdlib/transport/offload_io_service_client.hpp>
-#include <uhdlib/utils/semaphore.hpp>
 #include <condition_variable>
 #include <boost/lockfree/queue.hpp>
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 namespace uhd { namespace transport {
@@ -26,12 +28,39 @@ namespace {
 
 constexpr int32_t blocking_timeout_ms = 10;
 
-// Fixed-size queue that supports blocking semantics
+//! Longest sleep between polls once an adaptive worker has fully backed off.
+//! This bounds the wakeup latency at the start of a burst that arrives after
+//! a long idle gap.
+constexpr std::chrono::microseconds adaptive_max_backoff(256);
+
+//! Assumed size of a cache line, used to pad the queue counters so the
+//! producer and consumer never share a line
+constexpr size_t cache_line_size = 64;
+
+//! Iterations to busy-wait in a timed pop before backing off to short sleeps
+constexpr size_t timed_pop_spin_count = 1024;
+
+// Fixed-size lock-free SPSC queue that also supports blocking semantics.
+// push, peek, pop and read_available are wait-free: the producer and
+// consumer each own one monotonically increasing counter, published with
+// release/acquire ordering and padded to separate cache lines, so neither
+// side ever takes a mutex or stalls the other. The timed pop spins briefly
+// and then backs off to short sleeps, so it makes no blocking syscall that
+// the producer would have to pair with a wakeup.
 template <typename queue_item_t>
 class offload_thread_queue
 {
 public:
-    offload_thread_queue(size_t size) : _buffer(new queue_item_t[size]), _capacity(size)
+    offload_thread_queue(size_t size)
+        : _capacity([size]() {
+            // Round up to a power of two so the counters can wrap freely
+            size_t capacity = 1;
+            while (capacity < size) {
+                capacity <<= 1;
+            }
+            return capacity;
+        }())
+        , _buffer(new queue_item_t[_capacity])
     {
     }
 
@@ -42,57 +71,72 @@ public:
 
     void push(const queue_item_t& item)
     {
-        _buffer[_write_index++] = item;
-        _write_index %= _capacity;
-        _item_sem.notify();
+        const size_t write_count        = _write_count.load(std::memory_order_relaxed);
+        _buffer[write_count & (_capacity - 1)] = item;
+        // Publish the item to the consumer
+        _write_count.store(write_count + 1, std::memory_order_release);
     }
 
     bool peek(queue_item_t& item)
     {
-        if (_item_sem.count()) {
-            item = _buffer[_read_index];
-            return true;
-        } else {
+        const size_t read_count = _read_count.load(std::memory_order_relaxed);
+        if (_write_count.load(std::memory_order_acquire) == read_count) {
             return false;
         }
+        item = _buffer[read_count & (_capacity - 1)];
+        return true;
     }
 
     bool pop(queue_item_t& item)
     {
-        if (_item_sem.try_wait()) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
+        const size_t read_count = _read_count.load(std::memory_order_relaxed);
+        if (_write_count.load(std::memory_order_acquire) == read_count) {
             return false;
         }
+        item = _buffer[read_count & (_capacity - 1)];
+        // Return the slot to the producer
+        _read_count.store(read_count + 1, std::memory_order_release);
+        return true;
     }
 
     bool pop(queue_item_t& item, int32_t timeout_ms)
     {
-        if (_item_sem.wait_for(timeout_ms)) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
+        if (pop(item)) {
             return true;
-        } else {
-            return false;
+        }
+
+        const auto end_time = std::chrono::steady_clock::now()
+                              + std::chrono::milliseconds(timeout_ms);
+        size_t spins = 0;
+        while (true) {
+            if (pop(item)) {
+                return true;
+            }
+            if (std::chrono::steady_clock::now() > end_time) {
+                return false;
+            }
+            if (spins++ < timed_pop_spin_count) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
         }
     }
 
     size_t read_available()
     {
-        return _item_sem.count();
+        return _write_count.load(std::memory_order_acquire)
+               - _read_count.load(std::memory_order_relaxed);
     }
 
 private:
-    queue_item_t* _buffer;
     const size_t _capacity;
+    queue_item_t* _buffer;
 
-    size_t _read_index  = 0;
-    size_t _write_index = 0;
-
-    // Semaphore gating number of items available to read
-    semaphore _item_sem;
+    // Total items consumed and produced; each counter is written by only
+    // one side of the queue and padded onto its own cache line
+    alignas(cache_line_size) std::atomic<size_t> _read_count{0};
+    alignas(cache_line_size) std::atomic<size_t> _write_count{0};
 };
 
 // Object that implements the communication between client and offload thread
@@ -239,14 +283,21 @@ private:
 
 } // namespace
 
-// Implementation of io service that executes an inline io service in an offload
-// thread. The offload thread communicates with send and recv clients using a
-// pair of spsc queues. One queue carries buffers from the offload thread to the
-// client, and the other carries buffers in the opposite direction.
+// Implementation of io service that executes an inline io service in one or
+// more offload threads. Each offload thread communicates with its send and recv
+// clients using a pair of spsc queues. One queue carries buffers from the
+// offload thread to the client, and the other carries buffers in the opposite
+// direction.
 //
-// Requests to create new clients are handled using a separate mpsc queue. Client
-// requests to disconnect are sent in the same spsc queue as the buffers so that
-// they are processed only after all buffer release requestss have been processed.
+// Every attached link belongs to exactly one worker thread, chosen by the
+// link's transport adapter (explicitly via params, or round-robin), so both
+// directions of one NIC port share a worker and separate ports can run on
+// separate cores.
+//
+// Requests to create new clients are handled using a separate mpsc queue per
+// worker. Client requests to disconnect are sent in the same spsc queue as the
+// buffers so that they are processed only after all buffer release requests
+// have been processed.
 class offload_io_service_impl
     : public offload_io_service,
       public std::enable_shared_from_this<offload_io_service_impl>
@@ -278,7 +329,8 @@ public:
         recv_link_if::sptr recv_link,
         size_t num_recv_frames,
         recv_callback_t recv_cb,
-        send_io_if::fc_callback_t fc_cb);
+        send_io_if::fc_callback_t fc_cb,
+        const bool high_priority = false);
 
 private:
     offload_io_service_impl(const offload_io_service_impl&) = delete;
@@ -308,39 +360,68 @@ private:
         send_io_if::sptr inline_io;
         size_t num_frames_in_use = 0;
         frame_reservation_t frames_reserved;
+        // High-priority (control) clients are serviced ahead of data
+        // clients and drained fully at packet boundaries
+        bool high_priority = false;
+    };
+
+    // State owned by one worker thread
+    struct worker_t
+    {
+        worker_t() : client_connect_queue(10) // arbitrary initial size
+        {
+        }
+
+        // The I/O service that executes within this worker thread
+        io_service::sptr io_srv;
+
+        std::unique_ptr<std::thread> thread;
+
+        // Lists of clients and their respective queues; only touched from
+        // the worker thread
+        std::list<recv_client_info_t> recv_clients;
+        std::list<send_client_info_t> send_clients;
+
+        // Queue for connect and disconnect client requests
+        client_req_queue_t client_connect_queue;
     };
 
-    void _queue_client_req(std::function<void()> fn);
-    void _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
-    void _get_send_buff(send_client_info_t& info);
+    void _queue_client_req(worker_t& worker, std::function<void()> fn);
+    worker_t& _worker_for_adapter(const adapter_id_t adapter_id);
+    bool _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
+    bool _get_send_buff(send_client_info_t& info);
+    bool _drain_priority_send(send_client_info_t& info);
     void _release_recv_buff(recv_client_info_t& info, frame_buff* buff);
     void _release_send_buff(send_client_info_t& info, frame_buff* buff);
     void _disconnect_recv_client(recv_client_info_t& info);
     void _disconnect_send_client(send_client_info_t& info);
 
+    void _configure_offload_thread(const size_t worker_index);
+
     template <bool allow_recv, bool allow_send>
-    void _do_work_polling();
+    void _do_work_polling(worker_t& worker, const size_t worker_index);
 
     template <bool allow_recv, bool allow_send>
-    void _do_work_blocking();
+    void _do_work_blocking(worker_t& worker, const size_t worker_index);
 
-    // The I/O service that executes within the offload thread
-    io_service::sptr _io_srv;
+    template <bool allow_recv, bool allow_send>
+    void _do_work_adaptive(worker_t& worker, const size_t worker_index);
 
-    // Offload thread, its stop flag, and thread-related parameters
-    std::unique_ptr<std::thread> _offload_thread;
+    // Worker threads and the shared stop flag and parameters
+    std::vector<std::unique_ptr<worker_t>> _workers;
     std::atomic<bool> _stop_offload_thread{false};
     offload_io_service::params_t _offload_thread_params;
 
-    // Lists of clients and their respective queues
-    std::list<recv_client_info_t> _recv_clients;
-    std::list<send_client_info_t> _send_clients;
-
-    // Queue for connect and disconnect client requests
-    client_req_queue_t _client_connect_queue;
+    // Which worker services each transport adapter; guarded by
+    // _assignment_mutex since links attach from client threads
+    std::map<adapter_id_t, size_t> _adapter_worker_map;
+    size_t _next_worker = 0;
+    std::mutex _assignment_mutex;
 
-    // Keep track of frame reservations
+    // Keep track of frame reservations; shared between workers and
+    // guarded by _reservation_mutex (control path only)
     frame_reservation_mgr _reservation_mgr;
+    std::mutex _reservation_mutex;
 };
 
 //
@@ -357,9 +438,7 @@ offload_io_service::sptr offload_io_service::make(
 //
 offload_io_service_impl::offload_io_service_impl(
     io_service::sptr io_srv, const offload_io_service::params_t& params)
-    : _io_srv(io_srv)
-    , _offload_thread_params(params)
-    , _client_connect_queue(10) // arbitrary initial size
+    : _offload_thread_params(params)
 {
     if (params.wait_mode == BLOCK && params.client_type == BOTH_SEND_AND_RECV) {
         throw uhd::value_error(
@@ -368,92 +447,155 @@ offload_io_service_impl::offload_io_service_impl(
             "the other");
     }
 
-    std::function<void()> thread_fn;
-
-    if (params.wait_mode == BLOCK) {
-        if (params.client_type == RECV_ONLY) {
-            thread_fn = [this]() { _do_work_blocking<true, false>(); };
-        } else if (params.client_type == SEND_ONLY) {
-            thread_fn = [this]() { _do_work_blocking<false, true>(); };
-        } else {
-            UHD_THROW_INVALID_CODE_PATH();
+    if (params.num_worker_threads == 0) {
+        throw uhd::value_error("Offload I/O service needs at least one worker thread");
+    }
+    for (const auto& assignment : params.worker_assignment) {
+        if (assignment.second >= params.num_worker_threads) {
+            throw uhd::value_error(
+                "Offload I/O service link assigned to nonexistent worker thread");
         }
-    } else if (params.wait_mode == POLL) {
-        if (params.client_type == RECV_ONLY) {
-            thread_fn = [this]() { _do_work_polling<true, false>(); };
-        } else if (params.client_type == SEND_ONLY) {
-            thread_fn = [this]() { _do_work_polling<false, true>(); };
-        } else if (params.client_type == BOTH_SEND_AND_RECV) {
-            thread_fn = [this]() { _do_work_polling<true, true>(); };
+    }
+
+    for (size_t i = 0; i < params.num_worker_threads; i++) {
+        auto worker = std::make_unique<worker_t>();
+
+        // The first worker runs the I/O service provided by the caller,
+        // additional workers each get their own since an inline I/O
+        // service must not be shared between threads
+        worker->io_srv = (i == 0) ? io_srv : inline_io_service::make();
+
+        std::function<void()> thread_fn;
+        worker_t* worker_ptr = worker.get();
+
+        if (params.wait_mode == BLOCK) {
+            if (params.client_type == RECV_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_blocking<true, false>(*worker_ptr, i);
+                };
+            } else if (params.client_type == SEND_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_blocking<false, true>(*worker_ptr, i);
+                };
+            } else {
+                UHD_THROW_INVALID_CODE_PATH();
+            }
+        } else if (params.wait_mode == POLL) {
+            if (params.client_type == RECV_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_polling<true, false>(*worker_ptr, i);
+                };
+            } else if (params.client_type == SEND_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_polling<false, true>(*worker_ptr, i);
+                };
+            } else if (params.client_type == BOTH_SEND_AND_RECV) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_polling<true, true>(*worker_ptr, i);
+                };
+            } else {
+                UHD_THROW_INVALID_CODE_PATH();
+            }
+        } else if (params.wait_mode == ADAPTIVE) {
+            if (params.client_type == RECV_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_adaptive<true, false>(*worker_ptr, i);
+                };
+            } else if (params.client_type == SEND_ONLY) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_adaptive<false, true>(*worker_ptr, i);
+                };
+            } else if (params.client_type == BOTH_SEND_AND_RECV) {
+                thread_fn = [this, worker_ptr, i]() {
+                    _do_work_adaptive<true, true>(*worker_ptr, i);
+                };
+            } else {
+                UHD_THROW_INVALID_CODE_PATH();
+            }
         } else {
             UHD_THROW_INVALID_CODE_PATH();
         }
-    } else {
-        UHD_THROW_INVALID_CODE_PATH();
-    }
 
-    _offload_thread = std::make_unique<std::thread>(thread_fn);
+        worker->thread = std::make_unique<std::thread>(thread_fn);
+        _workers.push_back(std::move(worker));
+    }
 }
 
 offload_io_service_impl::~offload_io_service_impl()
 {
     _stop_offload_thread = true;
 
-    if (_offload_thread) {
-        _offload_thread->join();
+    for (auto& worker : _workers) {
+        if (worker->thread) {
+            worker->thread->join();
+        }
+        assert(worker->recv_clients.empty());
+        assert(worker->send_clients.empty());
     }
-
-    assert(_recv_clients.empty());
-    assert(_send_clients.empty());
 }
 
 void offload_io_service_impl::attach_recv_link(recv_link_if::sptr link)
 {
+    auto& worker = _worker_for_adapter(link->get_recv_adapter_id());
+
     // Create a request to attach link in the offload thread
-    auto req_fn = [this, link]() {
-        _reservation_mgr.register_link(link);
-        _io_srv->attach_recv_link(link);
+    auto req_fn = [this, &worker, link]() {
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
+            _reservation_mgr.register_link(link);
+        }
+        worker.io_srv->attach_recv_link(link);
     };
 
-    _queue_client_req(req_fn);
+    _queue_client_req(worker, req_fn);
 }
 
 void offload_io_service_impl::attach_send_link(send_link_if::sptr link)
 {
+    auto& worker = _worker_for_adapter(link->get_send_adapter_id());
+
     // Create a request to attach link in the offload thread
-    auto req_fn = [this, link]() {
-        _reservation_mgr.register_link(link);
-        _io_srv->attach_send_link(link);
+    auto req_fn = [this, &worker, link]() {
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
+            _reservation_mgr.register_link(link);
+        }
+        worker.io_srv->attach_send_link(link);
     };
 
-    client_req_t queue_element;
-    queue_element.req  = {new std::function<void()>(req_fn)};
-    const bool success = _client_connect_queue.push(queue_element);
-    if (!success) {
-        throw uhd::runtime_error("Failed to push attach_send_link request");
-    }
+    _queue_client_req(worker, req_fn);
 }
 
 void offload_io_service_impl::detach_recv_link(recv_link_if::sptr link)
 {
+    auto& worker = _worker_for_adapter(link->get_recv_adapter_id());
+
     // Create a request to detach link in the offload thread
-    auto req_fn = [this, link]() {
-        _reservation_mgr.unregister_link(link);
-        _io_srv->detach_recv_link(link);
+    auto req_fn = [this, &worker, link]() {
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
+            _reservation_mgr.unregister_link(link);
+        }
+        worker.io_srv->detach_recv_link(link);
     };
 
-    _queue_client_req(req_fn);
+    _queue_client_req(worker, req_fn);
 }
 
 void offload_io_service_impl::detach_send_link(send_link_if::sptr link)
 {
+    auto& worker = _worker_for_adapter(link->get_send_adapter_id());
+
     // Create a request to detach link in the offload thread
-    auto req_fn = [this, link]() {
-        _reservation_mgr.unregister_link(link);
-        _io_srv->detach_send_link(link);
+    auto req_fn = [this, &worker, link]() {
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
+            _reservation_mgr.unregister_link(link);
+        }
+        worker.io_srv->detach_send_link(link);
     };
 
-    _queue_client_req(req_fn);
+    _queue_client_req(worker, req_fn);
 }
 
 recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr recv_link,
@@ -463,36 +605,46 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
     size_t num_send_frames,
     recv_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_workers.empty());
 
     if (_offload_thread_params.client_type == SEND_ONLY) {
         throw uhd::runtime_error("Recv client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_recv_frames);
+    auto port    = std::make_shared<client_port_t>(num_recv_frames);
+    auto& worker = _worker_for_adapter(recv_link->get_recv_adapter_id());
 
     // Create a request to create a new receiver in the offload thread
-    auto req_fn =
-        [this, recv_link, num_recv_frames, cb, fc_link, num_send_frames, fc_cb, port]() {
-            frame_reservation_t frames = {
-                recv_link, num_recv_frames, fc_link, num_send_frames};
+    auto req_fn = [this,
+                      &worker,
+                      recv_link,
+                      num_recv_frames,
+                      cb,
+                      fc_link,
+                      num_send_frames,
+                      fc_cb,
+                      port]() {
+        frame_reservation_t frames = {recv_link, num_recv_frames, fc_link, num_send_frames};
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
             _reservation_mgr.reserve_frames(frames);
+        }
 
-            auto inline_recv_io = _io_srv->make_recv_client(
-                recv_link, num_recv_frames, cb, fc_link, num_send_frames, fc_cb);
+        auto inline_recv_io = worker.io_srv->make_recv_client(
+            recv_link, num_recv_frames, cb, fc_link, num_send_frames, fc_cb);
 
-            recv_client_info_t client_info;
-            client_info.inline_io       = inline_recv_io;
-            client_info.port            = port;
-            client_info.frames_reserved = frames;
+        recv_client_info_t client_info;
+        client_info.inline_io       = inline_recv_io;
+        client_info.port            = port;
+        client_info.frames_reserved = frames;
 
-            _recv_clients.push_back(client_info);
+        worker.recv_clients.push_back(client_info);
 
-            // Notify that the connection is created
-            port->offload_thread_set_connected(true);
-        };
+        // Notify that the connection is created
+        port->offload_thread_set_connected(true);
+    };
 
-    _queue_client_req(req_fn);
+    _queue_client_req(worker, req_fn);
     port->client_wait_until_connected();
 
     // Return a new recv client to the caller that just operates on the queues
@@ -511,18 +663,21 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     recv_link_if::sptr recv_link,
     size_t num_recv_frames,
     recv_callback_t recv_cb,
-    send_io_if::fc_callback_t fc_cb)
+    send_io_if::fc_callback_t fc_cb,
+    const bool high_priority)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_workers.empty());
 
     if (_offload_thread_params.client_type == RECV_ONLY) {
         throw uhd::runtime_error("Send client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_send_frames);
+    auto port    = std::make_shared<client_port_t>(num_send_frames);
+    auto& worker = _worker_for_adapter(send_link->get_send_adapter_id());
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn = [this,
+                      &worker,
                       send_link,
                       num_send_frames,
                       send_cb,
@@ -530,12 +685,16 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
                       num_recv_frames,
                       recv_cb,
                       fc_cb,
-                      port]() {
+                      port,
+                      high_priority]() {
         frame_reservation_t frames = {
             recv_link, num_recv_frames, send_link, num_send_frames};
-        _reservation_mgr.reserve_frames(frames);
+        {
+            std::lock_guard<std::mutex> lock(_reservation_mutex);
+            _reservation_mgr.reserve_frames(frames);
+        }
 
-        auto inline_send_io = _io_srv->make_send_client(send_link,
+        auto inline_send_io = worker.io_srv->make_send_client(send_link,
             num_send_frames,
             send_cb,
             recv_link,
@@ -547,14 +706,21 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
         client_info.inline_io       = inline_send_io;
         client_info.port            = port;
         client_info.frames_reserved = frames;
+        client_info.high_priority   = high_priority;
 
-        _send_clients.push_back(client_info);
+        // Keep high-priority (control) clients at the front of the list so
+        // each work loop iteration services them before any data client
+        if (high_priority) {
+            worker.send_clients.push_front(client_info);
+        } else {
+            worker.send_clients.push_back(client_info);
+        }
 
         // Notify that the connection is created
         port->offload_thread_set_connected(true);
     };
 
-    _queue_client_req(req_fn);
+    _queue_client_req(worker, req_fn);
     port->client_wait_until_connected();
 
     // Wait for buffer queue to be full
@@ -572,36 +738,89 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     }
 }
 
-void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
+void offload_io_service_impl::_queue_client_req(worker_t& worker, std::function<void()> fn)
 {
     client_req_t queue_element;
     queue_element.req  = {new std::function<void()>(fn)};
-    const bool success = _client_connect_queue.push(queue_element);
+    const bool success = worker.client_connect_queue.push(queue_element);
     if (!success) {
         throw uhd::runtime_error("Failed to queue client request");
     }
 }
 
+// Look up (or decide) which worker services a given transport adapter.
+// Explicit assignments from the params take precedence; adapters seen for
+// the first time otherwise go to the workers round-robin.
+offload_io_service_impl::worker_t& offload_io_service_impl::_worker_for_adapter(
+    const adapter_id_t adapter_id)
+{
+    std::lock_guard<std::mutex> lock(_assignment_mutex);
+
+    auto it = _adapter_worker_map.find(adapter_id);
+    if (it != _adapter_worker_map.end()) {
+        return *_workers[it->second];
+    }
+
+    size_t worker_index;
+    auto assignment = _offload_thread_params.worker_assignment.find(adapter_id);
+    if (assignment != _offload_thread_params.worker_assignment.end()) {
+        worker_index = assignment->second;
+    } else {
+        worker_index = _next_worker++ % _workers.size();
+    }
+
+    _adapter_worker_map[adapter_id] = worker_index;
+    return *_workers[worker_index];
+}
+
 // Get a single receive buffer if available and update client info
-void offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
+bool offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
 {
     if (info.num_frames_in_use < info.frames_reserved.num_recv_frames) {
         if (frame_buff::uptr buff = info.inline_io->get_recv_buff(timeout_ms)) {
             info.port->offload_thread_push(buff.release());
             info.num_frames_in_use++;
+            return true;
         }
     }
+    return false;
 }
 
 // Get a single send buffer if available and update client info
-void offload_io_service_impl::_get_send_buff(send_client_info_t& info)
+bool offload_io_service_impl::_get_send_buff(send_client_info_t& info)
 {
     if (info.num_frames_in_use < info.frames_reserved.num_send_frames) {
         if (frame_buff::uptr buff = info.inline_io->get_send_buff(0)) {
             info.port->offload_thread_push(buff.release());
             info.num_frames_in_use++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Send every packet queued by a high-priority (control) client, so a
+// command waits behind at most the data frame already handed to the link.
+// Disconnect requests are left in the queue for the regular servicing path.
+// Returns whether any buffer was released.
+bool offload_io_service_impl::_drain_priority_send(send_client_info_t& info)
+{
+    bool did_work = false;
+    while (true) {
+        frame_buff* buff;
+        bool disconnect;
+        std::tie(buff, disconnect) = info.port->offload_thread_peek();
+        if (!buff) {
+            break;
         }
+        if (!info.inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+            break;
+        }
+        _release_send_buff(info, buff);
+        info.port->offload_thread_pop();
+        did_work = true;
     }
+    return did_work;
 }
 
 // Release a single recv buffer and update client info
@@ -651,22 +870,41 @@ void offload_io_service_impl::_disconnect_send_client(send_client_info_t& info)
     info.port->offload_thread_set_connected(false);
 }
 
+// Apply CPU affinity and scheduler settings for a worker thread. Called by
+// each worker on its own thread before entering the work loop.
+void offload_io_service_impl::_configure_offload_thread(const size_t worker_index)
+{
+    if (worker_index < _offload_thread_params.worker_cpu_affinity.size()) {
+        uhd::set_thread_affinity(
+            _offload_thread_params.worker_cpu_affinity[worker_index]);
+    } else {
+        uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+    }
+    if (_offload_thread_params.thread_priority) {
+        // Use the safe variant; insufficient privileges for e.g. a realtime
+        // policy should not take down the streaming session
+        uhd::set_thread_priority_safe(
+            static_cast<float>(_offload_thread_params.thread_priority.get()),
+            _offload_thread_params.realtime_priority);
+    }
+}
+
 template <bool allow_recv, bool allow_send>
-void offload_io_service_impl::_do_work_polling()
+void offload_io_service_impl::_do_work_polling(worker_t& worker, const size_t worker_index)
 {
-    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+    _configure_offload_thread(worker_index);
 
     client_req_t client_req;
 
     while (!_stop_offload_thread) {
         if (allow_recv) {
             // Get recv buffers
-            for (auto& recv_info : _recv_clients) {
+            for (auto& recv_info : worker.recv_clients) {
                 _get_recv_buff(recv_info, 0);
             }
 
             // Release recv buffers
-            for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
+            for (auto it = worker.recv_clients.begin(); it != worker.recv_clients.end();) {
                 frame_buff* buff;
                 bool disconnect;
                 std::tie(buff, disconnect) = it->port->offload_thread_pop();
@@ -674,7 +912,7 @@ void offload_io_service_impl::_do_work_polling()
                     _release_recv_buff(*it, buff);
                 } else if (disconnect) {
                     _disconnect_recv_client(*it);
-                    it = _recv_clients.erase(it); // increments it
+                    it = worker.recv_clients.erase(it); // increments it
                     continue;
                 }
                 ++it;
@@ -683,12 +921,17 @@ void offload_io_service_impl::_do_work_polling()
 
         if (allow_send) {
             // Get send buffers
-            for (auto& send_info : _send_clients) {
+            for (auto& send_info : worker.send_clients) {
                 _get_send_buff(send_info);
             }
 
-            // Release send buffers
-            for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+            // Release send buffers. Control clients sit at the front of the
+            // list and are drained fully, so their packets preempt queued
+            // data at packet boundaries.
+            for (auto it = worker.send_clients.begin(); it != worker.send_clients.end();) {
+                if (it->high_priority) {
+                    _drain_priority_send(*it);
+                }
                 frame_buff* buff;
                 bool disconnect;
                 std::tie(buff, disconnect) = it->port->offload_thread_peek();
@@ -700,7 +943,7 @@ void offload_io_service_impl::_do_work_polling()
                 } else if (disconnect) {
                     it->port->offload_thread_pop();
                     _disconnect_send_client(*it);
-                    it = _send_clients.erase(it); // increments it
+                    it = worker.send_clients.erase(it); // increments it
                     continue;
                 }
                 ++it;
@@ -708,7 +951,7 @@ void offload_io_service_impl::_do_work_polling()
         }
 
         // Execute one client connect command per main loop iteration
-        if (_client_connect_queue.pop(client_req)) {
+        if (worker.client_connect_queue.pop(client_req)) {
             (*client_req.req)();
             delete client_req.req;
         }
@@ -716,21 +959,21 @@ void offload_io_service_impl::_do_work_polling()
 }
 
 template <bool allow_recv, bool allow_send>
-void offload_io_service_impl::_do_work_blocking()
+void offload_io_service_impl::_do_work_blocking(worker_t& worker, const size_t worker_index)
 {
-    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+    _configure_offload_thread(worker_index);
 
     client_req_t client_req;
 
     while (!_stop_offload_thread) {
         if (allow_recv) {
             // Get recv buffers
-            for (auto& recv_info : _recv_clients) {
+            for (auto& recv_info : worker.recv_clients) {
                 _get_recv_buff(recv_info, blocking_timeout_ms);
             }
 
             // Release recv buffers
-            for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
+            for (auto it = worker.recv_clients.begin(); it != worker.recv_clients.end();) {
                 frame_buff* buff;
                 bool disconnect;
 
@@ -747,7 +990,7 @@ void offload_io_service_impl::_do_work_blocking()
                     _release_recv_buff(*it, buff);
                 } else if (disconnect) {
                     _disconnect_recv_client(*it);
-                    it = _recv_clients.erase(it); // increments it
+                    it = worker.recv_clients.erase(it); // increments it
                     continue;
                 }
                 ++it;
@@ -756,12 +999,16 @@ void offload_io_service_impl::_do_work_blocking()
 
         if (allow_send) {
             // Get send buffers
-            for (auto& send_info : _send_clients) {
+            for (auto& send_info : worker.send_clients) {
                 _get_send_buff(send_info);
             }
 
-            // Release send buffers
-            for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+            // Release send buffers. Control clients sit at the front of the
+            // list and are drained fully before any data client is serviced.
+            for (auto it = worker.send_clients.begin(); it != worker.send_clients.end();) {
+                if (it->high_priority) {
+                    _drain_priority_send(*it);
+                }
                 if (it->num_frames_in_use > 0) {
                     frame_buff* buff;
                     bool disconnect;
@@ -775,7 +1022,7 @@ void offload_io_service_impl::_do_work_blocking()
                     } else if (disconnect) {
                         it->port->offload_thread_pop();
                         _disconnect_send_client(*it);
-                        it = _send_clients.erase(it); // increments it
+                        it = worker.send_clients.erase(it); // increments it
                         continue;
                     }
                 }
@@ -787,11 +1034,101 @@ void offload_io_service_impl::_do_work_blocking()
         // TODO: In a blocking I/O strategy, the loop can take a long time to
         // service these requests. Need to configure all clients up-front,
         // before starting the offload thread to avoid this.
-        if (_client_connect_queue.pop(client_req)) {
+        if (worker.client_connect_queue.pop(client_req)) {
             (*client_req.req)();
             delete client_req.req;
         }
     }
 }
 
+// Adaptive strategy: poll exactly like _do_work_polling while there is work,
+// then after a bounded number of idle iterations back off into sleeps that
+// double up to adaptive_max_backoff. The sleeps park the thread in the
+// kernel, so an idle worker costs (almost) no CPU, yet the spin window keeps
+// burst reaction identical to polling as long as gaps stay short.
+template <bool allow_recv, bool allow_send>
+void offload_io_service_impl::_do_work_adaptive(worker_t& worker, const size_t worker_index)
+{
+    _configure_offload_thread(worker_index);
+
+    const size_t spin_count = _offload_thread_params.adaptive_spin_count;
+
+    client_req_t client_req;
+    size_t idle_iterations = 0;
+    std::chrono::microseconds backoff(1);
+
+    while (!_stop_offload_thread) {
+        bool did_work = false;
+
+        if (allow_recv) {
+            // Get recv buffers
+            for (auto& recv_info : worker.recv_clients) {
+                did_work |= _get_recv_buff(recv_info, 0);
+            }
+
+            // Release recv buffers
+            for (auto it = worker.recv_clients.begin(); it != worker.recv_clients.end();) {
+                frame_buff* buff;
+                bool disconnect;
+                std::tie(buff, disconnect) = it->port->offload_thread_pop();
+                if (buff) {
+                    _release_recv_buff(*it, buff);
+                    did_work = true;
+                } else if (disconnect) {
+                    _disconnect_recv_client(*it);
+                    it = worker.recv_clients.erase(it); // increments it
+                    continue;
+                }
+                ++it;
+            }
+        }
+
+        if (allow_send) {
+            // Get send buffers
+            for (auto& send_info : worker.send_clients) {
+                did_work |= _get_send_buff(send_info);
+            }
+
+            // Release send buffers. Control clients sit at the front of the
+            // list and are drained fully before any data client is serviced.
+            for (auto it = worker.send_clients.begin(); it != worker.send_clients.end();) {
+                if (it->high_priority) {
+                    did_work |= _drain_priority_send(*it);
+                }
+                frame_buff* buff;
+                bool disconnect;
+                std::tie(buff, disconnect) = it->port->offload_thread_peek();
+                if (buff) {
+                    if (it->inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+                        _release_send_buff(*it, buff);
+                        it->port->offload_thread_pop();
+                        did_work = true;
+                    }
+                } else if (disconnect) {
+                    it->port->offload_thread_pop();
+                    _disconnect_send_client(*it);
+                    it = worker.send_clients.erase(it); // increments it
+                    continue;
+                }
+                ++it;
+            }
+        }
+
+        // Execute one client connect command per main loop iteration
+        if (worker.client_connect_queue.pop(client_req)) {
+            (*client_req.req)();
+            delete client_req.req;
+            did_work = true;
+        }
+
+        if (did_work) {
+            idle_iterations = 0;
+            backoff         = std::chrono::microseconds(1);
+        } else if (++idle_iterations > spin_count) {
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, adaptive_max_backoff);
+        }
+    }
+}
+
 }} // namespace uhd::transport
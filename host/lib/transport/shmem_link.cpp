@@ -0,0 +1,250 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/shmem_link.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+namespace uhd { namespace transport {
+
+namespace {
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+//! How long an attaching process waits for the creator to finish
+//! initializing a freshly created segment
+constexpr int32_t ATTACH_INIT_TIMEOUT_MS = 1000;
+
+size_t cache_align(const size_t num_bytes)
+{
+    return (num_bytes + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+}
+
+size_t lens_offset()
+{
+    return cache_align(sizeof(shmem_detail::ring_header));
+}
+
+size_t frames_offset(const size_t num_frames)
+{
+    return cache_align(lens_offset() + num_frames * sizeof(uint32_t));
+}
+
+size_t segment_size(const size_t frame_size, const size_t num_frames)
+{
+    return frames_offset(num_frames) + frame_size * num_frames;
+}
+
+//! POSIX shm names must begin with '/' and contain no further slashes
+std::string segment_name(const std::string& name, const bool downstream)
+{
+    return "/uhd-shmem-" + name + (downstream ? "-dn" : "-up");
+}
+
+} // namespace
+
+namespace shmem_detail {
+
+shmem_ring::~shmem_ring()
+{
+    close();
+}
+
+void shmem_ring::create(
+    const std::string& name, const size_t frame_size, const size_t num_frames)
+{
+    _name       = name;
+    _frame_size = frame_size;
+    _num_frames = num_frames;
+    _map_size   = segment_size(frame_size, num_frames);
+
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw uhd::io_error(str(
+            boost::format("shmem_link: cannot create segment %s: %s (is a stale "
+                          "segment from a crashed process still linked?)")
+            % name % std::strerror(errno)));
+    }
+    if (ftruncate(fd, _map_size) != 0) {
+        ::close(fd);
+        shm_unlink(name.c_str());
+        throw uhd::io_error(
+            str(boost::format("shmem_link: cannot size segment %s: %s") % name
+                % std::strerror(errno)));
+    }
+    void* mem = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // the mapping keeps the segment alive
+    if (mem == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw uhd::io_error(
+            str(boost::format("shmem_link: cannot map segment %s: %s") % name
+                % std::strerror(errno)));
+    }
+    _owner = true;
+
+    // Placement-new gives the shared atomics a valid lifetime
+    _hdr             = new (mem) ring_header();
+    _hdr->version    = RING_VERSION;
+    _hdr->frame_size = static_cast<uint32_t>(frame_size);
+    _hdr->num_frames = static_cast<uint32_t>(num_frames);
+    _hdr->head.store(0, std::memory_order_relaxed);
+    _hdr->tail.store(0, std::memory_order_relaxed);
+    _lens   = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(mem) + lens_offset());
+    _frames = static_cast<uint8_t*>(mem) + frames_offset(num_frames);
+    std::memset(_lens, 0, num_frames * sizeof(uint32_t));
+
+    // The magic goes in last: attachers poll for it to know init is done
+    _hdr->magic.store(RING_MAGIC, std::memory_order_release);
+}
+
+void shmem_ring::attach(
+    const std::string& name, const size_t frame_size, const size_t num_frames)
+{
+    _name       = name;
+    _frame_size = frame_size;
+    _num_frames = num_frames;
+    _map_size   = segment_size(frame_size, num_frames);
+
+    const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        throw uhd::io_error(
+            str(boost::format("shmem_link: cannot open segment %s: %s (is the "
+                              "creating process running?)")
+                % name % std::strerror(errno)));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 or static_cast<size_t>(st.st_size) < _map_size) {
+        ::close(fd);
+        throw uhd::io_error(str(
+            boost::format("shmem_link: segment %s is smaller than expected") % name));
+    }
+    void* mem = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        throw uhd::io_error(
+            str(boost::format("shmem_link: cannot map segment %s: %s") % name
+                % std::strerror(errno)));
+    }
+    _hdr = reinterpret_cast<ring_header*>(mem);
+
+    // Wait for the creator to finish initializing the segment
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::milliseconds(ATTACH_INIT_TIMEOUT_MS);
+    while (_hdr->magic.load(std::memory_order_acquire) != RING_MAGIC) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            munmap(mem, _map_size);
+            _hdr = nullptr;
+            throw uhd::io_error(
+                str(boost::format("shmem_link: segment %s was never initialized")
+                    % name));
+        }
+        std::this_thread::yield();
+    }
+
+    if (_hdr->version != RING_VERSION or _hdr->frame_size != frame_size
+        or _hdr->num_frames != num_frames) {
+        const std::string err = str(
+            boost::format("shmem_link: segment %s geometry mismatch: have version "
+                          "%u, %u frames of %u bytes; want version %u, %u frames of "
+                          "%u bytes")
+            % name % _hdr->version % _hdr->num_frames % _hdr->frame_size % RING_VERSION
+            % num_frames % frame_size);
+        munmap(mem, _map_size);
+        _hdr = nullptr;
+        throw uhd::value_error(err);
+    }
+
+    _lens   = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(mem) + lens_offset());
+    _frames = static_cast<uint8_t*>(mem) + frames_offset(num_frames);
+}
+
+void shmem_ring::close()
+{
+    if (_hdr) {
+        munmap(_hdr, _map_size);
+        _hdr    = nullptr;
+        _lens   = nullptr;
+        _frames = nullptr;
+    }
+    if (_owner) {
+        shm_unlink(_name.c_str());
+        _owner = false;
+    }
+}
+
+} // namespace shmem_detail
+
+shmem_link::shmem_link(
+    const std::string& name, const bool create, const link_params_t& params)
+    : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
+    , send_link_base_t(params.num_send_frames, params.send_frame_size)
+    , _recv_buffs(params.num_recv_frames)
+    , _send_buffs(params.num_send_frames)
+{
+    // The creator sends on the downstream ring and receives on the
+    // upstream ring; the attacher mirrors it
+    const std::string dn_name = segment_name(name, true);
+    const std::string up_name = segment_name(name, false);
+    if (create) {
+        _send_ring.create(dn_name, params.send_frame_size, params.num_send_frames);
+        _recv_ring.create(up_name, params.recv_frame_size, params.num_recv_frames);
+    } else {
+        _send_ring.attach(up_name, params.send_frame_size, params.num_send_frames);
+        _recv_ring.attach(dn_name, params.recv_frame_size, params.num_recv_frames);
+    }
+
+    /* Preload the buffer pools in the parent classes; the buffers are
+     * bound to their ring slots at acquisition time */
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+
+    auto info      = shmem_adapter_info(name);
+    auto& adap_ctx = adapter_ctx::get();
+    _adapter_id    = adap_ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("SHMEM")
+        << boost::format("Created shmem link %s (%s)") % name
+               % (create ? "create" : "attach");
+    UHD_LOGGER_TRACE("SHMEM")
+        << boost::format("num_recv_frames=%d, recv_frame_size=%d, num_send_frames=%d, "
+                         "send_frame_size=%d")
+               % params.num_recv_frames % params.recv_frame_size % params.num_send_frames
+               % params.send_frame_size;
+}
+
+shmem_link::~shmem_link()
+{
+    _send_ring.close();
+    _recv_ring.close();
+}
+
+shmem_link::sptr shmem_link::make(
+    const std::string& name, const bool create, const link_params_t& params)
+{
+    UHD_ASSERT_THROW(!name.empty());
+    UHD_ASSERT_THROW(params.recv_frame_size > 0);
+    UHD_ASSERT_THROW(params.send_frame_size > 0);
+    UHD_ASSERT_THROW(params.num_send_frames > 0);
+    UHD_ASSERT_THROW(params.num_recv_frames > 0);
+
+    return std::make_shared<shmem_link>(name, create, params);
+}
+
+}} // namespace uhd::transport
@@ -397,9 +397,11 @@ private:
     {
         managed_recv_buffer::sptr& buff = curr_buffer_info.buff;
         per_buffer_info_type& info      = curr_buffer_info;
+        // hoist the channel props lookup out of the per-packet code
+        xport_chan_props_type& props = _props[index];
         while (1) {
             // get a single packet from the transport layer
-            buff = _props[index].get_buff(timeout);
+            buff = props.get_buff(timeout);
             if (buff.get() == nullptr)
                 return PACKET_TIMEOUT_ERROR;
 
@@ -407,7 +409,7 @@ private:
             if (++recvd_packets > 1000) {
                 recvd_packets = 0;
                 buff.reset();
-                buff = _props[index].get_buff(timeout);
+                buff = props.get_buff(timeout);
                 if (buff.get() == nullptr)
                     return PACKET_TIMEOUT_ERROR;
             }
@@ -429,16 +431,16 @@ private:
                 info.vrt_hdr + info.ifpi.num_header_words32);
 
             // handle flow control
-            if (_props[index].handle_flowctrl) {
-                if ((info.ifpi.packet_count % _props[index].fc_update_window) == 0) {
-                    _props[index].handle_flowctrl(info.ifpi.packet_count);
+            if (props.handle_flowctrl) {
+                if ((info.ifpi.packet_count % props.fc_update_window) == 0) {
+                    props.handle_flowctrl(info.ifpi.packet_count);
                 }
             }
 
             // handle flow control ack
             if (info.ifpi.fc_ack) {
-                if (_props[index].handle_flowctrl_ack) {
-                    _props[index].handle_flowctrl_ack(
+                if (props.handle_flowctrl_ack) {
+                    props.handle_flowctrl_ack(
                         reinterpret_cast<const uint32_t*>(info.copy_buff));
                 }
                 // Process the next packet
@@ -464,16 +466,16 @@ private:
 #ifndef SRPH_DONT_CHECK_SEQUENCE
         const size_t seq_mask =
             (info.ifpi.link_type == vrt::if_packet_info_t::LINK_TYPE_NONE) ? 0xf : 0xfff;
-        const size_t expected_packet_count = _props[index].packet_count;
-        _props[index].packet_count         = (info.ifpi.packet_count + 1) & seq_mask;
+        const size_t expected_packet_count = props.packet_count;
+        props.packet_count                 = (info.ifpi.packet_count + 1) & seq_mask;
         if (expected_packet_count != info.ifpi.packet_count) {
             // UHD_LOGGER_INFO("STREAMER") << "expected: " << expected_packet_count << "
             // got: " << info.ifpi.packet_count;
-            if (_props[index].handle_flowctrl) {
+            if (props.handle_flowctrl) {
                 // Always update flow control in this case, because we don't
                 // know which packet was dropped and what state the upstream
                 // flow control is in.
-                _props[index].handle_flowctrl(info.ifpi.packet_count);
+                props.handle_flowctrl(info.ifpi.packet_count);
             }
             return PACKET_SEQUENCE_ERROR;
         }
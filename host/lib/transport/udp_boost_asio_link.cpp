@@ -8,6 +8,15 @@
 #include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <thread>
+#if defined(UHD_PLATFORM_LINUX)
+#    include <linux/errqueue.h>
+#    include <linux/net_tstamp.h>
+#endif
 
 using namespace uhd::transport;
 
@@ -17,8 +26,9 @@ udp_boost_asio_link::udp_boost_asio_link(
     const std::string& addr, const std::string& port, const link_params_t& params)
     : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
     , send_link_base_t(params.num_send_frames, params.send_frame_size)
-    , _recv_memory_pool(buffer_pool::make(params.num_recv_frames, params.recv_frame_size))
-    , _send_memory_pool(buffer_pool::make(params.num_send_frames, params.send_frame_size))
+    , _recv_memory_pool(make_recv_buff_pool(params))
+    , _send_memory_pool(make_send_buff_pool(params))
+    , _pacing_rate(params.send_pacing_rate)
 {
     for (size_t i = 0; i < params.num_recv_frames; i++) {
         _recv_buffs.push_back(udp_boost_asio_frame_buff(_recv_memory_pool->at(i)));
@@ -28,9 +38,26 @@ udp_boost_asio_link::udp_boost_asio_link(
         _send_buffs.push_back(udp_boost_asio_frame_buff(_send_memory_pool->at(i)));
     }
 
+#if defined(UHD_PLATFORM_LINUX)
+    // the batched recv path keeps its own free list
+    for (auto& buff : _recv_buffs) {
+        _recv_free.push_back(&buff);
+    }
+    _recv_pending.reserve(RECV_BATCH_SIZE);
+    _batch_buffs.reserve(RECV_BATCH_SIZE);
+    _msgs.resize(RECV_BATCH_SIZE);
+    _iovs.resize(RECV_BATCH_SIZE);
+    _cmsg_bufs.resize(RECV_BATCH_SIZE);
+    for (size_t i = 0; i < RECV_BATCH_SIZE; i++) {
+        std::memset(&_msgs[i], 0, sizeof(_msgs[i]));
+        _msgs[i].msg_hdr.msg_iov    = &_iovs[i];
+        _msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+#else
     for (auto& buff : _recv_buffs) {
         recv_link_base_t::preload_free_buff(&buff);
     }
+#endif
 
     for (auto& buff : _send_buffs) {
         send_link_base_t::preload_free_buff(&buff);
@@ -40,15 +67,189 @@ udp_boost_asio_link::udp_boost_asio_link(
     _socket  = open_udp_socket(addr, port, _io_service);
     _sock_fd = _socket->native_handle();
 
+#if defined(UHD_PLATFORM_LINUX)
+    enable_rx_timestamps();
+#endif
+
+    if (_pacing_rate != 0) {
+        // Allow a burst of at most ~100 us worth of traffic at the
+        // configured rate, but never less than one frame
+        _pacing_bucket_depth =
+            std::max<double>(params.send_frame_size, _pacing_rate / 10000.0);
+        _pacing_tokens      = _pacing_bucket_depth;
+        _pacing_last_refill = std::chrono::steady_clock::now();
+#if defined(UHD_PLATFORM_LINUX) && defined(SO_MAX_PACING_RATE)
+        // Additionally ask the kernel to space the packets on the wire. This
+        // takes effect when the fq qdisc is installed and gives smoother
+        // inter-packet gaps than the syscall-level bucket alone; the bucket
+        // remains as the fallback where fq is absent.
+        const unsigned int rate = static_cast<unsigned int>(std::min<size_t>(
+            _pacing_rate, std::numeric_limits<unsigned int>::max()));
+        if (::setsockopt(_sock_fd, SOL_SOCKET, SO_MAX_PACING_RATE, &rate, sizeof(rate))
+            != 0) {
+            UHD_LOGGER_TRACE("UDP")
+                << "Could not set SO_MAX_PACING_RATE: " << strerror(errno);
+        }
+#endif
+        UHD_LOGGER_DEBUG("UDP")
+            << boost::format("Pacing transmit at %d bytes/sec") % _pacing_rate;
+    }
+
     auto info   = udp_boost_asio_adapter_info(*_socket);
     auto& ctx   = adapter_ctx::get();
     _adapter_id = ctx.register_adapter(info);
+    ctx.register_capabilities(_adapter_id, discover_adapter_caps(get_local_addr()));
+
+#if defined(UHD_PLATFORM_LINUX) && defined(SO_NO_CHECK)
+    // When the NIC cannot offload transmit checksums, the kernel computes
+    // them in software for every frame. CHDR links are point-to-point and
+    // the protocol tracks sequence numbers itself, so skip the UDP checksum
+    // rather than burn cycles on it. IPv4 permits a zero UDP checksum; the
+    // IP header checksum is unaffected. Receive validation has no per-socket
+    // knob and stays wherever the NIC/kernel put it.
+    const auto caps = ctx.get_capabilities(_adapter_id);
+    if (caps.valid and not caps.tx_csum_offload) {
+        const int one = 1;
+        if (::setsockopt(_sock_fd, SOL_SOCKET, SO_NO_CHECK, &one, sizeof(one)) == 0) {
+            UHD_LOGGER_DEBUG("UDP")
+                << "Transmit checksum offload unavailable; skipping software "
+                   "UDP checksums (SO_NO_CHECK)";
+        }
+    }
+#endif
 
     UHD_LOGGER_TRACE("UDP") << boost::format("Created UDP link to %s:%s") % addr % port;
     UHD_LOGGER_TRACE("UDP") << boost::format("Local UDP socket endpoint: %s:%s")
                                    % get_local_addr() % get_local_port();
 }
 
+#if defined(UHD_PLATFORM_LINUX)
+//! Pull the packet arrival time out of the message's SCM_TIMESTAMPING record
+static uint64_t read_rx_timestamp(::msghdr* msg)
+{
+    for (::cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SCM_TIMESTAMPING) {
+            ::scm_timestamping tss;
+            std::memcpy(&tss, CMSG_DATA(cmsg), sizeof(tss));
+            // ts[2] is the raw NIC clock, ts[0] the kernel's stamp; prefer
+            // the NIC clock when the interface has timestamping enabled
+            const ::timespec& ts =
+                (tss.ts[2].tv_sec or tss.ts[2].tv_nsec) ? tss.ts[2] : tss.ts[0];
+            return uint64_t(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+        }
+    }
+    return 0;
+}
+
+void udp_boost_asio_link::enable_rx_timestamps()
+{
+    // Request NIC timestamps with a kernel timestamp fallback. Raw hardware
+    // stamps additionally require timestamping to be enabled on the interface
+    // itself (e.g. with hwstamp_ctl); until then the kernel stamp is reported.
+    const int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE
+                      | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    if (::setsockopt(_sock_fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags))
+        != 0) {
+        UHD_LOGGER_TRACE("UDP")
+            << "Could not enable socket timestamping: " << strerror(errno);
+    }
+}
+
+frame_buff::uptr udp_boost_asio_link::get_recv_buff(int32_t timeout_ms)
+{
+    if (_recv_pending_head == _recv_pending.size() and not fill_recv_batch(timeout_ms)) {
+        return frame_buff::uptr();
+    }
+    return frame_buff::uptr(_recv_pending[_recv_pending_head++]);
+}
+
+void udp_boost_asio_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    buff_ptr->set_packet_size(0);
+    _recv_free.push_back(buff_ptr);
+}
+
+bool udp_boost_asio_link::fill_recv_batch(int32_t timeout_ms)
+{
+    _recv_pending.clear();
+    _recv_pending_head = 0;
+
+    // stage as many free buffers as one syscall can fill
+    _batch_buffs.clear();
+    const size_t nbuffs = std::min(_recv_free.size(), RECV_BATCH_SIZE);
+    for (size_t i = 0; i < nbuffs; i++) {
+        frame_buff* buff = _recv_free.back();
+        _recv_free.pop_back();
+        _batch_buffs.push_back(buff);
+        _iovs[i].iov_base = buff->data();
+        _iovs[i].iov_len  = get_recv_frame_size();
+        // the kernel rewrites msg_controllen on each call
+        _msgs[i].msg_hdr.msg_control    = _cmsg_bufs[i].data();
+        _msgs[i].msg_hdr.msg_controllen = RECV_CMSG_SIZE;
+    }
+
+    // try a non-blocking batched recv first, then wait and retry
+    int num_received = ::recvmmsg(_sock_fd, _msgs.data(), nbuffs, MSG_DONTWAIT, NULL);
+    if (num_received < 0 and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+        if (wait_for_recv_ready(_sock_fd, timeout_ms)) {
+            num_received =
+                ::recvmmsg(_sock_fd, _msgs.data(), nbuffs, MSG_DONTWAIT, NULL);
+        } else {
+            num_received = 0; // timeout
+        }
+    }
+    if (num_received < 0 and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+        num_received = 0; // spurious wakeup
+    }
+    if (num_received < 0) {
+        // put the staged buffers back before reporting the error
+        for (frame_buff* buff : _batch_buffs) {
+            _recv_free.push_back(buff);
+        }
+        throw uhd::io_error(
+            str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+    }
+
+    for (int i = 0; i < num_received; i++) {
+        _batch_buffs[i]->set_packet_size(_msgs[i].msg_len);
+        _batch_buffs[i]->set_wire_time_ns(read_rx_timestamp(&_msgs[i].msg_hdr));
+        _recv_pending.push_back(_batch_buffs[i]);
+    }
+
+    // return the staged buffers the syscall did not fill
+    for (size_t i = num_received; i < nbuffs; i++) {
+        _recv_free.push_back(_batch_buffs[i]);
+    }
+
+    return num_received > 0;
+}
+#endif /* defined(UHD_PLATFORM_LINUX) */
+
+void udp_boost_asio_link::pace_send(const size_t nbytes)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    auto refill = [this, &now]() {
+        const std::chrono::duration<double> elapsed = now - _pacing_last_refill;
+        _pacing_last_refill                         = now;
+        _pacing_tokens = std::min(
+            _pacing_bucket_depth, _pacing_tokens + elapsed.count() * _pacing_rate);
+    };
+
+    refill();
+    while (_pacing_tokens < double(nbytes)) {
+        // Sleep just long enough to accrue the deficit
+        const double deficit_sec = (nbytes - _pacing_tokens) / _pacing_rate;
+        std::this_thread::sleep_for(std::chrono::duration<double>(deficit_sec));
+        now = std::chrono::steady_clock::now();
+        refill();
+    }
+    _pacing_tokens -= double(nbytes);
+}
+
 uint16_t udp_boost_asio_link::get_local_port() const
 {
     return _socket->local_endpoint().port();
@@ -47,15 +47,28 @@ udp_dpdk_link::udp_dpdk_link(dpdk::port_id_t port_id,
     // Get an unused UDP port for listening
     _local_port = _port->alloc_udp_port(local_port_num);
 
+    // Get a TX DMA queue (round-robin across the port's configured queues)
+    _queue = _port->alloc_queue();
+
     // Validate params
     const size_t max_frame_size = _port->get_mtu() - dpdk::HDR_SIZE_UDP_IPV4;
     UHD_ASSERT_THROW(params.send_frame_size <= max_frame_size);
     UHD_ASSERT_THROW(params.recv_frame_size <= max_frame_size);
 
-    // Register the adapter
+    // Register the adapter and the port's discovered capabilities, so the
+    // I/O service manager sees DPDK links the same way as kernel UDP links
     auto info      = _port->get_adapter_info();
     auto& adap_ctx = adapter_ctx::get();
     _adapter_id    = adap_ctx.register_adapter(info);
+
+    adapter_caps_t caps;
+    caps.valid           = true;
+    caps.rx_csum_offload = _port->get_rx_udp_cksum_offload();
+    caps.tx_csum_offload = _port->get_tx_udp_cksum_offload();
+    caps.num_rx_queues   = _port->get_queue_count();
+    caps.num_tx_queues   = _port->get_queue_count();
+    caps.mtu             = _port->get_mtu();
+    adap_ctx.register_capabilities(_adapter_id, caps);
     UHD_LOGGER_TRACE("DPDK") << boost::format("Created udp_dpdk_link to (%s:%s)")
                                     % remote_addr % remote_port;
     UHD_LOGGER_TRACE("DPDK")
@@ -109,6 +122,13 @@ void udp_dpdk_link::enqueue_recv_mbuf(struct rte_mbuf* mbuf)
     buff->header_jump(
         sizeof(struct ether_hdr) + sizeof(struct ipv4_hdr) + sizeof(struct udp_hdr));
     buff->set_packet_size(packet_size);
+#ifdef PKT_RX_TIMESTAMP
+    // Pass the PMD's RX timestamp along if the NIC provided one. Note the
+    // clock source (and for some PMDs, the units) is device-specific.
+    if (mbuf->ol_flags & PKT_RX_TIMESTAMP) {
+        buff->set_wire_time_ns(mbuf->timestamp);
+    }
+#endif
     // Add the dpdk_frame_buff to the list
     if (_recv_buff_head) {
         buff->prev                  = _recv_buff_head->prev;
@@ -0,0 +1,430 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/transport/udp_rio_link.hpp>
+#include <boost/asio.hpp>
+#include <boost/format.hpp>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+using namespace uhd::transport;
+
+namespace asio = boost::asio;
+
+namespace {
+
+//! Completions dequeued per RIODequeueCompletion call
+constexpr ULONG RIO_DEQUEUE_BATCH_SIZE = 32;
+
+//! Dequeue attempts before get_recv_buff starts sleeping between polls
+constexpr size_t RIO_RECV_SPIN_COUNT = 1000;
+
+//! Static initialization to take care of WSA init and cleanup
+struct uhd_wsa_control
+{
+    uhd_wsa_control()
+    {
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+    }
+
+    ~uhd_wsa_control()
+    {
+        WSACleanup();
+    }
+};
+
+} // namespace
+
+udp_rio_link::udp_rio_link(
+    const std::string& addr, const std::string& port, const link_params_t& params)
+    : _num_recv_frames(params.num_recv_frames)
+    , _recv_frame_size(params.recv_frame_size)
+    , _num_send_frames(params.num_send_frames)
+    , _send_frame_size(params.send_frame_size)
+    , _recv_memory_pool(buffer_pool::make(params.num_recv_frames,
+          params.recv_frame_size,
+          16,
+          params.numa_node,
+          params.use_hugepages))
+    , _send_memory_pool(buffer_pool::make(params.num_send_frames,
+          params.send_frame_size,
+          16,
+          params.numa_node,
+          params.use_hugepages))
+{
+    // makes wsa start happen via lazy initialization
+    static uhd_wsa_control uhd_wsa;
+
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        _recv_buffs.push_back(udp_rio_frame_buff(_recv_memory_pool->at(i), i));
+    }
+
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        _send_buffs.push_back(udp_rio_frame_buff(_send_memory_pool->at(i), i));
+    }
+
+    for (auto& buff : _send_buffs) {
+        _send_free.push_back(&buff);
+    }
+
+    _recv_pending.reserve(params.num_recv_frames);
+
+    // resolve the address
+    asio::io_service io_service;
+    asio::ip::udp::resolver resolver(io_service);
+    asio::ip::udp::resolver::query query(asio::ip::udp::v4(), addr, port);
+    asio::ip::udp::endpoint receiver_endpoint = *resolver.resolve(query);
+
+    // create the socket with registered I/O enabled
+    _socket = WSASocket(
+        AF_INET, SOCK_DGRAM, IPPROTO_UDP, NULL, 0, WSA_FLAG_REGISTERED_IO);
+    if (_socket == INVALID_SOCKET) {
+        const DWORD error = WSAGetLastError();
+        throw uhd::os_error(
+            str(boost::format("WSASocket() failed with error %d") % error));
+    }
+
+    // connect the socket so we can send/recv
+    const asio::ip::udp::endpoint::data_type& servaddr = *receiver_endpoint.data();
+    if (WSAConnect(_socket,
+            (const struct sockaddr*)&servaddr,
+            sizeof(servaddr),
+            NULL,
+            NULL,
+            NULL,
+            NULL)
+        != 0) {
+        const DWORD error = WSAGetLastError();
+        closesocket(_socket);
+        throw uhd::os_error(
+            str(boost::format("WSAConnect() failed with error %d") % error));
+    }
+
+    // fetch the RIO extension function table
+    GUID rio_guid = WSAID_MULTIPLE_RIO;
+    DWORD bytes   = 0;
+    std::memset(&_rio, 0, sizeof(_rio));
+    if (WSAIoctl(_socket,
+            SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+            &rio_guid,
+            sizeof(rio_guid),
+            &_rio,
+            sizeof(_rio),
+            &bytes,
+            NULL,
+            NULL)
+        != 0) {
+        const DWORD error = WSAGetLastError();
+        closesocket(_socket);
+        throw uhd::os_error(str(
+            boost::format("Could not load RIO extension functions (error %d). "
+                          "Registered I/O requires Windows 8 / Server 2012 or later.")
+            % error));
+    }
+
+    // One completion queue per direction so the recv and send threads
+    // never contend when dequeueing
+    _recv_cq = _rio.RIOCreateCompletionQueue((DWORD)params.num_recv_frames, NULL);
+    _send_cq = _rio.RIOCreateCompletionQueue((DWORD)params.num_send_frames, NULL);
+    if (_recv_cq == RIO_INVALID_CQ or _send_cq == RIO_INVALID_CQ) {
+        const DWORD error = WSAGetLastError();
+        closesocket(_socket);
+        throw uhd::os_error(
+            str(boost::format("RIOCreateCompletionQueue() failed with error %d")
+                % error));
+    }
+
+    // A socket gets exactly one request queue, shared by both directions
+    _rq = _rio.RIOCreateRequestQueue(_socket,
+        (ULONG)params.num_recv_frames, // max outstanding receives
+        1, // buffers per receive
+        (ULONG)params.num_send_frames, // max outstanding sends
+        1, // buffers per send
+        _recv_cq,
+        _send_cq,
+        this);
+    if (_rq == RIO_INVALID_RQ) {
+        const DWORD error = WSAGetLastError();
+        closesocket(_socket);
+        throw uhd::os_error(
+            str(boost::format("RIOCreateRequestQueue() failed with error %d") % error));
+    }
+
+    // Register the frame buffer regions once so the kernel skips the
+    // per-packet buffer probe and lock. The buffer pool is one
+    // contiguous allocation, so each frame is a slice of one
+    // registration.
+    auto register_pool = [this](buffer_pool::sptr& pool,
+                             const size_t num_frames,
+                             const size_t frame_size,
+                             std::vector<RIO_BUF>& rio_bufs) -> RIO_BUFFERID {
+        char* base       = static_cast<char*>(pool->at(0));
+        char* last       = static_cast<char*>(pool->at(num_frames - 1));
+        const DWORD size = (DWORD)(last - base) + (DWORD)frame_size;
+
+        RIO_BUFFERID bufid = _rio.RIORegisterBuffer(base, size);
+        if (bufid == RIO_INVALID_BUFFERID) {
+            const DWORD error = WSAGetLastError();
+            closesocket(_socket);
+            throw uhd::os_error(
+                str(boost::format("RIORegisterBuffer() failed with error %d") % error));
+        }
+
+        rio_bufs.resize(num_frames);
+        for (size_t i = 0; i < num_frames; i++) {
+            rio_bufs[i].BufferId = bufid;
+            rio_bufs[i].Offset   = (ULONG)(static_cast<char*>(pool->at(i)) - base);
+            rio_bufs[i].Length   = (ULONG)frame_size;
+        }
+        return bufid;
+    };
+
+    _recv_bufid = register_pool(
+        _recv_memory_pool, params.num_recv_frames, params.recv_frame_size, _recv_rio_bufs);
+    _send_bufid = register_pool(
+        _send_memory_pool, params.num_send_frames, params.send_frame_size, _send_rio_bufs);
+
+    // Keep a receive posted for every frame buffer so packets land in
+    // user memory without a syscall on the fast path
+    for (auto& buff : _recv_buffs) {
+        post_recv(&buff);
+    }
+
+    auto info   = udp_rio_adapter_info(addr);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("UDP") << boost::format("Created RIO UDP link to %s:%s") % addr
+                                   % port;
+}
+
+udp_rio_link::~udp_rio_link()
+{
+    // Closing the socket cancels the posted receives and any sends
+    // still in flight; the queues go away with it
+    closesocket(_socket);
+    if (_recv_cq != RIO_INVALID_CQ) {
+        _rio.RIOCloseCompletionQueue(_recv_cq);
+    }
+    if (_send_cq != RIO_INVALID_CQ) {
+        _rio.RIOCloseCompletionQueue(_send_cq);
+    }
+    if (_recv_bufid != RIO_INVALID_BUFFERID) {
+        _rio.RIODeregisterBuffer(_recv_bufid);
+    }
+    if (_send_bufid != RIO_INVALID_BUFFERID) {
+        _rio.RIODeregisterBuffer(_send_bufid);
+    }
+}
+
+void udp_rio_link::post_recv(udp_rio_frame_buff* buff)
+{
+    rq_lock_guard lock(_rq_flag);
+    if (not _rio.RIOReceive(_rq, &_recv_rio_bufs[buff->get_index()], 1, 0, buff)) {
+        const DWORD error = WSAGetLastError();
+        throw uhd::io_error(
+            str(boost::format("RIOReceive() failed with error %d") % error));
+    }
+}
+
+bool udp_rio_link::dequeue_recv_completions()
+{
+    RIORESULT results[RIO_DEQUEUE_BATCH_SIZE];
+    const ULONG count =
+        _rio.RIODequeueCompletion(_recv_cq, results, RIO_DEQUEUE_BATCH_SIZE);
+    if (count == RIO_CORRUPT_CQ) {
+        throw uhd::io_error("RIODequeueCompletion() reported a corrupt recv queue");
+    }
+
+    for (ULONG i = 0; i < count; i++) {
+        auto* buff =
+            reinterpret_cast<udp_rio_frame_buff*>(results[i].RequestContext);
+        if (results[i].Status != 0) {
+            // repost rather than leak the frame, then report the error
+            post_recv(buff);
+            throw uhd::io_error(str(
+                boost::format("RIO recv completion failed with status %d")
+                % results[i].Status));
+        }
+        buff->set_packet_size(results[i].BytesTransferred);
+        _recv_pending.push_back(buff);
+    }
+    return count != 0;
+}
+
+frame_buff::uptr udp_rio_link::get_recv_buff(int32_t timeout_ms)
+{
+    if (_recv_pending_head == _recv_pending.size()) {
+        _recv_pending.clear();
+        _recv_pending_head = 0;
+
+        if (not dequeue_recv_completions()) {
+            if (timeout_ms == 0) {
+                return frame_buff::uptr();
+            }
+            // Completions are polled: spin briefly for low latency, then
+            // sleep in 1 ms steps so an idle link does not pin a core
+            const auto end_time = std::chrono::steady_clock::now()
+                                  + std::chrono::milliseconds(timeout_ms);
+            size_t spins = 0;
+            while (not dequeue_recv_completions()) {
+                if (timeout_ms > 0 and std::chrono::steady_clock::now() > end_time) {
+                    return frame_buff::uptr();
+                }
+                if (++spins > RIO_RECV_SPIN_COUNT) {
+                    Sleep(1);
+                }
+            }
+        }
+    }
+
+    frame_buff* buff = _recv_pending[_recv_pending_head++];
+    return frame_buff::uptr(buff);
+}
+
+void udp_rio_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    buff_ptr->set_packet_size(0);
+    post_recv(static_cast<udp_rio_frame_buff*>(buff_ptr));
+}
+
+void udp_rio_link::reap_send_completions()
+{
+    RIORESULT results[RIO_DEQUEUE_BATCH_SIZE];
+    ULONG count;
+    while ((count = _rio.RIODequeueCompletion(
+                _send_cq, results, RIO_DEQUEUE_BATCH_SIZE))
+           != 0) {
+        if (count == RIO_CORRUPT_CQ) {
+            throw uhd::io_error("RIODequeueCompletion() reported a corrupt send queue");
+        }
+        for (ULONG i = 0; i < count; i++) {
+            auto* buff =
+                reinterpret_cast<udp_rio_frame_buff*>(results[i].RequestContext);
+            buff->set_packet_size(0);
+            _send_free.push_back(buff);
+            _sends_in_flight--;
+
+            if (results[i].Status != 0) {
+                throw uhd::io_error(str(
+                    boost::format("RIO send completion failed with status %d")
+                    % results[i].Status));
+            }
+        }
+    }
+}
+
+frame_buff::uptr udp_rio_link::get_send_buff(int32_t timeout_ms)
+{
+    if (_send_free.empty()) {
+        reap_send_completions();
+        if (_send_free.empty() and timeout_ms != 0 and _sends_in_flight > 0) {
+            const auto end_time = std::chrono::steady_clock::now()
+                                  + std::chrono::milliseconds(timeout_ms);
+            size_t spins = 0;
+            while (_send_free.empty()) {
+                if (timeout_ms > 0 and std::chrono::steady_clock::now() > end_time) {
+                    break;
+                }
+                if (++spins > RIO_RECV_SPIN_COUNT) {
+                    Sleep(1);
+                }
+                reap_send_completions();
+            }
+        }
+        if (_send_free.empty()) {
+            return frame_buff::uptr();
+        }
+    }
+
+    frame_buff* buff = _send_free.back();
+    _send_free.pop_back();
+    return frame_buff::uptr(buff);
+}
+
+void udp_rio_link::release_send_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    if (buff_ptr->packet_size() == 0) {
+        _send_free.push_back(buff_ptr);
+        return;
+    }
+
+    auto* rio_buff    = static_cast<udp_rio_frame_buff*>(buff_ptr);
+    RIO_BUF& send_buf = _send_rio_bufs[rio_buff->get_index()];
+    send_buf.Length   = (ULONG)rio_buff->packet_size();
+    {
+        rq_lock_guard lock(_rq_flag);
+        if (not _rio.RIOSend(_rq, &send_buf, 1, 0, rio_buff)) {
+            const DWORD error = WSAGetLastError();
+            throw uhd::io_error(
+                str(boost::format("RIOSend() failed with error %d") % error));
+        }
+    }
+    _sends_in_flight++;
+
+    // opportunistically harvest finished sends to keep the completion
+    // queue shallow
+    reap_send_completions();
+}
+
+udp_rio_link::sptr udp_rio_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    size_t& recv_socket_buff_size,
+    size_t& send_socket_buff_size)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    UHD_ASSERT_THROW(params.recv_buff_size != 0);
+    UHD_ASSERT_THROW(params.send_buff_size != 0);
+
+    udp_rio_link::sptr link(new udp_rio_link(addr, port, params));
+
+    // resize the socket buffers and read back what the OS granted
+    auto resize_buff = [&link](int opt, size_t num_bytes) -> size_t {
+        const int request = (int)num_bytes;
+        setsockopt(
+            link->_socket, SOL_SOCKET, opt, (const char*)&request, sizeof(request));
+        int actual  = 0;
+        int opt_len = sizeof(actual);
+        getsockopt(link->_socket, SOL_SOCKET, opt, (char*)&actual, &opt_len);
+        return (size_t)actual;
+    };
+
+    recv_socket_buff_size = resize_buff(SO_RCVBUF, params.recv_buff_size);
+    send_socket_buff_size = resize_buff(SO_SNDBUF, params.send_buff_size);
+
+    if (recv_socket_buff_size < params.recv_buff_size) {
+        UHD_LOG_WARNING("UDP",
+            "The recv buffer could not be resized sufficiently. "
+            "Requested "
+                << params.recv_buff_size << " bytes, got " << recv_socket_buff_size
+                << " bytes. This may result in dropped packets.");
+    }
+    if (send_socket_buff_size < params.send_buff_size) {
+        UHD_LOG_WARNING("UDP",
+            "The send buffer could not be resized sufficiently. "
+            "Requested "
+                << params.send_buff_size << " bytes, got " << send_socket_buff_size
+                << " bytes. This may result in dropped packets.");
+    }
+
+    return link;
+}
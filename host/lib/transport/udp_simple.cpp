@@ -9,6 +9,8 @@
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <boost/format.hpp>
+#include <map>
+#include <mutex>
 
 using namespace uhd::transport;
 namespace asio = boost::asio;
@@ -92,6 +94,30 @@ udp_simple::sptr udp_simple::make_connected(
     return sptr(new udp_simple_impl(addr, port, false, true /* no bcast, connect */));
 }
 
+udp_simple::sptr udp_simple::make_connected_pooled(
+    const std::string& addr, const std::string& port)
+{
+    // Keyed weak_ptr pool, same pattern as rpc_client::make_pooled: the pool
+    // does not keep sockets alive by itself, it only re-issues ones that are
+    // still referenced somewhere (e.g. a session re-using the warm socket
+    // left over from discovery). Broadcast sockets are deliberately not
+    // pooled: concurrent discoveries sharing one socket would steal each
+    // other's replies.
+    static std::mutex pool_mutex;
+    static std::map<std::string, std::weak_ptr<udp_simple>> pool;
+    const std::string key = addr + ":" + port;
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto pool_iter = pool.find(key);
+    if (pool_iter != pool.end()) {
+        if (sptr pooled_xport = pool_iter->second.lock()) {
+            return pooled_xport;
+        }
+    }
+    sptr new_xport = make_connected(addr, port);
+    pool[key]      = new_xport;
+    return new_xport;
+}
+
 udp_simple::sptr udp_simple::make_broadcast(
     const std::string& addr, const std::string& port)
 {
@@ -0,0 +1,339 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_uring_link.hpp>
+#include <boost/format.hpp>
+#include <cassert>
+#include <cstring>
+
+using namespace uhd::transport;
+
+namespace asio = boost::asio;
+
+namespace {
+
+//! Idle time in ms before a SQPOLL kernel thread goes to sleep
+constexpr unsigned SQPOLL_IDLE_MS = 100;
+
+::__kernel_timespec to_kernel_timespec(const int32_t timeout_ms)
+{
+    ::__kernel_timespec ts;
+    ts.tv_sec  = timeout_ms / 1000;
+    ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+    return ts;
+}
+
+} // namespace
+
+udp_uring_link::udp_uring_link(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const bool use_sqpoll)
+    : _num_recv_frames(params.num_recv_frames)
+    , _recv_frame_size(params.recv_frame_size)
+    , _num_send_frames(params.num_send_frames)
+    , _send_frame_size(params.send_frame_size)
+    , _recv_memory_pool(make_recv_buff_pool(params))
+    , _send_memory_pool(make_send_buff_pool(params))
+{
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        _recv_buffs.push_back(udp_uring_frame_buff(_recv_memory_pool->at(i), i));
+    }
+
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        _send_buffs.push_back(udp_uring_frame_buff(_send_memory_pool->at(i), i));
+    }
+
+    for (auto& buff : _send_buffs) {
+        _send_free.push_back(&buff);
+    }
+
+    // create, open, and connect the socket
+    _socket  = open_udp_socket(addr, port, _io_service);
+    _sock_fd = _socket->native_handle();
+
+    // One ring per direction so that the recv and send threads never
+    // contend on a submission queue.
+    setup_ring(_recv_ring, params.num_recv_frames, use_sqpoll);
+    setup_ring(_send_ring, params.num_send_frames, use_sqpoll);
+
+    // Pin the frame buffers in the kernel so each transfer skips the
+    // per-syscall get_user_pages work
+    std::vector<::iovec> recv_iovs(params.num_recv_frames);
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        recv_iovs[i].iov_base = _recv_buffs[i].data();
+        recv_iovs[i].iov_len  = params.recv_frame_size;
+    }
+    int ret = ::io_uring_register_buffers(
+        &_recv_ring, recv_iovs.data(), params.num_recv_frames);
+    if (ret < 0) {
+        throw uhd::io_error(str(
+            boost::format("io_uring_register_buffers (recv): %s") % strerror(-ret)));
+    }
+
+    std::vector<::iovec> send_iovs(params.num_send_frames);
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        send_iovs[i].iov_base = _send_buffs[i].data();
+        send_iovs[i].iov_len  = params.send_frame_size;
+    }
+    ret = ::io_uring_register_buffers(
+        &_send_ring, send_iovs.data(), params.num_send_frames);
+    if (ret < 0) {
+        throw uhd::io_error(str(
+            boost::format("io_uring_register_buffers (send): %s") % strerror(-ret)));
+    }
+
+    // Keep a receive posted for every frame buffer so packets land in
+    // user memory without a recv syscall on the fast path
+    for (auto& buff : _recv_buffs) {
+        post_recv(&buff);
+    }
+
+    auto info   = udp_boost_asio_adapter_info(*_socket);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("UDP") << boost::format("Created io_uring UDP link to %s:%s")
+                                   % addr % port;
+}
+
+udp_uring_link::~udp_uring_link()
+{
+    // Tearing down the rings cancels the posted receives and reaps any
+    // sends still in flight
+    ::io_uring_queue_exit(&_recv_ring);
+    ::io_uring_queue_exit(&_send_ring);
+}
+
+void udp_uring_link::setup_ring(
+    ::io_uring& ring, const size_t num_entries, const bool use_sqpoll)
+{
+    ::io_uring_params uring_params;
+    std::memset(&uring_params, 0, sizeof(uring_params));
+    if (use_sqpoll) {
+        uring_params.flags          = IORING_SETUP_SQPOLL;
+        uring_params.sq_thread_idle = SQPOLL_IDLE_MS;
+    }
+
+    int ret = ::io_uring_queue_init_params(num_entries, &ring, &uring_params);
+    if (ret < 0 and use_sqpoll) {
+        // SQPOLL needs a recent kernel and, before 5.11, CAP_SYS_NICE;
+        // degrade to a plain ring rather than failing the link
+        UHD_LOG_WARNING("UDP",
+            "Could not enable io_uring submission polling ("
+                << strerror(-ret) << "), continuing without SQPOLL");
+        std::memset(&uring_params, 0, sizeof(uring_params));
+        ret = ::io_uring_queue_init_params(num_entries, &ring, &uring_params);
+    }
+    if (ret < 0) {
+        throw uhd::io_error(
+            str(boost::format("io_uring_queue_init: %s") % strerror(-ret)));
+    }
+}
+
+void udp_uring_link::post_recv(udp_uring_frame_buff* buff)
+{
+    ::io_uring_sqe* sqe = ::io_uring_get_sqe(&_recv_ring);
+    if (not sqe) {
+        // cannot happen with one SQE per frame buffer, but do not leak
+        // the frame if a future change breaks that invariant
+        ::io_uring_submit(&_recv_ring);
+        sqe = ::io_uring_get_sqe(&_recv_ring);
+        UHD_ASSERT_THROW(sqe);
+    }
+    ::io_uring_prep_read_fixed(
+        sqe, _sock_fd, buff->data(), _recv_frame_size, 0, buff->get_index());
+    ::io_uring_sqe_set_data(sqe, buff);
+    ::io_uring_submit(&_recv_ring);
+}
+
+frame_buff::uptr udp_uring_link::get_recv_buff(int32_t timeout_ms)
+{
+    ::io_uring_cqe* cqe = nullptr;
+
+    int ret = ::io_uring_peek_cqe(&_recv_ring, &cqe);
+    if (ret == -EAGAIN) {
+        if (timeout_ms == 0) {
+            return frame_buff::uptr();
+        }
+        if (timeout_ms < 0) {
+            ret = ::io_uring_wait_cqe(&_recv_ring, &cqe);
+        } else {
+            auto ts = to_kernel_timespec(timeout_ms);
+            ret     = ::io_uring_wait_cqe_timeout(&_recv_ring, &cqe, &ts);
+        }
+        if (ret == -ETIME or ret == -EAGAIN) {
+            return frame_buff::uptr();
+        }
+    }
+    if (ret < 0) {
+        throw uhd::io_error(
+            str(boost::format("io_uring recv wait: %s") % strerror(-ret)));
+    }
+
+    auto* buff = static_cast<udp_uring_frame_buff*>(::io_uring_cqe_get_data(cqe));
+    const int res = cqe->res;
+    ::io_uring_cqe_seen(&_recv_ring, cqe);
+
+    if (res < 0) {
+        post_recv(buff);
+        throw uhd::io_error(
+            str(boost::format("io_uring recv completion: %s") % strerror(-res)));
+    }
+
+    buff->set_packet_size(res);
+    return frame_buff::uptr(buff);
+}
+
+void udp_uring_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    buff_ptr->set_packet_size(0);
+    post_recv(static_cast<udp_uring_frame_buff*>(buff_ptr));
+}
+
+frame_buff::uptr udp_uring_link::get_send_buff(int32_t timeout_ms)
+{
+    if (_send_free.empty()) {
+        reap_send_completions(timeout_ms);
+        if (_send_free.empty()) {
+            return frame_buff::uptr();
+        }
+    }
+
+    frame_buff* buff = _send_free.back();
+    _send_free.pop_back();
+    return frame_buff::uptr(buff);
+}
+
+void udp_uring_link::release_send_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    if (buff_ptr->packet_size() == 0) {
+        _send_free.push_back(buff_ptr);
+        return;
+    }
+
+    auto* uring_buff    = static_cast<udp_uring_frame_buff*>(buff_ptr);
+    ::io_uring_sqe* sqe = ::io_uring_get_sqe(&_send_ring);
+    if (not sqe) {
+        ::io_uring_submit(&_send_ring);
+        sqe = ::io_uring_get_sqe(&_send_ring);
+        UHD_ASSERT_THROW(sqe);
+    }
+    ::io_uring_prep_write_fixed(sqe,
+        _sock_fd,
+        uring_buff->data(),
+        uring_buff->packet_size(),
+        0,
+        uring_buff->get_index());
+    ::io_uring_sqe_set_data(sqe, uring_buff);
+    ::io_uring_submit(&_send_ring);
+    _sends_in_flight++;
+
+    // opportunistically harvest finished sends to keep the completion
+    // queue shallow
+    reap_send_completions(0);
+}
+
+void udp_uring_link::reap_send_completions(int32_t timeout_ms)
+{
+    ::io_uring_cqe* cqe = nullptr;
+
+    if (timeout_ms != 0 and _sends_in_flight > 0) {
+        int ret;
+        if (timeout_ms < 0) {
+            ret = ::io_uring_wait_cqe(&_send_ring, &cqe);
+        } else {
+            auto ts = to_kernel_timespec(timeout_ms);
+            ret     = ::io_uring_wait_cqe_timeout(&_send_ring, &cqe, &ts);
+        }
+        if (ret < 0 and ret != -ETIME and ret != -EAGAIN) {
+            throw uhd::io_error(
+                str(boost::format("io_uring send wait: %s") % strerror(-ret)));
+        }
+    }
+
+    while (::io_uring_peek_cqe(&_send_ring, &cqe) == 0) {
+        auto* buff    = static_cast<udp_uring_frame_buff*>(::io_uring_cqe_get_data(cqe));
+        const int res = cqe->res;
+        ::io_uring_cqe_seen(&_send_ring, cqe);
+
+        buff->set_packet_size(0);
+        _send_free.push_back(buff);
+        _sends_in_flight--;
+
+        if (res < 0) {
+            throw uhd::io_error(
+                str(boost::format("io_uring send completion: %s") % strerror(-res)));
+        }
+    }
+}
+
+size_t udp_uring_link::resize_recv_socket_buffer(size_t num_bytes)
+{
+    return resize_udp_socket_buffer<asio::socket_base::receive_buffer_size>(
+        _socket, num_bytes);
+}
+
+size_t udp_uring_link::resize_send_socket_buffer(size_t num_bytes)
+{
+    return resize_udp_socket_buffer<asio::socket_base::send_buffer_size>(
+        _socket, num_bytes);
+}
+
+udp_uring_link::sptr udp_uring_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const bool use_sqpoll,
+    size_t& recv_socket_buff_size,
+    size_t& send_socket_buff_size)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    UHD_ASSERT_THROW(params.recv_buff_size != 0);
+    UHD_ASSERT_THROW(params.send_buff_size != 0);
+
+    udp_uring_link::sptr link(new udp_uring_link(addr, port, params, use_sqpoll));
+
+    // call the helper to resize send and recv buffers
+
+    recv_socket_buff_size = resize_udp_socket_buffer_with_warning(
+        [link](size_t size) { return link->resize_recv_socket_buffer(size); },
+        params.recv_buff_size,
+        "recv");
+    send_socket_buff_size = resize_udp_socket_buffer_with_warning(
+        [link](size_t size) { return link->resize_send_socket_buffer(size); },
+        params.send_buff_size,
+        "send");
+
+    if (recv_socket_buff_size < params.num_recv_frames * MAX_ETHERNET_MTU) {
+        UHD_LOG_WARNING("UDP",
+            "The current recv_buff_size of "
+                << params.recv_buff_size
+                << " is less than the minimum recommended size of "
+                << params.num_recv_frames * MAX_ETHERNET_MTU
+                << " and may result in dropped packets on some NICs");
+    }
+    if (send_socket_buff_size < params.num_send_frames * MAX_ETHERNET_MTU) {
+        UHD_LOG_WARNING("UDP",
+            "The current send_buff_size of "
+                << params.send_buff_size
+                << " is less than the minimum recommended size of "
+                << params.num_send_frames * MAX_ETHERNET_MTU
+                << " and may result in dropped packets on some NICs");
+    }
+
+    return link;
+}
@@ -15,6 +15,10 @@
 #include <memory>
 #include <thread>
 #include <vector>
+#if defined(UHD_PLATFORM_LINUX)
+#    include <cstring>
+#    include <sys/socket.h>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -87,6 +91,30 @@ public:
         return sptr(); // null for timeout
     }
 
+#if defined(UHD_PLATFORM_LINUX)
+    // Hooks for the batched recv path, which claims buffers and performs the
+    // socket operation in the transport instead of in this class
+    UHD_INLINE bool claim(const double timeout)
+    {
+        return _claimer.claim_with_wait(timeout);
+    }
+
+    UHD_INLINE void unclaim(void)
+    {
+        _claimer.release();
+    }
+
+    UHD_INLINE void* get_mem(void)
+    {
+        return _mem;
+    }
+
+    UHD_INLINE sptr make_filled(const size_t len)
+    {
+        return make(this, _mem, len);
+    }
+#endif
+
 private:
     void* _mem;
     int _sock_fd;
@@ -178,6 +206,18 @@ public:
             _msb_pool.push_back(std::make_shared<udp_zero_copy_asio_msb>(
                 _send_buffer_pool->at(i), _sock_fd, get_send_frame_size()));
         }
+
+#if defined(UHD_PLATFORM_LINUX)
+        _batch_mrbs.reserve(RECV_BATCH_SIZE);
+        _batch_lens.reserve(RECV_BATCH_SIZE);
+        _msgs.resize(RECV_BATCH_SIZE);
+        _iovs.resize(RECV_BATCH_SIZE);
+        for (size_t i = 0; i < RECV_BATCH_SIZE; i++) {
+            std::memset(&_msgs[i], 0, sizeof(_msgs[i]));
+            _msgs[i].msg_hdr.msg_iov    = &_iovs[i];
+            _msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+#endif
     }
 
     size_t resize_send_socket_buffer(size_t num_bytes)
@@ -194,14 +234,28 @@ public:
 
     /*******************************************************************
      * Receive implementation:
-     * Block on the managed buffer's get call and advance the index.
+     * On Linux, one recvmmsg syscall fills as many free buffers as are
+     * claimable, and the filled buffers are then handed out one at a
+     * time. Elsewhere, block on the managed buffer's get call and
+     * advance the index.
      ******************************************************************/
+#if defined(UHD_PLATFORM_LINUX)
+    managed_recv_buffer::sptr get_recv_buff(double timeout)
+    {
+        if (_batch_head == _batch_mrbs.size() and not fill_recv_batch(timeout)) {
+            return managed_recv_buffer::sptr();
+        }
+        udp_zero_copy_asio_mrb* mrb = _batch_mrbs[_batch_head];
+        return mrb->make_filled(_batch_lens[_batch_head++]);
+    }
+#else
     managed_recv_buffer::sptr get_recv_buff(double timeout)
     {
         if (_next_recv_buff_index == _num_recv_frames)
             _next_recv_buff_index = 0;
         return _mrb_pool[_next_recv_buff_index]->get_new(timeout, _next_recv_buff_index);
     }
+#endif
 
     size_t get_num_recv_frames(void) const
     {
@@ -243,6 +297,92 @@ public:
     }
 
 private:
+#if defined(UHD_PLATFORM_LINUX)
+    //! Maximum number of packets pulled in with one recvmmsg call
+    static constexpr size_t RECV_BATCH_SIZE = 16;
+
+    //! Step the recv ring index back after recvmmsg filled fewer buffers
+    //! than were claimed, so the claim order stays aligned with the ring
+    UHD_INLINE void rewind_recv_index(const size_t count)
+    {
+        _next_recv_buff_index =
+            (_next_recv_buff_index + _num_recv_frames - count) % _num_recv_frames;
+    }
+
+    //! Claim the next free buffers in ring order and fill them with one
+    //! recvmmsg syscall
+    bool fill_recv_batch(const double timeout)
+    {
+        _batch_mrbs.clear();
+        _batch_lens.clear();
+        _batch_head = 0;
+
+        // claim the next buffer in ring order, waiting up to the caller's
+        // timeout, then opportunistically claim more for the same syscall
+        while (_batch_mrbs.size() < RECV_BATCH_SIZE) {
+            if (_next_recv_buff_index == _num_recv_frames)
+                _next_recv_buff_index = 0;
+            udp_zero_copy_asio_mrb* mrb = _mrb_pool[_next_recv_buff_index].get();
+            if (not mrb->claim(_batch_mrbs.empty() ? timeout : 0.0)) {
+                if (_batch_mrbs.empty())
+                    return false; // timed out waiting for a free buffer
+                break;
+            }
+            _next_recv_buff_index++;
+            _iovs[_batch_mrbs.size()].iov_base = mrb->get_mem();
+            _iovs[_batch_mrbs.size()].iov_len  = _recv_frame_size;
+            _batch_mrbs.push_back(mrb);
+        }
+        const size_t nbuffs = _batch_mrbs.size();
+
+        // try a non-blocking batched recv first, then wait and retry
+        int num_received = ::recvmmsg(_sock_fd, _msgs.data(), nbuffs, MSG_DONTWAIT, NULL);
+        if (num_received < 0 and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+            const int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
+            if (wait_for_recv_ready(_sock_fd, timeout_ms)) {
+                num_received =
+                    ::recvmmsg(_sock_fd, _msgs.data(), nbuffs, MSG_DONTWAIT, NULL);
+            } else {
+                num_received = 0; // timeout
+            }
+        }
+        if (num_received < 0 and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+            num_received = 0; // spurious wakeup
+        }
+        if (num_received < 0) {
+            // release the claimed buffers before reporting the error
+            for (udp_zero_copy_asio_mrb* mrb : _batch_mrbs) {
+                mrb->unclaim();
+            }
+            rewind_recv_index(nbuffs);
+            _batch_mrbs.clear();
+            throw uhd::io_error(
+                str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+        }
+
+        for (int i = 0; i < num_received; i++) {
+            _batch_lens.push_back(_msgs[i].msg_len);
+        }
+
+        // release the claimed buffers the syscall did not fill
+        for (size_t i = num_received; i < nbuffs; i++) {
+            _batch_mrbs[i]->unclaim();
+        }
+        rewind_recv_index(nbuffs - num_received);
+        _batch_mrbs.resize(num_received);
+
+        return num_received > 0;
+    }
+
+    // Filled-but-unclaimed buffers for the batched recv path and the
+    // scatter/gather structures reused across recvmmsg calls
+    std::vector<udp_zero_copy_asio_mrb*> _batch_mrbs;
+    std::vector<size_t> _batch_lens;
+    size_t _batch_head = 0;
+    std::vector<::mmsghdr> _msgs;
+    std::vector<::iovec> _iovs;
+#endif
+
     // memory management -> buffers and fifos
     const size_t _recv_frame_size, _num_recv_frames;
     const size_t _send_frame_size, _num_send_frames;
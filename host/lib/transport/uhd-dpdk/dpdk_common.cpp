@@ -110,6 +110,18 @@ dpdk_port::dpdk_port(port_id_t port,
         throw uhd::runtime_error("DPDK: Missing required TX offloads");
     }
 
+    // UDP checksum offloads are optional: use them when the NIC has them.
+    // Without them, packets go out with a zero (absent) UDP checksum, which
+    // IPv4 permits, so no software checksum is ever computed.
+    if (dev_info.tx_offload_capa & DEV_TX_OFFLOAD_UDP_CKSUM) {
+        tx_offloads |= DEV_TX_OFFLOAD_UDP_CKSUM;
+        _hw_udp_tx_cksum = true;
+    }
+    if (dev_info.rx_offload_capa & DEV_RX_OFFLOAD_UDP_CKSUM) {
+        rx_offloads |= DEV_RX_OFFLOAD_UDP_CKSUM;
+        _hw_udp_rx_cksum = true;
+    }
+
     // Check number of available queues
     if (dev_info.max_rx_queues < num_queues || dev_info.max_tx_queues < num_queues) {
         _num_queues = std::min(dev_info.max_rx_queues, dev_info.max_tx_queues);
@@ -124,6 +136,24 @@ dpdk_port::dpdk_port(port_id_t port,
     port_conf.rxmode.max_rx_pkt_len = _mtu;
     port_conf.txmode.offloads       = tx_offloads;
 
+    if (_num_queues > 1) {
+        // Spread flows across the RX queues by hashing the IP/UDP port
+        // tuple, so each CHDR stream (distinct UDP port pair) lands on its
+        // own queue
+        const uint64_t rss_hf = ETH_RSS_NONFRAG_IPV4_UDP
+                                & dev_info.flow_type_rss_offloads;
+        if (rss_hf) {
+            port_conf.rxmode.mq_mode              = ETH_MQ_RX_RSS;
+            port_conf.rx_adv_conf.rss_conf.rss_hf = rss_hf;
+        } else {
+            UHD_LOGGER_WARNING("DPDK")
+                << boost::format("%d: NIC does not support RSS on UDP flows, "
+                                 "falling back to a single DMA queue")
+                       % _port;
+            _num_queues = 1;
+        }
+    }
+
     retval = rte_eth_dev_configure(_port, _num_queues, _num_queues, &port_conf);
     if (retval != 0) {
         UHD_LOG_ERROR("DPDK", "Failed to configure the device");
@@ -176,7 +206,7 @@ dpdk_port::dpdk_port(port_id_t port,
         }
 
         struct rte_eth_txconf txconf = dev_info.default_txconf;
-        txconf.offloads              = DEV_TX_OFFLOAD_IPV4_CKSUM;
+        txconf.offloads              = tx_offloads;
         retval = rte_eth_tx_queue_setup(_port, i, tx_desc, cpu_socket, &txconf);
         if (retval < 0) {
             UHD_LOGGER_ERROR("DPDK")
@@ -185,8 +215,6 @@ dpdk_port::dpdk_port(port_id_t port,
         }
     }
 
-    /* TODO: Enable multiple queues (only support 1 right now) */
-
     /* Start the Ethernet device */
     retval = rte_eth_dev_start(_port);
     if (retval < 0) {
@@ -248,6 +276,14 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
     return rte_cpu_to_be_16(port_selected);
 }
 
+queue_id_t dpdk_port::alloc_queue()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const queue_id_t queue = _next_queue;
+    _next_queue            = (_next_queue + 1) % _num_queues;
+    return queue;
+}
+
 int dpdk_port::_arp_reply(queue_id_t queue_id, struct arp_hdr* arp_req)
 {
     struct rte_mbuf* mbuf;
@@ -433,8 +469,10 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             }
             /* Now combine user args with conf file */
             auto conf = uhd::prefs::get_dpdk_nic_args(nic);
-            // TODO: Enable the use of multiple DMA queues
-            conf["dpdk_num_queues"] = "1";
+            /* Multiple DMA queues (with RSS) are opt-in via dpdk_num_queues */
+            if (!conf.has_key("dpdk_num_queues")) {
+                conf["dpdk_num_queues"] = "1";
+            }
 
             /* Update config, and remove ports that aren't fully configured */
             if (conf.has_key("dpdk_ipv4")) {
@@ -457,10 +495,14 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                     lcore_to_port_id_map.insert({lcore_id, {}});
                 }
 
-                // Allocating enough buffers for all DMA queues for each CPU socket
-                // - This is a bit inefficient for larger systems, since NICs may not
-                //   all be on one socket
-                auto cpu_socket = rte_eth_dev_socket_id(i);
+                // Allocate the packet buffer pools on the NUMA node of the
+                // NIC, so mbuf access never crosses the socket interconnect.
+                // dpdk_socket overrides the PCIe-reported node if needed.
+                int cpu_socket = conf.cast<int>("dpdk_socket", rte_eth_dev_socket_id(i));
+                if (cpu_socket < 0 or cpu_socket >= (int)rte_socket_count()) {
+                    // Unknown or bogus node: fall back to the init thread's
+                    cpu_socket = (int)rte_socket_id();
+                }
                 auto rx_pool = _get_rx_pktbuf_pool(cpu_socket, _num_mbufs * queue_count);
                 auto tx_pool = _get_tx_pktbuf_pool(cpu_socket, _num_mbufs * queue_count);
                 UHD_LOG_TRACE("DPDK",
@@ -606,7 +648,7 @@ struct rte_mempool* dpdk_ctx::_get_rx_pktbuf_pool(
             _mbuf_cache_size,
             DPDK_MBUF_PRIV_SIZE,
             mbuf_size,
-            SOCKET_ID_ANY);
+            cpu_socket);
         if (!_rx_pktbuf_pools.at(cpu_socket)) {
             UHD_LOG_ERROR("DPDK", "Could not allocate RX pktbuf pool");
             throw uhd::runtime_error("DPDK: Could not allocate RX pktbuf pool");
@@ -623,7 +665,7 @@ struct rte_mempool* dpdk_ctx::_get_tx_pktbuf_pool(
         char name[32];
         snprintf(name, sizeof(name), "tx_mbuf_pool_%u", cpu_socket);
         _tx_pktbuf_pools[cpu_socket] = rte_pktmbuf_pool_create(
-            name, num_bufs, _mbuf_cache_size, 0, mbuf_size, SOCKET_ID_ANY);
+            name, num_bufs, _mbuf_cache_size, 0, mbuf_size, cpu_socket);
         if (!_tx_pktbuf_pools.at(cpu_socket)) {
             UHD_LOG_ERROR("DPDK", "Could not allocate TX pktbuf pool");
             throw uhd::runtime_error("DPDK: Could not allocate TX pktbuf pool");
@@ -229,8 +229,11 @@ send_io_if::sptr dpdk_io_service::make_send_client(send_link_if::sptr send_link,
     recv_link_if::sptr /*recv_link*/,
     size_t num_recv_frames,
     recv_callback_t recv_cb,
-    send_io_if::fc_callback_t fc_cb)
+    send_io_if::fc_callback_t fc_cb,
+    const bool /*high_priority*/)
 {
+    // Priority muxing is not implemented for the DPDK I/O service; its
+    // lcore worker drains the service queue ahead of data anyway
     auto link    = dynamic_cast<udp_dpdk_link*>(send_link.get());
     auto send_io = std::make_shared<dpdk_send_io>(shared_from_this(),
         link,
@@ -289,17 +292,41 @@ int dpdk_io_service::_io_worker(void* arg)
 
     int status = 0;
     while (!status) {
-        /* For each port, attempt to receive packets and process */
+        uint64_t pkts_moved = 0;
+        /* For each port, attempt to receive packets and process. With RSS,
+         * flows are spread across all of the port's RX queues. */
         for (auto port : srv->_ports) {
-            srv->_rx_burst(port, 0);
+            const auto num_queues = port->get_queue_count();
+            for (dpdk::queue_id_t queue = 0; queue < num_queues; queue++) {
+                const int num_rx = srv->_rx_burst(port, queue);
+                if (num_rx > 0) {
+                    srv->_stat_rx_packets.fetch_add(num_rx, std::memory_order_relaxed);
+                    srv->_stat_rx_bursts.fetch_add(1, std::memory_order_relaxed);
+                    pkts_moved += num_rx;
+                }
+            }
         }
         /* For each port's TX queues, do TX */
         for (auto port : srv->_ports) {
-            srv->_tx_burst(port);
+            const int num_tx = srv->_tx_burst(port);
+            if (num_tx > 0) {
+                srv->_stat_tx_packets.fetch_add(num_tx, std::memory_order_relaxed);
+                srv->_stat_tx_bursts.fetch_add(1, std::memory_order_relaxed);
+                pkts_moved += num_tx;
+            }
         }
         /* For each port's RX release queues, release buffers */
         for (auto port : srv->_ports) {
-            srv->_rx_release(port);
+            const int num_released = srv->_rx_release(port);
+            if (num_released > 0) {
+                pkts_moved += num_released;
+            }
+        }
+        /* Track how loaded this lcore is: an iteration that moved nothing
+         * was pure polling overhead */
+        srv->_stat_iterations.fetch_add(1, std::memory_order_relaxed);
+        if (pkts_moved > 0) {
+            srv->_stat_busy_iterations.fetch_add(1, std::memory_order_relaxed);
         }
         /* Retry waking clients */
         if (srv->_retry_head) {
@@ -322,9 +349,29 @@ int dpdk_io_service::_io_worker(void* arg)
         status = srv->_service_requests();
     }
 
+    const stats_t stats = srv->get_stats();
+    UHD_LOG_DEBUG("DPDK::IO_SERVICE",
+        "lcore " << lcore_id << " I/O worker exiting: " << stats.busy_iterations << "/"
+                 << stats.iterations << " busy iterations, " << stats.rx_packets
+                 << " pkts received in " << stats.rx_bursts << " bursts, "
+                 << stats.tx_packets << " pkts sent in " << stats.tx_bursts
+                 << " bursts");
+
     return status;
 }
 
+dpdk_io_service::stats_t dpdk_io_service::get_stats() const
+{
+    stats_t stats;
+    stats.iterations      = _stat_iterations.load(std::memory_order_relaxed);
+    stats.busy_iterations = _stat_busy_iterations.load(std::memory_order_relaxed);
+    stats.rx_packets      = _stat_rx_packets.load(std::memory_order_relaxed);
+    stats.tx_packets      = _stat_tx_packets.load(std::memory_order_relaxed);
+    stats.rx_bursts       = _stat_rx_bursts.load(std::memory_order_relaxed);
+    stats.tx_bursts       = _stat_tx_bursts.load(std::memory_order_relaxed);
+    return stats;
+}
+
 int dpdk_io_service::_service_requests()
 {
     for (int i = 0; i < MAX_PENDING_SERVICE_REQS; i++) {
@@ -680,6 +727,12 @@ int dpdk_io_service::_rx_burst(dpdk::dpdk_port* port, dpdk::queue_id_t queue)
                     UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
                 } else if ((ol_flags & PKT_RX_IP_CKSUM_MASK) == PKT_RX_IP_CKSUM_NONE) {
                     UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet missing IP cksum");
+                } else if (port->get_rx_udp_cksum_offload()
+                           && (ol_flags & PKT_RX_L4_CKSUM_MASK) == PKT_RX_L4_CKSUM_BAD) {
+                    // Only trustworthy when the port validates L4 checksums
+                    // in hardware; a zero (absent) checksum reports as NONE,
+                    // not BAD
+                    UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad UDP cksum");
                 } else {
                     _process_ipv4(port, bufs[buf], (struct ipv4_hdr*)l2_data);
                 }
@@ -0,0 +1,460 @@
+//
+// Copyright 2022 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/transport/xdp_link.hpp>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <boost/format.hpp>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+//! UMEM slot size; AF_XDP aligned mode requires a power of two <= page size
+constexpr size_t UMEM_FRAME_SIZE = XSK_UMEM__DEFAULT_FRAME_SIZE;
+
+//! Bytes of Ethernet + IPv4 + UDP header prepended to each CHDR packet
+constexpr size_t PKT_HDR_LEN = 14 + 20 + 8;
+
+size_t round_up_pow2(size_t value)
+{
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+uint16_t ipv4_checksum(const uint8_t* hdr)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < 20; i += 2) {
+        sum += (uint16_t(hdr[i]) << 8) | hdr[i + 1];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return uint16_t(~sum);
+}
+
+} // namespace
+
+xdp_link::xdp_link(const std::string& iface,
+    const size_t queue_index,
+    const std::string& remote_addr,
+    const std::string& remote_port,
+    const link_params_t& params)
+    : _num_recv_frames(params.num_recv_frames)
+    , _recv_frame_size(params.recv_frame_size)
+    , _num_send_frames(params.num_send_frames)
+    , _send_frame_size(params.send_frame_size)
+{
+    resolve_flow(iface, remote_addr, remote_port);
+
+    // One UMEM slot holds one CHDR packet plus the synthesized headers
+    // and the kernel's RX headroom; AF_XDP cannot split packets across
+    // slots, which bounds the usable MTU
+    if (params.recv_frame_size + PKT_HDR_LEN + XDP_PACKET_HEADROOM > UMEM_FRAME_SIZE
+        or params.send_frame_size + PKT_HDR_LEN > UMEM_FRAME_SIZE) {
+        throw uhd::value_error(
+            str(boost::format("XDP link frame size too large for a %d byte UMEM slot; "
+                              "reduce the MTU")
+                % UMEM_FRAME_SIZE));
+    }
+
+    const size_t num_frames = params.num_recv_frames + params.num_send_frames;
+    _umem_size              = num_frames * UMEM_FRAME_SIZE;
+    _umem_area              = ::mmap(nullptr,
+        _umem_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (_umem_area == MAP_FAILED) {
+        _umem_area = nullptr;
+        throw uhd::io_error("Could not allocate UMEM for XDP link");
+    }
+
+    ::xsk_umem_config umem_cfg;
+    std::memset(&umem_cfg, 0, sizeof(umem_cfg));
+    umem_cfg.fill_size      = round_up_pow2(params.num_recv_frames);
+    umem_cfg.comp_size      = round_up_pow2(params.num_send_frames);
+    umem_cfg.frame_size     = UMEM_FRAME_SIZE;
+    umem_cfg.frame_headroom = 0;
+
+    int ret = ::xsk_umem__create(
+        &_umem, _umem_area, _umem_size, &_fill_ring, &_comp_ring, &umem_cfg);
+    if (ret < 0) {
+        throw uhd::io_error(
+            str(boost::format("xsk_umem__create: %s") % strerror(-ret)));
+    }
+
+    ::xsk_socket_config xsk_cfg;
+    std::memset(&xsk_cfg, 0, sizeof(xsk_cfg));
+    xsk_cfg.rx_size    = round_up_pow2(params.num_recv_frames);
+    xsk_cfg.tx_size    = round_up_pow2(params.num_send_frames);
+    xsk_cfg.bind_flags = XDP_USE_NEED_WAKEUP;
+
+    ret = ::xsk_socket__create(
+        &_xsk, iface.c_str(), queue_index, _umem, &_rx_ring, &_tx_ring, &xsk_cfg);
+    if (ret < 0) {
+        throw uhd::io_error(
+            str(boost::format("xsk_socket__create on %s queue %d: %s") % iface
+                % queue_index % strerror(-ret)));
+    }
+    _xsk_fd = ::xsk_socket__fd(_xsk);
+
+    // UMEM slots [0, num_recv_frames) belong to the RX path, the rest to TX
+    build_header_template();
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        _recv_buffs.push_back(xdp_frame_buff(i));
+        refill(i);
+    }
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        const size_t index = params.num_recv_frames + i;
+        uint8_t* frame = static_cast<uint8_t*>(_umem_area) + index * UMEM_FRAME_SIZE;
+        std::memcpy(frame, _header_template.data(), PKT_HDR_LEN);
+        _send_buffs.push_back(xdp_frame_buff(index));
+        _send_buffs.back().set_data(frame + PKT_HDR_LEN);
+    }
+    for (auto& buff : _send_buffs) {
+        _send_free.push_back(&buff);
+    }
+
+    auto info   = xdp_adapter_info(iface, queue_index);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("XDP") << boost::format("Created XDP link on %s queue %d") % iface
+                                   % queue_index;
+}
+
+xdp_link::~xdp_link()
+{
+    if (_xsk) {
+        ::xsk_socket__delete(_xsk);
+    }
+    if (_umem) {
+        ::xsk_umem__delete(_umem);
+    }
+    if (_umem_area) {
+        ::munmap(_umem_area, _umem_size);
+    }
+}
+
+void xdp_link::build_header_template()
+{
+    uint8_t* hdr = _header_template.data();
+
+    // Ethernet
+    std::memcpy(hdr, _flow.remote_mac.data(), 6);
+    std::memcpy(hdr + 6, _flow.local_mac.data(), 6);
+    hdr[12] = 0x08; // IPv4
+    hdr[13] = 0x00;
+
+    // IPv4; total length and checksum are patched per packet
+    uint8_t* ip = hdr + 14;
+    std::memset(ip, 0, 20);
+    ip[0] = 0x45; // version 4, 20 byte header
+    ip[6] = 0x40; // don't fragment
+    ip[8] = 64; // TTL
+    ip[9] = 17; // UDP
+    std::memcpy(ip + 12, &_flow.local_ip, 4);
+    std::memcpy(ip + 16, &_flow.remote_ip, 4);
+
+    // UDP; length is patched per packet, checksum stays 0 (legal for IPv4)
+    uint8_t* udp = hdr + 34;
+    std::memset(udp, 0, 8);
+    std::memcpy(udp, &_flow.local_port, 2);
+    std::memcpy(udp + 2, &_flow.remote_port, 2);
+}
+
+void xdp_link::refill(const size_t frame_index)
+{
+    uint32_t idx;
+    if (::xsk_ring_prod__reserve(&_fill_ring, 1, &idx) != 1) {
+        // cannot happen: the fill ring has a slot for every recv frame
+        throw uhd::io_error("XDP link fill ring unexpectedly full");
+    }
+    *::xsk_ring_prod__fill_addr(&_fill_ring, idx) = frame_index * UMEM_FRAME_SIZE;
+    ::xsk_ring_prod__submit(&_fill_ring, 1);
+}
+
+bool xdp_link::packet_matches_flow(const uint8_t* pkt, const size_t len) const
+{
+    if (len <= PKT_HDR_LEN) {
+        return false;
+    }
+    if (pkt[12] != 0x08 or pkt[13] != 0x00) {
+        return false; // not IPv4
+    }
+    const uint8_t* ip = pkt + 14;
+    if ((ip[0] & 0xf0) != 0x40 or ip[9] != 17) {
+        return false; // not UDP over IPv4
+    }
+    if (std::memcmp(ip + 12, &_flow.remote_ip, 4) != 0
+        or std::memcmp(ip + 16, &_flow.local_ip, 4) != 0) {
+        return false;
+    }
+    const uint8_t* udp = pkt + 34;
+    return std::memcmp(udp, &_flow.remote_port, 2) == 0
+           and std::memcmp(udp + 2, &_flow.local_port, 2) == 0;
+}
+
+frame_buff::uptr xdp_link::get_recv_buff(int32_t timeout_ms)
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    while (true) {
+        uint32_t idx;
+        if (::xsk_ring_cons__peek(&_rx_ring, 1, &idx) == 0) {
+            // ring the fill doorbell if the driver went to sleep, then wait
+            if (::xsk_ring_prod__needs_wakeup(&_fill_ring)) {
+                ::recvfrom(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+            }
+            if (timeout_ms == 0) {
+                return frame_buff::uptr();
+            }
+            ::pollfd pfd;
+            pfd.fd     = _xsk_fd;
+            pfd.events = POLLIN;
+            ::poll(&pfd, 1, timeout_ms);
+            if (::xsk_ring_cons__peek(&_rx_ring, 1, &idx) == 0) {
+                return frame_buff::uptr();
+            }
+        }
+
+        const ::xdp_desc* desc = ::xsk_ring_cons__rx_desc(&_rx_ring, idx);
+        const uint64_t addr    = desc->addr;
+        const size_t len       = desc->len;
+        ::xsk_ring_cons__release(&_rx_ring, 1);
+
+        const size_t frame_index = addr / UMEM_FRAME_SIZE;
+        uint8_t* pkt = static_cast<uint8_t*>(::xsk_umem__get_data(_umem_area, addr));
+
+        if (not packet_matches_flow(pkt, len)) {
+            // Traffic that slipped onto our queue despite flow steering;
+            // we cannot reinject it into the stack, so drop and recycle
+            refill(frame_index);
+            if (timeout_ms >= 0 and std::chrono::steady_clock::now() > deadline) {
+                return frame_buff::uptr();
+            }
+            continue;
+        }
+
+        xdp_frame_buff* buff = &_recv_buffs[frame_index];
+        buff->set_data(pkt + PKT_HDR_LEN);
+        buff->set_packet_size(len - PKT_HDR_LEN);
+        return frame_buff::uptr(buff);
+    }
+}
+
+void xdp_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    buff_ptr->set_packet_size(0);
+    refill(static_cast<xdp_frame_buff*>(buff_ptr)->get_index());
+}
+
+frame_buff::uptr xdp_link::get_send_buff(int32_t timeout_ms)
+{
+    reap_tx_completions();
+
+    if (_send_free.empty() and timeout_ms != 0) {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (_send_free.empty()) {
+            kick_tx();
+            ::pollfd pfd;
+            pfd.fd     = _xsk_fd;
+            pfd.events = POLLOUT;
+            ::poll(&pfd, 1, 1);
+            reap_tx_completions();
+            if (timeout_ms >= 0 and std::chrono::steady_clock::now() > deadline) {
+                break;
+            }
+        }
+    }
+
+    if (_send_free.empty()) {
+        return frame_buff::uptr();
+    }
+
+    frame_buff* buff = _send_free.back();
+    _send_free.pop_back();
+    return frame_buff::uptr(buff);
+}
+
+void xdp_link::release_send_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    if (buff_ptr->packet_size() == 0) {
+        _send_free.push_back(buff_ptr);
+        return;
+    }
+
+    auto* xdp_buff     = static_cast<xdp_frame_buff*>(buff_ptr);
+    const size_t index = xdp_buff->get_index();
+    uint8_t* frame = static_cast<uint8_t*>(_umem_area) + index * UMEM_FRAME_SIZE;
+
+    // patch the per-packet header fields
+    const size_t payload_len = buff_ptr->packet_size();
+    uint8_t* ip              = frame + 14;
+    const uint16_t ip_len    = uint16_t(20 + 8 + payload_len);
+    ip[2]                    = uint8_t(ip_len >> 8);
+    ip[3]                    = uint8_t(ip_len & 0xff);
+    ip[10]                   = 0;
+    ip[11]                   = 0;
+    const uint16_t ip_csum   = ipv4_checksum(ip);
+    ip[10]                   = uint8_t(ip_csum >> 8);
+    ip[11]                   = uint8_t(ip_csum & 0xff);
+    uint8_t* udp             = frame + 34;
+    const uint16_t udp_len   = uint16_t(8 + payload_len);
+    udp[4]                   = uint8_t(udp_len >> 8);
+    udp[5]                   = uint8_t(udp_len & 0xff);
+
+    uint32_t idx;
+    while (::xsk_ring_prod__reserve(&_tx_ring, 1, &idx) != 1) {
+        // TX ring full; wait for the kernel to drain it
+        kick_tx();
+        reap_tx_completions();
+    }
+    ::xdp_desc* desc = ::xsk_ring_prod__tx_desc(&_tx_ring, idx);
+    desc->addr       = index * UMEM_FRAME_SIZE;
+    desc->len        = PKT_HDR_LEN + payload_len;
+    ::xsk_ring_prod__submit(&_tx_ring, 1);
+    kick_tx();
+
+    reap_tx_completions();
+}
+
+void xdp_link::reap_tx_completions()
+{
+    uint32_t idx;
+    const size_t num_completed =
+        ::xsk_ring_cons__peek(&_comp_ring, _num_send_frames, &idx);
+    for (size_t i = 0; i < num_completed; i++) {
+        const uint64_t addr      = *::xsk_ring_cons__comp_addr(&_comp_ring, idx + i);
+        const size_t frame_index = addr / UMEM_FRAME_SIZE;
+        xdp_frame_buff* buff     = &_send_buffs[frame_index - _num_recv_frames];
+        buff->set_packet_size(0);
+        _send_free.push_back(buff);
+    }
+    if (num_completed > 0) {
+        ::xsk_ring_cons__release(&_comp_ring, num_completed);
+    }
+}
+
+void xdp_link::kick_tx()
+{
+    if (::xsk_ring_prod__needs_wakeup(&_tx_ring)) {
+        ::sendto(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+    }
+}
+
+void xdp_link::resolve_flow(const std::string& iface,
+    const std::string& remote_addr,
+    const std::string& remote_port)
+{
+    // A connected UDP socket yields the local IP and reserves a local
+    // port; it stays open for the lifetime of the link so the port
+    // remains ours and the kernel keeps the ARP entry alive
+    _ctrl_socket = open_udp_socket(remote_addr, remote_port, _io_service);
+
+    const auto local_ep        = _ctrl_socket->local_endpoint();
+    const auto remote_ep       = _ctrl_socket->remote_endpoint();
+    const auto local_ip_bytes  = local_ep.address().to_v4().to_bytes();
+    const auto remote_ip_bytes = remote_ep.address().to_v4().to_bytes();
+    std::memcpy(&_flow.local_ip, local_ip_bytes.data(), 4);
+    std::memcpy(&_flow.remote_ip, remote_ip_bytes.data(), 4);
+    _flow.local_port  = htons(local_ep.port());
+    _flow.remote_port = htons(remote_ep.port());
+
+    // Local MAC from the interface
+    ::ifreq ifr;
+    std::memset(&ifr, 0, sizeof(ifr));
+    std::strncpy(ifr.ifr_name, iface.c_str(), IFNAMSIZ - 1);
+    if (::ioctl(_ctrl_socket->native_handle(), SIOCGIFHWADDR, &ifr) < 0) {
+        throw uhd::io_error(
+            str(boost::format("Could not read MAC address of %s") % iface));
+    }
+    std::memcpy(_flow.local_mac.data(), ifr.ifr_hwaddr.sa_data, 6);
+
+    // Remote MAC from the ARP table; a zero-length datagram prods the
+    // kernel into resolving the entry if it is not there yet
+    const std::string remote_ip_str = remote_ep.address().to_string();
+    bool resolved                   = false;
+    for (size_t attempt = 0; attempt < 50 and not resolved; attempt++) {
+        ::send(_ctrl_socket->native_handle(), nullptr, 0, 0);
+        std::ifstream arp("/proc/net/arp");
+        std::string line;
+        std::getline(arp, line); // header
+        while (std::getline(arp, line)) {
+            std::istringstream iss(line);
+            std::string ip, hw_type, flags, mac;
+            iss >> ip >> hw_type >> flags >> mac;
+            if (ip == remote_ip_str and flags != "0x0") {
+                unsigned int mac_bytes[6];
+                if (std::sscanf(mac.c_str(),
+                        "%x:%x:%x:%x:%x:%x",
+                        &mac_bytes[0],
+                        &mac_bytes[1],
+                        &mac_bytes[2],
+                        &mac_bytes[3],
+                        &mac_bytes[4],
+                        &mac_bytes[5])
+                    == 6) {
+                    for (size_t i = 0; i < 6; i++) {
+                        _flow.remote_mac[i] = uint8_t(mac_bytes[i]);
+                    }
+                    resolved = true;
+                }
+                break;
+            }
+        }
+        if (not resolved) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    if (not resolved) {
+        throw uhd::lookup_error(
+            str(boost::format("Could not resolve MAC address of %s") % remote_ip_str));
+    }
+}
+
+xdp_link::sptr xdp_link::make(const std::string& iface,
+    const size_t queue_index,
+    const std::string& remote_addr,
+    const std::string& remote_port,
+    const link_params_t& params)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+
+    return xdp_link::sptr(
+        new xdp_link(iface, queue_index, remote_addr, remote_port, params));
+}
@@ -5,198 +5,72 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
-#include <uhd/transport/bounded_buffer.hpp>
-#include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/zero_copy_flow_ctrl.hpp>
 #include <uhd/utils/log.hpp>
-#include <uhd/utils/safe_call.hpp>
-#include <boost/format.hpp>
-#include <boost/thread/mutex.hpp>
-#include <boost/thread/thread.hpp>
-#include <functional>
+#include <uhdlib/transport/zero_copy_flow_ctrl.hpp>
 #include <memory>
 
 using namespace uhd;
 using namespace uhd::transport;
 
-typedef bounded_buffer<managed_send_buffer::sptr> bounded_buffer_t;
+/***********************************************************************
+ * Policies adapting the type-erased flow_ctrl_func interface onto the
+ * templated layer. Callers with a concrete flow control type should use
+ * uhdlib/transport/zero_copy_flow_ctrl.hpp directly so the hooks inline.
+ **********************************************************************/
+namespace {
 
-class zero_copy_flow_ctrl_msb : public managed_send_buffer
+struct fn_send_flow_ctrl_t
 {
-public:
-    zero_copy_flow_ctrl_msb(flow_ctrl_func flow_ctrl)
-        : _mb(nullptr), _flow_ctrl(flow_ctrl)
-    {
-        /* NOP */
-    }
-
-    ~zero_copy_flow_ctrl_msb()
-    {
-        /* NOP */
-    }
-
-    void release()
+    static const bool enabled          = true;
+    static const bool has_release_hook = true;
+    fn_send_flow_ctrl_t(flow_ctrl_func flow_ctrl) : _flow_ctrl(flow_ctrl) {}
+    bool wait_for_send(double)
     {
-        if (_mb) {
-            _mb->commit(size());
-            while (_flow_ctrl and not _flow_ctrl(_mb)) {
-            }
-            _mb.reset();
-        }
+        return true;
     }
-
-    UHD_INLINE sptr get(sptr& mb)
+    void on_send_buff(managed_send_buffer::sptr&) {}
+    bool on_send_release(managed_send_buffer::sptr& buff)
     {
-        _mb = mb;
-        return make(this, _mb->cast<void*>(), _mb->size());
+        return _flow_ctrl(buff);
     }
-
-private:
-    sptr _mb;
     flow_ctrl_func _flow_ctrl;
 };
 
-class zero_copy_flow_ctrl_mrb : public managed_recv_buffer
+struct fn_recv_flow_ctrl_t
 {
-public:
-    zero_copy_flow_ctrl_mrb(flow_ctrl_func flow_ctrl) : _mb(NULL), _flow_ctrl(flow_ctrl)
+    static const bool enabled = true;
+    fn_recv_flow_ctrl_t(flow_ctrl_func flow_ctrl) : _flow_ctrl(flow_ctrl) {}
+    bool on_recv_buff(managed_recv_buffer::sptr& buff)
     {
-        /* NOP */
+        return _flow_ctrl(buff);
     }
-
-    ~zero_copy_flow_ctrl_mrb()
-    {
-        /* NOP */
-    }
-
-    void release()
-    {
-        if (_mb) {
-            _mb.reset();
-        }
-    }
-
-    UHD_INLINE sptr get(sptr& mb)
-    {
-        _mb = mb;
-        while (_flow_ctrl and not _flow_ctrl(_mb)) {
-        }
-        return make(this, _mb->cast<void*>(), _mb->size());
-    }
-
-private:
-    sptr _mb;
     flow_ctrl_func _flow_ctrl;
 };
 
-/***********************************************************************
- * Zero copy offload transport:
- * An intermediate transport that utilizes threading to free
- * the main thread from any receive work.
- **********************************************************************/
-class zero_copy_flow_ctrl_impl : public zero_copy_flow_ctrl
-{
-public:
-    typedef std::shared_ptr<zero_copy_flow_ctrl_impl> sptr;
-
-    zero_copy_flow_ctrl_impl(zero_copy_if::sptr transport,
-        flow_ctrl_func send_flow_ctrl,
-        flow_ctrl_func recv_flow_ctrl)
-        : _transport(transport)
-        , _send_buffers(transport->get_num_send_frames())
-        , _recv_buffers(transport->get_num_recv_frames())
-        , _send_buff_index(0)
-        , _recv_buff_index(0)
-        , _send_flow_ctrl(send_flow_ctrl)
-        , _recv_flow_ctrl(recv_flow_ctrl)
-    {
-        UHD_LOG_TRACE("TRANSPORT", "Created zero_copy_flow_ctrl");
-
-        for (size_t i = 0; i < transport->get_num_send_frames(); i++) {
-            _send_buffers[i] = std::make_shared<zero_copy_flow_ctrl_msb>(_send_flow_ctrl);
-        }
-        for (size_t i = 0; i < transport->get_num_recv_frames(); i++) {
-            _recv_buffers[i] = std::make_shared<zero_copy_flow_ctrl_mrb>(_recv_flow_ctrl);
-        }
-    }
-
-    ~zero_copy_flow_ctrl_impl() {}
-
-    /*******************************************************************
-     * Receive implementation:
-     * Pop the receive buffer pointer from the underlying transport
-     ******************************************************************/
-    UHD_INLINE managed_recv_buffer::sptr get_recv_buff(double timeout)
-    {
-        managed_recv_buffer::sptr ptr;
-        managed_recv_buffer::sptr buff = _transport->get_recv_buff(timeout);
-        if (buff) {
-            std::shared_ptr<zero_copy_flow_ctrl_mrb> mb =
-                _recv_buffers[_recv_buff_index++];
-            _recv_buff_index %= _recv_buffers.size();
-            ptr = mb->get(buff);
-        }
-        return ptr;
-    }
-
-    UHD_INLINE size_t get_num_recv_frames() const
-    {
-        return _transport->get_num_recv_frames();
-    }
-
-    UHD_INLINE size_t get_recv_frame_size() const
-    {
-        return _transport->get_recv_frame_size();
-    }
-
-    /*******************************************************************
-     * Send implementation:
-     * Pass the send buffer pointer from the underlying transport
-     ******************************************************************/
-    managed_send_buffer::sptr get_send_buff(double timeout)
-    {
-        managed_send_buffer::sptr ptr;
-        managed_send_buffer::sptr buff = _transport->get_send_buff(timeout);
-        if (buff) {
-            std::shared_ptr<zero_copy_flow_ctrl_msb> mb =
-                _send_buffers[_send_buff_index++];
-            _send_buff_index %= _send_buffers.size();
-            ptr = mb->get(buff);
-        }
-        return ptr;
-    }
-
-    UHD_INLINE size_t get_num_send_frames() const
-    {
-        return _transport->get_num_send_frames();
-    }
-
-    UHD_INLINE size_t get_send_frame_size() const
-    {
-        return _transport->get_send_frame_size();
-    }
-
-private:
-    // The underlying transport
-    zero_copy_if::sptr _transport;
-
-    // buffers
-    std::vector<std::shared_ptr<zero_copy_flow_ctrl_msb>> _send_buffers;
-    std::vector<std::shared_ptr<zero_copy_flow_ctrl_mrb>> _recv_buffers;
-    size_t _send_buff_index;
-    size_t _recv_buff_index;
-
-    // Flow control functions
-    flow_ctrl_func _send_flow_ctrl;
-    flow_ctrl_func _recv_flow_ctrl;
-};
+} // namespace
 
 zero_copy_flow_ctrl::sptr zero_copy_flow_ctrl::make(zero_copy_if::sptr transport,
     flow_ctrl_func send_flow_ctrl,
     flow_ctrl_func recv_flow_ctrl)
 {
-    zero_copy_flow_ctrl_impl::sptr zero_copy_flow_ctrl(
-        new zero_copy_flow_ctrl_impl(transport, send_flow_ctrl, recv_flow_ctrl));
-
-    return zero_copy_flow_ctrl;
+    UHD_LOG_TRACE("TRANSPORT", "Created zero_copy_flow_ctrl");
+
+    // Dispatch on which directions are actually flow controlled so that
+    // unused directions compile down to a plain pass-through
+    if (send_flow_ctrl and recv_flow_ctrl) {
+        return make_zero_copy_flow_ctrl(transport,
+            fn_send_flow_ctrl_t(send_flow_ctrl),
+            fn_recv_flow_ctrl_t(recv_flow_ctrl));
+    }
+    if (send_flow_ctrl) {
+        return make_zero_copy_flow_ctrl(
+            transport, fn_send_flow_ctrl_t(send_flow_ctrl), no_recv_flow_ctrl_t());
+    }
+    if (recv_flow_ctrl) {
+        return make_zero_copy_flow_ctrl(
+            transport, no_send_flow_ctrl_t(), fn_recv_flow_ctrl_t(recv_flow_ctrl));
+    }
+    return make_zero_copy_flow_ctrl(
+        transport, no_send_flow_ctrl_t(), no_recv_flow_ctrl_t());
 }
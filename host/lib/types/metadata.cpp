@@ -8,76 +8,111 @@
 #include <uhd/exception.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/types/time_spec.hpp>
-#include <boost/format.hpp>
-#include <sstream>
+#include <algorithm>
+#include <cstdio>
 #include <string>
 
 using namespace uhd;
 
+namespace {
+
+// These strings are formatted at burst rates when errors are being logged,
+// so they are built with bounded snprintf calls into a stack buffer instead
+// of an ostringstream (which allocates on every call).
+template <size_t buff_len, typename... Args>
+void buff_format(char (&buff)[buff_len], size_t& offset, const char* fmt, Args... args)
+{
+    if (offset >= buff_len - 1) {
+        return;
+    }
+    const int num_chars = std::snprintf(buff + offset, buff_len - offset, fmt, args...);
+    if (num_chars > 0) {
+        offset = std::min(offset + static_cast<size_t>(num_chars), buff_len - 1);
+    }
+}
+
+} // namespace
+
 std::string rx_metadata_t::to_pp_string(bool compact) const
 {
-    std::stringstream ss;
+    char buff[512];
+    size_t offset = 0;
 
     if (compact) {
         if (has_time_spec) {
-            ss << "Time: " << time_spec.get_real_secs() << " s\n";
+            buff_format(buff, offset, "Time: %g s\n", time_spec.get_real_secs());
         }
         if (more_fragments) {
-            ss << "Fragmentation offset: " << fragment_offset << "\n";
+            buff_format(buff, offset, "Fragmentation offset: %zu\n", fragment_offset);
         }
         if (start_of_burst) {
-            ss << "Start of burst.\n" << fragment_offset;
+            buff_format(buff, offset, "Start of burst.\n%zu", fragment_offset);
         }
         if (end_of_burst) {
-            ss << "End of burst.\n" << fragment_offset;
+            buff_format(buff, offset, "End of burst.\n%zu", fragment_offset);
         }
         if (error_code != ERROR_CODE_NONE) {
-            ss << strerror() << "\n";
+            buff_format(buff, offset, "%s\n", this->strerror().c_str());
         }
     } else {
-        ss << "Has timespec: " << (has_time_spec ? "Yes" : "No")
-           << "\tTime of first sample: " << time_spec.get_real_secs()
-           << "\nFragmented: " << (more_fragments ? "Yes" : "No")
-           << "  Fragmentation offset: " << fragment_offset
-           << "\nStart of burst: " << (start_of_burst ? "Yes" : "No")
-           << "\tEnd of burst: " << (end_of_burst ? "Yes" : "No")
-           << "\nError Code: " << strerror()
-           << "\tOut of sequence: " << (out_of_sequence ? "Yes" : "No");
+        buff_format(buff,
+            offset,
+            "Has timespec: %s\tTime of first sample: %g"
+            "\nFragmented: %s  Fragmentation offset: %zu"
+            "\nStart of burst: %s\tEnd of burst: %s"
+            "\nError Code: %s\tOut of sequence: %s",
+            (has_time_spec ? "Yes" : "No"),
+            time_spec.get_real_secs(),
+            (more_fragments ? "Yes" : "No"),
+            fragment_offset,
+            (start_of_burst ? "Yes" : "No"),
+            (end_of_burst ? "Yes" : "No"),
+            this->strerror().c_str(),
+            (out_of_sequence ? "Yes" : "No"));
     }
 
-    return ss.str();
+    return std::string(buff, offset);
 }
 
 std::string rx_metadata_t::strerror() const
 {
-    std::string errstr = "";
     switch (this->error_code) {
         case ERROR_CODE_NONE:
-            errstr = "ERROR_CODE_NONE";
-            break;
+            return "ERROR_CODE_NONE";
         case ERROR_CODE_TIMEOUT:
-            errstr = "ERROR_CODE_TIMEOUT";
-            break;
+            return "ERROR_CODE_TIMEOUT";
         case ERROR_CODE_LATE_COMMAND:
-            errstr = "ERROR_CODE_LATE_COMMAND";
-            break;
+            return "ERROR_CODE_LATE_COMMAND";
         case ERROR_CODE_BROKEN_CHAIN:
-            errstr = "ERROR_CODE_BROKEN_CHAIN (Expected another stream command)";
-            break;
+            return "ERROR_CODE_BROKEN_CHAIN (Expected another stream command)";
         case ERROR_CODE_OVERFLOW:
-            errstr = "ERROR_CODE_OVERFLOW ";
-            errstr += (this->out_of_sequence ? "(Out of sequence error)" : "(Overflow)");
-            break;
+            return this->out_of_sequence ? "ERROR_CODE_OVERFLOW (Out of sequence error)"
+                                         : "ERROR_CODE_OVERFLOW (Overflow)";
         case ERROR_CODE_ALIGNMENT:
-            errstr = "ERROR_CODE_ALIGNMENT (Multi-channel alignment failed)";
-            break;
+            return "ERROR_CODE_ALIGNMENT (Multi-channel alignment failed)";
         case ERROR_CODE_BAD_PACKET:
-            errstr = "ERROR_CODE_BAD_PACKET";
-            break;
+            return "ERROR_CODE_BAD_PACKET";
+        case ERROR_CODE_LINK_DOWN:
+            return "ERROR_CODE_LINK_DOWN (Link liveness timeout expired)";
         default:
-            errstr =
-                std::string(str(boost::format("Unknown error code: 0x%x") % error_code));
+            break;
     }
 
-    return errstr;
+    char buff[64];
+    size_t offset = 0;
+    buff_format(
+        buff, offset, "Unknown error code: 0x%x", static_cast<unsigned>(error_code));
+    return std::string(buff, offset);
+}
+
+rx_metadata_t::error_details_t rx_metadata_t::get_error_details() const
+{
+    error_details_t details;
+    details.error_code      = this->error_code;
+    details.out_of_sequence = this->out_of_sequence;
+    details.has_time_spec   = this->has_time_spec;
+    details.time_full_secs  = this->time_spec.get_full_secs();
+    details.time_frac_secs  = this->time_spec.get_frac_secs();
+    details.dropped_samps   = this->dropped_samps;
+    return details;
 }
@@ -27,7 +27,8 @@ void export_metadata(py::module& m)
         .value("broken_chain", error_code_t::ERROR_CODE_BROKEN_CHAIN)
         .value("overflow", error_code_t::ERROR_CODE_OVERFLOW)
         .value("alignment", error_code_t::ERROR_CODE_ALIGNMENT)
-        .value("bad_packet", error_code_t::ERROR_CODE_BAD_PACKET);
+        .value("bad_packet", error_code_t::ERROR_CODE_BAD_PACKET)
+        .value("link_down", error_code_t::ERROR_CODE_LINK_DOWN);
 
     py::class_<range_t>(m, "range")
         // Constructors
@@ -5,8 +5,10 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/types/serial.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -46,11 +48,22 @@ void i2c_iface::write_eeprom(uint16_t addr, uint16_t offset, const byte_vector_t
 
 byte_vector_t i2c_iface::read_eeprom(uint16_t addr, uint16_t offset, size_t num_bytes)
 {
+    // Set the EEPROM's address pointer once per chunk and read the bytes with
+    // a sequential read instead of re-addressing for every byte. The chunk
+    // size stays below the smallest per-transaction buffer of the various i2c
+    // backends (e.g. the USRP2 firmware buffers 20 bytes).
+    static const size_t CHUNK_SIZE = 16;
     byte_vector_t bytes;
-    for (size_t i = 0; i < num_bytes; i++) {
-        // do a zero byte write to start read cycle
+    bytes.reserve(num_bytes);
+    for (size_t i = 0; i < num_bytes; i += CHUNK_SIZE) {
+        const size_t chunk_size = std::min(CHUNK_SIZE, num_bytes - i);
+        // do a zero byte write to start read cycle at the chunk offset
         this->write_i2c(addr, byte_vector_t(1, narrow_cast<uint8_t>(offset + i)));
-        bytes.push_back(this->read_i2c(addr, 1).at(0));
+        const byte_vector_t chunk = this->read_i2c(addr, chunk_size);
+        if (chunk.size() != chunk_size) {
+            throw uhd::io_error("I2C EEPROM read returned short");
+        }
+        bytes.insert(bytes.end(), chunk.begin(), chunk.end());
     }
     return bytes;
 }
@@ -35,6 +35,25 @@ uint32_t wb_iface::peek32(const wb_iface::wb_addr_type)
     throw uhd::not_implemented_error("peek32 not implemented");
 }
 
+void wb_iface::poke32_many(
+    const std::vector<std::pair<wb_iface::wb_addr_type, uint32_t>>& regs)
+{
+    for (const auto& reg : regs) {
+        this->poke32(reg.first, reg.second);
+    }
+}
+
+std::vector<uint32_t> wb_iface::peek32_many(
+    const std::vector<wb_iface::wb_addr_type>& addrs)
+{
+    std::vector<uint32_t> data;
+    data.reserve(addrs.size());
+    for (const wb_addr_type addr : addrs) {
+        data.push_back(this->peek32(addr));
+    }
+    return data;
+}
+
 void wb_iface::poke16(const wb_iface::wb_addr_type, const uint16_t)
 {
     throw uhd::not_implemented_error("poke16 not implemented");
@@ -29,21 +29,31 @@ mboard_eeprom_t b100_impl::get_mb_eeprom(uhd::i2c_iface::sptr iface)
 {
     mboard_eeprom_t mb_eeprom;
 
+    // Read the region holding the burned-in fields in one transfer and parse
+    // host-side instead of issuing one transaction per field
+    const size_t base = offsetof(b100_eeprom_map, revision);
+    const byte_vector_t bytes =
+        iface->read_eeprom(B100_EEPROM_ADDR, base, sizeof(b100_eeprom_map) - base);
+    auto field_bytes = [&bytes, base](const size_t offset, const size_t length) {
+        return byte_vector_t(
+            bytes.begin() + (offset - base), bytes.begin() + (offset - base) + length);
+    };
+
     // extract the revision number
-    mb_eeprom["revision"] = uint16_bytes_to_string(
-        iface->read_eeprom(B100_EEPROM_ADDR, offsetof(b100_eeprom_map, revision), 2));
+    mb_eeprom["revision"] =
+        uint16_bytes_to_string(field_bytes(offsetof(b100_eeprom_map, revision), 2));
 
     // extract the product code
-    mb_eeprom["product"] = uint16_bytes_to_string(
-        iface->read_eeprom(B100_EEPROM_ADDR, offsetof(b100_eeprom_map, product), 2));
+    mb_eeprom["product"] =
+        uint16_bytes_to_string(field_bytes(offsetof(b100_eeprom_map, product), 2));
 
     // extract the serial
-    mb_eeprom["serial"] = bytes_to_string(iface->read_eeprom(
-        B100_EEPROM_ADDR, offsetof(b100_eeprom_map, serial), SERIAL_LEN));
+    mb_eeprom["serial"] =
+        bytes_to_string(field_bytes(offsetof(b100_eeprom_map, serial), SERIAL_LEN));
 
     // extract the name
-    mb_eeprom["name"] = bytes_to_string(iface->read_eeprom(
-        B100_EEPROM_ADDR, offsetof(b100_eeprom_map, name), NAME_MAX_LEN));
+    mb_eeprom["name"] =
+        bytes_to_string(field_bytes(offsetof(b100_eeprom_map, name), NAME_MAX_LEN));
 
     return mb_eeprom;
 }
@@ -9,6 +9,8 @@
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/paths.hpp>
+#include <uhd/utils/platform.hpp>
 #include <uhdlib/utils/ihex.hpp>
 #include <libusb.h>
 #include <stdint.h>
@@ -16,11 +18,14 @@
 #include <boost/format.hpp>
 #include <boost/functional/hash.hpp>
 #include <boost/lexical_cast.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cstring>
+#include <ctime>
 #include <fstream>
 #include <functional>
 #include <iomanip>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -37,6 +42,12 @@ static const bool load_img_msg = true;
 
 const static uint8_t FX3_FIRMWARE_LOAD = 0xA0;
 
+// The FX3 boot ROM accepts firmware download control transfers of up to
+// 4 KB; coalescing the ~16-byte hex records up to this size cuts the
+// number of transfers (and thus the fixed cold-enumeration load time)
+// by two orders of magnitude.
+const static size_t FX3_MAX_FW_XFER_SIZE = 4096;
+
 // 32 KB - 256 bytes for EEPROM storage
 constexpr size_t BOOTLOADER_MAX_SIZE = 32512;
 
@@ -117,6 +128,106 @@ static hash_type generate_hash(const char* filename)
     return hash_type(hash);
 }
 
+/***********************************************************************
+ * Persistent image hash cache
+ *
+ * Hashing an image means reading the entire file, and it happens on
+ * every open -- even when the device already runs that image and no
+ * reload takes place. Since images rarely change, the hash is cached
+ * on disk keyed by path/size/mtime, so repeated opens (and repeated
+ * processes, e.g. a test runner cycling the device) skip the file
+ * read. The cache is best-effort: any I/O problem falls back to
+ * hashing the file.
+ **********************************************************************/
+static const size_t HASH_CACHE_MAX_ENTRIES = 32;
+
+struct image_hash_entry_t
+{
+    hash_type hash;
+    uintmax_t size;
+    std::time_t mtime;
+    std::string path;
+};
+
+static boost::filesystem::path get_image_hash_cache_path(void)
+{
+    return boost::filesystem::path(uhd::get_tmp_path()) / ".uhd-b2xx-image-hashes";
+}
+
+static std::vector<image_hash_entry_t> read_image_hash_cache(void)
+{
+    std::vector<image_hash_entry_t> entries;
+    std::ifstream cache(get_image_hash_cache_path().string());
+    std::string line;
+    while (std::getline(cache, line)) {
+        std::istringstream iss(line);
+        image_hash_entry_t entry;
+        if (iss >> entry.hash >> entry.size >> entry.mtime and iss.get() == ' '
+            and std::getline(iss, entry.path)) {
+            entries.push_back(entry);
+        }
+    }
+    return entries;
+}
+
+static void store_image_hash(const image_hash_entry_t& new_entry)
+{
+    try {
+        std::vector<image_hash_entry_t> entries = read_image_hash_cache();
+        entries.erase(std::remove_if(entries.begin(),
+                          entries.end(),
+                          [&new_entry](const image_hash_entry_t& entry) {
+                              return entry.path == new_entry.path;
+                          }),
+            entries.end());
+        entries.insert(entries.begin(), new_entry);
+        if (entries.size() > HASH_CACHE_MAX_ENTRIES) {
+            entries.resize(HASH_CACHE_MAX_ENTRIES);
+        }
+        // write-then-rename so concurrent opens never see a torn cache
+        const boost::filesystem::path cache_path = get_image_hash_cache_path();
+        const boost::filesystem::path tmp_path =
+            cache_path.string() + "." + std::to_string(uhd::get_process_id());
+        std::ofstream cache(tmp_path.string(), std::ios::trunc);
+        for (const image_hash_entry_t& entry : entries) {
+            cache << entry.hash << ' ' << entry.size << ' ' << entry.mtime << ' '
+                  << entry.path << std::endl;
+        }
+        cache.close();
+        boost::filesystem::rename(tmp_path, cache_path);
+    } catch (const std::exception& e) {
+        UHD_LOGGER_DEBUG("B200") << "Could not update image hash cache: " << e.what();
+    }
+}
+
+/*!
+ * Like generate_hash(), but consults the on-disk hash cache first and
+ * only reads the image file on a cache miss (or if the file changed).
+ */
+static hash_type lookup_image_hash(const char* filename)
+{
+    if (filename == NULL)
+        return hash_type(0);
+
+    image_hash_entry_t entry;
+    entry.path = filename;
+    try {
+        entry.size  = boost::filesystem::file_size(filename);
+        entry.mtime = boost::filesystem::last_write_time(filename);
+        for (const image_hash_entry_t& cached : read_image_hash_cache()) {
+            if (cached.path == entry.path and cached.size == entry.size
+                and cached.mtime == entry.mtime) {
+                return cached.hash;
+            }
+        }
+    } catch (const std::exception&) {
+        return generate_hash(filename);
+    }
+    entry.hash = generate_hash(filename);
+    store_image_hash(entry);
+    return entry.hash;
+}
+
 
 /***********************************************************************
  * The implementation class
@@ -221,14 +332,15 @@ public:
 
         ihex_reader file_reader(filestring);
         try {
-            file_reader.read(std::bind(&b200_iface_impl::fx3_control_write,
-                this,
-                FX3_FIRMWARE_LOAD,
-                std::placeholders::_1,
-                std::placeholders::_2,
-                std::placeholders::_3,
-                std::placeholders::_4,
-                0));
+            file_reader.read_coalesced(std::bind(&b200_iface_impl::fx3_control_write,
+                                           this,
+                                           FX3_FIRMWARE_LOAD,
+                                           std::placeholders::_1,
+                                           std::placeholders::_2,
+                                           std::placeholders::_3,
+                                           std::placeholders::_4,
+                                           0),
+                FX3_MAX_FW_XFER_SIZE);
         } catch (const uhd::io_error& e) {
             throw uhd::io_error(
                 str(boost::format("Could not load firmware: \n%s") % e.what()));
@@ -491,7 +603,10 @@ public:
 
         const char* filename = filestring.c_str();
 
-        hash_type hash = generate_hash(filename);
+        // the cached lookup avoids re-reading the whole image on the
+        // common nothing-changed path; the hash on the device remains
+        // the per-unit ground truth
+        hash_type hash = lookup_image_hash(filename);
         hash_type loaded_hash;
         usrp_get_fpga_hash(loaded_hash);
         if (hash == loaded_hash and !force)
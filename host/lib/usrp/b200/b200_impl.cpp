@@ -8,6 +8,7 @@
 #include "b200_impl.hpp"
 #include "../../transport/libusb1_base.hpp"
 #include "b200_regs.hpp"
+#include <uhd/cal/database.hpp>
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/transport/usb_control.hpp>
@@ -35,7 +36,12 @@ using namespace uhd::transport;
 
 namespace {
 constexpr int64_t REENUMERATION_TIMEOUT_MS = 3000;
-}
+
+//! Cal database key for the init-time calibration record (see fast_init)
+constexpr char B200_INIT_CAL_KEY[] = "b2xx_init_cals";
+//! Width of the temperature bands the init cal record is keyed by (in C)
+constexpr double B200_INIT_CAL_TEMP_BAND = 10.0;
+} // namespace
 
 // B200 + B210:
 class b200_ad9361_client_t : public ad9361_params
@@ -232,8 +238,9 @@ static device_addrs_t b200_find(const device_addr_t& hint)
                 continue;
             } // ignore claimed
 
-            b200_iface::sptr iface          = b200_iface::make(control);
-            const mboard_eeprom_t mb_eeprom = b200_impl::get_mb_eeprom(iface);
+            b200_iface::sptr iface = b200_iface::make(control);
+            const mboard_eeprom_t mb_eeprom =
+                b200_impl::get_mb_eeprom(iface, handle->get_serial());
 
             device_addr_t new_addr;
             new_addr["type"]   = "b200";
@@ -387,7 +394,7 @@ b200_impl::b200_impl(
     ////////////////////////////////////////////////////////////////////
     // setup the mboard eeprom
     ////////////////////////////////////////////////////////////////////
-    const mboard_eeprom_t mb_eeprom = get_mb_eeprom(_iface);
+    const mboard_eeprom_t mb_eeprom = get_mb_eeprom(_iface, handle->get_serial());
     _tree->create<mboard_eeprom_t>(mb_path / "eeprom")
         .set(mb_eeprom)
         .add_coerced_subscriber(
@@ -622,7 +629,55 @@ b200_impl::b200_impl(
     } else {
         client_settings = std::make_shared<b200_ad9361_client_t>();
     }
-    _codec_ctrl = ad9361_ctrl::make_spi(client_settings, _spi_iface, AD9361_SLAVENO);
+    // Fast-init mode: with fast_init in the device args, consult the cal
+    // database for a record of the last full init-time calibration of this
+    // unit. On a match (same clock rate request, same temperature band), the
+    // one-shot calibrations are deferred to the first tune; on a miss they
+    // run as usual and the record is refreshed. The AD9361 cal results live
+    // in chip-internal state that cannot be written back from the host, so
+    // the database stores the conditions of the last full calibration rather
+    // than the results themselves.
+    const std::string init_cal_serial = mb_eeprom["serial"];
+    const std::string init_cal_clock  = device_addr.get("master_clock_rate", "auto");
+    std::string recorded_init_cal;
+    if (device_addr.has_key("fast_init") and not init_cal_serial.empty()
+        and cal::database::has_cal_data(
+            B200_INIT_CAL_KEY, init_cal_serial, cal::source::FILESYSTEM)) {
+        const auto cal_data = cal::database::read_cal_data(
+            B200_INIT_CAL_KEY, init_cal_serial, cal::source::FILESYSTEM);
+        recorded_init_cal = std::string(cal_data.begin(), cal_data.end());
+    }
+    // The record is "<clock rate> <temperature band>"; the temperature can
+    // only be compared after initialization, but a clock rate mismatch rules
+    // out the fast path up front.
+    const bool fast_init =
+        not recorded_init_cal.empty()
+        and recorded_init_cal.substr(0, recorded_init_cal.find(' ')) == init_cal_clock;
+    if (fast_init) {
+        UHD_LOGGER_DEBUG("B200") << "Using fast codec initialization";
+    }
+
+    _codec_ctrl =
+        ad9361_ctrl::make_spi(client_settings, _spi_iface, AD9361_SLAVENO, fast_init);
+
+    if (device_addr.has_key("fast_init") and not init_cal_serial.empty()) {
+        const int temp_band = int(std::floor(
+            _codec_ctrl->get_temperature().to_real() / B200_INIT_CAL_TEMP_BAND));
+        const std::string new_init_cal =
+            init_cal_clock + " " + std::to_string(temp_band);
+        if (fast_init and new_init_cal != recorded_init_cal) {
+            UHD_LOGGER_INFO("B200")
+                << "Temperature moved out of the calibrated band, re-running "
+                   "codec init calibrations...";
+            _codec_ctrl->run_init_cals();
+        }
+        if (new_init_cal != recorded_init_cal) {
+            cal::database::write_cal_data(B200_INIT_CAL_KEY,
+                init_cal_serial,
+                std::vector<uint8_t>(new_init_cal.begin(), new_init_cal.end()),
+                "old");
+        }
+    }
 
     ////////////////////////////////////////////////////////////////////
     // create codec control objects
@@ -13,7 +13,6 @@
 #include "b200_uart.hpp"
 #include <uhd/device.hpp>
 #include <uhd/property_tree.hpp>
-#include <uhd/transport/bounded_buffer.hpp>
 #include <uhd/transport/usb_zero_copy.hpp>
 #include <uhd/types/dict.hpp>
 #include <uhd/types/sensors.hpp>
@@ -35,6 +34,7 @@
 #include <uhdlib/usrp/cores/tx_dsp_core_3000.hpp>
 #include <uhdlib/usrp/cores/tx_vita_core_3000.hpp>
 #include <uhdlib/usrp/cores/user_settings_core_3000.hpp>
+#include <uhdlib/utils/bounded_queue.hpp>
 #include <boost/assign.hpp>
 #include <memory>
 #include <mutex>
@@ -129,7 +129,11 @@ public:
         double tick_rate,
         const std::string& direction = "");
 
-    static uhd::usrp::mboard_eeprom_t get_mb_eeprom(uhd::i2c_iface::sptr);
+    //! Read the motherboard EEPROM contents. If \p cache_key is non-empty
+    // (typically the USB serial), repeated reads within this process are
+    // served from a session cache.
+    static uhd::usrp::mboard_eeprom_t get_mb_eeprom(
+        uhd::i2c_iface::sptr, const std::string& cache_key = "");
 
 private:
     b200_product_t _product;
@@ -160,7 +164,7 @@ private:
 
     // async ctrl + msgs
     uhd::msg_task::sptr _async_task;
-    typedef uhd::transport::bounded_buffer<uhd::async_metadata_t> async_md_type;
+    typedef uhd::utils::bounded_queue<uhd::async_metadata_t> async_md_type;
     struct AsyncTaskData
     {
         std::shared_ptr<async_md_type> async_md;
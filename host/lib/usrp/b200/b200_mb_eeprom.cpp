@@ -7,6 +7,7 @@
 #include "b200_impl.hpp"
 #include <uhd/usrp/mboard_eeprom.hpp>
 #include <uhdlib/utils/eeprom_utils.hpp>
+#include <mutex>
 #include <unordered_map>
 
 using namespace uhd;
@@ -16,6 +17,12 @@ namespace {
 
 constexpr auto LOG_ID = "B2xx_EEPROM";
 
+// Session cache of parsed EEPROM contents keyed by USB serial. The EEPROM is
+// read during discovery and again when the device is made, so the second read
+// is served from here instead of going back over the wire.
+std::mutex eeprom_cache_mutex;
+std::unordered_map<std::string, mboard_eeprom_t> eeprom_cache;
+
 struct eeprom_field_t
 {
     size_t offset;
@@ -93,8 +100,17 @@ byte_vector_t _get_eeprom(uhd::i2c_iface::sptr iface)
 
 } // namespace
 
-mboard_eeprom_t b200_impl::get_mb_eeprom(uhd::i2c_iface::sptr iface)
+mboard_eeprom_t b200_impl::get_mb_eeprom(
+    uhd::i2c_iface::sptr iface, const std::string& cache_key)
 {
+    if (not cache_key.empty()) {
+        std::lock_guard<std::mutex> lock(eeprom_cache_mutex);
+        const auto cached = eeprom_cache.find(cache_key);
+        if (cached != eeprom_cache.end()) {
+            return cached->second;
+        }
+    }
+
     auto rev   = _get_rev(iface);
     auto bytes = _get_eeprom(iface);
     mboard_eeprom_t mb_eeprom;
@@ -131,11 +147,23 @@ mboard_eeprom_t b200_impl::get_mb_eeprom(uhd::i2c_iface::sptr iface)
         }
     }
 
+    if (not cache_key.empty()) {
+        std::lock_guard<std::mutex> lock(eeprom_cache_mutex);
+        eeprom_cache[cache_key] = mb_eeprom;
+    }
+
     return mb_eeprom;
 }
 
 void b200_impl::set_mb_eeprom(const mboard_eeprom_t& mb_eeprom)
 {
+    {
+        // Invalidate the session cache: the serial of this device is not
+        // readily available here, so drop all cached entries
+        std::lock_guard<std::mutex> lock(eeprom_cache_mutex);
+        eeprom_cache.clear();
+    }
+
     const auto rev  = _get_rev(_iface);
     auto eeprom_map = (rev == 0) ? B200_REV0_MAP : B200_REV1_MAP;
     auto base_addr  = (rev == 0) ? REV0_BASE_ADDR : REV1_BASE_ADDR;
@@ -88,10 +88,12 @@ private:
 class ad9361_ctrl_impl : public ad9361_ctrl
 {
 public:
-    ad9361_ctrl_impl(ad9361_params::sptr client_settings, ad9361_io::sptr io_iface)
+    ad9361_ctrl_impl(ad9361_params::sptr client_settings,
+        ad9361_io::sptr io_iface,
+        const bool skip_one_shot_cals)
         : _device(client_settings, io_iface)
     {
-        _device.initialize();
+        _device.initialize(skip_one_shot_cals);
     }
     double set_gain(const std::string& which, const double value)
     {
@@ -210,6 +212,12 @@ public:
         return sensor_value_t("temp", _device.get_average_temperature(), "C");
     }
 
+    void run_init_cals()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _device.run_init_cals();
+    }
+
     void set_dc_offset_auto(const std::string& which, const bool on)
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -320,15 +328,17 @@ private:
 //----------------------------------------------------------------------
 ad9361_ctrl::sptr ad9361_ctrl::make_spi(ad9361_params::sptr client_settings,
     uhd::spi_iface::sptr spi_iface,
-    uint32_t slave_num)
+    uint32_t slave_num,
+    const bool skip_one_shot_cals)
 {
     std::shared_ptr<ad9361_io_spi> spi_io_iface =
         std::make_shared<ad9361_io_spi>(spi_iface, slave_num);
-    return sptr(new ad9361_ctrl_impl(client_settings, spi_io_iface));
+    return sptr(new ad9361_ctrl_impl(client_settings, spi_io_iface, skip_one_shot_cals));
 }
 
-ad9361_ctrl::sptr ad9361_ctrl::make_spi(
-    ad9361_params::sptr client_settings, ad9361_io::sptr spi_io_iface)
+ad9361_ctrl::sptr ad9361_ctrl::make_spi(ad9361_params::sptr client_settings,
+    ad9361_io::sptr spi_io_iface,
+    const bool skip_one_shot_cals)
 {
-    return sptr(new ad9361_ctrl_impl(client_settings, spi_io_iface));
+    return sptr(new ad9361_ctrl_impl(client_settings, spi_io_iface, skip_one_shot_cals));
 }
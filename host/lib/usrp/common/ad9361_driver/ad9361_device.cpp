@@ -1556,7 +1556,7 @@ double ad9361_device_t::_setup_rates(const double rate)
 /***********************************************************************
  * Publicly exported functions to host calls
  **********************************************************************/
-void ad9361_device_t::initialize()
+void ad9361_device_t::initialize(const bool skip_one_shot_cals)
 {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
 
@@ -1762,21 +1762,21 @@ void ad9361_device_t::initialize()
 
     _setup_adc();
 
-    _calibrate_baseband_dc_offset();
-    _calibrate_rf_dc_offset();
-    _calibrate_rx_quadrature();
-
-    /*
-     * Rx BB DC and IQ tracking are both disabled by calibration at this
-     * point. Only issue commands if tracking needs to be turned on.
-     */
-    if (_use_dc_offset_tracking)
-        _configure_bb_dc_tracking();
-    if (_use_iq_balance_tracking)
-        _configure_rx_iq_tracking();
+    if (not skip_one_shot_cals) {
+        run_init_cals();
+    } else {
+        /* Defer the one-shot calibrations: invalidate the calibration
+         * frequencies so that the first tune() runs them at the frequency
+         * the application actually operates at, and make sure the tracking
+         * loops are enabled in the meantime. */
+        if (_use_dc_offset_tracking)
+            _configure_bb_dc_tracking();
+        if (_use_iq_balance_tracking)
+            _configure_rx_iq_tracking();
 
-    _last_rx_cal_freq = _rx_freq;
-    _last_tx_cal_freq = _tx_freq;
+        _last_rx_cal_freq = -AD9361_CAL_VALID_WINDOW;
+        _last_tx_cal_freq = -AD9361_CAL_VALID_WINDOW;
+    }
 
     // cals done, set PPORT config
     switch (_client_params->get_digital_interface_mode()) {
@@ -1820,6 +1820,41 @@ void ad9361_device_t::initialize()
     _io_iface->poke8(0x014, 0x21);
 }
 
+void ad9361_device_t::run_init_cals()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    /* The calibration state machines require the ALERT state. During
+     * initialization we are already there; a later refresh has to drop out
+     * of the FDD state first, the same way tune() does. */
+    int not_in_alert = 0;
+    if ((_io_iface->peek8(0x017) & 0x0F) != 5) {
+        not_in_alert = 1;
+        _io_iface->poke8(0x014, 0x01);
+    }
+
+    _calibrate_baseband_dc_offset();
+    _calibrate_rf_dc_offset();
+    _calibrate_rx_quadrature();
+
+    /*
+     * Rx BB DC and IQ tracking are both disabled by calibration at this
+     * point. Only issue commands if tracking needs to be turned on.
+     */
+    if (_use_dc_offset_tracking)
+        _configure_bb_dc_tracking();
+    if (_use_iq_balance_tracking)
+        _configure_rx_iq_tracking();
+
+    _last_rx_cal_freq = _rx_freq;
+    _last_tx_cal_freq = _tx_freq;
+
+    /* If we were in the FDD state, return to it now. */
+    if (not_in_alert) {
+        _io_iface->poke8(0x014, 0x21);
+    }
+}
+
 void ad9361_device_t::set_io_iface(ad9361_io::sptr io_iface)
 {
     _io_iface = io_iface;
@@ -1905,21 +1940,7 @@ double ad9361_device_t::set_clock_rate(const double req_rate)
 
     _setup_adc();
 
-    _calibrate_baseband_dc_offset();
-    _calibrate_rf_dc_offset();
-    _calibrate_rx_quadrature();
-
-    /*
-     * Rx BB DC and IQ tracking are both disabled by calibration at this
-     * point. Only issue commands if tracking needs to be turned on.
-     */
-    if (_use_dc_offset_tracking)
-        _configure_bb_dc_tracking();
-    if (_use_iq_balance_tracking)
-        _configure_rx_iq_tracking();
-
-    _last_rx_cal_freq = _rx_freq;
-    _last_tx_cal_freq = _tx_freq;
+    run_init_cals();
 
     // cals done, set PPORT config
     switch (_client_params->get_digital_interface_mode()) {
@@ -155,8 +155,24 @@ public:
     {
     }
 
-    /* Initialize the AD9361 codec. */
-    void initialize();
+    /* Initialize the AD9361 codec.
+     *
+     * When skip_one_shot_cals is set, the initialization-time one-shot
+     * calibrations (baseband DC offset, RF DC offset, RX quadrature) are
+     * deferred instead of being run at the default LO frequencies: the last
+     * calibration frequencies are invalidated so the first real tune() runs
+     * them at the frequency the application actually uses. Callers opting
+     * into this fast path should run_init_cals() if the device is operated
+     * without tuning first. */
+    void initialize(const bool skip_one_shot_cals = false);
+
+    /* Run the initialization-time one-shot calibrations.
+     *
+     * This is called from initialize() unless the one-shot calibrations were
+     * deferred, and can be called again later (e.g. after a large temperature
+     * excursion) to refresh the calibration state at the current LO
+     * frequencies. */
+    void run_init_cals();
 
     /* Set SPI interface */
     void set_io_iface(ad9361_io::sptr io_iface);
@@ -29,8 +29,22 @@ std::mutex corrections_mutex;
  **********************************************************************/
 namespace {
 
-// Cache the loaded data so we don't have to serialize on every tune
-std::unordered_map<std::string, iq_cal::sptr> fe_cal_cache;
+//! Upper bound for the per-container coefficient memo below. Frequency-hopping
+// patterns revisit a bounded set of LO frequencies, so this is rarely hit; it
+// only guards against unbounded growth when an application sweeps
+// monotonically through thousands of distinct frequencies.
+constexpr size_t MAX_COEFF_CACHE_SIZE = 4096;
+
+// Cache the loaded data so we don't have to deserialize on every tune
+struct fe_cal_entry
+{
+    iq_cal::sptr cal;
+    //! Memoized interpolated correction per LO frequency (keyed in integer Hz),
+    // so that repeat tunes to the same frequency are a single hash lookup
+    // instead of a bounding search plus interpolation.
+    std::unordered_map<uint64_t, std::complex<double>> coeffs;
+};
+std::unordered_map<std::string, fe_cal_entry> fe_cal_cache;
 
 // Deprecated CSV file loader. Delete this function once we remove CSV support.
 // Then, also delete the uhd::csv module.
@@ -72,7 +86,7 @@ bool load_legacy_fe_corrections(const std::string& cal_key,
         iq_cal_container->set_cal_coeff(
             std::stod(row[0]), {std::stod(row[1]), std::stod(row[2])});
     }
-    fe_cal_cache.insert({cal_key, iq_cal_container});
+    fe_cal_cache.insert({cal_key, {iq_cal_container, {}}});
     UHD_LOGGER_INFO("CAL") << "Calibration data loaded: " << cal_data_path.string();
     return true;
 }
@@ -88,8 +102,12 @@ void apply_fe_corrections(uhd::property_tree::sptr sub_tree,
     if (!fe_cal_cache.count(cal_key)) {
         if (database::has_cal_data(file_prefix, db_serial)) {
             try {
-                const auto cal_data = database::read_cal_data(file_prefix, db_serial);
-                fe_cal_cache.insert({cal_key, container::make<iq_cal>(cal_data)});
+                // Read the cal data as a blob (memory-mapped where possible)
+                // and defer parsing: only containers that get used for actual
+                // corrections pay for deserialization.
+                const auto cal_data =
+                    database::read_cal_data_blob(file_prefix, db_serial);
+                fe_cal_cache.insert({cal_key, {container::make<iq_cal>(cal_data), {}}});
                 UHD_LOG_DEBUG("CAL",
                     "Loaded calibration data for " << file_prefix
                                                    << " serial=" << db_serial);
@@ -97,7 +115,7 @@ void apply_fe_corrections(uhd::property_tree::sptr sub_tree,
                 UHD_LOG_WARNING("CAL",
                     "Error occurred reading cal data: `" << ex.what()
                                                         << "'. Skipping future loads.");
-                fe_cal_cache.insert({cal_key, nullptr});
+                fe_cal_cache.insert({cal_key, {nullptr, {}}});
             }
         // Delete the following else clause once we remove CSV support
         } else if (load_legacy_fe_corrections(cal_key, db_serial, file_prefix)) {
@@ -109,7 +127,7 @@ void apply_fe_corrections(uhd::property_tree::sptr sub_tree,
         } else {
             // If there is no cal data, store a nullptr so we can skip the check
             // next time.
-            fe_cal_cache.insert({cal_key, nullptr});
+            fe_cal_cache.insert({cal_key, {nullptr, {}}});
             UHD_LOG_TRACE("CAL",
                 "No calibration data found for " << file_prefix
                                                  << " serial=" << db_serial);
@@ -117,13 +135,23 @@ void apply_fe_corrections(uhd::property_tree::sptr sub_tree,
     }
 
     // Check if valid data even exists
-    if (fe_cal_cache.at(cal_key) == nullptr) {
+    auto& entry = fe_cal_cache.at(cal_key);
+    if (entry.cal == nullptr) {
         return;
     }
 
-    // OK we have cal data: Now apply it
-    sub_tree->access<std::complex<double>>(fe_path).set(
-        fe_cal_cache.at(cal_key)->get_cal_coeff(lo_freq));
+    // OK we have cal data: Now apply it. Repeat tunes to the same frequency
+    // (e.g., in a hopping pattern) hit the memo and skip the interpolation.
+    const uint64_t freq_key = static_cast<uint64_t>(lo_freq);
+    auto coeff_it           = entry.coeffs.find(freq_key);
+    if (coeff_it == entry.coeffs.end()) {
+        if (entry.coeffs.size() >= MAX_COEFF_CACHE_SIZE) {
+            entry.coeffs.clear();
+        }
+        coeff_it =
+            entry.coeffs.emplace(freq_key, entry.cal->get_cal_coeff(lo_freq)).first;
+    }
+    sub_tree->access<std::complex<double>>(fe_path).set(coeff_it->second);
 }
 
 } // namespace
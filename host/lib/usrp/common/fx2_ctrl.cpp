@@ -9,6 +9,7 @@
 #include <uhd/transport/usb_control.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/usrp/common/fx2_ctrl.hpp>
+#include <uhdlib/utils/ihex.hpp>
 #include <stdint.h>
 #include <boost/functional/hash.hpp>
 #include <chrono>
@@ -24,6 +25,11 @@ using namespace uhd::usrp;
 
 #define FX2_FIRMWARE_LOAD 0xa0
 
+// The FX2's firmware load request is handled by the USB core logic, which
+// accepts multi-packet control transfers; coalescing the ~16-byte hex
+// records up to this size avoids one control transfer per record.
+static const size_t FX2_MAX_FW_XFER_SIZE = 512;
+
 static const bool load_img_msg = true;
 
 typedef uint32_t hash_type;
@@ -60,69 +66,6 @@ static hash_type generate_hash(const char* filename)
 }
 
 
-/*!
- * Verify checksum of a Intel HEX record
- * \param record a line from an Intel HEX file
- * \return true if record is valid, false otherwise
- */
-static bool checksum(std::string* record)
-{
-    size_t len = record->length();
-    unsigned int i;
-    unsigned char sum = 0;
-    unsigned int val;
-
-    for (i = 1; i < len; i += 2) {
-        std::istringstream(record->substr(i, 2)) >> std::hex >> val;
-        sum += val;
-    }
-
-    if (sum == 0)
-        return true;
-    else
-        return false;
-}
-
-
-/*!
- * Parse Intel HEX record
- *
- * \param record a line from an Intel HEX file
- * \param len output length of record
- * \param addr output address
- * \param type output type
- * \param data output data
- * \return true if record is sucessfully read, false on error
- */
-bool parse_record(std::string* record,
-    unsigned int& len,
-    unsigned int& addr,
-    unsigned int& type,
-    unsigned char* data)
-{
-    unsigned int i;
-    std::string _data;
-    unsigned int val;
-
-    if (record->substr(0, 1) != ":")
-        return false;
-
-    std::istringstream(record->substr(1, 2)) >> std::hex >> len;
-    std::istringstream(record->substr(3, 4)) >> std::hex >> addr;
-    std::istringstream(record->substr(7, 2)) >> std::hex >> type;
-
-    if (len > (2 * (record->length() - 9))) // sanity check to prevent buffer overrun
-        return false;
-
-    for (i = 0; i < len; i++) {
-        std::istringstream(record->substr(9 + 2 * i, 2)) >> std::hex >> val;
-        data[i] = (unsigned char)val;
-    }
-
-    return true;
-}
-
-
 /*!
  * USRP control implementation for device discovery and configuration
  */
@@ -156,19 +99,6 @@ public:
         if (not force and (hash == loaded_hash))
             return;
 
-        // FIXME: verify types
-        unsigned int len;
-        unsigned int addr;
-        unsigned int type;
-        unsigned char data[512];
-
-        std::ifstream file;
-        file.open(filename, std::ifstream::in);
-
-        if (!file.good()) {
-            throw uhd::io_error("usrp_load_firmware: cannot open firmware input file");
-        }
-
         unsigned char reset_y = 1;
         unsigned char reset_n = 0;
 
@@ -177,45 +107,23 @@ public:
             UHD_LOGGER_INFO("FX2") << "Loading firmware image: " << filestring << "...";
         usrp_control_write(FX2_FIRMWARE_LOAD, 0xe600, 0, &reset_y, 1);
 
-        while (!file.eof()) {
-            std::string record;
-            file >> record;
-
-            if (!(record.length() > 0))
-                continue;
-
-            // check for valid record
-            if (not checksum(&record)
-                or not parse_record(&record, len, addr, type, data)) {
-                throw uhd::io_error("usrp_load_firmware: bad record checksum");
-            }
-
-            // type 0x00 is data
-            if (type == 0x00) {
-                int ret = usrp_control_write(FX2_FIRMWARE_LOAD, addr, 0, data, len);
-                if (ret < 0)
-                    throw uhd::io_error("usrp_load_firmware: usrp_control_write failed");
-            }
-            // type 0x01 is end
-            else if (type == 0x01) {
-                usrp_set_firmware_hash(hash); // set hash before reset
-                usrp_control_write(FX2_FIRMWARE_LOAD, 0xe600, 0, &reset_n, 1);
-                file.close();
-
-                // wait for things to settle
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                if (load_img_msg)
-                    UHD_LOGGER_INFO("FX2") << "Firmware loaded";
-                return;
-            }
-            // type anything else is unhandled
-            else {
-                throw uhd::io_error("usrp_load_firmware: unsupported record");
-            }
-        }
+        // upload the firmware, filling the 8051 RAM with a few large control
+        // transfers instead of one per hex record (the upper address bits
+        // are ignored, the FX2 address space is 16 bits)
+        ihex_reader file_reader(filestring);
+        file_reader.read_coalesced(
+            [this](uint16_t addr, uint16_t, unsigned char* data, uint16_t len) -> int {
+                return usrp_control_write(FX2_FIRMWARE_LOAD, addr, 0, data, len);
+            },
+            FX2_MAX_FW_XFER_SIZE);
+
+        usrp_set_firmware_hash(hash); // set hash before reset
+        usrp_control_write(FX2_FIRMWARE_LOAD, 0xe600, 0, &reset_n, 1);
 
-        // file did not end
-        throw uhd::io_error("usrp_load_firmware: bad record");
+        // wait for things to settle
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        if (load_img_msg)
+            UHD_LOGGER_INFO("FX2") << "Firmware loaded";
     }
 
     void usrp_init(void)
@@ -18,6 +18,11 @@ static const char* send_offload_str             = "send_offload";
 static const char* recv_offload_wait_mode_str   = "recv_offload_wait_mode";
 static const char* send_offload_wait_mode_str   = "send_offload_wait_mode";
 static const char* num_poll_offload_threads_str = "num_poll_offload_threads";
+static const char* recv_busy_poll_spin_str      = "recv_busy_poll_spin";
+static const char* offload_spin_count_str       = "offload_spin_count";
+static const char* offload_thread_prio_str      = "offload_thread_prio";
+static const char* offload_thread_policy_str    = "offload_thread_policy";
+static const char* isolation_class_str          = "isolation_class";
 
 static const std::regex recv_offload_thread_cpu_expr("^recv_offload_thread_(\\d+)_cpu");
 static const std::regex send_offload_thread_cpu_expr("^send_offload_thread_(\\d+)_cpu");
@@ -42,7 +47,25 @@ io_service_args_t::wait_mode_t get_wait_mode_arg(const device_addr_t& args,
 {
     constrained_device_args_t::enum_arg<io_service_args_t::wait_mode_t> arg(key,
         def,
-        {{"poll", io_service_args_t::POLL}, {"block", io_service_args_t::BLOCK}});
+        {{"poll", io_service_args_t::POLL},
+            {"block", io_service_args_t::BLOCK},
+            {"adaptive", io_service_args_t::ADAPTIVE}});
+
+    if (args.has_key(key)) {
+        arg.parse(args[key]);
+    }
+    return arg.get();
+}
+
+io_service_args_t::isolation_class_t get_isolation_class_arg(const device_addr_t& args,
+    const std::string& key,
+    const io_service_args_t::isolation_class_t def)
+{
+    constrained_device_args_t::enum_arg<io_service_args_t::isolation_class_t> arg(key,
+        def,
+        {{"default", io_service_args_t::ISOLATION_DEFAULT},
+            {"latency", io_service_args_t::ISOLATION_LATENCY},
+            {"bulk", io_service_args_t::ISOLATION_BULK}});
 
     if (args.has_key(key)) {
         arg.parse(args[key]);
@@ -77,6 +100,37 @@ io_service_args_t read_io_service_args(
         io_srv_args.num_poll_offload_threads = 1;
     }
 
+    io_srv_args.recv_busy_poll_spin =
+        args.cast<size_t>(recv_busy_poll_spin_str, defaults.recv_busy_poll_spin);
+
+    io_srv_args.offload_spin_count =
+        args.cast<size_t>(offload_spin_count_str, defaults.offload_spin_count);
+
+    io_srv_args.offload_thread_prio = defaults.offload_thread_prio;
+    if (args.has_key(offload_thread_prio_str)) {
+        const double prio = args.cast<double>(offload_thread_prio_str, 0.0);
+        if (prio < -1.0 || prio > 1.0) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Invalid value for offload_thread_prio. "
+                "Value must be between -1.0 and 1.0.");
+        } else {
+            io_srv_args.offload_thread_prio = prio;
+        }
+    }
+
+    io_srv_args.offload_thread_realtime = [&]() {
+        constrained_device_args_t::enum_arg<bool> arg(offload_thread_policy_str,
+            defaults.offload_thread_realtime,
+            {{"timeshare", false}, {"realtime", true}});
+        if (args.has_key(offload_thread_policy_str)) {
+            arg.parse(args[offload_thread_policy_str]);
+        }
+        return arg.get();
+    }();
+
+    io_srv_args.isolation_class =
+        get_isolation_class_arg(args, isolation_class_str, defaults.isolation_class);
+
     auto read_thread_args = [&args](
                                 const std::regex& expr, std::map<size_t, size_t>& dest) {
         auto keys = args.keys();
@@ -118,6 +172,11 @@ device_addr_t merge_io_service_dev_args(
     merge_args(dev_args, args, recv_offload_wait_mode_str);
     merge_args(dev_args, args, send_offload_wait_mode_str);
     merge_args(dev_args, args, num_poll_offload_threads_str);
+    merge_args(dev_args, args, recv_busy_poll_spin_str);
+    merge_args(dev_args, args, offload_spin_count_str);
+    merge_args(dev_args, args, offload_thread_prio_str);
+    merge_args(dev_args, args, offload_thread_policy_str);
+    merge_args(dev_args, args, isolation_class_str);
 
     auto merge_thread_args = [&merge_args](const device_addr_t& dev_args,
                                  device_addr_t& stream_args,
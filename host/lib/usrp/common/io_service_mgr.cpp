@@ -8,6 +8,7 @@
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #ifdef HAVE_DPDK
@@ -16,6 +17,8 @@
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/usrp/constrained_device_args.hpp>
 #include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 
 using namespace uhd;
@@ -23,6 +26,10 @@ using namespace uhd::transport;
 
 static const std::string LOG_ID = "IO_SRV";
 
+//! Default receive spin budget (link polls between scheduler yields) for
+//! streams in the "latency" isolation class
+static constexpr size_t LATENCY_CLASS_SPIN_BUDGET = 1000;
+
 namespace uhd { namespace usrp {
 
 /* This file defines an I/O service manager implementation, io_service_mgr_impl.
@@ -40,8 +47,9 @@ namespace uhd { namespace usrp {
 class inline_io_service_mgr
 {
 public:
-    io_service::sptr connect_links(
-        recv_link_if::sptr recv_link, send_link_if::sptr send_link);
+    io_service::sptr connect_links(recv_link_if::sptr recv_link,
+        send_link_if::sptr send_link,
+        const size_t recv_spin_budget);
 
     void disconnect_links(recv_link_if::sptr recv_link, send_link_if::sptr send_link);
 
@@ -56,8 +64,9 @@ private:
     std::map<link_pair_t, link_info_t> _link_info_map;
 };
 
-io_service::sptr inline_io_service_mgr::connect_links(
-    recv_link_if::sptr recv_link, send_link_if::sptr send_link)
+io_service::sptr inline_io_service_mgr::connect_links(recv_link_if::sptr recv_link,
+    send_link_if::sptr send_link,
+    const size_t recv_spin_budget)
 {
     // Check if links are already connected
     const link_pair_t links{recv_link, send_link};
@@ -70,7 +79,13 @@ io_service::sptr inline_io_service_mgr::connect_links(
     }
 
     // Links are not muxed, create a new inline I/O service
-    auto io_srv = inline_io_service::make();
+    auto io_srv = inline_io_service::make(recv_spin_budget);
+
+    if (recv_spin_budget > 0) {
+        UHD_LOG_INFO(LOG_ID,
+            "Creating new busy-polling inline I/O service, spin budget "
+                << recv_spin_budget);
+    }
 
     if (recv_link) {
         io_srv->attach_recv_link(recv_link);
@@ -250,6 +265,8 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
     params.client_type = (link_type == link_type_t::RX_DATA)
                              ? offload_io_service::RECV_ONLY
                              : offload_io_service::SEND_ONLY;
+    params.thread_priority   = args.offload_thread_prio;
+    params.realtime_priority = args.offload_thread_realtime;
 
     const auto& cpu_map = (link_type == link_type_t::RX_DATA)
                               ? args.recv_offload_thread_cpu
@@ -383,7 +400,17 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
 {
     offload_io_service::params_t params;
     params.client_type = offload_io_service::BOTH_SEND_AND_RECV;
-    params.wait_mode   = offload_io_service::POLL;
+
+    // An adaptive wait mode in either direction makes the whole thread
+    // adaptive, since one polling thread services both directions
+    const bool adaptive =
+        args.recv_offload_wait_mode == io_service_args_t::ADAPTIVE
+        || args.send_offload_wait_mode == io_service_args_t::ADAPTIVE;
+    params.wait_mode = adaptive ? offload_io_service::ADAPTIVE
+                                : offload_io_service::POLL;
+    params.adaptive_spin_count = args.offload_spin_count;
+    params.thread_priority     = args.offload_thread_prio;
+    params.realtime_priority   = args.offload_thread_realtime;
 
     const auto& cpu_map = args.poll_offload_thread_cpu;
 
@@ -396,7 +423,9 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
         cpu_affinity_str = ", cpu affinity: none";
     }
 
-    UHD_LOG_INFO(LOG_ID, "Creating new polling I/O service" << cpu_affinity_str);
+    UHD_LOG_INFO(LOG_ID,
+        "Creating new " << (adaptive ? "adaptive" : "polling") << " I/O service"
+                        << cpu_affinity_str);
 
     return offload_io_service::make(inline_io_service::make(), params);
 }
@@ -437,8 +466,16 @@ private:
     bool _out_of_order_supported(
         recv_link_if::sptr recv_link, send_link_if::sptr send_link) const;
 
+    void _apply_adapter_caps(recv_link_if::sptr recv_link,
+        send_link_if::sptr send_link,
+        const link_type_t link_type,
+        io_service_args_t& defaults);
+
     const uhd::device_addr_t _args;
 
+    // Adapters whose capabilities were already checked and logged
+    std::set<adapter_id_t> _caps_checked;
+
     inline_io_service_mgr _inline_io_srv_mgr;
     blocking_io_service_mgr _blocking_io_srv_mgr;
     polling_io_service_mgr _polling_io_srv_mgr;
@@ -462,6 +499,30 @@ io_service_mgr::sptr io_service_mgr::make(const uhd::device_addr_t& args)
             "Cannot instantiate DPDK I/O service. Proceeding with regular I/O service.");
 #endif
     }
+
+    // With shared_io_srv_mgr, all sessions in this process that request it
+    // share a single manager, so their streamers' links are scheduled onto
+    // one set of offload worker threads. This is intended for applications
+    // that open one session per device but stream from all of them, e.g.
+    // through an aggregate streamer. The first such session's args configure
+    // the shared manager; thread-count and affinity args of later sessions
+    // are ignored.
+    constrained_device_args_t::bool_arg shared_mgr("shared_io_srv_mgr", false);
+    if (args.has_key(shared_mgr.key())) {
+        shared_mgr.parse(args[shared_mgr.key()]);
+    }
+    if (shared_mgr.get()) {
+        static std::mutex shared_mgr_mutex;
+        static std::weak_ptr<io_service_mgr> shared_mgr_ref;
+        std::lock_guard<std::mutex> lock(shared_mgr_mutex);
+        auto mgr = shared_mgr_ref.lock();
+        if (not mgr) {
+            mgr            = std::make_shared<io_service_mgr_impl>(args);
+            shared_mgr_ref = mgr;
+        }
+        return mgr;
+    }
+
     return std::make_shared<io_service_mgr_impl>(args);
 }
 
@@ -481,6 +542,8 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
         default_args.send_offload = false;
     }
 
+    _apply_adapter_caps(recv_link, send_link, link_type, default_args);
+
     const io_service_args_t args =
         read_io_service_args(merge_io_service_dev_args(_args, stream_args), default_args);
 
@@ -501,6 +564,14 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
         // on user parameters and connect them.
         if (link_type == link_type_t::CTRL) {
             io_srv_type = INLINE_IO_SRV;
+        } else if (args.isolation_class == io_service_args_t::ISOLATION_LATENCY) {
+            // Latency class: dedicated inline service, so all I/O runs in
+            // the caller's thread and no shared worker can delay this stream
+            io_srv_type = INLINE_IO_SRV;
+        } else if (args.isolation_class == io_service_args_t::ISOLATION_BULK) {
+            // Bulk class: share the polling offload workers with the other
+            // bulk streams, keeping throughput traffic off latency streams
+            io_srv_type = POLLING_IO_SRV;
         } else {
             bool offload = (link_type == link_type_t::RX_DATA) ? args.recv_offload
                                                                : args.send_offload;
@@ -509,7 +580,8 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
                                  : args.send_offload_wait_mode;
 
             if (offload) {
-                if (wait_mode == io_service_args_t::POLL) {
+                if (wait_mode == io_service_args_t::POLL
+                    || wait_mode == io_service_args_t::ADAPTIVE) {
                     io_srv_type = POLLING_IO_SRV;
                 } else {
                     io_srv_type = BLOCKING_IO_SRV;
@@ -531,9 +603,21 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
     }
 
     switch (io_srv_type) {
-        case INLINE_IO_SRV:
-            io_srv = _inline_io_srv_mgr.connect_links(recv_link, send_link);
+        case INLINE_IO_SRV: {
+            // Busy-polling is only for data links; control links spend most
+            // of their time waiting for responses and would pin a core
+            size_t recv_spin_budget =
+                (link_type == link_type_t::CTRL) ? 0 : args.recv_busy_poll_spin;
+            // The latency class implies busy-polling; an explicit
+            // recv_busy_poll_spin arg still overrides the budget
+            if (link_type != link_type_t::CTRL and recv_spin_budget == 0
+                and args.isolation_class == io_service_args_t::ISOLATION_LATENCY) {
+                recv_spin_budget = LATENCY_CLASS_SPIN_BUDGET;
+            }
+            io_srv =
+                _inline_io_srv_mgr.connect_links(recv_link, send_link, recv_spin_budget);
             break;
+        }
         case BLOCKING_IO_SRV:
             io_srv = _blocking_io_srv_mgr.connect_links(
                 recv_link, send_link, link_type, args, streamer_id);
@@ -573,6 +657,61 @@ void io_service_mgr_impl::disconnect_links(
     _link_info_map.erase(it);
 }
 
+void io_service_mgr_impl::_apply_adapter_caps(recv_link_if::sptr recv_link,
+    send_link_if::sptr send_link,
+    const link_type_t link_type,
+    io_service_args_t& defaults)
+{
+    if (link_type == link_type_t::CTRL) {
+        return;
+    }
+
+    const adapter_id_t adapter_id = recv_link ? recv_link->get_recv_adapter_id()
+                                              : send_link->get_send_adapter_id();
+    const auto caps = adapter_ctx::get().get_capabilities(adapter_id);
+    if (not caps.valid) {
+        return;
+    }
+
+    // Warn once per adapter about host configurations that silently cost
+    // throughput, since these are otherwise hard to spot
+    if (_caps_checked.insert(adapter_id).second) {
+        if (recv_link && caps.mtu != 0 && recv_link->get_recv_frame_size() > caps.mtu) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Receive frame size (" << recv_link->get_recv_frame_size()
+                                       << " bytes) exceeds the interface MTU ("
+                                       << caps.mtu
+                                       << " bytes). Increase the interface MTU to "
+                                          "avoid dropped or fragmented packets.");
+        }
+        if (send_link && caps.mtu != 0 && send_link->get_send_frame_size() > caps.mtu) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Send frame size (" << send_link->get_send_frame_size()
+                                    << " bytes) exceeds the interface MTU (" << caps.mtu
+                                    << " bytes). Increase the interface MTU to "
+                                       "avoid dropped or fragmented packets.");
+        }
+        if (not caps.rx_csum_offload or not caps.tx_csum_offload) {
+            UHD_LOG_WARNING(LOG_ID,
+                "The network adapter has checksum offload disabled, which "
+                "increases CPU load during streaming. Enable it with "
+                "ethtool -K <interface> rx on tx on.");
+        }
+    }
+
+    // Spread polling offload threads over the adapter's queues. This only
+    // adjusts the default: an explicit num_poll_offload_threads arg from the
+    // user always wins in read_io_service_args().
+    const size_t num_queues = std::max(caps.num_rx_queues, caps.num_tx_queues);
+    if (num_queues > 1) {
+        // More threads than this show diminishing returns and just burn cores
+        constexpr size_t MAX_AUTO_POLL_THREADS = 4;
+        defaults.num_poll_offload_threads      = std::max(
+            defaults.num_poll_offload_threads,
+            std::min(num_queues, MAX_AUTO_POLL_THREADS));
+    }
+}
+
 bool io_service_mgr_impl::_out_of_order_supported(
     recv_link_if::sptr recv_link, send_link_if::sptr send_link) const
 {
@@ -8,7 +8,10 @@
 #include <uhdlib/usrp/common/lmx2592.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
+#include <map>
+#include <tuple>
 
 using namespace uhd;
 
@@ -33,6 +36,8 @@ constexpr double LMX2592_MAX_POSTR_DIV_OUT_FREQ = 125e6;
 
 constexpr double DEFAULT_LMX2592_SPUR_DODGING_THRESHOLD = 2e6; // Hz
 
+constexpr size_t LMX2592_MAX_TUNE_CACHE_ENTRIES = 1024;
+
 constexpr int MAX_N_DIVIDER = 4095;
 
 constexpr int MAX_MASH_ORDER = 4;
@@ -172,6 +177,19 @@ public:
             throw runtime_error("Requested frequency is out of the supported range");
         }
 
+        // Divider solutions depend only on the tune arguments, the reference
+        // frequency and the mash order (the cache is cleared when the latter
+        // two change), so they are memoized: repeated tunes to the same
+        // frequency (e.g. scan patterns) skip the solver and the spur dodging
+        // searches below.
+        const tune_key_t tune_key(static_cast<int64_t>(std::llround(target_freq)),
+            spur_dodging,
+            static_cast<int64_t>(std::llround(spur_dodging_threshold)));
+        const auto cached = _tune_cache.find(tune_key);
+        if (cached != _tune_cache.end()) {
+            return _apply_tune_solution(cached->second);
+        }
+
         // Find the largest possible divider
         auto output_divider_index = 0;
         for (auto limit : LMX2592_CHDIV_MIN_FREQ) {
@@ -279,6 +297,26 @@ public:
 
         UHD_LOGGER_TRACE("LMX2592") << "Tuned to " << actual_f_lo;
 
+        // Memoize the solution for subsequent tunes to the same frequency
+        if (_tune_cache.size() >= LMX2592_MAX_TUNE_CACHE_ENTRIES) {
+            _tune_cache.clear();
+        }
+        tune_solution_t& sol = _tune_cache[tune_key];
+        sol.chdiv_index      = output_divider_index;
+        sol.osc_doubler      = _regs.osc_doubler;
+        sol.pll_r_pre        = _regs.pll_r_pre;
+        sol.mult             = _regs.mult;
+        sol.pll_r            = _regs.pll_r;
+        sol.pll_n_pre        = _regs.pll_n_pre;
+        sol.pll_n            = _regs.pll_n;
+        sol.pll_num_lsb      = _regs.pll_num_lsb;
+        sol.pll_num_msb      = _regs.pll_num_msb;
+        sol.pll_den_lsb      = _regs.pll_den_lsb;
+        sol.pll_den_msb      = _regs.pll_den_msb;
+        sol.mash_seed_lsb    = _regs.mash_seed_lsb;
+        sol.mash_seed_msb    = _regs.mash_seed_msb;
+        sol.actual_f_lo      = actual_f_lo;
+
         // Toggle fcal field to start calibration
         _regs.fcal_enable = 0;
         commit();
@@ -309,6 +347,7 @@ public:
         } else if (mash_order == mash_order_t::FOURTH) {
             _regs.mash_order = lmx2592_regs_t::mash_order_t::MASH_ORDER_FOURTH;
         }
+        _tune_cache.clear();
     }
 
     void set_reference_frequency(const double ref_freq) override
@@ -319,6 +358,7 @@ public:
         }
 
         _ref_freq = ref_freq;
+        _tune_cache.clear();
     }
 
     void set_output_power(const output_t output, const unsigned int power) override
@@ -425,11 +465,67 @@ private: // Members
     //! Read functor: Return value given address
     using read_fn_t = std::function<uint16_t(uint8_t)>;
 
+    //! The frequency dependent register values of one divider solution,
+    // memoized in _tune_cache (see set_frequency)
+    struct tune_solution_t
+    {
+        int chdiv_index;
+        int osc_doubler;
+        uint16_t pll_r_pre;
+        uint8_t mult;
+        uint8_t pll_r;
+        lmx2592_regs_t::pll_n_pre_t pll_n_pre;
+        uint16_t pll_n;
+        uint16_t pll_num_lsb;
+        uint16_t pll_num_msb;
+        uint16_t pll_den_lsb;
+        uint16_t pll_den_msb;
+        uint16_t mash_seed_lsb;
+        uint16_t mash_seed_msb;
+        double actual_f_lo;
+    };
+    //! Cache key: target frequency quantized to 1 Hz, spur dodging on/off,
+    // and the spur dodging threshold quantized to 1 Hz
+    using tune_key_t = std::tuple<int64_t, bool, int64_t>;
+
+    //! Load a memoized divider solution and start the VCO calibration
+    double _apply_tune_solution(const tune_solution_t& sol)
+    {
+        _set_chdiv_values(sol.chdiv_index);
+        _regs.osc_doubler   = sol.osc_doubler;
+        _regs.pll_r_pre     = sol.pll_r_pre;
+        _regs.mult          = sol.mult;
+        _regs.pll_r         = sol.pll_r;
+        _regs.pll_n_pre     = sol.pll_n_pre;
+        _regs.pll_n         = sol.pll_n;
+        _regs.pll_num_lsb   = sol.pll_num_lsb;
+        _regs.pll_num_msb   = sol.pll_num_msb;
+        _regs.pll_den_lsb   = sol.pll_den_lsb;
+        _regs.pll_den_msb   = sol.pll_den_msb;
+        _regs.mash_seed_lsb = sol.mash_seed_lsb;
+        _regs.mash_seed_msb = sol.mash_seed_msb;
+
+        UHD_LOGGER_TRACE("LMX2592") << "Tuned to " << sol.actual_f_lo << " (cached)";
+
+        // Toggle fcal field to start calibration
+        _regs.fcal_enable = 0;
+        commit();
+
+        _regs.fcal_enable = 1;
+        commit();
+
+        UHD_LOGGER_TRACE("LMX2592")
+            << "PLL lock status: " << (get_lock_status() ? "Locked" : "Unlocked");
+
+        return sol.actual_f_lo;
+    }
+
     write_fn_t _write_fn;
     read_fn_t _read_fn;
     lmx2592_regs_t _regs;
     bool _rewrite_regs;
     double _ref_freq;
+    std::map<tune_key_t, tune_solution_t> _tune_cache;
 
     void _set_chdiv_values(const int output_divider_index)
     {
@@ -10,9 +10,9 @@
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/usrp/common/recv_packet_demuxer.hpp>
+#include <uhdlib/utils/bounded_queue.hpp>
 #include <boost/thread/mutex.hpp>
-#include <deque>
-#include <queue>
+#include <memory>
 #include <vector>
 
 using namespace uhd;
@@ -51,20 +51,32 @@ public:
     recv_packet_demuxer_impl(transport::zero_copy_if::sptr transport,
         const size_t size,
         const uint32_t sid_base)
-        : _transport(transport), _sid_base(sid_base), _queues(size)
+        : _transport(transport), _sid_base(sid_base)
     {
-        /* NOP */
+        // The number of outstanding buffers is bounded by the transport's
+        // frame pool, so queues of that depth can never drop
+        for (size_t i = 0; i < size; i++) {
+            _queues.push_back(std::make_shared<queue_type>(
+                std::max<size_t>(1, transport->get_num_recv_frames())));
+        }
     }
 
     managed_recv_buffer::sptr get_recv_buff(const size_t index, const double timeout)
     {
-        boost::mutex::scoped_lock lock(_mutex);
         managed_recv_buffer::sptr buff;
 
-        // there is already an entry in the queue, so pop that
-        if (not _queues[index].wrapper.empty()) {
-            std::swap(buff, _queues[index].wrapper.front());
-            _queues[index].wrapper.pop();
+        // there is already an entry in the queue, so pop that. This path is
+        // lock-free: another channel's reader may have demuxed for us.
+        if (_queues[index]->pop_with_haste(buff)) {
+            return buff;
+        }
+
+        // the transport itself is single-reader, so take the lock for it
+        boost::mutex::scoped_lock lock(_mutex);
+
+        // re-check after acquiring: whoever held the lock before us may have
+        // demuxed a packet for this channel in the meantime
+        if (_queues[index]->pop_with_haste(buff)) {
             return buff;
         }
 
@@ -81,7 +93,7 @@ public:
 
             // otherwise queue and try again
             if (rx_index < _queues.size())
-                _queues[rx_index].wrapper.push(buff);
+                _queues[rx_index]->push_with_pop_on_full(buff);
             else {
                 UHD_LOGGER_ERROR("STREAMER")
                     << "Got a data packet with unknown SID " << extract_sid(buff);
@@ -103,14 +115,9 @@ public:
 private:
     transport::zero_copy_if::sptr _transport;
     const uint32_t _sid_base;
-    boost::mutex _mutex;
-    struct channel_guts_type
-    {
-        channel_guts_type(void) : wrapper(container) {}
-        std::deque<managed_recv_buffer::sptr> container;
-        std::queue<managed_recv_buffer::sptr> wrapper;
-    };
-    std::vector<channel_guts_type> _queues;
+    boost::mutex _mutex; // guards the transport, not the queues
+    typedef uhd::utils::bounded_queue<managed_recv_buffer::sptr> queue_type;
+    std::vector<std::shared_ptr<queue_type>> _queues;
 };
 
 recv_packet_demuxer::sptr recv_packet_demuxer::make(
@@ -61,11 +61,14 @@ public:
     /**************************************************************************
      * Structors
      *************************************************************************/
-    dma_fifo_core_3000_impl(
-        poke32_fn_t&& poke_fn, peek32_fn_t&& peek_fn, const size_t fifo_index)
+    dma_fifo_core_3000_impl(poke32_fn_t&& poke_fn,
+        peek32_fn_t&& peek_fn,
+        peek64_fn_t&& peek64_fn,
+        const size_t fifo_index)
         : _fifo_index(fifo_index)
         , poke32(std::move(poke_fn))
         , peek32(std::move(peek_fn))
+        , _peek64(std::move(peek64_fn))
         , _has_bist(unpack_fifo_info(peek32(REG_FIFO_INFO)))
         , _mem_size(peek32(REG_FIFO_MEM_SIZE))
         , _bist_clk_rate(_has_bist ? peek32(REG_BIST_CLK_RATE) : 0.0)
@@ -272,10 +275,16 @@ private:
     const size_t _fifo_index;
     poke32_fn_t poke32;
     peek32_fn_t peek32;
+    //! Optional batched 64-bit read provided by the owner (may be empty)
+    peek64_fn_t _peek64;
 
-    //! Convenience function to do two consecutive peek32's
+    //! Read a 64-bit register, using the owner's batched reader when
+    // available, and two consecutive peek32's otherwise
     uint64_t peek64(const uint32_t addr)
     {
+        if (_peek64) {
+            return _peek64(addr);
+        }
         const uint32_t lo = peek32(addr);
         const uint32_t hi = peek32(addr + 4);
         return static_cast<uint64_t>(lo) | (static_cast<uint64_t>(hi) << 32);
@@ -314,9 +323,11 @@ private:
 //
 // Factory
 //
-dma_fifo_core_3000::sptr dma_fifo_core_3000::make(
-    poke32_fn_t&& poke_fn, peek32_fn_t&& peek_fn, const size_t fifo_index)
+dma_fifo_core_3000::sptr dma_fifo_core_3000::make(poke32_fn_t&& poke_fn,
+    peek32_fn_t&& peek_fn,
+    const size_t fifo_index,
+    peek64_fn_t&& peek64_fn)
 {
     return std::make_shared<dma_fifo_core_3000_impl>(
-        std::move(poke_fn), std::move(peek_fn), fifo_index);
+        std::move(poke_fn), std::move(peek_fn), std::move(peek64_fn), fifo_index);
 }
@@ -672,6 +672,101 @@ public:
         return locked;
     }
 
+    retune_schedule_t compile_retune_schedule(channel_t ch,
+        const std::vector<double>& lo1_freqs,
+        const std::vector<double>& lo2_freqs)
+    {
+        boost::lock_guard<boost::mutex> lock(_mutex);
+        static const double RESOLUTION = 1e3;
+
+        if (lo1_freqs.size() != lo2_freqs.size()) {
+            throw uhd::value_error(
+                "LO1 and LO2 frequency lists must have the same length");
+        }
+        if (lo1_freqs.empty()) {
+            throw uhd::value_error("cannot compile an empty retune schedule");
+        }
+        // The captured sequences only contain the frequency update registers,
+        // so the synthesizers must have gone through a full register sync
+        // (i.e. at least one regular tune) before a schedule can be compiled.
+        for (size_t c = 0; c < NUM_CHANS; c++) {
+            if ((ch == channel_t(c) or ch == BOTH)
+                and (_lo1_freq[c].get() == tune_freq_t()
+                        or _lo2_freq[c].get() == tune_freq_t())) {
+                throw uhd::runtime_error(
+                    "channel must be tuned once before compiling a retune schedule");
+            }
+        }
+
+        // For BOTH, capture from channel 1's synthesizers; the replay route
+        // enables the latches for both channels simultaneously (same scheme
+        // as the simultaneous commit in _commit())
+        const size_t chx = (ch == CH2) ? size_t(CH2) : size_t(CH1);
+
+        retune_schedule_t sched(lo1_freqs.size());
+        for (size_t i = 0; i < sched.size(); i++) {
+            retune_entry_t& entry = sched[i];
+            entry.lo1_freq =
+                _lo1_iface[chx]->set_frequency(lo1_freqs[i], RESOLUTION, false);
+            entry.lo2_freq = _lo2_iface[chx]->set_frequency(lo2_freqs[i], false, false);
+            // Divert the SPI writes of the commit into the schedule entry
+            // instead of programming the hardware
+            _lo_spi_capture = &entry.lo1_regs;
+            _lo1_iface[chx]->commit();
+            _lo_spi_capture = &entry.lo2_regs;
+            _lo2_iface[chx]->commit();
+            _lo_spi_capture = nullptr;
+        }
+
+        // The loop above never touched the hardware, which still holds the
+        // pre-compile state. Commit the last entry for real to bring the
+        // synthesizers back in sync with the driver.
+        _config_lo_route(LO1, ch);
+        _lo1_iface[chx]->commit();
+        _config_lo_route(LO2, ch);
+        _lo2_iface[chx]->commit();
+        for (size_t c = 0; c < NUM_CHANS; c++) {
+            if (ch == channel_t(c) or ch == BOTH) {
+                _lo1_freq[c] = tune_freq_t(sched.back().lo1_freq);
+                _lo1_freq[c].mark_clean();
+                _lo2_freq[c] = tune_freq_t(sched.back().lo2_freq);
+                _lo2_freq[c].mark_clean();
+            }
+        }
+        return sched;
+    }
+
+    void replay_retune(channel_t ch,
+        const retune_entry_t& entry,
+        const uhd::time_spec_t& time = uhd::time_spec_t(0.0))
+    {
+        boost::lock_guard<boost::mutex> lock(_mutex);
+        if (entry.lo1_regs.empty() or entry.lo2_regs.empty()) {
+            throw uhd::value_error("retune entry was not compiled");
+        }
+        // Stamp every write of this hop with the same command time so the
+        // motherboard queues the whole batch and releases it synchronously
+        if (time != uhd::time_spec_t(0.0)) {
+            _db_iface->set_command_time(time);
+        }
+        _config_lo_route(LO1, ch);
+        _write_lo_spi(dboard_iface::UNIT_TX, entry.lo1_regs);
+        _config_lo_route(LO2, ch);
+        _write_lo_spi(dboard_iface::UNIT_RX, entry.lo2_regs);
+        if (time != uhd::time_spec_t(0.0)) {
+            _db_iface->set_command_time(uhd::time_spec_t(0.0));
+        }
+        // Keep the bookkeeping in agreement with the hardware state
+        for (size_t c = 0; c < NUM_CHANS; c++) {
+            if (ch == channel_t(c) or ch == BOTH) {
+                _lo1_freq[c] = tune_freq_t(entry.lo1_freq);
+                _lo1_freq[c].mark_clean();
+                _lo2_freq[c] = tune_freq_t(entry.lo2_freq);
+                _lo2_freq[c].mark_clean();
+            }
+        }
+    }
+
 private: // Functions
     void _set_cal_mode(cal_mode_t cal_mode, lo_export_source_t lo1_export_src)
     {
@@ -717,6 +812,12 @@ private: // Functions
 
     void _write_lo_spi(dboard_iface::unit_t unit, const std::vector<uint32_t>& regs)
     {
+        if (_lo_spi_capture) {
+            // A retune schedule compilation is in progress: record the words
+            // instead of programming the synthesizer
+            _lo_spi_capture->insert(_lo_spi_capture->end(), regs.begin(), regs.end());
+            return;
+        }
         for (uint32_t reg : regs) {
             _db_iface->write_spi(unit, _spi_config, reg, 32);
         }
@@ -854,6 +955,9 @@ private: // Members
     lo_export_source_t _lo1_export;
     lo_export_source_t _lo2_export;
     bool _chan_enabled[NUM_CHANS];
+    //! When non-null, _write_lo_spi appends to this buffer instead of
+    // writing hardware (see compile_retune_schedule)
+    std::vector<uint32_t>* _lo_spi_capture = nullptr;
 };
 
 twinrx_ctrl::sptr twinrx_ctrl::make(dboard_iface::sptr db_iface,
@@ -10,8 +10,11 @@
 
 #include "twinrx_io.hpp"
 #include <uhd/types/ranges.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhd/utils/noncopyable.hpp>
+#include <cstdint>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace dboard { namespace twinrx {
 
@@ -104,6 +107,45 @@ public:
     virtual bool read_lo1_locked(channel_t ch) = 0;
 
     virtual bool read_lo2_locked(channel_t ch) = 0;
+
+    /*!
+     * One entry of a precompiled retune schedule: the coerced LO frequencies
+     * plus the exact SPI words that reproduce the frequency update on the
+     * synthesizers. Entries are produced by compile_retune_schedule() and
+     * consumed by replay_retune().
+     */
+    struct retune_entry_t
+    {
+        double lo1_freq = 0.0; //!< Coerced LO1 synthesizer frequency
+        double lo2_freq = 0.0; //!< Coerced LO2 synthesizer frequency
+        std::vector<uint32_t> lo1_regs; //!< Captured LO1 SPI register writes
+        std::vector<uint32_t> lo2_regs; //!< Captured LO2 SPI register writes
+    };
+
+    typedef std::vector<retune_entry_t> retune_schedule_t;
+
+    /*!
+     * Precompute the synthesizer register sequences for a list of LO
+     * frequency pairs so that hopping along the list does not have to run
+     * the frequency planning math or serialize a tune through the driver
+     * per hop. The channel must have been tuned normally at least once
+     * before a schedule can be compiled, and on return it is left tuned to
+     * the last entry of the schedule. The captured sequences embed the
+     * output enable and LO source configuration in effect at compile time,
+     * so that configuration must not change between compile and replay.
+     */
+    virtual retune_schedule_t compile_retune_schedule(channel_t ch,
+        const std::vector<double>& lo1_freqs,
+        const std::vector<double>& lo2_freqs) = 0;
+
+    /*!
+     * Replay one precompiled retune entry. If a non-zero time is given, all
+     * writes of the hop are stamped with that command time so they are
+     * released synchronously by the motherboard command queue.
+     */
+    virtual void replay_retune(channel_t ch,
+        const retune_entry_t& entry,
+        const uhd::time_spec_t& time = uhd::time_spec_t(0.0)) = 0;
 };
 
 }}}} // namespace uhd::usrp::dboard::twinrx
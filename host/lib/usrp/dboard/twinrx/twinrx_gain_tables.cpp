@@ -10,8 +10,14 @@
 
 using namespace uhd::usrp::dboard::twinrx;
 
+// The gain tables are returned by accessor functions so their ~750 entries
+// are only constructed on first use (i.e., when a TwinRX is actually
+// configured) instead of at library load.
+
 // clang-format off
-static const std::vector<twinrx_gain_config_t> HIGHBAND1_TABLE{
+static const std::vector<twinrx_gain_config_t>& highband1_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                     Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -28.3,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -28.3,   31,   31, false, false ),
@@ -107,9 +113,13 @@ static const std::vector<twinrx_gain_config_t> HIGHBAND1_TABLE{
         twinrx_gain_config_t(     91,   56.3,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   57.3,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   58.3,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> HIGHBAND2_TABLE{
+static const std::vector<twinrx_gain_config_t>& highband2_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -30.9,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -30.9,   31,   31, false, false ),
@@ -205,9 +215,13 @@ static const std::vector<twinrx_gain_config_t> HIGHBAND2_TABLE{
         twinrx_gain_config_t(     91,   53.4,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   54.4,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   55.4,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> HIGHBAND3_TABLE{
+static const std::vector<twinrx_gain_config_t>& highband3_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -31.1,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -31.1,   31,   31, false, false ),
@@ -303,9 +317,13 @@ static const std::vector<twinrx_gain_config_t> HIGHBAND3_TABLE{
         twinrx_gain_config_t(     91,   54.0,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   55.0,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   56.0,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> HIGHBAND4_TABLE{
+static const std::vector<twinrx_gain_config_t>& highband4_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -37.2,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -37.2,   31,   31, false, false ),
@@ -401,9 +419,13 @@ static const std::vector<twinrx_gain_config_t> HIGHBAND4_TABLE{
         twinrx_gain_config_t(     91,   45.6,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   46.6,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   47.6,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> LOWBAND1_TABLE{
+static const std::vector<twinrx_gain_config_t>& lowband1_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -31.1,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -30.1,   31,   30, false, false ),
@@ -499,9 +521,13 @@ static const std::vector<twinrx_gain_config_t> LOWBAND1_TABLE{
         twinrx_gain_config_t(     91,   59.5,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   60.5,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   61.5,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> LOWBAND2_TABLE{
+static const std::vector<twinrx_gain_config_t>& lowband2_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -33.4,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -33.4,   31,   31, false, false ),
@@ -597,9 +623,13 @@ static const std::vector<twinrx_gain_config_t> LOWBAND2_TABLE{
         twinrx_gain_config_t(     91,   56.8,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   57.8,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   58.8,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> LOWBAND3_TABLE{
+static const std::vector<twinrx_gain_config_t>& lowband3_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -34.0,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -34.0,   31,   31, false, false ),
@@ -695,9 +725,13 @@ static const std::vector<twinrx_gain_config_t> LOWBAND3_TABLE{
         twinrx_gain_config_t(     91,   55.0,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   56.0,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   57.0,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 
-static const std::vector<twinrx_gain_config_t> LOWBAND4_TABLE{
+static const std::vector<twinrx_gain_config_t>& lowband4_table()
+{
+    static const std::vector<twinrx_gain_config_t> table{
         //                       Index,   Gain, Atten1, Atten2,  Amp1,  Amp2
         twinrx_gain_config_t(      0,  -32.8,   31,   31, false, false ),
         twinrx_gain_config_t(      1,  -32.8,   31,   31, false, false ),
@@ -793,7 +827,9 @@ static const std::vector<twinrx_gain_config_t> LOWBAND4_TABLE{
         twinrx_gain_config_t(     91,   55.6,    0,    2,  true,  true ),
         twinrx_gain_config_t(     92,   56.6,    0,    1,  true,  true ),
         twinrx_gain_config_t(     93,   57.6,    0,    0,  true,  true ),
-};
+    };
+    return table;
+}
 // clang-format on
 
 const twinrx_gain_table twinrx_gain_table::lookup_table(
@@ -804,24 +840,24 @@ const twinrx_gain_table twinrx_gain_table::lookup_table(
     if (signal_path == twinrx_ctrl::PATH_HIGHBAND) {
         switch (preselector_path) {
             case twinrx_ctrl::PRESEL_PATH1:
-                return twinrx_gain_table(HIGHBAND1_TABLE);
+                return twinrx_gain_table(highband1_table());
             case twinrx_ctrl::PRESEL_PATH2:
-                return twinrx_gain_table(HIGHBAND2_TABLE);
+                return twinrx_gain_table(highband2_table());
             case twinrx_ctrl::PRESEL_PATH3:
-                return twinrx_gain_table(HIGHBAND3_TABLE);
+                return twinrx_gain_table(highband3_table());
             case twinrx_ctrl::PRESEL_PATH4:
-                return twinrx_gain_table(HIGHBAND4_TABLE);
+                return twinrx_gain_table(highband4_table());
         }
     } else {
         switch (preselector_path) {
             case twinrx_ctrl::PRESEL_PATH1:
-                return twinrx_gain_table(LOWBAND1_TABLE);
+                return twinrx_gain_table(lowband1_table());
             case twinrx_ctrl::PRESEL_PATH2:
-                return twinrx_gain_table(LOWBAND2_TABLE);
+                return twinrx_gain_table(lowband2_table());
             case twinrx_ctrl::PRESEL_PATH3:
-                return twinrx_gain_table(LOWBAND3_TABLE);
+                return twinrx_gain_table(lowband3_table());
             case twinrx_ctrl::PRESEL_PATH4:
-                return twinrx_gain_table(LOWBAND4_TABLE);
+                return twinrx_gain_table(lowband4_table());
         }
     }
     throw runtime_error("NO GAIN TABLE SELECTED");
@@ -13,15 +13,16 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/date_time.hpp>
 #include <boost/format.hpp>
-#include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
 #include <boost/tokenizer.hpp>
+#include <atomic>
 #include <chrono>
 #include <ctime>
+#include <memory>
 #include <regex>
 #include <string>
 #include <thread>
-#include <tuple>
+#include <utility>
 
 using namespace uhd;
 using namespace boost::posix_time;
@@ -34,6 +35,7 @@ constexpr int GPS_SERVO_FRESHNESS       = 1000;
 constexpr int GPS_LOCK_FRESHNESS        = 2500;
 constexpr int GPS_TIMEOUT_DELAY_MS      = 200;
 constexpr int GPSDO_COMMAND_DELAY_MS    = 200;
+constexpr int GPS_POLL_INTERVAL_MS      = 100;
 } // namespace
 
 /*!
@@ -48,9 +50,35 @@ gps_ctrl::~gps_ctrl(void)
 class gps_ctrl_impl : public gps_ctrl
 {
 private:
-    std::map<std::string, std::tuple<std::string, boost::system_time, bool>> sentences;
-    boost::mutex cache_mutex;
-    boost::system_time _last_cache_update;
+    //! Timestamped GPSDO sentence (payload, time of reception)
+    using sentence_t = std::pair<std::string, boost::system_time>;
+
+    /*! Immutable view of the sentence cache.
+     *
+     * The background poller builds a fresh snapshot after every UART drain
+     * and publishes it with an atomic shared_ptr store; readers grab the
+     * current snapshot with an atomic load and never touch the UART or any
+     * lock. This keeps get_sensor() calls (and thus the property tree) from
+     * blocking behind slow serial I/O.
+     */
+    struct snapshot_t
+    {
+        std::map<std::string, sentence_t> sentences;
+        boost::system_time last_update;
+    };
+
+    //! Working copy of the sentence cache, only touched by the poller (and
+    // the constructor, before the poller starts).
+    std::map<std::string, sentence_t> sentences;
+    std::shared_ptr<const snapshot_t> _snapshot{std::make_shared<snapshot_t>()};
+
+    std::thread _poll_thread;
+    std::atomic<bool> _poll_running{false};
+
+    std::shared_ptr<const snapshot_t> _get_snapshot() const
+    {
+        return std::atomic_load(&_snapshot);
+    }
 
     std::string get_sentence(const std::string which,
         const int max_age_ms,
@@ -60,36 +88,28 @@ private:
         std::string sentence;
         boost::system_time now       = boost::get_system_time();
         boost::system_time exit_time = now + milliseconds(timeout);
-        boost::posix_time::time_duration age;
 
+        // When waiting for the next sentence, anything at or before the
+        // reception time of the currently cached one does not count.
+        boost::system_time baseline = boost::posix_time::min_date_time;
         if (wait_for_next) {
-            boost::lock_guard<boost::mutex> lock(cache_mutex);
-            update_cache();
-            // mark sentence as touched
-            if (sentences.find(which) != sentences.end())
-                std::get<2>(sentences[which]) = true;
+            auto snap     = _get_snapshot();
+            auto sent_itr = snap->sentences.find(which);
+            if (sent_itr != snap->sentences.end()) {
+                baseline = sent_itr->second.second;
+            } else {
+                baseline = now;
+            }
         }
         while (1) {
-            try {
-                boost::lock_guard<boost::mutex> lock(cache_mutex);
-
-                // update cache if older than a millisecond
-                if (now - _last_cache_update > milliseconds(1)) {
-                    update_cache();
-                }
-
-                if (sentences.find(which) == sentences.end()) {
-                    age = milliseconds(max_age_ms);
-                } else {
-                    age = boost::get_system_time() - std::get<1>(sentences[which]);
-                }
+            auto snap     = _get_snapshot();
+            auto sent_itr = snap->sentences.find(which);
+            if (sent_itr != snap->sentences.end()) {
+                const auto age = boost::get_system_time() - sent_itr->second.second;
                 if (age < milliseconds(max_age_ms)
-                    and (not(wait_for_next and std::get<2>(sentences[which])))) {
-                    sentence                      = std::get<0>(sentences[which]);
-                    std::get<2>(sentences[which]) = true;
+                    and sent_itr->second.second > baseline) {
+                    sentence = sent_itr->second.first;
                 }
-            } catch (std::exception& e) {
-                UHD_LOGGER_DEBUG("GPS") << "get_sentence: " << e.what();
             }
 
             if (not sentence.empty() or now > exit_time) {
@@ -174,11 +194,27 @@ private:
         // Update sentences with newly read data
         for (std::string key : keys) {
             if (not msgs[key].empty()) {
-                sentences[key] = std::make_tuple(msgs[key], time, false);
+                sentences[key] = std::make_pair(msgs[key], time);
             }
         }
 
-        _last_cache_update = time;
+        // Publish a new snapshot for the readers
+        auto snap         = std::make_shared<snapshot_t>();
+        snap->sentences   = sentences;
+        snap->last_update = time;
+        std::atomic_store(
+            &_snapshot, std::shared_ptr<const snapshot_t>(std::move(snap)));
+    }
+
+    //! Drain the UART and publish fresh snapshots until told to stop. This
+    // is the only place that touches the UART once the poller is running.
+    void _poll_loop()
+    {
+        while (_poll_running) {
+            update_cache();
+            std::this_thread::sleep_for(
+                std::chrono::milliseconds(GPS_POLL_INTERVAL_MS));
+        }
     }
 
 public:
@@ -246,18 +282,32 @@ public:
 
         // initialize cache
         update_cache();
+
+        // From here on out, the poller owns the UART; sensor reads are
+        // served from the published snapshots.
+        if (gps_detected()) {
+            _poll_running = true;
+            _poll_thread  = std::thread([this]() { _poll_loop(); });
+        }
     }
 
     ~gps_ctrl_impl(void)
     {
-        /* NOP */
+        _poll_running = false;
+        if (_poll_thread.joinable()) {
+            _poll_thread.join();
+        }
     }
 
     // return a list of supported sensors
     std::vector<std::string> get_sensors(void)
     {
-        std::vector<std::string> ret{
-            "gps_gpgga", "gps_gprmc", "gps_time", "gps_locked", "gps_servo"};
+        std::vector<std::string> ret{"gps_gpgga",
+            "gps_gprmc",
+            "gps_time",
+            "gps_locked",
+            "gps_servo",
+            "gps_cache_age"};
         return ret;
     }
 
@@ -279,6 +329,16 @@ public:
                     GPS_SERVO_FRESHNESS,
                     GPS_TIMEOUT_DELAY_MS),
                 "");
+        } else if (key == "gps_cache_age") {
+            // Staleness of the published snapshot: milliseconds since the
+            // poller last drained the UART (-1 if it never has)
+            auto snap   = _get_snapshot();
+            int64_t age = -1;
+            if (not snap->last_update.is_not_a_date_time()) {
+                age = (boost::get_system_time() - snap->last_update)
+                          .total_milliseconds();
+            }
+            return sensor_value_t("GPS cache age", int(age), "ms");
         } else {
             throw uhd::value_error("gps ctrl get_sensor unknown key: " + key);
         }
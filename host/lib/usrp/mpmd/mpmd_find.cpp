@@ -41,8 +41,15 @@ device_addr_t flag_dev_as_unreachable(const device_addr_t& device_args)
 }
 } // namespace
 
+/*! Probe a single address (unicast or broadcast) for MPM devices
+ *
+ * \param find_first Stop listening after the first matching response. Set
+ *                   this when \p mgmt_addr pins a single device (unicast),
+ *                   so we don't wait out the full response timeout after
+ *                   the device has already answered.
+ */
 device_addrs_t mpmd_find_with_addr(
-    const std::string& mgmt_addr, const device_addr_t& hint_)
+    const std::string& mgmt_addr, const device_addr_t& hint_, const bool find_first = false)
 {
     UHD_ASSERT_THROW(not mgmt_addr.empty());
     const std::string mpm_discovery_port = hint_.get(
@@ -80,14 +87,9 @@ device_addrs_t mpmd_find_with_addr(
         const std::string recv_addr = comm->get_recv_addr();
 
         // remove external iface addrs if executed directly on device
-        bool external_iface = false;
-        for (const auto& addr : transport::get_if_addrs()) {
-            if ((addr.inet == comm->get_recv_addr())
-                && recv_addr != boost::asio::ip::address_v4::loopback().to_string()) {
-                external_iface = true;
-                break;
-            }
-        }
+        const bool external_iface =
+            transport::is_local_if_addr(comm->get_recv_addr())
+            && recv_addr != boost::asio::ip::address_v4::loopback().to_string();
         if (external_iface) {
             continue;
         }
@@ -120,6 +122,9 @@ device_addrs_t mpmd_find_with_addr(
             UHD_LOG_TRACE(
                 "MPMD FIND", "Found device that matches hints: " << new_addr.to_string());
             addrs.push_back(new_addr);
+            if (find_first) {
+                break;
+            }
         } else {
             UHD_LOG_DEBUG(
                 "MPMD FIND", "Found device, but does not match hint: " << recv_addr);
@@ -135,6 +140,9 @@ device_addrs_t mpmd_find_with_addrs(const device_addrs_t& hints)
     UHD_LOG_TRACE("MPMD FIND", "Finding with addrs.");
     device_addrs_t found_devices;
     found_devices.reserve(hints.size());
+    // probe all hinted addresses concurrently; each one pins a single device,
+    // so the probes early-out on the first response
+    std::vector<std::pair<device_addr_t, std::future<device_addrs_t>>> probe_tasks;
     for (const auto& hint : hints) {
         if (not(hint.has_key(xport::FIRST_ADDR_KEY) or hint.has_key(MGMT_ADDR_KEY))) {
             UHD_LOG_DEBUG("MPMD FIND", "No address given in hint " << hint.to_string());
@@ -142,10 +150,16 @@ device_addrs_t mpmd_find_with_addrs(const device_addrs_t& hints)
         }
         const std::string mgmt_addr =
             hint.get(MGMT_ADDR_KEY, hint.get(xport::FIRST_ADDR_KEY, ""));
-        device_addrs_t reply_addrs = mpmd_find_with_addr(mgmt_addr, hint);
+        probe_tasks.emplace_back(
+            hint, std::async(std::launch::async, [mgmt_addr, hint]() {
+                return mpmd_find_with_addr(mgmt_addr, hint, true /* find_first */);
+            }));
+    }
+    for (auto& probe_task : probe_tasks) {
+        device_addrs_t reply_addrs = probe_task.second.get();
         if (reply_addrs.size() > 1) {
             UHD_LOG_ERROR("MPMD",
-                "Could not resolve device hint \"" << hint.to_string()
+                "Could not resolve device hint \"" << probe_task.first.to_string()
                                                    << "\" to a unique device.");
             continue;
         } else if (reply_addrs.empty()) {
@@ -169,7 +183,7 @@ device_addrs_t mpmd_find_with_bcast(const device_addr_t& hint)
     UHD_LOG_TRACE(
         "MPMD FIND", "Broadcasting on all available interfaces to find MPM devices.");
     std::vector<std::future<device_addrs_t>> task_list;
-    for (const auto& if_addr : transport::get_if_addrs()) {
+    for (const auto& if_addr : transport::get_if_addrs_cached()) {
         task_list.emplace_back(std::async(std::launch::async,
             [if_addr, hint]() { return mpmd_find_with_addr(if_addr.bcast, hint); }));
     }
@@ -248,14 +262,22 @@ device_addrs_t mpmd_find(const device_addr_t& hint_)
                              << ", will not "
                                 "check devices for CHDR accessibility.");
     }
-    // Filter found devices for those that we can actually talk to via CHDR
-    device_addrs_t filtered_mpm_devs;
+    // Filter found devices for those that we can actually talk to via CHDR.
+    // The reachability checks wait on the network, so run them concurrently
+    // and pay for the slowest device instead of the sum of all of them.
+    std::vector<std::future<boost::optional<device_addr_t>>> reachability_tasks;
+    reachability_tasks.reserve(bcast_mpm_devs.size());
     for (const auto& mpm_dev : bcast_mpm_devs) {
-        const auto reachable_device_addr = mpmd_mboard_impl::is_device_reachable(mpm_dev);
+        reachability_tasks.emplace_back(std::async(std::launch::async,
+            [mpm_dev]() { return mpmd_mboard_impl::is_device_reachable(mpm_dev); }));
+    }
+    device_addrs_t filtered_mpm_devs;
+    for (size_t i = 0; i < reachability_tasks.size(); i++) {
+        const auto reachable_device_addr = reachability_tasks[i].get();
         if (bool(reachable_device_addr)) {
             filtered_mpm_devs.push_back(reachable_device_addr.get());
         } else if (find_all) {
-            filtered_mpm_devs.emplace_back(flag_dev_as_unreachable(mpm_dev));
+            filtered_mpm_devs.emplace_back(flag_dev_as_unreachable(bcast_mpm_devs[i]));
         }
     }
 
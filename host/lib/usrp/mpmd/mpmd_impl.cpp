@@ -165,20 +165,55 @@ mpmd_impl::mpmd_impl(const device_addr_t& device_args)
                             << "with args: " << device_args.to_string();
 
     // First, claim all the devices (so we own them and no one else can claim
-    // them).
-    // This can be parallelized as long as uptrs are stored in the right spot;
-    // they need to be correctly indexed.
-    for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
-        UHD_LOG_DEBUG("MPMD", "Claiming mboard " << mb_i);
-        _mb.push_back(claim_and_make(mb_args[mb_i]));
+    // them). Claims are independent per device, so they run concurrently
+    // unless serialize_init was requested; the futures keep the uptrs
+    // correctly indexed.
+    {
+        std::vector<std::future<mpmd_mboard_impl::uptr>> claim_futures;
+        claim_futures.reserve(num_mboards);
+        for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
+            UHD_LOG_DEBUG("MPMD", "Claiming mboard " << mb_i);
+            claim_futures.push_back(std::async(
+                serialize_init ? std::launch::deferred : std::launch::async,
+                [this, &mb_args, mb_i]() { return claim_and_make(mb_args[mb_i]); }));
+        }
+        for (auto& future : claim_futures) {
+            _mb.push_back(future.get());
+        }
     }
 
     if (not skip_init) {
-        // Run the actual device initialization. This can run in parallel.
+        // Run the actual device initialization. Each mboard only talks to
+        // its own MPM instance here, so this also runs in parallel; the
+        // mboard controllers get registered below, after the join, because
+        // the registry is not thread-safe.
+        // Note: This is the only place we do compat number checks. They're
+        // effectively disabled for skip_init=1
+        std::vector<std::future<void>> init_futures;
+        init_futures.reserve(num_mboards);
+        for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
+            init_futures.push_back(std::async(
+                serialize_init ? std::launch::deferred : std::launch::async,
+                [this, mb_i]() { setup_mb(_mb[mb_i].get(), mb_i); }));
+        }
+        // Join all initializations before rethrowing, so no init is still
+        // running when the constructor unwinds
+        std::exception_ptr first_error;
+        for (auto& future : init_futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (not first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+        }
+        if (first_error) {
+            std::rethrow_exception(first_error);
+        }
         for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
-            // Note: This is the only place we do compat number checks. They're
-            // effectively disabled for skip_init=1
-            setup_mb(_mb[mb_i].get(), mb_i);
+            UHD_ASSERT_THROW(_mb[mb_i]->mb_ctrl);
+            register_mb_controller(mb_i, _mb[mb_i]->mb_ctrl);
         }
     } else {
         UHD_LOG_DEBUG("MPMD", "Claimed device, but skipped init.");
@@ -240,8 +275,8 @@ void mpmd_impl::setup_mb(mpmd_mboard_impl* mb, const size_t mb_index)
 
     UHD_LOG_DEBUG("MPMD", "Initializing mboard " << mb_index);
     mb->init();
-    UHD_ASSERT_THROW(mb->mb_ctrl);
-    register_mb_controller(mb_index, mb->mb_ctrl);
+    // The mboard controller is registered by the caller once all mboards
+    // have joined, since the registry is not safe for concurrent writes
 }
 
 /*****************************************************************************
@@ -140,8 +140,8 @@ private:
      ************************************************************************/
     /*! Renew the claim onto the device.
      *
-     * This is meant to be called repeatedly, e.g., using a UHD task. See also
-     * _claimer_task.
+     * This is meant to be called repeatedly, e.g., from the shared claimer
+     * pool. See also claim_device_and_register_keepalive().
      */
     bool claim();
 
@@ -151,7 +151,11 @@ private:
      */
     void set_rpcc_timeout(const uint64_t timeout_ms);
 
-    uhd::task::sptr claim_device_and_make_task();
+    /*! Claim the device and register its reclaim keepalive with the shared
+     * claimer pool. All motherboards in the process share a single keepalive
+     * thread. Returns the pool handle used for deregistration.
+     */
+    size_t claim_device_and_register_keepalive();
 
     /*! Read out the log buffer from the MPM device and send it to native
      * logging system.
@@ -161,9 +165,9 @@ private:
     /*************************************************************************
      * Private attributes
      ************************************************************************/
-    /*! Continuously reclaims the device.
+    /*! Handle of this board's reclaim keepalive in the shared claimer pool.
      */
-    uhd::task::sptr _claimer_task;
+    size_t _claimer_handle = 0;
 
     /*! This flag is only used within the claim() function. Go look there if you
      * really need to know what it does.
@@ -242,6 +246,10 @@ private:
      * This is where mpmd_mboard_impl::init() is called.
      * Also assigns the local crossbar addresses.
      *
+     * May be called concurrently for different mboards; it only talks to
+     * the given mboard's own MPM instance. Registering the mboard
+     * controller is left to the caller, after all mboards have joined.
+     *
      * \param mb Reference to the mboard class
      * \param mb_index Index number of the mboard that's being initialized
      * \param device_args Device args
@@ -16,11 +16,23 @@
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/prefs.hpp>
+#include <cstdio>
+#include <set>
 #include <string>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_URING
+#    include <uhdlib/transport/udp_uring_link.hpp>
+#endif
+#ifdef UHD_PLATFORM_WIN32
+#    include <uhdlib/transport/udp_rio_link.hpp>
+#endif
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/xdp_link.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -108,7 +120,7 @@ std::vector<std::string> get_addrs_from_mb_args(const uhd::device_addr_t& mb_arg
     return addrs;
 }
 
-/*! Do a binary search to discover MTU
+/*! Do a parallel probe search to discover MTU
  *
  * Uses the MPM echo service to figure out MTU. We simply send a bunch of
  * packets and see if they come back until we converged on the path MTU.
@@ -124,13 +136,17 @@ std::vector<std::string> get_addrs_from_mb_args(const uhd::device_addr_t& mb_arg
  *                     exceed the MTU, we don't expect a response, and this
  *                     is the amount of time we'll wait before we assume
  *                     the frame size exceeds the MTU.
+ * \param cached_mtu MTU discovered in an earlier session, or 0. If given,
+ *                   it is revalidated with a single probe round before the
+ *                   full search is considered.
  */
 size_t discover_mtu(const std::string& address,
     const std::string& port,
     size_t min_frame_size,
     size_t max_frame_size,
     const double echo_timeout,
-    const bool use_dpdk)
+    const bool use_dpdk,
+    const size_t cached_mtu = 0)
 {
     //! Function to create a udp_simple::sptr (kernel-based or DPDK-based)
     using udp_simple_factory_t = std::function<uhd::transport::udp_simple::sptr(
@@ -173,34 +189,92 @@ size_t discover_mtu(const std::string& address,
         }
     };
     UHD_LOG_TRACE("MPMD", "Determining UDP MTU... ");
-    size_t seq_no = 0;
+    // Instead of testing one size per round trip, probe several candidate
+    // sizes per round. Probes that fit the path come back almost
+    // immediately, so a round costs at most one echo timeout (for the probes
+    // that exceeded the MTU), regardless of how many candidates it tests.
+    constexpr size_t MAX_PROBES_PER_ROUND = 8;
+    size_t seq_no    = 0;
+    bool first_round = true;
     while (min_frame_size < max_frame_size) {
-        // Only test multiples of 4 bytes!
-        const size_t test_frame_size = (max_frame_size / 2 + min_frame_size / 2 + 3)
-                                       & ~size_t(3);
-        // Encode sequence number and current size in the string, makes it
-        // easy to debug in code or Wireshark. Is also used for identifying
-        // response packets.
-        std::sprintf(
-            &send_buf[echo_prefix_offset], ";%04lu,%04lu", seq_no++, test_frame_size);
-        UHD_LOG_TRACE("MPMD", "Testing frame size " << test_frame_size);
-        udp->send(boost::asio::buffer(&send_buf[0], test_frame_size));
+        // Pick the candidate sizes of this round (multiples of 4 only!)
+        std::vector<size_t> candidates;
+        if (first_round and cached_mtu % 4 == 0 and cached_mtu > min_frame_size
+            and cached_mtu < max_frame_size) {
+            // An MTU cached from an earlier session: confirm that it still
+            // passes and that the next size up still fails. If both hold we
+            // are done after this round, otherwise the cache is stale and we
+            // fall through to the full search.
+            candidates = {cached_mtu, cached_mtu + 4};
+        } else {
+            const size_t span       = max_frame_size - min_frame_size;
+            const size_t num_probes = std::min(MAX_PROBES_PER_ROUND, span / 4);
+            for (size_t i = 1; i <= num_probes; i++) {
+                const size_t candidate = (min_frame_size + span * i / num_probes)
+                                         & ~size_t(3);
+                if (candidate > min_frame_size
+                    and (candidates.empty() or candidate != candidates.back())) {
+                    candidates.push_back(candidate);
+                }
+            }
+        }
+        first_round = false;
 
-        const size_t len = udp->recv(boost::asio::buffer(recv_buf), echo_timeout);
-        if (len == 0) {
-            // Nothing received, so this is probably too big
-            max_frame_size = test_frame_size - 4;
-        } else if (len >= test_frame_size) {
-            // Size went through, so bump the minimum
-            require_bufs_match(len);
-            min_frame_size = test_frame_size;
-        } else if (len < test_frame_size) {
-            // This is an odd case. Something must have snipped the packet
-            // on the way back. Still, we'll just back off and try
-            // something smaller.
-            UHD_LOG_DEBUG("MPMD", "Unexpected packet truncation during MTU discovery.");
+        // Send all probes of this round back to back...
+        for (const size_t test_frame_size : candidates) {
+            // Encode sequence number and current size in the string, makes it
+            // easy to debug in code or Wireshark. Is also used for identifying
+            // response packets.
+            std::sprintf(&send_buf[echo_prefix_offset],
+                ";%04lu,%04lu",
+                static_cast<unsigned long>(seq_no++),
+                static_cast<unsigned long>(test_frame_size));
+            UHD_LOG_TRACE("MPMD", "Testing frame size " << test_frame_size);
+            udp->send(boost::asio::buffer(&send_buf[0], test_frame_size));
+        }
+
+        // ...then collect the responses. A single timed-out recv means all
+        // probes still pending were too big.
+        std::set<size_t> pending(candidates.begin(), candidates.end());
+        size_t largest_passed = 0;
+        while (not pending.empty()) {
+            const size_t len = udp->recv(boost::asio::buffer(recv_buf), echo_timeout);
+            if (len == 0) {
+                break;
+            }
             require_bufs_match(len);
-            max_frame_size = len;
+            unsigned long rx_seq  = 0;
+            unsigned long rx_size = 0;
+            if (std::sscanf(reinterpret_cast<const char*>(&recv_buf[echo_prefix_offset]),
+                    ";%04lu,%04lu",
+                    &rx_seq,
+                    &rx_size)
+                    != 2
+                or pending.count(rx_size) == 0) {
+                // Response to a probe from an earlier round, ignore
+                continue;
+            }
+            pending.erase(rx_size);
+            if (len >= rx_size) {
+                // Size went through
+                largest_passed = std::max<size_t>(largest_passed, rx_size);
+            } else {
+                // This is an odd case. Something must have snipped the packet
+                // on the way back. Still, we'll just back off and try
+                // something smaller.
+                UHD_LOG_DEBUG(
+                    "MPMD", "Unexpected packet truncation during MTU discovery.");
+                max_frame_size = std::min(max_frame_size, len & ~size_t(3));
+            }
+        }
+        if (largest_passed > 0) {
+            min_frame_size = std::max(min_frame_size, largest_passed);
+        }
+        // Whatever is still pending exceeded the path MTU
+        for (const size_t failed : pending) {
+            if (failed > min_frame_size) {
+                max_frame_size = std::min(max_frame_size, failed - 4);
+            }
         }
     }
     UHD_LOG_DEBUG("MPMD", "Path MTU for address " << address << ": " << min_frame_size);
@@ -223,14 +297,24 @@ mpmd_link_if_ctrl_udp::mpmd_link_if_ctrl_udp(const uhd::device_addr_t& mb_args,
         mb_args.has_key("use_dpdk"); // FIXME use constrained_device_args
     const std::string mpm_discovery_port = _mb_args.get(
         mpmd_impl::MPM_DISCOVERY_PORT_KEY, std::to_string(mpmd_impl::MPM_DISCOVERY_PORT));
-    auto discover_mtu_for_ip = [mpm_discovery_port, use_dpdk](
+    const std::string serial = _mb_args.get("serial", "");
+    auto discover_mtu_for_ip = [mpm_discovery_port, use_dpdk, serial](
                                    const std::string& ip_addr) {
-        return discover_mtu(ip_addr,
+        // Seed the search with the MTU discovered in an earlier session, if
+        // any; a valid cached value reduces discovery to one probe round
+        const size_t cached_mtu =
+            serial.empty() ? 0 : uhd::prefs::get_cached_mtu(serial, ip_addr);
+        const size_t mtu = discover_mtu(ip_addr,
             mpm_discovery_port,
             IP_PROTOCOL_MIN_MTU_SIZE - IP_PROTOCOL_UDP_PLUS_IP_HEADER,
             MPMD_10GE_DATA_FRAME_MAX_SIZE,
             MPMD_MTU_DISCOVERY_TIMEOUT,
-            use_dpdk);
+            use_dpdk,
+            cached_mtu);
+        if (not serial.empty() and mtu != cached_mtu) {
+            uhd::prefs::update_cached_mtu(serial, ip_addr, mtu);
+        }
+        return mtu;
     };
 
     const std::vector<std::string> requested_addrs(
@@ -289,6 +373,11 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
     link_params.num_recv_frames =
         std::max(uhd::rfnoc::MIN_NUM_FRAMES, link_params.num_recv_frames);
 
+    // Allocate the frame buffers on the NUMA node of the NIC, if requested
+    link_params.numa_node = _mb_args.cast<int>("numa_node", link_params.numa_node);
+    // Back the frame buffers with 2 MB huge pages, if requested
+    link_params.use_hugepages = _mb_args.has_key("use_hugepages");
+
     if (_mb_args.has_key("use_dpdk")) { // FIXME use constrained device args
 #ifdef HAVE_DPDK
         auto link = uhd::transport::udp_dpdk_link::make(ip_addr, udp_port, link_params);
@@ -300,6 +389,56 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             true);
 #else
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (_mb_args.has_key("use_xdp")) {
+#ifdef HAVE_XDP
+        // The XDP link needs to know which interface and NIC queue to
+        // claim; flow steering to that queue is the user's responsibility
+        auto link = uhd::transport::xdp_link::make(_mb_args["xdp_iface"],
+            _mb_args.cast<size_t>("xdp_queue", 0),
+            ip_addr,
+            udp_port,
+            link_params);
+        return std::make_tuple(link,
+            link_params.send_buff_size,
+            link,
+            link_params.recv_buff_size,
+            true,
+            false);
+#else
+        UHD_LOG_WARNING("MPMD", "Cannot create XDP transport, falling back to UDP");
+#endif
+    }
+    if (_mb_args.has_key("use_uring")) {
+#ifdef HAVE_URING
+        auto link = uhd::transport::udp_uring_link::make(ip_addr,
+            udp_port,
+            link_params,
+            _mb_args.has_key("uring_sqpoll"),
+            link_params.recv_buff_size,
+            link_params.send_buff_size);
+        return std::make_tuple(link,
+            link_params.send_buff_size,
+            link,
+            link_params.recv_buff_size,
+            true,
+            false);
+#else
+        UHD_LOG_WARNING(
+            "MPMD", "Cannot create io_uring transport, falling back to UDP");
+#endif
+    }
+    if (_mb_args.has_key("use_rio")) {
+#ifdef UHD_PLATFORM_WIN32
+        size_t recv_buff_size, send_buff_size;
+        auto link = uhd::transport::udp_rio_link::make(
+            ip_addr, udp_port, link_params, recv_buff_size, send_buff_size);
+        return std::make_tuple(
+            link, send_buff_size, link, recv_buff_size, true, false);
+#else
+        UHD_LOG_WARNING("MPMD",
+            "Registered I/O is only available on Windows, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(ip_addr,
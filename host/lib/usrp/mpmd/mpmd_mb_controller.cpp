@@ -168,6 +168,52 @@ sensor_value_t mpmd_mb_controller::get_sensor(const std::string& name)
         _rpc->request_with_token<sensor_value_t::sensor_map_t>("get_mb_sensor", name));
 }
 
+std::vector<sensor_value_t> mpmd_mb_controller::get_sensors(
+    const std::vector<std::string>& names)
+{
+    for (const auto& name : names) {
+        if (!_sensor_names.count(name)) {
+            throw uhd::key_error(std::string("Invalid motherboard sensor name: ") + name);
+        }
+    }
+    // Preferred path: Read the whole batch with a single RPC call
+    if (_has_bulk_sensor_rpc) {
+        try {
+            const auto sensor_maps =
+                _rpc->request_with_token<std::vector<sensor_value_t::sensor_map_t>>(
+                    "get_mb_sensors_values", names);
+            UHD_ASSERT_THROW(sensor_maps.size() == names.size());
+            std::vector<sensor_value_t> values;
+            values.reserve(sensor_maps.size());
+            for (const auto& sensor_map : sensor_maps) {
+                values.push_back(sensor_value_t(sensor_map));
+            }
+            return values;
+        } catch (const uhd::runtime_error&) {
+            UHD_LOG_DEBUG("MPMD",
+                "MPM does not provide get_mb_sensors_values, falling back to "
+                "pipelined single-sensor reads.");
+            _has_bulk_sensor_rpc = false;
+        }
+    }
+    // Fallback for older MPM versions: Issue all single-sensor requests before
+    // waiting for the first response, so the batch still only pays one network
+    // round trip
+    std::vector<uhd::rpc_response<sensor_value_t::sensor_map_t>> responses;
+    responses.reserve(names.size());
+    for (const auto& name : names) {
+        responses.push_back(
+            _rpc->async_request_with_token<sensor_value_t::sensor_map_t>(
+                "get_mb_sensor", name));
+    }
+    std::vector<sensor_value_t> values;
+    values.reserve(names.size());
+    for (auto& response : responses) {
+        values.push_back(sensor_value_t(response.get()));
+    }
+    return values;
+}
+
 std::vector<std::string> mpmd_mb_controller::get_sensor_names()
 {
     std::vector<std::string> sensor_names(_sensor_names.cbegin(), _sensor_names.cend());
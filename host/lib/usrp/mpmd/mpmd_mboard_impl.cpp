@@ -10,8 +10,13 @@
 #include <uhd/transport/udp_simple.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/safe_call.hpp>
+#include <algorithm>
 #include <chrono>
+#include <functional>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 namespace {
@@ -159,13 +164,116 @@ uhd::rpc_client::sptr make_mpm_rpc_client(const std::string& rpc_server_addr,
     const uhd::device_addr_t& mb_args,
     const size_t timeout_ms = MPMD_DEFAULT_RPC_TIMEOUT)
 {
-    return uhd::rpc_client::make(rpc_server_addr,
+    // Pooled: sessions re-use the warm connection left over from discovery,
+    // and repeated sessions to the same device skip the connection setup
+    return uhd::rpc_client::make_pooled(rpc_server_addr,
         mb_args.cast<size_t>(
             uhd::mpmd::mpmd_impl::MPM_RPC_PORT_KEY, uhd::mpmd::mpmd_impl::MPM_RPC_PORT),
         timeout_ms,
         uhd::mpmd::mpmd_impl::MPM_RPC_GET_LAST_ERROR_CMD);
 }
 
+/*! Shared keepalive for all claimed MPM devices in this process.
+ *
+ * Every mpmd_mboard_impl used to spawn its own claimer task, so a session
+ * with N motherboards produced N threads waking up once per second each.
+ * This pool runs all reclaim callbacks from a single task thread, i.e., one
+ * wakeup per interval regardless of the number of devices. The wake cadence
+ * is the shortest interval requested by any registered board.
+ */
+class mpmd_claimer_pool
+{
+public:
+    static mpmd_claimer_pool& instance()
+    {
+        static mpmd_claimer_pool pool;
+        return pool;
+    }
+
+    /*! Register a reclaim callback, returns a handle for unregistering.
+     *
+     * A callback that throws is dropped from the pool, which matches the old
+     * behavior of a per-board claimer task dying on an unrecoverable claim
+     * failure.
+     */
+    size_t add_claim_cb(std::function<void(void)> claim_cb, const size_t interval_ms)
+    {
+        std::lock_guard<std::mutex> task_lock(_task_mutex);
+        size_t handle;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            handle           = _next_handle++;
+            _entries[handle] = {std::move(claim_cb), interval_ms};
+        }
+        if (not _task) {
+            _task = uhd::task::make([this]() { _claim_all(); }, "mpmd_claimer_task");
+        }
+        return handle;
+    }
+
+    /*! Remove a callback.
+     *
+     * Blocks until the callback is guaranteed not to be invoked again, so
+     * the caller can safely unclaim the device afterwards.
+     */
+    void remove_claim_cb(const size_t handle)
+    {
+        std::lock_guard<std::mutex> task_lock(_task_mutex);
+        bool stop_task = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.erase(handle);
+            stop_task = _entries.empty();
+        }
+        // Reset the task outside of _mutex: the task body takes _mutex, and
+        // resetting the task joins its thread.
+        if (stop_task) {
+            _task.reset();
+        }
+    }
+
+private:
+    struct claim_entry_t
+    {
+        std::function<void(void)> claim_cb;
+        size_t interval_ms;
+    };
+
+    void _claim_all()
+    {
+        const auto now     = std::chrono::steady_clock::now();
+        size_t interval_ms = std::numeric_limits<size_t>::max();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto it = _entries.begin(); it != _entries.end();) {
+                try {
+                    it->second.claim_cb();
+                    interval_ms = std::min(interval_ms, it->second.interval_ms);
+                    ++it;
+                } catch (const std::exception& ex) {
+                    UHD_LOG_ERROR("MPMD",
+                        "Reclaim failure, dropping device from claimer pool: "
+                            << ex.what());
+                    it = _entries.erase(it);
+                }
+            }
+        }
+        if (interval_ms == std::numeric_limits<size_t>::max()) {
+            interval_ms = MPMD_RECLAIM_INTERVAL_MS;
+        }
+        std::this_thread::sleep_until(now + std::chrono::milliseconds(interval_ms));
+    }
+
+    //! Serializes add/remove against each other and guards _task. Always
+    // taken before _mutex.
+    std::mutex _task_mutex;
+    //! Guards _entries; also held while callbacks run.
+    std::mutex _mutex;
+    std::map<size_t, claim_entry_t> _entries;
+    size_t _next_handle = 1;
+    uhd::task::sptr _task;
+};
+
 } // namespace
 
 using namespace uhd;
@@ -186,7 +294,10 @@ boost::optional<device_addr_t> mpmd_mboard_impl::is_device_reachable(
     // 1) Read back device info
     dev_info device_info_dict;
     try {
-        auto rpcc = uhd::rpc_client::make(rpc_addr, rpc_port);
+        auto rpcc = uhd::rpc_client::make_pooled(rpc_addr,
+            rpc_port,
+            MPMD_DEFAULT_RPC_TIMEOUT,
+            mpmd_impl::MPM_RPC_GET_LAST_ERROR_CMD);
         device_info_dict =
             rpcc->request<dev_info>(MPMD_SHORT_RPC_TIMEOUT, "get_device_info");
     } catch (const uhd::runtime_error& e) {
@@ -225,7 +336,10 @@ boost::optional<device_addr_t> mpmd_mboard_impl::is_device_reachable(
                 continue;
             }
             UHD_LOG_TRACE("MPMD", "Was able to ping device, trying RPC connection.");
-            auto chdr_rpcc = uhd::rpc_client::make(chdr_addr, rpc_port);
+            auto chdr_rpcc = uhd::rpc_client::make_pooled(chdr_addr,
+                rpc_port,
+                MPMD_DEFAULT_RPC_TIMEOUT,
+                mpmd_impl::MPM_RPC_GET_LAST_ERROR_CMD);
             auto dev_info_chdr =
                 chdr_rpcc->request<dev_info>(MPMD_SHORT_RPC_TIMEOUT, "get_device_info");
             if (dev_info_chdr["serial"] != device_info_dict["serial"]) {
@@ -266,19 +380,22 @@ mpmd_mboard_impl::mpmd_mboard_impl(
                              << rpc_server_addr
                              << " mboard args: " << mb_args.to_string();
 
-    _claimer_task = claim_device_and_make_task();
+    _claimer_handle = claim_device_and_register_keepalive();
     if (mb_args_.has_key(MPMD_MEAS_LATENCY_KEY)) {
         measure_rpc_latency(rpc, MPMD_MEAS_LATENCY_DURATION);
     }
 
-    /// Get device info
-    const auto device_info_dict = rpc->request<dev_info>("get_device_info");
+    /// Get device and dboard info. The requests are pipelined so the two
+    /// queries share one network round trip.
+    auto device_info_response  = rpc->async_request<dev_info>("get_device_info");
+    auto dboards_info_response =
+        rpc->async_request<std::vector<dev_info>>("get_dboard_info");
+    const auto device_info_dict = device_info_response.get();
     for (const auto& info_pair : device_info_dict) {
         device_info[info_pair.first] = info_pair.second;
     }
     UHD_LOG_DEBUG("MPMD", "MPM reports device info: " << device_info.to_string());
-    /// Get dboard info
-    const auto dboards_info = rpc->request<std::vector<dev_info>>("get_dboard_info");
+    const auto dboards_info = dboards_info_response.get();
     UHD_ASSERT_THROW(this->dboard_info.size() == 0);
     for (const auto& dboard_info_dict : dboards_info) {
         uhd::device_addr_t this_db_info;
@@ -301,9 +418,10 @@ mpmd_mboard_impl::mpmd_mboard_impl(
 
 mpmd_mboard_impl::~mpmd_mboard_impl()
 {
-    // Destroy the claimer task to avoid spurious asynchronous reclaim call
-    // after the unclaim.
-    UHD_SAFE_CALL(dump_logs(); _claimer_task.reset();
+    // Deregister from the claimer pool to avoid spurious asynchronous reclaim
+    // call after the unclaim.
+    UHD_SAFE_CALL(dump_logs();
+                  mpmd_claimer_pool::instance().remove_claim_cb(_claimer_handle);
                   if (not rpc->request_with_token<bool>("unclaim")) {
                       UHD_LOG_WARNING("MPMD", "Failure to ack unclaim!");
                   });
@@ -354,7 +472,7 @@ bool mpmd_mboard_impl::claim()
     }
 }
 
-uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
+size_t mpmd_mboard_impl::claim_device_and_register_keepalive()
 {
     auto rpc_token = _claim_rpc->request<std::string>(
         "claim", mb_args.get("session_id", MPMD_DEFAULT_SESSION_ID));
@@ -373,9 +491,13 @@ uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
             UHD_LOG_WARNING("MPMD", "Could not read back log queue!");
         }
     }
-    return uhd::task::make(
+    // The wake cadence is configurable via the claim_interval_ms device arg;
+    // note that MPM unclaims a device whose keepalives stop, so intervals
+    // beyond the MPM-side claim timeout will lose the claim.
+    const size_t interval_ms = std::max<size_t>(
+        100, mb_args.cast<size_t>("claim_interval_ms", MPMD_RECLAIM_INTERVAL_MS));
+    return mpmd_claimer_pool::instance().add_claim_cb(
         [this] {
-            auto now = std::chrono::steady_clock::now();
             if (not this->claim()) {
                 throw uhd::value_error("mpmd device reclaiming loop failed!");
             } else {
@@ -385,10 +507,8 @@ uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
                     UHD_LOG_WARNING("MPMD", "Could not read back log queue!");
                 }
             }
-            std::this_thread::sleep_until(
-                now + std::chrono::milliseconds(MPMD_RECLAIM_INTERVAL_MS));
         },
-        "mpmd_claimer_task");
+        interval_ms);
 }
 
 void mpmd_mboard_impl::dump_logs(const bool dump_to_null)
@@ -21,6 +21,7 @@
 #include <uhd/utils/soft_register.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
+#include <uhdlib/utils/serial_task_executor.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/format.hpp>
@@ -29,7 +30,9 @@
 #include <chrono>
 #include <cmath>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 namespace uhd { namespace rfnoc {
@@ -908,6 +911,19 @@ public:
         return {};
     }
 
+    std::vector<sensor_value_t> get_mboard_sensors(
+        const std::vector<std::string>& names, size_t mboard)
+    {
+        // Gen-2 devices read sensors through the property tree, so there is
+        // no transaction to coalesce here
+        std::vector<sensor_value_t> values;
+        values.reserve(names.size());
+        for (const auto& name : names) {
+            values.push_back(get_mboard_sensor(name, mboard));
+        }
+        return values;
+    }
+
     void set_user_register(const uint8_t addr, const uint32_t data, size_t mboard)
     {
         if (mboard != ALL_MBOARDS) {
@@ -952,6 +968,7 @@ public:
 
     void set_rx_subdev_spec(const subdev_spec_t& spec, size_t mboard)
     {
+        _invalidate_rx_path_cache();
         if (mboard != ALL_MBOARDS) {
             _tree->access<subdev_spec_t>(mb_root(mboard) / "rx_subdev_spec").set(spec);
             return;
@@ -1968,8 +1985,19 @@ public:
         return this->get_device()->get_tx_stream(args);
     }
 
+    std::future<void> post_task(std::function<void()> task)
+    {
+        std::lock_guard<std::mutex> l(_cmd_executor_mutex);
+        if (not _cmd_executor) {
+            _cmd_executor =
+                std::make_unique<uhd::serial_task_executor>("uhd_usrp_cmd");
+        }
+        return _cmd_executor->post(std::move(task));
+    }
+
     void set_tx_subdev_spec(const subdev_spec_t& spec, size_t mboard)
     {
+        _invalidate_tx_path_cache();
         if (mboard != ALL_MBOARDS) {
             _tree->access<subdev_spec_t>(mb_root(mboard) / "tx_subdev_spec").set(spec);
             return;
@@ -2525,6 +2553,40 @@ private:
     //! Container for spp values set in set_rx_spp()
     std::unordered_map<size_t, size_t> _rx_spp;
 
+    //! Command thread for post_task(), started on first use. Declared after
+    // _dev so it is torn down (draining all queued tasks) before the device.
+    std::mutex _cmd_executor_mutex;
+    std::unique_ptr<uhd::serial_task_executor> _cmd_executor;
+
+    //! Cached per-channel tree handles. Resolving a frontend path or a gain
+    // group walks the property tree with string concatenation on every call,
+    // which is too slow for kHz-rate control loops. Entries are invalidated
+    // when the subdev spec changes, since that redirects the frontend paths
+    // and the channel-to-mboard mapping.
+    std::mutex _path_cache_mutex;
+    std::map<size_t, fs_path> _rx_dsp_root_cache;
+    std::map<size_t, fs_path> _tx_dsp_root_cache;
+    std::map<size_t, fs_path> _rx_rf_fe_root_cache;
+    std::map<size_t, fs_path> _tx_rf_fe_root_cache;
+    std::map<size_t, gain_group::sptr> _rx_gain_group_cache;
+    std::map<size_t, gain_group::sptr> _tx_gain_group_cache;
+
+    void _invalidate_rx_path_cache(void)
+    {
+        std::lock_guard<std::mutex> l(_path_cache_mutex);
+        _rx_dsp_root_cache.clear();
+        _rx_rf_fe_root_cache.clear();
+        _rx_gain_group_cache.clear();
+    }
+
+    void _invalidate_tx_path_cache(void)
+    {
+        std::lock_guard<std::mutex> l(_path_cache_mutex);
+        _tx_dsp_root_cache.clear();
+        _tx_rf_fe_root_cache.clear();
+        _tx_gain_group_cache.clear();
+    }
+
     struct mboard_chan_pair
     {
         size_t mboard, chan;
@@ -2587,6 +2649,13 @@ private:
 
     fs_path rx_dsp_root(const size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _rx_dsp_root_cache.find(chan);
+            if (it != _rx_dsp_root_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp = rx_chan_to_mcp(chan);
         if (_tree->exists(mb_root(mcp.mboard) / "rx_chan_dsp_mapping")) {
             std::vector<size_t> map = _tree
@@ -2600,6 +2669,8 @@ private:
         try {
             const std::string tree_path = mb_root(mcp.mboard) / "rx_dsps" / mcp.chan;
             if (_tree->exists(tree_path)) {
+                std::lock_guard<std::mutex> l(_path_cache_mutex);
+                _rx_dsp_root_cache[chan] = fs_path(tree_path);
                 return tree_path;
             } else {
                 throw uhd::index_error(
@@ -2616,6 +2687,13 @@ private:
 
     fs_path tx_dsp_root(const size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _tx_dsp_root_cache.find(chan);
+            if (it != _tx_dsp_root_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp = tx_chan_to_mcp(chan);
         if (_tree->exists(mb_root(mcp.mboard) / "tx_chan_dsp_mapping")) {
             std::vector<size_t> map = _tree
@@ -2628,6 +2706,8 @@ private:
         try {
             const std::string tree_path = mb_root(mcp.mboard) / "tx_dsps" / mcp.chan;
             if (_tree->exists(tree_path)) {
+                std::lock_guard<std::mutex> l(_path_cache_mutex);
+                _tx_dsp_root_cache[chan] = fs_path(tree_path);
                 return tree_path;
             } else {
                 throw uhd::index_error(
@@ -2687,11 +2767,21 @@ private:
 
     fs_path rx_rf_fe_root(const size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _rx_rf_fe_root_cache.find(chan);
+            if (it != _rx_rf_fe_root_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp = rx_chan_to_mcp(chan);
         try {
             const subdev_spec_pair_t spec = get_rx_subdev_spec(mcp.mboard).at(mcp.chan);
-            return mb_root(mcp.mboard) / "dboards" / spec.db_name / "rx_frontends"
-                   / spec.sd_name;
+            const fs_path root = mb_root(mcp.mboard) / "dboards" / spec.db_name
+                                 / "rx_frontends" / spec.sd_name;
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            _rx_rf_fe_root_cache[chan] = root;
+            return root;
         } catch (const std::exception& e) {
             throw uhd::index_error(
                 str(boost::format("multi_usrp::rx_rf_fe_root(%u) - mcp(%u) - %s") % chan
@@ -2701,11 +2791,21 @@ private:
 
     fs_path tx_rf_fe_root(const size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _tx_rf_fe_root_cache.find(chan);
+            if (it != _tx_rf_fe_root_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp = tx_chan_to_mcp(chan);
         try {
             const subdev_spec_pair_t spec = get_tx_subdev_spec(mcp.mboard).at(mcp.chan);
-            return mb_root(mcp.mboard) / "dboards" / spec.db_name / "tx_frontends"
-                   / spec.sd_name;
+            const fs_path root = mb_root(mcp.mboard) / "dboards" / spec.db_name
+                                 / "tx_frontends" / spec.sd_name;
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            _tx_rf_fe_root_cache[chan] = root;
+            return root;
         } catch (const std::exception& e) {
             throw uhd::index_error(
                 str(boost::format("multi_usrp::tx_rf_fe_root(%u) - mcp(%u) - %s") % chan
@@ -2715,6 +2815,13 @@ private:
 
     gain_group::sptr rx_gain_group(size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _rx_gain_group_cache.find(chan);
+            if (it != _rx_gain_group_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp          = rx_chan_to_mcp(chan);
         const subdev_spec_pair_t spec = get_rx_subdev_spec(mcp.mboard).at(mcp.chan);
         gain_group::sptr gg           = gain_group::make();
@@ -2731,11 +2838,20 @@ private:
                     _tree->subtree(rx_rf_fe_root(chan) / "gains" / name)),
                 1 /* high prio */);
         }
+        std::lock_guard<std::mutex> l(_path_cache_mutex);
+        _rx_gain_group_cache[chan] = gg;
         return gg;
     }
 
     gain_group::sptr tx_gain_group(size_t chan)
     {
+        {
+            std::lock_guard<std::mutex> l(_path_cache_mutex);
+            auto it = _tx_gain_group_cache.find(chan);
+            if (it != _tx_gain_group_cache.end()) {
+                return it->second;
+            }
+        }
         mboard_chan_pair mcp          = tx_chan_to_mcp(chan);
         const subdev_spec_pair_t spec = get_tx_subdev_spec(mcp.mboard).at(mcp.chan);
         gain_group::sptr gg           = gain_group::make();
@@ -2752,6 +2868,8 @@ private:
                     _tree->subtree(tx_rf_fe_root(chan) / "gains" / name)),
                 0 /* low prio */);
         }
+        std::lock_guard<std::mutex> l(_path_cache_mutex);
+        _tx_gain_group_cache[chan] = gg;
         return gg;
     }
 
@@ -84,6 +84,7 @@ void export_multi_usrp(py::module& m)
         .def("get_num_mboards"         , &multi_usrp::get_num_mboards)
         .def("get_mboard_sensor"       , &multi_usrp::get_mboard_sensor, py::arg("name"), py::arg("mboard") = 0)
         .def("get_mboard_sensor_names" , &multi_usrp::get_mboard_sensor_names, py::arg("mboard") = 0)
+        .def("get_mboard_sensors"      , &multi_usrp::get_mboard_sensors, py::arg("names"), py::arg("mboard") = 0)
         .def("set_user_register"       , &multi_usrp::set_user_register, py::arg("addr"), py::arg("data"), py::arg("mboard") = ALL_MBOARDS)
 
         // RX methods
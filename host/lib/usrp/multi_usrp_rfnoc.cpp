@@ -15,12 +15,15 @@
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/graph_utils.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
+#include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/serial_task_executor.hpp>
 #include <unordered_set>
 #include <boost/format.hpp>
 #include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -314,6 +317,18 @@ public:
         // commands go through the graph
         _graph->commit();
 
+        // Give the streamer a way to query device time, so recv() after a
+        // timed stream command can sleep until data is due instead of
+        // polling through the gap
+        if (auto rfnoc_streamer =
+                std::dynamic_pointer_cast<rfnoc_rx_streamer>(rx_streamer)) {
+            const auto rx_chain = _get_rx_chan(args.channels.at(0));
+            const size_t mb_idx = rx_chain.radio->get_block_id().get_device_no();
+            auto timekeeper     = get_mbc(mb_idx)->get_timekeeper(0);
+            rfnoc_streamer->set_time_now_fn(
+                [timekeeper]() { return timekeeper->get_time_now(); });
+        }
+
         // Before we return the streamer, we may need to reapply the rate. This
         // is necessary whenever the blocks were configured before the streamer
         // was created, because we don't know what state the graph is in after
@@ -702,7 +717,21 @@ public:
 
     void set_time_next_pps(const time_spec_t& time_spec, size_t mboard)
     {
-        MUX_MB_API_CALL(set_time_next_pps, time_spec);
+        if (mboard == ALL_MBOARDS) {
+            // Program all boards in parallel: A sequential loop pushes the
+            // later boards' commands ever closer to the PPS edge, which gets
+            // dangerous with many boards (or a slow control transport)
+            std::vector<std::future<void>> tasks;
+            tasks.reserve(get_num_mboards());
+            for (size_t m = 0; m < get_num_mboards(); m++) {
+                tasks.emplace_back(std::async(std::launch::async,
+                    [this, m, time_spec]() { set_time_next_pps(time_spec, m); }));
+            }
+            for (auto& task : tasks) {
+                task.get();
+            }
+            return;
+        }
         get_mbc(mboard)->get_timekeeper(0)->set_time_next_pps(time_spec);
     }
 
@@ -721,10 +750,27 @@ public:
         }
 
         UHD_LOGGER_INFO("MULTI_USRP") << "    2) set times next pps (synchronously)";
-        set_time_next_pps(time_spec, ALL_MBOARDS);
-        std::this_thread::sleep_for(1s);
+        constexpr size_t MAX_PPS_SYNC_ATTEMPTS = 3;
+        for (size_t attempt = 1; attempt <= MAX_PPS_SYNC_ATTEMPTS; attempt++) {
+            set_time_next_pps(time_spec, ALL_MBOARDS);
+            std::this_thread::sleep_for(1s);
+
+            // Verify that all boards latched the same epoch: their time
+            // registers must read within a few RTT of board 0. A board that
+            // missed the PPS edge will be off by a full second, in which case
+            // we simply try again on a later edge.
+            if (get_time_synchronized()) {
+                return;
+            }
+            if (attempt < MAX_PPS_SYNC_ATTEMPTS) {
+                UHD_LOGGER_WARNING("MULTI_USRP")
+                    << boost::format("Detected time deviation after setting time at "
+                                     "PPS edge, retrying (attempt %d of %d)...")
+                           % attempt % MAX_PPS_SYNC_ATTEMPTS;
+            }
+        }
 
-        // verify that the time registers are read to be within a few RTT
+        // All attempts failed: report which boards deviate
         for (size_t m = 1; m < get_num_mboards(); m++) {
             time_spec_t time_0 = this->get_time_now(0);
             time_spec_t time_i = this->get_time_now(m);
@@ -894,6 +940,12 @@ public:
         return get_mbc(mboard)->get_sensor_names();
     }
 
+    std::vector<sensor_value_t> get_mboard_sensors(
+        const std::vector<std::string>& names, size_t mboard = 0)
+    {
+        return get_mbc(mboard)->get_sensors(names);
+    }
+
     // This only works on the USRP2 and B100, both of which are not rfnoc_device
     void set_user_register(const uint8_t, const uint32_t, size_t)
     {
@@ -2302,6 +2354,16 @@ public:
         }
     }
 
+    std::future<void> post_task(std::function<void()> task)
+    {
+        std::lock_guard<std::mutex> l(_cmd_executor_mutex);
+        if (not _cmd_executor) {
+            _cmd_executor =
+                std::make_unique<uhd::serial_task_executor>("uhd_usrp_cmd");
+        }
+        return _cmd_executor->post(std::move(task));
+    }
+
 private:
     /**************************************************************************
      * Private Helpers
@@ -2353,6 +2415,11 @@ private:
 
     std::recursive_mutex _graph_mutex;
 
+    //! Command thread for post_task(), started on first use. Declared after
+    // _graph so it is torn down (draining all queued tasks) before the graph.
+    std::mutex _cmd_executor_mutex;
+    std::unique_ptr<uhd::serial_task_executor> _cmd_executor;
+
     std::shared_ptr<redirector_device> _device;
 };
 
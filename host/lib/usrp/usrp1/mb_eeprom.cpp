@@ -30,18 +30,28 @@ mboard_eeprom_t usrp1_impl::get_mb_eeprom(uhd::i2c_iface::sptr iface)
 {
     mboard_eeprom_t mb_eeprom;
 
+    // Read the region holding the burned-in fields in one transfer and parse
+    // host-side instead of issuing one transaction per field
+    const size_t base = offsetof(usrp1_eeprom_map, mcr);
+    const byte_vector_t bytes =
+        iface->read_eeprom(USRP1_EEPROM_ADDR, base, sizeof(usrp1_eeprom_map) - base);
+    auto field_bytes = [&bytes, base](const size_t offset, const size_t length) {
+        return byte_vector_t(
+            bytes.begin() + (offset - base), bytes.begin() + (offset - base) + length);
+    };
+
     // extract the serial
-    mb_eeprom["serial"] = uhd::bytes_to_string(iface->read_eeprom(
-        USRP1_EEPROM_ADDR, offsetof(usrp1_eeprom_map, serial), USRP1_SERIAL_LEN));
+    mb_eeprom["serial"] = uhd::bytes_to_string(
+        field_bytes(offsetof(usrp1_eeprom_map, serial), USRP1_SERIAL_LEN));
 
     // extract the name
-    mb_eeprom["name"] = uhd::bytes_to_string(iface->read_eeprom(
-        USRP1_EEPROM_ADDR, offsetof(usrp1_eeprom_map, name), NAME_MAX_LEN));
+    mb_eeprom["name"] =
+        uhd::bytes_to_string(field_bytes(offsetof(usrp1_eeprom_map, name), NAME_MAX_LEN));
 
     // extract master clock rate as a 32-bit uint in Hz
     uint32_t master_clock_rate;
-    const byte_vector_t rate_bytes = iface->read_eeprom(
-        USRP1_EEPROM_ADDR, offsetof(usrp1_eeprom_map, mcr), sizeof(master_clock_rate));
+    const byte_vector_t rate_bytes =
+        field_bytes(offsetof(usrp1_eeprom_map, mcr), sizeof(master_clock_rate));
     std::copy(rate_bytes.begin(),
         rate_bytes.end(), // input
         reinterpret_cast<uint8_t*>(&master_clock_rate) // output
@@ -11,17 +11,20 @@
 #include "usrp2_impl.hpp"
 #include "usrp2_regs.hpp"
 #include <uhd/exception.hpp>
-#include <uhd/transport/bounded_buffer.hpp>
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
 #include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/zero_copy_flow_ctrl.hpp>
 #include <uhdlib/usrp/common/async_packet_handler.hpp>
 #include <uhdlib/usrp/common/validate_subdev_spec.hpp>
+#include <uhdlib/utils/bounded_queue.hpp>
 #include <boost/asio.hpp>
 #include <boost/format.hpp>
+#include <boost/thread/condition.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <iostream>
@@ -65,7 +68,6 @@ public:
     flow_control_monitor(seq_type max_seqs_out) : _max_seqs_out(max_seqs_out)
     {
         this->clear();
-        _ready_fcn = std::bind(&flow_control_monitor::ready, this);
     }
 
     //! Clear the monitor, Ex: when a streamer is created
@@ -92,11 +94,13 @@ public:
      */
     UHD_INLINE bool check_fc_condition(double timeout)
     {
-        boost::mutex::scoped_lock lock(_fc_mutex);
+        // lock-free fast path: the common case is that we are not throttled
         if (this->ready())
             return true;
+        boost::mutex::scoped_lock lock(_fc_mutex);
         boost::this_thread::disable_interruption di; // disable because the wait can throw
-        return _fc_cond.timed_wait(lock, to_time_dur(timeout), _ready_fcn);
+        return _fc_cond.timed_wait(
+            lock, to_time_dur(timeout), [this]() { return this->ready(); });
     }
 
     /*!
@@ -119,9 +123,38 @@ private:
 
     boost::mutex _fc_mutex;
     boost::condition _fc_cond;
-    seq_type _last_seq_out, _last_seq_ack;
+    std::atomic<seq_type> _last_seq_out, _last_seq_ack;
     const seq_type _max_seqs_out;
-    std::function<bool(void)> _ready_fcn;
+};
+
+/***********************************************************************
+ * Send flow control policy for the templated zero copy flow ctrl layer:
+ * throttle on the monitor before a buffer is handed out and stamp the
+ * flow control word into it. The hooks inline into the buffer path.
+ **********************************************************************/
+struct usrp2_send_flow_ctrl_t
+{
+    static const bool enabled          = true;
+    static const bool has_release_hook = false;
+
+    usrp2_send_flow_ctrl_t(flow_control_monitor::sptr fc_mon) : _fc_mon(fc_mon) {}
+
+    bool wait_for_send(double timeout)
+    {
+        return _fc_mon->check_fc_condition(timeout);
+    }
+
+    void on_send_buff(managed_send_buffer::sptr& buff)
+    {
+        buff->cast<uint32_t*>()[0] = uhd::htonx(_fc_mon->get_curr_seq_out());
+    }
+
+    bool on_send_release(managed_send_buffer::sptr&)
+    {
+        return true;
+    }
+
+    flow_control_monitor::sptr _fc_mon;
 };
 
 /***********************************************************************
@@ -145,32 +178,14 @@ struct usrp2_impl::io_impl
         pirate_tasks.clear();
     }
 
-    managed_send_buffer::sptr get_send_buff(size_t chan, double timeout)
-    {
-        flow_control_monitor& fc_mon = *fc_mons[chan];
-
-        // wait on flow control w/ timeout
-        if (not fc_mon.check_fc_condition(timeout))
-            return managed_send_buffer::sptr();
-
-        // get a buffer from the transport w/ timeout
-        managed_send_buffer::sptr buff = tx_xports[chan]->get_send_buff(timeout);
-
-        // write the flow control word into the buffer
-        if (buff.get())
-            buff->cast<uint32_t*>()[0] = uhd::htonx(fc_mon.get_curr_seq_out());
-
-        return buff;
-    }
-
-    // tx dsp: xports and flow control monitors
+    // tx dsp: flow controlled xports and flow control monitors
     std::vector<zero_copy_if::sptr> tx_xports;
     std::vector<flow_control_monitor::sptr> fc_mons;
 
     // methods and variables for the pirate crew
     void recv_pirate_loop(zero_copy_if::sptr, size_t, const std::atomic<bool>&);
     std::list<task::sptr> pirate_tasks;
-    bounded_buffer<async_metadata_t> async_msg_fifo;
+    uhd::utils::bounded_queue<async_metadata_t> async_msg_fifo;
     double tick_rate;
 };
 
@@ -243,11 +258,13 @@ void usrp2_impl::io_init(void)
 
     // init first so we dont have an access race
     for (const std::string& mb : _mbc.keys()) {
-        // init the tx xport and flow control monitor
-        _io_impl->tx_xports.push_back(_mbc[mb].tx_dsp_xport);
+        // init the flow control monitor and the flow controlled tx xport
         _io_impl->fc_mons.push_back(flow_control_monitor::sptr(
             new flow_control_monitor(device_addr.cast("send_buff_size", USRP2_SRAM_BYTES)
                                      / _mbc[mb].tx_dsp_xport->get_send_frame_size())));
+        _io_impl->tx_xports.push_back(make_zero_copy_flow_ctrl(_mbc[mb].tx_dsp_xport,
+            usrp2_send_flow_ctrl_t(_io_impl->fc_mons.back()),
+            no_recv_flow_ctrl_t()));
     }
 
     // allocate streamer weak ptrs containers
@@ -588,12 +605,11 @@ tx_streamer::sptr usrp2_impl::get_tx_stream(const uhd::stream_args_t& args_)
                 }
                 _mbc[mb].tx_dsp->setup(args);
                 my_streamer->set_xport_chan_get_buff(chan_i,
-                    std::bind(&usrp2_impl::io_impl::get_send_buff,
-                        _io_impl.get(),
-                        abs,
+                    std::bind(&zero_copy_if::get_send_buff,
+                        _io_impl->tx_xports[abs],
                         std::placeholders::_1));
                 my_streamer->set_async_receiver(
-                    std::bind(&bounded_buffer<async_metadata_t>::pop_with_timed_wait,
+                    std::bind(&uhd::utils::bounded_queue<async_metadata_t>::pop_with_timed_wait,
                         &(_io_impl->async_msg_fifo),
                         std::placeholders::_1,
                         std::placeholders::_2));
@@ -44,39 +44,43 @@ mboard_eeprom_t usrp2_impl::get_mb_eeprom(usrp2_iface& iface)
 {
     uhd::usrp::mboard_eeprom_t mb_eeprom;
 
+    // Read the entire EEPROM map in one chunked transfer and parse the
+    // fields host-side instead of issuing one transaction per field
+    const byte_vector_t bytes =
+        iface.read_eeprom(N200_EEPROM_ADDR, 0, sizeof(struct n200_eeprom_map));
+    auto field_bytes = [&bytes](const size_t offset, const size_t length) {
+        return byte_vector_t(bytes.begin() + offset, bytes.begin() + offset + length);
+    };
+
     // extract the hardware number
-    mb_eeprom["hardware"] = uint16_bytes_to_string(
-        iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, hardware), 2));
+    mb_eeprom["hardware"] =
+        uint16_bytes_to_string(field_bytes(offsetof(n200_eeprom_map, hardware), 2));
 
     // extract the revision number
-    mb_eeprom["revision"] = uint16_bytes_to_string(
-        iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, revision), 2));
+    mb_eeprom["revision"] =
+        uint16_bytes_to_string(field_bytes(offsetof(n200_eeprom_map, revision), 2));
 
     // extract the product code
-    mb_eeprom["product"] = uint16_bytes_to_string(
-        iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, product), 2));
+    mb_eeprom["product"] =
+        uint16_bytes_to_string(field_bytes(offsetof(n200_eeprom_map, product), 2));
 
     // extract the addresses
-    mb_eeprom["mac-addr"] = mac_addr_t::from_bytes(
-        iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, mac_addr), 6))
-                                .to_string();
+    mb_eeprom["mac-addr"] =
+        mac_addr_t::from_bytes(field_bytes(offsetof(n200_eeprom_map, mac_addr), 6))
+            .to_string();
 
     boost::asio::ip::address_v4::bytes_type ip_addr_bytes;
-    byte_copy(iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, ip_addr), 4),
-        ip_addr_bytes);
+    byte_copy(field_bytes(offsetof(n200_eeprom_map, ip_addr), 4), ip_addr_bytes);
     mb_eeprom["ip-addr"] = boost::asio::ip::address_v4(ip_addr_bytes).to_string();
 
-    byte_copy(iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, subnet), 4),
-        ip_addr_bytes);
+    byte_copy(field_bytes(offsetof(n200_eeprom_map, subnet), 4), ip_addr_bytes);
     mb_eeprom["subnet"] = boost::asio::ip::address_v4(ip_addr_bytes).to_string();
 
-    byte_copy(iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, gateway), 4),
-        ip_addr_bytes);
+    byte_copy(field_bytes(offsetof(n200_eeprom_map, gateway), 4), ip_addr_bytes);
     mb_eeprom["gateway"] = boost::asio::ip::address_v4(ip_addr_bytes).to_string();
 
     // gpsdo capabilities
-    uint8_t gpsdo_byte =
-        iface.read_eeprom(N200_EEPROM_ADDR, offsetof(n200_eeprom_map, gpsdo), 1).at(0);
+    uint8_t gpsdo_byte = bytes.at(offsetof(n200_eeprom_map, gpsdo));
     switch (n200_gpsdo_type(gpsdo_byte)) {
         case N200_GPSDO_INTERNAL:
             mb_eeprom["gpsdo"] = "internal";
@@ -89,12 +93,12 @@ mboard_eeprom_t usrp2_impl::get_mb_eeprom(usrp2_iface& iface)
     }
 
     // extract the serial
-    mb_eeprom["serial"] = bytes_to_string(iface.read_eeprom(
-        N200_EEPROM_ADDR, offsetof(n200_eeprom_map, serial), SERIAL_LEN));
+    mb_eeprom["serial"] =
+        bytes_to_string(field_bytes(offsetof(n200_eeprom_map, serial), SERIAL_LEN));
 
     // extract the name
-    mb_eeprom["name"] = bytes_to_string(iface.read_eeprom(
-        N200_EEPROM_ADDR, offsetof(n200_eeprom_map, name), NAME_MAX_LEN));
+    mb_eeprom["name"] =
+        bytes_to_string(field_bytes(offsetof(n200_eeprom_map, name), NAME_MAX_LEN));
 
     // Empty serial correction: use the mac address to determine serial.
     // Older usrp2 models don't have a serial burned into EEPROM.
@@ -23,9 +23,11 @@
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/thread.hpp>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 typedef boost::asio::ip::address_v4 ip_v4;
 
@@ -44,6 +46,13 @@ using namespace uhd::transport;
 #define N200_UDP_FW_UPDATE_PORT 49154
 #define UDP_TIMEOUT 0.5
 
+// Default and maximum number of outstanding flash requests during the
+// write and verify passes. Pipelining hides the round trip per block;
+// window=1 restores the old strict lockstep behavior.
+#define N200_FLASH_DEFAULT_WINDOW 8
+#define N200_FLASH_MAX_WINDOW 32
+#define N200_FLASH_MAX_RETRIES 3
+
 #define N200_FW_MAX_SIZE_BYTES 31744
 #define N200_PROD_FW_IMAGE_ADDR 0x00300000
 #define N200_SAFE_FW_IMAGE_ADDR 0x003F0000
@@ -132,6 +141,7 @@ typedef struct
     uint32_t size;
     uint32_t max_size;
     uint32_t flash_addr;
+    size_t window;
     udp_simple::sptr xport;
 } n200_session_t;
 
@@ -177,14 +187,20 @@ static void print_usrp2_error(const image_loader::image_loader_args_t& image_loa
 /*
  * Ethernet communication functions
  */
+static UHD_INLINE void n200_send(
+    udp_simple::sptr xport, n200_fw_update_id_t pkt_code, n200_fw_update_data_t* pkt_out)
+{
+    pkt_out->proto_ver = htonx<uint32_t>(USRP2_FW_COMPAT_NUM);
+    pkt_out->id        = htonx<uint32_t>(pkt_code);
+    xport->send(boost::asio::buffer(pkt_out, sizeof(*pkt_out)));
+}
+
 static UHD_INLINE size_t n200_send_and_recv(udp_simple::sptr xport,
     n200_fw_update_id_t pkt_code,
     n200_fw_update_data_t* pkt_out,
     uint8_t* data)
 {
-    pkt_out->proto_ver = htonx<uint32_t>(USRP2_FW_COMPAT_NUM);
-    pkt_out->id        = htonx<uint32_t>(pkt_code);
-    xport->send(boost::asio::buffer(pkt_out, sizeof(*pkt_out)));
+    n200_send(xport, pkt_code, pkt_out);
     return xport->recv(boost::asio::buffer(data, udp_simple::mtu), UDP_TIMEOUT);
 }
 
@@ -388,10 +404,56 @@ static void n200_setup_session(n200_session_t& session,
         session.burn_type = session.fw ? "firmware" : "FPGA";
     }
 
+    session.window = image_loader_args.args.cast<size_t>(
+        "window", N200_FLASH_DEFAULT_WINDOW);
+    if (session.window < 1) {
+        session.window = 1;
+    } else if (session.window > N200_FLASH_MAX_WINDOW) {
+        session.window = N200_FLASH_MAX_WINDOW;
+    }
+
     session.xport = udp_simple::make_connected(
         session.dev_addr["addr"], BOOST_STRINGIZE(N200_UDP_FW_UPDATE_PORT));
 }
 
+/*
+ * Read the image file into a buffer padded to a whole number of flash
+ * packets, so any block can be (re)sent or compared on demand.
+ */
+static std::vector<uint8_t> n200_read_image_file(
+    const n200_session_t& session, const size_t num_blocks)
+{
+    std::vector<uint8_t> image_data(num_blocks * N200_FLASH_DATA_PACKET_SIZE, 0);
+    std::ifstream image(session.filepath.c_str(), std::ios::binary);
+    image.read((char*)image_data.data(), session.size);
+    image.close();
+    return image_data;
+}
+
+/*
+ * Attribute a flash response to the block we expect to be acknowledged
+ * next. The firmware echoes the flash address of the request it is
+ * acknowledging; responses for any other block are duplicates from a
+ * retransmission (or acks that raced a timeout) and must be dropped so the
+ * counting stays aligned. If the echoed address is not within the image
+ * being burned, the response cannot be attributed and is counted against
+ * the oldest outstanding request, since the device services requests in
+ * arrival order.
+ */
+static bool n200_ack_is_next(const n200_session_t& session,
+    const n200_fw_update_data_t* pkt_in,
+    const size_t num_blocks,
+    const size_t next_to_ack)
+{
+    const uint32_t addr = ntohl(pkt_in->data.flash_args.flash_addr);
+    if (addr < session.flash_addr
+        or addr >= session.flash_addr + num_blocks * N200_FLASH_DATA_PACKET_SIZE) {
+        return true;
+    }
+    const size_t block = (addr - session.flash_addr) / N200_FLASH_DATA_PACKET_SIZE;
+    return block == next_to_ack;
+}
+
 static void n200_erase_image(n200_session_t& session)
 {
     // UDP receive buffer
@@ -449,51 +511,68 @@ static void n200_write_image(n200_session_t& session)
         reinterpret_cast<const n200_fw_update_data_t*>(session.data_in);
     size_t len = 0;
 
-    // Write image
-    std::ifstream image(session.filepath.c_str(), std::ios::binary);
-    uint32_t current_addr          = session.flash_addr;
+    const size_t num_blocks = (session.size / N200_FLASH_DATA_PACKET_SIZE) + 1;
+    const std::vector<uint8_t> image_data = n200_read_image_file(session, num_blocks);
+
     pkt_out.data.flash_args.length = htonx<uint32_t>(N200_FLASH_DATA_PACKET_SIZE);
-    for (size_t i = 0; i < ((session.size / N200_FLASH_DATA_PACKET_SIZE) + 1); i++) {
-        pkt_out.data.flash_args.flash_addr = htonx<uint32_t>(current_addr);
-        memset(pkt_out.data.flash_args.data, 0x0, N200_FLASH_DATA_PACKET_SIZE);
-        image.read((char*)pkt_out.data.flash_args.data, N200_FLASH_DATA_PACKET_SIZE);
 
-        len =
-            n200_send_and_recv(session.xport, WRITE_FLASH_CMD, &pkt_out, session.data_in);
+    /*
+     * Keep a window of outstanding write requests on the wire instead of
+     * paying a full round trip per block. The device services datagrams in
+     * arrival order and rewriting an erased block with the same data is
+     * idempotent, so a timeout simply resends everything that has not been
+     * acknowledged yet (go-back-N). The verify pass reads every block back
+     * afterwards, so a write that was lost despite the accounting cannot go
+     * unnoticed.
+     */
+    size_t next_to_send = 0;
+    size_t next_to_ack  = 0;
+    size_t num_timeouts = 0;
+    while (next_to_ack < num_blocks) {
+        for (; next_to_send < num_blocks
+               and (next_to_send - next_to_ack) < session.window;
+             next_to_send++) {
+            pkt_out.data.flash_args.flash_addr = htonx<uint32_t>(
+                session.flash_addr + next_to_send * N200_FLASH_DATA_PACKET_SIZE);
+            memcpy(pkt_out.data.flash_args.data,
+                &image_data[next_to_send * N200_FLASH_DATA_PACKET_SIZE],
+                N200_FLASH_DATA_PACKET_SIZE);
+            n200_send(session.xport, WRITE_FLASH_CMD, &pkt_out);
+        }
+
+        len = session.xport->recv(
+            boost::asio::buffer(session.data_in, udp_simple::mtu), UDP_TIMEOUT);
         if (n200_response_matches(pkt_in, WRITE_FLASH_ACK, len)) {
-            std::cout << boost::format("\r-- Writing %s image (%d%%)") % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
-                      << std::flush;
+            if (n200_ack_is_next(session, pkt_in, num_blocks, next_to_ack)) {
+                next_to_ack++;
+                num_timeouts = 0;
+                std::cout << boost::format("\r-- Writing %s image (%d%%)")
+                                 % session.burn_type
+                                 % int(double(next_to_ack) / double(num_blocks) * 100)
+                          << std::flush;
+            }
         } else if (len < offsetof(n200_fw_update_data_t, data)) {
-            image.close();
-            std::cout << boost::format("\r--Writing %s image..failed at %d%%.")
-                             % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
-                      << std::endl;
-            throw uhd::runtime_error("Timed out waiting for reply from device.");
+            if (++num_timeouts > N200_FLASH_MAX_RETRIES) {
+                std::cout << boost::format("\r--Writing %s image..failed at %d%%.")
+                                 % session.burn_type
+                                 % int(double(next_to_ack) / double(num_blocks) * 100)
+                          << std::endl;
+                throw uhd::runtime_error("Timed out waiting for reply from device.");
+            }
+            // Resend the outstanding window
+            next_to_send = next_to_ack;
         } else if (ntohl(pkt_in->id) != WRITE_FLASH_ACK) {
-            image.close();
             std::cout << boost::format("\r--Writing %s image..failed at %d%%.")
                              % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
+                             % int(double(next_to_ack) / double(num_blocks) * 100)
                       << std::endl;
             throw uhd::runtime_error(
                 str(boost::format("Received invalid reply %d from device.\n")
                     % ntohl(pkt_in->id)));
         }
-
-        current_addr += N200_FLASH_DATA_PACKET_SIZE;
     }
     std::cout << boost::format("\r-- Writing %s image...successful.") % session.burn_type
               << std::endl;
-
-    image.close();
 }
 
 static void n200_verify_image(n200_session_t& session)
@@ -504,69 +583,77 @@ static void n200_verify_image(n200_session_t& session)
         reinterpret_cast<const n200_fw_update_data_t*>(session.data_in);
     size_t len = 0;
 
-    // Read and verify image
-    std::ifstream image(session.filepath.c_str(), std::ios::binary);
-    uint8_t image_part[N200_FLASH_DATA_PACKET_SIZE];
-    uint32_t current_addr          = session.flash_addr;
+    const size_t num_blocks = (session.size / N200_FLASH_DATA_PACKET_SIZE) + 1;
+    const std::vector<uint8_t> image_data = n200_read_image_file(session, num_blocks);
+
     pkt_out.data.flash_args.length = htonx<uint32_t>(N200_FLASH_DATA_PACKET_SIZE);
-    uint16_t cmp_len               = 0;
-    for (size_t i = 0; i < ((session.size / N200_FLASH_DATA_PACKET_SIZE) + 1); i++) {
-        memset(image_part, 0x0, N200_FLASH_DATA_PACKET_SIZE);
-        memset((void*)pkt_in->data.flash_args.data, 0x0, N200_FLASH_DATA_PACKET_SIZE);
 
-        pkt_out.data.flash_args.flash_addr = htonx<uint32_t>(current_addr);
-        image.read((char*)image_part, N200_FLASH_DATA_PACKET_SIZE);
-        cmp_len = image.gcount();
+    // Same windowed request pipeline as the write pass; reads are idempotent
+    // so retransmission on timeout is always safe. A response that cannot be
+    // attributed to the expected block is dropped rather than compared, so
+    // packet loss can delay verification but never produce a false pass.
+    size_t next_to_send = 0;
+    size_t next_to_ack  = 0;
+    size_t num_timeouts = 0;
+    while (next_to_ack < num_blocks) {
+        for (; next_to_send < num_blocks
+               and (next_to_send - next_to_ack) < session.window;
+             next_to_send++) {
+            pkt_out.data.flash_args.flash_addr = htonx<uint32_t>(
+                session.flash_addr + next_to_send * N200_FLASH_DATA_PACKET_SIZE);
+            n200_send(session.xport, READ_FLASH_CMD, &pkt_out);
+        }
 
-        len =
-            n200_send_and_recv(session.xport, READ_FLASH_CMD, &pkt_out, session.data_in);
+        len = session.xport->recv(
+            boost::asio::buffer(session.data_in, udp_simple::mtu), UDP_TIMEOUT);
         if (n200_response_matches(pkt_in, READ_FLASH_ACK, len)) {
+            if (not n200_ack_is_next(session, pkt_in, num_blocks, next_to_ack)) {
+                continue;
+            }
             std::cout << boost::format("\r-- Verifying %s image (%d%%)")
                              % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
+                             % int(double(next_to_ack) / double(num_blocks) * 100)
                       << std::flush;
 
-            if (memcmp(image_part, pkt_in->data.flash_args.data, cmp_len)) {
+            // The last block of the image may only be partially covered
+            const size_t cmp_len =
+                std::min<size_t>(N200_FLASH_DATA_PACKET_SIZE,
+                    session.size - next_to_ack * N200_FLASH_DATA_PACKET_SIZE);
+            if (memcmp(&image_data[next_to_ack * N200_FLASH_DATA_PACKET_SIZE],
+                    pkt_in->data.flash_args.data,
+                    cmp_len)) {
                 std::cout << boost::format("\r-- Verifying %s image...failed at %d%%.")
                                  % session.burn_type
-                                 % int((double(current_addr - session.flash_addr)
-                                           / double(session.size))
-                                       * 100)
+                                 % int(double(next_to_ack) / double(num_blocks) * 100)
                           << std::endl;
                 throw uhd::runtime_error(
                     str(boost::format("Failed to verify %s image.") % session.burn_type));
             }
+            next_to_ack++;
+            num_timeouts = 0;
         } else if (len < offsetof(n200_fw_update_data_t, data)) {
-            image.close();
-            std::cout << boost::format("\r-- Verifying %s image...failed at %d%%.")
-                             % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
-                      << std::endl;
-            throw uhd::runtime_error("Timed out waiting for reply from device.");
+            if (++num_timeouts > N200_FLASH_MAX_RETRIES) {
+                std::cout << boost::format("\r-- Verifying %s image...failed at %d%%.")
+                                 % session.burn_type
+                                 % int(double(next_to_ack) / double(num_blocks) * 100)
+                          << std::endl;
+                throw uhd::runtime_error("Timed out waiting for reply from device.");
+            }
+            // Resend the outstanding window
+            next_to_send = next_to_ack;
         } else if (ntohl(pkt_in->id) != READ_FLASH_ACK) {
-            image.close();
             std::cout << boost::format("\r-- Verifying %s image...failed at %d%%.")
                              % session.burn_type
-                             % int((double(current_addr - session.flash_addr)
-                                       / double(session.size))
-                                   * 100)
+                             % int(double(next_to_ack) / double(num_blocks) * 100)
                       << std::endl;
             throw uhd::runtime_error(
                 str(boost::format("Received invalid reply %d from device.\n")
                     % ntohl(pkt_in->id)));
         }
-
-        current_addr += N200_FLASH_DATA_PACKET_SIZE;
     }
     std::cout << boost::format("\r-- Verifying %s image...successful.")
                      % session.burn_type
               << std::endl;
-
-    image.close();
 }
 
 static void n200_reset(n200_session_t& session)
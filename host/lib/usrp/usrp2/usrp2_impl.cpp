@@ -73,7 +73,7 @@ device_addrs_t usrp2_find(const device_addr_t& hint_)
 
     // if no address was specified, send a broadcast on each interface
     if (not hint.has_key("addr")) {
-        for (const if_addrs_t& if_addrs : get_if_addrs()) {
+        for (const if_addrs_t& if_addrs : get_if_addrs_cached()) {
             // avoid the loopback device
             if (if_addrs.inet == asio::ip::address_v4::loopback().to_string())
                 continue;
@@ -135,7 +135,7 @@ device_addrs_t usrp2_find(const device_addr_t& hint_)
             // Attempt a simple 2-way communication with a connected socket.
             // Reason: Although the USRP will respond the broadcast above,
             // we may not be able to communicate directly (non-broadcast).
-            udp_simple::sptr ctrl_xport = udp_simple::make_connected(
+            udp_simple::sptr ctrl_xport = udp_simple::make_connected_pooled(
                 new_addr["addr"], BOOST_STRINGIZE(USRP2_UDP_CTRL_PORT));
             ctrl_xport->send(boost::asio::buffer(&ctrl_data_out, sizeof(ctrl_data_out)));
             size_t len = ctrl_xport->recv(asio::buffer(usrp2_ctrl_data_in_mem));
@@ -376,8 +376,8 @@ usrp2_impl::usrp2_impl(const device_addr_t& _device_addr)
         ////////////////////////////////////////////////////////////////
         // create the iface that controls i2c, spi, uart, and wb
         ////////////////////////////////////////////////////////////////
-        _mbc[mb].iface = usrp2_iface::make(
-            udp_simple::make_connected(addr, BOOST_STRINGIZE(USRP2_UDP_CTRL_PORT)));
+        _mbc[mb].iface = usrp2_iface::make(udp_simple::make_connected_pooled(
+            addr, BOOST_STRINGIZE(USRP2_UDP_CTRL_PORT)));
         _tree->create<std::string>(mb_path / "name").set(_mbc[mb].iface->get_cname());
         _tree->create<std::string>(mb_path / "fw_version")
             .set(_mbc[mb].iface->get_fw_version_string());
@@ -59,6 +59,12 @@ struct uhd_tx_streamer
     size_t usrp_index;
     uhd::tx_streamer::sptr streamer;
     std::string last_error;
+    /* Cached at uhd_usrp_get_tx_stream() so the send() fast path can skip the
+     * virtual get_num_channels() call */
+    size_t num_channels = 0;
+    /* True whenever last_error and the global error string need a refresh on
+     * the next successful streaming call; see uhd_tx_streamer_send() */
+    bool error_state_stale = true;
 };
 
 struct uhd_rx_streamer
@@ -66,6 +72,12 @@ struct uhd_rx_streamer
     size_t usrp_index;
     uhd::rx_streamer::sptr streamer;
     std::string last_error;
+    /* Cached at uhd_usrp_get_rx_stream() so the recv() fast path can skip the
+     * virtual get_num_channels() call */
+    size_t num_channels = 0;
+    /* True whenever last_error and the global error string need a refresh on
+     * the next successful streaming call; see uhd_rx_streamer_recv() */
+    bool error_state_stale = true;
 };
 
 /* Not public: We use this for our internal registry */
@@ -111,6 +123,13 @@ uhd_error uhd_rx_streamer_max_num_samps(
     UHD_SAFE_C_SAVE_ERROR(h, *max_num_samps_out = h->streamer->get_max_num_samps();)
 }
 
+/* Streaming fast path: this is a hand-rolled UHD_SAFE_C_SAVE_ERROR. The macro
+ * updates last_error and the mutex-protected global error string on *every*
+ * call, successful or not, which is measurable wrapper tax in a recv loop. We
+ * only pay for the error bookkeeping on failure (and on the first success
+ * after a failure, to flush the stale strings); a successful call in steady
+ * state touches no error state at all. The channel count is cached in the
+ * handle, so no virtual call is needed either. */
 uhd_error uhd_rx_streamer_recv(uhd_rx_streamer_handle h,
     void** buffs,
     size_t samps_per_buff,
@@ -119,10 +138,37 @@ uhd_error uhd_rx_streamer_recv(uhd_rx_streamer_handle h,
     bool one_packet,
     size_t* items_recvd)
 {
-    UHD_SAFE_C_SAVE_ERROR(
-        h, uhd::rx_streamer::buffs_type buffs_cpp(buffs, h->streamer->get_num_channels());
+    try {
+        uhd::rx_streamer::buffs_type buffs_cpp(buffs, h->num_channels);
         *items_recvd = h->streamer->recv(
-            buffs_cpp, samps_per_buff, (*md)->rx_metadata_cpp, timeout, one_packet);)
+            buffs_cpp, samps_per_buff, (*md)->rx_metadata_cpp, timeout, one_packet);
+    } catch (const uhd::exception& e) {
+        set_c_global_error_string(e.what());
+        h->last_error        = e.what();
+        h->error_state_stale = true;
+        return error_from_uhd_exception(&e);
+    } catch (const boost::exception& e) {
+        set_c_global_error_string(boost::diagnostic_information(e));
+        h->last_error        = boost::diagnostic_information(e);
+        h->error_state_stale = true;
+        return UHD_ERROR_BOOSTEXCEPT;
+    } catch (const std::exception& e) {
+        set_c_global_error_string(e.what());
+        h->last_error        = e.what();
+        h->error_state_stale = true;
+        return UHD_ERROR_STDEXCEPT;
+    } catch (...) {
+        set_c_global_error_string("Unrecognized exception caught.");
+        h->last_error        = "Unrecognized exception caught.";
+        h->error_state_stale = true;
+        return UHD_ERROR_UNKNOWN;
+    }
+    if (h->error_state_stale) {
+        h->last_error = "None";
+        set_c_global_error_string("None");
+        h->error_state_stale = false;
+    }
+    return UHD_ERROR_NONE;
 }
 
 uhd_error uhd_rx_streamer_issue_stream_cmd(
@@ -167,6 +213,7 @@ uhd_error uhd_tx_streamer_max_num_samps(
     UHD_SAFE_C_SAVE_ERROR(h, *max_num_samps_out = h->streamer->get_max_num_samps();)
 }
 
+/* Streaming fast path; same structure and rationale as uhd_rx_streamer_recv() */
 uhd_error uhd_tx_streamer_send(uhd_tx_streamer_handle h,
     const void** buffs,
     size_t samps_per_buff,
@@ -174,10 +221,37 @@ uhd_error uhd_tx_streamer_send(uhd_tx_streamer_handle h,
     double timeout,
     size_t* items_sent)
 {
-    UHD_SAFE_C_SAVE_ERROR(
-        h, uhd::tx_streamer::buffs_type buffs_cpp(buffs, h->streamer->get_num_channels());
+    try {
+        uhd::tx_streamer::buffs_type buffs_cpp(buffs, h->num_channels);
         *items_sent = h->streamer->send(
-            buffs_cpp, samps_per_buff, (*md)->tx_metadata_cpp, timeout);)
+            buffs_cpp, samps_per_buff, (*md)->tx_metadata_cpp, timeout);
+    } catch (const uhd::exception& e) {
+        set_c_global_error_string(e.what());
+        h->last_error        = e.what();
+        h->error_state_stale = true;
+        return error_from_uhd_exception(&e);
+    } catch (const boost::exception& e) {
+        set_c_global_error_string(boost::diagnostic_information(e));
+        h->last_error        = boost::diagnostic_information(e);
+        h->error_state_stale = true;
+        return UHD_ERROR_BOOSTEXCEPT;
+    } catch (const std::exception& e) {
+        set_c_global_error_string(e.what());
+        h->last_error        = e.what();
+        h->error_state_stale = true;
+        return UHD_ERROR_STDEXCEPT;
+    } catch (...) {
+        set_c_global_error_string("Unrecognized exception caught.");
+        h->last_error        = "Unrecognized exception caught.";
+        h->error_state_stale = true;
+        return UHD_ERROR_UNKNOWN;
+    }
+    if (h->error_state_stale) {
+        h->last_error = "None";
+        set_c_global_error_string("None");
+        h->error_state_stale = false;
+    }
+    return UHD_ERROR_NONE;
 }
 
 uhd_error uhd_tx_streamer_recv_async_msg(uhd_tx_streamer_handle h,
@@ -267,7 +341,9 @@ uhd_error uhd_usrp_get_rx_stream(
 
         usrp_ptr& usrp  = get_usrp_ptrs()[h_u->usrp_index];
         h_s->streamer   = usrp.ptr->get_rx_stream(stream_args_c_to_cpp(stream_args));
-        h_s->usrp_index = h_u->usrp_index;)
+        h_s->usrp_index = h_u->usrp_index;
+        /* Cache for the recv() fast path */
+        h_s->num_channels = h_s->streamer->get_num_channels();)
 }
 
 static boost::mutex _usrp_get_tx_stream_mutex;
@@ -284,7 +360,9 @@ uhd_error uhd_usrp_get_tx_stream(
 
         usrp_ptr& usrp  = get_usrp_ptrs()[h_u->usrp_index];
         h_s->streamer   = usrp.ptr->get_tx_stream(stream_args_c_to_cpp(stream_args));
-        h_s->usrp_index = h_u->usrp_index;)
+        h_s->usrp_index = h_u->usrp_index;
+        /* Cache for the send() fast path */
+        h_s->num_channels = h_s->streamer->get_num_channels();)
 }
 
 /****************************************************************************
@@ -17,10 +17,16 @@ using namespace uhd::usrp::x300;
  * claimer logic
  **********************************************************************/
 
-void uhd::usrp::x300::claimer_loop(wb_iface::sptr iface)
+void uhd::usrp::x300::claimer_loop(wb_iface::sptr iface, const size_t claim_period_ms)
 {
-    claim(iface);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    // The heartbeat only needs to refresh the claim time. The claim source
+    // hash does not change for the lifetime of the process and was already
+    // written when the claim was acquired, so skipping it here halves the
+    // number of control packets per heartbeat. Each register access is one
+    // UDP transaction on the same NIC as the streaming traffic, which is
+    // also why the period is configurable (see claim_period_ms device arg).
+    iface->poke32(X300_FW_SHMEM_ADDR(X300_FW_SHMEM_CLAIM_TIME), uint32_t(time(NULL)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(claim_period_ms));
 }
 
 claim_status_t uhd::usrp::x300::claim_status(wb_iface::sptr iface)
@@ -15,7 +15,9 @@ namespace uhd { namespace usrp { namespace x300 {
 enum claim_status_t { UNCLAIMED, CLAIMED_BY_US, CLAIMED_BY_OTHER };
 
 claim_status_t claim_status(uhd::wb_iface::sptr iface);
-void claimer_loop(uhd::wb_iface::sptr iface);
+//! Run one claim heartbeat, then wait for \p claim_period_ms. Must only be
+//  called while holding the claim (see claim()).
+void claimer_loop(uhd::wb_iface::sptr iface, const size_t claim_period_ms = 1000);
 void claim(uhd::wb_iface::sptr iface);
 bool try_to_claim(uhd::wb_iface::sptr iface, long timeout = 2000);
 void release(uhd::wb_iface::sptr iface);
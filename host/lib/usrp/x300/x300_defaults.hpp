@@ -55,6 +55,15 @@ static constexpr double THREAD_BUFFER_TIMEOUT       = 0.1; // Time in seconds
 
 static constexpr double DEFAULT_EXT_ADC_SELF_TEST_DURATION = 30.0;
 
+//! Period of the claim heartbeat loop, in milliseconds
+static constexpr size_t DEFAULT_CLAIM_PERIOD_MS = 1000;
+//! Valid range for the claim heartbeat period. The firmware considers a
+//  claim stale a few seconds after the last refresh, so the period must
+//  stay well below that; the lower bound keeps an aggressive setting from
+//  flooding the control port.
+static constexpr size_t MIN_CLAIM_PERIOD_MS = 100;
+static constexpr size_t MAX_CLAIM_PERIOD_MS = 2000;
+
 }}} /* namespace uhd::usrp::x300 */
 
 #endif /* INCLUDED_X300_DEFAULTS_HPP */
@@ -41,6 +41,7 @@ public:
         , _download_fpga("download-fpga", false)
         , _recv_frame_size("recv_frame_size", DATA_FRAME_MAX_SIZE)
         , _send_frame_size("send_frame_size", DATA_FRAME_MAX_SIZE)
+        , _claim_period_ms("claim_period_ms", DEFAULT_CLAIM_PERIOD_MS)
     {
         // nop
     }
@@ -141,6 +142,10 @@ public:
     {
         return _send_frame_size.get();
     }
+    size_t get_claim_period_ms() const
+    {
+        return _claim_period_ms.get();
+    }
     device_addr_t get_orig_args() const
     {
         return _orig_args;
@@ -263,9 +268,11 @@ private:
         }
         PARSE_DEFAULT(_recv_frame_size)
         PARSE_DEFAULT(_send_frame_size)
+        PARSE_DEFAULT(_claim_period_ms)
 
         // Sanity check params
         _enforce_range(_master_clock_rate, MIN_TICK_RATE, MAX_TICK_RATE);
+        _enforce_range(_claim_period_ms, MIN_CLAIM_PERIOD_MS, MAX_CLAIM_PERIOD_MS);
         _enforce_discrete(_system_ref_rate, EXTERNAL_FREQ_OPTIONS);
         _enforce_discrete(_clock_source, CLOCK_SOURCE_OPTIONS);
         _enforce_discrete(_time_source, TIME_SOURCE_OPTIONS);
@@ -295,6 +302,7 @@ private:
     constrained_device_args_t::bool_arg _download_fpga;
     constrained_device_args_t::num_arg<size_t> _recv_frame_size;
     constrained_device_args_t::num_arg<size_t> _send_frame_size;
+    constrained_device_args_t::num_arg<size_t> _claim_period_ms;
 
     device_addr_t _orig_args;
 };
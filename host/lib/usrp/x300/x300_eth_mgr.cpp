@@ -24,6 +24,10 @@
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/utils/prefs.hpp>
+#ifdef UHD_PLATFORM_WIN32
+#    include <uhdlib/transport/udp_rio_link.hpp>
+#endif
 #include <uhdlib/usrp/cores/i2c_core_100_wb32.hpp>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk_simple.hpp>
@@ -77,7 +81,9 @@ constexpr size_t MAX_RATE_1GIGE     = (size_t)( // bytes/s
  *****************************************************************************/
 eth_manager::udp_simple_factory_t eth_manager::x300_get_udp_factory(const bool use_dpdk)
 {
-    udp_simple_factory_t udp_make_connected = udp_simple::make_connected;
+    // Pooled: the socket opened while probing a device during discovery is
+    // re-used for the firmware transactions of the session init
+    udp_simple_factory_t udp_make_connected = udp_simple::make_connected_pooled;
     if (use_dpdk) {
 #ifdef HAVE_DPDK
         udp_make_connected = [](const std::string& addr, const std::string& port) {
@@ -278,6 +284,21 @@ both_links_t eth_manager::get_links(link_type_t link_type,
             true);
 #else
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (_args.get_orig_args().has_key("use_rio")) {
+#ifdef UHD_PLATFORM_WIN32
+        size_t recv_buff_size, send_buff_size;
+        auto link = uhd::transport::udp_rio_link::make(conn.addr,
+            BOOST_STRINGIZE(X300_VITA_UDP_PORT),
+            link_params,
+            recv_buff_size,
+            send_buff_size);
+        return std::make_tuple(
+            link, send_buff_size, link, recv_buff_size, true, false);
+#else
+        UHD_LOG_WARNING("X300",
+            "Registered I/O is only available on Windows, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(conn.addr,
@@ -584,18 +605,48 @@ eth_manager::frame_size_t eth_manager::determine_max_frame_size(
     size_t max_send_frame_size =
         std::min(user_frame_size.send_frame_size, x300::DATA_FRAME_MAX_SIZE) & size_t(~3);
 
-    UHD_LOGGER_DEBUG("X300") << "Determining maximum frame size... ";
-    while (min_recv_frame_size < max_recv_frame_size) {
-        size_t test_frame_size = (max_recv_frame_size / 2 + min_recv_frame_size / 2 + 3)
-                                 & ~3;
-
+    // Little helpers to probe a single frame size in each direction: the
+    // recv test asks the device to pad its reply to the test size, the send
+    // test pads the request and expects the device to report how much of it
+    // arrived
+    auto test_recv_size = [&](const size_t test_frame_size) -> bool {
         request->flags = uhd::htonx<uint32_t>(X300_MTU_DETECT_ECHO_REQUEST);
         request->size  = uhd::htonx<uint32_t>(test_frame_size);
         udp->send(boost::asio::buffer(buffer, sizeof(x300_mtu_t)));
-
+        const size_t len = udp->recv(boost::asio::buffer(buffer), echo_timeout);
+        return len >= test_frame_size;
+    };
+    auto test_send_size = [&](const size_t test_frame_size) -> bool {
+        request->flags = uhd::htonx<uint32_t>(X300_MTU_DETECT_ECHO_REQUEST);
+        request->size  = uhd::htonx<uint32_t>(sizeof(x300_mtu_t));
+        udp->send(boost::asio::buffer(buffer, test_frame_size));
         size_t len = udp->recv(boost::asio::buffer(buffer), echo_timeout);
+        if (len >= sizeof(x300_mtu_t))
+            len = uhd::ntohx<uint32_t>(request->size);
+        return len >= test_frame_size;
+    };
+
+    // Frame sizes discovered in an earlier session are revalidated with one
+    // probe round per direction (the cached size must pass and the next size
+    // up must fail); only when the cache is stale do we pay for the full
+    // binary search below
+    const std::string cache_dev = "x300_" + addr;
+    const size_t cached_recv = uhd::prefs::get_cached_mtu(cache_dev, "recv_frame_size");
+    const size_t cached_send = uhd::prefs::get_cached_mtu(cache_dev, "send_frame_size");
+
+    UHD_LOGGER_DEBUG("X300") << "Determining maximum frame size... ";
+    if (cached_recv % 4 == 0 and cached_recv > min_recv_frame_size
+        and cached_recv <= max_recv_frame_size and test_recv_size(cached_recv)
+        and (cached_recv == max_recv_frame_size
+            or not test_recv_size(cached_recv + 4))) {
+        min_recv_frame_size = cached_recv;
+        max_recv_frame_size = cached_recv;
+    }
+    while (min_recv_frame_size < max_recv_frame_size) {
+        size_t test_frame_size = (max_recv_frame_size / 2 + min_recv_frame_size / 2 + 3)
+                                 & ~3;
 
-        if (len >= test_frame_size)
+        if (test_recv_size(test_frame_size))
             min_recv_frame_size = test_frame_size;
         else
             max_recv_frame_size = test_frame_size - 4;
@@ -606,19 +657,18 @@ eth_manager::frame_size_t eth_manager::determine_max_frame_size(
                                  "required by the IP protocol.");
     }
 
+    if (cached_send % 4 == 0 and cached_send > min_send_frame_size
+        and cached_send <= max_send_frame_size and test_send_size(cached_send)
+        and (cached_send == max_send_frame_size
+            or not test_send_size(cached_send + 4))) {
+        min_send_frame_size = cached_send;
+        max_send_frame_size = cached_send;
+    }
     while (min_send_frame_size < max_send_frame_size) {
         size_t test_frame_size = (max_send_frame_size / 2 + min_send_frame_size / 2 + 3)
                                  & ~3;
 
-        request->flags = uhd::htonx<uint32_t>(X300_MTU_DETECT_ECHO_REQUEST);
-        request->size  = uhd::htonx<uint32_t>(sizeof(x300_mtu_t));
-        udp->send(boost::asio::buffer(buffer, test_frame_size));
-
-        size_t len = udp->recv(boost::asio::buffer(buffer), echo_timeout);
-        if (len >= sizeof(x300_mtu_t))
-            len = uhd::ntohx<uint32_t>(request->size);
-
-        if (len >= test_frame_size)
+        if (test_send_size(test_frame_size))
             min_send_frame_size = test_frame_size;
         else
             max_send_frame_size = test_frame_size - 4;
@@ -629,6 +679,13 @@ eth_manager::frame_size_t eth_manager::determine_max_frame_size(
             "System send MTU size is less than the minimum required by the IP protocol.");
     }
 
+    if (min_recv_frame_size != cached_recv) {
+        uhd::prefs::update_cached_mtu(cache_dev, "recv_frame_size", min_recv_frame_size);
+    }
+    if (min_send_frame_size != cached_send) {
+        uhd::prefs::update_cached_mtu(cache_dev, "send_frame_size", min_send_frame_size);
+    }
+
     frame_size_t frame_size;
     // There are cases when NICs accept oversized packets, in which case we'd falsely
     // detect a larger-than-possible frame size. A safe and sensible value is the minimum
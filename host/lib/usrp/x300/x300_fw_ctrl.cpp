@@ -77,6 +77,43 @@ public:
         return 0;
     }
 
+    void poke32_many(const std::vector<std::pair<wb_addr_type, uint32_t>>& regs)
+    {
+        for (size_t i = 1; i <= num_retries; i++) {
+            boost::mutex::scoped_lock lock(reg_access);
+            try {
+                return this->__poke32_many(regs);
+            } catch (const uhd::io_error& ex) {
+                std::string error_msg =
+                    str(boost::format("%s: x300 fw communication failure #%u\n%s")
+                        % __loc_info() % i % ex.what());
+                if (errors)
+                    UHD_LOGGER_ERROR("X300") << error_msg;
+                if (i == num_retries)
+                    throw uhd::io_error(error_msg);
+            }
+        }
+    }
+
+    std::vector<uint32_t> peek32_many(const std::vector<wb_addr_type>& addrs)
+    {
+        for (size_t i = 1; i <= num_retries; i++) {
+            boost::mutex::scoped_lock lock(reg_access);
+            try {
+                return this->__peek32_many(addrs);
+            } catch (const uhd::io_error& ex) {
+                std::string error_msg =
+                    str(boost::format("%s: x300 fw communication failure #%u\n%s")
+                        % __loc_info() % i % ex.what());
+                if (errors)
+                    UHD_LOGGER_ERROR("X300") << error_msg;
+                if (i == num_retries)
+                    throw uhd::io_error(error_msg);
+            }
+        }
+        return std::vector<uint32_t>();
+    }
+
 protected:
     bool errors;
 
@@ -85,6 +122,23 @@ protected:
     virtual void __flush()                                              = 0;
     virtual std::string __loc_info()                                    = 0;
 
+    // Transports that cannot aggregate accesses fall back to one
+    // transaction per register
+    virtual void __poke32_many(const std::vector<std::pair<wb_addr_type, uint32_t>>& regs)
+    {
+        for (const auto& reg : regs)
+            this->__poke32(reg.first, reg.second);
+    }
+
+    virtual std::vector<uint32_t> __peek32_many(const std::vector<wb_addr_type>& addrs)
+    {
+        std::vector<uint32_t> data;
+        data.reserve(addrs.size());
+        for (const wb_addr_type addr : addrs)
+            data.push_back(this->__peek32(addr));
+        return data;
+    }
+
     boost::mutex reg_access;
 };
 
@@ -169,6 +223,99 @@ protected:
         return uhd::ntohx<uint32_t>(reply.data);
     }
 
+    // The ZPU firmware services one register access per UDP packet, but it
+    // processes packets back-to-back, so we can keep a small window of
+    // requests in flight and collect the acks as they stream back. This
+    // overlaps the network round trips that dominate bulk bring-up
+    // sequences. The window is kept small so we cannot overrun the
+    // firmware's receive queue.
+    static const size_t max_outstanding = 4;
+
+    virtual void __poke32_many(const std::vector<std::pair<wb_addr_type, uint32_t>>& regs)
+    {
+        __flush();
+        std::vector<x300_fw_comms_t> requests(regs.size());
+        size_t num_sent  = 0;
+        size_t num_acked = 0;
+        while (num_acked < regs.size()) {
+            // fill the window
+            while (num_sent < regs.size()
+                   and (num_sent - num_acked) < max_outstanding) {
+                x300_fw_comms_t& request = requests[num_sent];
+                request                  = x300_fw_comms_t();
+                request.flags            = uhd::htonx<uint32_t>(
+                    X300_FW_COMMS_FLAGS_ACK | X300_FW_COMMS_FLAGS_POKE32);
+                request.sequence = uhd::htonx<uint32_t>(seq++);
+                request.addr     = uhd::htonx(regs[num_sent].first);
+                request.data     = uhd::htonx(regs[num_sent].second);
+                udp->send(boost::asio::buffer(&request, sizeof(request)));
+                num_sent++;
+            }
+
+            // collect the next ack (replies arrive in order)
+            x300_fw_comms_t reply = x300_fw_comms_t();
+            const size_t nbytes =
+                udp->recv(boost::asio::buffer(&reply, sizeof(reply)), 1.0);
+            if (nbytes == 0)
+                throw uhd::io_error("x300 fw poke32 - reply timed out");
+
+            // sanity checks
+            const x300_fw_comms_t& request = requests[num_acked];
+            const size_t flags             = uhd::ntohx<uint32_t>(reply.flags);
+            UHD_ASSERT_THROW(nbytes == sizeof(reply));
+            UHD_ASSERT_THROW(not(flags & X300_FW_COMMS_FLAGS_ERROR));
+            UHD_ASSERT_THROW(flags & X300_FW_COMMS_FLAGS_POKE32);
+            UHD_ASSERT_THROW(flags & X300_FW_COMMS_FLAGS_ACK);
+            UHD_ASSERT_THROW(reply.sequence == request.sequence);
+            UHD_ASSERT_THROW(reply.addr == request.addr);
+            UHD_ASSERT_THROW(reply.data == request.data);
+            num_acked++;
+        }
+    }
+
+    virtual std::vector<uint32_t> __peek32_many(const std::vector<wb_addr_type>& addrs)
+    {
+        __flush();
+        std::vector<x300_fw_comms_t> requests(addrs.size());
+        std::vector<uint32_t> data;
+        data.reserve(addrs.size());
+        size_t num_sent = 0;
+        while (data.size() < addrs.size()) {
+            // fill the window
+            while (num_sent < addrs.size()
+                   and (num_sent - data.size()) < max_outstanding) {
+                x300_fw_comms_t& request = requests[num_sent];
+                request                  = x300_fw_comms_t();
+                request.flags            = uhd::htonx<uint32_t>(
+                    X300_FW_COMMS_FLAGS_ACK | X300_FW_COMMS_FLAGS_PEEK32);
+                request.sequence = uhd::htonx<uint32_t>(seq++);
+                request.addr     = uhd::htonx(addrs[num_sent]);
+                request.data     = 0;
+                udp->send(boost::asio::buffer(&request, sizeof(request)));
+                num_sent++;
+            }
+
+            // collect the next reply (replies arrive in order)
+            x300_fw_comms_t reply = x300_fw_comms_t();
+            const size_t nbytes =
+                udp->recv(boost::asio::buffer(&reply, sizeof(reply)), 1.0);
+            if (nbytes == 0)
+                throw uhd::io_error("x300 fw peek32 - reply timed out");
+
+            // sanity checks
+            const x300_fw_comms_t& request = requests[data.size()];
+            const size_t flags             = uhd::ntohx<uint32_t>(reply.flags);
+            UHD_ASSERT_THROW(nbytes == sizeof(reply));
+            UHD_ASSERT_THROW(not(flags & X300_FW_COMMS_FLAGS_ERROR));
+            UHD_ASSERT_THROW(flags & X300_FW_COMMS_FLAGS_PEEK32);
+            UHD_ASSERT_THROW(flags & X300_FW_COMMS_FLAGS_ACK);
+            UHD_ASSERT_THROW(reply.sequence == request.sequence);
+            UHD_ASSERT_THROW(reply.addr == request.addr);
+            data.push_back(uhd::ntohx<uint32_t>(reply.data));
+        }
+        return data;
+    }
+
     virtual void __flush(void)
     {
         char buff[X300_FW_COMMS_MTU] = {};
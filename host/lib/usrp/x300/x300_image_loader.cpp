@@ -44,6 +44,13 @@ using namespace uhd::transport;
 #define UDP_TIMEOUT 3
 #define FPGA_LOAD_TIMEOUT 15
 
+// Default and maximum number of outstanding flash packets while burning
+// over Ethernet. Pipelining hides the round trip per packet; window=1
+// restores the old strict lockstep behavior.
+#define X300_FLASH_DEFAULT_WINDOW 8
+#define X300_FLASH_MAX_WINDOW 32
+#define X300_FLASH_MAX_RETRIES 3
+
 /*
  * Bitstream header pattern
  */
@@ -96,6 +103,7 @@ typedef struct
     std::string filepath;
     std::string outpath;
     std::string rpc_port;
+    size_t window;
     udp_simple::sptr write_xport;
     udp_simple::sptr read_xport;
     size_t size;
@@ -213,6 +221,12 @@ static void x300_setup_session(x300_session_t& session,
             session.ip_addr, BOOST_STRINGIZE(X300_FPGA_READ_UDP_PORT));
         session.verify   = args.has_key("verify");
         session.download = args.has_key("download");
+        session.window   = args.cast<size_t>("window", X300_FLASH_DEFAULT_WINDOW);
+        if (session.window < 1) {
+            session.window = 1;
+        } else if (session.window > X300_FLASH_MAX_WINDOW) {
+            session.window = X300_FLASH_MAX_WINDOW;
+        }
     } else {
         session.resource = session.dev_addr["resource"];
         session.rpc_port = args.get("rpc-port", "5444");
@@ -289,6 +303,36 @@ static UHD_INLINE void x300_bitswap(uint8_t* num)
     *num = ((*num & 0xAA) >> 1) | ((*num & 0x55) << 1);
 }
 
+/*
+ * Read the FPGA image into a buffer padded to a whole number of flash
+ * packets, with the bit- and byteswapping the flash programmer expects
+ * already applied, so any packet can be (re)sent on demand.
+ */
+static std::vector<uint8_t> x300_read_image_data(x300_session_t& session)
+{
+    const size_t num_pkts =
+        (session.size + X300_PACKET_SIZE_BYTES - 1) / X300_PACKET_SIZE_BYTES;
+    std::vector<uint8_t> data(num_pkts * X300_PACKET_SIZE_BYTES, 0);
+    if (session.lvbitx) {
+        memcpy(data.data(), session.bitstream.data(), session.size);
+    } else {
+        std::ifstream image(session.filepath.c_str(), std::ios::binary);
+        image.read((char*)data.data(), session.size);
+        image.close();
+    }
+
+    // Data must be bitswapped and byteswapped
+    for (size_t k = 0; k < data.size(); k++) {
+        x300_bitswap(&data[k]);
+    }
+    uint16_t* data16 = reinterpret_cast<uint16_t*>(data.data());
+    for (size_t k = 0; k < data.size() / 2; k++) {
+        data16[k] = htonx<uint16_t>(data16[k]);
+    }
+
+    return data;
+}
+
 static void x300_ethernet_load(x300_session_t& session)
 {
     // UDP receive buffer
@@ -317,77 +361,76 @@ static void x300_ethernet_load(x300_session_t& session)
                   << std::endl;
     }
 
-    size_t current_pos = 0;
-    size_t sectors     = (session.size / X300_FLASH_SECTOR_SIZE);
-    std::ifstream image(session.filepath.c_str(), std::ios::binary);
+    size_t sectors        = (session.size / X300_FLASH_SECTOR_SIZE);
+    const size_t num_pkts =
+        (session.size + X300_PACKET_SIZE_BYTES - 1) / X300_PACKET_SIZE_BYTES;
+    const std::vector<uint8_t> image_data = x300_read_image_data(session);
 
-    // Each sector
-    for (size_t i = 0; i < session.size; i += X300_FLASH_SECTOR_SIZE) {
-        // Print progress percentage at beginning of each sector
-        std::cout << boost::format("\r-- Loading %s FPGA image: %d%% (%d/%d sectors)")
-                         % session.fpga_type
-                         % (int(double(i) / double(session.size) * 100.0))
-                         % (i / X300_FLASH_SECTOR_SIZE) % sectors
-                  << std::flush;
-
-        // Each packet
-        for (size_t j = i; (j < session.size and j < (i + X300_FLASH_SECTOR_SIZE));
-             j += X300_PACKET_SIZE_BYTES) {
-            flags = X300_FPGA_PROG_FLAGS_ACK;
-            if (j == i)
+    /*
+     * Keep a window of outstanding flash packets on the wire instead of
+     * paying a full round trip per packet. The device services datagrams in
+     * arrival order, so a timeout resends everything not yet acknowledged
+     * (go-back-N). The first packet of each sector carries the erase flag;
+     * retransmission restarts from the oldest unacknowledged packet, so a
+     * resent erase is always followed by resends of every later packet of
+     * that sector and the flash contents stay consistent.
+     */
+    size_t next_to_send = 0;
+    size_t next_to_ack  = 0;
+    size_t num_timeouts = 0;
+    while (next_to_ack < num_pkts) {
+        for (; next_to_send < num_pkts
+               and (next_to_send - next_to_ack) < session.window;
+             next_to_send++) {
+            const size_t j = next_to_send * X300_PACKET_SIZE_BYTES;
+            flags          = X300_FPGA_PROG_FLAGS_ACK;
+            if (j % X300_FLASH_SECTOR_SIZE == 0)
                 flags |= X300_FPGA_PROG_FLAGS_ERASE; // Erase at beginning of sector
             if (session.verify)
                 flags |= X300_FPGA_PROG_FLAGS_VERIFY;
 
             // Set burn location
+            pkt_out.flags  = htonx<uint32_t>(flags);
             pkt_out.sector =
-                htonx<uint32_t>(X300_FPGA_SECTOR_START + (i / X300_FLASH_SECTOR_SIZE));
+                htonx<uint32_t>(X300_FPGA_SECTOR_START + (j / X300_FLASH_SECTOR_SIZE));
             pkt_out.index = htonx<uint32_t>((j % X300_FLASH_SECTOR_SIZE) / 2);
             pkt_out.size  = htonx<uint32_t>(X300_PACKET_SIZE_BYTES / 2);
+            memcpy(pkt_out.data8, &image_data[j], X300_PACKET_SIZE_BYTES);
+            session.write_xport->send(
+                boost::asio::buffer(&pkt_out, sizeof(pkt_out)));
+        }
 
-            // Read next piece of image
-            memset(pkt_out.data8, 0, X300_PACKET_SIZE_BYTES);
-            if (session.lvbitx) {
-                memcpy(pkt_out.data8,
-                    &session.bitstream[current_pos],
-                    X300_PACKET_SIZE_BYTES);
-                current_pos += X300_PACKET_SIZE_BYTES;
-            } else {
-                image.read((char*)pkt_out.data8, X300_PACKET_SIZE_BYTES);
-            }
-
-            // Data must be bitswapped and byteswapped
-            for (size_t k = 0; k < X300_PACKET_SIZE_BYTES; k++) {
-                x300_bitswap(&pkt_out.data8[k]);
-            }
-            for (size_t k = 0; k < (X300_PACKET_SIZE_BYTES / 2); k++) {
-                pkt_out.data16[k] = htonx<uint16_t>(pkt_out.data16[k]);
-            }
-
-            len =
-                x300_send_and_recv(session.write_xport, flags, &pkt_out, session.data_in);
-            if (len == 0) {
-                if (!session.lvbitx)
-                    image.close();
+        len = session.write_xport->recv(
+            boost::asio::buffer(session.data_in, udp_simple::mtu), UDP_TIMEOUT);
+        if (len == 0) {
+            if (++num_timeouts > X300_FLASH_MAX_RETRIES) {
                 throw uhd::runtime_error("Timed out waiting for reply from device.");
-            } else if ((ntohl(pkt_in->flags) & X300_FPGA_PROG_FLAGS_ERROR)) {
-                if (!session.lvbitx)
-                    image.close();
-                throw uhd::runtime_error("Device reported an error.");
+            }
+            // Resend the outstanding window
+            next_to_send = next_to_ack;
+        } else if ((ntohl(pkt_in->flags) & X300_FPGA_PROG_FLAGS_ERROR)) {
+            throw uhd::runtime_error("Device reported an error.");
+        } else {
+            next_to_ack++;
+            num_timeouts = 0;
+            // Print progress percentage at each sector boundary
+            if ((next_to_ack * X300_PACKET_SIZE_BYTES) % X300_FLASH_SECTOR_SIZE == 0) {
+                const size_t bytes_done = next_to_ack * X300_PACKET_SIZE_BYTES;
+                std::cout
+                    << boost::format("\r-- Loading %s FPGA image: %d%% (%d/%d sectors)")
+                           % session.fpga_type
+                           % (int(double(bytes_done) / double(session.size) * 100.0))
+                           % (bytes_done / X300_FLASH_SECTOR_SIZE) % sectors
+                    << std::flush;
             }
         }
     }
-    if (!session.lvbitx) {
-        image.close();
-    }
 
     std::cout << boost::format("\r-- Loading %s FPGA image: 100%% (%d/%d sectors)")
                      % session.fpga_type % sectors % sectors
               << std::endl;
 
     // Cleanup
-    if (!session.lvbitx)
-        image.close();
     flags          = (X300_FPGA_PROG_FLAGS_CLEANUP | X300_FPGA_PROG_FLAGS_ACK);
     pkt_out.sector = pkt_out.index = pkt_out.size = 0;
     memset(pkt_out.data8, 0, X300_PACKET_SIZE_BYTES);
@@ -22,6 +22,7 @@
 #include <uhdlib/rfnoc/device_id.hpp>
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <thread>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk/common.hpp>
@@ -98,8 +99,11 @@ device_addrs_t x300_find(const device_addr_t& hint_)
     }
 
     if (!hint.has_key("resource")) {
-        // otherwise, no address was specified, send a broadcast on each interface
-        for (const transport::if_addrs_t& if_addrs : transport::get_if_addrs()) {
+        // otherwise, no address was specified, send a broadcast on each
+        // interface. The broadcasts run concurrently, so find() waits for one
+        // response timeout instead of one per interface.
+        std::vector<std::future<device_addrs_t>> find_tasks;
+        for (const transport::if_addrs_t& if_addrs : transport::get_if_addrs_cached()) {
             // avoid the loopback device
             if (if_addrs.inet == asio::ip::address_v4::loopback().to_string())
                 continue;
@@ -108,23 +112,26 @@ device_addrs_t x300_find(const device_addr_t& hint_)
             device_addr_t new_hint = hint;
             new_hint["addr"]       = if_addrs.bcast;
 
-            // call discover with the new hint and append results
-            device_addrs_t new_addrs = x300_find(new_hint);
+            // call discover with the new hint
+            find_tasks.emplace_back(std::async(
+                std::launch::async, [new_hint]() { return x300_find(new_hint); }));
+        }
+        for (auto& find_task : find_tasks) {
+            device_addrs_t new_addrs = find_task.get();
             // if we are looking for a serial, only add the one device with a matching
             // serial
             if (hint.has_key("serial")) {
-                bool found_serial = false; // signal to break out of the interface loop
+                if (not addrs.empty()) {
+                    continue; // already resolved on another interface
+                }
                 for (device_addrs_t::iterator new_addr_it = new_addrs.begin();
                      new_addr_it != new_addrs.end();
                      new_addr_it++) {
                     if ((*new_addr_it)["serial"] == hint["serial"]) {
                         addrs.insert(addrs.begin(), *new_addr_it);
-                        found_serial = true;
                         break;
                     }
                 }
-                if (found_serial)
-                    break;
             } else {
                 // Otherwise, add all devices we find
                 addrs.insert(addrs.begin(), new_addrs.begin(), new_addrs.end());
@@ -242,8 +249,10 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
     if (not try_to_claim(mb.zpu_ctrl)) {
         throw uhd::runtime_error("Failed to claim device");
     }
-    mb.claimer_task =
-        uhd::task::make([&mb]() { claimer_loop(mb.zpu_ctrl); }, "x300_claimer");
+    const size_t claim_period_ms = mb.args.get_claim_period_ms();
+    mb.claimer_task              = uhd::task::make(
+        [&mb, claim_period_ms]() { claimer_loop(mb.zpu_ctrl, claim_period_ms); },
+        "x300_claimer");
 
     // extract the FW path for the X300
     // and live load fw over ethernet link
@@ -12,6 +12,8 @@
 #include <uhd/utils/log.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/format.hpp>
+#include <future>
+#include <mutex>
 
 using namespace uhd;
 using namespace uhd::usrp_clock;
@@ -60,9 +62,30 @@ public:
 
     sensor_value_t get_sensor(const std::string& name, size_t board)
     {
-        std::string board_str = str(boost::format("/mboards/%d") % board);
+        std::lock_guard<std::mutex> lock(_sensor_mutex);
+        return _get_sensor(name, board);
+    }
 
-        return _tree->access<sensor_value_t>(board_str / "sensors" / name).get();
+    std::vector<sensor_value_t> get_sensors(
+        const std::vector<std::string>& names, size_t board)
+    {
+        // The driver caches the device state briefly, so reading the fields
+        // back-to-back shares one UDP exchange.
+        std::lock_guard<std::mutex> lock(_sensor_mutex);
+        std::vector<sensor_value_t> values;
+        values.reserve(names.size());
+        for (const std::string& name : names) {
+            values.push_back(_get_sensor(name, board));
+        }
+        return values;
+    }
+
+    std::future<sensor_value_t> get_sensor_async(const std::string& name, size_t board)
+    {
+        return std::async(std::launch::async, [this, name, board]() {
+            std::lock_guard<std::mutex> lock(_sensor_mutex);
+            return _get_sensor(name, board);
+        });
     }
 
     std::vector<std::string> get_sensor_names(size_t board)
@@ -73,8 +96,17 @@ public:
     }
 
 private:
+    sensor_value_t _get_sensor(const std::string& name, size_t board)
+    {
+        std::string board_str = str(boost::format("/mboards/%d") % board);
+
+        return _tree->access<sensor_value_t>(board_str / "sensors" / name).get();
+    }
+
     device::sptr _dev;
     property_tree::sptr _tree;
+    //! Serializes sensor access between callers and async queries
+    std::mutex _sensor_mutex;
 };
 
 multi_usrp_clock::~multi_usrp_clock(void)
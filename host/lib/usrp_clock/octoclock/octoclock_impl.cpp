@@ -25,6 +25,13 @@
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/thread.hpp>
+#include <chrono>
+
+//! How long a retrieved device state serves further sensor reads (ms). The
+// device returns every status field in one datagram, so sensor reads that
+// happen within this window (e.g. one monitoring sweep over several fields)
+// share a single timeout-guarded UDP exchange.
+static constexpr int OCTOCLOCK_STATE_FRESHNESS_MS = 100;
 
 using namespace uhd;
 using namespace uhd::usrp_clock;
@@ -76,7 +83,7 @@ device_addrs_t octoclock_find(const device_addr_t& hint)
 
     // If no address was specified, send a broadcast on each interface
     if (not _hint.has_key("addr")) {
-        for (const if_addrs_t& if_addrs : get_if_addrs()) {
+        for (const if_addrs_t& if_addrs : get_if_addrs_cached()) {
             // avoid the loopback device
             if (if_addrs.inet == asio::ip::address_v4::loopback().to_string())
                 continue;
@@ -122,7 +129,7 @@ device_addrs_t octoclock_find(const device_addr_t& hint)
             new_addr["addr"] = udp_transport->get_recv_addr();
 
             // Attempt direct communication with OctoClock
-            udp_simple::sptr ctrl_xport = udp_simple::make_connected(
+            udp_simple::sptr ctrl_xport = udp_simple::make_connected_pooled(
                 new_addr["addr"], BOOST_STRINGIZE(OCTOCLOCK_UDP_CTRL_PORT));
             UHD_OCTOCLOCK_SEND_AND_RECV(ctrl_xport,
                 OCTOCLOCK_FW_COMPAT_NUM,
@@ -234,8 +241,8 @@ octoclock_impl::octoclock_impl(const device_addr_t& _device_addr)
         ////////////////////////////////////////////////////////////////////
         // Set up UDP transports
         ////////////////////////////////////////////////////////////////////
-        _oc_dict[oc].ctrl_xport =
-            udp_simple::make_connected(addr, BOOST_STRINGIZE(OCTOCLOCK_UDP_CTRL_PORT));
+        _oc_dict[oc].ctrl_xport = udp_simple::make_connected_pooled(
+            addr, BOOST_STRINGIZE(OCTOCLOCK_UDP_CTRL_PORT));
         _oc_dict[oc].gpsdo_xport =
             udp_simple::make_connected(addr, BOOST_STRINGIZE(OCTOCLOCK_UDP_GPSDO_PORT));
 
@@ -392,6 +399,14 @@ uint32_t octoclock_impl::_get_fw_version(const std::string& oc)
 
 void octoclock_impl::_get_state(const std::string& oc)
 {
+    // Serve from the cached state when it is fresh enough; this batches the
+    // round trips of back-to-back sensor reads into one exchange.
+    const auto now = std::chrono::steady_clock::now();
+    if (now - _oc_dict[oc].state_time
+        < std::chrono::milliseconds(OCTOCLOCK_STATE_FRESHNESS_MS)) {
+        return;
+    }
+
     auto pkt_out = make_octoclock_packet(uhd::htonx<uint32_t>(++_sequence));
     size_t len   = 0;
 
@@ -408,7 +423,8 @@ void octoclock_impl::_get_state(const std::string& oc)
     if (UHD_OCTOCLOCK_PACKET_MATCHES(SEND_STATE_ACK, pkt_out, pkt_in, len)) {
         const octoclock_state_t* state =
             reinterpret_cast<const octoclock_state_t*>(pkt_in->data);
-        _oc_dict[oc].state = *state;
+        _oc_dict[oc].state      = *state;
+        _oc_dict[oc].state_time = now;
     } else
         throw uhd::runtime_error("Failed to retrieve state information from OctoClock.");
 }
@@ -18,6 +18,7 @@
 #include <uhd/usrp/mboard_eeprom.hpp>
 #include <uhd/usrp_clock/octoclock_eeprom.hpp>
 #include <boost/thread.hpp>
+#include <chrono>
 #include <memory>
 
 uhd::device_addrs_t octoclock_find(const uhd::device_addr_t& hint);
@@ -47,6 +48,8 @@ private:
     {
         uhd::usrp_clock::octoclock_eeprom_t eeprom;
         octoclock_state_t state;
+        //! When `state` was last retrieved from the device
+        std::chrono::steady_clock::time_point state_time;
         uhd::transport::udp_simple::sptr ctrl_xport;
         uhd::transport::udp_simple::sptr gpsdo_xport;
         uhd::gps_ctrl::sptr gps;
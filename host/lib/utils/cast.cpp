@@ -4,57 +4,135 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
-#include <uhd/utils/cast.hpp>
+#include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/utils/cast.hpp>
 #include <boost/algorithm/string.hpp>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
+#    include <xlocale.h>
+#    define UHD_CAST_HAVE_STRTOD_L
+#elif defined(UHD_PLATFORM_LINUX)
+#    include <locale.h>
+#    define UHD_CAST_HAVE_STRTOD_L
+#elif defined(UHD_PLATFORM_WIN32)
+#    include <locale.h>
+#    define UHD_CAST_HAVE_WIN_STRTOD_L
+#endif
 
 using namespace uhd;
 
-template <>
-bool cast::from_str(const std::string& val)
+namespace {
+
+// These parsers run on device-arg hot paths (dozens of calls per streamer
+// creation), so they avoid the stringstream/stoi machinery: no stream state,
+// no locale lookups, and no exceptions for flow control.
+
+/*! Parse a base-10 integer. Mirrors std::stoi: leading whitespace and a sign
+ * are accepted, parsing stops at the first non-digit, and at least one digit
+ * is required. Returns false when no digit was found or the value does not
+ * fit in an int.
+ */
+bool parse_int(const std::string& val, int& result)
 {
-    try {
-        return (std::stoi(val) != 0);
-    } catch (std::exception& ex) {
-        if (boost::algorithm::to_lower_copy(val) == "true"
-                   || boost::algorithm::to_lower_copy(val) == "yes"
-                   || boost::algorithm::to_lower_copy(val) == "y"
-                   || val == "1") {
-            return true;
-        } else if (boost::algorithm::to_lower_copy(val) == "false"
-                   || boost::algorithm::to_lower_copy(val) == "no"
-                   || boost::algorithm::to_lower_copy(val) == "n"
-                   || val == "0") {
-            return false;
-        } else {
-            throw uhd::runtime_error("Cannot convert `" + val + "' to boolean!");
+    const char* str = val.c_str();
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    bool negative = false;
+    if (*str == '+' or *str == '-') {
+        negative = (*str == '-');
+        str++;
+    }
+    if (not std::isdigit(static_cast<unsigned char>(*str))) {
+        return false;
+    }
+    int64_t accum           = 0;
+    const int64_t magnitude = negative ? -int64_t(INT32_MIN) : int64_t(INT32_MAX);
+    while (std::isdigit(static_cast<unsigned char>(*str))) {
+        accum = accum * 10 + (*str - '0');
+        if (accum > magnitude) {
             return false;
         }
+        str++;
     }
+    result = static_cast<int>(negative ? -accum : accum);
+    return true;
+}
+
+/*! Parse a double with the "C" locale, i.e. with a '.' decimal point no
+ * matter what the application set via setlocale(). Accepts everything
+ * strtod() does (leading whitespace, trailing garbage, inf/nan, hex floats).
+ * Returns false when no conversion was possible or the value overflows.
+ */
+bool parse_double(const std::string& val, double& result)
+{
+    const char* str = val.c_str();
+    char* end       = nullptr;
+    errno           = 0;
+#if defined(UHD_CAST_HAVE_STRTOD_L)
+    static const locale_t c_locale =
+        newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+    result = strtod_l(str, &end, c_locale);
+#elif defined(UHD_CAST_HAVE_WIN_STRTOD_L)
+    static const _locale_t c_locale = _create_locale(LC_ALL, "C");
+    result = _strtod_l(str, &end, c_locale);
+#else
+    // No per-call locale available on this platform; strtod() honors the
+    // application's numeric locale like std::stod() did before.
+    result = std::strtod(str, &end);
+#endif
+    if (end == str) {
+        return false;
+    }
+    if (errno == ERANGE and (result == HUGE_VAL or result == -HUGE_VAL)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+template <>
+bool cast::from_str(const std::string& val)
+{
+    int int_val = 0;
+    if (parse_int(val, int_val)) {
+        return int_val != 0;
+    }
+    const std::string lower = boost::algorithm::to_lower_copy(val);
+    if (lower == "true" or lower == "yes" or lower == "y") {
+        return true;
+    }
+    if (lower == "false" or lower == "no" or lower == "n") {
+        return false;
+    }
+    throw uhd::runtime_error("Cannot convert `" + val + "' to boolean!");
 }
 
 template <>
 double cast::from_str(const std::string& val)
 {
-    try {
-        return std::stod(val);
-    } catch (std::invalid_argument&) {
-        throw uhd::runtime_error(std::string("Cannot convert `") + val + "' to double!");
-    } catch (std::out_of_range&) {
+    double result = 0.0;
+    if (not parse_double(val, result)) {
         throw uhd::runtime_error(std::string("Cannot convert `") + val + "' to double!");
     }
+    return result;
 }
 
 template <>
 int cast::from_str(const std::string& val)
 {
-    try {
-        return std::stoi(val);
-    } catch (std::invalid_argument&) {
-        throw uhd::runtime_error(std::string("Cannot convert `") + val + "' to int!");
-    } catch (std::out_of_range&) {
+    int result = 0;
+    if (not parse_int(val, result)) {
         throw uhd::runtime_error(std::string("Cannot convert `") + val + "' to int!");
     }
+    return result;
 }
 
 template <>
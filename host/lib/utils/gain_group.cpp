@@ -11,13 +11,14 @@
 #include <uhd/utils/gain_group.hpp>
 #include <uhd/utils/log.hpp>
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <vector>
 
 using namespace uhd;
 
 static bool compare_by_step_size(
-    const size_t& rhs, const size_t& lhs, std::vector<gain_fcns_t>& fcns)
+    const size_t& rhs, const size_t& lhs, const std::vector<gain_fcns_t>& fcns)
 {
     return fcns.at(rhs).get_range().step() > fcns.at(lhs).get_range().step();
 }
@@ -100,7 +101,7 @@ public:
         if (not name.empty())
             return _name_to_fcns.get(name).set_value(gain);
 
-        std::vector<gain_fcns_t> all_fcns = get_all_fcns();
+        const std::vector<gain_fcns_t>& all_fcns = get_all_fcns();
         if (all_fcns.size() == 0)
             return; // nothing to set!
 
@@ -133,7 +134,7 @@ public:
             std::bind(&compare_by_step_size,
                 std::placeholders::_1,
                 std::placeholders::_2,
-                all_fcns));
+                std::cref(all_fcns)));
         UHD_ASSERT_THROW(all_fcns.at(indexes_step_size_dec.front()).get_range().step()
                          >= all_fcns.at(indexes_step_size_dec.back()).get_range().step());
 
@@ -151,8 +152,18 @@ public:
             gain_left_to_distribute -= additional_gain;
         }
 
-        // now write the bucket out to the individual gain values
+        // now write the bucket out to the individual gain values. The full
+        // distribution is computed by this point, so elements that already
+        // sit at their target can be skipped: a small logical gain change
+        // typically lands in a single element, and firing the other setters
+        // would only replay identical hardware writes down their property
+        // chains.
         for (size_t i = 0; i < gain_bucket.size(); i++) {
+            const double step      = all_fcns.at(i).get_range().step();
+            const double tolerance = (step == 0.0) ? 0.001 : step / 2;
+            if (std::abs(all_fcns.at(i).get_value() - gain_bucket.at(i)) < tolerance) {
+                continue;
+            }
             all_fcns.at(i).set_value(gain_bucket.at(i));
         }
     }
@@ -171,22 +182,27 @@ public:
         }
         _registry[priority].push_back(gain_fcns);
         _name_to_fcns[name] = gain_fcns;
+        _all_fcns.clear(); // force a rebuild on the next access
     }
 
 private:
     //! get the gain function sets in order (highest priority first)
-    std::vector<gain_fcns_t> get_all_fcns(void)
+    //  The flattened list only changes when a new element is registered,
+    //  so it is cached across the get/set calls
+    const std::vector<gain_fcns_t>& get_all_fcns(void)
     {
-        std::vector<gain_fcns_t> all_fcns;
-        for (size_t key : uhd::sorted(_registry.keys())) {
-            const std::vector<gain_fcns_t>& fcns = _registry[key];
-            all_fcns.insert(all_fcns.begin(), fcns.begin(), fcns.end());
+        if (_all_fcns.empty()) {
+            for (size_t key : uhd::sorted(_registry.keys())) {
+                const std::vector<gain_fcns_t>& fcns = _registry[key];
+                _all_fcns.insert(_all_fcns.begin(), fcns.begin(), fcns.end());
+            }
         }
-        return all_fcns;
+        return _all_fcns;
     }
 
     uhd::dict<size_t, std::vector<gain_fcns_t>> _registry;
     uhd::dict<std::string, gain_fcns_t> _name_to_fcns;
+    std::vector<gain_fcns_t> _all_fcns;
 };
 
 /***********************************************************************
@@ -11,12 +11,37 @@
 #include <uhd/utils/graph_utils.hpp>
 #include <uhd/utils/log.hpp>
 #include <boost/format.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <utility>
 
 
 namespace uhd { namespace rfnoc {
 
+namespace {
+
+/* The static connections that get_block_chain() traverses are fixed by the
+ * FPGA image, so a computed chain stays valid for the lifetime of the graph
+ * object. Applications that reconfigure dynamically call into here once per
+ * hop, so we keep the result of each traversal around, keyed on the graph
+ * instance. The weak_ptr tells us when a graph went away (and guards
+ * against a new graph being allocated at a recycled address). */
+
+using chain_key_t = std::tuple<std::string, size_t, bool>;
+
+struct graph_chain_cache_t
+{
+    std::weak_ptr<rfnoc_graph> owner;
+    std::map<chain_key_t, std::vector<graph_edge_t>> chains;
+};
+
+std::mutex chain_cache_mutex;
+std::map<const rfnoc_graph*, graph_chain_cache_t> chain_caches;
+
+} // namespace
+
 
 //! Returns whether or not a block (and port) is know to to terminate data paths
 bool check_terminator_block(const block_id_t blk_id, const size_t port)
@@ -38,47 +63,74 @@ std::vector<graph_edge_t> get_block_chain(const rfnoc_graph::sptr graph,
     const size_t port,
     const bool source_chain)
 {
+    const chain_key_t key{start_block.to_string(), port, source_chain};
+    std::lock_guard<std::mutex> lock(chain_cache_mutex);
+    auto& cache = chain_caches[graph.get()];
+    if (cache.owner.expired()) {
+        // First use of this graph (or a previous graph at a recycled address)
+        cache.owner = graph;
+        cache.chains.clear();
+        // Drop leftovers from graphs that went away
+        for (auto cache_it = chain_caches.begin(); cache_it != chain_caches.end();) {
+            if (cache_it->second.owner.expired()) {
+                cache_it = chain_caches.erase(cache_it);
+            } else {
+                ++cache_it;
+            }
+        }
+    }
+    auto chain_it = cache.chains.find(key);
+    if (chain_it != cache.chains.end()) {
+        return chain_it->second;
+    }
+
     // Enumerate blocks in the chain
     auto edges = graph->enumerate_static_connections();
 
+    // Index the edges by the (block, port) pair on the side we walk from, so
+    // every hop is a single lookup instead of a scan over all edges
+    std::map<std::pair<std::string, size_t>, const graph_edge_t*> edge_index;
+    for (const auto& edge : edges) {
+        edge_index.emplace(source_chain ? std::make_pair(edge.src_blockid, edge.src_port)
+                                        : std::make_pair(edge.dst_blockid, edge.dst_port),
+            &edge);
+    }
+
     std::vector<graph_edge_t> block_chain;
     std::string current_block = start_block.to_string();
     size_t current_port       = port;
     while (true) {
         UHD_LOG_TRACE("GRAPH_UTILS",
             "Looking for current block " << current_block << ", port " << current_port);
-        bool next_found = false;
-        for (auto& edge : edges) {
-            if ((source_chain)
-                    ? (edge.src_blockid == current_block && edge.src_port == current_port)
-                    : (edge.dst_blockid == current_block
-                          && edge.dst_port == current_port)) {
-                // If the current block is the edge's source, make the edge's
-                // destination the current block
-                next_found = true;
-                UHD_LOG_TRACE("GRAPH_UTILS", "Found next block: " + edge.dst_blockid);
-
-                block_chain.push_back(edge);
-                current_block = (source_chain) ? edge.dst_blockid : edge.src_blockid;
-                current_port  = (source_chain) ? edge.dst_port : edge.src_port;
-                // Compare our current block and port
-                if (check_terminator_block(current_block, current_port)) {
-                    // If we've found a terminating block, stop iterating through the
-                    // edges
-                    break;
-                }
-            }
-        }
-        if (not next_found) {
+        auto edge_it = edge_index.find({current_block, current_port});
+        if (edge_it == edge_index.end()) {
             UHD_LOG_TRACE(
                 "GRAPH_UTILS", "Failed to find current block in static connections");
             break;
         }
+        // If the current block is the edge's source, make the edge's
+        // destination the current block
+        const graph_edge_t& edge = *edge_it->second;
+        UHD_LOG_TRACE("GRAPH_UTILS", "Found next block: " + edge.dst_blockid);
+
+        block_chain.push_back(edge);
+        current_block = (source_chain) ? edge.dst_blockid : edge.src_blockid;
+        current_port  = (source_chain) ? edge.dst_port : edge.src_port;
+        // Compare our current block and port
         if (check_terminator_block(current_block, current_port)) {
             // If we've found a terminating block, stop iterating through the edges
             break;
         }
+        if (block_chain.size() > edges.size()) {
+            // A chain cannot contain more hops than there are edges; we must
+            // be going in circles
+            UHD_LOG_WARNING("GRAPH_UTILS",
+                "Cycle detected in static connections, aborting traversal at "
+                    + current_block);
+            break;
+        }
     }
+    cache.chains.emplace(key, block_chain);
     return block_chain;
 }
 
@@ -93,27 +145,26 @@ void connect_through_blocks(rfnoc_graph::sptr graph,
     auto block_chain = get_block_chain(graph, src_blk, src_port, true);
     UHD_LOG_TRACE("GRAPH_UTILS", "Found source chain for " + src_blk.to_string());
     // See if dst_blk is in our block_chain already
-    const bool dst_found = std::accumulate(block_chain.begin(),
+    const std::string dst_blk_id = dst_blk.to_string();
+    const bool dst_found         = std::accumulate(block_chain.begin(),
         block_chain.end(),
         false,
-        [dst_blk, dst_port](bool dst_found, const graph_edge_t edge) {
+        [&dst_blk_id, dst_port](bool dst_found, const graph_edge_t& edge) {
             // This is our "accumulator" function that checks if the current_blk's ID and
             // input port match what we're looking for
             return dst_found
-                   || (dst_blk.to_string() == edge.dst_blockid
-                          && dst_port == edge.dst_port);
+                   || (dst_blk_id == edge.dst_blockid && dst_port == edge.dst_port);
         });
     // If our dst_blk is in the chain already, make sure its the last element and continue
     if (dst_found) {
-        UHD_LOG_TRACE(
-            "GRAPH_UTILS", "Found dst_blk (" + dst_blk.to_string() + ") in source chain");
-        while (dst_blk.to_string() == block_chain.back().dst_blockid
+        UHD_LOG_TRACE("GRAPH_UTILS", "Found dst_blk (" + dst_blk_id + ") in source chain");
+        while (dst_blk_id == block_chain.back().dst_blockid
                && dst_port == block_chain.back().dst_port) {
             UHD_LOG_TRACE("GRAPH_UTILS",
                 boost::format(
                     "Last block (%s:%d) doesn't match dst_blk (%s:%d); removing.")
                     % block_chain.back().dst_blockid % block_chain.back().dst_port
-                    % dst_blk.to_string() % dst_port);
+                    % dst_blk_id % dst_port);
             block_chain.pop_back();
         }
     } else {
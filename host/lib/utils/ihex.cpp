@@ -183,6 +183,73 @@ void ihex_reader::read(ihex_reader::record_handle_type record_handler)
     throw uhd::io_error("ihex_reader::read(): No EOF record found.");
 }
 
+
+void ihex_reader::read_coalesced(
+    ihex_reader::record_handle_type record_handler, const size_t max_block_size)
+{
+    std::vector<unsigned char> block;
+    block.reserve(max_block_size);
+    uint16_t block_lower = 0x0000;
+    uint16_t block_upper = 0x0000;
+
+    auto flush = [&block, &block_lower, &block_upper, &record_handler]() -> int {
+        if (block.empty()) {
+            return 0;
+        }
+        const int ret = record_handler(
+            block_lower, block_upper, block.data(), (uint16_t)block.size());
+        block.clear();
+        return ret;
+    };
+
+    this->read([&](uint16_t lower_address_bits,
+                   uint16_t upper_address_bits,
+                   unsigned char* data,
+                   uint16_t len) -> int {
+        /* A zero-length record is the jump instruction from an SLA record:
+         * all data must be on the device before it is handed through. */
+        if (len == 0 and data == NULL) {
+            const int ret = flush();
+            if (ret < 0) {
+                return ret;
+            }
+            return record_handler(lower_address_bits, upper_address_bits, data, len);
+        }
+
+        /* Flush the pending block if this record doesn't extend it. The
+         * address sum is computed in 32 bits so a wrap past 0xFFFF counts
+         * as a discontinuity. */
+        if (not block.empty()) {
+            const bool contiguous =
+                upper_address_bits == block_upper
+                and (uint32_t)block_lower + block.size() == (uint32_t)lower_address_bits
+                and block.size() + len <= max_block_size;
+            if (not contiguous) {
+                const int ret = flush();
+                if (ret < 0) {
+                    return ret;
+                }
+            }
+        }
+
+        if (block.empty()) {
+            block_lower = lower_address_bits;
+            block_upper = upper_address_bits;
+        }
+        block.insert(block.end(), data, data + len);
+        if (block.size() >= max_block_size) {
+            return flush();
+        }
+        return 0;
+    });
+
+    /* read() returned on the EOF record; push out what's left. */
+    if (flush() < 0) {
+        throw uhd::io_error(
+            "ihex_reader::read_coalesced(): record hander returned failure code");
+    }
+}
+
 // We need a functor for the cast, a lambda would be perfect...
 int _file_writer_callback(
     std::shared_ptr<std::ofstream> output_file, unsigned char* buff, uint16_t len)
@@ -0,0 +1,134 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/utils/init_profile.hpp>
+#include <boost/format.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace uhd::utils;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+//! Process-wide phase storage. Start/end times are kept as clock time
+// points and only converted to relative seconds when queried.
+struct profile_storage_t
+{
+    struct entry_t
+    {
+        std::string name;
+        size_t depth;
+        clock_type::time_point start;
+        clock_type::duration duration{0};
+        bool done = false;
+    };
+
+    std::mutex mutex;
+    std::vector<entry_t> entries;
+};
+
+profile_storage_t& storage()
+{
+    static profile_storage_t s;
+    return s;
+}
+
+//! Per-thread nesting depth of active phases
+thread_local size_t thread_phase_depth = 0;
+
+double to_seconds(const clock_type::duration dur)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>(dur).count();
+}
+
+} // namespace
+
+namespace uhd { namespace utils {
+
+scoped_init_phase::scoped_init_phase(std::string name)
+    : _index([&name]() {
+        auto& s = storage();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.entries.push_back(
+            {std::move(name), thread_phase_depth, clock_type::now(), {}, false});
+        return s.entries.size() - 1;
+    }())
+{
+    thread_phase_depth++;
+}
+
+scoped_init_phase::~scoped_init_phase()
+{
+    thread_phase_depth--;
+    bool top_level_done = false;
+    {
+        auto& s = storage();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto& entry    = s.entries[_index];
+        entry.duration = clock_type::now() - entry.start;
+        entry.done     = true;
+        top_level_done = (entry.depth == 0);
+    }
+    if (top_level_done) {
+        const char* dump_env = std::getenv("UHD_INIT_PROFILE");
+        if (dump_env and dump_env[0] != '\0') {
+            UHD_LOG_INFO("PROFILE", "Init phase timing:\n" << format_init_profile());
+        }
+    }
+}
+
+std::vector<init_phase_record_t> get_init_profile()
+{
+    auto& s = storage();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    std::vector<init_phase_record_t> result;
+    result.reserve(s.entries.size());
+    if (s.entries.empty()) {
+        return result;
+    }
+    const auto epoch = s.entries.front().start;
+    for (const auto& entry : s.entries) {
+        init_phase_record_t record;
+        record.name     = entry.name;
+        record.depth    = entry.depth;
+        record.start    = to_seconds(entry.start - epoch);
+        record.duration = entry.done ? to_seconds(entry.duration)
+                                     : to_seconds(clock_type::now() - entry.start);
+        result.push_back(std::move(record));
+    }
+    return result;
+}
+
+std::string format_init_profile()
+{
+    constexpr size_t name_column_width = 32;
+    std::ostringstream report;
+    for (const auto& record : get_init_profile()) {
+        std::string name = std::string(2 * record.depth, ' ') + record.name;
+        if (name.size() < name_column_width) {
+            name.append(name_column_width - name.size(), ' ');
+        }
+        report << boost::format("%s @ %9.1f ms, took %9.1f ms\n") % name
+                      % (record.start * 1e3) % (record.duration * 1e3);
+    }
+    return report.str();
+}
+
+void clear_init_profile()
+{
+    auto& s = storage();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.entries.clear();
+}
+
+}} // namespace uhd::utils
@@ -7,10 +7,11 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/utils/paths.hpp>
-#include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -85,12 +86,16 @@ static void load_module_path(const fs::path& path)
     }
 }
 
-/*!
- * Load all the modules given in the module paths.
- */
-UHD_STATIC_BLOCK(load_modules)
+void uhd::load_modules(void)
 {
-    for (const fs::path& path : uhd::get_module_paths()) {
-        load_module_path(path);
-    }
+    /* This used to run from a static block, i.e. before main(), which made
+     * every UHD-linked process pay for the module path walk even if it never
+     * touched a registry. Callers that consult a registry (device discovery,
+     * image loading) call in here first instead. */
+    static std::once_flag modules_loaded;
+    std::call_once(modules_loaded, []() {
+        for (const fs::path& path : uhd::get_module_paths()) {
+            load_module_path(path);
+        }
+    });
 }
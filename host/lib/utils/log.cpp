@@ -17,6 +17,8 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <atomic>
 #include <cctype>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <mutex>
@@ -98,6 +100,86 @@ inline std::string path_to_filename(std::string path)
     return path.substr(path.find_last_of("/\\") + 1);
 }
 
+#ifndef UHD_LOG_FASTPATH_DISABLE
+/*! A bounded lock-free MPSC ring for fastpath messages
+ *
+ * Fastpath messages are pushed from streaming threads (the "UOSDL" markers in
+ * the packet handlers), so the producer side must never take a lock or block:
+ * producers claim a slot with a single CAS, copy the (tiny) message into it,
+ * and drop the message if the ring is full. The single consumer is the
+ * fastpath logging thread, which polls the ring. This is the classic bounded
+ * queue scheme with per-slot sequence numbers.
+ */
+class fastpath_queue_t
+{
+public:
+    fastpath_queue_t()
+    {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            _slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //! Push from any thread. Returns false (and drops the message) when full.
+    bool push(const std::string& msg)
+    {
+        size_t pos = _write_pos.load(std::memory_order_relaxed);
+        slot_t* slot;
+        while (true) {
+            slot               = &_slots[pos & (CAPACITY - 1)];
+            const size_t seq   = slot->seq.load(std::memory_order_acquire);
+            const intptr_t dif = intptr_t(seq) - intptr_t(pos);
+            if (dif == 0) {
+                if (_write_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                // The consumer has fallen a full lap behind: don't wait, the
+                // message is just lost. Too bad.
+                return false;
+            } else {
+                pos = _write_pos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->len = std::min(msg.size(), MSG_CAPACITY);
+        std::memcpy(slot->msg, msg.data(), slot->len);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Pop from the single consumer thread. Returns false when empty.
+    bool pop(std::string& msg)
+    {
+        slot_t* slot     = &_slots[_read_pos & (CAPACITY - 1)];
+        const size_t seq = slot->seq.load(std::memory_order_acquire);
+        if (seq != _read_pos + 1) {
+            return false;
+        }
+        msg.assign(slot->msg, slot->len);
+        slot->seq.store(_read_pos + CAPACITY, std::memory_order_release);
+        _read_pos++;
+        return true;
+    }
+
+private:
+    static constexpr size_t CAPACITY = 1024; // Must be a power of two
+    // Fastpath messages are single characters; longer ones get truncated
+    static constexpr size_t MSG_CAPACITY = 15;
+
+    struct slot_t
+    {
+        std::atomic<size_t> seq;
+        size_t len;
+        char msg[MSG_CAPACITY];
+    };
+
+    std::atomic<size_t> _write_pos{0};
+    size_t _read_pos = 0; // Only touched by the consumer thread
+    slot_t _slots[CAPACITY];
+};
+#endif // UHD_LOG_FASTPATH_DISABLE
+
 } // namespace
 
 /***********************************************************************
@@ -183,17 +265,12 @@ private:
 class log_resource
 {
 public:
-    uhd::log::severity_level global_level;
+    //! The global log level. Atomic so the hot-path level check in the log
+    // macros is a single relaxed-ish load, with no locking against
+    // set_log_level().
+    std::atomic<uhd::log::severity_level> global_level;
 
-    log_resource(void)
-        : global_level(uhd::log::off)
-        , _exit(false)
-        ,
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        _fastpath_queue(10)
-        ,
-#endif
-        _log_queue(10)
+    log_resource(void) : global_level(uhd::log::off), _exit(false), _log_queue(10)
     {
         // allow override from macro definition
 #ifdef UHD_LOG_MIN_LEVEL
@@ -269,9 +346,6 @@ public:
             boost::this_thread::get_id());
         final_message.message = "";
         push(final_message);
-#    ifndef UHD_LOG_FASTPATH_DISABLE
-        push_fastpath("");
-#    endif
 #endif // BOOST_MSVC
 
         _pop_task->join();
@@ -295,9 +369,9 @@ public:
 #ifndef UHD_LOG_FASTPATH_DISABLE
     void push_fastpath(const std::string& message)
     {
-        // Never wait. If the buffer is full, we just don't see the message.
-        // Too bad.
-        _fastpath_queue.push_with_haste(message);
+        // Lock-free, and never waits. If the ring is full, we just don't see
+        // the message. Too bad.
+        _fastpath_queue.push(message);
     }
 #endif
 
@@ -348,20 +422,18 @@ public:
 #ifndef UHD_LOG_FASTPATH_DISABLE
         std::string msg;
         while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            if (_fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT)) {
+            // The lock-free ring has no blocking pop; poll it and nap while
+            // it is empty. This also means we never hang on join, so the
+            // MSVC timed-wait workaround is not needed here.
+            if (_fastpath_queue.pop(msg)) {
                 std::cerr << msg << std::flush;
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
             }
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-            std::cerr << msg << std::flush;
-#    endif // BOOST_MSVC
         }
 
         // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg)) {
+        while (_fastpath_queue.pop(msg)) {
             std::cerr << msg << std::flush;
         }
 #endif
@@ -372,17 +444,14 @@ public:
 #ifndef UHD_LOG_FASTPATH_DISABLE
         std::string msg;
         while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            _fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT);
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-#    endif // BOOST_MSVC
+            // Drain and discard so producers don't always see a full ring
+            if (!_fastpath_queue.pop(msg)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
         }
 
         // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg))
+        while (_fastpath_queue.pop(msg))
             ;
 #endif
     }
@@ -492,7 +561,7 @@ private:
     using level_logfn_pair = std::pair<uhd::log::severity_level, uhd::log::log_fn_t>;
     std::map<std::string, level_logfn_pair> _loggers;
 #ifndef UHD_LOG_FASTPATH_DISABLE
-    uhd::transport::bounded_buffer<std::string> _fastpath_queue;
+    fastpath_queue_t _fastpath_queue;
 #endif
     uhd::transport::bounded_buffer<uhd::log::logging_info> _log_queue;
 };
@@ -555,6 +624,11 @@ void uhd::log::set_log_level(uhd::log::severity_level level)
     log_rs().global_level = level;
 }
 
+uhd::log::severity_level uhd::log::get_log_level(void)
+{
+    return log_rs().global_level;
+}
+
 void uhd::log::set_logger_level(const std::string& key, uhd::log::severity_level level)
 {
     log_rs().set_log_level(key, level);
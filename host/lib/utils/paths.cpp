@@ -23,6 +23,8 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <regex>
 #include <streambuf>
 #include <string>
@@ -416,7 +418,13 @@ std::string _get_images_path_from_registry(const std::string& registry_key_path)
 }
 #endif /*UHD_PLATFORM_WIN32*/
 
-std::string uhd::get_images_dir(const std::string& search_paths)
+/*! Resolve the images directory by walking the candidate locations.
+ *
+ * This is the uncached workhorse behind uhd::get_images_dir(). It hits the
+ * filesystem once per candidate directory, which is cheap locally but adds
+ * up on network-mounted image stores.
+ */
+static std::string images_dir_lookup(const std::string& search_paths)
 {
     /*   This function will check for the existence of directories in this
      *   order:
@@ -487,9 +495,50 @@ std::string uhd::get_images_dir(const std::string& search_paths)
     }
 }
 
+std::string uhd::get_images_dir(const std::string& search_paths)
+{
+    /* Directory resolution walks every candidate location, which can mean
+     * several stat() calls against a network mount. The result only changes
+     * if the environment variable or the search paths change, so memoize it
+     * for the lifetime of the process, keyed on both. */
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::string> cache;
+
+    const std::string cache_key =
+        get_env_var("UHD_IMAGES_DIR") + "\n" + search_paths;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto cache_it = cache.find(cache_key);
+    if (cache_it != cache.end()) {
+        return cache_it->second;
+    }
+
+    const std::string images_dir = images_dir_lookup(search_paths);
+    if (!images_dir.empty()) {
+        cache[cache_key] = images_dir;
+    }
+    return images_dir;
+}
+
 std::string uhd::find_image_path(
     const std::string& image_name, const std::string& search_paths)
 {
+    /* Cache fully resolved image paths so repeated lookups (e.g. multiple
+     * sessions to the same device type) cost a single stat() instead of a
+     * directory resolution. Hits are re-validated against the filesystem so
+     * a removed or re-installed image never returns a stale path. */
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::string> cache;
+
+    const std::string cache_key = image_name + "\n" + search_paths;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto cache_it = cache.find(cache_key);
+        if (cache_it != cache.end() and fs::exists(cache_it->second)) {
+            return cache_it->second;
+        }
+    }
+
     /* If a path was provided on the command-line or as a hint from the caller,
      * we default to that. */
     if (fs::exists(image_name)) {
@@ -501,6 +550,8 @@ std::string uhd::find_image_path(
     if (!images_dir.empty()) {
         fs::path image_path = fs::path(images_dir) / image_name;
         if (fs::exists(image_path)) {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            cache[cache_key] = image_path.string();
             return image_path.string();
         } else {
             throw uhd::io_error("Could not find the image '" + image_name
@@ -10,13 +10,40 @@
 #include <uhdlib/utils/prefs.hpp>
 #include <config.h>
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <vector>
 
 using namespace uhd;
 
 namespace {
 constexpr char UHD_CONF_FILE_VAR[] = "UHD_CONFIG_FILE";
 
+//! Guards the config file object and its bookkeeping below
+std::mutex conf_mutex;
+//! mtimes of all config file candidates as of the last (re)load. Files that
+//  do not exist are recorded with an mtime of 0 so that a config file
+//  appearing after the first load also triggers a reload.
+std::map<std::string, std::time_t> conf_file_mtimes;
+//! Bumped on every (re)load so cached merged arg maps can invalidate
+std::atomic<size_t> conf_generation{0};
+
+std::time_t _get_conf_mtime(const std::string& path)
+{
+    try {
+        if (not path.empty() and boost::filesystem::exists(path)) {
+            return boost::filesystem::last_write_time(path);
+        }
+    } catch (...) {
+        // fall through
+    }
+    return 0;
+}
+
 inline bool _update_conf_file(
     const std::string& path, const std::string& config_type, config_parser& conf_file)
 {
@@ -58,11 +85,40 @@ void update_from_key(
 device_addr_t get_args(const uhd::device_addr_t& user_args,
     const std::vector<std::string>& keys_to_update_from)
 {
-    device_addr_t args;
+    // The config-derived portion of the merged args only depends on the
+    // relevant key/value pairs, so cache it keyed on those. This keeps
+    // repeated lookups (e.g. many channels initializing at once) from
+    // re-walking the parsed config per call. The cache is flushed whenever
+    // the config files get reloaded.
+    static std::mutex args_cache_mutex;
+    static std::map<std::string, device_addr_t> args_cache;
+    static size_t args_cache_generation = 0;
+
+    std::string cache_key;
     for (const auto& key : keys_to_update_from) {
-        update_from_key(key, user_args.get(key, ""), args);
+        cache_key += key + "=" + user_args.get(key, "") + ";";
     }
 
+    // Trigger a config reload check before consulting the cache
+    uhd::prefs::get_uhd_config();
+    const size_t current_generation = conf_generation;
+
+    std::lock_guard<std::mutex> lock(args_cache_mutex);
+    if (args_cache_generation != current_generation) {
+        args_cache.clear();
+        args_cache_generation = current_generation;
+    }
+
+    auto cache_it = args_cache.find(cache_key);
+    if (cache_it == args_cache.end()) {
+        device_addr_t conf_args;
+        for (const auto& key : keys_to_update_from) {
+            update_from_key(key, user_args.get(key, ""), conf_args);
+        }
+        cache_it = args_cache.emplace(cache_key, conf_args).first;
+    }
+
+    device_addr_t args = cache_it->second;
     // Finally, copy over the original user args:
     for (const auto& user_key : user_args.keys()) {
         args[user_key] = user_args[user_key];
@@ -76,42 +132,66 @@ config_parser& uhd::prefs::get_uhd_config()
 {
     static config_parser _conf_files{};
     static bool init_done = false;
-    if (not init_done) {
-        UHD_LOG_TRACE("CONF", "Initializing config file object...");
-        const std::string sys_conf_file = path_expandvars(UHD_SYS_CONF_FILE);
-        _update_conf_file(sys_conf_file, "system", _conf_files);
-        // prefer .config/uhd.conf
-        // otherwise ~/.uhd/uhd.conf
-        const std::string user_conf_file =
-            (get_xdg_config_home() / std::string(UHD_USER_CONF_FILE)).string();
-        const bool user_conf_loaded =
-            _update_conf_file(user_conf_file, "user", _conf_files);
-        // Config files can be in ~/.config/ or in ~/.uhd. The latter is
-        // considered deprecated. We load from there (if we have not already
-        // loaded from ~/.config), but we show a warning.
-        if (!user_conf_loaded
-            && _update_conf_file(
-                   (get_legacy_config_home() / std::string(UHD_USER_CONF_FILE)).string(),
-                   "user",
-                   _conf_files)) {
-            UHD_LOG_WARNING("PREFS",
-                "Loaded config from " << get_legacy_config_home().string()
-                                      << ". This location is considered deprecated, "
-                                         "consider moving your config file to "
-                                      << get_xdg_config_home().string() << " instead.");
+
+    std::lock_guard<std::mutex> lock(conf_mutex);
+
+    // The parsed config is kept for the lifetime of the process; we only
+    // reparse when one of the config file candidates changed on disk (or
+    // appeared/disappeared).
+    bool needs_reload = not init_done;
+    for (const auto& path_mtime : conf_file_mtimes) {
+        if (_get_conf_mtime(path_mtime.first) != path_mtime.second) {
+            UHD_LOG_DEBUG(
+                "PREFS", "Config file " << path_mtime.first << " changed, reloading...");
+            needs_reload = true;
+            break;
         }
-        std::string env_conf_file;
-        try { // getenv into std::string can fail
-            if (std::getenv(UHD_CONF_FILE_VAR) != NULL) {
-                env_conf_file = std::string(std::getenv(UHD_CONF_FILE_VAR));
-            }
-            _update_conf_file(env_conf_file, "ENV", _conf_files);
-        } catch (const std::exception&) {
-            // nop
+    }
+    if (not needs_reload) {
+        return _conf_files;
+    }
+
+    UHD_LOG_TRACE("CONF", "Initializing config file object...");
+    _conf_files = config_parser{};
+    conf_file_mtimes.clear();
+    const std::string sys_conf_file = path_expandvars(UHD_SYS_CONF_FILE);
+    conf_file_mtimes[sys_conf_file] = _get_conf_mtime(sys_conf_file);
+    _update_conf_file(sys_conf_file, "system", _conf_files);
+    // prefer .config/uhd.conf
+    // otherwise ~/.uhd/uhd.conf
+    const std::string user_conf_file =
+        (get_xdg_config_home() / std::string(UHD_USER_CONF_FILE)).string();
+    conf_file_mtimes[user_conf_file] = _get_conf_mtime(user_conf_file);
+    const bool user_conf_loaded = _update_conf_file(user_conf_file, "user", _conf_files);
+    // Config files can be in ~/.config/ or in ~/.uhd. The latter is
+    // considered deprecated. We load from there (if we have not already
+    // loaded from ~/.config), but we show a warning.
+    const std::string legacy_conf_file =
+        (get_legacy_config_home() / std::string(UHD_USER_CONF_FILE)).string();
+    conf_file_mtimes[legacy_conf_file] = _get_conf_mtime(legacy_conf_file);
+    if (!user_conf_loaded
+        && _update_conf_file(legacy_conf_file, "user", _conf_files)) {
+        UHD_LOG_WARNING("PREFS",
+            "Loaded config from " << get_legacy_config_home().string()
+                                  << ". This location is considered deprecated, "
+                                     "consider moving your config file to "
+                                  << get_xdg_config_home().string() << " instead.");
+    }
+    std::string env_conf_file;
+    try { // getenv into std::string can fail
+        if (std::getenv(UHD_CONF_FILE_VAR) != NULL) {
+            env_conf_file = std::string(std::getenv(UHD_CONF_FILE_VAR));
+        }
+        if (not env_conf_file.empty()) {
+            conf_file_mtimes[env_conf_file] = _get_conf_mtime(env_conf_file);
         }
-        init_done = true;
-        UHD_LOG_TRACE("PREFS", "Done initializing.");
+        _update_conf_file(env_conf_file, "ENV", _conf_files);
+    } catch (const std::exception&) {
+        // nop
     }
+    init_done = true;
+    conf_generation++;
+    UHD_LOG_TRACE("PREFS", "Done initializing.");
 
     return _conf_files;
 }
@@ -134,3 +214,61 @@ device_addr_t uhd::prefs::get_dpdk_nic_args(const uhd::device_addr_t& user_args)
     const std::vector<std::string> keys_to_update_from = {"dpdk_mac"};
     return get_args(user_args, keys_to_update_from);
 }
+
+/******************************************************************************
+ * MTU cache
+ *****************************************************************************/
+namespace {
+
+//! Guards the MTU cache file against concurrent access from this process
+std::mutex mtu_cache_mutex;
+
+std::string _get_mtu_cache_path()
+{
+    return (get_xdg_data_home() / "uhd" / "mtu_cache.ini").string();
+}
+
+//! ptree interprets '.' as a path separator, so mangle it out of keys
+std::string _sanitize_cache_key(const std::string& key)
+{
+    std::string result(key);
+    std::replace(result.begin(), result.end(), '.', '_');
+    return result;
+}
+
+} // namespace
+
+size_t uhd::prefs::get_cached_mtu(const std::string& device, const std::string& iface)
+{
+    std::lock_guard<std::mutex> lock(mtu_cache_mutex);
+    const std::string path = _get_mtu_cache_path();
+    try {
+        if (not boost::filesystem::exists(path)) {
+            return 0;
+        }
+        config_parser cache(path);
+        return cache.get<size_t>(
+            _sanitize_cache_key(device), _sanitize_cache_key(iface), 0);
+    } catch (const std::exception& ex) {
+        UHD_LOG_DEBUG("PREFS", "Could not read MTU cache: " << ex.what());
+        return 0;
+    }
+}
+
+void uhd::prefs::update_cached_mtu(
+    const std::string& device, const std::string& iface, const size_t mtu)
+{
+    std::lock_guard<std::mutex> lock(mtu_cache_mutex);
+    const std::string path = _get_mtu_cache_path();
+    try {
+        config_parser cache(
+            boost::filesystem::exists(path) ? path : std::string(""));
+        cache.set(_sanitize_cache_key(device), _sanitize_cache_key(iface), mtu);
+        boost::filesystem::create_directories(
+            boost::filesystem::path(path).parent_path());
+        cache.save(path);
+    } catch (const std::exception& ex) {
+        // The cache is only an optimization, so failure to write is not fatal
+        UHD_LOG_DEBUG("PREFS", "Could not update MTU cache: " << ex.what());
+    }
+}
@@ -0,0 +1,56 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/serial_task_executor.hpp>
+
+using namespace uhd;
+
+serial_task_executor::serial_task_executor(const std::string& name)
+{
+    _worker = std::thread([this]() { _worker_loop(); });
+    set_thread_name(&_worker, name);
+}
+
+serial_task_executor::~serial_task_executor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _exit = true;
+    }
+    _cond.notify_one();
+    _worker.join();
+}
+
+std::future<void> serial_task_executor::post(task_t task)
+{
+    std::packaged_task<void()> ptask(std::move(task));
+    std::future<void> result = ptask.get_future();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(std::move(ptask));
+    }
+    _cond.notify_one();
+    return result;
+}
+
+void serial_task_executor::_worker_loop()
+{
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait(lock, [this]() { return _exit or not _queue.empty(); });
+            if (_queue.empty()) {
+                // _exit is set and all queued tasks have run
+                return;
+            }
+            task = std::move(_queue.front());
+            _queue.pop_front();
+        }
+        task();
+    }
+}
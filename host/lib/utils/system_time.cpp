@@ -6,12 +6,126 @@
 
 #include <uhdlib/utils/system_time.hpp>
 #include <chrono>
+#include <cstdint>
+#if defined(__linux__)
+#    include <time.h>
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#    include <cpuid.h>
+#    include <x86intrin.h>
+#    define UHD_SYSTEM_TIME_USE_TSC
+#endif
+
+namespace {
+
+inline int64_t steady_clock_ns(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+#ifdef UHD_SYSTEM_TIME_USE_TSC
+
+//! Only use the TSC if the CPU advertises it as invariant, i.e., running at
+//  a constant rate regardless of frequency scaling and synchronized across
+//  cores. Anything else cannot be used as a time base.
+bool have_invariant_tsc(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (edx & (1 << 8)) != 0;
+}
+
+//! Calibrate the TSC frequency over no less than this interval. A 10 ms
+//  window puts the frequency estimate error in the 1e-5 range.
+constexpr int64_t CALIB_INTERVAL_NS = 10 * 1000 * 1000;
+//! Re-anchor against the system clock about once a second so extrapolation
+//  drift stays bounded (~10 us/s at 1e-5 frequency error).
+constexpr int64_t RECAL_INTERVAL_NS = 1000 * 1000 * 1000;
+
+//! TSC calibration state. This is kept per-thread so the fast path needs no
+//  synchronization at all; the TSC itself is synchronized across cores on
+//  invariant-TSC parts, so per-thread anchors agree with each other.
+struct tsc_calibration_t
+{
+    uint64_t base_tsc   = 0;
+    int64_t base_ns     = 0;
+    double ns_per_tick  = 0.0;
+    uint64_t recal_tick = 0;
+    int64_t last_ns     = 0;
+};
+
+int64_t tsc_time_ns(void)
+{
+    thread_local tsc_calibration_t cal;
+    const uint64_t tsc = __rdtsc();
+
+    // Fast path: extrapolate from the last anchor without any syscall
+    if (cal.ns_per_tick != 0.0 && (tsc - cal.base_tsc) < cal.recal_tick) {
+        const int64_t ret =
+            cal.base_ns + int64_t(double(tsc - cal.base_tsc) * cal.ns_per_tick);
+        // Clamp so re-anchoring can never make time step backwards
+        if (ret < cal.last_ns) {
+            return cal.last_ns;
+        }
+        cal.last_ns = ret;
+        return ret;
+    }
+
+    // Slow path: read the system clock, and (re)calibrate the TSC frequency
+    // once enough time has passed since the last anchor
+    const int64_t now_ns = steady_clock_ns();
+    if (cal.base_tsc == 0) {
+        cal.base_tsc = tsc;
+        cal.base_ns  = now_ns;
+    } else {
+        const int64_t dt_ns = now_ns - cal.base_ns;
+        if (dt_ns >= CALIB_INTERVAL_NS && tsc > cal.base_tsc) {
+            cal.ns_per_tick = double(dt_ns) / double(tsc - cal.base_tsc);
+            cal.recal_tick  = uint64_t(RECAL_INTERVAL_NS / cal.ns_per_tick);
+            cal.base_tsc    = tsc;
+            cal.base_ns     = now_ns;
+        }
+    }
+    if (now_ns < cal.last_ns) {
+        return cal.last_ns;
+    }
+    cal.last_ns = now_ns;
+    return now_ns;
+}
+
+#endif // UHD_SYSTEM_TIME_USE_TSC
+
+inline int64_t system_time_ns(void)
+{
+#ifdef UHD_SYSTEM_TIME_USE_TSC
+    static const bool use_tsc = have_invariant_tsc();
+    if (use_tsc) {
+        return tsc_time_ns();
+    }
+#endif
+    return steady_clock_ns();
+}
+
+} // namespace
 
 uhd::time_spec_t uhd::get_system_time(void)
 {
-    const auto now     = std::chrono::steady_clock::now().time_since_epoch();
-    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
-    const auto nanoseconds =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds);
-    return uhd::time_spec_t(seconds.count(), nanoseconds.count(), 1e9);
+    const int64_t ns = system_time_ns();
+    return uhd::time_spec_t(ns / 1000000000, long(ns % 1000000000), 1e9);
+}
+
+uhd::time_spec_t uhd::get_system_time_coarse(void)
+{
+#if defined(__linux__)
+    timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0) {
+        return uhd::time_spec_t(ts.tv_sec, long(ts.tv_nsec), 1e9);
+    }
+#endif
+    return uhd::get_system_time();
 }
@@ -10,6 +10,7 @@
 #include <uhd/utils/msg_task.hpp>
 #include <uhd/utils/tasks.hpp>
 #include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/thread_roles.hpp>
 #include <boost/thread/barrier.hpp>
 #include <boost/thread/thread.hpp>
 #include <atomic>
@@ -26,7 +27,12 @@ class task_impl : public task
 public:
     task_impl(const task_fcn_type& task_fcn, const std::string& name) : _exit(false)
     {
-        _task = std::thread([this, task_fcn]() { this->task_loop(task_fcn); });
+        _task = std::thread([this, task_fcn, name]() {
+            // Apply configured placement (thread_<name>_cpu/_priority device
+            // args) before entering the loop
+            utils::apply_thread_role(name);
+            this->task_loop(task_fcn);
+        });
         if (not name.empty()) {
             set_thread_name(&_task, name);
         }
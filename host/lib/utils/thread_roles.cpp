@@ -0,0 +1,95 @@
+//
+// Copyright 2019 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/thread_roles.hpp>
+#include <map>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <vector>
+
+static const std::string LOG_ID = "UHD";
+
+static const std::regex thread_cpu_expr("^thread_([A-Za-z0-9_]+)_cpu$");
+static const std::regex thread_priority_expr("^thread_([A-Za-z0-9_]+)_priority$");
+
+namespace {
+
+struct thread_role_config_t
+{
+    std::vector<size_t> cpu_affinity_list;
+    bool has_priority = false;
+    float priority    = 0.0f;
+};
+
+// The registry outlives any device object, since the threads consulting it
+// may be torn down after the device args that configured it are gone.
+std::mutex& get_role_mutex(void)
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, thread_role_config_t>& get_role_map(void)
+{
+    static std::map<std::string, thread_role_config_t> map;
+    return map;
+}
+
+} // namespace
+
+void uhd::utils::register_thread_role_config(const device_addr_t& args)
+{
+    std::lock_guard<std::mutex> lock(get_role_mutex());
+    for (const auto& key : args.keys()) {
+        std::smatch match;
+        if (std::regex_match(key, match, thread_cpu_expr)) {
+            UHD_ASSERT_THROW(match.size() == 2); // first match is the entire key
+            get_role_map()[match.str(1)].cpu_affinity_list = {
+                args.cast<size_t>(key, 0)};
+        } else if (std::regex_match(key, match, thread_priority_expr)) {
+            UHD_ASSERT_THROW(match.size() == 2);
+            auto& config        = get_role_map()[match.str(1)];
+            config.priority     = args.cast<float>(key, 0.0f);
+            config.has_priority = true;
+        }
+    }
+}
+
+void uhd::utils::apply_thread_role(const std::string& role)
+{
+    if (role.empty()) {
+        return;
+    }
+    thread_role_config_t config;
+    {
+        std::lock_guard<std::mutex> lock(get_role_mutex());
+        const auto& map = get_role_map();
+        auto it         = map.find(role);
+        if (it == map.end()) {
+            it = map.find("default");
+        }
+        if (it == map.end()) {
+            return;
+        }
+        config = it->second;
+    }
+    if (not config.cpu_affinity_list.empty()) {
+        UHD_LOG_DEBUG(LOG_ID,
+            "Setting affinity of thread role " << role << " to CPU "
+                                               << config.cpu_affinity_list.front());
+        uhd::set_thread_affinity(config.cpu_affinity_list);
+    }
+    if (config.has_priority) {
+        if (not uhd::set_thread_priority_safe(config.priority, false)) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Failed to set priority for thread role " << role);
+        }
+    }
+}
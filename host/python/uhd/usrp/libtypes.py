@@ -26,4 +26,5 @@ FEConnection = lib.usrp.fe_connection
 StreamArgs = lib.usrp.stream_args
 RXStreamer = lib.usrp.rx_streamer
 TXStreamer = lib.usrp.tx_streamer
+RecvBufferRing = lib.usrp.recv_buffer_ring
 # pylint: enable=invalid-name
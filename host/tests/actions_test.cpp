@@ -85,3 +85,37 @@ BOOST_AUTO_TEST_CASE(test_actions_simple_graph)
     BOOST_CHECK_EQUAL(
         NUM_SAMPS * mock_ddc.get_property<int>("decim", 0), mock_rx_radio.last_num_samps);
 }
+
+BOOST_AUTO_TEST_CASE(test_actions_multi_chan_fanout)
+{
+    node_accessor_t node_accessor{};
+    uhd::rfnoc::detail::graph_t graph{};
+
+    // Define some mock nodes:
+    mock_radio_node_t mock_rx_radio0{0};
+    mock_radio_node_t mock_rx_radio1{1};
+    mock_streamer_t mock_streamer{2};
+
+    // These init calls would normally be done by the framework
+    node_accessor.init_props(&mock_rx_radio0);
+    node_accessor.init_props(&mock_rx_radio1);
+    node_accessor.init_props(&mock_streamer);
+
+    graph.connect(&mock_rx_radio0, &mock_streamer, {0, 0, graph_edge_t::DYNAMIC, true});
+    graph.connect(&mock_rx_radio1, &mock_streamer, {0, 1, graph_edge_t::DYNAMIC, true});
+    graph.commit();
+
+    uhd::stream_cmd_t num_samps_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    constexpr size_t NUM_SAMPS = 42;
+    num_samps_cmd.num_samps    = NUM_SAMPS;
+
+    // A single batched post must reach every radio
+    mock_streamer.issue_stream_cmd_all_chans(num_samps_cmd);
+    BOOST_CHECK_EQUAL(mock_rx_radio0.last_num_samps, NUM_SAMPS);
+    BOOST_CHECK_EQUAL(mock_rx_radio1.last_num_samps, NUM_SAMPS);
+
+    // Detached from a graph, post_actions() must fall back to the default
+    // (dropping) callback without throwing
+    mock_streamer_t detached_streamer{2};
+    detached_streamer.issue_stream_cmd_all_chans(num_samps_cmd);
+}
@@ -0,0 +1,296 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/stream.hpp>
+#include <uhd/types/metadata.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr size_t BYTES_PER_SAMP = 4; // sc16
+
+/*!
+ * Mock RX streamer that plays back a scripted sequence of packets, standing
+ * in for a per-device streamer in the aggregate streamer tests. Sample n of
+ * a packet is written as the 32-bit value tag + n on every channel, so tests
+ * can check which packet's data ended up where in the caller's buffers.
+ */
+class mock_rx_streamer : public uhd::rx_streamer
+{
+public:
+    struct packet_t
+    {
+        size_t nsamps;
+        bool has_tsf;
+        double time;
+        bool eob                               = false;
+        uhd::rx_metadata_t::error_code_t error = uhd::rx_metadata_t::ERROR_CODE_NONE;
+        uint32_t tag                           = 0;
+    };
+
+    mock_rx_streamer(const size_t num_chans, const size_t max_num_samps)
+        : _num_chans(num_chans), _max_num_samps(max_num_samps)
+    {
+    }
+
+    void push_packet(const packet_t& packet)
+    {
+        _packets.push_back(packet);
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return _max_num_samps;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const double /*timeout*/,
+        const bool /*one_packet*/) override
+    {
+        metadata.reset();
+        num_recv_calls++;
+        if (_packets.empty()) {
+            metadata.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+            return 0;
+        }
+        const packet_t packet = _packets.front();
+        _packets.pop_front();
+        if (packet.error != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            metadata.error_code = packet.error;
+            return 0;
+        }
+        const size_t nsamps = std::min(nsamps_per_buff, packet.nsamps);
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            uint32_t* samps = static_cast<uint32_t*>(buffs[chan]);
+            for (size_t n = 0; n < nsamps; n++) {
+                samps[n] = packet.tag + uint32_t(n);
+            }
+        }
+        metadata.has_time_spec = packet.has_tsf;
+        metadata.time_spec     = uhd::time_spec_t(packet.time);
+        metadata.end_of_burst  = packet.eob;
+        num_packets_consumed++;
+        return nsamps;
+    }
+
+    uhd::stream_stats_t get_stream_stats() const override
+    {
+        uhd::stream_stats_t stats;
+        stats.num_calls   = num_recv_calls;
+        stats.num_packets = num_packets_consumed;
+        return stats;
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t& stream_cmd) override
+    {
+        num_stream_cmds++;
+        last_stream_cmd = stream_cmd;
+    }
+
+    size_t num_recv_calls       = 0;
+    size_t num_packets_consumed = 0;
+    size_t num_stream_cmds      = 0;
+    uhd::stream_cmd_t last_stream_cmd{uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS};
+
+private:
+    const size_t _num_chans;
+    const size_t _max_num_samps;
+    std::deque<packet_t> _packets;
+};
+
+//! Caller-side sample storage for an aggregate streamer with the given
+//! number of channels
+struct recv_buffs_t
+{
+    recv_buffs_t(const size_t num_chans, const size_t nsamps)
+        : storage(num_chans, std::vector<uint32_t>(nsamps, 0))
+    {
+        for (auto& chan_storage : storage) {
+            ptrs.push_back(chan_storage.data());
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> storage;
+    std::vector<void*> ptrs;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_aggregate_geometry)
+{
+    auto streamer_a = std::make_shared<mock_rx_streamer>(2, 100);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, 200);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    BOOST_CHECK_EQUAL(aggregate->get_num_channels(), 3);
+    BOOST_CHECK_EQUAL(aggregate->get_max_num_samps(), 100);
+
+    BOOST_CHECK_THROW(uhd::make_aggregate_rx_streamer({}, "sc16"), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_aligned_recv)
+{
+    constexpr size_t NSAMPS = 100;
+    auto streamer_a = std::make_shared<mock_rx_streamer>(2, NSAMPS);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    streamer_a->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 2000});
+
+    recv_buffs_t buffs(3, NSAMPS);
+    uhd::rx_metadata_t metadata;
+    const size_t num_samps =
+        aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+
+    BOOST_CHECK_EQUAL(num_samps, NSAMPS);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK(metadata.has_time_spec);
+    BOOST_CHECK_CLOSE(metadata.time_spec.get_real_secs(), 1.0, 1e-9);
+    BOOST_CHECK(not metadata.end_of_burst);
+
+    // Channels 0 and 1 come from the first member, channel 2 from the second
+    BOOST_CHECK_EQUAL(buffs.storage[0][0], 1000);
+    BOOST_CHECK_EQUAL(buffs.storage[1][NSAMPS - 1], 1000 + NSAMPS - 1);
+    BOOST_CHECK_EQUAL(buffs.storage[2][0], 2000);
+    BOOST_CHECK_EQUAL(buffs.storage[2][NSAMPS - 1], 2000 + NSAMPS - 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_drops_stale_packets)
+{
+    constexpr size_t NSAMPS = 50;
+    auto streamer_a = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    // The second member is one packet behind (e.g. the first member dropped
+    // a packet during an overrun): its stale packet must be discarded and
+    // overwritten by the aligned one
+    streamer_a->push_packet({NSAMPS, true, 2.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 2000});
+    streamer_b->push_packet({NSAMPS, true, 2.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 3000});
+
+    recv_buffs_t buffs(2, NSAMPS);
+    uhd::rx_metadata_t metadata;
+    const size_t num_samps =
+        aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+
+    BOOST_CHECK_EQUAL(num_samps, NSAMPS);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_CLOSE(metadata.time_spec.get_real_secs(), 2.0, 1e-9);
+    BOOST_CHECK_EQUAL(buffs.storage[0][0], 1000);
+    BOOST_CHECK_EQUAL(buffs.storage[1][0], 3000);
+    BOOST_CHECK_EQUAL(streamer_b->num_packets_consumed, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_one_packet_topup)
+{
+    constexpr size_t NSAMPS = 100;
+    auto streamer_a = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    // The second member uses half the spp of the first: a one-packet recv
+    // must still return equal counts, so the short member is topped up with
+    // its next packet rather than letting it fall behind
+    streamer_a->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({NSAMPS / 2, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 2000});
+    streamer_b->push_packet({NSAMPS / 2, true, 1.5, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 3000});
+
+    recv_buffs_t buffs(2, NSAMPS);
+    uhd::rx_metadata_t metadata;
+    const size_t num_samps =
+        aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, true);
+
+    BOOST_CHECK_EQUAL(num_samps, NSAMPS);
+    BOOST_CHECK_EQUAL(buffs.storage[1][0], 2000);
+    BOOST_CHECK_EQUAL(buffs.storage[1][NSAMPS / 2], 3000);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_error_and_timeout)
+{
+    constexpr size_t NSAMPS = 50;
+    auto streamer_a = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    // An error on any member interrupts the call
+    streamer_a->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({0, false, 0.0, false, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW, 0});
+
+    recv_buffs_t buffs(2, NSAMPS);
+    uhd::rx_metadata_t metadata;
+    size_t num_samps = aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps, 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+
+    // Both members are now empty: the next call times out
+    num_samps = aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps, 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_end_of_burst)
+{
+    constexpr size_t NSAMPS = 50;
+    auto streamer_a = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, NSAMPS);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    // End of burst is only reported once all members have reached it
+    streamer_a->push_packet({NSAMPS, true, 1.0, true, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({NSAMPS, true, 1.0, false, uhd::rx_metadata_t::ERROR_CODE_NONE, 2000});
+
+    recv_buffs_t buffs(2, NSAMPS);
+    uhd::rx_metadata_t metadata;
+    size_t num_samps = aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps, NSAMPS);
+    BOOST_CHECK(not metadata.end_of_burst);
+
+    streamer_a->push_packet({NSAMPS, true, 2.0, true, uhd::rx_metadata_t::ERROR_CODE_NONE, 1000});
+    streamer_b->push_packet({NSAMPS, true, 2.0, true, uhd::rx_metadata_t::ERROR_CODE_NONE, 2000});
+
+    num_samps = aggregate->recv(buffs.ptrs, NSAMPS, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps, NSAMPS);
+    BOOST_CHECK(metadata.end_of_burst);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregate_forwards_stream_cmds_and_stats)
+{
+    auto streamer_a = std::make_shared<mock_rx_streamer>(1, 100);
+    auto streamer_b = std::make_shared<mock_rx_streamer>(1, 100);
+    auto aggregate  = uhd::make_aggregate_rx_streamer({streamer_a, streamer_b}, "sc16");
+
+    uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    stream_cmd.num_samps  = 1000;
+    stream_cmd.stream_now = false;
+    stream_cmd.time_spec  = uhd::time_spec_t(1.0);
+    aggregate->issue_stream_cmd(stream_cmd);
+
+    BOOST_CHECK_EQUAL(streamer_a->num_stream_cmds, 1);
+    BOOST_CHECK_EQUAL(streamer_b->num_stream_cmds, 1);
+    BOOST_CHECK_EQUAL(streamer_b->last_stream_cmd.num_samps, 1000);
+
+    streamer_a->num_recv_calls       = 3;
+    streamer_a->num_packets_consumed = 2;
+    streamer_b->num_recv_calls       = 5;
+    streamer_b->num_packets_consumed = 4;
+    const uhd::stream_stats_t stats = aggregate->get_stream_stats();
+    BOOST_CHECK_EQUAL(stats.num_calls, 8);
+    BOOST_CHECK_EQUAL(stats.num_packets, 6);
+}
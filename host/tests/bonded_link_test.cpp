@@ -0,0 +1,131 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "common/mock_link.hpp"
+#include <uhdlib/transport/bonded_link.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr size_t FRAME_SIZE = 1000;
+constexpr int32_t TIMEOUT_MS = 1;
+
+mock_send_link::sptr make_mock_send_link(const size_t num_frames)
+{
+    return std::make_shared<mock_send_link>(
+        mock_send_link::link_params{FRAME_SIZE, num_frames});
+}
+
+mock_recv_link::sptr make_mock_recv_link(const size_t num_frames)
+{
+    return std::make_shared<mock_recv_link>(
+        mock_recv_link::link_params{FRAME_SIZE, num_frames});
+}
+
+void push_recv_packet(mock_recv_link::sptr link, const uint8_t tag)
+{
+    auto mem = boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]);
+    mem[0]   = tag;
+    link->push_back_recv_packet(mem, FRAME_SIZE);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_bonded_send_striping)
+{
+    auto link_a = make_mock_send_link(2);
+    auto link_b = make_mock_send_link(2);
+    bonded_send_link_t bonded({link_a, link_b});
+
+    BOOST_CHECK_EQUAL(bonded.get_num_send_frames(), 4);
+    BOOST_CHECK_EQUAL(bonded.get_send_frame_size(), FRAME_SIZE);
+
+    // Consecutive packets alternate between the members
+    for (size_t i = 0; i < 6; i++) {
+        auto buff = bonded.get_send_buff(TIMEOUT_MS);
+        BOOST_REQUIRE(buff);
+        static_cast<uint8_t*>(buff->data())[0] = uint8_t(i);
+        buff->set_packet_size(FRAME_SIZE);
+        bonded.release_send_buff(std::move(buff));
+    }
+    BOOST_REQUIRE_EQUAL(link_a->get_num_packets(), 3);
+    BOOST_REQUIRE_EQUAL(link_b->get_num_packets(), 3);
+    for (size_t i = 0; i < 3; i++) {
+        BOOST_CHECK_EQUAL(link_a->pop_send_packet().first[0], uint8_t(2 * i));
+        BOOST_CHECK_EQUAL(link_b->pop_send_packet().first[0], uint8_t(2 * i + 1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_bonded_send_skips_busy_member)
+{
+    auto link_a = make_mock_send_link(1);
+    auto link_b = make_mock_send_link(2);
+    bonded_send_link_t bonded({link_a, link_b});
+
+    // Exhaust the first member's only frame: subsequent sends must come
+    // from the second member instead of timing out
+    auto held = bonded.get_send_buff(TIMEOUT_MS);
+    BOOST_REQUIRE(held);
+    for (size_t i = 0; i < 2; i++) {
+        auto buff = bonded.get_send_buff(TIMEOUT_MS);
+        BOOST_REQUIRE(buff);
+        buff->set_packet_size(FRAME_SIZE);
+        bonded.release_send_buff(std::move(buff));
+    }
+    BOOST_CHECK_EQUAL(link_a->get_num_packets(), 0);
+    BOOST_CHECK_EQUAL(link_b->get_num_packets(), 2);
+
+    held->set_packet_size(FRAME_SIZE);
+    bonded.release_send_buff(std::move(held));
+    BOOST_CHECK_EQUAL(link_a->get_num_packets(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_bonded_recv_merge)
+{
+    auto link_a = make_mock_recv_link(2);
+    auto link_b = make_mock_recv_link(2);
+    bonded_recv_link_t bonded({link_a, link_b});
+
+    BOOST_CHECK_EQUAL(bonded.get_num_recv_frames(), 4);
+    BOOST_CHECK_EQUAL(bonded.get_recv_frame_size(), FRAME_SIZE);
+
+    // Two packets pending on each member: all four must be delivered,
+    // alternating between the members
+    for (size_t i = 0; i < 2; i++) {
+        push_recv_packet(link_a, uint8_t(10 + i));
+        push_recv_packet(link_b, uint8_t(20 + i));
+    }
+    std::vector<uint8_t> tags;
+    for (size_t i = 0; i < 4; i++) {
+        auto buff = bonded.get_recv_buff(TIMEOUT_MS);
+        BOOST_REQUIRE(buff);
+        tags.push_back(static_cast<const uint8_t*>(buff->data())[0]);
+        bonded.release_recv_buff(std::move(buff));
+    }
+    std::sort(tags.begin(), tags.end());
+    const std::vector<uint8_t> expected{10, 11, 20, 21};
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        tags.begin(), tags.end(), expected.begin(), expected.end());
+
+    // No packets pending: times out with a null buffer
+    BOOST_CHECK(!bonded.get_recv_buff(0));
+}
+
+BOOST_AUTO_TEST_CASE(test_bonded_link_errors)
+{
+    BOOST_REQUIRE_THROW(
+        bonded_send_link_t bonded(std::vector<send_link_if::sptr>{}), uhd::value_error);
+    BOOST_REQUIRE_THROW(
+        bonded_recv_link_t bonded(std::vector<recv_link_if::sptr>{}), uhd::value_error);
+
+    auto link_a = make_mock_send_link(1);
+    auto link_c = std::make_shared<mock_send_link>(
+        mock_send_link::link_params{FRAME_SIZE / 2, 1});
+    BOOST_REQUIRE_THROW(
+        bonded_send_link_t bonded({link_a, link_c}), uhd::value_error);
+}
@@ -6,6 +6,7 @@
 //
 
 #include <uhd/transport/bounded_buffer.hpp>
+#include <uhdlib/utils/bounded_queue.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -54,3 +55,52 @@ BOOST_AUTO_TEST_CASE(test_bounded_buffer_with_pop_on_full)
     BOOST_CHECK(bb.pop_with_timed_wait(val, timeout));
     BOOST_CHECK_EQUAL(val, 3);
 }
+
+BOOST_AUTO_TEST_CASE(test_bounded_queue_with_haste)
+{
+    // capacity rounds up to the next power of two (4)
+    uhd::utils::bounded_queue<int> bq(3);
+
+    // push elements, check for full
+    BOOST_CHECK(bq.push_with_haste(0));
+    BOOST_CHECK(bq.push_with_haste(1));
+    BOOST_CHECK(bq.push_with_haste(2));
+    BOOST_CHECK(bq.push_with_haste(3));
+    BOOST_CHECK(not bq.push_with_haste(4));
+
+    int val;
+    // pop elements, check for empty and check values
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 0);
+    BOOST_CHECK(bq.pop_with_timed_wait(val, timeout));
+    BOOST_CHECK_EQUAL(val, 1);
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 2);
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 3);
+    BOOST_CHECK(not bq.pop_with_haste(val));
+    BOOST_CHECK(not bq.pop_with_timed_wait(val, timeout));
+}
+
+BOOST_AUTO_TEST_CASE(test_bounded_queue_with_pop_on_full)
+{
+    uhd::utils::bounded_queue<int> bq(4);
+
+    // push elements, check for overflow behavior
+    BOOST_CHECK(bq.push_with_pop_on_full(0));
+    BOOST_CHECK(bq.push_with_pop_on_full(1));
+    BOOST_CHECK(bq.push_with_pop_on_full(2));
+    BOOST_CHECK(bq.push_with_pop_on_full(3));
+    BOOST_CHECK(not bq.push_with_pop_on_full(4));
+
+    int val;
+    // the oldest element was popped to make room
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 1);
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 2);
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 3);
+    BOOST_CHECK(bq.pop_with_haste(val));
+    BOOST_CHECK_EQUAL(val, 4);
+}
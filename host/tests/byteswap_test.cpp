@@ -7,6 +7,7 @@
 
 #include <uhd/utils/byteswap.hpp>
 #include <boost/test/unit_test.hpp>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(test_byteswap16)
 {
@@ -29,3 +30,28 @@ BOOST_AUTO_TEST_CASE(test_byteswap64)
     uint64_t y = 0xefcdab89 | (uint64_t(0x67452301) << 32);
     BOOST_CHECK_EQUAL(uhd::byteswap(x), y);
 }
+
+BOOST_AUTO_TEST_CASE(test_byteswap_buff)
+{
+    // Odd length so the vectorized body and the scalar tail both run
+    std::vector<uint32_t> buff(37);
+    for (size_t i = 0; i < buff.size(); i++) {
+        buff[i] = uint32_t(0x01234567 + i);
+    }
+    uhd::byteswap_buff(buff.data(), buff.size());
+    for (size_t i = 0; i < buff.size(); i++) {
+        BOOST_CHECK_EQUAL(buff[i], uhd::byteswap(uint32_t(0x01234567 + i)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_byteswap_copy)
+{
+    std::vector<uint16_t> input(19), output(19);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = uint16_t(0x0123 + i);
+    }
+    uhd::byteswap_copy(output.data(), input.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        BOOST_CHECK_EQUAL(output[i], uhd::byteswap(input[i]));
+    }
+}
@@ -124,6 +124,35 @@ BOOST_AUTO_TEST_CASE(test_pwr_cal_serdes)
             pwr_cal_data->get_power(gp.first, ref_freq),
             gp.second);
     }
+
+    // Now the same round trip through the lazy, blob-based deserialization
+    class mock_blob : public cal_data_blob
+    {
+    public:
+        mock_blob(std::vector<uint8_t> data) : _data(std::move(data)) {}
+        const uint8_t* data() const override
+        {
+            return _data.data();
+        }
+        size_t size() const override
+        {
+            return _data.size();
+        }
+
+    private:
+        const std::vector<uint8_t> _data;
+    };
+    const cal_data_blob::sptr blob = std::make_shared<mock_blob>(serialized);
+    auto pwr_cal_data_lazy = container::make<pwr_cal>(blob);
+    // Metadata is available before the tables are unpacked
+    BOOST_CHECK_EQUAL(pwr_cal_data_lazy->get_name(), name);
+    BOOST_CHECK_EQUAL(pwr_cal_data_lazy->get_serial(), serial);
+    BOOST_CHECK_EQUAL(pwr_cal_data_lazy->get_timestamp(), timestamp);
+    for (auto& gp : test_gain_power) {
+        BOOST_CHECK_EQUAL(
+            pwr_cal_data_lazy->get_power(gp.first, ref_freq),
+            gp.second);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(test_pwr_cal_des_fail)
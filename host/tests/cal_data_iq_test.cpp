@@ -12,6 +12,28 @@
 using namespace uhd::usrp::cal;
 using namespace uhd::math;
 
+namespace {
+//! Minimal blob implementation for testing the lazy deserialization path
+class mock_blob : public cal_data_blob
+{
+public:
+    mock_blob(std::vector<uint8_t> data) : _data(std::move(data)) {}
+
+    const uint8_t* data() const override
+    {
+        return _data.data();
+    }
+
+    size_t size() const override
+    {
+        return _data.size();
+    }
+
+private:
+    const std::vector<uint8_t> _data;
+};
+} // namespace
+
 BOOST_AUTO_TEST_CASE(test_iq_cal_api)
 {
     const std::string name   = "Mock IQ Data";
@@ -73,6 +95,41 @@ BOOST_AUTO_TEST_CASE(test_iq_cal_serdes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_iq_cal_serdes_blob)
+{
+    const std::string name   = "Mock IQ Data";
+    const std::string serial = "ABC1234";
+    const uint64_t timestamp = 0x12340000;
+
+    auto iq_cal_data_blueprint = iq_cal::make(name, serial, timestamp);
+    for (double d = 0; d < 5.0; d += 1.0) {
+        iq_cal_data_blueprint->set_cal_coeff(d, {d, d}, d * 10, d * 20);
+    }
+
+    const cal_data_blob::sptr blob =
+        std::make_shared<mock_blob>(iq_cal_data_blueprint->serialize());
+
+    auto iq_cal_data = container::make<iq_cal>(blob);
+
+    // Metadata is available right away...
+    BOOST_CHECK_EQUAL(iq_cal_data->get_name(), name);
+    BOOST_CHECK_EQUAL(iq_cal_data->get_serial(), serial);
+    BOOST_CHECK_EQUAL(iq_cal_data->get_timestamp(), timestamp);
+
+    // ...and the coefficients are unpacked on first access
+    iq_cal_data->set_interp_mode(interp_mode::NEAREST_NEIGHBOR);
+    for (double d = 0; d < 5.0; d += 1.0) {
+        BOOST_CHECK_EQUAL(iq_cal_data->get_cal_coeff(d), std::complex<double>(d, d));
+    }
+
+    // The round trip must also survive re-serialization
+    const auto serialized = iq_cal_data->serialize();
+    BOOST_CHECK_EQUAL_COLLECTIONS(serialized.begin(),
+        serialized.end(),
+        blob->data(),
+        blob->data() + blob->size());
+}
+
 BOOST_AUTO_TEST_CASE(test_iq_cal_des_fail)
 {
     std::vector<uint8_t> not_actual_data(42, 23);
@@ -29,6 +29,13 @@ BOOST_AUTO_TEST_CASE(test_rc)
     // are hashed with the same git commit, and thus we also test the integrity
     // of test.cal.
     BOOST_CHECK_EQUAL(test_str, "rc::cal::test_data");
+
+    // RC data can also be referenced in place as a blob
+    const auto test_blob = database::read_cal_data_blob("test", "", source::RC);
+    BOOST_REQUIRE(test_blob);
+    const std::string test_blob_str(
+        reinterpret_cast<const char*>(test_blob->data()), test_blob->size());
+    BOOST_CHECK_EQUAL(test_blob_str, "rc::cal::test_data");
 }
 
 BOOST_AUTO_TEST_CASE(test_fs)
@@ -70,6 +77,14 @@ BOOST_AUTO_TEST_CASE(test_fs)
     BOOST_CHECK_EQUAL_COLLECTIONS(
         mock_data.begin(), mock_data.end(), mock_data_rb.begin(), mock_data_rb.end());
 
+    // The blob-based read must yield the same bytes, without the heap copy
+    const auto mock_data_blob = database::read_cal_data_blob("mock_data", "1234");
+    BOOST_REQUIRE(mock_data_blob);
+    BOOST_CHECK_EQUAL_COLLECTIONS(mock_data.begin(),
+        mock_data.end(),
+        mock_data_blob->data(),
+        mock_data_blob->data() + mock_data_blob->size());
+
     BOOST_CHECK(!database::has_cal_data("mock_data", "abcd"));
     std::vector<uint8_t> mock_data2{2, 3, 4, 5, 6};
     database::write_cal_data("mock_data", "abcd", mock_data);
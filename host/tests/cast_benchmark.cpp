@@ -0,0 +1,76 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Benchmark for uhd::cast::from_str(), which device-arg parsing
+// (device_addr_t::cast, io_service_args) calls dozens of times per session
+// and streamer creation. Run before/after touching the parsers to verify
+// conversion cost.
+
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+namespace {
+
+template <typename data_t>
+double benchmark_from_str(const std::vector<std::string>& inputs, const size_t iters)
+{
+    // Accumulate results so the calls cannot be optimized away
+    volatile size_t sink = 0;
+    const auto start     = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iters; i++) {
+        for (const auto& input : inputs) {
+            sink = sink + static_cast<size_t>(uhd::cast::from_str<data_t>(input) != 0);
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const double ns =
+        double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    return ns / double(iters * inputs.size());
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t iters;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("iters", po::value<size_t>(&iters)->default_value(100000), "iterations per data type")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << "UHD Cast Benchmark " << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::vector<std::string> int_inputs{"0", "32", "-1", "2048", "1000000"};
+    const std::vector<std::string> double_inputs{
+        "0.0", "1e6", "-0.125", "30.72e6", "2452.5"};
+    const std::vector<std::string> bool_inputs{"1", "0", "true", "No", "y"};
+
+    std::cout << "from_str<int>:    " << benchmark_from_str<int>(int_inputs, iters)
+              << " ns/call" << std::endl;
+    std::cout << "from_str<double>: " << benchmark_from_str<double>(double_inputs, iters)
+              << " ns/call" << std::endl;
+    std::cout << "from_str<bool>:   " << benchmark_from_str<bool>(bool_inputs, iters)
+              << " ns/call" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/rfnoc/chdr_flight_recorder.hpp>
+#include <uhdlib/rfnoc/chdr_types.hpp>
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+//! Reads a little-endian 32-bit word at the given byte offset
+uint32_t read_u32(const std::string& bytes, const size_t offset)
+{
+    BOOST_REQUIRE(offset + 4 <= bytes.size());
+    return (uint32_t(uint8_t(bytes[offset]))) | (uint32_t(uint8_t(bytes[offset + 1])) << 8)
+           | (uint32_t(uint8_t(bytes[offset + 2])) << 16)
+           | (uint32_t(uint8_t(bytes[offset + 3])) << 24);
+}
+
+uint64_t read_u64(const std::string& bytes, const size_t offset)
+{
+    return uint64_t(read_u32(bytes, offset))
+           | (uint64_t(read_u32(bytes, offset + 4)) << 32);
+}
+
+//! Splits a dump into its pcapng blocks (offset of each block body)
+std::vector<size_t> parse_blocks(const std::string& bytes)
+{
+    std::vector<size_t> offsets;
+    size_t offset = 0;
+    while (offset < bytes.size()) {
+        offsets.push_back(offset);
+        const uint32_t blk_len = read_u32(bytes, offset + 4);
+        BOOST_REQUIRE(blk_len >= 12 and blk_len % 4 == 0);
+        // Trailing length must match the leading one
+        BOOST_CHECK_EQUAL(read_u32(bytes, offset + blk_len - 4), blk_len);
+        offset += blk_len;
+    }
+    BOOST_CHECK_EQUAL(offset, bytes.size());
+    return offsets;
+}
+
+uint64_t make_header(const uint16_t seq_num, const size_t length)
+{
+    chdr::chdr_header header;
+    header.set_pkt_type(chdr::PKT_TYPE_DATA_NO_TS);
+    header.set_seq_num(seq_num);
+    header.set_length(length);
+    return header.pack();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_flight_recorder_pcapng_layout)
+{
+    chdr_flight_recorder recorder(8, "unused");
+
+    recorder.record(make_header(0, 100), 0, false, chdr_flight_recorder::DIR_RX);
+    recorder.record(make_header(1, 200), 0x1234, true, chdr_flight_recorder::DIR_RX);
+    recorder.record(make_header(2, 300), 0, false, chdr_flight_recorder::DIR_TX);
+    BOOST_CHECK_EQUAL(recorder.get_num_recorded(), 3);
+
+    std::ostringstream out;
+    recorder.dump(out);
+    const std::string bytes = out.str();
+
+    const auto blocks = parse_blocks(bytes);
+    BOOST_REQUIRE_EQUAL(blocks.size(), 5); // SHB + IDB + 3 packets
+
+    // Section header block with the little-endian byte-order magic
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[0]), 0x0A0D0D0A);
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[0] + 8), 0x1A2B3C4D);
+
+    // Interface description block: user link type, 16-byte snap length
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[1]), 1);
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[1] + 8) & 0xFFFF, 147);
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[1] + 12), 16);
+
+    // First packet: header only, original length from the CHDR length field
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[2]), 6);
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[2] + 20), 8); // captured length
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[2] + 24), 100); // original length
+    BOOST_CHECK_EQUAL(read_u64(bytes, blocks[2] + 28), make_header(0, 100));
+
+    // Second packet carries its timestamp after the header
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[3] + 20), 16);
+    BOOST_CHECK_EQUAL(read_u64(bytes, blocks[3] + 28), make_header(1, 200));
+    BOOST_CHECK_EQUAL(read_u64(bytes, blocks[3] + 36), 0x1234);
+
+    // Direction is encoded in the epb_flags option right after the data
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[2] + 40), 0x1); // inbound
+    BOOST_CHECK_EQUAL(read_u32(bytes, blocks[4] + 40), 0x2); // outbound
+
+    // Timestamps are monotonic across the records
+    const uint64_t ts_0 = (uint64_t(read_u32(bytes, blocks[2] + 12)) << 32)
+                          | read_u32(bytes, blocks[2] + 16);
+    const uint64_t ts_1 = (uint64_t(read_u32(bytes, blocks[3] + 12)) << 32)
+                          | read_u32(bytes, blocks[3] + 16);
+    BOOST_CHECK(ts_1 >= ts_0);
+}
+
+BOOST_AUTO_TEST_CASE(test_flight_recorder_ring_wrap)
+{
+    chdr_flight_recorder recorder(4, "unused");
+
+    // Overfill the ring; only the newest 4 records survive
+    for (uint16_t i = 0; i < 10; i++) {
+        recorder.record(make_header(i, 64), 0, false, chdr_flight_recorder::DIR_RX);
+    }
+    BOOST_CHECK_EQUAL(recorder.get_num_recorded(), 10);
+
+    std::ostringstream out;
+    recorder.dump(out);
+    const std::string bytes = out.str();
+
+    const auto blocks = parse_blocks(bytes);
+    BOOST_REQUIRE_EQUAL(blocks.size(), 6); // SHB + IDB + 4 packets
+
+    // Oldest first: sequence numbers 6 through 9
+    for (size_t i = 0; i < 4; i++) {
+        const uint64_t header = read_u64(bytes, blocks[2 + i] + 28);
+        BOOST_CHECK_EQUAL(
+            chdr::chdr_header(header).get_seq_num(), uint16_t(6 + i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_flight_recorder_rejects_empty_ring)
+{
+    BOOST_CHECK_THROW(chdr_flight_recorder(0, "unused"), uhd::value_error);
+}
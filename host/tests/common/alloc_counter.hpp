@@ -0,0 +1,88 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#ifndef INCLUDED_ALLOC_COUNTER_HPP
+#define INCLUDED_ALLOC_COUNTER_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*!
+ * Heap allocation counter for hot-path tests
+ *
+ * This header replaces the global allocation functions so that a test can
+ * assert that a code path performs no heap allocations (e.g., the streamer
+ * recv/send steady state). Because replacement allocation functions must be
+ * defined exactly once per binary, include this header in exactly one
+ * translation unit of a test.
+ */
+
+namespace test_alloc_counter {
+
+static std::atomic<size_t> num_allocs{0};
+static std::atomic<bool> counting{false};
+
+//! RAII scope during which global heap allocations are counted
+class scoped_alloc_counter
+{
+public:
+    scoped_alloc_counter()
+    {
+        num_allocs = 0;
+        counting   = true;
+    }
+
+    ~scoped_alloc_counter()
+    {
+        counting = false;
+    }
+
+    size_t count() const
+    {
+        return num_allocs;
+    }
+};
+
+} // namespace test_alloc_counter
+
+void* operator new(std::size_t size)
+{
+    if (test_alloc_counter::counting) {
+        test_alloc_counter::num_allocs++;
+    }
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#endif /* INCLUDED_ALLOC_COUNTER_HPP */
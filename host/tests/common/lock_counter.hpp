@@ -0,0 +1,108 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#ifndef INCLUDED_LOCK_COUNTER_HPP
+#define INCLUDED_LOCK_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/*!
+ * Mutex acquisition counter for hot-path tests
+ *
+ * On platforms where pthread_mutex_lock can be interposed (Linux/glibc),
+ * this header replaces it with a wrapper that counts acquisitions, and
+ * separately those that were contended (the lock could not be taken
+ * immediately), so a test can assert that a code path is lock-free in
+ * steady state. Because the replacement must be defined exactly once per
+ * binary, include this header in exactly one translation unit of a test.
+ *
+ * On other platforms the counters stay at zero and lock_counter_available()
+ * returns false; tests should skip their assertions in that case.
+ */
+
+namespace test_lock_counter {
+
+static std::atomic<size_t> num_locks{0};
+static std::atomic<size_t> num_contended{0};
+static std::atomic<bool> counting{false};
+
+//! RAII scope during which mutex acquisitions are counted, on all threads
+class scoped_lock_counter
+{
+public:
+    scoped_lock_counter()
+    {
+        num_locks     = 0;
+        num_contended = 0;
+        counting      = true;
+    }
+
+    ~scoped_lock_counter()
+    {
+        counting = false;
+    }
+
+    size_t count() const
+    {
+        return num_locks;
+    }
+
+    size_t contended_count() const
+    {
+        return num_contended;
+    }
+};
+
+} // namespace test_lock_counter
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+#    ifndef _GNU_SOURCE
+#        define _GNU_SOURCE
+#    endif
+#    include <dlfcn.h>
+#    include <pthread.h>
+
+namespace test_lock_counter {
+constexpr bool lock_counter_available()
+{
+    return true;
+}
+} // namespace test_lock_counter
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    using lock_fn_t = int (*)(pthread_mutex_t*);
+    static const lock_fn_t real_lock =
+        reinterpret_cast<lock_fn_t>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+    static const lock_fn_t real_trylock =
+        reinterpret_cast<lock_fn_t>(dlsym(RTLD_NEXT, "pthread_mutex_trylock"));
+
+    if (test_lock_counter::counting) {
+        test_lock_counter::num_locks++;
+        // Probe with trylock to detect contention; fall through to the
+        // blocking lock if the mutex is held elsewhere
+        if (real_trylock(mutex) == 0) {
+            return 0;
+        }
+        test_lock_counter::num_contended++;
+    }
+    return real_lock(mutex);
+}
+
+#else
+
+namespace test_lock_counter {
+constexpr bool lock_counter_available()
+{
+    return false;
+}
+} // namespace test_lock_counter
+
+#endif
+
+#endif /* INCLUDED_LOCK_COUNTER_HPP */
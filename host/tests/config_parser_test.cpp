@@ -70,3 +70,18 @@ BOOST_AUTO_TEST_CASE(test_config_parser)
 
     cleanup_config_parsers();
 }
+
+BOOST_AUTO_TEST_CASE(test_config_parser_save)
+{
+    const std::string save_filename = "test_save.ini";
+    {
+        uhd::config_parser I;
+        I.set("section1", "key1", std::string("value1"));
+        I.set("section2", "key2", 42);
+        I.save(save_filename);
+    }
+    uhd::config_parser I(save_filename);
+    BOOST_CHECK_EQUAL(I.get<std::string>("section1", "key1"), "value1");
+    BOOST_CHECK_EQUAL(I.get<int>("section2", "key2"), 42);
+    std::remove(save_filename.c_str());
+}
@@ -0,0 +1,51 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/init_profile.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace uhd::utils;
+
+BOOST_AUTO_TEST_CASE(test_init_profile_records_nested_phases)
+{
+    clear_init_profile();
+    {
+        scoped_init_phase outer("outer");
+        {
+            scoped_init_phase inner("inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        scoped_init_phase sibling("sibling");
+    }
+
+    const auto profile = get_init_profile();
+    BOOST_REQUIRE_EQUAL(profile.size(), 3);
+
+    BOOST_CHECK_EQUAL(profile[0].name, "outer");
+    BOOST_CHECK_EQUAL(profile[0].depth, 0);
+    BOOST_CHECK_EQUAL(profile[1].name, "inner");
+    BOOST_CHECK_EQUAL(profile[1].depth, 1);
+    BOOST_CHECK_EQUAL(profile[2].name, "sibling");
+    BOOST_CHECK_EQUAL(profile[2].depth, 1);
+
+    // The outer phase contains the inner ones
+    BOOST_CHECK(profile[0].start <= profile[1].start);
+    BOOST_CHECK(profile[0].duration >= profile[1].duration);
+    BOOST_CHECK(profile[1].duration >= 0.002);
+
+    // Records are relative to the first phase
+    BOOST_CHECK_EQUAL(profile[0].start, 0.0);
+
+    // The report has one line per phase
+    const std::string report = format_init_profile();
+    BOOST_CHECK_EQUAL(std::count(report.begin(), report.end(), '\n'), 3);
+
+    clear_init_profile();
+    BOOST_CHECK(get_init_profile().empty());
+}
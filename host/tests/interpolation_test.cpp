@@ -7,6 +7,7 @@
 #include <uhdlib/utils/interpolation.hpp>
 #include <boost/test/unit_test.hpp>
 #include <string>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(test_get_bounding_iterators)
 {
@@ -101,3 +102,39 @@ BOOST_AUTO_TEST_CASE(test_map_bilinear_interp)
     BOOST_CHECK_EQUAL(at_bilin_interp(test_data, 1.5, 2.0), 1.5);
 }
 
+BOOST_AUTO_TEST_CASE(test_lin_interp_cache)
+{
+    using namespace uhd::math;
+    const std::map<double, double> test_data{{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}};
+    lin_interp_cache<std::map<double, double>> cache(test_data);
+
+    // Results must match at_lin_interp(), regardless of query order
+    BOOST_CHECK_CLOSE(cache(1.5), 1.5, 1e-6);
+    // Same bracket again (cache hit)
+    BOOST_CHECK_CLOSE(cache(1.25), 1.25, 1e-6);
+    BOOST_CHECK_CLOSE(cache(1.75), 1.75, 1e-6);
+    // Different bracket (cache miss)
+    BOOST_CHECK_CLOSE(cache(2.5), 2.5, 1e-6);
+    // Back to the first bracket
+    BOOST_CHECK_CLOSE(cache(1.5), 1.5, 1e-6);
+    // Boundary behavior must match at_lin_interp()
+    BOOST_CHECK_EQUAL(cache(0.1), 1.0);
+    BOOST_CHECK_EQUAL(cache(137.0), 3.0);
+    BOOST_CHECK_EQUAL(cache(2.0), 2.0);
+    cache.invalidate();
+    BOOST_CHECK_CLOSE(cache(2.5), 2.5, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(test_lin_interp_batch)
+{
+    using namespace uhd::math;
+    const std::map<double, double> test_data{{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}};
+
+    const std::vector<double> keys{0.1, 1.0, 1.5, 1.75, 2.5, 2.75, 137.0};
+    std::vector<double> values(keys.size(), 0.0);
+    at_lin_interp_batch(test_data, keys.data(), values.data(), keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        BOOST_CHECK_CLOSE(values[i], at_lin_interp(test_data, keys[i]), 1e-6);
+    }
+}
+
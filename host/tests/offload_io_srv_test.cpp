@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "common/alloc_counter.hpp"
 #include "common/mock_link.hpp"
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <boost/test/unit_test.hpp>
@@ -114,7 +115,8 @@ public:
         recv_link_if::sptr /*recv_link*/,
         size_t /*num_recv_frames*/,
         recv_callback_t /*recv_cb*/,
-        send_io_if::fc_callback_t /*fc_cb*/)
+        send_io_if::fc_callback_t /*fc_cb*/,
+        const bool /*high_priority*/ = false)
     {
         return std::make_shared<mock_send_io>(send_link);
     }
@@ -212,6 +214,36 @@ BOOST_AUTO_TEST_CASE(test_send)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_priority)
+{
+    // A high-priority (control) client sharing a link with a data client
+    // must have all of its packets sent; the priority drain path is
+    // exercised in every wait mode
+    for (const auto wait_mode : wait_modes) {
+        params_t params  = {{}, SEND_ONLY, wait_mode};
+        auto mock_io_srv = std::make_shared<mock_io_service>();
+        auto io_srv      = offload_io_service::make(mock_io_srv, params);
+        auto send_link   = make_send_link(5);
+        io_srv->attach_send_link(send_link);
+        auto data_client =
+            io_srv->make_send_client(send_link, 2, nullptr, nullptr, 0, nullptr, nullptr);
+        auto ctrl_client = io_srv->make_send_client(
+            send_link, 1, nullptr, nullptr, 0, nullptr, nullptr, true);
+
+        for (size_t i = 0; i < 10; i++) {
+            auto data_buff = data_client->get_send_buff(100);
+            BOOST_CHECK(data_buff != nullptr);
+            data_client->release_send_buff(std::move(data_buff));
+
+            auto ctrl_buff = ctrl_client->get_send_buff(100);
+            BOOST_CHECK(ctrl_buff != nullptr);
+            ctrl_client->release_send_buff(std::move(ctrl_buff));
+        }
+        ctrl_client.reset();
+        data_client.reset();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv)
 {
     for (const auto wait_mode : wait_modes) {
@@ -352,3 +384,92 @@ BOOST_AUTO_TEST_CASE(test_attach_detach)
     mock_io_srv->allocate_recv_frames(2, 1);
     recv_client2->release_recv_buff(recv_client2->get_recv_buff(100));
 }
+
+BOOST_AUTO_TEST_CASE(test_recv_steady_state_no_allocs)
+{
+    // The offload client hand-off runs over lock-free queues and is
+    // documented to perform no heap allocations in steady state; count
+    // global allocations over a run of successful calls to prove it
+    for (const auto wait_mode : wait_modes) {
+        params_t params  = {{}, RECV_ONLY, wait_mode};
+        auto mock_io_srv = std::make_shared<mock_io_service>();
+        auto io_srv      = offload_io_service::make(mock_io_srv, params);
+        auto recv_link   = make_recv_link(5);
+        io_srv->attach_recv_link(recv_link);
+
+        auto recv_client =
+            io_srv->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr);
+
+        const size_t NUM_PKTS = 10;
+        for (size_t i = 0; i < NUM_PKTS + 1; i++) {
+            recv_link->push_back_recv_packet(
+                boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+        }
+        mock_io_srv->allocate_recv_frames(0, NUM_PKTS + 1);
+
+        // One warm-up round trip so lazily initialized state is not counted
+        recv_client->release_recv_buff(recv_client->get_recv_buff(100));
+
+        size_t num_allocs = 0;
+        size_t num_buffs  = 0;
+        {
+            // No BOOST_CHECKs inside this scope: the test framework itself
+            // allocates
+            test_alloc_counter::scoped_alloc_counter counter;
+            for (size_t i = 0; i < NUM_PKTS; i++) {
+                auto buff = recv_client->get_recv_buff(100);
+                if (buff) {
+                    num_buffs++;
+                    recv_client->release_recv_buff(std::move(buff));
+                }
+            }
+            num_allocs = counter.count();
+        }
+
+        BOOST_CHECK_EQUAL(num_allocs, 0);
+        BOOST_CHECK_EQUAL(num_buffs, NUM_PKTS);
+        recv_client.reset();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_send_steady_state_no_allocs)
+{
+    for (const auto wait_mode : wait_modes) {
+        params_t params  = {{}, SEND_ONLY, wait_mode};
+        auto mock_io_srv = std::make_shared<mock_io_service>();
+        auto io_srv      = offload_io_service::make(mock_io_srv, params);
+
+        // Reuse the send memory so the mock link does not allocate a fresh
+        // buffer per packet; only the offload hand-off is under test here
+        const mock_send_link::link_params link_params = {FRAME_SIZE, 5};
+        auto send_link = std::make_shared<mock_send_link>(link_params, true);
+        io_srv->attach_send_link(send_link);
+
+        auto send_client =
+            io_srv->make_send_client(send_link, 1, nullptr, nullptr, 0, nullptr, nullptr);
+
+        // One warm-up round trip so lazily initialized state is not counted
+        send_client->release_send_buff(send_client->get_send_buff(100));
+
+        const size_t NUM_PKTS = 10;
+        size_t num_allocs     = 0;
+        size_t num_buffs      = 0;
+        {
+            // No BOOST_CHECKs inside this scope: the test framework itself
+            // allocates
+            test_alloc_counter::scoped_alloc_counter counter;
+            for (size_t i = 0; i < NUM_PKTS; i++) {
+                auto buff = send_client->get_send_buff(100);
+                if (buff) {
+                    num_buffs++;
+                    send_client->release_send_buff(std::move(buff));
+                }
+            }
+            num_allocs = counter.count();
+        }
+
+        BOOST_CHECK_EQUAL(num_allocs, 0);
+        BOOST_CHECK_EQUAL(num_buffs, NUM_PKTS);
+        send_client.reset();
+    }
+}
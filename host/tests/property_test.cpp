@@ -246,6 +246,26 @@ BOOST_AUTO_TEST_CASE(test_prop_subtree)
         tree_dirs2.begin(), tree_dirs2.end(), subtree2_dirs.begin(), subtree2_dirs.end());
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_list_order)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    tree->create<int>("/dir/bbb");
+    tree->create<int>("/dir/aaa");
+    tree->create<int>("/dir/ccc");
+
+    // list() enumerates children in creation order, not sorted order
+    const std::vector<std::string> expected{"bbb", "aaa", "ccc"};
+    const std::vector<std::string> listed = tree->list("/dir");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        expected.begin(), expected.end(), listed.begin(), listed.end());
+
+    tree->remove("/dir/aaa");
+    const std::vector<std::string> expected2{"bbb", "ccc"};
+    const std::vector<std::string> listed2 = tree->list("/dir");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        expected2.begin(), expected2.end(), listed2.begin(), listed2.end());
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_operators)
 {
     uhd::fs_path path1 = "/root/";
@@ -81,6 +81,32 @@ BOOST_AUTO_TEST_CASE(test_ranges_clip2)
     BOOST_CHECK_CLOSE(mr.clip(4., true), 3., tolerance);
 }
 
+BOOST_AUTO_TEST_CASE(test_ranges_clip_fragmented)
+{
+    // many sub-ranges, like a TwinRX gain/tune range
+    meta_range_t mr;
+    for (size_t i = 0; i < 32; i++) {
+        const double start = 100.0 * i;
+        mr.push_back(range_t(start, start + 50.0, 1.0));
+    }
+
+    BOOST_CHECK_CLOSE(mr.clip(-10.0), 0.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(25.0), 25.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1550.0), 1550.0, tolerance);
+    // in the gap: clip to the nearest edge on either side
+    BOOST_CHECK_CLOSE(mr.clip(1560.0), 1550.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1590.0), 1600.0, tolerance);
+    // boundaries of a sub-range
+    BOOST_CHECK_CLOSE(mr.clip(1600.0), 1600.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1650.0), 1650.0, tolerance);
+    // above everything
+    BOOST_CHECK_CLOSE(mr.clip(99999.0), 3150.0, tolerance);
+    // step clipping still works within a located sub-range
+    BOOST_CHECK_CLOSE(mr.clip(1620.4, true), 1620.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.start(), 0.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.stop(), 3150.0, tolerance);
+}
+
 BOOST_AUTO_TEST_CASE(test_ranges_compare)
 {
     range_t range(1);
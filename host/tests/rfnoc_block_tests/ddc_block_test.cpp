@@ -129,3 +129,77 @@ BOOST_AUTO_TEST_CASE(test_ddc_block)
     BOOST_CHECK_EQUAL(test_ddc->get_property<int>("decim", 0), 1);
     BOOST_CHECK_EQUAL(test_ddc->get_property<double>("freq", 0), 0.0);
 }
+
+BOOST_AUTO_TEST_CASE(test_ddc_block_fast_rate_change)
+{
+    node_accessor_t node_accessor{};
+    constexpr uint32_t num_hb  = 2;
+    constexpr uint32_t max_cic = 128;
+    constexpr size_t num_chans = 1;
+    constexpr noc_id_t noc_id  = DDC_BLOCK;
+
+    auto block_container = get_mock_block(noc_id, num_chans, num_chans);
+    auto& ddc_reg_iface  = block_container.reg_iface;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_COMPAT_NUM] =
+        (ddc_block_control::MAJOR_COMPAT << 16) | ddc_block_control::MINOR_COMPAT;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_NUM_HB]        = num_hb;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_CIC_MAX_DECIM] = max_cic;
+    auto test_ddc = block_container.get_block<ddc_block_control>();
+    BOOST_REQUIRE(test_ddc);
+    node_accessor.init_props(test_ddc.get());
+
+    // The fast path requires a valid input rate
+    BOOST_REQUIRE_THROW(test_ddc->set_output_rate_fast(0.25, 0), uhd::runtime_error);
+
+    detail::graph_t graph{};
+    detail::graph_t::graph_edge_t edge_info;
+    edge_info.src_port                    = 0;
+    edge_info.dst_port                    = 0;
+    edge_info.property_propagation_active = true;
+    edge_info.edge                        = detail::graph_t::graph_edge_t::DYNAMIC;
+
+    mock_terminator_t mock_source_term(1);
+    mock_terminator_t mock_sink_term(1);
+    mock_source_term.set_edge_property<std::string>(
+        "type", "sc16", {res_source_info::OUTPUT_EDGE, 0});
+    mock_source_term.set_edge_property<double>(
+        "scaling", 1.0, {res_source_info::OUTPUT_EDGE, 0});
+    mock_source_term.set_edge_property<double>(
+        "samp_rate", 1.0, {res_source_info::OUTPUT_EDGE, 0});
+
+    graph.connect(&mock_source_term, test_ddc.get(), edge_info);
+    graph.connect(test_ddc.get(), &mock_sink_term, edge_info);
+    graph.commit();
+
+    // Rates that don't hit a legal decimation exactly must not be coerced
+    BOOST_REQUIRE_THROW(test_ddc->set_output_rate_fast(0.3, 0), uhd::value_error);
+    BOOST_REQUIRE_THROW(
+        test_ddc->set_output_rate_fast(1.0 / (max_cic * (1 << num_hb) * 2), 0),
+        uhd::value_error);
+
+    // A legal rate updates the registers and this block's properties...
+    BOOST_CHECK_EQUAL(test_ddc->set_output_rate_fast(0.25, 0), 0.25);
+    BOOST_REQUIRE(ddc_reg_iface->write_memory.count(ddc_block_control::SR_DECIM_ADDR));
+    BOOST_CHECK_EQUAL(
+        ddc_reg_iface->write_memory.at(ddc_block_control::SR_DECIM_ADDR), 2 << 8 | 1);
+    // ...but does not propagate through the graph. We peek at the sink's
+    // property directly, because get_edge_property() would trigger a full
+    // resolution.
+    auto sink_rate_props = node_accessor.filter_props(
+        &mock_sink_term, [](property_base_t* prop) -> bool {
+            return prop->get_id() == "samp_rate"
+                   && prop->get_src_info()
+                          == res_source_info{res_source_info::INPUT_EDGE, 0};
+        });
+    BOOST_REQUIRE_EQUAL(sink_rate_props.size(), 1);
+    BOOST_CHECK_EQUAL(
+        dynamic_cast<property_t<double>*>(*sink_rate_props.begin())->get(), 1.0);
+
+    // The next full resolution (here: triggered by get_property()) propagates
+    // the new rate downstream
+    BOOST_CHECK_EQUAL(test_ddc->get_property<int>("decim", 0), 4);
+    BOOST_CHECK_EQUAL(test_ddc->get_output_rate(0), 0.25);
+    BOOST_CHECK_EQUAL(mock_sink_term.get_edge_property<double>(
+                          "samp_rate", {res_source_info::INPUT_EDGE, 0}),
+        0.25);
+}
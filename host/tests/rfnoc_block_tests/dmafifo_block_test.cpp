@@ -0,0 +1,83 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/rfnoc/defaults.hpp>
+#include <uhd/rfnoc/dmafifo_block_control.hpp>
+#include <uhd/rfnoc/mock_block.hpp>
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+
+using namespace uhd::rfnoc;
+
+// Redeclare this here, since it's only defined outside of UHD_API
+noc_block_base::make_args_t::~make_args_t() = default;
+
+namespace {
+
+// Register addresses within a FIFO core's register window (see
+// dma_fifo_core_3000.cpp)
+constexpr uint32_t REG_FIFO_INFO      = 0x0000;
+constexpr uint32_t REG_FIFO_MEM_SIZE  = 0x0008;
+constexpr uint32_t REG_FIFO_TIMEOUT   = 0x000C;
+constexpr uint32_t REG_FIFO_FULLNESS  = 0x0010;
+constexpr uint32_t REG_FIFO_ADDR_BASE = 0x0018;
+constexpr uint32_t REG_FIFO_ADDR_MASK = 0x0020;
+constexpr uint32_t REG_FIFO_PACKET_CNT = 0x0028;
+
+//! Magic word in the info register, with the BIST bit cleared
+constexpr uint32_t FIFO_INFO_NO_BIST = 0xF1F00000;
+
+//! Address space between FIFO controls
+constexpr uint32_t REG_OFFSET = 128;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_dmafifo_block)
+{
+    constexpr size_t num_chans = 2;
+    constexpr noc_id_t noc_id  = 0xF1F00000;
+
+    auto block_container = get_mock_block(noc_id, num_chans, num_chans);
+    // Shorthand to save typing
+    auto& reg_iface = block_container.reg_iface;
+    auto set_mem    = [&](const uint32_t addr, const uint32_t data) {
+        reg_iface->read_memory[addr] = data;
+    };
+    // Prime the register space the FIFO cores read at construction time
+    constexpr uint64_t fullness[num_chans]    = {0x1000, (uint64_t(5) << 32) | 0x100};
+    constexpr uint32_t packet_count[num_chans] = {42, 43};
+    for (size_t i = 0; i < num_chans; i++) {
+        const uint32_t base = i * REG_OFFSET;
+        set_mem(base + REG_FIFO_INFO, FIFO_INFO_NO_BIST);
+        // 64-bit RAM words, 27 address bits (128 MiB)
+        set_mem(base + REG_FIFO_MEM_SIZE, (64 << 16) | 27);
+        set_mem(base + REG_FIFO_TIMEOUT, 280);
+        set_mem(base + REG_FIFO_FULLNESS, uint32_t(fullness[i] & 0xFFFFFFFF));
+        set_mem(base + REG_FIFO_FULLNESS + 4, uint32_t(fullness[i] >> 32));
+        set_mem(base + REG_FIFO_ADDR_BASE, 0);
+        set_mem(base + REG_FIFO_ADDR_BASE + 4, 0);
+        set_mem(base + REG_FIFO_ADDR_MASK, 0x07FFFFFF);
+        set_mem(base + REG_FIFO_ADDR_MASK + 4, 0);
+        set_mem(base + REG_FIFO_PACKET_CNT, packet_count[i]);
+    }
+
+    auto test_dmafifo = block_container.get_block<dmafifo_block_control>();
+    BOOST_REQUIRE(test_dmafifo);
+
+    for (size_t i = 0; i < num_chans; i++) {
+        BOOST_CHECK_EQUAL(test_dmafifo->get_fifo_fullness(i), fullness[i]);
+        BOOST_CHECK_EQUAL(test_dmafifo->get_packet_count(i), packet_count[i]);
+    }
+    const auto all_fullness = test_dmafifo->get_fifo_fullness();
+    BOOST_REQUIRE_EQUAL(all_fullness.size(), num_chans);
+    for (size_t i = 0; i < num_chans; i++) {
+        BOOST_CHECK_EQUAL(all_fullness[i], fullness[i]);
+    }
+
+    BOOST_REQUIRE_THROW(test_dmafifo->get_packet_count(num_chans), uhd::assertion_error);
+    BOOST_REQUIRE_THROW(
+        test_dmafifo->get_fifo_fullness(num_chans), uhd::assertion_error);
+}
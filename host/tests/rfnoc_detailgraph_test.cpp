@@ -181,6 +181,63 @@ BOOST_AUTO_TEST_CASE(test_graph)
     BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(test_graph_remove_node)
+{
+    graph_t graph{};
+    uhd::rfnoc::detail::graph_accessor_t graph_accessor(&graph);
+    node_accessor_t node_accessor{};
+
+    auto& bgl_graph = graph_accessor.get_graph();
+
+    mock_radio_node_t mock_rx_radio(0);
+    mock_radio_node_t mock_tx_radio(1);
+    node_accessor.init_props(&mock_rx_radio);
+    node_accessor.init_props(&mock_tx_radio);
+
+    uhd::rfnoc::detail::graph_t::graph_edge_t edge_info(
+        0, 0, graph_t::graph_edge_t::DYNAMIC, true);
+
+    graph.connect(&mock_rx_radio, &mock_tx_radio, edge_info);
+    graph.commit();
+    BOOST_CHECK_EQUAL(boost::num_vertices(bgl_graph), 2);
+    BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 1);
+
+    // Removing a node that was never added is a no-op
+    mock_radio_node_t mock_other_radio(2);
+    node_accessor.init_props(&mock_other_radio);
+    graph.remove_node(&mock_other_radio);
+    BOOST_CHECK_EQUAL(boost::num_vertices(bgl_graph), 2);
+
+    // Remove the sink: its edge must go away with it
+    graph.remove_node(&mock_tx_radio);
+    BOOST_CHECK_EQUAL(boost::num_vertices(bgl_graph), 1);
+    BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 0);
+
+    // Resolutions triggered by the remaining node must no longer reach the
+    // removed node, but must still work for the remaining node itself
+    const size_t tx_rssi_count = mock_tx_radio.rssi_resolver_count;
+    mock_rx_radio.set_property<double>("master_clock_rate", 100e6, 0);
+    BOOST_CHECK_CLOSE(
+        mock_rx_radio.get_property<double>("master_clock_rate", 0), 100e6, 1e-6);
+    BOOST_CHECK_EQUAL(mock_tx_radio.rssi_resolver_count, tx_rssi_count);
+
+    // Setting a property on the removed node resolves locally without
+    // touching the graph
+    mock_tx_radio.set_property<double>("master_clock_rate", 100e6, 0);
+    BOOST_CHECK_CLOSE(
+        mock_tx_radio.get_property<double>("master_clock_rate", 0), 100e6, 1e-6);
+
+    // A replacement sink can be connected and committed as usual, and
+    // graph-wide resolution reaches it
+    mock_rx_radio.set_property<double>("master_clock_rate", 200e6, 0);
+    const size_t other_rssi_count = mock_other_radio.rssi_resolver_count;
+    graph.connect(&mock_rx_radio, &mock_other_radio, edge_info);
+    graph.commit();
+    BOOST_CHECK_EQUAL(boost::num_vertices(bgl_graph), 2);
+    BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 1);
+    BOOST_CHECK(mock_other_radio.rssi_resolver_count > other_rssi_count);
+}
+
 BOOST_AUTO_TEST_CASE(test_graph_unresolvable)
 {
     graph_t graph{};
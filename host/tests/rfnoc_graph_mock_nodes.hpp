@@ -347,6 +347,19 @@ public:
         post_action({res_source_info::INPUT_EDGE, chan}, scmd);
     }
 
+    //! Issue a stream command to all channels in one batch (see post_actions())
+    void issue_stream_cmd_all_chans(uhd::stream_cmd_t stream_cmd)
+    {
+        auto scmd =
+            stream_cmd_action_info::make(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+        scmd->stream_cmd = stream_cmd;
+        std::vector<std::pair<res_source_info, action_info::sptr>> cmds;
+        for (size_t chan = 0; chan < _num_ports; chan++) {
+            cmds.emplace_back(res_source_info(res_source_info::INPUT_EDGE, chan), scmd);
+        }
+        post_actions(cmds);
+    }
+
 private:
     property_t<double> _samp_rate_user{"samp_rate", 1e6, {res_source_info::USER}};
     property_t<double> _samp_rate_in{"samp_rate", 1e6, {res_source_info::INPUT_EDGE}};
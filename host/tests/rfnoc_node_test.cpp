@@ -120,6 +120,15 @@ BOOST_AUTO_TEST_CASE(test_node_prop_access)
 
     TN1.set_property<double>("double_prop", 4.2);
     BOOST_CHECK_EQUAL(TN1.get_property<double>("double_prop"), 4.2);
+
+    // Compile-time keys resolve to the same properties as the string API
+    constexpr prop_key_t<double> double_prop_key{"double_prop"};
+    constexpr prop_key_t<double> bad_prop_key{"nonexistant_prop"};
+    BOOST_CHECK_EQUAL(TN1.get_property(double_prop_key), 4.2);
+    TN1.set_property(double_prop_key, 2.4);
+    BOOST_CHECK_EQUAL(TN1.get_property<double>("double_prop"), 2.4);
+    BOOST_REQUIRE_THROW(TN1.get_property(bad_prop_key), uhd::lookup_error);
+    BOOST_REQUIRE_THROW(TN1.set_property(bad_prop_key, 5.0), uhd::lookup_error);
 }
 
 BOOST_AUTO_TEST_CASE(test_node_accessor)
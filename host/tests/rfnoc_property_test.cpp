@@ -154,6 +154,18 @@ BOOST_AUTO_TEST_CASE(test_dirtifier)
     BOOST_CHECK(!prop_accessor.are_compatible(&dirtifier, &prop_i));
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_key)
+{
+    // The hash is computed at compile time...
+    constexpr prop_key_t<int> key{"int_prop"};
+    static_assert(key.hash == prop_id_hash("int_prop"), "hash must be constexpr");
+    // ...and matches the hash a property stores for the same ID
+    property_t<int> prop_i{"int_prop", 5, {res_source_info::USER}};
+    BOOST_CHECK_EQUAL(prop_i.get_id_hash(), key.hash);
+    BOOST_CHECK_EQUAL(prop_i.get_id_hash(), prop_id_hash(std::string("int_prop")));
+    BOOST_CHECK(prop_id_hash("int_prop") != prop_id_hash("other_prop"));
+}
+
 BOOST_AUTO_TEST_CASE(test_from_str)
 {
     prop_accessor_t prop_accessor{};
@@ -4,11 +4,15 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "../common/alloc_counter.hpp"
+#include "../common/lock_counter.hpp"
 #include "../common/mock_link.hpp"
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 namespace uhd { namespace transport {
 
@@ -53,7 +57,11 @@ public:
         const int32_t timeout_ms)
     {
         frame_buff::uptr buff = _recv_link->get_recv_buff(timeout_ms);
-        mock_header_t header  = *(reinterpret_cast<mock_header_t*>(buff->data()));
+        if (!buff) {
+            // Timed out, like the real transport would
+            return std::make_tuple(frame_buff::uptr(), packet_info_t(), false);
+        }
+        mock_header_t header = *(reinterpret_cast<mock_header_t*>(buff->data()));
 
         packet_info_t info;
         info.eob           = header.eob;
@@ -90,6 +98,11 @@ public:
         return _recv_link->get_recv_frame_size() - sizeof(packet_info_t);
     }
 
+    std::vector<uhd::stream_stats_t::fc_drop_event_t> get_fc_drop_events() const
+    {
+        return {};
+    }
+
 private:
     mock_recv_link::sptr _recv_link;
     size_t _seq_num = 0;
@@ -122,6 +135,11 @@ public:
     {
         rx_streamer_impl::set_scale_factor(chan, scale_factor);
     }
+
+    void set_scheduled_start(const std::chrono::steady_clock::time_point start_time)
+    {
+        rx_streamer_impl::set_scheduled_start(start_time);
+    }
 };
 
 }} // namespace uhd::transport
@@ -241,6 +259,196 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_ts_discontinuity_count)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t num_samps = 20;
+    const uint64_t ticks_per_pkt =
+        static_cast<uint64_t>(num_samps * TICK_RATE / SAMP_RATE);
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    auto recv_one = [&](const bool has_tsf, const uint64_t tsf) {
+        mock_header_t header;
+        header.has_tsf = has_tsf;
+        header.tsf     = tsf;
+        push_back_recv_packet(recv_links[0], header, num_samps);
+        const size_t num_samps_ret =
+            streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    };
+
+    // Contiguous timestamps do not count as discontinuities
+    recv_one(true, 1000);
+    recv_one(true, 1000 + ticks_per_pkt);
+    BOOST_CHECK_EQUAL(streamer->get_stream_stats().num_ts_discontinuities, 0);
+
+    // An untimestamped packet advances the expectation, so a correctly
+    // placed timestamp following it is still contiguous
+    recv_one(false, 0);
+    recv_one(true, 1000 + 3 * ticks_per_pkt);
+    BOOST_CHECK_EQUAL(streamer->get_stream_stats().num_ts_discontinuities, 0);
+
+    // A timestamp jump is detected and counted
+    recv_one(true, 1000 + 10 * ticks_per_pkt);
+    BOOST_CHECK_EQUAL(streamer->get_stream_stats().num_ts_discontinuities, 1);
+
+    // The check re-anchors at the new timestamp
+    recv_one(true, 1000 + 11 * ticks_per_pkt);
+    BOOST_CHECK_EQUAL(streamer->get_stream_stats().num_ts_discontinuities, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_iq_correction)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const std::complex<double> gain(0.75, 0.25);
+    const std::complex<double> offset(-1.5, 0.5);
+    streamer->set_iq_correction(0, gain, offset);
+
+    BOOST_CHECK_THROW(streamer->set_iq_correction(1, gain, offset), uhd::index_error);
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    size_t num_samps_ret =
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+
+    for (size_t j = 0; j < num_samps; j++) {
+        const auto converted =
+            std::complex<float>((j * 2) * SCALE_FACTOR, (j * 2 + 1) * SCALE_FACTOR);
+        const auto expected =
+            converted * std::complex<float>(gain) + std::complex<float>(offset);
+        BOOST_CHECK_EQUAL(expected, buff[j]);
+    }
+
+    // Identity terms restore the uncorrected fast path
+    streamer->set_iq_correction(
+        0, std::complex<double>(1.0, 0.0), std::complex<double>(0.0, 0.0));
+
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+
+    for (size_t j = 0; j < num_samps; j++) {
+        const auto value =
+            std::complex<float>((j * 2) * SCALE_FACTOR, (j * 2 + 1) * SCALE_FACTOR);
+        BOOST_CHECK_EQUAL(value, buff[j]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_iq_correction_requires_float_format)
+{
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, "sc16");
+
+    BOOST_CHECK_THROW(
+        streamer->set_iq_correction(
+            0, std::complex<double>(0.5, 0.0), std::complex<double>(0.0, 0.0)),
+        uhd::value_error);
+
+    // Identity terms are accepted on any format since they change nothing
+    streamer->set_iq_correction(
+        0, std::complex<double>(1.0, 0.0), std::complex<double>(0.0, 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_postproc_decimation)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    // A single unit tap turns the decimator into a pure sample dropper,
+    // which makes the expected output exact
+    streamer->set_postproc(0, uhd::make_fir_decimator(2, {1.0f}));
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps / 2);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    const size_t num_samps_ret =
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps / 2);
+
+    for (size_t k = 0; k < num_samps_ret; k++) {
+        const size_t j = 2 * k;
+        const auto value =
+            std::complex<float>((j * 2) * SCALE_FACTOR, (j * 2 + 1) * SCALE_FACTOR);
+        BOOST_CHECK_EQUAL(value, buff[k]);
+    }
+
+    // Detaching restores the unprocessed path
+    streamer->set_postproc(0, nullptr);
+
+    std::vector<std::complex<float>> full_buff(num_samps);
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    const size_t num_full_ret =
+        streamer->recv(full_buff.data(), full_buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_full_ret, num_samps);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_postproc_filter_across_packets)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t decim = 2;
+    const std::vector<float> taps(4, 0.25f);
+    streamer->set_postproc(0, uhd::make_fir_decimator(decim, taps));
+
+    const size_t samps_per_pkt = 20;
+    const size_t num_pkts      = 2;
+
+    // Reference: the filter must behave as if it ran over the concatenated
+    // input, i.e. packet boundaries are invisible
+    std::vector<std::complex<float>> input(num_pkts * samps_per_pkt);
+    for (size_t n = 0; n < input.size(); n++) {
+        input[n] =
+            std::complex<float>((n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+    }
+    std::vector<std::complex<float>> expected;
+    for (size_t pos = 0; pos + taps.size() <= input.size(); pos += decim) {
+        std::complex<float> acc(0.0f, 0.0f);
+        for (size_t t = 0; t < taps.size(); t++) {
+            acc += input[pos + t] * taps[t];
+        }
+        expected.push_back(acc);
+    }
+
+    mock_header_t header;
+    push_back_recv_packet(recv_links[0], header, samps_per_pkt, 0);
+    push_back_recv_packet(recv_links[0], header, samps_per_pkt, samps_per_pkt);
+
+    std::vector<std::complex<float>> buff(expected.size());
+    uhd::rx_metadata_t metadata;
+
+    const size_t num_samps_ret =
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_REQUIRE_EQUAL(num_samps_ret, expected.size());
+
+    for (size_t k = 0; k < expected.size(); k++) {
+        BOOST_CHECK_EQUAL(expected[k], buff[k]);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_one_channel_multi_packet)
 {
     const size_t NUM_BUFFS_TO_TEST = 5;
@@ -320,6 +528,53 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_multi_packet_with_eob)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_one_channel_aggregate_bursts)
+{
+    // With the aggregate_bursts stream arg, EOBs should not terminate a
+    // multi-packet recv until the requested number of bursts has been read
+    const std::string format("sc16");
+
+    auto recv_links = make_links(1);
+
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["aggregate_bursts"] = "4";
+    auto streamer = std::make_shared<mock_rx_streamer>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    mock_rx_data_xport::uptr xport(std::make_unique<mock_rx_data_xport>(recv_links[0]));
+    streamer->set_scale_factor(0, SCALE_FACTOR);
+    streamer->connect_channel(0, std::move(xport));
+
+    const size_t num_packets = 8;
+    const size_t spp         = streamer->get_max_num_samps();
+    const size_t num_samps   = spp * num_packets;
+    std::vector<std::complex<int16_t>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    // Queue 8 single-packet bursts, i.e. every packet has eob set
+    for (size_t i = 0; i < num_packets; i++) {
+        mock_header_t header;
+        header.has_tsf = true;
+        header.tsf     = i;
+        header.eob     = true;
+        push_back_recv_packet(recv_links[0], header, spp);
+    }
+
+    // Each recv call should deliver four aggregated bursts, with the
+    // metadata of the first packet and the EOB flag of the last
+    for (size_t i = 0; i < num_packets / 4; i++) {
+        std::cout << "receiving aggregated buffer " << i << std::endl;
+
+        size_t num_samps_ret =
+            streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+
+        BOOST_CHECK_EQUAL(num_samps_ret, spp * 4);
+        BOOST_CHECK_EQUAL(metadata.end_of_burst, true);
+        BOOST_CHECK_EQUAL(metadata.has_time_spec, true);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), i * 4);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_two_channel_one_packet)
 {
     const size_t NUM_PKTS_TO_TEST = 5;
@@ -376,6 +631,252 @@ BOOST_AUTO_TEST_CASE(test_recv_two_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_two_channel_parallel_convert)
+{
+    // With the convert_threads stream arg, per-channel conversions are fanned
+    // out to a pool; results must be identical to the serial path
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const std::string format("fc32");
+
+    const size_t num_chans = 2;
+
+    auto recv_links = make_links(num_chans);
+
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["convert_threads"] = "2";
+    auto streamer = std::make_shared<mock_rx_streamer>(num_chans, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    for (size_t i = 0; i < num_chans; i++) {
+        mock_rx_data_xport::uptr xport(
+            std::make_unique<mock_rx_data_xport>(recv_links[i]));
+        streamer->set_scale_factor(i, SCALE_FACTOR);
+        streamer->connect_channel(i, std::move(xport));
+    }
+
+    const size_t num_samps = 20;
+
+    std::vector<std::vector<std::complex<float>>> buffer(num_chans);
+    std::vector<void*> buffers;
+    for (size_t i = 0; i < num_chans; i++) {
+        buffer[i].resize(num_samps);
+        buffers.push_back(&buffer[i].front());
+    }
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        const bool even_iteration = (i % 2 == 0);
+        const bool odd_iteration  = (i % 2 != 0);
+        mock_header_t header;
+        header.eob     = even_iteration;
+        header.has_tsf = odd_iteration;
+        header.tsf     = i;
+
+        size_t samps_pushed = 0;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(recv_links[ch], header, num_samps, samps_pushed);
+            samps_pushed += num_samps;
+        }
+
+        std::cout << "receiving packet " << i << std::endl;
+
+        size_t num_samps_ret = streamer->recv(buffers, num_samps, metadata, 1.0, false);
+
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+        BOOST_CHECK_EQUAL(metadata.end_of_burst, even_iteration);
+        BOOST_CHECK_EQUAL(metadata.has_time_spec, odd_iteration);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), i);
+
+        size_t samps_checked = 0;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            for (size_t samp = 0; samp < num_samps; samp++) {
+                const size_t n   = samps_checked + samp;
+                const auto value = std::complex<float>(
+                    (n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+                BOOST_CHECK_EQUAL(value, buffer[ch][samp]);
+            }
+            samps_checked += num_samps;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_link_liveness)
+{
+    // With the link_timeout_ms stream arg, mid-burst silence beyond the
+    // timeout is reported as link-down rather than a plain timeout
+    const std::string format("sc16");
+
+    auto recv_links = make_links(1);
+
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["link_timeout_ms"] = "5";
+    auto streamer = std::make_shared<mock_rx_streamer>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    mock_rx_data_xport::uptr xport(std::make_unique<mock_rx_data_xport>(recv_links[0]));
+    streamer->set_scale_factor(0, SCALE_FACTOR);
+    streamer->connect_channel(0, std::move(xport));
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<uint16_t>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    // Silence before any packet has arrived is a plain timeout
+    size_t num_samps_ret = streamer->recv(buff.data(), num_samps, metadata, 0.02, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+
+    // A mid-burst packet arms the watchdog...
+    mock_header_t header;
+    header.eob     = false;
+    header.has_tsf = false;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    num_samps_ret = streamer->recv(buff.data(), num_samps, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+
+    // ...so silence beyond the liveness timeout now reports link-down
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    num_samps_ret = streamer->recv(buff.data(), num_samps, metadata, 0.02, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_LINK_DOWN);
+
+    // An end-of-burst stands the watchdog down; silence is normal again
+    header.eob = true;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    num_samps_ret = streamer->recv(buff.data(), num_samps, metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.end_of_burst, true);
+
+    num_samps_ret = streamer->recv(buff.data(), num_samps, metadata, 0.02, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_channel_enable_disable)
+{
+    const std::string format("sc16");
+    const size_t num_chans = 2;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t num_samps = 20;
+
+    std::vector<std::vector<std::complex<uint16_t>>> buffer(num_chans);
+    std::vector<void*> buffers;
+    for (size_t i = 0; i < num_chans; i++) {
+        buffer[i].resize(num_samps);
+        buffers.push_back(&buffer[i].front());
+    }
+
+    uhd::rx_metadata_t metadata;
+    mock_header_t header;
+    header.has_tsf = true;
+
+    // Both channels enabled: regular two-channel receive
+    header.tsf = 0;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        push_back_recv_packet(recv_links[ch], header, num_samps);
+    }
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buffers, num_samps, metadata, 1.0, false), num_samps);
+
+    // Park channel 1; its buffer must stay untouched while channel 0 keeps
+    // streaming and provides the metadata
+    streamer->set_channel_enabled(1, false);
+    BOOST_CHECK(streamer->is_channel_enabled(0));
+    BOOST_CHECK(!streamer->is_channel_enabled(1));
+
+    const auto sentinel = std::complex<uint16_t>(0xDEAD, 0xBEEF);
+    std::fill(buffer[1].begin(), buffer[1].end(), sentinel);
+
+    header.tsf = 100;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buffers, num_samps, metadata, 1.0, false), num_samps);
+    BOOST_CHECK_EQUAL(metadata.has_time_spec, true);
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 100);
+
+    for (size_t samp = 0; samp < num_samps; samp++) {
+        const auto value =
+            std::complex<uint16_t>((samp * 2), (samp * 2 + 1));
+        BOOST_CHECK_EQUAL(value, buffer[0][samp]);
+        BOOST_CHECK_EQUAL(sentinel, buffer[1][samp]);
+    }
+
+    // The last enabled channel cannot be disabled
+    BOOST_CHECK_THROW(streamer->set_channel_enabled(0, false), uhd::value_error);
+
+    // Resume channel 1 and verify two-channel operation is restored
+    streamer->set_channel_enabled(1, true);
+    BOOST_CHECK(streamer->is_channel_enabled(1));
+
+    header.tsf = 200;
+    size_t samps_pushed = 0;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        push_back_recv_packet(recv_links[ch], header, num_samps, samps_pushed);
+        samps_pushed += num_samps;
+    }
+
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buffers, num_samps, metadata, 1.0, false), num_samps);
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 200);
+
+    size_t samps_checked = 0;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        for (size_t samp = 0; samp < num_samps; samp++) {
+            const size_t n   = samps_checked + samp;
+            const auto value = std::complex<uint16_t>((n * 2), (n * 2 + 1));
+            BOOST_CHECK_EQUAL(value, buffer[ch][samp]);
+        }
+        samps_checked += num_samps;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_scheduled_start)
+{
+    const std::string format("sc16");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<uint16_t>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    header.has_tsf = true;
+    header.tsf     = 1000;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    // Although the packet is already available, recv() should sleep out
+    // most of the scheduled gap before it starts polling
+    const auto delay = std::chrono::milliseconds(100);
+    const auto start = std::chrono::steady_clock::now();
+    streamer->set_scheduled_start(start + delay);
+
+    const size_t num_samps_ret =
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK(elapsed >= std::chrono::milliseconds(50));
+
+    // A start time in the past must not delay the following call
+    header.tsf = 2000;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    streamer->set_scheduled_start(
+        std::chrono::steady_clock::now() - std::chrono::seconds(1));
+
+    const auto start2 = std::chrono::steady_clock::now();
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    BOOST_CHECK(std::chrono::steady_clock::now() - start2
+                < std::chrono::milliseconds(500));
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
 {
     const size_t NUM_PKTS_TO_TEST = 5;
@@ -496,6 +997,75 @@ BOOST_AUTO_TEST_CASE(test_recv_seq_error)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_seq_error_tolerated)
+{
+    // Test that with the tolerate_seq_error stream arg, a dropped packet
+    // does not surface as an overflow error: the packet that follows the
+    // hole is delivered in the same call, with the gap reported via the
+    // out_of_sequence flag and the dropped_samps count.
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["tolerate_seq_error"] = "1";
+    auto streamer = std::make_shared<mock_rx_streamer>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    mock_rx_data_xport::uptr xport(
+        std::make_unique<mock_rx_data_xport>(recv_links[0]));
+    streamer->set_scale_factor(0, SCALE_FACTOR);
+    streamer->connect_channel(0, std::move(xport));
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    header.eob        = false;
+    header.has_tsf    = true;
+    header.ignore_seq = false;
+
+    size_t seq_num = 0;
+    size_t tsf     = 0;
+
+    header.seq_num = seq_num++;
+    header.tsf     = tsf;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    // Drop one packet
+    seq_num++;
+    tsf += 2 * num_samps * (TICK_RATE / SAMP_RATE);
+
+    header.seq_num = seq_num++;
+    header.tsf     = tsf;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    // First read succeeds normally
+    size_t num_samps_ret =
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.out_of_sequence, false);
+
+    // Second read delivers data despite the gap and quantifies the hole
+    num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(metadata.out_of_sequence, true);
+    BOOST_CHECK_EQUAL(metadata.dropped_samps, num_samps);
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), tsf);
+
+    // Subsequent reads are back to normal
+    header.seq_num = seq_num++;
+    header.tsf     = tsf + num_samps * (TICK_RATE / SAMP_RATE);
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.out_of_sequence, false);
+    BOOST_CHECK_EQUAL(metadata.dropped_samps, 0);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_bad_packet)
 {
     // Test that when we receive a packet with invalid chdr header or length
@@ -850,3 +1420,96 @@ BOOST_AUTO_TEST_CASE(test_recv_two_channel_aggregate_eov)
         BOOST_CHECK_EQUAL(expected_eov_offsets[i], metadata.eov_positions[i]);
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_recv_steady_state_no_allocs)
+{
+    // recv() is documented to perform no heap allocations in steady state
+    // (see the hot-path note in uhd/stream.hpp); count global allocations
+    // over a run of successful calls to prove it
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t spp      = streamer->get_max_num_samps();
+    const size_t NUM_PKTS = 10;
+    std::vector<std::complex<float>> buff(spp);
+    std::vector<size_t> samps_ret(NUM_PKTS, 0);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    header.has_tsf = true;
+
+    for (size_t i = 0; i < NUM_PKTS + 1; i++) {
+        header.tsf = i * spp;
+        push_back_recv_packet(recv_links[0], header, spp);
+    }
+
+    // One warm-up call so lazily initialized state is not counted
+    streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+
+    size_t num_allocs = 0;
+    {
+        // No BOOST_CHECKs inside this scope: the test framework itself
+        // allocates
+        test_alloc_counter::scoped_alloc_counter counter;
+        for (size_t i = 0; i < NUM_PKTS; i++) {
+            samps_ret[i] =
+                streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+        }
+        num_allocs = counter.count();
+    }
+
+    BOOST_CHECK_EQUAL(num_allocs, 0);
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        BOOST_CHECK_EQUAL(samps_ret[i], spp);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_steady_state_no_locks)
+{
+    // Like the allocation check above, but for mutexes: the recv hot path
+    // must not acquire any lock in steady state
+    if (not test_lock_counter::lock_counter_available()) {
+        return;
+    }
+
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t spp      = streamer->get_max_num_samps();
+    const size_t NUM_PKTS = 10;
+    std::vector<std::complex<float>> buff(spp);
+    std::vector<size_t> samps_ret(NUM_PKTS, 0);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    header.has_tsf = true;
+
+    for (size_t i = 0; i < NUM_PKTS + 1; i++) {
+        header.tsf = i * spp;
+        push_back_recv_packet(recv_links[0], header, spp);
+    }
+
+    // One warm-up call so lazily initialized state is not counted
+    streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+
+    size_t num_locks = 0;
+    {
+        // No BOOST_CHECKs inside this scope: the test framework itself
+        // may take locks
+        test_lock_counter::scoped_lock_counter counter;
+        for (size_t i = 0; i < NUM_PKTS; i++) {
+            samps_ret[i] =
+                streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+        }
+        num_locks = counter.count();
+    }
+
+    BOOST_CHECK_EQUAL(num_locks, 0);
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        BOOST_CHECK_EQUAL(samps_ret[i], spp);
+    }
+}
@@ -0,0 +1,63 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/utils/serial_task_executor.hpp>
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(test_tasks_run_in_order)
+{
+    const size_t NUM_TASKS = 100;
+    std::vector<size_t> order;
+
+    {
+        uhd::serial_task_executor executor("test_exec");
+        for (size_t i = 0; i < NUM_TASKS; i++) {
+            executor.post([&order, i]() { order.push_back(i); });
+        }
+        // Destruction drains the queue
+    }
+
+    BOOST_REQUIRE_EQUAL(order.size(), NUM_TASKS);
+    for (size_t i = 0; i < NUM_TASKS; i++) {
+        BOOST_CHECK_EQUAL(order[i], i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_future_completion)
+{
+    uhd::serial_task_executor executor("test_exec");
+
+    bool ran    = false;
+    auto future = executor.post([&ran]() { ran = true; });
+    future.wait();
+    BOOST_CHECK(ran);
+}
+
+BOOST_AUTO_TEST_CASE(test_task_runs_on_worker_thread)
+{
+    uhd::serial_task_executor executor("test_exec");
+
+    std::thread::id task_thread;
+    executor.post([&task_thread]() { task_thread = std::this_thread::get_id(); })
+        .wait();
+    BOOST_CHECK(task_thread != std::this_thread::get_id());
+}
+
+BOOST_AUTO_TEST_CASE(test_exception_delivered_via_future)
+{
+    uhd::serial_task_executor executor("test_exec");
+
+    auto future = executor.post([]() { throw uhd::runtime_error("boom"); });
+    BOOST_CHECK_THROW(future.get(), uhd::runtime_error);
+
+    // The worker survives a throwing task
+    bool ran = false;
+    executor.post([&ran]() { ran = true; }).wait();
+    BOOST_CHECK(ran);
+}
@@ -18,6 +18,31 @@
 #include <memory>
 #include <vector>
 
+// Cycle counter for the cycles/sample column; on architectures without a
+// user-readable timestamp counter only the wall-clock columns are printed
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    include <x86intrin.h>
+#    define UHD_BENCHMARK_HAS_CYCLE_COUNTER 1
+static inline uint64_t read_cycle_counter()
+{
+    return __rdtsc();
+}
+#elif defined(__aarch64__)
+#    define UHD_BENCHMARK_HAS_CYCLE_COUNTER 1
+static inline uint64_t read_cycle_counter()
+{
+    uint64_t cntvct;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(cntvct));
+    return cntvct;
+}
+#else
+#    define UHD_BENCHMARK_HAS_CYCLE_COUNTER 0
+static inline uint64_t read_cycle_counter()
+{
+    return 0;
+}
+#endif
+
 namespace po = boost::program_options;
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -41,6 +66,12 @@ public:
     {
         using uptr = std::unique_ptr<buff_t>;
         std::vector<uint8_t> data;
+
+        //! No wire-level receive timestamps in the benchmark mock
+        uint64_t wire_time_ns() const
+        {
+            return 0;
+        }
     };
 
     struct packet_info_t
@@ -82,6 +113,11 @@ public:
         return _buff_size;
     }
 
+    std::vector<stream_stats_t::fc_drop_event_t> get_fc_drop_events() const
+    {
+        return {};
+    }
+
 private:
     size_t _buff_size;
     buff_t::uptr _buff;
@@ -362,19 +398,26 @@ void benchmark_rx_streamer(
     // Run benchmark
     uhd::rx_metadata_t md;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time     = std::chrono::steady_clock::now();
+    const uint64_t start_tick = read_cycle_counter();
+    const size_t iterations   = 1e7;
 
     for (size_t i = 0; i < iterations; i++) {
         streamer->recv(buffers, spp, md, 1.0, true);
     }
 
-    const auto end_time = std::chrono::steady_clock::now();
+    const uint64_t end_tick = read_cycle_counter();
+    const auto end_time     = std::chrono::steady_clock::now();
     const std::chrono::duration<double> elapsed_time(end_time - start_time);
     const double time_per_packet = elapsed_time.count() / iterations;
 
     std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+              << time_per_packet * 1e9 << " ns/packet";
+    if (UHD_BENCHMARK_HAS_CYCLE_COUNTER) {
+        std::cout << ", " << double(end_tick - start_tick) / iterations / spp
+                  << " cycles/sample";
+    }
+    std::cout << "\n";
 }
 
 /*!
@@ -395,8 +438,9 @@ void benchmark_tx_streamer(tx_streamer::sptr streamer,
     uhd::tx_metadata_t md;
     md.has_time_spec = use_time_spec;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time     = std::chrono::steady_clock::now();
+    const uint64_t start_tick = read_cycle_counter();
+    const size_t iterations   = 1e7;
 
     for (size_t i = 0; i < iterations; i++) {
         if (use_time_spec) {
@@ -405,12 +449,18 @@ void benchmark_tx_streamer(tx_streamer::sptr streamer,
         streamer->send(buffers, spp, md, 1.0);
     }
 
-    const auto end_time = std::chrono::steady_clock::now();
+    const uint64_t end_tick = read_cycle_counter();
+    const auto end_time     = std::chrono::steady_clock::now();
     const std::chrono::duration<double> elapsed_time(end_time - start_time);
     const double time_per_packet = elapsed_time.count() / iterations;
 
     std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+              << time_per_packet * 1e9 << " ns/packet";
+    if (UHD_BENCHMARK_HAS_CYCLE_COUNTER) {
+        std::cout << ", " << double(end_tick - start_tick) / iterations / spp
+                  << " cycles/sample";
+    }
+    std::cout << "\n";
 }
 
 int UHD_SAFE_MAIN(int argc, char* argv[])
@@ -6,6 +6,7 @@
 //
 
 #include <uhd/types/time_spec.hpp>
+#include <uhdlib/utils/tick_converter.hpp>
 #include <stdint.h>
 #include <boost/test/unit_test.hpp>
 #include <boost/thread.hpp> //sleep
@@ -105,3 +106,32 @@ BOOST_AUTO_TEST_CASE(test_time_error_irrational_rate)
 
     BOOST_CHECK_EQUAL(err, (long long)(0));
 }
+
+BOOST_AUTO_TEST_CASE(test_tick_converter)
+{
+    std::cout << "Testing tick-native time converter..." << std::endl;
+
+    // The converter caches the rate decomposition, so it must reproduce
+    // the time_spec_t conversions exactly at device tick rates
+    static const double rates[] = {1e6, 30.72e6, 122.88e6, 200e6, 1e9};
+    static const long long ticks[] = {
+        0ll, 1ll, 12345ll, 23423436291667ll, 100000000000ll};
+
+    for (const double rate : rates) {
+        const uhd::tick_converter conv(rate);
+        BOOST_CHECK_EQUAL(conv.get_tick_rate(), rate);
+        for (const long long tick : ticks) {
+            const uhd::time_spec_t expected = uhd::time_spec_t::from_ticks(tick, rate);
+            const uhd::time_spec_t actual   = conv.from_ticks(tick);
+            BOOST_CHECK_EQUAL(expected.get_full_secs(), actual.get_full_secs());
+            BOOST_CHECK_CLOSE(expected.get_frac_secs(), actual.get_frac_secs(), 1e-9);
+            BOOST_CHECK_EQUAL(expected.to_ticks(rate), conv.to_ticks(actual));
+        }
+    }
+
+    // Re-rating the converter must behave like a freshly constructed one
+    uhd::tick_converter conv(1.0);
+    conv.set_tick_rate(200e6);
+    BOOST_CHECK_EQUAL(
+        conv.to_ticks(conv.from_ticks(23423436291667ll)), 23423436291667ll);
+}
@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "../common/alloc_counter.hpp"
 #include "../common/mock_link.hpp"
 #include <uhdlib/transport/tx_streamer_impl.hpp>
 #include <boost/test/unit_test.hpp>
@@ -556,6 +557,79 @@ BOOST_AUTO_TEST_CASE(test_send_one_channel_multi_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_one_channel_multi_packet_pipelined)
+{
+    const size_t NUM_BUFFS_TO_TEST = 5;
+    const std::string format("fc64");
+
+    // The pipelined path holds the previous packet's frame while acquiring
+    // the next one, so the link needs at least two send frames
+    const mock_send_link::link_params params = {FRAME_SIZE, 2};
+    auto send_link                           = std::make_shared<mock_send_link>(params);
+
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["convert_pipeline"] = "1";
+    auto streamer = std::make_shared<mock_tx_streamer>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    streamer->set_scale_factor(0, SCALE_FACTOR);
+    streamer->connect_channel(0, std::make_unique<mock_tx_data_xport>(send_link));
+
+    // Allocate metadata
+    uhd::tx_metadata_t metadata;
+    metadata.has_time_spec = true;
+    metadata.time_spec     = uhd::time_spec_t(0.0);
+
+    // Allocate buffer and write data
+    const size_t spp       = streamer->get_max_num_samps();
+    const size_t num_samps = spp * 4;
+    std::vector<std::complex<double>> buff(num_samps);
+    for (size_t i = 0; i < buff.size(); i++) {
+        buff[i] = std::complex<double>(i * 2, i * 2 + 1);
+    }
+
+    // Send packets and check that data, ordering and flags are identical
+    // to the non-pipelined path
+    size_t num_accum_samps = 0;
+
+    for (size_t i = 0; i < NUM_BUFFS_TO_TEST; i++) {
+        metadata.end_of_burst = true;
+        const size_t num_sent = streamer->send(&buff.front(), num_samps, metadata, 1.0);
+        BOOST_CHECK_EQUAL(num_sent, num_samps);
+        metadata.time_spec += uhd::time_spec_t(0, num_sent, SAMP_RATE);
+
+        size_t samps_checked = 0;
+
+        while (samps_checked < num_samps) {
+            mock_tx_data_xport::packet_info_t info;
+            std::complex<uint16_t>* data;
+            size_t packet_samps;
+            boost::shared_array<uint8_t> frame_buff;
+
+            std::tie(info, data, packet_samps, frame_buff) = pop_send_packet(send_link);
+
+            for (size_t j = 0; j < packet_samps; j++) {
+                const size_t n = j + samps_checked;
+                const std::complex<uint16_t> value(
+                    (n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+                BOOST_CHECK_EQUAL(value, data[j]);
+            }
+
+            BOOST_CHECK_EQUAL(
+                packet_samps, info.payload_bytes / sizeof(std::complex<uint16_t>));
+            BOOST_CHECK(info.has_tsf);
+            BOOST_CHECK_EQUAL(
+                info.tsf, (num_accum_samps + samps_checked) * TICK_RATE / SAMP_RATE);
+            samps_checked += packet_samps;
+
+            BOOST_CHECK_EQUAL(info.eob, samps_checked == num_samps);
+        }
+
+        BOOST_CHECK_EQUAL(samps_checked, num_samps);
+        num_accum_samps += samps_checked;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
 {
     const size_t NUM_PKTS_TO_TEST = 30;
@@ -680,3 +754,47 @@ BOOST_AUTO_TEST_CASE(test_spp)
             streamer->get_max_num_samps(), max_pyld / sizeof(std::complex<uint16_t>));
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_send_steady_state_no_allocs)
+{
+    // send() is documented to perform no heap allocations in steady state
+    // (see the hot-path note in uhd/stream.hpp); count global allocations
+    // over a run of successful calls to prove it
+    const std::string format("fc32");
+
+    // Reuse the send memory so the mock link does not allocate per packet
+    // (real links stream from preallocated frame buffers)
+    const mock_send_link::link_params params = {FRAME_SIZE, 1};
+    std::vector<mock_send_link::sptr> send_links = {
+        std::make_shared<mock_send_link>(params, true /* reuse_send_memory */)};
+    auto streamer = make_tx_streamer(send_links, format);
+
+    const size_t spp      = streamer->get_max_num_samps();
+    const size_t NUM_PKTS = 10;
+    std::vector<std::complex<float>> buff(spp);
+    std::vector<size_t> samps_sent(NUM_PKTS, 0);
+
+    uhd::tx_metadata_t metadata;
+    metadata.has_time_spec = true;
+    metadata.time_spec     = uhd::time_spec_t(0.0);
+
+    // One warm-up call so lazily initialized state is not counted
+    streamer->send(buff.data(), buff.size(), metadata, 1.0);
+    metadata.has_time_spec = false;
+
+    size_t num_allocs = 0;
+    {
+        // No BOOST_CHECKs inside this scope: the test framework itself
+        // allocates
+        test_alloc_counter::scoped_alloc_counter counter;
+        for (size_t i = 0; i < NUM_PKTS; i++) {
+            samps_sent[i] = streamer->send(buff.data(), buff.size(), metadata, 1.0);
+        }
+        num_allocs = counter.count();
+    }
+
+    BOOST_CHECK_EQUAL(num_allocs, 0);
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        BOOST_CHECK_EQUAL(samps_sent[i], spp);
+    }
+}
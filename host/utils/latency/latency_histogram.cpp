@@ -0,0 +1,330 @@
+//
+// Copyright 2018 Ettus Research, a National Instruments Company
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Automation-friendly latency measurement in the style of cyclictest:
+// each iteration commands a timed RX burst and measures how much later
+// than the commanded time the samples actually arrive at the caller.
+// That residual covers the whole streamer path (device, transport,
+// kernel, UHD) and its tail percentiles are what degrade first after a
+// kernel or driver change. Optionally, each iteration also attempts a
+// timed response burst (hardware loopback / RTT gating like the
+// responder utility) and counts late bursts.
+//
+// Unlike the responder, this tool has no interactive UI: it prints a
+// full latency histogram with configurable percentile targets as text,
+// CSV, or JSON, for consumption by test automation.
+
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <csignal>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+static bool stop_signal_called = false;
+static void sig_int_handler(int)
+{
+    stop_signal_called = true;
+}
+
+namespace {
+
+struct measurement_results_t
+{
+    std::vector<double> samples_us; // sorted before reporting
+    uint64_t num_rx_errors  = 0;
+    uint64_t num_tx_acks    = 0;
+    uint64_t num_tx_late    = 0;
+    uint64_t num_tx_other   = 0;
+
+    double percentile(const double pct) const
+    {
+        if (samples_us.empty()) {
+            return 0.0;
+        }
+        const size_t index = std::min(samples_us.size() - 1,
+            size_t(std::ceil(pct / 100.0 * samples_us.size())) - 1);
+        return samples_us[index];
+    }
+
+    double mean() const
+    {
+        if (samples_us.empty()) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (const double sample : samples_us) {
+            sum += sample;
+        }
+        return sum / samples_us.size();
+    }
+};
+
+//! Bin the sorted samples into fixed-width buckets of bin_width_us,
+//  keyed by the bin's lower edge
+std::map<int64_t, uint64_t> make_histogram(
+    const std::vector<double>& samples_us, const double bin_width_us)
+{
+    std::map<int64_t, uint64_t> histogram;
+    for (const double sample : samples_us) {
+        const int64_t bin = int64_t(std::floor(sample / bin_width_us));
+        histogram[bin]++;
+    }
+    return histogram;
+}
+
+std::vector<double> parse_percentiles(const std::string& percentile_list)
+{
+    std::vector<double> percentiles;
+    std::vector<std::string> strings;
+    boost::split(strings, percentile_list, boost::is_any_of("\"', "));
+    for (const std::string& str : strings) {
+        if (not str.empty()) {
+            percentiles.push_back(std::stod(str));
+        }
+    }
+    return percentiles;
+}
+
+void write_text(std::ostream& out,
+    const measurement_results_t& results,
+    const std::vector<double>& percentiles,
+    const double bin_width_us)
+{
+    out << "Samples:   " << results.samples_us.size() << std::endl;
+    out << "RX errors: " << results.num_rx_errors << std::endl;
+    if (results.num_tx_acks or results.num_tx_late or results.num_tx_other) {
+        out << "TX acks:   " << results.num_tx_acks << std::endl;
+        out << "TX late:   " << results.num_tx_late << std::endl;
+        out << "TX other:  " << results.num_tx_other << std::endl;
+    }
+    if (results.samples_us.empty()) {
+        return;
+    }
+    out << boost::format("Min:  %10.2f us") % results.samples_us.front() << std::endl;
+    out << boost::format("Mean: %10.2f us") % results.mean() << std::endl;
+    out << boost::format("Max:  %10.2f us") % results.samples_us.back() << std::endl;
+    for (const double pct : percentiles) {
+        out << boost::format("p%-6s %8.2f us") % pct % results.percentile(pct)
+            << std::endl;
+    }
+    out << std::endl << "# Histogram (bin start in us, count)" << std::endl;
+    for (const auto& bin : make_histogram(results.samples_us, bin_width_us)) {
+        out << boost::format("%10.1f %10u") % (bin.first * bin_width_us) % bin.second
+            << std::endl;
+    }
+}
+
+void write_csv(std::ostream& out,
+    const measurement_results_t& results,
+    const double bin_width_us)
+{
+    out << "latency_us,count" << std::endl;
+    for (const auto& bin : make_histogram(results.samples_us, bin_width_us)) {
+        out << (bin.first * bin_width_us) << "," << bin.second << std::endl;
+    }
+}
+
+void write_json(std::ostream& out,
+    const measurement_results_t& results,
+    const std::vector<double>& percentiles,
+    const double bin_width_us)
+{
+    out << "{" << std::endl;
+    out << "  \"samples\": " << results.samples_us.size() << "," << std::endl;
+    out << "  \"rx_errors\": " << results.num_rx_errors << "," << std::endl;
+    out << "  \"tx_acks\": " << results.num_tx_acks << "," << std::endl;
+    out << "  \"tx_late\": " << results.num_tx_late << "," << std::endl;
+    out << "  \"tx_other\": " << results.num_tx_other << "," << std::endl;
+    if (not results.samples_us.empty()) {
+        out << "  \"min_us\": " << results.samples_us.front() << "," << std::endl;
+        out << "  \"mean_us\": " << results.mean() << "," << std::endl;
+        out << "  \"max_us\": " << results.samples_us.back() << "," << std::endl;
+    }
+    out << "  \"percentiles_us\": {";
+    for (size_t i = 0; i < percentiles.size(); i++) {
+        out << (i ? ", " : "") << "\"" << percentiles[i]
+            << "\": " << results.percentile(percentiles[i]);
+    }
+    out << "}," << std::endl;
+    out << "  \"histogram_bin_width_us\": " << bin_width_us << "," << std::endl;
+    out << "  \"histogram\": [";
+    bool first = true;
+    for (const auto& bin : make_histogram(results.samples_us, bin_width_us)) {
+        out << (first ? "" : ", ") << "[" << (bin.first * bin_width_us) << ", "
+            << bin.second << "]";
+        first = false;
+    }
+    out << "]" << std::endl;
+    out << "}" << std::endl;
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    // variables to be set by po
+    std::string args, percentile_list, output_format, output_file;
+    size_t nsamps, nruns;
+    double rate, lead, rtt, bin_width_us;
+
+    // setup the program options
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("args", po::value<std::string>(&args)->default_value(""), "single uhd device address args")
+        ("rate", po::value<double>(&rate)->default_value(1e6), "sample rate for receive and transmit (sps)")
+        ("nsamps", po::value<size_t>(&nsamps)->default_value(256), "number of samples per timed burst")
+        ("nruns", po::value<size_t>(&nruns)->default_value(10000), "number of measurement iterations")
+        ("lead", po::value<double>(&lead)->default_value(0.005), "how far in the future timed bursts are commanded (seconds)")
+        ("rtt", po::value<double>(&rtt)->default_value(0.0), "if nonzero, also send a timed response burst this many seconds after each received burst and count late bursts (requires loopback or unconnected TX)")
+        ("percentiles", po::value<std::string>(&percentile_list)->default_value("50,90,99,99.9,99.99"), "comma-separated percentile targets to report")
+        ("bin-width", po::value<double>(&bin_width_us)->default_value(1.0), "histogram bin width in microseconds")
+        ("format", po::value<std::string>(&output_format)->default_value("text"), "output format: text, csv, or json")
+        ("output", po::value<std::string>(&output_file)->default_value(""), "output filename (empty: stdout)")
+        ("no-realtime", "don't enable real-time priority")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Latency Histogram %s") % desc << std::endl;
+        std::cout
+            << "    Each iteration commands a timed RX burst and measures how much\n"
+               "    later than the commanded time the samples arrive at the caller.\n"
+               "    The resulting latency distribution is reported as a histogram\n"
+               "    with configurable percentile targets, in a format suitable for\n"
+               "    test automation (text, CSV, or JSON).\n"
+            << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    if (output_format != "text" and output_format != "csv" and output_format != "json") {
+        std::cerr << "Unknown output format: " << output_format << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::vector<double> percentiles = parse_percentiles(percentile_list);
+
+    if (vm.count("no-realtime") == 0) {
+        uhd::set_thread_priority_safe();
+    }
+
+    // create a usrp device
+    std::cerr << boost::format("Creating the usrp device with: %s...") % args
+              << std::endl;
+    uhd::usrp::multi_usrp::sptr usrp = uhd::usrp::multi_usrp::make(args);
+    usrp->set_time_now(uhd::time_spec_t(0.0));
+    usrp->set_rx_rate(rate);
+    usrp->set_tx_rate(rate);
+    const double actual_rate = usrp->get_rx_rate();
+    std::cerr << boost::format("Actual rate: %f Msps") % (actual_rate / 1e6) << std::endl;
+
+    uhd::stream_args_t stream_args("fc32");
+    uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
+    uhd::tx_streamer::sptr tx_stream;
+    if (rtt > 0.0) {
+        tx_stream = usrp->get_tx_stream(stream_args);
+    }
+
+    std::vector<std::complex<float>> buffer(nsamps);
+    measurement_results_t results;
+    results.samples_us.reserve(nruns);
+
+    // the time the burst itself occupies on the air
+    const double burst_duration = nsamps / actual_rate;
+
+    std::signal(SIGINT, &sig_int_handler);
+
+    for (size_t nrun = 0; nrun < nruns and not stop_signal_called; nrun++) {
+        uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+        stream_cmd.num_samps  = buffer.size();
+        stream_cmd.stream_now = false;
+        stream_cmd.time_spec  = usrp->get_time_now() + uhd::time_spec_t(lead);
+
+        const auto host_start = std::chrono::steady_clock::now();
+        rx_stream->issue_stream_cmd(stream_cmd);
+
+        uhd::rx_metadata_t rx_md;
+        const size_t num_rx_samps =
+            rx_stream->recv(&buffer.front(), buffer.size(), rx_md, lead + 1.0);
+        const auto host_end = std::chrono::steady_clock::now();
+
+        if (rx_md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE
+            or num_rx_samps != buffer.size()) {
+            results.num_rx_errors++;
+            continue;
+        }
+
+        // The samples cannot arrive before commanded time + burst duration;
+        // everything beyond that is latency added by the streamer path
+        const double elapsed = std::chrono::duration<double>(host_end - host_start).count();
+        results.samples_us.push_back((elapsed - lead - burst_duration) * 1e6);
+
+        if (tx_stream) {
+            uhd::tx_metadata_t tx_md;
+            tx_md.start_of_burst = true;
+            tx_md.end_of_burst   = true;
+            tx_md.has_time_spec  = true;
+            tx_md.time_spec      = rx_md.time_spec + uhd::time_spec_t(rtt);
+            tx_stream->send(&buffer.front(), buffer.size(), tx_md);
+
+            uhd::async_metadata_t async_md;
+            if (tx_stream->recv_async_msg(async_md, rtt + 1.0)) {
+                switch (async_md.event_code) {
+                    case uhd::async_metadata_t::EVENT_CODE_BURST_ACK:
+                        results.num_tx_acks++;
+                        break;
+                    case uhd::async_metadata_t::EVENT_CODE_TIME_ERROR:
+                        results.num_tx_late++;
+                        break;
+                    default:
+                        results.num_tx_other++;
+                        break;
+                }
+            } else {
+                results.num_tx_other++;
+            }
+        }
+    }
+
+    std::sort(results.samples_us.begin(), results.samples_us.end());
+
+    std::ofstream file_stream;
+    if (not output_file.empty()) {
+        file_stream.open(output_file.c_str());
+        if (not file_stream) {
+            std::cerr << "Could not open output file: " << output_file << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& out = output_file.empty() ? std::cout : file_stream;
+
+    if (output_format == "csv") {
+        write_csv(out, results, bin_width_us);
+    } else if (output_format == "json") {
+        write_json(out, results, percentiles, bin_width_us);
+    } else {
+        write_text(out, results, percentiles, bin_width_us);
+    }
+
+    return results.num_rx_errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
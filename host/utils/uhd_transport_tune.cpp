@@ -0,0 +1,430 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Sweeps transport frame/ring geometry (recv_frame_size, num_recv_frames and
+// the send equivalents) against the actual device, NIC and CPU by running a
+// short streaming benchmark for each combination, then recommends the best
+// performing one. With --save, the recommendation is persisted in the user's
+// uhd.conf under a [serial=...] section, where the prefs system picks it up
+// automatically in subsequent sessions.
+
+#include <uhd/convert.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+namespace {
+
+//! Outcome of one streaming trial
+struct trial_result
+{
+    double samps_per_sec          = 0.0;
+    unsigned long long num_errors = 0;
+};
+
+//! One point of the sweep, plus its measured result
+struct trial_point
+{
+    size_t frame_size = 0;
+    size_t num_frames = 0;
+    trial_result result;
+};
+
+std::vector<size_t> parse_size_list(const std::string& list)
+{
+    std::vector<size_t> result;
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","));
+    for (const auto& token : tokens) {
+        if (not token.empty()) {
+            result.push_back(std::stoul(token));
+        }
+    }
+    return result;
+}
+
+//! Receive continuously for the given duration, counting overflows and
+// timeouts as errors
+trial_result run_rx_trial(uhd::usrp::multi_usrp::sptr usrp, const double duration)
+{
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    auto rx_stream = usrp->get_rx_stream(stream_args);
+
+    const size_t spp = rx_stream->get_max_num_samps();
+    std::vector<std::complex<int16_t>> buff(spp);
+    std::vector<void*> buffs(rx_stream->get_num_channels(), &buff.front());
+
+    uhd::stream_cmd_t cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+    cmd.stream_now = true;
+    rx_stream->issue_stream_cmd(cmd);
+
+    trial_result result;
+    uhd::rx_metadata_t md;
+    unsigned long long num_samps = 0;
+
+    using namespace std::chrono;
+    const auto start_time = steady_clock::now();
+    const auto end_time   = start_time + milliseconds(int64_t(duration * 1000));
+
+    while (steady_clock::now() < end_time) {
+        num_samps += rx_stream->recv(buffs, spp, md, 0.5);
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW
+            or md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+            result.num_errors++;
+        }
+    }
+
+    const double elapsed =
+        duration_cast<std::chrono::duration<double>>(steady_clock::now() - start_time)
+            .count();
+    result.samps_per_sec = num_samps / elapsed;
+
+    rx_stream->issue_stream_cmd(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
+
+    // Drain until the stream stops so buffers are released before teardown
+    while (rx_stream->recv(buffs, spp, md, 0.2)) {
+        // nop
+    }
+
+    return result;
+}
+
+//! Transmit continuously for the given duration, counting underflows and
+// sequence errors reported on the async message queue as errors
+trial_result run_tx_trial(uhd::usrp::multi_usrp::sptr usrp, const double duration)
+{
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    auto tx_stream = usrp->get_tx_stream(stream_args);
+
+    const size_t spp = tx_stream->get_max_num_samps();
+    std::vector<std::complex<int16_t>> buff(spp);
+    std::vector<const void*> buffs(tx_stream->get_num_channels(), &buff.front());
+
+    trial_result result;
+    uhd::tx_metadata_t md;
+    md.start_of_burst = true;
+    unsigned long long num_samps = 0;
+
+    using namespace std::chrono;
+    const auto start_time = steady_clock::now();
+    const auto end_time   = start_time + milliseconds(int64_t(duration * 1000));
+
+    while (steady_clock::now() < end_time) {
+        num_samps += tx_stream->send(buffs, spp, md, 0.5);
+        md.start_of_burst = false;
+    }
+
+    const double elapsed =
+        duration_cast<std::chrono::duration<double>>(steady_clock::now() - start_time)
+            .count();
+    result.samps_per_sec = num_samps / elapsed;
+
+    md.end_of_burst = true;
+    tx_stream->send(buffs, 0, md, 0.5);
+
+    // Collect the error events reported during the burst
+    uhd::async_metadata_t async_md;
+    while (tx_stream->recv_async_msg(async_md, 0.1)) {
+        switch (async_md.event_code) {
+            case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW:
+            case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW_IN_PACKET:
+            case uhd::async_metadata_t::EVENT_CODE_SEQ_ERROR:
+            case uhd::async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST:
+                result.num_errors++;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return result;
+}
+
+//! Returns true when lhs is a better trial outcome than rhs: fewer errors
+// first, then higher throughput
+bool is_better(const trial_result& lhs, const trial_result& rhs)
+{
+    if (lhs.num_errors != rhs.num_errors) {
+        return lhs.num_errors < rhs.num_errors;
+    }
+    return lhs.samps_per_sec > rhs.samps_per_sec;
+}
+
+//! Path of the user's uhd.conf, matching what the prefs system loads
+std::string user_conf_path()
+{
+    const char* xdg_home = std::getenv("XDG_CONFIG_HOME");
+    if (xdg_home != NULL and xdg_home[0] != '\0') {
+        return std::string(xdg_home) + "/uhd.conf";
+    }
+#ifdef UHD_PLATFORM_WIN32
+    const char* home = std::getenv("APPDATA");
+#else
+    const char* home = std::getenv("HOME");
+#endif
+    if (home == NULL) {
+        throw std::runtime_error("Cannot determine the user config directory");
+    }
+#ifdef UHD_PLATFORM_WIN32
+    return std::string(home) + "/uhd.conf";
+#else
+    return std::string(home) + "/.config/uhd.conf";
+#endif
+}
+
+//! Merge the recommended keys into the config file, preserving everything
+// else in it (including comments). The keys are replaced if the section
+// already contains them, otherwise inserted; a missing section is appended.
+void save_recommendation(const std::string& path,
+    const std::string& section,
+    const uhd::device_addr_t& recommendation)
+{
+    std::vector<std::string> lines;
+    {
+        std::ifstream in(path.c_str());
+        std::string line;
+        while (std::getline(in, line)) {
+            lines.push_back(line);
+        }
+    }
+
+    const std::string header = "[" + section + "]";
+
+    // Find the section and the line one past its end
+    size_t section_begin = lines.size();
+    size_t section_end   = lines.size();
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (boost::trim_copy(lines[i]) == header) {
+            section_begin = i;
+            section_end   = lines.size();
+            for (size_t j = i + 1; j < lines.size(); j++) {
+                const std::string trimmed = boost::trim_copy(lines[j]);
+                if (not trimmed.empty() and trimmed.front() == '[') {
+                    section_end = j;
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    if (section_begin == lines.size()) {
+        // Section does not exist yet; append it
+        if (not lines.empty() and not lines.back().empty()) {
+            lines.push_back("");
+        }
+        lines.push_back(header);
+        section_begin = lines.size() - 1;
+        section_end   = lines.size();
+    }
+
+    // Drop existing assignments of the recommended keys within the section
+    for (size_t i = section_begin + 1; i < section_end;) {
+        const std::string trimmed = boost::trim_copy(lines[i]);
+        const std::string key = boost::trim_copy(trimmed.substr(0, trimmed.find('=')));
+        if (recommendation.has_key(key)) {
+            lines.erase(lines.begin() + i);
+            section_end--;
+        } else {
+            i++;
+        }
+    }
+
+    // Insert the recommendation right after the section header
+    size_t insert_pos = section_begin + 1;
+    for (const auto& key : recommendation.keys()) {
+        lines.insert(
+            lines.begin() + insert_pos, key + "=" + recommendation.get(key));
+        insert_pos++;
+    }
+
+    std::ofstream out(path.c_str(), std::ios::trunc);
+    if (not out) {
+        throw std::runtime_error("Cannot write config file " + path);
+    }
+    for (const auto& line : lines) {
+        out << line << std::endl;
+    }
+}
+
+//! Sweep one direction (RX or TX) over the frame/ring geometry
+template <typename trial_fn_t>
+trial_point sweep(const uhd::device_addr_t& base_args,
+    const std::string& frame_size_key,
+    const std::string& num_frames_key,
+    const std::vector<size_t>& frame_sizes,
+    const std::vector<size_t>& num_frames_list,
+    const double rate,
+    const double duration,
+    trial_fn_t&& trial_fn)
+{
+    trial_point best;
+
+    for (const size_t frame_size : frame_sizes) {
+        for (const size_t num_frames : num_frames_list) {
+            uhd::device_addr_t args(base_args);
+            args[frame_size_key] = std::to_string(frame_size);
+            args[num_frames_key] = std::to_string(num_frames);
+
+            trial_point point;
+            point.frame_size = frame_size;
+            point.num_frames = num_frames;
+
+            try {
+                // Each combination needs its own device session, since the
+                // link geometry is fixed when the links are created
+                auto usrp = uhd::usrp::multi_usrp::make(args);
+                if (rate > 0) {
+                    usrp->set_rx_rate(rate);
+                    usrp->set_tx_rate(rate);
+                }
+                point.result = trial_fn(usrp, duration);
+            } catch (const std::exception& e) {
+                std::cout << boost::format("  %s=%u %s=%u: failed (%s)")
+                                 % frame_size_key % frame_size % num_frames_key
+                                 % num_frames % e.what()
+                          << std::endl;
+                continue;
+            }
+
+            std::cout << boost::format("  %s=%u %s=%u: %0.3f Msps, %llu errors")
+                             % frame_size_key % frame_size % num_frames_key
+                             % num_frames % (point.result.samps_per_sec / 1e6)
+                             % point.result.num_errors
+                      << std::endl;
+
+            if (best.frame_size == 0 or is_better(point.result, best.result)) {
+                best = point;
+            }
+        }
+    }
+
+    if (best.frame_size == 0) {
+        throw std::runtime_error("All trial combinations failed");
+    }
+
+    return best;
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string args_str, recv_frame_sizes_str, num_recv_frames_str;
+    std::string send_frame_sizes_str, num_send_frames_str;
+    double rate, duration;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("args", po::value<std::string>(&args_str)->default_value(""), "device address args")
+        ("rate", po::value<double>(&rate)->default_value(0.0), "sample rate for the trials (0 = device default)")
+        ("duration", po::value<double>(&duration)->default_value(2.0), "duration of each trial in seconds")
+        ("recv-frame-sizes", po::value<std::string>(&recv_frame_sizes_str)->default_value("1472,4000,8000"), "comma-separated recv_frame_size values to try")
+        ("num-recv-frames", po::value<std::string>(&num_recv_frames_str)->default_value("32,64,128,256"), "comma-separated num_recv_frames values to try")
+        ("send-frame-sizes", po::value<std::string>(&send_frame_sizes_str)->default_value("1472,4000,8000"), "comma-separated send_frame_size values to try")
+        ("num-send-frames", po::value<std::string>(&num_send_frames_str)->default_value("32,64,128,256"), "comma-separated num_send_frames values to try")
+        ("skip-rx", "do not tune the receive direction")
+        ("skip-tx", "do not tune the transmit direction")
+        ("save", "persist the recommendation in the user's uhd.conf")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << "UHD Transport Tune " << desc << std::endl;
+        std::cout << "Benchmarks transport frame/ring geometry against the\n"
+                     "actual device and host, and recommends (optionally\n"
+                     "persists) the best performing combination.\n"
+                  << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    uhd::set_thread_priority_safe();
+
+    const uhd::device_addr_t base_args(args_str);
+    uhd::device_addr_t recommendation;
+
+    // Grab the motherboard serial for the prefs section before sweeping
+    std::string serial;
+    {
+        auto usrp = uhd::usrp::multi_usrp::make(base_args);
+        serial    = usrp->get_usrp_rx_info(0).get("mboard_serial", "");
+    }
+
+    if (not vm.count("skip-rx")) {
+        std::cout << "Tuning receive direction..." << std::endl;
+        const trial_point best = sweep(base_args,
+            "recv_frame_size",
+            "num_recv_frames",
+            parse_size_list(recv_frame_sizes_str),
+            parse_size_list(num_recv_frames_str),
+            rate,
+            duration,
+            [](uhd::usrp::multi_usrp::sptr usrp, const double d) {
+                return run_rx_trial(usrp, d);
+            });
+        recommendation["recv_frame_size"] = std::to_string(best.frame_size);
+        recommendation["num_recv_frames"] = std::to_string(best.num_frames);
+    }
+
+    if (not vm.count("skip-tx")) {
+        std::cout << "Tuning transmit direction..." << std::endl;
+        const trial_point best = sweep(base_args,
+            "send_frame_size",
+            "num_send_frames",
+            parse_size_list(send_frame_sizes_str),
+            parse_size_list(num_send_frames_str),
+            rate,
+            duration,
+            [](uhd::usrp::multi_usrp::sptr usrp, const double d) {
+                return run_tx_trial(usrp, d);
+            });
+        recommendation["send_frame_size"] = std::to_string(best.frame_size);
+        recommendation["num_send_frames"] = std::to_string(best.num_frames);
+    }
+
+    if (recommendation.keys().empty()) {
+        std::cout << "Nothing to tune." << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    std::cout << std::endl << "Recommended device args: " << recommendation.to_string()
+              << std::endl;
+
+    if (vm.count("save")) {
+        if (serial.empty()) {
+            std::cerr << "Cannot persist recommendation: device reports no serial"
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        const std::string path = user_conf_path();
+        save_recommendation(path, "serial=" + serial, recommendation);
+        std::cout << boost::format("Saved to %s under [serial=%s]") % path % serial
+                  << std::endl;
+    } else {
+        std::cout << "Re-run with --save to persist this in uhd.conf." << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
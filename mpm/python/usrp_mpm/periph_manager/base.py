@@ -764,6 +764,17 @@ class PeriphManagerBase(object):
             self, self.mboard_sensor_callback_map.get(sensor_name)
         )()
 
+    def get_mb_sensors_values(self, sensor_names):
+        """
+        Return a list of sensor value dictionaries (see get_mb_sensor() for
+        the format), one for every entry of sensor_names, in the same order.
+
+        This is equivalent to calling get_mb_sensor() once per name, but
+        only costs a single RPC round trip, which matters when many sensors
+        are polled periodically (e.g., for telemetry).
+        """
+        return [self.get_mb_sensor(name) for name in sensor_names]
+
     ##########################################################################
     # EEPROMS
     ##########################################################################